@@ -0,0 +1,87 @@
+/**
+ * @file calendar.c
+ * @brief Calendar service implementation
+ */
+
+#include "calendar.h"
+#include "time_of_day.h"
+#include "hijri.h"
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <string.h>
+
+static const char *const day_short_names[7] = {
+    "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"
+};
+
+// Double buffer: the published snapshot is never written, the spare one is rebuilt
+static calendar_snapshot_t snapshots[2];
+static atomic_ptr_t published = ATOMIC_PTR_INIT(NULL);
+
+static uint32_t calendar_recomputes = 0;
+static uint32_t calendar_requests = 0;
+
+// "DD/MM/YYYY" without snprintf
+static void format_date(char *out, int day, int month, int year)
+{
+    tod_put2(out, day % 100);
+    out[2] = '/';
+    tod_put2(out + 3, month % 100);
+    out[5] = '/';
+    tod_put2(out + 6, (year / 100) % 100);
+    tod_put2(out + 8, year % 100);
+    out[10] = '\0';
+}
+
+const calendar_snapshot_t *calendar_update(int year, int month, int day)
+{
+    calendar_requests++;
+
+    int32_t ordinal = tod_days_from_civil(year, month, day);
+    const calendar_snapshot_t *current = atomic_ptr_get(&published);
+
+    if (current && current->ordinal == ordinal) {
+        return current;
+    }
+
+    calendar_snapshot_t *next = (current == &snapshots[0]) ? &snapshots[1] : &snapshots[0];
+
+    next->year = year;
+    next->month = month;
+    next->day = day;
+    next->ordinal = ordinal;
+    next->julian_day = convert_Gregor_2_Julian_Day((float)day, month, year);
+    next->hijri = hijri_from_days(ordinal);
+
+    // 2000-01-01 was a Saturday
+    int weekday = (ordinal + 6) % 7;
+    next->weekday = (weekday < 0) ? weekday + 7 : weekday;
+
+    format_date(next->gregorian_str, day, month, year);
+    format_date(next->hijri_str, next->hijri.day, next->hijri.month, next->hijri.year);
+    strcpy(next->day_short, day_short_names[next->weekday]);
+    next->generation = current ? current->generation + 1 : 1;
+
+    atomic_ptr_set(&published, next);
+    calendar_recomputes++;
+
+    printk("CALENDAR: %s (%s) -> Hijri %s, generation %u\n",
+           next->gregorian_str, next->day_short, next->hijri_str, next->generation);
+
+    return next;
+}
+
+const calendar_snapshot_t *calendar_get(void)
+{
+    return atomic_ptr_get(&published);
+}
+
+void calendar_get_stats(uint32_t *recomputes, uint32_t *requests)
+{
+    if (recomputes) {
+        *recomputes = calendar_recomputes;
+    }
+    if (requests) {
+        *requests = calendar_requests;
+    }
+}
@@ -0,0 +1,62 @@
+/**
+ * @file calendar.h
+ * @brief Calendar service: Julian day, weekday and Hijri date cached per Gregorian date
+ *
+ * The GPS delivers the date once per second, but it only changes once per day.
+ * calendar_update() recomputes the Julian day, weekday, Hijri date and their
+ * display strings only when the Gregorian date actually changes, and publishes the
+ * result as an immutable snapshot shared by the GPS module and main.c.
+ */
+
+#ifndef CALENDAR_H
+#define CALENDAR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "prayerTime.h"
+
+/**
+ * @brief Immutable calendar snapshot for one Gregorian date
+ */
+typedef struct {
+    int year;                   ///< Gregorian year (full year)
+    int month;                  ///< Gregorian month (1-12)
+    int day;                    ///< Gregorian day (1-31)
+    int32_t ordinal;            ///< Days since 2000-01-01
+    double julian_day;          ///< Julian Day at 0h UT
+    int weekday;                ///< Day of week (0=Sunday ... 6=Saturday)
+    hijri_date_t hijri;         ///< Hijri date
+    char gregorian_str[12];     ///< "DD/MM/YYYY"
+    char hijri_str[12];         ///< "DD/MM/YYYY"
+    char day_short[4];          ///< "Sun" ... "Sat"
+    uint32_t generation;        ///< Incremented on every date change
+} calendar_snapshot_t;
+
+/**
+ * @brief Feed the current Gregorian date
+ *
+ * Cheap when the date is unchanged (one integer compare). On a change the new
+ * snapshot is built in a spare buffer and published with a single pointer swap.
+ *
+ * @return Current snapshot
+ */
+const calendar_snapshot_t *calendar_update(int year, int month, int day);
+
+/**
+ * @brief Get the current snapshot
+ *
+ * The returned snapshot is never modified while published; it stays valid until
+ * the date changes twice.
+ *
+ * @return Current snapshot, or NULL before the first date is known
+ */
+const calendar_snapshot_t *calendar_get(void);
+
+/**
+ * @brief Get calendar statistics
+ * @param recomputes Pointer to store number of date conversions performed (can be NULL)
+ * @param requests Pointer to store number of calendar_update() calls (can be NULL)
+ */
+void calendar_get_stats(uint32_t *recomputes, uint32_t *requests);
+
+#endif // CALENDAR_H
@@ -0,0 +1,43 @@
+/**
+ * @file ephemeris.h
+ * @brief Solar ephemeris backends for the prayer time engine
+ *
+ * The prayer engine only needs the sun's apparent declination and the equation of
+ * time. Two backends implement that:
+ *  - Meeus-lite: a few terms of Meeus ch.25, cheap and accurate to ~0.01 degree
+ *  - NREL SPA:   full VSOP87 periodic terms and IAU 1980 nutation (Reda & Andreas)
+ *
+ * The backend is chosen at build time (-DUSE_SPA_EPHEMERIS=1 selects SPA, see
+ * CMakeLists.txt); only the selected one is compiled into the firmware.
+ */
+
+#ifndef EPHEMERIS_H
+#define EPHEMERIS_H
+
+/**
+ * @brief Apparent solar position at one instant
+ */
+typedef struct {
+    double declination;         ///< Apparent declination (radians)
+    double right_ascension;     ///< Apparent right ascension (degrees, 0-360)
+    double equation_of_time;    ///< Equation of time (minutes, apparent minus mean solar time)
+} ephemeris_sun_t;
+
+/**
+ * @brief Ephemeris backend
+ */
+typedef struct {
+    const char *name;                                       ///< Backend name for logs
+    void (*sun)(double jd_ut, ephemeris_sun_t *out);        ///< Solar position at a Julian Day (UT)
+} ephemeris_backend_t;
+
+extern const ephemeris_backend_t ephemeris_meeus_backend;
+extern const ephemeris_backend_t ephemeris_spa_backend;
+
+#ifdef USE_SPA_EPHEMERIS
+#define EPHEMERIS_BACKEND (&ephemeris_spa_backend)
+#else
+#define EPHEMERIS_BACKEND (&ephemeris_meeus_backend)
+#endif
+
+#endif // EPHEMERIS_H
@@ -0,0 +1,68 @@
+/**
+ * @file ephemeris_meeus.c
+ * @brief Low-cost solar ephemeris (Meeus, Astronomical Algorithms ch.25 and ch.28)
+ */
+
+#include "ephemeris.h"
+#include <math.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define DEG2RAD(x) ((x) * (M_PI / 180.0))
+#define RAD2DEG(x) ((x) * (180.0 / M_PI))
+
+// Reduce an angle to 0-360 degrees, keeping the fraction
+static double limit_degrees(double degrees)
+{
+    degrees = fmod(degrees, 360.0);
+    return (degrees < 0.0) ? degrees + 360.0 : degrees;
+}
+
+static void meeus_sun(double jd_ut, ephemeris_sun_t *out)
+{
+    // Julian centuries and millennia from J2000.0
+    double T = (jd_ut - 2451545.0) / 36525.0;
+    double tau = T / 10.0;
+
+    // Sun's mean longitude and mean anomaly
+    double L0 = limit_degrees(280.4664567 + tau * (360007.6982779 + tau * (0.03032028 +
+                              tau * (1.0 / 49931.0 - tau * (1.0 / 15300.0 + tau / 2000000.0)))));
+    double M = limit_degrees(357.52911 + T * (35999.05029 - 0.0001537 * T));
+
+    // Equation of center and true longitude
+    double C = (1.914602 - T * (0.004817 + 0.000014 * T)) * sin(DEG2RAD(M)) +
+               (0.019993 - 0.000101 * T) * sin(DEG2RAD(2.0 * M)) +
+               0.000289 * sin(DEG2RAD(3.0 * M));
+    double true_longitude = L0 + C;
+
+    // Nutation in longitude and obliquity, main terms (degrees)
+    double omega = DEG2RAD(125.04452 - 1934.136261 * T);
+    double L = DEG2RAD(280.4665 + 36000.7698 * T);
+    double L_moon = DEG2RAD(218.3165 + 481267.8813 * T);
+    double delta_psi = (-17.20 * sin(omega) - 1.32 * sin(2.0 * L) - 0.23 * sin(2.0 * L_moon) +
+                        0.21 * sin(2.0 * omega)) / 3600.0;
+    double delta_eps = (9.20 * cos(omega) + 0.57 * cos(2.0 * L) + 0.10 * cos(2.0 * L_moon) -
+                        0.09 * cos(2.0 * omega)) / 3600.0;
+
+    // True obliquity of the ecliptic
+    double eps = 23.43929111 - T * (0.01300416667 + T * (0.0000001638 - 0.00000050361 * T)) + delta_eps;
+
+    // Apparent longitude (aberration), right ascension and declination
+    double lambda = DEG2RAD(true_longitude + delta_psi - 0.00569);
+    double alpha = limit_degrees(RAD2DEG(atan2(cos(DEG2RAD(eps)) * sin(lambda), cos(lambda))));
+
+    out->declination = asin(sin(DEG2RAD(eps)) * sin(lambda));
+    out->right_ascension = alpha;
+
+    // Equation of time (Meeus 28.3), wrapped into +-180 degrees
+    double E = L0 - 0.0057183 - alpha + delta_psi * cos(DEG2RAD(eps));
+    E = limit_degrees(E + 180.0) - 180.0;
+    out->equation_of_time = E * 4.0;
+}
+
+const ephemeris_backend_t ephemeris_meeus_backend = {
+    .name = "Meeus-lite",
+    .sun = meeus_sun,
+};
@@ -0,0 +1,323 @@
+/**
+ * @file ephemeris_spa.c
+ * @brief NREL Solar Position Algorithm backend (Reda & Andreas, NREL/TP-560-34302)
+ *
+ * Heliocentric Earth position from the VSOP87 periodic terms used by SPA, IAU 1980
+ * nutation and the SPA equation of time. Only the geocentric quantities needed by
+ * the prayer engine are computed (no topocentric or refraction steps).
+ */
+
+#include "ephemeris.h"
+#include <math.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define DEG2RAD(x) ((x) * (M_PI / 180.0))
+#define RAD2DEG(x) ((x) * (180.0 / M_PI))
+
+#define ARRAY_LEN(a) (sizeof(a) / sizeof((a)[0]))
+
+// Periodic term A * cos(B + C * JME)
+typedef struct {
+    double a;
+    double b;
+    double c;
+} spa_term_t;
+
+static const spa_term_t L0_terms[] = {
+    {175347046.0, 0, 0}, {3341656.0, 4.6692568, 6283.07585}, {34894.0, 4.6261, 12566.1517},
+    {3497.0, 2.7441, 5753.3849}, {3418.0, 2.8289, 3.5231}, {3136.0, 3.6277, 77713.7715},
+    {2676.0, 4.4181, 7860.4194}, {2343.0, 6.1352, 3930.2097}, {1324.0, 0.7425, 11506.7698},
+    {1273.0, 2.0371, 529.691}, {1199.0, 1.1096, 1577.3435}, {990, 5.233, 5884.927},
+    {902, 2.045, 26.298}, {857, 3.508, 398.149}, {780, 1.179, 5223.694},
+    {753, 2.533, 5507.553}, {505, 4.583, 18849.228}, {492, 4.205, 775.523},
+    {357, 2.92, 0.067}, {317, 5.849, 11790.629}, {284, 1.899, 796.298},
+    {271, 0.315, 10977.079}, {243, 0.345, 5486.778}, {206, 4.806, 2544.314},
+    {205, 1.869, 5573.143}, {202, 2.458, 6069.777}, {156, 0.833, 213.299},
+    {132, 3.411, 2942.463}, {126, 1.083, 20.775}, {115, 0.645, 0.98},
+    {103, 0.636, 4694.003}, {102, 0.976, 15720.839}, {102, 4.267, 7.114},
+    {99, 6.21, 2146.17}, {98, 0.68, 155.42}, {86, 5.98, 161000.69},
+    {85, 1.3, 6275.96}, {85, 3.67, 71430.7}, {80, 1.81, 17260.15},
+    {79, 3.04, 12036.46}, {75, 1.76, 5088.63}, {74, 3.5, 3154.69},
+    {74, 4.68, 801.82}, {70, 0.83, 9437.76}, {62, 3.98, 8827.39},
+    {61, 1.82, 7084.9}, {57, 2.78, 6286.6}, {56, 4.39, 14143.5},
+    {56, 3.47, 6279.55}, {52, 0.19, 12139.55}, {52, 1.33, 1748.02},
+    {51, 0.28, 5856.48}, {49, 0.49, 1194.45}, {41, 5.37, 8429.24},
+    {41, 2.4, 19651.05}, {39, 6.17, 10447.39}, {37, 6.04, 10213.29},
+    {37, 2.57, 1059.38}, {36, 1.71, 2352.87}, {36, 1.78, 6812.77},
+    {33, 0.59, 17789.85}, {30, 0.44, 83996.85}, {30, 2.74, 1349.87},
+    {25, 3.16, 4690.48},
+};
+
+static const spa_term_t L1_terms[] = {
+    {628331966747.0, 0, 0}, {206059.0, 2.678235, 6283.07585}, {4303.0, 2.6351, 12566.1517},
+    {425.0, 1.59, 3.523}, {119.0, 5.796, 26.298}, {109.0, 2.966, 1577.344},
+    {93, 2.59, 18849.23}, {72, 1.14, 529.69}, {68, 1.87, 398.15},
+    {67, 4.41, 5507.55}, {59, 2.89, 5223.69}, {56, 2.17, 155.42},
+    {45, 0.4, 796.3}, {36, 0.47, 775.52}, {29, 2.65, 7.11},
+    {21, 5.34, 0.98}, {19, 1.85, 5486.78}, {19, 4.97, 213.3},
+    {17, 2.99, 6275.96}, {16, 0.03, 2544.31}, {16, 1.43, 2146.17},
+    {15, 1.21, 10977.08}, {12, 2.83, 1748.02}, {12, 3.26, 5088.63},
+    {12, 5.27, 1194.45}, {12, 2.08, 4694}, {11, 0.77, 553.57},
+    {10, 1.3, 6286.6}, {10, 4.24, 1349.87}, {9, 2.7, 242.73},
+    {9, 5.64, 951.72}, {8, 5.3, 2352.87}, {6, 2.65, 9437.76},
+    {6, 4.67, 4690.48},
+};
+
+static const spa_term_t L2_terms[] = {
+    {52919.0, 0, 0}, {8720.0, 1.0721, 6283.0758}, {309.0, 0.867, 12566.152},
+    {27, 0.05, 3.52}, {16, 5.19, 26.3}, {16, 3.68, 155.42},
+    {10, 0.76, 18849.23}, {9, 2.06, 77713.77}, {7, 0.83, 775.52},
+    {5, 4.66, 1577.34}, {4, 1.03, 7.11}, {4, 3.44, 5573.14},
+    {3, 5.14, 796.3}, {3, 6.05, 5507.55}, {3, 1.19, 242.73},
+    {3, 6.12, 529.69}, {3, 0.31, 398.15}, {3, 2.28, 553.57},
+    {2, 4.38, 5223.69}, {2, 3.75, 0.98},
+};
+
+static const spa_term_t L3_terms[] = {
+    {289.0, 5.844, 6283.076}, {35, 0, 0}, {17, 5.49, 12566.15},
+    {3, 5.2, 155.42}, {1, 4.72, 3.52}, {1, 5.3, 18849.23},
+    {1, 5.97, 242.73},
+};
+
+static const spa_term_t L4_terms[] = {
+    {114.0, 3.142, 0}, {8, 4.13, 6283.08}, {1, 3.84, 12566.15},
+};
+
+static const spa_term_t L5_terms[] = {
+    {1, 3.14, 0},
+};
+
+static const spa_term_t B0_terms[] = {
+    {280.0, 3.199, 84334.662}, {102.0, 5.422, 5507.553}, {80, 3.88, 5223.69},
+    {44, 3.7, 2352.87}, {32, 4, 1577.34},
+};
+
+static const spa_term_t B1_terms[] = {
+    {9, 3.9, 5507.55}, {6, 1.73, 5223.69},
+};
+
+static const spa_term_t R0_terms[] = {
+    {100013989.0, 0, 0}, {1670700.0, 3.0984635, 6283.07585}, {13956.0, 3.05525, 12566.1517},
+    {3084.0, 5.1985, 77713.7715}, {1628.0, 1.1739, 5753.3849}, {1576.0, 2.8469, 7860.4194},
+    {925, 5.453, 11506.77}, {542, 4.564, 3930.21}, {472, 3.661, 5884.927},
+    {346, 0.964, 5507.553}, {329, 5.9, 5223.694}, {307, 0.299, 5573.143},
+    {243, 4.273, 11790.629}, {212, 5.847, 1577.344}, {186, 5.022, 10977.079},
+    {175, 3.012, 18849.228}, {110, 5.055, 5486.778}, {98, 0.89, 6069.78},
+    {86, 5.69, 15720.84}, {86, 1.27, 161000.69}, {65, 0.27, 17260.15},
+    {63, 0.92, 529.69}, {57, 2.01, 83996.85}, {56, 5.24, 71430.7},
+    {49, 3.25, 2544.31}, {47, 2.58, 775.52}, {45, 5.54, 9437.76},
+    {43, 6.01, 6275.96}, {39, 5.36, 4694}, {38, 2.39, 8827.39},
+    {37, 0.83, 19651.05}, {37, 4.9, 12139.55}, {36, 1.67, 12036.46},
+    {35, 1.84, 2942.46}, {33, 0.24, 7084.9}, {32, 0.18, 5088.63},
+    {32, 1.78, 398.15}, {28, 1.21, 6286.6}, {28, 1.9, 6279.55},
+    {26, 4.59, 10447.39},
+};
+
+static const spa_term_t R1_terms[] = {
+    {103019.0, 1.10749, 6283.07585}, {1721.0, 1.0644, 12566.1517}, {702, 3.142, 0},
+    {32, 1.02, 18849.23}, {31, 2.84, 5507.55}, {25, 1.32, 5223.69},
+    {18, 1.42, 1577.34}, {10, 5.91, 10977.08}, {9, 1.42, 6275.96},
+    {9, 0.27, 5486.78},
+};
+
+static const spa_term_t R2_terms[] = {
+    {4359.0, 5.7846, 6283.0758}, {124, 5.579, 12566.152}, {12, 3.14, 0},
+    {9, 3.63, 77713.77}, {6, 1.87, 5573.14}, {3, 5.47, 18849.23},
+};
+
+static const spa_term_t R3_terms[] = {
+    {145, 4.273, 6283.076}, {7, 3.92, 12566.15},
+};
+
+static const spa_term_t R4_terms[] = {
+    {4, 2.56, 6283.08},
+};
+
+// Nutation: multipliers of X0..X4 and coefficients a, b (longitude) and c, d (obliquity)
+typedef struct {
+    int8_t y[5];
+    float a;
+    float b;
+    float c;
+    float d;
+} spa_nutation_term_t;
+
+static const spa_nutation_term_t nutation_terms[] = {
+    {{0, 0, 0, 0, 1}, -171996, -174.2f, 92025, 8.9f},
+    {{-2, 0, 0, 2, 2}, -13187, -1.6f, 5736, -3.1f},
+    {{0, 0, 0, 2, 2}, -2274, -0.2f, 977, -0.5f},
+    {{0, 0, 0, 0, 2}, 2062, 0.2f, -895, 0.5f},
+    {{0, 1, 0, 0, 0}, 1426, -3.4f, 54, -0.1f},
+    {{0, 0, 1, 0, 0}, 712, 0.1f, -7, 0},
+    {{-2, 1, 0, 2, 2}, -517, 1.2f, 224, -0.6f},
+    {{0, 0, 0, 2, 1}, -386, -0.4f, 200, 0},
+    {{0, 0, 1, 2, 2}, -301, 0, 129, -0.1f},
+    {{-2, -1, 0, 2, 2}, 217, -0.5f, -95, 0.3f},
+    {{-2, 0, 1, 0, 0}, -158, 0, 0, 0},
+    {{-2, 0, 0, 2, 1}, 129, 0.1f, -70, 0},
+    {{0, 0, -1, 2, 2}, 123, 0, -53, 0},
+    {{2, 0, 0, 0, 0}, 63, 0, 0, 0},
+    {{0, 0, 1, 0, 1}, 63, 0.1f, -33, 0},
+    {{2, 0, -1, 2, 2}, -59, 0, 26, 0},
+    {{0, 0, -1, 0, 1}, -58, -0.1f, 32, 0},
+    {{0, 0, 1, 2, 1}, -51, 0, 27, 0},
+    {{-2, 0, 2, 0, 0}, 48, 0, 0, 0},
+    {{0, 0, -2, 2, 1}, 46, 0, -24, 0},
+    {{2, 0, 0, 2, 2}, -38, 0, 16, 0},
+    {{0, 0, 2, 2, 2}, -31, 0, 13, 0},
+    {{0, 0, 2, 0, 0}, 29, 0, 0, 0},
+    {{-2, 0, 1, 2, 2}, 29, 0, -12, 0},
+    {{0, 0, 0, 2, 0}, 26, 0, 0, 0},
+    {{-2, 0, 0, 2, 0}, -22, 0, 0, 0},
+    {{0, 0, -1, 2, 1}, 21, 0, -10, 0},
+    {{0, 2, 0, 0, 0}, 17, -0.1f, 0, 0},
+    {{2, 0, -1, 0, 1}, 16, 0, -8, 0},
+    {{-2, 2, 0, 2, 2}, -16, 0.1f, 7, 0},
+    {{0, 1, 0, 0, 1}, -15, 0, 9, 0},
+    {{-2, 0, 1, 0, 1}, -13, 0, 7, 0},
+    {{0, -1, 0, 0, 1}, -12, 0, 6, 0},
+    {{0, 0, 2, -2, 0}, 11, 0, 0, 0},
+    {{2, 0, -1, 2, 1}, -10, 0, 5, 0},
+    {{2, 0, 1, 2, 2}, -8, 0, 3, 0},
+    {{0, 1, 0, 2, 2}, 7, 0, -3, 0},
+    {{-2, 1, 1, 0, 0}, -7, 0, 0, 0},
+    {{0, -1, 0, 2, 2}, -7, 0, 3, 0},
+    {{2, 0, 0, 2, 1}, -7, 0, 3, 0},
+    {{2, 0, 1, 0, 0}, 6, 0, 0, 0},
+    {{-2, 0, 2, 2, 2}, 6, 0, -3, 0},
+    {{-2, 0, 1, 2, 1}, 6, 0, -3, 0},
+    {{2, 0, -2, 0, 1}, -6, 0, 3, 0},
+    {{2, 0, 0, 0, 1}, -6, 0, 3, 0},
+    {{0, -1, 1, 0, 0}, 5, 0, 0, 0},
+    {{-2, -1, 0, 2, 1}, -5, 0, 3, 0},
+    {{-2, 0, 0, 0, 1}, -5, 0, 3, 0},
+    {{0, 0, 2, 2, 1}, -5, 0, 3, 0},
+    {{-2, 0, 2, 0, 1}, 4, 0, 0, 0},
+    {{-2, 1, 0, 2, 1}, 4, 0, 0, 0},
+    {{0, 0, 1, -2, 0}, 4, 0, 0, 0},
+    {{-1, 0, 1, 0, 0}, -4, 0, 0, 0},
+    {{-2, 1, 0, 0, 0}, -4, 0, 0, 0},
+    {{1, 0, 0, 0, 0}, -4, 0, 0, 0},
+    {{0, 0, 1, 2, 0}, 3, 0, 0, 0},
+    {{0, 0, -2, 2, 2}, -3, 0, 0, 0},
+    {{-1, -1, 1, 0, 0}, -3, 0, 0, 0},
+    {{0, 1, 1, 0, 0}, -3, 0, 0, 0},
+    {{0, -1, 1, 2, 2}, -3, 0, 0, 0},
+    {{2, -1, -1, 2, 2}, -3, 0, 0, 0},
+    {{0, 0, 3, 2, 2}, -3, 0, 0, 0},
+    {{2, -1, 0, 2, 2}, -3, 0, 0, 0},
+};
+
+static double limit_degrees(double degrees)
+{
+    degrees = fmod(degrees, 360.0);
+    return (degrees < 0.0) ? degrees + 360.0 : degrees;
+}
+
+static double sum_terms(const spa_term_t *terms, size_t count, double jme)
+{
+    double sum = 0.0;
+    for (size_t i = 0; i < count; i++) {
+        sum += terms[i].a * cos(terms[i].b + terms[i].c * jme);
+    }
+    return sum;
+}
+
+// Evaluate sum(k) Sk * JME^k / 1e8 for a series of term tables
+static double earth_series(const spa_term_t *const *tables, const size_t *counts, int n, double jme)
+{
+    double result = 0.0;
+    for (int k = n - 1; k >= 0; k--) {
+        result = result * jme + sum_terms(tables[k], counts[k], jme);
+    }
+    return result / 1.0e8;
+}
+
+// TT - UT in seconds (Espenak & Meeus polynomial, 2005-2050, extended)
+static double delta_t(double jd_ut)
+{
+    double t = (jd_ut - 2451545.0) / 365.25;    // Years since 2000.0
+    return 62.92 + t * (0.32217 + 0.005589 * t);
+}
+
+static void spa_sun(double jd_ut, ephemeris_sun_t *out)
+{
+    static const spa_term_t *const L_tables[] = {L0_terms, L1_terms, L2_terms, L3_terms, L4_terms, L5_terms};
+    static const size_t L_counts[] = {ARRAY_LEN(L0_terms), ARRAY_LEN(L1_terms), ARRAY_LEN(L2_terms),
+                                      ARRAY_LEN(L3_terms), ARRAY_LEN(L4_terms), ARRAY_LEN(L5_terms)};
+    static const spa_term_t *const B_tables[] = {B0_terms, B1_terms};
+    static const size_t B_counts[] = {ARRAY_LEN(B0_terms), ARRAY_LEN(B1_terms)};
+    static const spa_term_t *const R_tables[] = {R0_terms, R1_terms, R2_terms, R3_terms, R4_terms};
+    static const size_t R_counts[] = {ARRAY_LEN(R0_terms), ARRAY_LEN(R1_terms), ARRAY_LEN(R2_terms),
+                                      ARRAY_LEN(R3_terms), ARRAY_LEN(R4_terms)};
+
+    double jde = jd_ut + delta_t(jd_ut) / 86400.0;
+    double jce = (jde - 2451545.0) / 36525.0;
+    double jme = jce / 10.0;
+
+    // Heliocentric longitude, latitude (degrees) and radius vector (AU)
+    double L = limit_degrees(RAD2DEG(earth_series(L_tables, L_counts, 6, jme)));
+    double B = RAD2DEG(earth_series(B_tables, B_counts, 2, jme));
+    double R = earth_series(R_tables, R_counts, 5, jme);
+
+    // Geocentric longitude and latitude
+    double theta = limit_degrees(L + 180.0);
+    double beta = -B;
+
+    // Nutation in longitude and obliquity
+    double x[5];
+    x[0] = 297.85036 + jce * (445267.111480 + jce * (-0.0019142 + jce / 189474.0));
+    x[1] = 357.52772 + jce * (35999.050340 + jce * (-0.0001603 - jce / 300000.0));
+    x[2] = 134.96298 + jce * (477198.867398 + jce * (0.0086972 + jce / 56250.0));
+    x[3] = 93.27191 + jce * (483202.017538 + jce * (-0.0036825 + jce / 327270.0));
+    x[4] = 125.04452 + jce * (-1934.136261 + jce * (0.0020708 + jce / 450000.0));
+
+    double sum_psi = 0.0;
+    double sum_eps = 0.0;
+    for (size_t i = 0; i < ARRAY_LEN(nutation_terms); i++) {
+        const spa_nutation_term_t *t = &nutation_terms[i];
+        double arg = DEG2RAD(x[0] * t->y[0] + x[1] * t->y[1] + x[2] * t->y[2] +
+                             x[3] * t->y[3] + x[4] * t->y[4]);
+        sum_psi += (t->a + t->b * jce) * sin(arg);
+        sum_eps += (t->c + t->d * jce) * cos(arg);
+    }
+    double delta_psi = sum_psi / 36000000.0;
+    double delta_eps = sum_eps / 36000000.0;
+
+    // True obliquity of the ecliptic
+    double U = jme / 10.0;
+    double eps0 = 84381.448 + U * (-4680.93 + U * (-1.55 + U * (1999.25 + U * (-51.38 + U * (-249.67 +
+                  U * (-39.05 + U * (7.12 + U * (27.87 + U * (5.79 + U * 2.45)))))))));
+    double eps = eps0 / 3600.0 + delta_eps;
+
+    // Aberration correction and apparent sun longitude
+    double delta_tau = -20.4898 / (3600.0 * R);
+    double lambda = theta + delta_psi + delta_tau;
+
+    // Geocentric right ascension and declination
+    double lambda_r = DEG2RAD(lambda);
+    double eps_r = DEG2RAD(eps);
+    double beta_r = DEG2RAD(beta);
+    double alpha = limit_degrees(RAD2DEG(atan2(sin(lambda_r) * cos(eps_r) - tan(beta_r) * sin(eps_r),
+                                               cos(lambda_r))));
+
+    out->declination = asin(sin(beta_r) * cos(eps_r) + cos(beta_r) * sin(eps_r) * sin(lambda_r));
+    out->right_ascension = alpha;
+
+    // Equation of time (SPA A.1), sun's mean longitude from the same millennia
+    double M = limit_degrees(280.4664567 + jme * (360007.6982779 + jme * (0.03032028 +
+                             jme * (1.0 / 49931.0 - jme * (1.0 / 15300.0 + jme / 2000000.0)))));
+    double E = M - 0.0057183 - alpha + delta_psi * cos(eps_r);
+    E = limit_degrees(E + 180.0) - 180.0;
+    out->equation_of_time = E * 4.0;
+}
+
+const ephemeris_backend_t ephemeris_spa_backend = {
+    .name = "NREL SPA",
+    .sun = spa_sun,
+};
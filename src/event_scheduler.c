@@ -0,0 +1,242 @@
+/**
+ * @file event_scheduler.c
+ * @brief Event-time scheduler implementation
+ *
+ * The event table is small and fixed (one day of prayers plus resync points), so
+ * it is scanned linearly when re-arming; the expensive part that this replaces is
+ * waking every 500 ms to re-parse time strings, not the scan itself.
+ */
+
+#include "event_scheduler.h"
+#include <zephyr/sys/printk.h>
+#include <errno.h>
+
+#define SCHED_DAY_MS ((int64_t)SCHED_SECONDS_PER_DAY * 1000)
+
+struct sched_event {
+    int32_t sod;            ///< Seconds since local midnight
+    uint8_t type;           ///< sched_event_type_t
+    uint8_t index;          ///< Callback argument
+    bool fired;             ///< Already fired for the current day
+};
+
+static struct sched_event events[SCHED_MAX_EVENTS];
+static int event_count = 0;
+static struct k_spinlock sched_lock;
+
+static sched_callback_t sched_callback = NULL;
+
+// Local clock anchor: local_sod at uptime anchor_uptime_ms
+static int64_t anchor_uptime_ms = 0;
+static int32_t anchor_sod = 0;
+static bool time_anchored = false;
+static int64_t current_day = 0;
+
+static uint32_t main_wakeups = 0;
+static uint32_t events_fired = 0;
+
+K_SEM_DEFINE(sched_wake_sem, 0, 1);
+
+static void sched_work_handler(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(sched_work, sched_work_handler);
+
+static void sched_tick_handler(struct k_timer *timer)
+{
+    k_sem_give(&sched_wake_sem);
+}
+
+K_TIMER_DEFINE(sched_tick_timer, sched_tick_handler, NULL);
+
+/**
+ * @brief Milliseconds since local midnight of the anchor day
+ */
+static int64_t sched_now_ms(void)
+{
+    return (int64_t)anchor_sod * 1000 + (k_uptime_get() - anchor_uptime_ms);
+}
+
+/**
+ * @brief Re-arm the delayable work for the earliest unfired event
+ * Must be called with sched_lock held.
+ */
+static void sched_rearm_locked(int64_t now_ms)
+{
+    int64_t day = now_ms / SCHED_DAY_MS;
+    int32_t sod = (int32_t)((now_ms % SCHED_DAY_MS) / 1000);
+
+    // Midnight is always armed for the date rollover
+    int32_t next_sod = SCHED_SECONDS_PER_DAY;
+    for (int i = 0; i < event_count; i++) {
+        if (!events[i].fired && events[i].sod > sod && events[i].sod < next_sod) {
+            next_sod = events[i].sod;
+        }
+    }
+
+    int64_t delay_ms = day * SCHED_DAY_MS + (int64_t)next_sod * 1000 - now_ms;
+    if (delay_ms < 0) {
+        delay_ms = 0;
+    }
+    k_work_reschedule(&sched_work, K_MSEC(delay_ms));
+}
+
+static void sched_work_handler(struct k_work *work)
+{
+    struct sched_event due[SCHED_MAX_EVENTS + 1];
+    int due_count = 0;
+
+    k_spinlock_key_t key = k_spin_lock(&sched_lock);
+
+    if (!time_anchored) {
+        k_spin_unlock(&sched_lock, key);
+        return;
+    }
+
+    int64_t now_ms = sched_now_ms();
+    int64_t day = now_ms / SCHED_DAY_MS;
+    int32_t sod = (int32_t)((now_ms % SCHED_DAY_MS) / 1000);
+
+    // New local day: every event becomes pending again
+    if (day != current_day) {
+        current_day = day;
+        for (int i = 0; i < event_count; i++) {
+            events[i].fired = false;
+        }
+        due[due_count++] = (struct sched_event){ .sod = 0, .type = SCHED_EVT_DATE_ROLLOVER };
+    }
+
+    for (int i = 0; i < event_count; i++) {
+        if (!events[i].fired && events[i].sod <= sod) {
+            events[i].fired = true;
+            due[due_count++] = events[i];
+        }
+    }
+
+    sched_rearm_locked(now_ms);
+    k_spin_unlock(&sched_lock, key);
+
+    // Callbacks run outside the lock so they may add or clear events
+    for (int i = 0; i < due_count; i++) {
+        events_fired++;
+        if (sched_callback) {
+            sched_callback((sched_event_type_t)due[i].type, due[i].index);
+        }
+    }
+
+    if (due_count > 0) {
+        k_sem_give(&sched_wake_sem);
+    }
+}
+
+void sched_init(sched_callback_t callback)
+{
+    sched_callback = callback;
+    event_count = 0;
+    time_anchored = false;
+
+    // Free-running second tick until the clock is anchored
+    k_timer_start(&sched_tick_timer, K_SECONDS(1), K_SECONDS(1));
+
+    printk("SCHED: Event scheduler initialized (%d event slots)\n", SCHED_MAX_EVENTS);
+}
+
+void sched_set_time(int32_t local_sod)
+{
+    if (local_sod < 0 || local_sod >= SCHED_SECONDS_PER_DAY) {
+        return;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&sched_lock);
+
+    anchor_uptime_ms = k_uptime_get();
+    anchor_sod = local_sod;
+    current_day = 0;
+
+    // Events at or before the new time are considered done for today
+    for (int i = 0; i < event_count; i++) {
+        events[i].fired = (events[i].sod <= local_sod);
+    }
+
+    time_anchored = true;
+    sched_rearm_locked(sched_now_ms());
+    k_spin_unlock(&sched_lock, key);
+
+    // Align the second tick with the new local second boundary
+    k_timer_start(&sched_tick_timer, K_SECONDS(1), K_SECONDS(1));
+}
+
+bool sched_time_valid(void)
+{
+    return time_anchored;
+}
+
+int32_t sched_now(void)
+{
+    if (!time_anchored) {
+        return 0;
+    }
+    return (int32_t)((sched_now_ms() % SCHED_DAY_MS) / 1000);
+}
+
+int sched_add(int32_t sod, sched_event_type_t type, uint8_t index)
+{
+    if (sod < 0 || sod >= SCHED_SECONDS_PER_DAY || type >= SCHED_EVT_TYPE_COUNT) {
+        return -EINVAL;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&sched_lock);
+
+    if (event_count >= SCHED_MAX_EVENTS) {
+        k_spin_unlock(&sched_lock, key);
+        return -ENOMEM;
+    }
+
+    events[event_count].sod = sod;
+    events[event_count].type = (uint8_t)type;
+    events[event_count].index = index;
+    events[event_count].fired = time_anchored && (sod <= sched_now());
+    event_count++;
+
+    if (time_anchored) {
+        sched_rearm_locked(sched_now_ms());
+    }
+
+    k_spin_unlock(&sched_lock, key);
+    return 0;
+}
+
+void sched_clear_type(sched_event_type_t type)
+{
+    k_spinlock_key_t key = k_spin_lock(&sched_lock);
+
+    int kept = 0;
+    for (int i = 0; i < event_count; i++) {
+        if (events[i].type != type) {
+            events[kept++] = events[i];
+        }
+    }
+    event_count = kept;
+
+    k_spin_unlock(&sched_lock, key);
+}
+
+int sched_wait(k_timeout_t timeout)
+{
+    int ret = k_sem_take(&sched_wake_sem, timeout);
+    main_wakeups++;
+    return ret;
+}
+
+void sched_wake(void)
+{
+    k_sem_give(&sched_wake_sem);
+}
+
+void sched_get_stats(uint32_t *wakeups, uint32_t *fired)
+{
+    if (wakeups) {
+        *wakeups = main_wakeups;
+    }
+    if (fired) {
+        *fired = events_fired;
+    }
+}
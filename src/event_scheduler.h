@@ -0,0 +1,100 @@
+/**
+ * @file event_scheduler.h
+ * @brief Event-time scheduler for the day's prayer, highlight, rollover and resync events
+ *
+ * Events are stored as integer seconds since local midnight. A single
+ * k_work_delayable is armed for the earliest pending event, so callbacks fire at
+ * the exact instant instead of being discovered by polling. A 1 Hz k_timer aligned
+ * to the local second boundary wakes the main thread for clock display updates.
+ *
+ * The local clock is propagated from k_uptime between calls to sched_set_time().
+ */
+
+#ifndef EVENT_SCHEDULER_H
+#define EVENT_SCHEDULER_H
+
+#include <zephyr/kernel.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SCHED_MAX_EVENTS        40      ///< Capacity of the day's event table
+#define SCHED_SECONDS_PER_DAY   86400   ///< Seconds in one local day
+
+/**
+ * @brief Event types handled by the scheduler
+ */
+typedef enum {
+    SCHED_EVT_PRAYER = 0,       ///< Prayer instant reached (index = prayer)
+    SCHED_EVT_NEXT_PRAYER,      ///< Next-prayer highlight switches (index = new next prayer)
+    SCHED_EVT_DATE_ROLLOVER,    ///< Local midnight passed (always armed)
+    SCHED_EVT_RESYNC,           ///< Re-anchor the local clock from GPS
+    SCHED_EVT_GPS_WAKE,         ///< Resume full GPS tracking before the day change
+    SCHED_EVT_TYPE_COUNT
+} sched_event_type_t;
+
+/**
+ * @brief Event callback, invoked from the system work queue at the event instant
+ * @param type Event type
+ * @param index Event argument (prayer index for prayer events, 0 otherwise)
+ */
+typedef void (*sched_callback_t)(sched_event_type_t type, uint8_t index);
+
+/**
+ * @brief Initialize the scheduler and start the 1 Hz second tick
+ * @param callback Function called for every fired event
+ */
+void sched_init(sched_callback_t callback);
+
+/**
+ * @brief Anchor the local clock to a known time of day
+ * @param local_sod Local time in seconds since midnight (0-86399)
+ */
+void sched_set_time(int32_t local_sod);
+
+/**
+ * @brief Check whether the local clock has been anchored
+ * @return true after the first sched_set_time() call
+ */
+bool sched_time_valid(void);
+
+/**
+ * @brief Get current local time
+ * @return Seconds since local midnight (0-86399)
+ */
+int32_t sched_now(void);
+
+/**
+ * @brief Add an event for the current day
+ * @param sod Event time in seconds since local midnight
+ * @param type Event type
+ * @param index Event argument passed back to the callback
+ * @return 0 on success, -ENOMEM if the table is full, -EINVAL on bad time
+ */
+int sched_add(int32_t sod, sched_event_type_t type, uint8_t index);
+
+/**
+ * @brief Remove all events of the given type
+ * @param type Event type to remove
+ */
+void sched_clear_type(sched_event_type_t type);
+
+/**
+ * @brief Block until the next second tick or fired event
+ * @param timeout Maximum time to sleep
+ * @return 0 when woken, -EAGAIN on timeout
+ */
+int sched_wait(k_timeout_t timeout);
+
+/**
+ * @brief Wake sched_wait() early, e.g. for an event from another module (any context)
+ */
+void sched_wake(void);
+
+/**
+ * @brief Get scheduler statistics
+ * @param wakeups Pointer to store main-thread wakeups (can be NULL)
+ * @param events_fired Pointer to store number of fired events (can be NULL)
+ */
+void sched_get_stats(uint32_t *wakeups, uint32_t *events_fired);
+
+#endif // EVENT_SCHEDULER_H
@@ -0,0 +1,870 @@
+/**
+ * @file gnss_core.c
+ * @brief GNSS receiver core: RX demultiplexing, NMEA/UBX parsing, fix publication and local time
+ *
+ * Processes RMC, GGA, GSA, GSV and ZDA sentences from any talker (GP, GN, GL...)
+ * and UBX NAV-PVT frames, whichever the backend's receiver sends.
+ */
+
+#include "gnss_core.h"
+#include "font.h"
+#include "prayerTime.h"
+#include "ili9341_parallel.h"
+#include "world_cities.h"
+#include "time_of_day.h"
+#include "calendar.h"
+#include "nmea.h"
+#include "ubx.h"
+#include "gps_events.h"
+#include "utc_clock.h"
+#include "tz_rules.h"
+#include "gnss_sats.h"
+#include "latency_trace.h"
+#include <zephyr/sys/barrier.h>
+#include <zephyr/sys/printk.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+static const gnss_backend_t *gnss_backend;
+
+/*
+ * Fix publication: the work item updates gps_work field by field, then copies it
+ * into the buffer the next generation selects and bumps the generation. Readers
+ * copy the buffer of the generation they saw and retry if it moved meanwhile, so
+ * they never block the writer and never see a half-updated fix.
+ */
+static struct gps_data gps_work = { .utc_sod = TOD_INVALID };     ///< Writer copy (work queue only)
+static struct gps_data gps_published[2] = {
+    { .utc_sod = TOD_INVALID },
+    { .utc_sod = TOD_INVALID },
+};
+static atomic_t gps_generation_count;   ///< Generation n lives in gps_published[n & 1]
+
+// Debug: Store last few NMEA sentences for display
+#define DEBUG_NMEA_COUNT 5
+static char debug_nmea[DEBUG_NMEA_COUNT][80];
+static int debug_nmea_index = 0;
+static uint32_t total_bytes_received = 0;
+static uint32_t total_sentences_parsed = 0;
+static uint32_t calendar_generation = 0;
+
+// Forward declarations
+static void process_nmea_sentence(const nmea_sentence_t *sentence);
+static void process_ubx_frame(const ubx_frame_t *frame);
+
+/*
+ * The RX path feeds the NMEA tokenizer or, from a 0xB5 sync byte on, the UBX
+ * frame parser; both write straight into a free queue slot, and checksum-valid
+ * messages are parsed in a work item.
+ */
+#define GPS_LINE_COUNT      8           ///< Queued messages: a full 1 Hz NMEA burst
+#define GPS_STATS_INTERVAL_MS 5000
+
+// Parser state (UART callback context)
+static nmea_parser_t gps_nmea;
+static ubx_parser_t gps_ubx;
+
+enum {
+    GPS_MSG_NMEA = 0,
+    GPS_MSG_UBX,
+};
+
+// One queue slot holds either message type
+typedef struct {
+    uint8_t type;                       ///< GPS_MSG_NMEA or GPS_MSG_UBX
+    union {
+        nmea_sentence_t nmea;
+        ubx_frame_t ubx;
+    };
+} gps_msg_t;
+
+// Single producer (UART callback) / single consumer (work item) message queue
+static gps_msg_t gps_lines[GPS_LINE_COUNT];
+static gps_msg_t *gps_rx_slot;          ///< Slot both parsers currently write to
+static atomic_t gps_rx_reset;           ///< Set by gnss_core_rx_reset()
+static atomic_t gps_line_head;
+static atomic_t gps_line_tail;
+
+static gps_rx_stats_t rx_stats;
+static uint64_t parse_cycles;
+static uint32_t last_active_second;
+
+static void gps_line_work_handler(struct k_work *work);
+static K_WORK_DEFINE(gps_line_work, gps_line_work_handler);
+
+/**
+ * @brief Free queue slot for the next message, NULL when the queue is full
+ */
+static gps_msg_t *gps_line_slot(void)
+{
+    atomic_val_t head = atomic_get(&gps_line_head);
+
+    if (head - atomic_get(&gps_line_tail) >= GPS_LINE_COUNT) {
+        return NULL;
+    }
+    return &gps_lines[head % GPS_LINE_COUNT];
+}
+
+/**
+ * @brief Publish the message in the claimed slot
+ */
+static void gps_line_publish(uint8_t type)
+{
+    gps_rx_slot->type = type;
+    atomic_inc(&gps_line_head);
+    gps_rx_slot = NULL;
+    gps_nmea.sentence = NULL;
+    gps_ubx.frame = NULL;
+    latency_trace_mark(LATENCY_SENTENCE);
+    k_work_submit(&gps_line_work);
+}
+
+void gnss_core_init(const gnss_backend_t *backend)
+{
+    gnss_backend = backend;
+}
+
+void gnss_core_rx_bytes(const uint8_t *data, size_t len)
+{
+    rx_stats.rx_events++;
+    total_bytes_received += len;
+    latency_trace_rx();
+
+    if (atomic_clear(&gps_rx_reset)) {
+        nmea_parser_abort(&gps_nmea);
+        ubx_parser_abort(&gps_ubx);
+        gps_rx_slot = NULL;
+        gps_nmea.sentence = NULL;
+        gps_ubx.frame = NULL;
+    }
+
+    while (len > 0) {
+        // Claim a slot between messages; without one the next message is dropped
+        if (!gps_rx_slot && nmea_parser_idle(&gps_nmea) && ubx_parser_idle(&gps_ubx)) {
+            gps_rx_slot = gps_line_slot();
+            gps_nmea.sentence = gps_rx_slot ? &gps_rx_slot->nmea : NULL;
+            gps_ubx.frame = gps_rx_slot ? &gps_rx_slot->ubx : NULL;
+        }
+
+        if (!ubx_parser_idle(&gps_ubx) || data[0] == UBX_SYNC1) {
+            // Binary frame: byte-wise, it also cuts off any sentence in progress
+            nmea_parser_abort(&gps_nmea);
+            bool complete = ubx_feed(&gps_ubx, data[0]);
+            data++;
+            len--;
+            if (complete) {
+                gps_line_publish(GPS_MSG_UBX);
+            }
+            continue;
+        }
+
+        // NMEA text up to the next possible UBX sync byte
+        const uint8_t *sync = memchr(data, UBX_SYNC1, len);
+        bool complete;
+        size_t used = nmea_feed_block(&gps_nmea, data, sync ? (size_t)(sync - data) : len,
+                                      &complete);
+        data += used;
+        len -= used;
+
+        if (complete) {
+            // The sentence is already in its slot: publish it
+            gps_line_publish(GPS_MSG_NMEA);
+        }
+    }
+}
+
+void gnss_core_rx_error(void)
+{
+    rx_stats.rx_errors++;
+}
+
+void gnss_core_rx_reset(void)
+{
+    atomic_set(&gps_rx_reset, 1);
+}
+
+uint32_t gnss_core_traffic(void)
+{
+    return gps_nmea.sentences + gps_ubx.frames;
+}
+
+/**
+ * @brief Publish gps_work to readers if it changed (system work queue)
+ */
+static void gps_publish(void)
+{
+    atomic_val_t generation = atomic_get(&gps_generation_count);
+
+    if (memcmp(&gps_work, &gps_published[generation & 1], sizeof(gps_work)) == 0) {
+        return;
+    }
+    latency_trace_mark(LATENCY_PARSED);
+
+    // The other buffer is not the current one: readers only copy it after the
+    // generation below moves, and a reader still copying it from two
+    // generations ago sees the generation change and retries
+    gps_published[(generation + 1) & 1] = gps_work;
+    barrier_dmem_fence_full();
+    atomic_set(&gps_generation_count, generation + 1);
+
+    // Then tell zbus subscribers what changed
+    gps_events_update(&gps_work);
+    latency_trace_mark(LATENCY_PUBLISHED);
+}
+
+/**
+ * @brief Parse queued messages (system work queue)
+ */
+static void gps_line_work_handler(struct k_work *work)
+{
+    static uint32_t last_stats_print = 0;
+
+    rx_stats.work_runs++;
+    uint32_t start = k_cycle_get_32();
+
+    atomic_val_t tail = atomic_get(&gps_line_tail);
+    while (tail != atomic_get(&gps_line_head)) {
+        const gps_msg_t *msg = &gps_lines[tail % GPS_LINE_COUNT];
+
+        if (msg->type == GPS_MSG_UBX) {
+            process_ubx_frame(&msg->ubx);
+        } else {
+            // Store for debug display
+            strncpy(debug_nmea[debug_nmea_index], msg->nmea.text, 79);
+            debug_nmea[debug_nmea_index][79] = '\0';
+            debug_nmea_index = (debug_nmea_index + 1) % DEBUG_NMEA_COUNT;
+
+            process_nmea_sentence(&msg->nmea);
+        }
+        tail++;
+        atomic_set(&gps_line_tail, tail);
+    }
+    gps_publish();
+    parse_cycles += k_cycle_get_32() - start;
+
+    // Seconds with receiver output: the receiver's on-time in power save mode
+    uint32_t second = k_uptime_get_32() / 1000U;
+    if (second != last_active_second) {
+        last_active_second = second;
+        rx_stats.active_s++;
+    }
+
+    // Print statistics every 5 seconds
+    uint32_t now = k_uptime_get_32();
+    if (now - last_stats_print >= GPS_STATS_INTERVAL_MS) {
+        printk("%s Stats: %u bytes, %u sentences, %u UBX frames, %u RX events, %u work runs, "
+               "%u dropped, %u checksum errors, %u framing errors, %u RX errors\n",
+               gnss_backend ? gnss_backend->name : "GNSS",
+               total_bytes_received, total_sentences_parsed, gps_ubx.frames, rx_stats.rx_events,
+               rx_stats.work_runs, gps_nmea.dropped + gps_ubx.dropped,
+               gps_nmea.checksum_errors + gps_ubx.checksum_errors,
+               gps_nmea.framing_errors + gps_ubx.oversize, rx_stats.rx_errors);
+        last_stats_print = now;
+    }
+}
+
+/**
+ * @brief Update the UTC date and the calendar strings derived from it
+ */
+static void gps_set_date(int year, int month, int day)
+{
+    gps_work.utc_day = day;
+    gps_work.utc_month = month;
+    gps_work.utc_year = year;
+    gps_work.date_ordinal = tod_days_from_civil(year, month, day);
+    gps_work.date_valid = true;
+
+    // Julian day, Hijri date and weekday are only recomputed on a date change
+    const calendar_snapshot_t *cal = calendar_update(year, month, day);
+    if (cal->generation != calendar_generation) {
+        calendar_generation = cal->generation;
+        strcpy(gps_work.date_str, cal->gregorian_str);
+        strcpy(gps_work.hijri_date_str, cal->hijri_str);
+        strcpy(gps_work.day_of_week, cal->day_short);
+        gps_work.hijri_valid = true;
+        gps_work.day_valid = true;
+    }
+}
+
+static void gps_set_time(int32_t utc_sod)
+{
+    gps_work.utc_sod = utc_sod;
+    gps_work.utc_update_ms = k_uptime_get_32();
+    tod_format_hhmmss(gps_work.utc_sod, gps_work.time_str);
+}
+
+static void gps_set_position(int32_t lat_e7, int32_t lon_e7)
+{
+    gps_work.latitude = lat_e7 / 1e7;
+    gps_work.longitude = lon_e7 / 1e7;
+    gps_work.lat_hemisphere = (lat_e7 < 0) ? 'S' : 'N';
+    gps_work.lon_hemisphere = (lon_e7 < 0) ? 'W' : 'E';
+    gps_work.valid = true;
+    rx_stats.last_fix_ms = k_uptime_get_32();
+}
+
+/**
+ * @brief Process RMC (Recommended Minimum Course) NMEA sentence
+ * Format: $GPRMC,time,status,lat,lat_dir,lon,lon_dir,speed,course,date,mag_var,mag_dir*hh
+ */
+static void process_gprmc(const nmea_sentence_t *s)
+{
+    int year, month, day;
+    int32_t ms_of_day, lat_e7, lon_e7;
+
+    // Date (field 9, DDMMYY)
+    if (nmea_date(s, 9, &year, &month, &day)) {
+        gps_set_date(year, month, day);
+    }
+
+    // Time (field 1, HHMMSS.SSS)
+    if (nmea_time(s, 1, &ms_of_day)) {
+        gps_set_time(ms_of_day / 1000);
+    }
+
+    // Process position data only from valid GPS fixes (status = 'A')
+    if (nmea_char(s, 2) == 'A' && nmea_coord(s, 3, &lat_e7) && nmea_coord(s, 5, &lon_e7)) {
+        gps_set_position(lat_e7, lon_e7);
+    }
+}
+
+/**
+ * @brief Process ZDA (Time and Date) NMEA sentence
+ * Format: $GPZDA,time,day,month,year,local_hour,local_min*hh
+ */
+static void process_gpzda(const nmea_sentence_t *s)
+{
+    int32_t ms_of_day, day, month, year;
+
+    if (nmea_int(s, 2, &day) && nmea_int(s, 3, &month) && nmea_int(s, 4, &year) &&
+        day >= 1 && day <= 31 && month >= 1 && month <= 12) {
+        gps_set_date(year, month, day);
+    }
+    if (nmea_time(s, 1, &ms_of_day)) {
+        gps_set_time(ms_of_day / 1000);
+    }
+}
+
+/**
+ * @brief Process GGA (Global Positioning System Fix Data) NMEA sentence
+ * Format: $GPGGA,time,lat,N/S,lon,E/W,quality,numSV,HDOP,alt,M,geoid,M,dgps_time,dgps_id*hh
+ */
+static void process_gpgga(const nmea_sentence_t *s)
+{
+    int32_t quality, altitude_cm, hdop_x100;
+
+    if (!nmea_int(s, 6, &quality) || quality == 0) {
+        return;
+    }
+
+    // Altitude (field 9) and HDOP (field 8) only with a fix (quality > 0)
+    if (nmea_fixed(s, 9, 2, &altitude_cm)) {
+        gps_work.seeHeight = altitude_cm / 100.0;
+        gps_work.seeHeight_valid = true;
+    }
+    if (nmea_fixed(s, 8, 2, &hdop_x100) && hdop_x100 > 0) {
+        gps_work.hdop_x100 = (uint16_t)MIN(hdop_x100, UINT16_MAX);
+    }
+}
+
+/**
+ * @brief Process GSA (GPS DOP and Active Satellites) NMEA sentence
+ * Format: $GPGSA,mode,fix_type,sat1,...,sat12,PDOP,HDOP,VDOP*hh
+ */
+static void process_gpgsa(const nmea_sentence_t *s, bool continuation)
+{
+    int32_t fix_type, id;
+    uint8_t ids[GNSS_SATS_PER_GSA];
+    int count = 0;
+
+    // Field 2 contains fix type: 1=no fix, 2=2D fix, 3=3D fix
+    if (!nmea_int(s, 2, &fix_type)) {
+        return;
+    }
+    if (fix_type < 2) {
+        gps_work.valid = false;
+    }
+
+    // Fields 3-14: satellites used in the fix (multi-GNSS: one GSA per constellation)
+    for (int f = 3; f < 3 + GNSS_SATS_PER_GSA; f++) {
+        if (nmea_int(s, f, &id) && id > 0 && id <= UINT8_MAX) {
+            ids[count++] = (uint8_t)id;
+        }
+    }
+    gnss_sats_gsa(gnss_sats_system(&s->text[s->field[0].offset]), fix_type, ids, count,
+                  continuation);
+}
+
+/**
+ * @brief Process GSV (Satellites in View) NMEA sentence, one part of a sequence
+ * Format: $GPGSV,total,number,in_view,{id,elevation,azimuth,SNR}x(1-4)*hh
+ */
+static void process_gpgsv(const nmea_sentence_t *s)
+{
+    int32_t total, number, in_view, value;
+    gnss_sat_t sats[GNSS_SATS_PER_GSV];
+    int count = 0;
+
+    if (!nmea_int(s, 1, &total) || !nmea_int(s, 2, &number) || !nmea_int(s, 3, &in_view) ||
+        number < 1 || number > total) {
+        return;
+    }
+
+    // Four fields per satellite from field 4; empty elevation/azimuth/SNR when unknown
+    for (int f = 4; f + 3 < s->field_count && count < GNSS_SATS_PER_GSV; f += 4) {
+        if (!nmea_int(s, f, &value) || value <= 0 || value > UINT8_MAX) {
+            continue;
+        }
+        gnss_sat_t *sat = &sats[count++];
+        sat->id = (uint8_t)value;
+        sat->elevation = (nmea_int(s, f + 1, &value) && value <= 90) ? (int8_t)value : -1;
+        sat->azimuth = (nmea_int(s, f + 2, &value) && value < 360) ? (uint16_t)value : 0;
+        sat->snr = (nmea_int(s, f + 3, &value) && value <= 99) ? (uint8_t)value : 0;
+    }
+    gnss_sats_gsv(gnss_sats_system(&s->text[s->field[0].offset]), total, number, in_view,
+                  sats, count);
+}
+
+/**
+ * @brief Process NMEA sentence dispatcher (any talker: GP, GN, GL...)
+ */
+static void process_nmea_sentence(const nmea_sentence_t *s)
+{
+    static bool previous_gsa;   // Consecutive GSA sentences list one epoch's satellites
+    bool gsa = nmea_is(s, "GSA");
+
+    total_sentences_parsed++;
+
+    if (nmea_is(s, "RMC")) {
+        process_gprmc(s);
+    } else if (nmea_is(s, "GGA")) {
+        process_gpgga(s);
+    } else if (gsa) {
+        process_gpgsa(s, previous_gsa);
+    } else if (nmea_is(s, "GSV")) {
+        process_gpgsv(s);
+    } else if (nmea_is(s, "ZDA")) {
+        process_gpzda(s);
+    }
+    previous_gsa = gsa;
+}
+
+/**
+ * @brief Process NAV-PVT: date, time, fix, position and height in one frame
+ */
+static void process_nav_pvt(const ubx_nav_pvt_t *pvt)
+{
+    if (pvt->date_valid) {
+        gps_set_date(pvt->year, pvt->month, pvt->day);
+    }
+    if (pvt->time_valid) {
+        gps_set_time((pvt->hour * 60 + pvt->minute) * 60 + pvt->second);
+    }
+
+    // 2D or 3D fix flagged usable (fix types 4/5 are dead reckoning)
+    if (pvt->fix_ok && (pvt->fix_type == 2 || pvt->fix_type == 3)) {
+        gps_set_position(pvt->lat_e7, pvt->lon_e7);
+    } else {
+        gps_work.valid = false;
+    }
+
+    if (pvt->fix_ok && pvt->fix_type == 3) {
+        gps_work.seeHeight = pvt->hmsl_mm / 1000.0;
+        gps_work.seeHeight_valid = true;
+    }
+
+    // NAV-PVT carries no HDOP; position DOP is the closest weight
+    if (pvt->fix_ok) {
+        gps_work.hdop_x100 = pvt->pdop;
+    }
+
+    // No GSV/GSA in UBX mode: the used count is all the satellite table gets
+    gnss_sats_used(pvt->num_sv);
+}
+
+/**
+ * @brief Process UBX frame dispatcher: NAV-PVT here, the rest (ACKs) to the backend
+ */
+static void process_ubx_frame(const ubx_frame_t *frame)
+{
+    ubx_nav_pvt_t pvt;
+
+    if (ubx_decode_nav_pvt(frame, &pvt)) {
+        process_nav_pvt(&pvt);
+    }
+
+    // NAV-PVT also feeds the NEO-7M configuration manager's watchdog
+    if (gnss_backend && gnss_backend->ubx_frame) {
+        gnss_backend->ubx_frame(frame);
+    }
+}
+
+/**
+ * @brief Get the core's part of the receiver statistics
+ */
+void gnss_core_get_rx_stats(gps_rx_stats_t *stats)
+{
+    if (stats) {
+        *stats = rx_stats;
+        stats->bytes = total_bytes_received;
+        stats->sentences = total_sentences_parsed;
+        stats->lines_dropped = gps_nmea.dropped + gps_ubx.dropped;
+        stats->checksum_errors = gps_nmea.checksum_errors + gps_ubx.checksum_errors;
+        stats->framing_errors = gps_nmea.framing_errors + gps_ubx.oversize;
+        stats->ubx_frames = gps_ubx.frames;
+        stats->parse_us = (uint32_t)k_cyc_to_us_floor64(parse_cycles);
+    }
+}
+
+/**
+ * @brief Copy the latest published fix
+ */
+uint32_t gps_snapshot(struct gps_data *out)
+{
+    atomic_val_t generation;
+
+    do {
+        generation = atomic_get(&gps_generation_count);
+        *out = gps_published[generation & 1];
+        barrier_dmem_fence_full();
+    } while (atomic_get(&gps_generation_count) != generation);
+
+    return (uint32_t)generation;
+}
+
+/**
+ * @brief Generation of the latest published fix
+ */
+uint32_t gps_generation(void)
+{
+    return (uint32_t)atomic_get(&gps_generation_count);
+}
+
+/**
+ * @brief Print GPS info to console
+ */
+void gps_print_info(void)
+{
+    struct gps_data gps;
+
+    gps_snapshot(&gps);
+    if (gps.valid) {
+        int lat_int = (int)(fabs(gps.latitude) * 1000000);
+        int lon_int = (int)(fabs(gps.longitude) * 1000000);
+
+        printk("GNSS: Lat: %d.%06d%c, Lon: %d.%06d%c\n",
+               lat_int / 1000000, lat_int % 1000000, gps.lat_hemisphere,
+               lon_int / 1000000, lon_int % 1000000, gps.lon_hemisphere);
+        printk("GNSS: Time: %s UTC, Date: %s\n",
+               gps.time_str, gps.date_str);
+
+        if (gps.seeHeight_valid) {
+            int alt_int = (int)gps.seeHeight;
+            printk("GNSS: Altitude: %d m\n", alt_int);
+        }
+    } else {
+        printk("GNSS: No fix\n");
+    }
+}
+
+/**
+ * @brief Display GPS data on LCD
+ */
+void display_gps_data(const struct device *display_dev, int x, int y)
+{
+    static int search_dots = 0;
+    char status_str[40];
+    struct gps_data gps;
+
+    gps_snapshot(&gps);
+
+    // Always show byte counter and stats at top
+    snprintf(status_str, sizeof(status_str), "RX:%u S:%u",
+             total_bytes_received, total_sentences_parsed);
+    ili9341_draw_string(x, y, status_str, COLOR_YELLOW, COLOR_BLACK, 1);
+
+    // Show last received NMEA sentence for debugging
+    if (debug_nmea_index > 0) {
+        int last_idx = (debug_nmea_index - 1 + DEBUG_NMEA_COUNT) % DEBUG_NMEA_COUNT;
+        if (debug_nmea[last_idx][0] != '\0') {
+            char truncated[31];
+            strncpy(truncated, debug_nmea[last_idx], 30);
+            truncated[30] = '\0';
+            ili9341_draw_string(x, y + 12, truncated, COLOR_GREEN, COLOR_BLACK, 1);
+        }
+    }
+
+    if (gps.valid) {
+        // GPS has fix - show data
+        char time_str[32];
+        char lat_str[32];
+        char lon_str[32];
+        char alt_str[32];
+        char date_str[32];
+
+        int lat_int = (int)(fabs(gps.latitude) * 1000000);
+        int lon_int = (int)(fabs(gps.longitude) * 1000000);
+
+        snprintf(time_str, sizeof(time_str), "%s UTC", gps.time_str);
+        snprintf(lat_str, sizeof(lat_str), "%d.%06d%c",
+                lat_int / 1000000, lat_int % 1000000, gps.lat_hemisphere);
+        snprintf(lon_str, sizeof(lon_str), "%d.%06d%c",
+                lon_int / 1000000, lon_int % 1000000, gps.lon_hemisphere);
+
+        if (gps.date_valid) {
+            snprintf(date_str, sizeof(date_str), "%s", gps.date_str);
+        } else {
+            strcpy(date_str, "---");
+        }
+
+        if (gps.seeHeight_valid) {
+            int alt_int = (int)gps.seeHeight;
+            snprintf(alt_str, sizeof(alt_str), "%dm", alt_int);
+        } else {
+            strcpy(alt_str, "---");
+        }
+
+        int line_y = y + 30;
+
+        // Time
+        ili9341_draw_string(x, line_y, "Time:", COLOR_CYAN, COLOR_BLACK, 1);
+        ili9341_draw_string(x + 50, line_y, time_str, COLOR_WHITE, COLOR_BLACK, 2);
+        line_y += 20;
+
+        // Latitude
+        ili9341_draw_string(x, line_y, "Lat:", COLOR_CYAN, COLOR_BLACK, 1);
+        ili9341_draw_string(x + 50, line_y, lat_str, COLOR_WHITE, COLOR_BLACK, 2);
+        line_y += 20;
+
+        // Longitude
+        ili9341_draw_string(x, line_y, "Long:", COLOR_CYAN, COLOR_BLACK, 1);
+        ili9341_draw_string(x + 50, line_y, lon_str, COLOR_WHITE, COLOR_BLACK, 2);
+        line_y += 20;
+
+        // Altitude
+        ili9341_draw_string(x, line_y, "Alt:", COLOR_CYAN, COLOR_BLACK, 1);
+        ili9341_draw_string(x + 50, line_y, alt_str, COLOR_MAGENTA, COLOR_BLACK, 2);
+        line_y += 20;
+
+        // Date
+        ili9341_draw_string(x, line_y, "Date:", COLOR_CYAN, COLOR_BLACK, 1);
+        ili9341_draw_string(x + 50, line_y, date_str, COLOR_GREEN, COLOR_BLACK, 2);
+
+    } else {
+        // Searching for fix
+        char search_msg[32];
+        search_dots = (search_dots + 1) % 4;
+        switch(search_dots) {
+            case 0: strcpy(search_msg, "Searching   "); break;
+            case 1: strcpy(search_msg, "Searching.  "); break;
+            case 2: strcpy(search_msg, "Searching.. "); break;
+            case 3: strcpy(search_msg, "Searching..."); break;
+        }
+
+        int line_y = y + 30;
+
+        ili9341_draw_string(x, line_y, "No satellite fix", COLOR_YELLOW, COLOR_BLACK, 2);
+        line_y += 20;
+        ili9341_draw_string(x, line_y, search_msg, COLOR_CYAN, COLOR_BLACK, 2);
+        line_y += 25;
+
+        // Show time even without fix
+        if (gps.time_str[0] != '\0') {
+            char time_display[32];
+            snprintf(time_display, sizeof(time_display), "Time: %s UTC", gps.time_str);
+            ili9341_draw_string(x, line_y, time_display, COLOR_WHITE, COLOR_BLACK, 1);
+            line_y += 12;
+        }
+
+        // Show date if available
+        if (gps.date_valid && gps.date_str[0] != '\0') {
+            char date_display[32];
+            snprintf(date_display, sizeof(date_display), "Date: %s", gps.date_str);
+            ili9341_draw_string(x, line_y, date_display, COLOR_GREEN, COLOR_BLACK, 1);
+            line_y += 12;
+        }
+
+        line_y += 10;
+        ili9341_draw_string(x, line_y, "Move to window", COLOR_RED, COLOR_BLACK, 1);
+        line_y += 12;
+        ili9341_draw_string(x, line_y, "for satellite lock", COLOR_RED, COLOR_BLACK, 1);
+    }
+}
+
+/**
+ * @brief Get current date string
+ */
+const char* gps_get_today_date(void)
+{
+    static char today[20];                  // date_str of the last call
+    struct gps_data gps;
+
+    gps_snapshot(&gps);
+    if (gps.date_valid) {
+        strcpy(today, gps.date_str);
+        return today;
+    } else {
+        return "No Date";
+    }
+}
+
+/**
+ * @brief Get GPS statistics
+ */
+void gps_get_stats(uint32_t *bytes_rx, uint32_t *sentences_parsed)
+{
+    if (bytes_rx) {
+        *bytes_rx = total_bytes_received;
+    }
+    if (sentences_parsed) {
+        *sentences_parsed = total_sentences_parsed;
+    }
+}
+
+/**
+ * @brief Print raw NMEA sentences for debugging
+ */
+void gps_print_raw_data(void)
+{
+    struct gps_data gps;
+
+    gps_snapshot(&gps);
+
+    printk("\n========== RAW GPS NMEA DATA ==========\n");
+    printk("Total bytes: %u, Total sentences: %u\n", total_bytes_received, total_sentences_parsed);
+    printk("Last %d NMEA sentences received:\n", DEBUG_NMEA_COUNT);
+
+    // Print the last DEBUG_NMEA_COUNT sentences in order
+    for (int i = 0; i < DEBUG_NMEA_COUNT; i++) {
+        int idx = (debug_nmea_index + i) % DEBUG_NMEA_COUNT;
+        if (debug_nmea[idx][0] != '\0') {
+            printk("  [%d] %s\n", i+1, debug_nmea[idx]);
+        }
+    }
+
+    printk("GPS Valid: %s\n", gps.valid ? "YES" : "NO");
+    if (gps.valid) {
+        printk("Position: %.6f%c, %.6f%c\n",
+               fabs(gps.latitude), gps.lat_hemisphere,
+               fabs(gps.longitude), gps.lon_hemisphere);
+        printk("Time: %s UTC, Date: %s\n", gps.time_str, gps.date_str);
+    }
+    printk("=======================================\n\n");
+}
+
+// Timezone until the position is known - Germany/Berlin (CET/CEST); main thread
+static tz_year_t local_tz = { .zone = TZ_EU_CENTRAL };
+
+void gps_set_timezone(uint8_t zone)
+{
+    // Any year: queries re-expand it for their own
+    tz_year_expand(&local_tz, zone, 2000);
+    printk("Timezone: %s\n", tz_zone_name(zone));
+}
+
+/**
+ * @brief UTC now as seconds since 2000-01-01
+ *
+ * From the disciplined clock once it has GPS time (drift corrected, and correct
+ * across midnight during outages), otherwise the last GPS time carried forward
+ * with the uptime.
+ * @return -1 while no UTC time is known
+ */
+static int32_t gps_utc_now(void)
+{
+    int64_t utc_ms = utc_clock_now_ms();
+    if (utc_ms >= 0) {
+        return (int32_t)(utc_ms / 1000);
+    }
+
+    struct gps_data gps;
+    gps_snapshot(&gps);
+    if (gps.utc_sod < 0 || !gps.date_valid) {
+        return -1;
+    }
+
+    return gps.date_ordinal * TOD_SECONDS_PER_DAY + gps.utc_sod +
+           (int32_t)((k_uptime_get_32() - gps.utc_update_ms) / 1000U);
+}
+
+bool gps_is_dst_active(void)
+{
+    int32_t utc_s = gps_utc_now();
+
+    return utc_s >= 0 && tz_is_dst(&local_tz, utc_s);
+}
+
+int gps_get_current_offset(void)
+{
+    int32_t utc_s = gps_utc_now();
+
+    return (utc_s >= 0) ? tz_offset_min(&local_tz, utc_s) : 0;
+}
+
+/**
+ * @brief Get local time with timezone and DST applied
+ */
+int gps_get_local_time(int32_t *local_sod)
+{
+    if (!local_sod) {
+        return 0;
+    }
+
+    // Not the last GPS time: in power save mode it may be an hour old
+    int32_t utc_s = gps_utc_now();
+    if (utc_s < 0) {
+        *local_sod = TOD_INVALID;
+        return 0;
+    }
+
+    // O(1): the year's two transitions are expanded once
+    int offset_min = tz_offset_min(&local_tz, utc_s);
+
+    // Apply offset and handle day wraparound
+    *local_sod = tod_wrap(utc_s + offset_min * 60);
+    return offset_min;
+}
+
+int gps_calculate_timezone_from_longitude(double longitude)
+{
+    // Earth rotates 360° in 24 hours, so each timezone is ~15° wide
+    int timezone = (int)round(longitude / 15.0);
+
+    // Clamp to valid timezone range [-12, +14]
+    if (timezone < -12) timezone = -12;
+    if (timezone > 14) timezone = 14;
+
+    return timezone;
+}
+
+/**
+ * @brief Configure the timezone from the nearest city or the longitude
+ */
+void gps_auto_configure_timezone(const city_data_t *nearest_city, double longitude, int32_t date_ordinal)
+{
+    if (nearest_city) {
+        printk("GNSS: Nearest city: %s (%s) has timezone %s\n",
+               nearest_city->city_name, nearest_city->country, tz_zone_name(nearest_city->tz));
+        if (local_tz.zone != nearest_city->tz) {
+            gps_set_timezone(nearest_city->tz);
+        }
+    } else {
+        // Calculate timezone from longitude (15 degrees per hour), without DST
+        int calculated_tz = gps_calculate_timezone_from_longitude(longitude);
+
+        printk("GNSS: No nearest city found - using calculated timezone UTC%+d\n", calculated_tz);
+        tz_year_fixed(&local_tz, calculated_tz * 60);
+    }
+
+    // Prayer times are local clock times: the offset of the day they are for, at
+    // local solar noon (not now: on a DST change day they are computed before it)
+    int32_t noon_utc = date_ordinal * TOD_SECONDS_PER_DAY + TOD_SECONDS_PER_DAY / 2 -
+                       (int32_t)lround(longitude * 240.0);
+    int offset_min = tz_offset_min(&local_tz, noon_utc);
+    prayer_set_timezone(offset_min / 60.0);
+
+    printk("GNSS: Longitude: %.4f, timezone configured to UTC%+d:%02d\n",
+           longitude, offset_min / 60, abs(offset_min) % 60);
+}
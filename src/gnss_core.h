@@ -0,0 +1,236 @@
+/**
+ * @file gnss_core.h
+ * @brief GNSS receiver core shared by the NEO-6M and NEO-7M backends
+ *
+ * The core owns everything between received UART bytes and the application:
+ * - RX demultiplexing: NMEA sentences and UBX frames are tokenized straight
+ *   into a message queue (gnss_core_rx_bytes(), UART callback context)
+ * - parsing: RMC, GGA, GSA, GSV, ZDA and UBX NAV-PVT in a system work queue item
+ * - publication: lock-free snapshots (gps_snapshot()) and zbus events (gps_events.h)
+ * - time: local time with the timezone and DST rules of the nearest city (tz_rules.h)
+ *
+ * A backend (gps_neo6m.c, gps_neo7m.c) only brings the transport: it sets up
+ * the UART, hands received bytes to gnss_core_rx_bytes() and may configure the
+ * receiver. The backend is chosen at build time (-DUSE_NEO6M_GPS, CMakeLists.txt).
+ */
+
+#ifndef GNSS_CORE_H
+#define GNSS_CORE_H
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "ubx.h"
+#include "tz_rules.h"
+
+/**
+ * @brief GPS data structure containing parsed NMEA/UBX information
+ */
+struct gps_data {
+    double latitude;                ///< Latitude in decimal degrees (+ = North, - = South)
+    double longitude;               ///< Longitude in decimal degrees (+ = East, - = West)
+    double seeHeight;               ///< Altitude above sea level in meters
+    char lat_hemisphere;            ///< Latitude hemisphere ('N' or 'S')
+    char lon_hemisphere;            ///< Longitude hemisphere ('E' or 'W')
+    char time_str[11];              ///< GPS time in HH:MM:SS format (UTC)
+    char date_str[20];              ///< Date in DD/MM/YYYY format
+    char hijri_date_str[20];        ///< Hijri date in DD/MM/YYYY format
+    char day_of_week[12];           ///< Day name (e.g., "Monday")
+    bool valid;                     ///< True when GPS has satellite fix
+    bool date_valid;                ///< True when date information is available
+    bool hijri_valid;               ///< True when Hijri date is calculated
+    bool day_valid;                 ///< True when day of week is available
+    bool seeHeight_valid;           ///< True when altitude is valid
+    uint16_t hdop_x100;             ///< Horizontal DOP * 100 (NAV-PVT: position DOP), 0 if unknown
+    int32_t utc_sod;                ///< UTC time in seconds since midnight (-1 if unknown)
+    int32_t date_ordinal;           ///< UTC date as days since 2000-01-01
+    int utc_day;                    ///< UTC day (1-31)
+    int utc_month;                  ///< UTC month (1-12)
+    int utc_year;                   ///< UTC year (full year)
+    uint32_t utc_update_ms;         ///< Uptime when utc_sod was received
+};
+
+/**
+ * @brief Receiver statistics
+ */
+typedef struct {
+    uint32_t bytes;                 ///< Bytes received
+    uint32_t sentences;             ///< Sentences parsed
+    uint32_t ubx_frames;            ///< UBX frames received
+    uint32_t rx_events;             ///< RX callbacks handing bytes to the core
+    uint32_t work_runs;             ///< Parser work item runs
+    uint32_t lines_dropped;         ///< Messages skipped because the queue was full
+    uint32_t checksum_errors;       ///< Sentences/frames failing their checksum
+    uint32_t framing_errors;        ///< Truncated, overlong or malformed sentences, oversized UBX frames
+    uint32_t rx_errors;             ///< Overrun/framing/parity errors reported by the driver
+    uint8_t protocol;               ///< GPS_PROTOCOL_* in use (backends with UBX configuration)
+    uint32_t baud;                  ///< Receiver baud rate (0 while detecting or fixed)
+    uint32_t parse_us;              ///< Time spent parsing queued messages
+    uint32_t last_fix_ms;           ///< Uptime of the last position update
+    uint32_t active_s;              ///< Seconds in which the receiver sent anything
+} gps_rx_stats_t;
+
+/**
+ * @brief Backend description
+ */
+typedef struct {
+    const char *name;               ///< Log prefix, e.g. "NEO-7M"
+    /** UBX frames after the core has decoded NAV-PVT (ACKs for configuration); may be NULL */
+    void (*ubx_frame)(const ubx_frame_t *frame);
+} gnss_backend_t;
+
+// Backend interface (gps_neo6m.c / gps_neo7m.c)
+
+/**
+ * @brief Attach the backend; call before its RX starts
+ * @param backend Backend description (must stay valid)
+ */
+void gnss_core_init(const gnss_backend_t *backend);
+
+/**
+ * @brief Tokenize received bytes into the message queue (UART callback context)
+ *
+ * Each call counts as one RX event.
+ */
+void gnss_core_rx_bytes(const uint8_t *data, size_t len);
+
+/**
+ * @brief Count a receive error reported by the UART driver
+ */
+void gnss_core_rx_error(void);
+
+/**
+ * @brief Abandon the sentence or frame in progress (bytes lost, baud rate changed)
+ *
+ * Both parsers go back to waiting for a start and the queue slot they were
+ * filling is released. Takes effect before the next received bytes are
+ * tokenized, so it may be called from any context.
+ */
+void gnss_core_rx_reset(void);
+
+/**
+ * @brief Checksum-valid sentences and frames received so far (sign of life for autobaud)
+ */
+uint32_t gnss_core_traffic(void);
+
+/**
+ * @brief Get the core's part of the receiver statistics
+ * @param stats Output statistics (protocol and baud are left 0)
+ */
+void gnss_core_get_rx_stats(gps_rx_stats_t *stats);
+
+// Backend entry points
+
+/**
+ * @brief Initialize GPS module and UART communication
+ * @return 0 on success, -1 on failure
+ */
+int gps_init(void);
+
+/**
+ * @brief Process GPS data (compatibility function, parsing runs in a work item)
+ */
+void gps_process_data(void);
+
+// Application interface
+
+/**
+ * @brief Copy the latest fix without locking
+ *
+ * The core publishes a complete struct gps_data at a time, so position, date
+ * and time in the copy always belong together. Safe from any thread.
+ * @param out Output snapshot
+ * @return Generation of the snapshot (0 until the first publication)
+ */
+uint32_t gps_snapshot(struct gps_data *out);
+
+/**
+ * @brief Generation of the latest fix, bumped each time the published data changes
+ *
+ * Cheap enough to poll: skip gps_snapshot() and dependent work while it is unchanged.
+ */
+uint32_t gps_generation(void);
+
+/**
+ * @brief Print current GPS information to console (debug function)
+ */
+void gps_print_info(void);
+
+/**
+ * @brief Print the last NMEA sentences received (debug function)
+ */
+void gps_print_raw_data(void);
+
+/**
+ * @brief Display GPS data on LCD screen
+ * @param display_dev Display device pointer
+ * @param x X position on screen
+ * @param y Y position on screen
+ */
+void display_gps_data(const struct device *display_dev, int x, int y);
+
+/**
+ * @brief Get current date string for prayer calculations
+ * @return Pointer to date string in DD/MM/YYYY format
+ */
+const char* gps_get_today_date(void);
+
+/**
+ * @brief Get GPS statistics
+ * @param bytes_rx Pointer to store total bytes received (can be NULL)
+ * @param sentences_parsed Pointer to store total sentences parsed (can be NULL)
+ */
+void gps_get_stats(uint32_t *bytes_rx, uint32_t *sentences_parsed);
+
+/**
+ * @brief Use a zone's timezone and DST rules for local time
+ * @param zone Zone (tz_zone_id_t), e.g. a city's tz
+ */
+void gps_set_timezone(uint8_t zone);
+
+/**
+ * @brief Check if DST is active at the current GPS date and time
+ * @return true if DST is active, false otherwise
+ */
+bool gps_is_dst_active(void);
+
+/**
+ * @brief Get current timezone offset (including DST if active)
+ * @return Total timezone offset in minutes, 0 while no UTC time is known
+ */
+int gps_get_current_offset(void);
+
+/**
+ * @brief Get local time with timezone and DST applied
+ *
+ * UTC comes from the disciplined clock (utc_clock.h), so this stays correct
+ * between fixes (in power save mode they may be an hour apart) and in outages.
+ * @param local_sod Output local time in seconds since midnight (TOD_INVALID if unknown)
+ * @return Total offset applied (timezone + DST) in minutes, 0 if unknown
+ */
+int gps_get_local_time(int32_t *local_sod);
+
+/**
+ * @brief Calculate timezone offset from GPS longitude coordinate
+ * @param longitude Longitude in decimal degrees
+ * @return Calculated timezone offset in hours from UTC
+ */
+int gps_calculate_timezone_from_longitude(double longitude);
+
+struct city_data;
+
+/**
+ * @brief Configure the timezone for a position
+ * Uses the nearest city's zone (a fixed offset from the longitude without one),
+ * and sets the prayer time timezone to its offset at local noon of date_ordinal.
+ * The caller searches the city, once per position.
+ * @param nearest_city Nearest city (world_cities.h), NULL if none
+ * @param longitude Longitude in decimal degrees, for the fallback and local noon
+ * @param date_ordinal UTC date the prayer times are computed for (days since 2000-01-01)
+ */
+void gps_auto_configure_timezone(const struct city_data *nearest_city, double longitude,
+                                 int32_t date_ordinal);
+
+#endif // GNSS_CORE_H
@@ -0,0 +1,230 @@
+/**
+ * @file gnss_sats.c
+ * @brief Satellite tables from GSV and GSA
+ */
+
+#include "gnss_sats.h"
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <string.h>
+
+/**
+ * @brief GSV sequence state of one constellation
+ */
+typedef struct {
+    uint8_t expected;                   ///< Next sentence number, 0 outside a sequence
+    uint8_t cycle;                      ///< Tag of the current sequence
+    uint8_t in_view;                    ///< From the last sentence
+} gsv_sequence_t;
+
+// Writer side (parser context only)
+static gnss_sats_t sats_work;
+static gsv_sequence_t sequences[GNSS_SYSTEM_COUNT];
+
+// Reader side
+static struct k_spinlock sats_lock;
+static gnss_sats_t sats_published;
+static uint32_t sats_generation;
+
+static gnss_sats_stats_t sats_stats;
+
+uint8_t gnss_sats_system(const char *talker)
+{
+    static const struct {
+        char id[3];
+        uint8_t system;
+    } talkers[] = {
+        { "GP", GNSS_SYSTEM_GPS },
+        { "GL", GNSS_SYSTEM_GLONASS },
+        { "GA", GNSS_SYSTEM_GALILEO },
+        { "GB", GNSS_SYSTEM_BEIDOU },
+        { "BD", GNSS_SYSTEM_BEIDOU },
+    };
+
+    for (size_t i = 0; i < ARRAY_SIZE(talkers); i++) {
+        if (talker[0] == talkers[i].id[0] && talker[1] == talkers[i].id[1]) {
+            return talkers[i].system;
+        }
+    }
+    return GNSS_SYSTEM_ANY;
+}
+
+static void publish(void)
+{
+    uint8_t tracked = 0, in_view = 0;
+
+    for (int i = 0; i < sats_work.count; i++) {
+        tracked += (sats_work.sat[i].snr > 0);
+    }
+    for (int i = 0; i < GNSS_SYSTEM_COUNT; i++) {
+        in_view += sequences[i].in_view;
+    }
+    sats_work.tracked = tracked;
+    sats_work.in_view = in_view;
+
+    k_spinlock_key_t key = k_spin_lock(&sats_lock);
+    sats_published.count = sats_work.count;
+    sats_published.in_view = sats_work.in_view;
+    sats_published.tracked = sats_work.tracked;
+    sats_published.used = sats_work.used;
+    sats_published.fix_type = sats_work.fix_type;
+    memcpy(sats_published.sat, sats_work.sat, sats_work.count * sizeof(gnss_sat_t));
+    sats_generation++;
+    k_spin_unlock(&sats_lock, key);
+
+    sats_stats.publications++;
+}
+
+/**
+ * @brief Slot of a satellite, a new one if it is not in the table, NULL when full
+ */
+static gnss_sat_t *sat_slot(uint8_t system, uint8_t id)
+{
+    for (int i = 0; i < sats_work.count; i++) {
+        if (sats_work.sat[i].id == id && sats_work.sat[i].system == system) {
+            return &sats_work.sat[i];
+        }
+    }
+    if (sats_work.count == GNSS_SATS_MAX) {
+        sats_stats.overflows++;
+        return NULL;
+    }
+
+    gnss_sat_t *sat = &sats_work.sat[sats_work.count++];
+    *sat = (gnss_sat_t){ .id = id, .system = system, .elevation = -1 };
+    return sat;
+}
+
+/**
+ * @brief Drop a constellation's satellites the completed sequence did not report
+ */
+static void remove_set(uint8_t system, uint8_t cycle)
+{
+    for (int i = 0; i < sats_work.count; ) {
+        gnss_sat_t *sat = &sats_work.sat[i];
+
+        if (sat->system == system && sat->cycle != cycle) {
+            // Last entry fills the hole: the order is not meaningful
+            *sat = sats_work.sat[--sats_work.count];
+            sats_stats.set++;
+        } else {
+            i++;
+        }
+    }
+}
+
+void gnss_sats_gsv(uint8_t system, int total, int number, int in_view,
+                   const gnss_sat_t *sats, int count)
+{
+    if (system >= GNSS_SYSTEM_COUNT) {
+        system = GNSS_SYSTEM_GPS;
+    }
+    gsv_sequence_t *seq = &sequences[system];
+
+    if (number == 1) {
+        if (seq->expected != 0) {
+            sats_stats.broken++;
+        }
+        seq->cycle++;
+        seq->expected = 1;
+    } else if (number != seq->expected) {
+        // A part was lost: keep the updates, but do not judge what has set
+        if (seq->expected != 0) {
+            sats_stats.broken++;
+        }
+        seq->expected = 0;
+    }
+    seq->in_view = (uint8_t)CLAMP(in_view, 0, UINT8_MAX);
+
+    for (int i = 0; i < count; i++) {
+        if (sats[i].id == 0) {
+            continue;
+        }
+        gnss_sat_t *sat = sat_slot(system, sats[i].id);
+        if (!sat) {
+            continue;
+        }
+        sat->elevation = sats[i].elevation;
+        sat->azimuth = sats[i].azimuth;
+        sat->snr = sats[i].snr;
+        sat->cycle = seq->cycle;
+    }
+
+    if (seq->expected == 0) {
+        return;
+    }
+    if (number < total) {
+        seq->expected++;
+        return;
+    }
+
+    // Sequence complete
+    remove_set(system, seq->cycle);
+    seq->expected = 0;
+    sats_stats.sequences++;
+    publish();
+}
+
+void gnss_sats_gsa(uint8_t system, int fix_type, const uint8_t *ids, int count, bool continuation)
+{
+    if (!continuation) {
+        for (int i = 0; i < sats_work.count; i++) {
+            sats_work.sat[i].used = false;
+        }
+        sats_work.used = 0;
+        sats_work.fix_type = 0;
+    }
+
+    for (int i = 0; i < count; i++) {
+        for (int j = 0; j < sats_work.count; j++) {
+            gnss_sat_t *sat = &sats_work.sat[j];
+            if (sat->id == ids[i] && (system == GNSS_SYSTEM_ANY || sat->system == system)) {
+                sat->used = true;
+            }
+        }
+    }
+    sats_work.used = (uint8_t)MIN(sats_work.used + count, UINT8_MAX);
+    sats_work.fix_type = (uint8_t)MAX(sats_work.fix_type, fix_type);
+
+    publish();
+}
+
+void gnss_sats_used(int used)
+{
+    if (sats_work.used != used) {
+        sats_work.used = (uint8_t)CLAMP(used, 0, UINT8_MAX);
+        publish();
+    }
+}
+
+uint32_t gnss_sats_snapshot(gnss_sats_t *out)
+{
+    k_spinlock_key_t key = k_spin_lock(&sats_lock);
+    uint32_t generation = sats_generation;
+
+    out->count = sats_published.count;
+    out->in_view = sats_published.in_view;
+    out->tracked = sats_published.tracked;
+    out->used = sats_published.used;
+    out->fix_type = sats_published.fix_type;
+    memcpy(out->sat, sats_published.sat, sats_published.count * sizeof(gnss_sat_t));
+    k_spin_unlock(&sats_lock, key);
+
+    return generation;
+}
+
+uint32_t gnss_sats_generation(void)
+{
+    k_spinlock_key_t key = k_spin_lock(&sats_lock);
+    uint32_t generation = sats_generation;
+
+    k_spin_unlock(&sats_lock, key);
+    return generation;
+}
+
+void gnss_sats_get_stats(gnss_sats_stats_t *stats)
+{
+    if (stats) {
+        *stats = sats_stats;
+    }
+}
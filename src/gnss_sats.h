@@ -0,0 +1,131 @@
+/**
+ * @file gnss_sats.h
+ * @brief Satellites in view (GSV) and used in the fix (GSA) in fixed-size tables
+ *
+ * A GSV sequence reports up to four satellites per sentence over several
+ * sentences, one sequence per constellation (talker GP, GL, GA, GB). Each
+ * sentence updates its satellites in place in a table of GNSS_SATS_MAX slots;
+ * when a sequence completes in order, the constellation's satellites it did not
+ * mention have set and their slots are freed. Nothing is allocated, and a full
+ * table ignores further satellites until slots free up.
+ *
+ * GSA lists the satellites used in the fix, one sentence per constellation in
+ * multi-GNSS mode; consecutive GSA sentences form one epoch's list. With UBX
+ * NAV-PVT only the used count is known.
+ *
+ * The parser (gnss_core.c, system work queue) updates a working table and
+ * publishes a copy after each complete GSV sequence and GSA epoch; readers
+ * copy the published table.
+ */
+
+#ifndef GNSS_SATS_H
+#define GNSS_SATS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define GNSS_SATS_MAX           32      ///< Table capacity (a NEO-7M tracks up to 16 per system)
+#define GNSS_SATS_PER_GSV       4       ///< Satellites per GSV sentence
+#define GNSS_SATS_PER_GSA       12      ///< Satellite IDs per GSA sentence
+
+/**
+ * @brief Constellation, from the talker ID
+ */
+enum {
+    GNSS_SYSTEM_GPS = 0,                ///< GP (also SBAS, IDs 33-64)
+    GNSS_SYSTEM_GLONASS,                ///< GL
+    GNSS_SYSTEM_GALILEO,                ///< GA
+    GNSS_SYSTEM_BEIDOU,                 ///< GB, BD
+    GNSS_SYSTEM_ANY,                    ///< GN: combined (GSA only)
+    GNSS_SYSTEM_COUNT = GNSS_SYSTEM_ANY,
+};
+
+/**
+ * @brief One satellite
+ */
+typedef struct {
+    uint8_t id;                         ///< Satellite ID as in NMEA (GPS 1-32, SBAS 33-64, GLONASS 65-96)
+    uint8_t system;                     ///< GNSS_SYSTEM_*
+    int8_t elevation;                   ///< Degrees above the horizon, -1 if unknown
+    uint8_t snr;                        ///< C/N0 in dB-Hz, 0 when not tracked
+    uint16_t azimuth;                   ///< Degrees from true north, 0-359
+    bool used;                          ///< Used in the fix (GSA)
+    uint8_t cycle;                      ///< Last GSV sequence that reported it (internal)
+} gnss_sat_t;
+
+/**
+ * @brief Published satellite table
+ */
+typedef struct {
+    uint8_t count;                      ///< Valid entries in sat[]
+    uint8_t in_view;                    ///< Satellites in view, summed over the GSV sequences
+    uint8_t tracked;                    ///< Entries with a signal (snr > 0)
+    uint8_t used;                       ///< Satellites in the fix (GSA list or NAV-PVT count)
+    uint8_t fix_type;                   ///< GSA mode: 1 no fix, 2 2D, 3 3D (0 unknown)
+    gnss_sat_t sat[GNSS_SATS_MAX];
+} gnss_sats_t;
+
+/**
+ * @brief Table statistics
+ */
+typedef struct {
+    uint32_t sequences;                 ///< GSV sequences completed
+    uint32_t broken;                    ///< GSV sequences abandoned (a part lost or out of order)
+    uint32_t set;                       ///< Satellites removed after a sequence no longer reported them
+    uint32_t overflows;                 ///< Satellites ignored because the table was full
+    uint32_t publications;
+} gnss_sats_stats_t;
+
+/**
+ * @brief Constellation of a talker ID
+ * @param talker Two-character talker ID ("GP", "GL"...)
+ * @return GNSS_SYSTEM_*, GNSS_SYSTEM_ANY for "GN" and unknown talkers
+ */
+uint8_t gnss_sats_system(const char *talker);
+
+/**
+ * @brief One GSV sentence (parser context)
+ * @param system GNSS_SYSTEM_* of the talker
+ * @param total Sentences in the sequence
+ * @param number This sentence, 1-based
+ * @param in_view Satellites in view of this constellation
+ * @param sats Satellites in this sentence (id, elevation, azimuth, snr)
+ * @param count Entries in sats (0-GNSS_SATS_PER_GSV)
+ */
+void gnss_sats_gsv(uint8_t system, int total, int number, int in_view,
+                   const gnss_sat_t *sats, int count);
+
+/**
+ * @brief One GSA sentence (parser context)
+ * @param system GNSS_SYSTEM_* of the talker
+ * @param fix_type 1 no fix, 2 2D, 3 3D
+ * @param ids Satellite IDs used in the fix
+ * @param count Entries in ids (0-GNSS_SATS_PER_GSA)
+ * @param continuation Follows another GSA of the same epoch (multi-GNSS)
+ */
+void gnss_sats_gsa(uint8_t system, int fix_type, const uint8_t *ids, int count, bool continuation);
+
+/**
+ * @brief Satellites used, where no GSA is received (UBX NAV-PVT; parser context)
+ */
+void gnss_sats_used(int used);
+
+/**
+ * @brief Copy the published table
+ * @param out Output table
+ * @return Publication generation (0 before the first one)
+ */
+uint32_t gnss_sats_snapshot(gnss_sats_t *out);
+
+/**
+ * @brief Generation of the published table, to poll for changes cheaply
+ */
+uint32_t gnss_sats_generation(void);
+
+/**
+ * @brief Get table statistics
+ * @param stats Output statistics
+ */
+void gnss_sats_get_stats(gnss_sats_stats_t *stats);
+
+#endif // GNSS_SATS_H
@@ -0,0 +1,507 @@
+/**
+ * @file gps_config.c
+ * @brief u-blox receiver configuration manager
+ */
+
+#include "gps_config.h"
+#include <zephyr/kernel.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+
+#define GPS_DETECT_WINDOW_MS    1100    ///< Listen per candidate: covers a whole 1 Hz burst
+#define GPS_DETECT_ROUNDS       3       ///< Passes over the candidates before pausing
+#define GPS_DETECT_RETRY_MS     10000   ///< Pause before detecting again (receiver off?)
+#define GPS_PRT_SETTLE_MS       100     ///< CFG-PRT on the wire and applied before we follow
+#define GPS_PRT_FAILURES        2       ///< Failed baud switches before staying where we are
+#define GPS_ACK_TIMEOUT_MS      500
+#define GPS_ACK_ATTEMPTS        3
+#define GPS_UBX_SILENCE_MS      3000    ///< NAV-PVT gap that triggers the NMEA fallback
+#define GPS_PM2_ON_TIME_S       2       ///< Stay on this long after each fix
+#define GPS_POWER_UNKNOWN       UINT32_MAX
+
+#define GPS_CACHE_MAGIC         0x47435647  // "GVCG"
+
+#ifdef GPS_UBX_MODE
+#define GPS_UBX_ENABLED         1
+#else
+#define GPS_UBX_ENABLED         0
+#endif
+
+enum {
+    CFG_STEP_DETECT = 0,    // Listening for traffic at candidate baud rates
+    CFG_STEP_PRT,           // CFG-PRT sent, waiting before switching our side
+    CFG_STEP_VERIFY,        // Listening at the new baud rate
+    CFG_STEP_RATE,          // CFG-RATE sent, waiting for the ACK
+    CFG_STEP_NAV_PVT,       // CFG-MSG NAV-PVT sent, waiting for the ACK
+    CFG_STEP_MSG,           // CFG-MSG for gps_nmea_msgs[msg_index] sent
+    CFG_STEP_PM2,           // CFG-PM2 (ON/OFF period) sent, waiting for the ACK
+    CFG_STEP_RXM,           // CFG-RXM (continuous/power save) sent, waiting for the ACK
+    CFG_STEP_DONE,          // Idle: power mode changes and the NAV-PVT watchdog only
+};
+
+// Standard NMEA messages (class 0xF0) and their rate in NMEA mode; all 0 in UBX mode
+static const struct {
+    uint8_t id;
+    uint8_t rate;
+} gps_nmea_msgs[] = {
+    { 0x00, 1 },    // GGA: altitude
+    { 0x01, 0 },    // GLL
+    { 0x02, 1 },    // GSA: fix type
+    { 0x03, 5 },    // GSV: satellite table (gnss_sats.c), 3-4 sentences every 5th fix
+    { 0x04, 1 },    // RMC: date, time, position
+    { 0x05, 0 },    // VTG
+};
+
+// Baud rates tried after the cached one, factory default first
+static const uint32_t gps_bauds[] = { 9600, 38400, 115200, 57600, 19200, 4800 };
+
+/**
+ * @brief Applied configuration, kept across warm resets
+ */
+typedef struct {
+    uint32_t magic;
+    uint32_t signature;     ///< Settings this build asks for (see config_signature())
+    uint32_t baud;
+    uint32_t protocol;
+    uint32_t crc;           ///< CRC-32 of the fields above
+} gps_config_cache_t;
+
+static __noinit gps_config_cache_t gps_config_cache;
+
+static struct {
+    const gps_config_port_t *port;
+    uint8_t step;
+    uint8_t protocol;
+    uint8_t attempts;       ///< Sends of the current command, or detection rounds
+    uint8_t candidate;      ///< Index into candidates[]
+    uint8_t candidate_count;
+    uint8_t msg_index;
+    uint8_t prt_failures;
+    bool complete;          ///< Every command ACKed: the result may be cached
+    uint32_t baud;          ///< Receiver baud rate, 0 while unknown
+    uint32_t baseline;      ///< traffic() at the start of the listening window
+    uint32_t power_period_s;  ///< ON/OFF update period applied (0 = continuous)
+    uint32_t candidates[ARRAY_SIZE(gps_bauds) + 1];
+    uint8_t tx_buf[UBX_CFG_PM2_LENGTH + UBX_FRAME_OVERHEAD];   ///< Largest command: CFG-PM2
+} gps_cfg = { .power_period_s = GPS_POWER_UNKNOWN };
+
+// Requested update period; applied from the work queue once the manager is idle
+static atomic_t gps_power_request = ATOMIC_INIT(GPS_POWER_UNKNOWN);
+
+static void gps_config_timer_handler(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(gps_config_timer, gps_config_timer_handler);
+static void gps_config_power_handler(struct k_work *work);
+static K_WORK_DEFINE(gps_config_power_work, gps_config_power_handler);
+
+static uint32_t config_signature(void)
+{
+    const uint32_t settings[] = { GPS_CONFIG_BAUD, GPS_CONFIG_RATE_MS, GPS_UBX_ENABLED };
+    uint32_t sig = crc32_ieee((const uint8_t *)settings, sizeof(settings));
+    return crc32_ieee_update(sig, (const uint8_t *)gps_nmea_msgs, sizeof(gps_nmea_msgs));
+}
+
+static uint32_t cache_crc(void)
+{
+    return crc32_ieee((const uint8_t *)&gps_config_cache, offsetof(gps_config_cache_t, crc));
+}
+
+static bool cache_valid(void)
+{
+    return gps_config_cache.magic == GPS_CACHE_MAGIC &&
+           gps_config_cache.crc == cache_crc() &&
+           gps_config_cache.signature == config_signature();
+}
+
+static void cache_store(void)
+{
+    gps_config_cache.magic = GPS_CACHE_MAGIC;
+    gps_config_cache.signature = config_signature();
+    gps_config_cache.baud = gps_cfg.baud;
+    gps_config_cache.protocol = gps_cfg.protocol;
+    gps_config_cache.crc = cache_crc();
+}
+
+static void listen_at(uint32_t baud, uint32_t window_ms)
+{
+    gps_cfg.port->set_baud(baud);
+    gps_cfg.baseline = gps_cfg.port->traffic();
+    k_work_reschedule(&gps_config_timer, K_MSEC(window_ms));
+}
+
+static bool traffic_seen(void)
+{
+    return gps_cfg.port->traffic() != gps_cfg.baseline;
+}
+
+static void send_frame(size_t len, uint32_t timeout_ms)
+{
+    gps_cfg.port->send(gps_cfg.tx_buf, len);
+    k_work_reschedule(&gps_config_timer, K_MSEC(timeout_ms));
+}
+
+/**
+ * @brief Build and send the command of the current step
+ */
+static void send_command(void)
+{
+    size_t len = 0;
+
+    switch (gps_cfg.step) {
+    case CFG_STEP_RATE:
+        len = ubx_build_cfg_rate(gps_cfg.tx_buf, GPS_CONFIG_RATE_MS);
+        break;
+
+    case CFG_STEP_NAV_PVT:
+        // Without GPS_UBX_MODE this turns off a NAV-PVT left on by an earlier build
+        len = ubx_build_cfg_msg(gps_cfg.tx_buf, UBX_CLASS_NAV, UBX_ID_NAV_PVT, GPS_UBX_ENABLED);
+        break;
+
+    case CFG_STEP_MSG: {
+        uint8_t rate = (gps_cfg.protocol == GPS_PROTOCOL_NMEA) ? gps_nmea_msgs[gps_cfg.msg_index].rate : 0;
+        len = ubx_build_cfg_msg(gps_cfg.tx_buf, UBX_CLASS_NMEA, gps_nmea_msgs[gps_cfg.msg_index].id, rate);
+        break;
+    }
+
+    case CFG_STEP_PM2: {
+        uint32_t period_ms = (uint32_t)atomic_get(&gps_power_request) * 1000U;
+        len = ubx_build_cfg_pm2(gps_cfg.tx_buf, period_ms, period_ms, GPS_PM2_ON_TIME_S);
+        break;
+    }
+
+    case CFG_STEP_RXM:
+        len = ubx_build_cfg_rxm(gps_cfg.tx_buf, (atomic_get(&gps_power_request) > 0) ?
+                                UBX_RXM_POWER_SAVE : UBX_RXM_CONTINUOUS);
+        break;
+
+    default:
+        return;
+    }
+
+    gps_cfg.attempts++;
+    send_frame(len, GPS_ACK_TIMEOUT_MS);
+}
+
+// NAV-PVT gap tolerated before falling back: longer while the receiver sleeps between fixes
+static uint32_t silence_ms(void)
+{
+    // No power mode applied yet: the receiver runs continuously
+    uint32_t period_s = (gps_cfg.power_period_s == GPS_POWER_UNKNOWN) ? 0U : gps_cfg.power_period_s;
+
+    return GPS_UBX_SILENCE_MS + 2U * period_s * 1000U;
+}
+
+static void enter_step(uint8_t step);
+
+/**
+ * @brief Go idle, or start on a power mode change requested meanwhile
+ */
+static void idle(void)
+{
+    gps_cfg.step = CFG_STEP_DONE;
+
+    uint32_t period = (uint32_t)atomic_get(&gps_power_request);
+    if (period != gps_cfg.power_period_s) {
+        // The ON/OFF period only matters in power save mode
+        enter_step((period > 0) ? CFG_STEP_PM2 : CFG_STEP_RXM);
+    } else if (gps_cfg.protocol == GPS_PROTOCOL_UBX) {
+        k_work_reschedule(&gps_config_timer, K_MSEC(silence_ms()));
+    }
+}
+
+static void enter_step(uint8_t step)
+{
+    gps_cfg.step = step;
+    gps_cfg.attempts = 0;
+
+    switch (step) {
+    case CFG_STEP_DETECT:
+        gps_cfg.baud = 0;
+        gps_cfg.candidate = 0;
+        listen_at(gps_cfg.candidates[0], GPS_DETECT_WINDOW_MS);
+        break;
+
+    case CFG_STEP_PRT:
+        printk("GPS config: %u -> %u baud\n", gps_cfg.baud, GPS_CONFIG_BAUD);
+        send_frame(ubx_build_cfg_prt(gps_cfg.tx_buf, GPS_CONFIG_BAUD), GPS_PRT_SETTLE_MS);
+        break;
+
+    case CFG_STEP_VERIFY:
+        listen_at(GPS_CONFIG_BAUD, GPS_DETECT_WINDOW_MS);
+        break;
+
+    case CFG_STEP_MSG:
+        gps_cfg.msg_index = 0;
+        send_command();
+        break;
+
+    case CFG_STEP_DONE:
+        if (gps_cfg.protocol == GPS_PROTOCOL_UBX_PENDING) {
+            gps_cfg.protocol = GPS_PROTOCOL_UBX;
+        }
+        if (gps_cfg.complete && gps_cfg.baud == GPS_CONFIG_BAUD) {
+            cache_store();
+        }
+        printk("GPS config: done, %u baud, %s%s\n", gps_cfg.baud,
+               (gps_cfg.protocol == GPS_PROTOCOL_UBX) ? "NAV-PVT" : "RMC/GGA/GSA",
+               gps_cfg.complete ? "" : " (incomplete, not cached)");
+        idle();
+        break;
+
+    default:
+        send_command();
+        break;
+    }
+}
+
+/**
+ * @brief Receiver heard at gps_cfg.baud: skip, move it, or configure it
+ */
+static void detected(void)
+{
+    printk("GPS config: receiver found at %u baud\n", gps_cfg.baud);
+
+    if (cache_valid() && gps_cfg.baud == gps_config_cache.baud) {
+        // Warm boot: the receiver kept what we sent last time
+        gps_cfg.protocol = (uint8_t)gps_config_cache.protocol;
+        gps_cfg.complete = true;
+        printk("GPS config: cached configuration still applied, skipped\n");
+        enter_step(CFG_STEP_DONE);
+        return;
+    }
+
+    gps_cfg.complete = true;
+    if (gps_cfg.baud != GPS_CONFIG_BAUD && gps_cfg.prt_failures < GPS_PRT_FAILURES) {
+        enter_step(CFG_STEP_PRT);
+    } else {
+        enter_step(CFG_STEP_RATE);
+    }
+}
+
+/**
+ * @brief ACK, NAK or no answer for the command of the current step
+ */
+static void command_result(bool acked)
+{
+    switch (gps_cfg.step) {
+    case CFG_STEP_RATE:
+        if (!acked) {
+            printk("GPS config: CFG-RATE rejected\n");
+            gps_cfg.complete = false;
+        }
+        enter_step(CFG_STEP_NAV_PVT);
+        break;
+
+    case CFG_STEP_NAV_PVT:
+        // A NEO-6 (protocol 6/7) NAKs NAV-PVT: stay on NMEA
+        if (GPS_UBX_ENABLED && !acked) {
+            printk("GPS config: NAV-PVT not supported, using NMEA\n");
+        }
+        gps_cfg.protocol = (GPS_UBX_ENABLED && acked) ? GPS_PROTOCOL_UBX_PENDING : GPS_PROTOCOL_NMEA;
+        enter_step(CFG_STEP_MSG);
+        break;
+
+    case CFG_STEP_MSG:
+        if (!acked) {
+            printk("GPS config: CFG-MSG F0 %02x rejected\n", gps_nmea_msgs[gps_cfg.msg_index].id);
+            gps_cfg.complete = false;
+        }
+        if (++gps_cfg.msg_index < ARRAY_SIZE(gps_nmea_msgs)) {
+            gps_cfg.attempts = 0;
+            send_command();
+        } else {
+            enter_step(CFG_STEP_DONE);
+        }
+        break;
+
+    case CFG_STEP_PM2:
+        if (!acked) {
+            printk("GPS config: CFG-PM2 rejected\n");
+        }
+        enter_step(CFG_STEP_RXM);
+        break;
+
+    case CFG_STEP_RXM: {
+        // Recorded even when refused, so a receiver without power save is not asked again
+        uint32_t period = (uint32_t)atomic_get(&gps_power_request);
+        gps_cfg.power_period_s = period;
+        if (!acked) {
+            printk("GPS config: CFG-RXM rejected\n");
+        } else if (period > 0) {
+            printk("GPS config: power save, one fix every %u s\n", period);
+        } else {
+            printk("GPS config: continuous tracking\n");
+        }
+        idle();
+        break;
+    }
+
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief Listening windows, ACK timeouts and the NAV-PVT watchdog (system work queue)
+ */
+static void gps_config_timer_handler(struct k_work *work)
+{
+    switch (gps_cfg.step) {
+    case CFG_STEP_DETECT:
+        if (traffic_seen()) {
+            gps_cfg.baud = gps_cfg.candidates[gps_cfg.candidate];
+            detected();
+            break;
+        }
+        if (++gps_cfg.candidate < gps_cfg.candidate_count) {
+            listen_at(gps_cfg.candidates[gps_cfg.candidate], GPS_DETECT_WINDOW_MS);
+        } else if (++gps_cfg.attempts < GPS_DETECT_ROUNDS) {
+            gps_cfg.candidate = 0;
+            listen_at(gps_cfg.candidates[0], GPS_DETECT_WINDOW_MS);
+        } else {
+            printk("GPS config: no receiver traffic at any baud rate, retrying\n");
+            gps_cfg.attempts = 0;
+            gps_cfg.candidate = 0;
+            listen_at(gps_cfg.candidates[0], GPS_DETECT_RETRY_MS);
+        }
+        break;
+
+    case CFG_STEP_PRT:
+        enter_step(CFG_STEP_VERIFY);
+        break;
+
+    case CFG_STEP_VERIFY:
+        if (traffic_seen()) {
+            gps_cfg.baud = GPS_CONFIG_BAUD;
+            enter_step(CFG_STEP_RATE);
+        } else {
+            // CFG-PRT was lost or refused: find the receiver again
+            printk("GPS config: no traffic at %u baud after CFG-PRT\n", GPS_CONFIG_BAUD);
+            gps_cfg.prt_failures++;
+            enter_step(CFG_STEP_DETECT);
+        }
+        break;
+
+    case CFG_STEP_RATE:
+    case CFG_STEP_NAV_PVT:
+    case CFG_STEP_MSG:
+    case CFG_STEP_PM2:
+    case CFG_STEP_RXM:
+        // A sleeping receiver loses the first bytes that wake it: the retry gets through
+        if (gps_cfg.attempts < GPS_ACK_ATTEMPTS) {
+            send_command();
+        } else {
+            gps_cfg.complete = false;
+            command_result(false);
+        }
+        break;
+
+    case CFG_STEP_DONE:
+        if (gps_cfg.protocol == GPS_PROTOCOL_UBX) {
+            // NAV-PVT went silent: turn the NMEA set back on
+            printk("GPS config: NAV-PVT stopped, using NMEA\n");
+            gps_cfg.protocol = GPS_PROTOCOL_NMEA;
+            gps_cfg.complete = true;
+            gps_config_cache.magic = 0;
+            enter_step(CFG_STEP_MSG);
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+void gps_config_start(const gps_config_port_t *port)
+{
+    gps_cfg.port = port;
+    gps_cfg.protocol = GPS_PROTOCOL_NMEA;
+    gps_cfg.prt_failures = 0;
+
+    // The cached baud rate first, then the usual ones
+    gps_cfg.candidate_count = 0;
+    if (cache_valid()) {
+        gps_cfg.candidates[gps_cfg.candidate_count++] = gps_config_cache.baud;
+    }
+    for (size_t i = 0; i < ARRAY_SIZE(gps_bauds); i++) {
+        if (gps_cfg.candidate_count == 0 || gps_bauds[i] != gps_cfg.candidates[0]) {
+            gps_cfg.candidates[gps_cfg.candidate_count++] = gps_bauds[i];
+        }
+    }
+
+    enter_step(CFG_STEP_DETECT);
+}
+
+void gps_config_on_frame(const ubx_frame_t *frame)
+{
+    if (frame->msg_class == UBX_CLASS_NAV && frame->msg_id == UBX_ID_NAV_PVT) {
+        if (gps_cfg.step == CFG_STEP_NAV_PVT) {
+            // NAV-PVT arriving is as good as the ACK
+            command_result(true);
+        } else if (gps_cfg.step == CFG_STEP_DONE && gps_cfg.protocol == GPS_PROTOCOL_UBX) {
+            k_work_reschedule(&gps_config_timer, K_MSEC(silence_ms()));
+        }
+        return;
+    }
+
+    uint8_t id;
+    switch (gps_cfg.step) {
+    case CFG_STEP_RATE:
+        id = UBX_ID_CFG_RATE;
+        break;
+    case CFG_STEP_NAV_PVT:
+    case CFG_STEP_MSG:
+        id = UBX_ID_CFG_MSG;
+        break;
+    case CFG_STEP_PM2:
+        id = UBX_ID_CFG_PM2;
+        break;
+    case CFG_STEP_RXM:
+        id = UBX_ID_CFG_RXM;
+        break;
+    default:
+        return;     // Not waiting for an acknowledgement
+    }
+
+    int ack = ubx_ack_result(frame, UBX_CLASS_CFG, id);
+    if (ack >= 0) {
+        command_result(ack == 1);
+    }
+}
+
+/**
+ * @brief Apply a power mode request (system work queue)
+ */
+static void gps_config_power_handler(struct k_work *work)
+{
+    // Otherwise picked up when the current sequence goes idle
+    if (gps_cfg.step == CFG_STEP_DONE) {
+        idle();
+    }
+}
+
+void gps_config_set_power(uint32_t update_period_s)
+{
+    atomic_set(&gps_power_request, (atomic_val_t)update_period_s);
+    k_work_submit(&gps_config_power_work);
+}
+
+uint32_t gps_config_power(void)
+{
+    return gps_cfg.power_period_s;
+}
+
+uint8_t gps_config_protocol(void)
+{
+    return gps_cfg.protocol;
+}
+
+uint32_t gps_config_baud(void)
+{
+    return gps_cfg.baud;
+}
+
+bool gps_config_done(void)
+{
+    return gps_cfg.step == CFG_STEP_DONE;
+}
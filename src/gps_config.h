@@ -0,0 +1,97 @@
+/**
+ * @file gps_config.h
+ * @brief u-blox receiver configuration manager: baud rate, navigation rate and message set
+ *
+ * At boot the manager finds the receiver's baud rate by listening for
+ * checksum-valid traffic at each candidate rate (autobaud on our side), moves it
+ * to GPS_CONFIG_BAUD with UBX-CFG-PRT, sets the navigation rate with
+ * UBX-CFG-RATE and the output messages with UBX-CFG-MSG, waiting for ACK-ACK
+ * after each command. Only RMC, GGA and GSA are kept, plus GSV every fifth fix
+ * (or NAV-PVT alone with GPS_UBX_MODE); GLL and VTG are turned off.
+ *
+ * Afterwards the receiver's power mode can be switched between continuous
+ * tracking and ON/OFF operation (UBX-CFG-PM2 plus UBX-CFG-RXM) on request.
+ *
+ * The applied configuration is cached in RAM that survives a warm reset: when
+ * the receiver still answers at the cached baud rate, nothing is resent.
+ *
+ * The manager runs on the system work queue and talks to the receiver through
+ * the driver's gps_config_port_t.
+ */
+
+#ifndef GPS_CONFIG_H
+#define GPS_CONFIG_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "ubx.h"
+
+#ifndef GPS_CONFIG_BAUD
+#define GPS_CONFIG_BAUD         38400   ///< Target baud rate (override with -DGPS_CONFIG_BAUD=115200)
+#endif
+#define GPS_CONFIG_RATE_MS      1000    ///< Navigation solution period (1 Hz)
+
+/**
+ * @brief Receiver output protocol
+ */
+enum {
+    GPS_PROTOCOL_NMEA = 0,          ///< NMEA sentences (default, and the fallback)
+    GPS_PROTOCOL_UBX_PENDING,       ///< NAV-PVT requested, waiting for the ACK
+    GPS_PROTOCOL_UBX,               ///< NAV-PVT only
+};
+
+/**
+ * @brief Driver hooks used to reach the receiver
+ */
+typedef struct {
+    /** Start transmitting a frame; the buffer stays untouched until the next call */
+    int (*send)(const uint8_t *data, size_t len);
+    /** Reconfigure the local UART baud rate; the parsers start over (gnss_core_rx_reset()) */
+    int (*set_baud)(uint32_t baud);
+    /** Checksum-valid sentences and frames received so far */
+    uint32_t (*traffic)(void);
+} gps_config_port_t;
+
+/**
+ * @brief Start configuring the receiver
+ * @param port Driver hooks (must stay valid)
+ */
+void gps_config_start(const gps_config_port_t *port);
+
+/**
+ * @brief Hand a received UBX frame to the manager (ACK/NAK, NAV-PVT watchdog)
+ *
+ * Call from the system work queue, like the manager itself.
+ */
+void gps_config_on_frame(const ubx_frame_t *frame);
+
+/**
+ * @brief Request continuous tracking or ON/OFF operation
+ *
+ * Safe from any thread; applied once the boot configuration has finished.
+ * @param update_period_s Time between fixes in ON/OFF operation, 0 for continuous tracking
+ */
+void gps_config_set_power(uint32_t update_period_s);
+
+/**
+ * @brief ON/OFF update period applied (0 = continuous, UINT32_MAX before the first request)
+ */
+uint32_t gps_config_power(void);
+
+/**
+ * @brief Output protocol currently configured (GPS_PROTOCOL_*)
+ */
+uint8_t gps_config_protocol(void);
+
+/**
+ * @brief Baud rate the receiver was found at or moved to (0 while detecting)
+ */
+uint32_t gps_config_baud(void);
+
+/**
+ * @brief True once configuration finished (or was skipped on a warm boot)
+ */
+bool gps_config_done(void);
+
+#endif // GPS_CONFIG_H
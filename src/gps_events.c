@@ -0,0 +1,119 @@
+/**
+ * @file gps_events.c
+ * @brief GPS event channels: announce fix, UTC second and date changes
+ */
+
+#include "gps_events.h"
+#include "gnss_core.h"
+#include "gps_position.h"
+#include "time_of_day.h"
+
+ZBUS_CHAN_DEFINE(gps_fix_chan, gps_fix_msg_t, NULL, NULL, ZBUS_OBSERVERS_EMPTY,
+                 ZBUS_MSG_INIT(.event = GPS_FIX_LOST));
+ZBUS_CHAN_DEFINE(gps_time_chan, gps_time_msg_t, NULL, NULL, ZBUS_OBSERVERS_EMPTY,
+                 ZBUS_MSG_INIT(.utc_sod = TOD_INVALID, .date_ordinal = -1));
+ZBUS_CHAN_DEFINE(gps_date_chan, gps_date_msg_t, NULL, NULL, ZBUS_OBSERVERS_EMPTY,
+                 ZBUS_MSG_INIT(.date_ordinal = -1));
+
+// Last announced state (only the GPS parser context calls gps_events_update)
+static bool fix_valid;
+static double fix_latitude;
+static double fix_longitude;
+static int32_t last_sod = TOD_INVALID;
+static int32_t last_date = -1;
+static int32_t filtered_sod = TOD_INVALID;     ///< Epoch of the last fix given to the filter
+
+static gps_events_stats_t event_stats;
+
+static void announce_fix(gps_fix_event_t event, double latitude, double longitude)
+{
+    const gps_fix_msg_t msg = {
+        .event = event,
+        .latitude = latitude,
+        .longitude = longitude,
+    };
+
+    fix_valid = (event != GPS_FIX_LOST);
+    if (fix_valid) {
+        fix_latitude = latitude;
+        fix_longitude = longitude;
+    }
+    if (event == GPS_FIX_MOVED) {
+        event_stats.moved++;
+    } else {
+        event_stats.fix++;
+    }
+
+    zbus_chan_pub(&gps_fix_chan, &msg, K_NO_WAIT);
+}
+
+/**
+ * @brief Filter the fix and announce acquisition or movement of the smoothed position
+ */
+static void update_position(const struct gps_data *gps)
+{
+    double latitude, longitude;
+    bool sampled = gps_position_get(&latitude, &longitude);
+
+    // One sample per navigation epoch: several messages publish each one
+    if (!sampled || gps->utc_sod != filtered_sod) {
+        filtered_sod = gps->utc_sod;
+        gps_position_add(gps->latitude, gps->longitude, gps->hdop_x100 / 100.0);
+        gps_position_get(&latitude, &longitude);
+
+        // Unfiltered, this fix alone would have invalidated the position work
+        if (fix_valid && gps_position_moved(gps->latitude, gps->longitude, fix_latitude, fix_longitude) &&
+            !gps_position_moved(latitude, longitude, fix_latitude, fix_longitude)) {
+            event_stats.suppressed++;
+        }
+    }
+
+    if (!fix_valid) {
+        announce_fix(GPS_FIX_ACQUIRED, latitude, longitude);
+    } else if (gps_position_moved(latitude, longitude, fix_latitude, fix_longitude)) {
+        announce_fix(GPS_FIX_MOVED, latitude, longitude);
+    }
+}
+
+void gps_events_update(const struct gps_data *gps)
+{
+    if (gps->valid) {
+        update_position(gps);
+    } else if (fix_valid) {
+        // Position kept in the message; averaging restarts with the next fix
+        announce_fix(GPS_FIX_LOST, fix_latitude, fix_longitude);
+        gps_position_reset();
+    }
+
+    // Date before time, so a time subscriber sees the new day already announced
+    if (gps->date_valid && gps->date_ordinal != last_date) {
+        const gps_date_msg_t msg = {
+            .date_ordinal = gps->date_ordinal,
+            .year = gps->utc_year,
+            .month = gps->utc_month,
+            .day = gps->utc_day,
+        };
+
+        last_date = gps->date_ordinal;
+        zbus_chan_pub(&gps_date_chan, &msg, K_NO_WAIT);
+        event_stats.date++;
+    }
+
+    if (gps->utc_sod >= 0 && gps->utc_sod != last_sod) {
+        const gps_time_msg_t msg = {
+            .utc_sod = gps->utc_sod,
+            .date_ordinal = gps->date_valid ? gps->date_ordinal : -1,
+        };
+
+        last_sod = gps->utc_sod;
+        zbus_chan_pub(&gps_time_chan, &msg, K_NO_WAIT);
+        event_stats.time++;
+    }
+}
+
+void gps_events_get_stats(gps_events_stats_t *stats)
+{
+    if (stats) {
+        *stats = event_stats;
+    }
+}
@@ -0,0 +1,85 @@
+/**
+ * @file gps_events.h
+ * @brief GPS event channels (zbus): fix acquired/lost/moved, UTC second, date change
+ *
+ * The GPS driver hands every fix it publishes to gps_events_update(), which
+ * compares it with what was last announced and publishes on a channel only
+ * when something a consumer cares about changed. Positions on gps_fix_chan are
+ * smoothed by the position filter (gps_position.h). Consumers attach listeners or
+ * subscribers (ZBUS_CHAN_ADD_OBS) instead of polling the fix every loop.
+ *
+ * Messages live in the channels themselves (allocated at build time); nothing
+ * is allocated per event.
+ */
+
+#ifndef GPS_EVENTS_H
+#define GPS_EVENTS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <zephyr/zbus/zbus.h>
+
+struct gps_data;
+
+/**
+ * @brief Fix channel events
+ */
+typedef enum {
+    GPS_FIX_ACQUIRED = 0,       ///< Valid fix after none (or after boot)
+    GPS_FIX_LOST,               ///< Receiver reports no fix (position kept from the last one)
+    GPS_FIX_MOVED,              ///< Smoothed position more than GPS_POSITION_MOVE_KM from the last announced one
+} gps_fix_event_t;
+
+/**
+ * @brief gps_fix_chan message
+ */
+typedef struct {
+    gps_fix_event_t event;
+    double latitude;            ///< Decimal degrees (+ = North)
+    double longitude;           ///< Decimal degrees (+ = East)
+} gps_fix_msg_t;
+
+/**
+ * @brief gps_time_chan message, one per new UTC second received
+ */
+typedef struct {
+    int32_t utc_sod;            ///< UTC seconds since midnight
+    int32_t date_ordinal;       ///< UTC date as days since 2000-01-01 (-1 if unknown)
+} gps_time_msg_t;
+
+/**
+ * @brief gps_date_chan message, once per UTC date
+ */
+typedef struct {
+    int32_t date_ordinal;       ///< Days since 2000-01-01
+    int year;
+    int month;
+    int day;
+} gps_date_msg_t;
+
+ZBUS_CHAN_DECLARE(gps_fix_chan, gps_time_chan, gps_date_chan);
+
+/**
+ * @brief Publication counts per channel
+ */
+typedef struct {
+    uint32_t fix;               ///< Acquired and lost
+    uint32_t moved;
+    uint32_t suppressed;        ///< Raw fixes past the move threshold that the filter held back
+    uint32_t time;
+    uint32_t date;
+} gps_events_stats_t;
+
+/**
+ * @brief Announce what changed in a newly published fix (GPS parser context)
+ * @param gps Fix just published to gps_snapshot() readers
+ */
+void gps_events_update(const struct gps_data *gps);
+
+/**
+ * @brief Get publication counts
+ * @param stats Output statistics
+ */
+void gps_events_get_stats(gps_events_stats_t *stats);
+
+#endif // GPS_EVENTS_H
@@ -1,21 +1,19 @@
 /**
  * @file gps_neo7m.h
- * @brief NEO-7M GPS module driver for NMEA data processing
+ * @brief NEO-7M GPS module backend for the shared GNSS core
  *
- * This module handles NEO-7M GPS communication via UART and processes NMEA sentences
- * to extract position, time, and date information.
+ * This module handles NEO-7M GPS communication via UART and configures the
+ * receiver; parsing, fix publication and local time live in gnss_core.h.
  *
  * Hardware: NEO-7M WPI430 Velleman GPS Module
- * - Default baud rate: 9600 bps
- * - Output: NMEA 0183 protocol
+ * - Default baud rate: 9600 bps, moved to GPS_CONFIG_BAUD at boot (gps_config.h)
+ * - Output: NMEA 0183 RMC/GGA/GSA, or UBX NAV-PVT when built with GPS_UBX_MODE
  * - Update rate: 1Hz (configurable up to 10Hz)
  *
  * UART Configuration:
- * - UART0: 9600 baud, 8N1
+ * - UART0: 8N1, async API (DMA double buffering, RX timeout), baud rate detected
  * - P0.08: NEO-7M TX (connect to GPS module TX)
  * - P0.06: NEO-7M RX (connect to GPS module RX)
- *
- * COMPATIBLE INTERFACE: Uses same function/variable names as gps.h
  */
 
 #ifndef GPS_NEO7M_H
@@ -30,6 +28,8 @@
 #include <stdlib.h>
 #include <math.h>
 #include <stdbool.h>
+#include "gnss_core.h"
+#include "gps_config.h"
 
 // Hardware configuration
 // Board-specific UART selection
@@ -40,80 +40,6 @@
 #else
     #define GPS_UART_NODE DT_NODELABEL(uart0)  ///< GPS on UART0 (nrf52dk, default)
 #endif
-#define GPS_BUFFER_SIZE 256                 ///< NMEA sentence buffer size
-
-/**
- * @brief GPS data structure containing parsed NMEA information
- * EXACTLY matches struct gps_data from gps.h for compatibility
- */
-struct gps_data {
-    double latitude;                ///< Latitude in decimal degrees (+ = North, - = South)
-    double longitude;               ///< Longitude in decimal degrees (+ = East, - = West)
-    double seeHeight;               ///< Altitude above sea level in meters
-    char lat_hemisphere;            ///< Latitude hemisphere ('N' or 'S')
-    char lon_hemisphere;            ///< Longitude hemisphere ('E' or 'W')
-    char time_str[11];              ///< GPS time in HH:MM:SS format (UTC)
-    char date_str[20];              ///< Date in DD/MM/YYYY format
-    char hijri_date_str[20];        ///< Hijri date in DD/MM/YYYY format
-    char day_of_week[12];           ///< Day name (e.g., "Monday")
-    bool valid;                     ///< True when GPS has satellite fix
-    bool date_valid;                ///< True when date information is available
-    bool hijri_valid;               ///< True when Hijri date is calculated
-    bool day_valid;                 ///< True when day of week is available
-    bool seeHeight_valid;           ///< True when altitude is valid
-};
-
-// Global GPS data instance
-extern struct gps_data current_gps;
-
-// Function declarations - EXACTLY matches gps.h interface
-
-/**
- * @brief Initialize GPS module and UART communication
- * @return 0 on success, -1 on failure
- */
-int gps_init(void);
-
-/**
- * @brief Process GPS data (compatibility function for interrupt-driven mode)
- */
-void gps_process_data(void);
-
-/**
- * @brief Print current GPS information to console (debug function)
- */
-void gps_print_info(void);
-
-/**
- * @brief Display GPS data on LCD screen
- * @param display_dev Display device pointer
- * @param x X position on screen
- * @param y Y position on screen
- */
-void display_gps_data(const struct device *display_dev, int x, int y);
-
-/**
- * @brief Get current date string for prayer calculations
- * @return Pointer to date string in DD/MM/YYYY format
- */
-const char* gps_get_today_date(void);
-
-/**
- * @brief Get local time with automatic DST adjustment (CET/CEST)
- * Automatically detects DST based on European rules:
- * - DST starts: Last Sunday of March at 2:00 AM (UTC+2)
- * - DST ends: Last Sunday of October at 3:00 AM (UTC+1)
- * @param local_time Output buffer for local time
- * @param max_len Size of output buffer (must be at least 11 bytes)
- * @return Timezone offset applied (1 for CET winter, 2 for CEST summer, 0 if invalid)
- */
-int gps_get_local_time(char *local_time, size_t max_len);
-
-/**
- * @brief Auto-configure timezone based on GPS coordinates
- * Uses GPS longitude to calculate timezone offset and updates prayer time settings
- */
-void gps_auto_configure_timezone(void);
 
 /**
  * @brief Send test data on UART for loopback testing
@@ -122,16 +48,9 @@ void gps_auto_configure_timezone(void);
 void gps_send_test_data(int count);
 
 /**
- * @brief Print raw NMEA sentences received from GPS
- * Displays the last 5 NMEA sentences received for debugging
- */
-void gps_print_raw_data(void);
-
-/**
- * @brief Get GPS statistics
- * @param bytes_rx Pointer to store total bytes received (can be NULL)
- * @param sentences_parsed Pointer to store total sentences parsed (can be NULL)
+ * @brief Get UART reception statistics
+ * @param stats Output statistics
  */
-void gps_get_stats(uint32_t *bytes_rx, uint32_t *sentences_parsed);
+void gps_get_rx_stats(gps_rx_stats_t *stats);
 
 #endif // GPS_NEO7M_H
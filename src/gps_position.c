@@ -0,0 +1,104 @@
+/**
+ * @file gps_position.c
+ * @brief Position filter implementation
+ */
+
+#include "gps_position.h"
+#include <math.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define KM_PER_DEGREE   111.32
+
+static double avg_latitude;
+static double avg_longitude;
+static double avg_weight;               ///< Sum of weights in the average
+static uint32_t avg_fixes;              ///< Fixes since the last reset
+static uint32_t far_fixes;              ///< Consecutive fixes beyond GPS_POSITION_JUMP_KM
+
+static gps_position_stats_t position_stats;
+
+void gps_position_reset(void)
+{
+    if (avg_fixes > 0) {
+        position_stats.resets++;
+    }
+    avg_fixes = 0;
+    avg_weight = 0.0;
+    far_fixes = 0;
+}
+
+void gps_position_add(double latitude, double longitude, double hdop)
+{
+    if (hdop <= 0.0) {
+        hdop = GPS_POSITION_HDOP_NONE;
+    }
+    // Position error scales with HDOP: weight by inverse variance (floored at HDOP 0.5)
+    hdop = fmax(hdop, 0.5);
+    double weight = 1.0 / (hdop * hdop);
+
+    if (avg_fixes > 0 &&
+        gps_position_distance_km(latitude, longitude, avg_latitude, avg_longitude) > GPS_POSITION_JUMP_KM) {
+        if (++far_fixes < GPS_POSITION_JUMP_FIXES) {
+            position_stats.outliers++;
+            return;
+        }
+        // Consistently elsewhere: start over from this fix
+        position_stats.jumps++;
+        avg_fixes = 0;
+        avg_weight = 0.0;
+    }
+    far_fixes = 0;
+
+    // Settled: forget old fixes at the rate of the averaging window
+    if (avg_fixes >= GPS_POSITION_AVG_FIXES) {
+        avg_weight *= (GPS_POSITION_AVG_FIXES - 1) / (double)GPS_POSITION_AVG_FIXES;
+    }
+
+    avg_weight += weight;
+    avg_latitude += (latitude - avg_latitude) * weight / avg_weight;
+    avg_longitude += (longitude - avg_longitude) * weight / avg_weight;
+
+    avg_fixes++;
+    position_stats.fixes++;
+    if (avg_fixes == GPS_POSITION_AVG_FIXES) {
+        position_stats.settled++;
+    }
+}
+
+bool gps_position_get(double *latitude, double *longitude)
+{
+    if (avg_fixes == 0) {
+        return false;
+    }
+    *latitude = avg_latitude;
+    *longitude = avg_longitude;
+    return true;
+}
+
+bool gps_position_settled(void)
+{
+    return avg_fixes >= GPS_POSITION_AVG_FIXES;
+}
+
+double gps_position_distance_km(double lat1, double lon1, double lat2, double lon2)
+{
+    double dy = (lat2 - lat1) * KM_PER_DEGREE;
+    double dx = (lon2 - lon1) * KM_PER_DEGREE * cos((lat1 + lat2) * M_PI / 360.0);
+
+    return sqrt(dx * dx + dy * dy);
+}
+
+bool gps_position_moved(double lat, double lon, double ref_lat, double ref_lon)
+{
+    return gps_position_distance_km(lat, lon, ref_lat, ref_lon) > GPS_POSITION_MOVE_KM;
+}
+
+void gps_position_get_stats(gps_position_stats_t *stats)
+{
+    if (stats) {
+        *stats = position_stats;
+    }
+}
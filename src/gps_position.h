@@ -0,0 +1,85 @@
+/**
+ * @file gps_position.h
+ * @brief Position filter: HDOP-weighted averaging and a movement threshold
+ *
+ * Single fixes scatter by tens of metres, more with a poor satellite geometry.
+ * The filter averages the first GPS_POSITION_AVG_FIXES fixes weighted by
+ * 1/HDOP², then keeps a running average with the same memory, so a stationary
+ * receiver settles on one position and a moving one is followed within a few
+ * fixes. A fix far from the average is held out of it as an outlier; several
+ * in a row are a relocation and restart the averaging at the new place instead
+ * of sliding there fix by fix.
+ *
+ * Consumers compare the smoothed position against the one their work was done
+ * for with gps_position_moved() and only redo it beyond GPS_POSITION_MOVE_KM.
+ *
+ * The filter state is owned by the GPS parser context (gps_events.c).
+ */
+
+#ifndef GPS_POSITION_H
+#define GPS_POSITION_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define GPS_POSITION_AVG_FIXES  10      ///< Fixes averaged before the position is settled
+#define GPS_POSITION_MOVE_KM    1.0     ///< Smoothed movement that invalidates position work
+#define GPS_POSITION_HDOP_NONE  2.0     ///< HDOP assumed when the receiver reports none
+#define GPS_POSITION_JUMP_KM    5.0     ///< Fix this far from the average is an outlier...
+#define GPS_POSITION_JUMP_FIXES 3       ///< ...unless this many in a row: then a relocation
+
+/**
+ * @brief Filter statistics
+ */
+typedef struct {
+    uint32_t fixes;                 ///< Fixes filtered
+    uint32_t settled;               ///< Averaging periods completed (one per acquisition)
+    uint32_t resets;                ///< Restarts after a fix loss
+    uint32_t outliers;              ///< Fixes held out of the average
+    uint32_t jumps;                 ///< Restarts after GPS_POSITION_JUMP_FIXES far fixes
+} gps_position_stats_t;
+
+/**
+ * @brief Restart averaging (fix lost: the receiver may move before the next one)
+ */
+void gps_position_reset(void);
+
+/**
+ * @brief Add one fix (once per navigation epoch)
+ * @param latitude Decimal degrees
+ * @param longitude Decimal degrees
+ * @param hdop Horizontal dilution of precision, 0 if unknown
+ */
+void gps_position_add(double latitude, double longitude, double hdop);
+
+/**
+ * @brief Get the smoothed position
+ * @param latitude Output decimal degrees
+ * @param longitude Output decimal degrees
+ * @return true once at least one fix was added since the last reset
+ */
+bool gps_position_get(double *latitude, double *longitude);
+
+/**
+ * @brief Whether the first GPS_POSITION_AVG_FIXES fixes have been averaged
+ */
+bool gps_position_settled(void);
+
+/**
+ * @brief Distance between two positions (equirectangular, ample below 100 km)
+ * @return Kilometres
+ */
+double gps_position_distance_km(double lat1, double lon1, double lat2, double lon2);
+
+/**
+ * @brief Whether a position is more than GPS_POSITION_MOVE_KM from a reference
+ */
+bool gps_position_moved(double lat, double lon, double ref_lat, double ref_lon);
+
+/**
+ * @brief Get filter statistics
+ * @param stats Output statistics
+ */
+void gps_position_get_stats(gps_position_stats_t *stats);
+
+#endif // GPS_POSITION_H
@@ -0,0 +1,144 @@
+/**
+ * @file gps_power.c
+ * @brief GPS power policy: continuous acquisition, then ON/OFF operation
+ */
+
+#include "gps_power.h"
+#include "gps_neo7m.h"
+#include "gps_config.h"
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+#define GPS_POWER_CHECK_MS      5000    ///< Policy evaluation period
+#define GPS_POWER_LOST_PERIODS  3       ///< Update periods without a fix before reacquiring
+
+static const uint32_t stage_period_s[GPS_POWER_STAGE_COUNT] = {
+    [GPS_POWER_ACQUIRE] = 0,
+    [GPS_POWER_CYCLIC] = GPS_POWER_CYCLIC_PERIOD_S,
+    [GPS_POWER_TIME_ONLY] = GPS_POWER_REFRESH_PERIOD_S,
+};
+
+static const char *const stage_names[GPS_POWER_STAGE_COUNT] = {
+    "acquire", "cyclic", "time-only",
+};
+
+static gps_power_stats_t power_stats;
+static uint64_t stage_ms[GPS_POWER_STAGE_COUNT];
+static uint32_t stage_mark_ms;          ///< Uptime up to which stage_ms is accounted
+static uint32_t stage_entered_ms;
+static uint32_t last_fix_ms;            ///< Last position update seen
+static uint32_t counted_fix_ms;         ///< Last fix counted towards GPS_POWER_TRUST_FIXES
+static uint32_t trusted_fixes;
+static uint32_t hold_until_ms;          ///< Full tracking until then (midnight wake)
+static bool holding;
+static atomic_t wake_requested;
+
+static void gps_power_work_handler(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(gps_power_work, gps_power_work_handler);
+
+static void enter_stage(gps_power_stage_t stage, uint32_t now)
+{
+    if (stage != power_stats.stage) {
+        power_stats.transitions++;
+        printk("GPS power: %s -> %s\n", stage_names[power_stats.stage], stage_names[stage]);
+    }
+    power_stats.stage = stage;
+    stage_entered_ms = now;
+    trusted_fixes = 0;
+    gps_config_set_power(stage_period_s[stage]);
+}
+
+/**
+ * @brief Evaluate the policy (system work queue)
+ */
+static void gps_power_work_handler(struct k_work *work)
+{
+    uint32_t now = k_uptime_get_32();
+    gps_rx_stats_t rx;
+    gps_get_rx_stats(&rx);
+
+    stage_ms[power_stats.stage] += now - stage_mark_ms;
+    stage_mark_ms = now;
+
+    // A fix is only useful to the clock with date and time alongside
+    struct gps_data gps;
+    gps_snapshot(&gps);
+    bool fix = gps.valid && gps.date_valid && gps.utc_sod >= 0;
+    bool new_fix = fix && rx.last_fix_ms != last_fix_ms;
+    if (new_fix) {
+        last_fix_ms = rx.last_fix_ms;
+    }
+
+    if (atomic_clear(&wake_requested)) {
+        holding = true;
+        hold_until_ms = now + GPS_POWER_WAKE_HOLD_S * 1000U;
+        enter_stage(GPS_POWER_ACQUIRE, now);
+    }
+    if (holding && (int32_t)(now - hold_until_ms) >= 0) {
+        holding = false;
+    }
+
+#ifndef GPS_CONTINUOUS
+    // Time since the last fix, or since entering the stage if there was none in it
+    uint32_t since = ((int32_t)(last_fix_ms - stage_entered_ms) > 0) ? last_fix_ms : stage_entered_ms;
+    uint32_t period_ms = stage_period_s[power_stats.stage] * 1000U;
+    bool lost = (now - since) > GPS_POWER_LOST_PERIODS * period_ms + GPS_POWER_CHECK_MS;
+
+    switch (power_stats.stage) {
+    case GPS_POWER_ACQUIRE:
+        if (fix && !holding && gps_config_done()) {
+            enter_stage(GPS_POWER_CYCLIC, now);
+        }
+        break;
+
+    case GPS_POWER_CYCLIC:
+        // One count per wake-up: the receiver reports several fixes while it is on
+        if (new_fix && last_fix_ms - counted_fix_ms >= period_ms / 2) {
+            counted_fix_ms = last_fix_ms;
+            if (++trusted_fixes >= GPS_POWER_TRUST_FIXES) {
+                enter_stage(GPS_POWER_TIME_ONLY, now);
+            }
+        } else if (lost) {
+            enter_stage(GPS_POWER_ACQUIRE, now);
+        }
+        break;
+
+    case GPS_POWER_TIME_ONLY:
+        if (lost) {
+            enter_stage(GPS_POWER_ACQUIRE, now);
+        }
+        break;
+
+    default:
+        break;
+    }
+#endif
+
+    k_work_reschedule(&gps_power_work, K_MSEC(GPS_POWER_CHECK_MS));
+}
+
+void gps_power_init(void)
+{
+    uint32_t now = k_uptime_get_32();
+
+    stage_mark_ms = now;
+    power_stats.stage = GPS_POWER_ACQUIRE;
+    enter_stage(GPS_POWER_ACQUIRE, now);
+    k_work_schedule(&gps_power_work, K_MSEC(GPS_POWER_CHECK_MS));
+}
+
+void gps_power_full_tracking(void)
+{
+    atomic_set(&wake_requested, 1);
+    k_work_reschedule(&gps_power_work, K_NO_WAIT);
+}
+
+void gps_power_get_stats(gps_power_stats_t *stats)
+{
+    if (stats) {
+        *stats = power_stats;
+        for (int i = 0; i < GPS_POWER_STAGE_COUNT; i++) {
+            stats->stage_s[i] = (uint32_t)(stage_ms[i] / 1000U);
+        }
+    }
+}
@@ -0,0 +1,63 @@
+/**
+ * @file gps_power.h
+ * @brief GPS power policy: track for a fix, then duty-cycle the receiver
+ *
+ * A wall clock needs one good fix a day plus time discipline. The receiver
+ * tracks continuously until position, date and time are valid, then runs in
+ * ON/OFF operation with one fix a minute; once a few of those fixes have come
+ * in, it backs off to one fix an hour to refresh the time. Shortly before UTC
+ * midnight (the scheduler runs on local time, so the main loop moves the
+ * wake-up with the UTC offset) it calls gps_power_full_tracking(): the next
+ * day's prayer times are calculated on the GPS date change, which then comes
+ * from a fresh fix instead of the next hourly one.
+ *
+ * Build with GPS_CONTINUOUS to keep the receiver tracking (stages are still counted).
+ */
+
+#ifndef GPS_POWER_H
+#define GPS_POWER_H
+
+#include <stdint.h>
+
+#define GPS_POWER_CYCLIC_PERIOD_S   60      ///< One fix a minute after acquisition
+#define GPS_POWER_REFRESH_PERIOD_S  3600    ///< One fix an hour once position and time are trusted
+#define GPS_POWER_TRUST_FIXES       5       ///< ON/OFF fixes before backing off to hourly
+#define GPS_POWER_WAKE_UTC_SOD      (23 * 3600 + 50 * 60)  ///< UTC time to resume full tracking
+#define GPS_POWER_WAKE_HOLD_S       (20 * 60)   ///< Full tracking kept across UTC midnight
+
+/**
+ * @brief Policy stages
+ */
+typedef enum {
+    GPS_POWER_ACQUIRE = 0,      ///< Continuous tracking until a fix with date and time
+    GPS_POWER_CYCLIC,           ///< ON/OFF operation, GPS_POWER_CYCLIC_PERIOD_S
+    GPS_POWER_TIME_ONLY,        ///< ON/OFF operation, GPS_POWER_REFRESH_PERIOD_S
+    GPS_POWER_STAGE_COUNT
+} gps_power_stage_t;
+
+/**
+ * @brief Policy statistics
+ */
+typedef struct {
+    gps_power_stage_t stage;                    ///< Current stage
+    uint32_t stage_s[GPS_POWER_STAGE_COUNT];    ///< Seconds spent in each stage
+    uint32_t transitions;                       ///< Stage changes
+} gps_power_stats_t;
+
+/**
+ * @brief Start the policy (after gps_init())
+ */
+void gps_power_init(void);
+
+/**
+ * @brief Go back to continuous tracking for GPS_POWER_WAKE_HOLD_S, then duty-cycle again
+ */
+void gps_power_full_tracking(void);
+
+/**
+ * @brief Get policy statistics
+ * @param stats Output statistics
+ */
+void gps_power_get_stats(gps_power_stats_t *stats);
+
+#endif // GPS_POWER_H
@@ -0,0 +1,576 @@
+/**
+ * @file gps_replay.c
+ * @brief GNSS replay backend: paced NMEA/UBX feeder with fault injection and latency probes
+ *
+ * The feeder thread hands bytes to the core in chunks of at most one NEO-7M DMA
+ * buffer, so the core's work item runs between chunks exactly as it does after
+ * a UART callback. A small scanner follows the source stream to count messages
+ * and to remember when each UTC second went in, for the latency statistics.
+ */
+
+#include "gps_replay.h"
+#include "gps_events.h"
+#include "time_of_day.h"
+#include "ubx.h"
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/zbus/zbus.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define GPS_REPLAY_TICK_MS      10      ///< Feeder period (uptime)
+#define GPS_REPLAY_CHUNK        64      ///< Bytes per core call, one NEO-7M DMA buffer
+#define GPS_REPLAY_MARKS        64      ///< UTC seconds remembered for end-to-end latency (power of 2)
+#define GPS_REPLAY_SAMPLES      256     ///< End-to-end latency samples kept for the percentiles
+#define GPS_REPLAY_STACK_SIZE   1536
+#define GPS_REPLAY_PRIORITY     7       ///< Preemptible: the core's work item runs between chunks
+
+static const gnss_backend_t replay_backend = {
+    .name = "REPLAY",
+    .ubx_frame = NULL,
+};
+
+#ifdef GPS_REPLAY_LOG
+// Recorded receiver output, embedded at build time (CMakeLists.txt)
+static const uint8_t replay_log[] = {
+#include "gps_replay_log.inc"
+};
+static size_t replay_log_pos;
+#else
+/**
+ * @brief One stretch of the built-in script
+ */
+typedef struct {
+    int year;                       ///< Jump to this UTC date (0 = continue from the previous phase)
+    int month;
+    int day;
+    int32_t sod;                    ///< UTC time at the jump
+    uint32_t duration_s;
+    bool fix;
+    int32_t lat_e7;
+    int32_t lon_e7;
+} replay_phase_t;
+
+// Berlin, then Munich (500 km: a GPS_FIX_MOVED event); the script repeats
+static const replay_phase_t replay_script[] = {
+    // UTC date rollover two minutes in
+    { 2026, 3, 28, 23 * 3600 + 58 * 60, 300, true, 525200000, 134050000 },
+    // Fix lost for a minute, time and date still sent
+    { 0, 0, 0, 0, 60, false, 525200000, 134050000 },
+    // DST starts at 01:00 UTC on the last Sunday of March
+    { 0, 0, 0, 0, 3600, true, 525200000, 134050000 },
+    // DST ends at 01:00 UTC on the last Sunday of October
+    { 2026, 10, 25, 58 * 60, 240, true, 481370000, 115750000 },
+};
+
+static uint8_t epoch[768];          ///< Receiver output for the current second
+static size_t epoch_len;
+static size_t epoch_pos;
+static uint32_t epochs;             ///< Seconds generated so far
+static uint8_t phase;
+static uint32_t phase_s;
+static int32_t sim_date;            ///< Days since 2000-01-01
+static int32_t sim_sod;
+#endif
+
+// Source stream scanner (feeder thread)
+enum {
+    SCAN_IDLE = 0,
+    SCAN_NMEA,
+    SCAN_UBX_HEADER,
+    SCAN_UBX_BODY,
+};
+
+static struct {
+    uint8_t state;
+    uint8_t prev;
+    uint8_t len;
+    uint8_t buf[24];                ///< Start of the sentence, or UBX header / payload
+    uint8_t ubx_class;
+    uint8_t ubx_id;
+    uint16_t remaining;             ///< UBX payload and checksum bytes still to come
+    bool fix;                       ///< Source reports a fix
+} scan;
+
+// When each UTC second went in, keyed by utc_sod
+static struct {
+    int32_t sod;
+    uint32_t in_ms;
+} marks[GPS_REPLAY_MARKS];
+
+static atomic_t fix_in_ms;          ///< First valid message after a fix loss (0 = none pending)
+static uint32_t rand_state = 0x2545F491;
+
+static gps_replay_stats_t stats;
+static uint16_t e2e_samples[GPS_REPLAY_SAMPLES];
+
+/**
+ * @brief xorshift32: reproducible fault positions from run to run
+ */
+static uint32_t replay_rand(void)
+{
+    rand_state ^= rand_state << 13;
+    rand_state ^= rand_state >> 17;
+    rand_state ^= rand_state << 5;
+    return rand_state;
+}
+
+/**
+ * @brief A message carrying a UTC second went in
+ */
+static void replay_mark(int32_t sod, bool fix)
+{
+    uint32_t now = k_uptime_get_32();
+
+    marks[sod & (GPS_REPLAY_MARKS - 1)].sod = sod;
+    marks[sod & (GPS_REPLAY_MARKS - 1)].in_ms = now;
+
+    if (fix && !scan.fix) {
+        atomic_set(&fix_in_ms, MAX(now, 1U));
+    }
+    scan.fix = fix;
+}
+
+/**
+ * @brief RMC sentence complete: "$GPRMC,hhmmss.ss,A,..."
+ */
+static void scan_nmea_done(void)
+{
+    const char *s = (const char *)scan.buf;
+
+    if (scan.len < 19 || memcmp(&s[3], "RMC,", 4) != 0) {
+        return;
+    }
+    for (int i = 7; i < 13; i++) {
+        if (s[i] < '0' || s[i] > '9') {
+            return;
+        }
+    }
+
+    const char *status = memchr(&s[7], ',', scan.len - 7);
+    if (status && status + 1 < s + scan.len) {
+        replay_mark(tod_from_hms((s[7] - '0') * 10 + s[8] - '0', (s[9] - '0') * 10 + s[10] - '0',
+                                 (s[11] - '0') * 10 + s[12] - '0'),
+                    status[1] == 'A');
+    }
+}
+
+/**
+ * @brief UBX frame complete: NAV-PVT carries time and fix in its first 24 payload bytes
+ */
+static void scan_ubx_done(void)
+{
+    const uint8_t *p = scan.buf;
+
+    if (scan.ubx_class != UBX_CLASS_NAV || scan.ubx_id != UBX_ID_NAV_PVT ||
+        scan.len < sizeof(scan.buf) || !(p[11] & 0x02)) {
+        return;
+    }
+    replay_mark(tod_from_hms(p[8], p[9], p[10]), (p[21] & 0x01) && (p[20] == 2 || p[20] == 3));
+}
+
+/**
+ * @brief Follow the source stream byte by byte
+ */
+static void scan_byte(uint8_t byte)
+{
+    switch (scan.state) {
+    case SCAN_UBX_HEADER:
+        scan.buf[scan.len++] = byte;
+        if (scan.len == 4) {
+            scan.ubx_class = scan.buf[0];
+            scan.ubx_id = scan.buf[1];
+            scan.remaining = (scan.buf[2] | (scan.buf[3] << 8)) + 2;
+            scan.len = 0;
+            scan.state = SCAN_UBX_BODY;
+        }
+        break;
+
+    case SCAN_UBX_BODY:
+        if (scan.len < sizeof(scan.buf)) {
+            scan.buf[scan.len++] = byte;
+        }
+        if (--scan.remaining == 0) {
+            scan_ubx_done();
+            scan.state = SCAN_IDLE;
+        }
+        break;
+
+    default:
+        if (byte == '$') {
+            stats.messages++;
+            scan.len = 0;
+            scan.state = SCAN_NMEA;
+        } else if (byte == UBX_SYNC2 && scan.prev == UBX_SYNC1) {
+            stats.messages++;
+            scan.len = 0;
+            scan.state = SCAN_UBX_HEADER;
+            break;
+        } else if (byte == '\n' && scan.state == SCAN_NMEA) {
+            scan_nmea_done();
+            scan.state = SCAN_IDLE;
+            break;
+        }
+        if (scan.state == SCAN_NMEA && scan.len < sizeof(scan.buf)) {
+            scan.buf[scan.len++] = byte;
+        }
+        break;
+    }
+    scan.prev = byte;
+}
+
+/**
+ * @brief Inject faults and hand one chunk to the core
+ */
+static void replay_feed(const uint8_t *data, size_t len)
+{
+    uint8_t chunk[GPS_REPLAY_CHUNK];
+    size_t out = 0;
+
+    for (size_t i = 0; i < len; i++) {
+        uint8_t byte = data[i];
+
+        scan_byte(byte);
+
+        if (GPS_REPLAY_CORRUPT_PPM + GPS_REPLAY_DROP_PPM > 0) {
+            uint32_t r = replay_rand() % 1000000U;
+            if (r < GPS_REPLAY_DROP_PPM) {
+                stats.dropped++;
+                continue;
+            }
+            if (r < GPS_REPLAY_DROP_PPM + GPS_REPLAY_CORRUPT_PPM) {
+                byte ^= BIT(replay_rand() & 7);
+                stats.corrupted++;
+            }
+        }
+        chunk[out++] = byte;
+    }
+
+    if (out > 0) {
+        gnss_core_rx_bytes(chunk, out);
+        stats.bytes += out;
+    }
+}
+
+#ifndef GPS_REPLAY_LOG
+/**
+ * @brief Append one NMEA sentence with its checksum to the epoch
+ */
+static void epoch_sentence(const char *body)
+{
+    uint8_t checksum = 0;
+
+    for (const char *c = body; *c; c++) {
+        checksum ^= (uint8_t)*c;
+    }
+    epoch_len += snprintf((char *)&epoch[epoch_len], sizeof(epoch) - epoch_len,
+                          "$%s*%02X\r\n", body, checksum);
+}
+
+/**
+ * @brief Satellites of the built-in script: the first eight are the GSA list
+ */
+static const struct {
+    uint8_t id;
+    uint8_t elevation;
+    uint16_t azimuth;               ///< At midnight; they drift by a degree every 4 minutes
+    uint8_t snr;
+} replay_sky[] = {
+    { 4, 62, 48, 44 }, { 5, 35, 301, 38 }, { 9, 18, 110, 31 }, { 12, 71, 205, 46 },
+    { 16, 44, 152, 40 }, { 18, 27, 252, 35 }, { 22, 12, 12, 27 }, { 24, 53, 96, 42 },
+    { 2, 6, 330, 18 }, { 29, 3, 178, 0 },
+};
+
+/**
+ * @brief GSV sequence (every fifth second, as gps_config.c asks the NEO-7M)
+ */
+static void epoch_gsv(bool fix)
+{
+    const int count = ARRAY_SIZE(replay_sky), total = DIV_ROUND_UP(count, 4);
+    char body[96];
+
+    for (int n = 0; n < total; n++) {
+        int len = snprintf(body, sizeof(body), "GPGSV,%d,%d,%02d", total, n + 1, count);
+
+        for (int i = n * 4; i < MIN(count, n * 4 + 4); i++) {
+            // Without a fix only the strongest few are tracked
+            uint8_t snr = (fix || replay_sky[i].snr >= 44) ? replay_sky[i].snr : 0;
+            int azimuth = (replay_sky[i].azimuth + sim_sod / 240) % 360;
+
+            len += snprintf(&body[len], sizeof(body) - len, ",%02u,%02u,%03d,", replay_sky[i].id,
+                            replay_sky[i].elevation, azimuth);
+            if (snr > 0) {
+                len += snprintf(&body[len], sizeof(body) - len, "%02u", snr);
+            }
+        }
+        epoch_sentence(body);
+    }
+}
+
+/**
+ * @brief Format a coordinate as NMEA ddmm.mmmm / dddmm.mmmm plus hemisphere
+ */
+static void format_coord(char *out, size_t size, int32_t deg_e7, int deg_digits, char pos, char neg)
+{
+    uint32_t value = (uint32_t)abs(deg_e7);
+    uint32_t min_e4 = (value % 10000000U) * 60U / 1000U;
+
+    snprintf(out, size, "%0*u%02u.%04u,%c", deg_digits, value / 10000000U,
+             min_e4 / 10000U, min_e4 % 10000U, deg_e7 < 0 ? neg : pos);
+}
+
+/**
+ * @brief Generate the receiver output for the current script second, then advance
+ */
+static void replay_next_epoch(void)
+{
+    const replay_phase_t *ph = &replay_script[phase];
+    int year, month, day;
+    int hour = sim_sod / 3600, minute = (sim_sod / 60) % 60, second = sim_sod % 60;
+
+    tod_civil_from_days(sim_date, &year, &month, &day);
+    epoch_len = 0;
+    epoch_pos = 0;
+
+#ifdef GPS_REPLAY_UBX
+    ubx_nav_pvt_t pvt = {
+        .year = year, .month = month, .day = day,
+        .hour = hour, .minute = minute, .second = second,
+        .date_valid = true, .time_valid = true,
+        .fix_type = ph->fix ? 3 : 0, .fix_ok = ph->fix, .num_sv = ph->fix ? 8 : 0,
+        .lat_e7 = ph->fix ? ph->lat_e7 : 0, .lon_e7 = ph->fix ? ph->lon_e7 : 0,
+        .height_mm = 80000, .hmsl_mm = 34000, .h_acc_mm = 2500, .pdop = 250,
+    };
+    epoch_len = ubx_build_nav_pvt(epoch, &pvt);
+#else
+    char body[96], lat[20], lon[20];
+
+    format_coord(lat, sizeof(lat), ph->lat_e7, 2, 'N', 'S');
+    format_coord(lon, sizeof(lon), ph->lon_e7, 3, 'E', 'W');
+
+    if (ph->fix) {
+        snprintf(body, sizeof(body), "GPRMC,%02d%02d%02d.00,A,%s,%s,0.0,0.0,%02d%02d%02d,,,A",
+                 hour, minute, second, lat, lon, day, month, year % 100);
+        epoch_sentence(body);
+        snprintf(body, sizeof(body), "GPGGA,%02d%02d%02d.00,%s,%s,1,08,1.0,34.0,M,46.0,M,,",
+                 hour, minute, second, lat, lon);
+        epoch_sentence(body);
+        epoch_sentence("GPGSA,A,3,04,05,09,12,16,18,22,24,,,,,2.5,1.3,2.1");
+    } else {
+        snprintf(body, sizeof(body), "GPRMC,%02d%02d%02d.00,V,,,,,,,%02d%02d%02d,,,N",
+                 hour, minute, second, day, month, year % 100);
+        epoch_sentence(body);
+        snprintf(body, sizeof(body), "GPGGA,%02d%02d%02d.00,,,,,0,00,99.99,,,,,,",
+                 hour, minute, second);
+        epoch_sentence(body);
+        epoch_sentence("GPGSA,A,1,,,,,,,,,,,,,99.99,99.99,99.99");
+    }
+    if (sim_sod % 5 == 0) {
+        epoch_gsv(ph->fix);
+    }
+    snprintf(body, sizeof(body), "GPZDA,%02d%02d%02d.00,%02d,%02d,%04d,00,00",
+             hour, minute, second, day, month, year);
+    epoch_sentence(body);
+#endif
+
+    // Next second, and the next phase when this one is over
+    epochs++;
+    sim_sod++;
+    if (sim_sod == 86400) {
+        sim_sod = 0;
+        sim_date++;
+    }
+    if (++phase_s == ph->duration_s) {
+        phase_s = 0;
+        phase = (phase + 1) % ARRAY_SIZE(replay_script);
+        if (replay_script[phase].year != 0) {
+            sim_date = tod_days_from_civil(replay_script[phase].year, replay_script[phase].month,
+                                           replay_script[phase].day);
+            sim_sod = replay_script[phase].sod;
+        }
+    }
+}
+#endif
+
+/**
+ * @brief Next source bytes the line can carry at receiver time sim_ms
+ * @return Number of contiguous bytes at *data (0 = line idle)
+ */
+static size_t replay_source(const uint8_t **data, uint64_t sim_ms)
+{
+#ifdef GPS_REPLAY_LOG
+    if (replay_log_pos == sizeof(replay_log)) {
+        replay_log_pos = 0;
+    }
+    *data = &replay_log[replay_log_pos];
+    return sizeof(replay_log) - replay_log_pos;
+#else
+    if (epoch_pos == epoch_len) {
+        // The receiver sends one burst per second
+        if (sim_ms < (uint64_t)epochs * 1000U) {
+            return 0;
+        }
+        replay_next_epoch();
+    }
+    *data = &epoch[epoch_pos];
+    return epoch_len - epoch_pos;
+#endif
+}
+
+static void replay_consume(size_t len)
+{
+#ifdef GPS_REPLAY_LOG
+    replay_log_pos += len;
+#else
+    epoch_pos += len;
+#endif
+}
+
+/**
+ * @brief Feeder thread: pace the source at the emulated line rate
+ */
+static void replay_thread(void *p1, void *p2, void *p3)
+{
+    int64_t start = k_uptime_get();
+    uint64_t line_bytes = 0;        // Bytes the line has had time for so far
+
+#ifndef GPS_REPLAY_LOG
+    sim_date = tod_days_from_civil(replay_script[0].year, replay_script[0].month,
+                                   replay_script[0].day);
+    sim_sod = replay_script[0].sod;
+#endif
+
+    while (1) {
+        k_msleep(GPS_REPLAY_TICK_MS);
+
+        // Receiver time, and what an 8N1 line (10 bits per byte) carries in it
+        uint64_t sim_ms = (uint64_t)(k_uptime_get() - start) * GPS_REPLAY_SPEEDUP;
+        uint64_t budget = sim_ms * (GPS_REPLAY_BAUD / 10) / 1000U;
+
+        while (line_bytes < budget) {
+            const uint8_t *data;
+            size_t len = replay_source(&data, sim_ms);
+
+            if (len == 0) {
+                // Idle line: unused time is not made up later
+                line_bytes = budget;
+                break;
+            }
+            len = MIN(len, (size_t)MIN((uint64_t)GPS_REPLAY_CHUNK, budget - line_bytes));
+            replay_feed(data, len);
+            replay_consume(len);
+            line_bytes += len;
+        }
+    }
+}
+
+K_THREAD_DEFINE(gps_replay_tid, GPS_REPLAY_STACK_SIZE,
+                replay_thread, NULL, NULL, NULL,
+                GPS_REPLAY_PRIORITY, 0, SYS_FOREVER_MS);
+
+/**
+ * @brief Fix acquired: close the fix latency measurement (GPS parser context)
+ */
+static void on_replay_fix(const struct zbus_channel *chan)
+{
+    const gps_fix_msg_t *msg = zbus_chan_const_msg(chan);
+
+    if (msg->event != GPS_FIX_ACQUIRED) {
+        return;
+    }
+
+    uint32_t in_ms = (uint32_t)atomic_clear(&fix_in_ms);
+    if (in_ms != 0) {
+        stats.fix_latency_ms = k_uptime_get_32() - in_ms;
+        stats.fix_latency_max_ms = MAX(stats.fix_latency_max_ms, stats.fix_latency_ms);
+        stats.fixes++;
+    }
+}
+
+ZBUS_LISTENER_DEFINE(gps_replay_listener, on_replay_fix);
+ZBUS_CHAN_ADD_OBS(gps_fix_chan, gps_replay_listener, 0);
+
+/**
+ * @brief Initialize the replay backend and start feeding
+ */
+int gps_init(void)
+{
+    gnss_core_init(&replay_backend);
+
+#ifdef GPS_REPLAY_LOG
+    printk("REPLAY: %u byte log", (unsigned int)sizeof(replay_log));
+#elif defined(GPS_REPLAY_UBX)
+    printk("REPLAY: NAV-PVT script");
+#else
+    printk("REPLAY: NMEA script");
+#endif
+    printk(" at %u baud, %ux, %u ppm corrupted, %u ppm dropped\n",
+           GPS_REPLAY_BAUD, GPS_REPLAY_SPEEDUP, GPS_REPLAY_CORRUPT_PPM, GPS_REPLAY_DROP_PPM);
+
+    k_thread_start(gps_replay_tid);
+    return 0;
+}
+
+/**
+ * @brief Process GPS data (compatibility function)
+ */
+void gps_process_data(void)
+{
+    // Bytes are fed and parsed in the background
+}
+
+void gps_replay_displayed(int32_t utc_sod)
+{
+    if (utc_sod < 0) {
+        return;
+    }
+
+    // Each second is measured once, at the first refresh that shows it
+    uint32_t now = k_uptime_get_32();
+    int i = utc_sod & (GPS_REPLAY_MARKS - 1);
+    if (marks[i].sod != utc_sod || marks[i].in_ms == 0) {
+        return;
+    }
+
+    e2e_samples[stats.e2e_samples % GPS_REPLAY_SAMPLES] = MIN(now - marks[i].in_ms, UINT16_MAX);
+    stats.e2e_samples++;
+    stats.e2e_max_ms = MAX(stats.e2e_max_ms, now - marks[i].in_ms);
+    marks[i].in_ms = 0;
+}
+
+void gps_replay_get_stats(gps_replay_stats_t *out)
+{
+    static uint16_t sorted[GPS_REPLAY_SAMPLES];
+    gps_rx_stats_t rx;
+
+    if (!out) {
+        return;
+    }
+
+    *out = stats;
+
+    // Parsed messages lag the source by at most the one in flight
+    gnss_core_get_rx_stats(&rx);
+    uint32_t parsed = rx.sentences + rx.ubx_frames;
+    out->lost = (stats.messages > parsed) ? stats.messages - parsed : 0;
+    out->parse_kbps = rx.parse_us ? (uint32_t)((uint64_t)rx.bytes * 1000U / rx.parse_us) : 0;
+
+    // Percentiles over the last GPS_REPLAY_SAMPLES refreshes (insertion sort)
+    size_t n = MIN(stats.e2e_samples, GPS_REPLAY_SAMPLES);
+    for (size_t i = 0; i < n; i++) {
+        uint16_t v = e2e_samples[i];
+        size_t j = i;
+        while (j > 0 && sorted[j - 1] > v) {
+            sorted[j] = sorted[j - 1];
+            j--;
+        }
+        sorted[j] = v;
+    }
+    if (n > 0) {
+        out->e2e_p50_ms = sorted[(n - 1) * 50 / 100];
+        out->e2e_p90_ms = sorted[(n - 1) * 90 / 100];
+        out->e2e_p99_ms = sorted[(n - 1) * 99 / 100];
+    }
+}
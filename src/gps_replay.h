@@ -0,0 +1,75 @@
+/**
+ * @file gps_replay.h
+ * @brief GNSS replay backend: feeds recorded or synthesised NMEA/UBX into the GNSS core
+ *
+ * Replaces the receiver and its UART for soak and throughput runs without
+ * hardware (native_sim or any board): a thread paces bytes into
+ * gnss_core_rx_bytes() as a UART at GPS_REPLAY_BAUD would deliver them, with
+ * receiver time running GPS_REPLAY_SPEEDUP times faster than uptime.
+ *
+ * Source (build time, see CMakeLists.txt):
+ * - built-in script (default): 1 Hz RMC/GGA/GSA/ZDA epochs, or NAV-PVT frames
+ *   with GPS_REPLAY_UBX, covering a UTC date rollover, a fix loss and both
+ *   EU DST changes
+ * - recorded log (-DGPS_REPLAY_LOG=<file>): replayed byte for byte in a loop,
+ *   paced by the baud rate only
+ *
+ * Bytes can be corrupted (one bit flipped) or dropped at a configurable rate
+ * before they reach the core.
+ */
+
+#ifndef GPS_REPLAY_H
+#define GPS_REPLAY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gnss_core.h"
+
+#ifndef GPS_REPLAY_SPEEDUP
+#define GPS_REPLAY_SPEEDUP      100     ///< Receiver seconds per uptime second (1 = real time)
+#endif
+#ifndef GPS_REPLAY_BAUD
+#define GPS_REPLAY_BAUD         9600    ///< Emulated line rate, in receiver time
+#endif
+#ifndef GPS_REPLAY_CORRUPT_PPM
+#define GPS_REPLAY_CORRUPT_PPM  0       ///< Bytes with a flipped bit, per million
+#endif
+#ifndef GPS_REPLAY_DROP_PPM
+#define GPS_REPLAY_DROP_PPM     0       ///< Bytes lost on the line, per million
+#endif
+
+/**
+ * @brief Replay statistics (latencies in uptime milliseconds)
+ */
+typedef struct {
+    uint32_t bytes;                 ///< Bytes handed to the core
+    uint32_t messages;              ///< Sentences and frames in the source stream
+    uint32_t lost;                  ///< Source messages the core did not parse
+    uint32_t corrupted;             ///< Bytes with an injected bit error
+    uint32_t dropped;               ///< Bytes removed from the stream
+    uint32_t parse_kbps;            ///< Parser throughput: kB per second of parse time
+    uint32_t fixes;                 ///< Fix acquisitions measured
+    uint32_t fix_latency_ms;        ///< Last fix: first valid message in to fix published
+    uint32_t fix_latency_max_ms;
+    uint32_t e2e_samples;           ///< Display updates measured (last GPS_REPLAY_SAMPLES kept)
+    uint32_t e2e_p50_ms;            ///< Message in to display updated, percentiles
+    uint32_t e2e_p90_ms;
+    uint32_t e2e_p99_ms;
+    uint32_t e2e_max_ms;
+} gps_replay_stats_t;
+
+/**
+ * @brief Report a display refresh showing the fix of a UTC second (main thread)
+ *
+ * Closes the end-to-end latency measurement for the message carrying that second.
+ * @param utc_sod UTC time of the displayed snapshot (ignored when unknown)
+ */
+void gps_replay_displayed(int32_t utc_sod);
+
+/**
+ * @brief Get replay statistics (main thread)
+ * @param stats Output statistics
+ */
+void gps_replay_get_stats(gps_replay_stats_t *stats);
+
+#endif // GPS_REPLAY_H
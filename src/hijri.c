@@ -0,0 +1,150 @@
+/**
+ * @file hijri.c
+ * @brief Umm al-Qura Hijri calendar implementation
+ */
+
+#include "hijri.h"
+#include "hijri_table.h"
+
+// 1 Muharram 1 AH of the tabular calendar is JD 1948440, 2000-01-01 is JD 2451545
+#define HIJRI_TABULAR_EPOCH (1948440 - 2451545)
+
+static int32_t floor_div(int32_t a, int32_t b)
+{
+    int32_t q = a / b;
+    return (a % b != 0 && (a < 0) != (b < 0)) ? q - 1 : q;
+}
+
+// --- Tabular (arithmetic) calendar, 30-year cycle with leap years 2,5,7,10,13,16,18,21,24,26,29 ---
+
+static int32_t tabular_year_start(int year)
+{
+    return (int32_t)(year - 1) * 354 + floor_div(3 + 11 * year, 30) + HIJRI_TABULAR_EPOCH;
+}
+
+static bool tabular_is_leap(int year)
+{
+    int32_t r = (11 * (int32_t)year + 14) % 30;
+    return (r < 0 ? r + 30 : r) < 11;
+}
+
+static int tabular_month_offset(int month)
+{
+    // ceil(29.5 * (month - 1)): odd months have 30 days, even months 29
+    return (59 * (month - 1) + 1) / 2;
+}
+
+static hijri_date_t tabular_from_days(int32_t days)
+{
+    hijri_date_t date;
+    int year = floor_div(30 * (days - HIJRI_TABULAR_EPOCH) + 10646, 10631);
+    int32_t doy = days - tabular_year_start(year);
+
+    if (doy < 0) {
+        year--;
+        doy = days - tabular_year_start(year);
+    } else if (doy >= 354 + tabular_is_leap(year)) {
+        year++;
+        doy = days - tabular_year_start(year);
+    }
+
+    int month = (2 * doy) / 59 + 1;
+    if (month > 12) {
+        month = 12;     // Leap day, 30 Dhu al-Hijjah
+    }
+
+    date.year = year;
+    date.month = month;
+    date.day = doy - tabular_month_offset(month) + 1;
+    return date;
+}
+
+// --- Umm al-Qura table ---
+
+static inline uint16_t table_bits(int year)
+{
+    return hijri_month_lengths[year - HIJRI_TABLE_FIRST_YEAR];
+}
+
+static inline int32_t table_year_start(int year)
+{
+    return tabular_year_start(year) + hijri_year_start_delta[year - HIJRI_TABLE_FIRST_YEAR];
+}
+
+static inline int table_year_length(int year)
+{
+    return 12 * 29 + __builtin_popcount(table_bits(year));
+}
+
+static inline int table_month_offset(uint16_t bits, int month)
+{
+    return 29 * (month - 1) + __builtin_popcount(bits & ((1u << (month - 1)) - 1u));
+}
+
+static inline bool year_in_table(int year)
+{
+    return year >= HIJRI_TABLE_FIRST_YEAR && year <= HIJRI_TABLE_LAST_YEAR;
+}
+
+bool hijri_days_in_table(int32_t days)
+{
+    return days >= table_year_start(HIJRI_TABLE_FIRST_YEAR) &&
+           days < table_year_start(HIJRI_TABLE_LAST_YEAR) + table_year_length(HIJRI_TABLE_LAST_YEAR);
+}
+
+hijri_date_t hijri_from_days(int32_t days)
+{
+    if (!hijri_days_in_table(days)) {
+        return tabular_from_days(days);
+    }
+
+    // The table never strays more than a day or two from the tabular calendar,
+    // so the tabular estimate is at most one year and one month off
+    hijri_date_t date;
+    int year = tabular_from_days(days).year;
+    int32_t start = table_year_start(year);
+
+    if (days < start) {
+        year--;
+        start = table_year_start(year);
+    } else if (days >= start + table_year_length(year)) {
+        year++;
+        start = table_year_start(year);
+    }
+
+    uint16_t bits = table_bits(year);
+    int doy = days - start;
+    int month = (2 * doy) / 59 + 1;
+    if (month > 12) {
+        month = 12;
+    }
+    if (doy < table_month_offset(bits, month)) {
+        month--;
+    } else if (month < 12 && doy >= table_month_offset(bits, month + 1)) {
+        month++;
+    }
+
+    date.year = year;
+    date.month = month;
+    date.day = doy - table_month_offset(bits, month) + 1;
+    return date;
+}
+
+int32_t hijri_to_days(int year, int month, int day)
+{
+    if (year_in_table(year)) {
+        return table_year_start(year) + table_month_offset(table_bits(year), month) + day - 1;
+    }
+    return tabular_year_start(year) + tabular_month_offset(month) + day - 1;
+}
+
+int hijri_month_length(int year, int month)
+{
+    if (year_in_table(year)) {
+        return 29 + ((table_bits(year) >> (month - 1)) & 1);
+    }
+    if (month == 12) {
+        return tabular_is_leap(year) ? 30 : 29;
+    }
+    return (month & 1) ? 30 : 29;
+}
@@ -0,0 +1,45 @@
+/**
+ * @file hijri.h
+ * @brief Umm al-Qura Hijri calendar with an integer-only tabular fallback
+ *
+ * Dates are exchanged as day ordinals (days since 2000-01-01, see time_of_day.h).
+ * Between HIJRI_TABLE_FIRST_YEAR and HIJRI_TABLE_LAST_YEAR the conversion uses a
+ * compact month-length table (one bit per month plus one byte per year); outside
+ * that range the arithmetic (tabular) Islamic calendar is used. Both paths are
+ * constant time and use integer arithmetic only.
+ */
+
+#ifndef HIJRI_H
+#define HIJRI_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "prayerTime.h"
+
+/**
+ * @brief Convert a day ordinal to a Hijri date
+ * @param days Days since 2000-01-01
+ * @return Hijri date
+ */
+hijri_date_t hijri_from_days(int32_t days);
+
+/**
+ * @brief Convert a Hijri date to a day ordinal
+ * @param year Hijri year
+ * @param month Hijri month (1-12)
+ * @param day Hijri day (1-30)
+ * @return Days since 2000-01-01
+ */
+int32_t hijri_to_days(int year, int month, int day);
+
+/**
+ * @brief Number of days in a Hijri month (29 or 30)
+ */
+int hijri_month_length(int year, int month);
+
+/**
+ * @brief Check whether a day ordinal is covered by the Umm al-Qura table
+ */
+bool hijri_days_in_table(int32_t days);
+
+#endif // HIJRI_H
@@ -0,0 +1,72 @@
+/**
+ * @file hijri_table.h
+ * @brief Umm al-Qura month-length table (generated by tools/gen_hijri_table.py)
+ *
+ * Covers 1300-1600 AH; 1 Muharram 1300 = 1882-11-12.
+ * Do not edit by hand, regenerate instead.
+ */
+
+#ifndef HIJRI_TABLE_H
+#define HIJRI_TABLE_H
+
+#include <stdint.h>
+
+#define HIJRI_TABLE_FIRST_YEAR 1300
+#define HIJRI_TABLE_LAST_YEAR  1600
+
+// Bit (month - 1) set: the month has 30 days, otherwise 29
+static const uint16_t hijri_month_lengths[301] = {
+    0xaa5, 0x92d, 0x25d, 0x8bd, 0x1ba, 0x5b5, 0x5aa, 0xd55, 0xa9a, 0x92e, // 1300
+    0x16e, 0x2dd, 0xada, 0x6d4, 0x695, 0x52b, 0xa57, 0x52e, 0xaad, 0x5aa, // 1310
+    0xba5, 0xb4a, 0xa95, 0x54b, 0xa9b, 0x55a, 0xb55, 0xf4a, 0xea4, 0xe4a, // 1320
+    0xa95, 0x52d, 0x6ad, 0xb6a, 0x754, 0x749, 0xe95, 0xd2a, 0x95a, 0x2ba, // 1330
+    0x5b9, 0xbb4, 0xb64, 0xaaa, 0xa56, 0x4b6, 0x96d, 0x2ec, 0x5e9, 0xdb2, // 1340
+    0xd54, 0xcaa, 0x93a, 0x2b6, 0x575, 0xb6a, 0xb54, 0xb25, 0xa4b, 0x49b, // 1350
+    0xa57, 0x2b6, 0x6b5, 0x6a9, 0xe93, 0xd25, 0xa4d, 0x4ad, 0x95b, 0xb5a, // 1360
+    0xad2, 0xea5, 0xe4a, 0xc96, 0x536, 0xa75, 0x574, 0xb69, 0x752, 0x6a9, // 1370
+    0x555, 0xaad, 0x4ec, 0xaea, 0x5d4, 0xdc9, 0xd52, 0xaa5, 0x4d5, 0x975, // 1380
+    0x2f2, 0xae9, 0x6d2, 0x6a5, 0x52b, 0x257, 0x4b7, 0x976, 0x56a, 0xd65, // 1390
+    0xd4a, 0xc96, 0x92d, 0x25d, 0x4dd, 0xad6, 0x6aa, 0x695, 0x52b, 0xa57, // 1400
+    0x4ae, 0x96d, 0x2ea, 0xb65, 0x6c9, 0x693, 0x52b, 0x967, 0x2d6, 0x5d5, // 1410
+    0xbd2, 0xba4, 0xb49, 0xa95, 0x52d, 0x5ad, 0xb6a, 0x6e4, 0xdc9, 0xd92, // 1420
+    0xaa6, 0x956, 0x2ae, 0x56d, 0x36a, 0xb55, 0xaaa, 0x94d, 0x49d, 0x95d, // 1430
+    0x2ba, 0x5b5, 0x5aa, 0xd55, 0xa9a, 0x92e, 0x25e, 0x55d, 0xada, 0x6d4, // 1440
+    0x6a5, 0x54b, 0xa97, 0x54e, 0xaae, 0x5ac, 0xba9, 0xd92, 0xb25, 0x64b, // 1450
+    0xcab, 0x55a, 0xb55, 0x6d2, 0xea5, 0xe4a, 0xa95, 0x52d, 0xaad, 0x36c, // 1460
+    0x759, 0x6d2, 0x695, 0x52d, 0xa5b, 0x4ba, 0x9ba, 0x3b4, 0xb69, 0xb52, // 1470
+    0xaa6, 0x4b6, 0x96d, 0x2ec, 0x6d9, 0xdb2, 0xd54, 0xd2a, 0xa56, 0x4ae, // 1480
+    0x96d, 0xd6a, 0xb54, 0xb29, 0xa93, 0x52b, 0xa57, 0x536, 0xab5, 0x6aa, // 1490
+    0xe93, 0xd26, 0xa4d, 0x4ad, 0x95b, 0xcda, 0x6d4, 0xea9, 0xe52, 0xcaa, // 1500
+    0x956, 0xab5, 0x574, 0xb71, 0x764, 0x6c9, 0x555, 0x2ad, 0x56d, 0xaea, // 1510
+    0x5e4, 0xdc9, 0xd52, 0xaa5, 0x955, 0x275, 0x4ed, 0xae9, 0x6d2, 0xaa5, // 1520
+    0x94b, 0x457, 0x8b7, 0x276, 0x575, 0xd6a, 0xd4a, 0xc96, 0x92e, 0x25e, // 1530
+    0x4dd, 0xad6, 0x6d2, 0x5a5, 0x54b, 0xa97, 0x4ae, 0x96d, 0x36a, 0xb65, // 1540
+    0x752, 0x6a5, 0x54b, 0xaab, 0x55a, 0x6d5, 0xdd2, 0xba4, 0xb4a, 0xa95, // 1550
+    0x54d, 0x9ad, 0x36a, 0x5d5, 0x5ca, 0xd95, 0x52a, 0x957, 0x2ae, 0x96e, // 1560
+    0x36c, 0xb55, 0xaaa, 0xa55, 0x4ad, 0x15d, 0x2bd, 0x5ba, 0x5aa, 0xd55, // 1570
+    0xaaa, 0x94e, 0x2ae, 0x55d, 0xada, 0x6d4, 0xea9, 0xe8a, 0xd16, 0xa56, // 1580
+    0x2ae, 0x5b5, 0xda9, 0xd92, 0xd45, 0xa8b, 0x52b, 0x55b, 0xb5a, 0x6d4, // 1590
+    0xea9, // 1600
+};
+
+// First day of each year minus the tabular calendar's first day, in days
+static const int8_t hijri_year_start_delta[301] = {
+     0, -1, -1, -1, -1, -1,  0, -1,  0, -1, -1, -1, -1,  0,  0, -1, -1, -1, -1,  0, // 1300
+    -1,  0,  0, -1, -1,  0, -1,  0,  0,  0,  0, -1, -1,  0,  0,  0,  0,  0,  0, -1, // 1320
+    -1,  0,  0,  0,  0, -1, -1, -1, -1,  0,  0,  0,  0, -1, -1,  0,  0,  0, -1, -1, // 1340
+    -1, -1, -1,  0, -1,  0,  0, -1, -1, -1,  0,  0,  0,  0,  0, -1,  0, -1,  0,  0, // 1360
+    -1, -1,  0, -1,  0,  0,  0,  0, -1, -1,  0, -1,  0,  0, -1, -1, -1, -1,  0, -1, // 1380
+     0,  0, -1, -1, -1, -1,  0, -1, -1, -1, -1, -1,  0, -1,  0,  0, -1, -1, -1, -1, // 1400
+     0,  0,  0,  0, -1, -1,  0,  0,  0,  0,  0,  0, -1, -1,  0, -1,  0, -1, -1, -1, // 1420
+    -1, -1,  0, -1,  0,  0, -1, -1, -1,  0,  0, -1, -1,  0, -1,  0,  0,  0,  0, -1, // 1440
+    -1,  0, -1,  0,  0,  0,  0, -1, -1,  0, -1,  0,  0, -1, -1,  0, -1,  0, -1,  0, // 1460
+     0, -1, -1,  0, -1,  0,  1,  0,  0, -1, -1,  0,  0,  0,  0, -1, -1, -1, -1,  0, // 1480
+    -1,  0,  0, -1, -1,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0, -1, -1, -1, // 1500
+     0,  0,  0,  0,  0, -1, -1, -1,  0,  0, -1, -1, -1, -1, -1,  0,  0,  0, -1, -1, // 1520
+    -1, -1,  0,  0, -1, -1,  0, -1,  0, -1,  0,  0, -1, -1,  0, -1,  0,  0,  0,  0, // 1540
+    -1, -1,  0, -1,  0,  0,  0, -1, -1, -1,  0, -1,  0,  0, -1, -1, -1, -1,  0, -1, // 1560
+     0,  0, -1, -1,  0,  0,  0,  0,  0,  0, -1, -1,  0,  0,  0,  0, -1, -1, -1,  0, // 1580
+     0, // 1600
+};
+
+#endif // HIJRI_TABLE_H
@@ -1,11 +1,26 @@
 #include "ili9341_tft.h"
-#include "gps_neo7m.h"
+#include "gnss_core.h"
+#include "gnss_sats.h"
+#include "latency_trace.h"
 #include "font.h"
 #include "font_16x16.h"
 #include <zephyr/drivers/gpio.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
 
 static hmi_display_data_t hmi_data = {0};
 
+#ifdef GPS_SKY_PLOT
+#define WAITING_Y           8                               // Sky plot below
+#else
+#define WAITING_Y           ((DISPLAY_HEIGHT / 2) - 16)     // Centered (16 is half of 2x font height)
+#endif
+
 
 static void hmi_draw_character(const struct device *display_dev, char c, int x, int y, uint16_t color);
 static void hmi_draw_text(const struct device *display_dev, const char* text, int x, int y, uint16_t color);
@@ -310,6 +325,7 @@ void hmi_init(void)
     // Only set non-text defaults
     hmi_data.brightness_level = 50;
     hmi_data.next_prayer_index = -1;
+    hmi_data.current_sod = TOD_INVALID;
 
     // Initialize update flags
     hmi_data.needs_full_update = true;
@@ -380,11 +396,47 @@ static void hmi_draw_text_centered_scaled(const struct device *display_dev, cons
     hmi_draw_text_scaled(display_dev, text, start_x, y, color, scale);
 }
 
+// The prayer screen needs a valid GPS fix, or last-known prayer times restored at boot
+static bool hmi_screen_valid(const struct gps_data *gps)
+{
+    return gps->valid || hmi_data.last_known;
+}
+
+// Signal bars for the satellites in the fix, or tracked ones (orange) before a fix
+static void hmi_sat_icon_state(uint8_t *bars, uint16_t *color)
+{
+    uint8_t sats = hmi_data.sats_used ? hmi_data.sats_used : hmi_data.sats_tracked;
+
+    *bars = (sats >= 10) ? 4 : (sats >= 7) ? 3 : (sats >= 4) ? 2 : (sats >= 1) ? 1 : 0;
+    *color = hmi_data.sats_used ? COLOR_GREEN : COLOR_ORANGE;
+}
+
+static uint8_t last_sat_bars = 0xFF;
+static uint16_t last_sat_color;
+
+static void hmi_draw_sat_icon(const struct device *display_dev)
+{
+    uint8_t bars;
+    uint16_t color;
+
+    hmi_sat_icon_state(&bars, &color);
+    for (int i = 0; i < SAT_ICON_BARS; i++) {
+        int height = 4 + 3 * i;
+        hmi_draw_rectangle(display_dev, SAT_ICON_X + 4 * i, SAT_ICON_Y + 14 - height, 3, height,
+                           (i < bars) ? color : COLOR_GRAY);
+    }
+    last_sat_bars = bars;
+    last_sat_color = color;
+}
+
+static void hmi_draw_waiting(const struct device *display_dev);
+
 void hmi_draw_top_bar(const struct device *display_dev)
 {
     // Check GPS validity - don't draw if GPS not valid
-    extern struct gps_data current_gps;
-    if (!current_gps.valid) {
+    struct gps_data gps;
+    gps_snapshot(&gps);
+    if (!hmi_screen_valid(&gps)) {
         return;
     }
 
@@ -409,11 +461,11 @@ void hmi_draw_top_bar(const struct device *display_dev)
 void hmi_draw_prayer_times(const struct device *display_dev)
 {
     // Check if GPS is valid - if not, show "Waiting for GPS..." message
-    extern struct gps_data current_gps;
-    if (!current_gps.valid) {
+    struct gps_data gps;
+    gps_snapshot(&gps);
+    if (!hmi_screen_valid(&gps)) {
         // Draw "Waiting for GPS..." centered on screen with 2x font
-        int center_y = (DISPLAY_HEIGHT / 2) - 16; // Center vertically (16 is half of 2x font height)
-        hmi_draw_text_centered_scaled(display_dev, "Waiting for GPS...", DISPLAY_WIDTH / 2, center_y, COLOR_CYAN, 2);
+        hmi_draw_waiting(display_dev);
         return;
     }
 
@@ -432,8 +484,10 @@ void hmi_draw_prayer_times(const struct device *display_dev)
         hmi_draw_rectangle(display_dev, PRAYER_MARGIN - 10, current_y, DISPLAY_WIDTH - 2 * (PRAYER_MARGIN - 10), PRAYER_HEIGHT, bg_color);
 
         // Draw prayer name and time with 16x16 font
+        char time_str[6];
+        tod_format_hhmm(hmi_data.prayers[i].sod, time_str);
         hmi_draw_text_16x16(display_dev, hmi_data.prayers[i].name, PRAYER_NAME_X, current_y + 5, text_color);
-        hmi_draw_text_16x16(display_dev, hmi_data.prayers[i].time, PRAYER_TIME_X, current_y + 5, text_color);
+        hmi_draw_text_16x16(display_dev, time_str, PRAYER_TIME_X, current_y + 5, text_color);
 
         current_y += PRAYER_HEIGHT;
     }
@@ -446,14 +500,18 @@ void hmi_draw_prayer_times(const struct device *display_dev)
 void hmi_draw_bottom_bar(const struct device *display_dev)
 {
     // Check GPS validity - don't draw if GPS not valid
-    extern struct gps_data current_gps;
-    if (!current_gps.valid) {
+    struct gps_data gps;
+    gps_snapshot(&gps);
+    if (!hmi_screen_valid(&gps)) {
         printk("hmi_draw_bottom_bar: GPS not valid - skipping\n");
         return;
     }
 
+    char time_str[9];
+    tod_format_hhmmss(hmi_data.current_sod, time_str);
+
     printk("hmi_draw_bottom_bar: Drawing with time='%s', temp='%s'\n",
-           hmi_data.current_time, hmi_data.weather_temp);
+           time_str, hmi_data.weather_temp);
 
     int bottom_y = DISPLAY_HEIGHT - BOTTOM_BAR_HEIGHT;
     hmi_draw_rectangle(display_dev, 0, bottom_y, DISPLAY_WIDTH, BOTTOM_BAR_HEIGHT, COLOR_DARK_GRAY);
@@ -464,37 +522,40 @@ void hmi_draw_bottom_bar(const struct device *display_dev)
     }
 
     // Use fixed position for consistent time display
-    printk("  Drawing time: '%s'\n", hmi_data.current_time);
-    hmi_draw_text_16x16(display_dev, hmi_data.current_time, CLOCK_X, CLOCK_Y, COLOR_WHITE);
+    printk("  Drawing time: '%s'\n", time_str);
+    hmi_draw_text_16x16(display_dev, time_str, CLOCK_X, CLOCK_Y, COLOR_WHITE);
 
     hmi_draw_text(display_dev, "SET", SETTINGS_X, SETTINGS_Y, COLOR_LIGHT_GRAY);
 
     char brightness_str[8];
     snprintf(brightness_str, sizeof(brightness_str), "%d%%", hmi_data.brightness_level);
     hmi_draw_text(display_dev, brightness_str, BRIGHTNESS_X, BRIGHTNESS_Y, COLOR_ORANGE);
+
+    hmi_draw_sat_icon(display_dev);
 }
 
-static char last_time_displayed[12] = {0};
+static int32_t last_time_displayed = TOD_INVALID;
 static char last_temp_displayed[8] = {0};
 
 void hmi_update_display(const struct device *display_dev)
 {
     // Check if GPS is valid
-    extern struct gps_data current_gps;
+    struct gps_data gps;
+    gps_snapshot(&gps);
 
     // First time initialization - draw everything once
     if (!hmi_data.screen_initialized) {
-        printk("hmi_update_display: First init, GPS valid = %d\n", current_gps.valid);
-        printk("  HMI current_time: '%s'\n", hmi_data.current_time);
+        printk("hmi_update_display: First init, GPS valid = %d\n", gps.valid);
+        printk("  HMI current_sod: %d\n", hmi_data.current_sod);
         printk("  HMI weather_temp: '%s'\n", hmi_data.weather_temp);
         hmi_clear_screen(display_dev);
 
         // If GPS not valid, only show waiting message
-        if (!current_gps.valid) {
+        if (!hmi_screen_valid(&gps)) {
             printk("Drawing waiting message in hmi_update_display\n");
-            int center_y = (DISPLAY_HEIGHT / 2) - 16;
-            hmi_draw_text_centered_scaled(display_dev, "Waiting for GPS...", DISPLAY_WIDTH / 2, center_y, COLOR_CYAN, 2);
+            hmi_draw_waiting(display_dev);
             hmi_data.screen_initialized = true;
+            latency_trace_mark(LATENCY_DISPLAYED);
             printk("Waiting screen displayed - DONE\n");
             return;
         }
@@ -504,19 +565,27 @@ void hmi_update_display(const struct device *display_dev)
         hmi_draw_top_bar(display_dev);
         hmi_draw_prayer_times(display_dev);
         hmi_draw_bottom_bar(display_dev);
-        strcpy(last_time_displayed, hmi_data.current_time);
+        last_time_displayed = hmi_data.current_sod;
         strcpy(last_temp_displayed, hmi_data.weather_temp);
         hmi_data.screen_initialized = true;
+        latency_trace_mark(LATENCY_DISPLAYED);
         return;
     }
 
     // If GPS not valid, only show waiting message (don't update anything else)
-    if (!current_gps.valid) {
+    if (!hmi_screen_valid(&gps)) {
+#ifdef GPS_SKY_PLOT
+        hmi_draw_sky_plot(display_dev);
+#endif
         return;
     }
 
+    bool drawn = false;
+
     // Only update if time changed (ultra-fast selective update)
-    if (strcmp(last_time_displayed, hmi_data.current_time) != 0) {
+    if (last_time_displayed != hmi_data.current_sod) {
+        char time_str[9];
+        tod_format_hhmmss(hmi_data.current_sod, time_str);
 
         // Clear exact time display area for consistent positioning
         hmi_draw_rectangle(display_dev, CLOCK_X - 2, CLOCK_Y - 1, TIME_DISPLAY_WIDTH + 4, TIME_DISPLAY_HEIGHT + 2, COLOR_BLACK);
@@ -525,10 +594,11 @@ void hmi_update_display(const struct device *display_dev)
         k_usleep(500);
 
         // Draw new time at exact position
-        hmi_draw_text_16x16(display_dev, hmi_data.current_time, CLOCK_X, CLOCK_Y, COLOR_WHITE);
+        hmi_draw_text_16x16(display_dev, time_str, CLOCK_X, CLOCK_Y, COLOR_WHITE);
 
         // Update last displayed time
-        strcpy(last_time_displayed, hmi_data.current_time);
+        last_time_displayed = hmi_data.current_sod;
+        drawn = true;
     }
 
     // Check if temperature changed and update it
@@ -545,6 +615,21 @@ void hmi_update_display(const struct device *display_dev)
 
         // Update last displayed temperature
         strcpy(last_temp_displayed, hmi_data.weather_temp);
+        drawn = true;
+    }
+
+    // Satellite bars only when their count or colour changes
+    uint8_t sat_bars;
+    uint16_t sat_color;
+    hmi_sat_icon_state(&sat_bars, &sat_color);
+    if (sat_bars != last_sat_bars || sat_color != last_sat_color) {
+        hmi_draw_sat_icon(display_dev);
+        drawn = true;
+    }
+
+    // Fix-to-pixel trace: the change is on the panel
+    if (drawn) {
+        latency_trace_mark(LATENCY_DISPLAYED);
     }
 
     // Reset flags
@@ -555,11 +640,12 @@ void hmi_update_display(const struct device *display_dev)
 void hmi_force_full_update(const struct device *display_dev)
 {
     // Check if GPS is valid
-    extern struct gps_data current_gps;
+    struct gps_data gps;
+    gps_snapshot(&gps);
 
-    printk("hmi_force_full_update: GPS valid = %d\n", current_gps.valid);
+    printk("hmi_force_full_update: GPS valid = %d\n", gps.valid);
     printk("DEBUG: HMI data before update:\n");
-    printk("  current_time: '%s'\n", hmi_data.current_time);
+    printk("  current_sod: %d\n", hmi_data.current_sod);
     printk("  weather_temp: '%s'\n", hmi_data.weather_temp);
     printk("  city: '%s'\n", hmi_data.city);
     printk("  screen_initialized: %d\n", hmi_data.screen_initialized);
@@ -568,15 +654,15 @@ void hmi_force_full_update(const struct device *display_dev)
     hmi_clear_screen(display_dev);
 
     // If GPS not valid, only show waiting message
-    if (!current_gps.valid) {
+    if (!hmi_screen_valid(&gps)) {
         printk("GPS not valid - showing waiting message only\n");
-        int center_y = (DISPLAY_HEIGHT / 2) - 16;
-        hmi_draw_text_centered_scaled(display_dev, "Waiting for GPS...", DISPLAY_WIDTH / 2, center_y, COLOR_CYAN, 2);
+        hmi_draw_waiting(display_dev);
         hmi_data.screen_initialized = true;
 
         // Clear the tracking variables to prevent any updates
-        last_time_displayed[0] = '\0';
+        last_time_displayed = TOD_INVALID;
         last_temp_displayed[0] = '\0';
+        latency_trace_mark(LATENCY_DISPLAYED);
         printk("GPS waiting screen displayed. No placeholders should be visible.\n");
         return;
     }
@@ -591,12 +677,14 @@ void hmi_force_full_update(const struct device *display_dev)
     // Clear the time area specifically and redraw it cleanly
     hmi_draw_rectangle(display_dev, CLOCK_X - 2, CLOCK_Y - 1, TIME_DISPLAY_WIDTH + 4, TIME_DISPLAY_HEIGHT + 2, COLOR_BLACK);
     k_usleep(500);  // Ensure clear completes
-    hmi_draw_text_16x16(display_dev, hmi_data.current_time, CLOCK_X, CLOCK_Y, COLOR_WHITE);
+    char time_str[9];
+    tod_format_hhmmss(hmi_data.current_sod, time_str);
+    hmi_draw_text_16x16(display_dev, time_str, CLOCK_X, CLOCK_Y, COLOR_WHITE);
 
     // Reset time tracking to current time
-    strcpy(last_time_displayed, hmi_data.current_time);
+    last_time_displayed = hmi_data.current_sod;
     hmi_data.screen_initialized = true;
-
+    latency_trace_mark(LATENCY_DISPLAYED);
 }
 
 void hmi_set_city(const char* city)
@@ -626,6 +714,7 @@ void hmi_set_dates(const char* greg_date, const char* hijri_date, const char* da
 void hmi_set_prayer_times(const prayer_time_t* prayer_times, int next_prayer)
 {
     if (prayer_times) {
+        latency_trace_mark(LATENCY_HMI_DIRTY);
         for (int i = 0; i < PRAYER_COUNT; i++) {
             hmi_data.prayers[i] = prayer_times[i];
             hmi_data.prayers[i].is_next = (i == next_prayer);
@@ -651,12 +740,12 @@ void hmi_set_weather(const char* temperature)
     }
 }
 
-void hmi_set_current_time(const char* time)
+void hmi_set_current_time(int32_t sod)
 {
-    if (time) {
-        strncpy(hmi_data.current_time, time, sizeof(hmi_data.current_time) - 1);
-        hmi_data.current_time[sizeof(hmi_data.current_time) - 1] = '\0';
+    if (sod != hmi_data.current_sod) {
+        latency_trace_mark(LATENCY_HMI_DIRTY);
     }
+    hmi_data.current_sod = sod;
 }
 
 void hmi_set_brightness(uint8_t level)
@@ -666,6 +755,178 @@ void hmi_set_brightness(uint8_t level)
     }
 }
 
+void hmi_set_last_known(bool shown)
+{
+    hmi_data.last_known = shown;
+}
+
+void hmi_set_satellites(uint8_t used, uint8_t tracked)
+{
+    if (used != hmi_data.sats_used || tracked != hmi_data.sats_tracked) {
+        latency_trace_mark(LATENCY_HMI_DIRTY);
+    }
+    hmi_data.sats_used = used;
+    hmi_data.sats_tracked = tracked;
+}
+
+#ifdef GPS_SKY_PLOT
+/*
+ * Sky plot: satellites by azimuth (north up) and elevation (horizon on the outer
+ * ring, 45 degrees on the inner one), coloured by signal and larger when used in
+ * the fix. Only satellites that moved or changed colour are redrawn; an erased
+ * dot restores the grid pixels it covered.
+ */
+#define SKY_CX              (DISPLAY_WIDTH / 2)
+#define SKY_CY              146
+#define SKY_R               88
+#define SKY_RING_DOTS       48
+#define SKY_DOT_USED        7
+#define SKY_DOT             5
+
+typedef struct {
+    uint8_t id;
+    uint8_t system;
+    uint8_t size;
+    int16_t x;                  ///< Top left corner
+    int16_t y;
+    uint16_t color;
+} sky_dot_t;
+
+static sky_dot_t sky_drawn[GNSS_SATS_MAX];
+static uint8_t sky_drawn_count;
+static int16_t sky_ring[2][SKY_RING_DOTS][2];
+static bool sky_grid_drawn;
+static uint32_t sky_generation;
+static gnss_sats_t sky_sats;
+
+static uint16_t sky_snr_color(uint8_t snr)
+{
+    return (snr == 0) ? COLOR_GRAY : (snr < 25) ? COLOR_RED : (snr < 35) ? COLOR_YELLOW : COLOR_GREEN;
+}
+
+// Grid pixels inside a box (the whole grid for the full screen)
+static void sky_draw_grid(const struct device *display_dev, int x0, int y0, int x1, int y1)
+{
+    // Cross through the zenith
+    if (SKY_CY >= y0 && SKY_CY < y1) {
+        int left = MAX(x0, SKY_CX - SKY_R), right = MIN(x1, SKY_CX + SKY_R + 1);
+        if (right > left) {
+            hmi_draw_rectangle(display_dev, left, SKY_CY, right - left, 1, COLOR_DARK_GRAY);
+        }
+    }
+    if (SKY_CX >= x0 && SKY_CX < x1) {
+        int top = MAX(y0, SKY_CY - SKY_R), bottom = MIN(y1, SKY_CY + SKY_R + 1);
+        if (bottom > top) {
+            hmi_draw_rectangle(display_dev, SKY_CX, top, 1, bottom - top, COLOR_DARK_GRAY);
+        }
+    }
+
+    // Dotted horizon and 45 degree rings
+    for (int r = 0; r < 2; r++) {
+        for (int i = 0; i < SKY_RING_DOTS; i++) {
+            int x = sky_ring[r][i][0], y = sky_ring[r][i][1];
+            if (x >= x0 && x < x1 && y >= y0 && y < y1) {
+                hmi_draw_rectangle(display_dev, x, y, 1, 1, COLOR_LIGHT_GRAY);
+            }
+        }
+    }
+}
+
+static bool sky_dot_equal(const sky_dot_t *a, const sky_dot_t *b)
+{
+    return a->x == b->x && a->y == b->y && a->size == b->size && a->color == b->color;
+}
+
+static void sky_dot_for(const gnss_sat_t *sat, sky_dot_t *dot)
+{
+    double radius = SKY_R * (90 - sat->elevation) / 90.0;
+    double azimuth = sat->azimuth * M_PI / 180.0;
+
+    dot->id = sat->id;
+    dot->system = sat->system;
+    dot->size = sat->used ? SKY_DOT_USED : SKY_DOT;
+    dot->x = (int16_t)lround(SKY_CX + radius * sin(azimuth)) - dot->size / 2;
+    dot->y = (int16_t)lround(SKY_CY - radius * cos(azimuth)) - dot->size / 2;
+    dot->color = sky_snr_color(sat->snr);
+}
+
+void hmi_draw_sky_plot(const struct device *display_dev)
+{
+    uint32_t generation = gnss_sats_generation();
+
+    if (!sky_grid_drawn) {
+        for (int i = 0; i < SKY_RING_DOTS; i++) {
+            double a = 2.0 * M_PI * i / SKY_RING_DOTS;
+            for (int r = 0; r < 2; r++) {
+                int radius = (r == 0) ? SKY_R : SKY_R / 2;
+                sky_ring[r][i][0] = (int16_t)lround(SKY_CX + radius * sin(a));
+                sky_ring[r][i][1] = (int16_t)lround(SKY_CY - radius * cos(a));
+            }
+        }
+        sky_draw_grid(display_dev, 0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+        hmi_draw_text(display_dev, "N", SKY_CX - 4, SKY_CY - SKY_R - 18, COLOR_LIGHT_GRAY);
+        sky_drawn_count = 0;
+        sky_grid_drawn = true;
+    } else if (generation == sky_generation) {
+        return;
+    }
+    sky_generation = gnss_sats_snapshot(&sky_sats);
+
+    // Satellites to show: position known
+    sky_dot_t wanted[GNSS_SATS_MAX];
+    int wanted_count = 0;
+    for (int i = 0; i < sky_sats.count; i++) {
+        if (sky_sats.sat[i].elevation >= 0) {
+            sky_dot_for(&sky_sats.sat[i], &wanted[wanted_count++]);
+        }
+    }
+
+    // Erase dots that set, moved or changed colour
+    for (int i = 0; i < sky_drawn_count; ) {
+        const sky_dot_t *old = &sky_drawn[i];
+        bool keep = false;
+
+        for (int j = 0; j < wanted_count; j++) {
+            if (wanted[j].id == old->id && wanted[j].system == old->system) {
+                keep = sky_dot_equal(&wanted[j], old);
+                break;
+            }
+        }
+        if (keep) {
+            i++;
+            continue;
+        }
+        hmi_draw_rectangle(display_dev, old->x, old->y, old->size, old->size, COLOR_BLACK);
+        sky_draw_grid(display_dev, old->x, old->y, old->x + old->size, old->y + old->size);
+        sky_drawn[i] = sky_drawn[--sky_drawn_count];
+    }
+
+    // Draw the ones not on screen
+    for (int j = 0; j < wanted_count; j++) {
+        bool shown = false;
+
+        for (int i = 0; i < sky_drawn_count && !shown; i++) {
+            shown = sky_drawn[i].id == wanted[j].id && sky_drawn[i].system == wanted[j].system;
+        }
+        if (!shown) {
+            hmi_draw_rectangle(display_dev, wanted[j].x, wanted[j].y, wanted[j].size, wanted[j].size,
+                               wanted[j].color);
+            sky_drawn[sky_drawn_count++] = wanted[j];
+        }
+    }
+}
+#endif // GPS_SKY_PLOT
+
+static void hmi_draw_waiting(const struct device *display_dev)
+{
+    hmi_draw_text_centered_scaled(display_dev, "Waiting for GPS...", DISPLAY_WIDTH / 2, WAITING_Y, COLOR_CYAN, 2);
+#ifdef GPS_SKY_PLOT
+    // Called on a cleared screen: draw the whole plot again
+    sky_grid_drawn = false;
+    hmi_draw_sky_plot(display_dev);
+#endif
+}
+
 // ========================================================================
 // Compatible API with ili9341_parallel.h (for unified main.c)
 // ========================================================================
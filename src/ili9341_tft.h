@@ -6,6 +6,7 @@
 #include <zephyr/drivers/display.h>
 #include <stdbool.h>
 #include "prayerTime.h"
+#include "time_of_day.h"
 
 // Display specifications for 320x240 RGB565
 #define DISPLAY_WIDTH       320
@@ -55,6 +56,9 @@
 #define CLOCK_Y             (DISPLAY_HEIGHT - BOTTOM_BAR_HEIGHT + 10)
 #define TIME_DISPLAY_WIDTH  140   // 8 chars * 16 pixels per char (16x16 font) + padding
 #define TIME_DISPLAY_HEIGHT 16    // Font height
+#define SAT_ICON_X          (CLOCK_X + TIME_DISPLAY_WIDTH + 6)   // Satellite bars between clock and "SET"
+#define SAT_ICON_Y          (DISPLAY_HEIGHT - BOTTOM_BAR_HEIGHT + 10)
+#define SAT_ICON_BARS       4
 #define SETTINGS_X          (DISPLAY_WIDTH - 60)
 #define SETTINGS_Y          (DISPLAY_HEIGHT - BOTTOM_BAR_HEIGHT + 10)
 #define BRIGHTNESS_X        (DISPLAY_WIDTH - 30)
@@ -74,7 +78,7 @@ typedef enum {
 // Prayer time structure
 typedef struct {
     char name[10];      // Prayer name
-    char time[8];       // HH:MM format
+    int32_t sod;        // Seconds since local midnight, formatted HH:MM at render time
     bool is_next;       // Is this the next prayer?
 } prayer_time_t;
 
@@ -93,13 +97,16 @@ typedef struct {
 
     // Bottom bar info
     char weather_temp[8];
-    char current_time[12];  // "HH:MM:SS" format + extra space
+    int32_t current_sod;    // Seconds since local midnight, TOD_INVALID if unknown
     uint8_t brightness_level;
+    uint8_t sats_used;      // Satellites in the fix
+    uint8_t sats_tracked;   // Satellites with a signal
 
     // Status flags
     bool gps_valid;
     bool prayer_times_valid;
     bool weather_valid;
+    bool last_known;        // Prayer screen from the last-known state until GPS is valid
 
     // Update flags to prevent unnecessary redraws
     bool needs_full_update;
@@ -116,14 +123,19 @@ void hmi_set_dates(const char* greg_date, const char* hijri_date, const char* da
 void hmi_set_prayer_times(const prayer_time_t* prayer_times, int next_prayer);
 void hmi_set_countdown(const char* countdown);
 void hmi_set_weather(const char* temperature);
-void hmi_set_current_time(const char* time);
+void hmi_set_current_time(int32_t sod);
 void hmi_set_brightness(uint8_t level);
+void hmi_set_last_known(bool shown);
+void hmi_set_satellites(uint8_t used, uint8_t tracked);
 
 
 // Display section functions
 void hmi_draw_top_bar(const struct device *display_dev);
 void hmi_draw_prayer_times(const struct device *display_dev);
 void hmi_draw_bottom_bar(const struct device *display_dev);
+#ifdef GPS_SKY_PLOT
+void hmi_draw_sky_plot(const struct device *display_dev);
+#endif
 void hmi_clear_screen(const struct device *display_dev);
 
 // Utility functions
@@ -0,0 +1,239 @@
+/**
+ * @file last_known.c
+ * @brief Last-known state persistence (settings subsystem, NVS backend)
+ */
+
+#include "last_known.h"
+#include "utc_clock.h"
+#include <zephyr/kernel.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+#include <errno.h>
+#include <stddef.h>
+
+#define LAST_KNOWN_SUBTREE      "lastknown"
+#define LAST_KNOWN_KEY          LAST_KNOWN_SUBTREE "/state"
+#define LAST_KNOWN_VERSION      1       ///< Bump when last_known_t changes meaning
+#define LAST_KNOWN_CLOCK_MAGIC  0x4b4c434b  // "KCLK"
+
+// The NVS settings backend mounts the chosen settings partition, else storage_partition;
+// without either settings_subsys_init() fails on every boot
+#if defined(CONFIG_SETTINGS_NVS) && !defined(CONFIG_PARTITION_MANAGER_ENABLED)
+BUILD_ASSERT(DT_HAS_CHOSEN(zephyr_settings_partition) || DT_HAS_FIXED_PARTITION_LABEL(storage_partition),
+             "last_known.c: the board has no storage_partition for the settings (add one in its overlay)");
+#endif
+
+/**
+ * @brief Flash record
+ */
+typedef struct {
+    uint32_t version;
+    last_known_t state;
+} last_known_record_t;
+
+/**
+ * @brief UTC kept across warm resets
+ */
+typedef struct {
+    int64_t utc_ms;
+    uint32_t magic;
+    uint32_t crc;           ///< CRC-32 of the fields above
+} last_known_clock_t;
+
+static __noinit last_known_clock_t retained_clock;
+
+static struct k_spinlock lock;
+static last_known_t stored;                 ///< State in flash
+static bool stored_valid;
+static last_known_t pending;                ///< Latest update, written by save_work
+static bool pending_valid;
+static int64_t last_write_ms;               ///< Uptime of the last write
+static int64_t boot_utc_ms = -1;            ///< Retained UTC at boot, -1 if none
+
+static last_known_stats_t lk_stats;
+
+static void save_handler(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(save_work, save_handler);
+
+static bool state_equal(const last_known_t *a, const last_known_t *b)
+{
+    return a->latitude == b->latitude && a->longitude == b->longitude &&
+           a->date_ordinal == b->date_ordinal && a->city_index == b->city_index &&
+           a->zone == b->zone && a->method == b->method &&
+           a->asr_method == b->asr_method && a->high_lat_rule == b->high_lat_rule;
+}
+
+static uint32_t clock_crc(void)
+{
+    return crc32_ieee((const uint8_t *)&retained_clock, offsetof(last_known_clock_t, crc));
+}
+
+static int last_known_set(const char *name, size_t len, settings_read_cb read_cb, void *cb_arg)
+{
+    const char *next;
+    last_known_record_t record;
+
+    if (!settings_name_steq(name, "state", &next) || next) {
+        return -ENOENT;
+    }
+    // A record from another layout is ignored, the next update replaces it
+    if (len != sizeof(record)) {
+        return 0;
+    }
+    if (read_cb(cb_arg, &record, sizeof(record)) != sizeof(record)) {
+        lk_stats.errors++;
+        return -EIO;
+    }
+    if (record.version == LAST_KNOWN_VERSION) {
+        stored = record.state;
+        stored_valid = true;
+    }
+    return 0;
+}
+
+SETTINGS_STATIC_HANDLER_DEFINE(last_known, LAST_KNOWN_SUBTREE, NULL, last_known_set, NULL, NULL);
+
+int last_known_init(void)
+{
+    // Retained UTC from before the reset; RAM content is random after a power cycle
+    if (retained_clock.magic == LAST_KNOWN_CLOCK_MAGIC && retained_clock.crc == clock_crc() &&
+        retained_clock.utc_ms >= 0) {
+        boot_utc_ms = retained_clock.utc_ms;
+        lk_stats.clock_retained = true;
+    }
+
+    int ret = settings_subsys_init();
+    if (ret == 0) {
+        ret = settings_load_subtree(LAST_KNOWN_SUBTREE);
+    }
+    if (ret != 0) {
+        printk("Last-known: settings unavailable: %d, state kept in RAM only\n", ret);
+        lk_stats.errors++;
+        return ret;
+    }
+
+    lk_stats.storage = true;
+    lk_stats.loaded = stored_valid;
+    return stored_valid ? 0 : -ENOENT;
+}
+
+bool last_known_get(last_known_t *out)
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    bool valid = pending_valid || stored_valid;
+
+    if (valid) {
+        *out = pending_valid ? pending : stored;
+    }
+    k_spin_unlock(&lock, key);
+    return valid;
+}
+
+void last_known_update(const last_known_t *state)
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    lk_stats.updates++;
+    if (!pending_valid && stored_valid && state_equal(state, &stored)) {
+        lk_stats.unchanged++;
+        k_spin_unlock(&lock, key);
+        return;
+    }
+    if (pending_valid && lk_stats.storage) {
+        lk_stats.coalesced++;
+    }
+    pending = *state;
+    pending_valid = true;
+
+    // No storage: last_known_get() still returns the update, nothing is written
+    if (!lk_stats.storage) {
+        k_spin_unlock(&lock, key);
+        return;
+    }
+
+    // Not before the delay, nor before the minimum interval since the last write
+    int64_t delay_ms = LAST_KNOWN_SAVE_DELAY_S * 1000LL;
+    if (lk_stats.writes > 0) {
+        delay_ms = MAX(delay_ms, last_write_ms + LAST_KNOWN_MIN_INTERVAL_S * 1000LL - k_uptime_get());
+    }
+    k_spin_unlock(&lock, key);
+
+    // No-op while a write is already scheduled: this update joins it
+    k_work_schedule(&save_work, K_MSEC(delay_ms));
+}
+
+static void save_handler(struct k_work *work)
+{
+    last_known_record_t record = { .version = LAST_KNOWN_VERSION };
+
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    if (!pending_valid) {
+        k_spin_unlock(&lock, key);
+        return;
+    }
+    record.state = pending;
+    // Changed back before the write was due
+    if (stored_valid && state_equal(&record.state, &stored)) {
+        pending_valid = false;
+        lk_stats.unchanged++;
+        k_spin_unlock(&lock, key);
+        return;
+    }
+    k_spin_unlock(&lock, key);
+
+    // Flash write (and possibly a page erase) outside the lock
+    int ret = settings_save_one(LAST_KNOWN_KEY, &record, sizeof(record));
+
+    key = k_spin_lock(&lock);
+    if (ret == 0) {
+        stored = record.state;
+        stored_valid = true;
+        lk_stats.writes++;
+        last_write_ms = k_uptime_get();
+        // Updated again during the write: the next run writes that
+        pending_valid = !state_equal(&pending, &stored);
+    } else {
+        lk_stats.errors++;
+        pending_valid = false;
+    }
+    k_spin_unlock(&lock, key);
+
+    if (ret != 0) {
+        printk("Last-known: write failed: %d\n", ret);
+    } else if (pending_valid) {
+        k_work_schedule(&save_work, K_SECONDS(LAST_KNOWN_MIN_INTERVAL_S));
+    }
+}
+
+bool last_known_utc_ms(int64_t *utc_ms)
+{
+    if (boot_utc_ms < 0) {
+        return false;
+    }
+    *utc_ms = boot_utc_ms + k_uptime_get();
+    return true;
+}
+
+void last_known_tick(void)
+{
+    int64_t utc_ms = utc_clock_now_ms();
+
+    if (utc_ms < 0 && !last_known_utc_ms(&utc_ms)) {
+        return;
+    }
+    retained_clock.magic = LAST_KNOWN_CLOCK_MAGIC;
+    retained_clock.utc_ms = utc_ms;
+    retained_clock.crc = clock_crc();
+}
+
+void last_known_get_stats(last_known_stats_t *stats)
+{
+    if (stats) {
+        k_spinlock_key_t key = k_spin_lock(&lock);
+        *stats = lk_stats;
+        k_spin_unlock(&lock, key);
+    }
+}
@@ -0,0 +1,106 @@
+/**
+ * @file last_known.h
+ * @brief Last-known position, timezone and calculation settings kept in flash
+ *
+ * The first GPS fix can take minutes indoors. The state the prayer times were
+ * last computed from is saved through the settings subsystem (NVS backend), so
+ * the next boot can show today's prayer times before the receiver has a fix and
+ * let GPS correct them later.
+ *
+ * Writes are coalesced to spare the flash: an update is written
+ * LAST_KNOWN_SAVE_DELAY_S later, never closer than LAST_KNOWN_MIN_INTERVAL_S to
+ * the previous write, and updates arriving in between join the pending write.
+ * An update equal to the stored state writes nothing. In practice this is one
+ * write per day (the date) plus one per relocation.
+ *
+ * UTC is also kept in RAM that survives a warm reset (watchdog, sys_reboot,
+ * debugger), so after one the date and the clock are known as well. After a
+ * power cycle only the date of the last fix is.
+ */
+
+#ifndef LAST_KNOWN_H
+#define LAST_KNOWN_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define LAST_KNOWN_SAVE_DELAY_S     60      ///< Update to flash write (collects a boot's burst of updates)
+#define LAST_KNOWN_MIN_INTERVAL_S   600     ///< Minimum time between two flash writes
+
+/**
+ * @brief State the prayer times were computed from
+ */
+typedef struct {
+    double latitude;                ///< Smoothed position, decimal degrees
+    double longitude;
+    int32_t date_ordinal;           ///< UTC date of the fix, days since 2000-01-01
+    int16_t city_index;             ///< Nearest city (get_city_by_index()), -1 if none
+    uint8_t zone;                   ///< tz_zone_id_t, TZ_ZONE_FIXED for a longitude estimate
+    uint8_t method;                 ///< prayer_method_id_t
+    uint8_t asr_method;             ///< prayer_asr_method_t
+    uint8_t high_lat_rule;          ///< prayer_high_lat_rule_t
+} last_known_t;
+
+/**
+ * @brief Persistence statistics
+ */
+typedef struct {
+    bool storage;                   ///< Settings storage mounted: updates are written to flash
+    bool loaded;                    ///< A state was found in flash at boot
+    bool clock_retained;            ///< UTC survived the last reset
+    uint32_t updates;               ///< last_known_update() calls
+    uint32_t unchanged;             ///< Updates equal to the stored state (nothing written)
+    uint32_t coalesced;             ///< Updates that joined an already pending write
+    uint32_t writes;                ///< Flash writes
+    uint32_t errors;                ///< Failed loads or writes
+} last_known_stats_t;
+
+/**
+ * @brief Initialize the settings subsystem and load the stored state
+ *
+ * Blocks while the NVS area is mounted (a few milliseconds). Call once at boot,
+ * before anything else reads the state.
+ * @return 0 if a state was loaded, -ENOENT if none is stored, negative errno on failure
+ */
+int last_known_init(void);
+
+/**
+ * @brief Get the state loaded at boot, or the latest update since
+ * @param out Output state
+ * @return false if there is none
+ */
+bool last_known_get(last_known_t *out);
+
+/**
+ * @brief Record the state new prayer times were computed from (coalesced write)
+ *
+ * Without settings storage (last_known_init() failed) the state is only kept in
+ * RAM for last_known_get().
+ * @param state State; compared field by field with the stored one
+ */
+void last_known_update(const last_known_t *state);
+
+/**
+ * @brief UTC carried over a warm reset
+ *
+ * The value is the last one kept by last_known_tick() before the reset plus the
+ * time since boot, so it is late by the reset itself (milliseconds).
+ * @param utc_ms Output milliseconds since 2000-01-01 00:00 UTC
+ * @return false after a power cycle, or when no UTC was known before the reset
+ */
+bool last_known_utc_ms(int64_t *utc_ms);
+
+/**
+ * @brief Keep the current UTC in retained RAM (call once per second)
+ *
+ * Uses the disciplined clock, or the retained time while GPS has not set it.
+ */
+void last_known_tick(void);
+
+/**
+ * @brief Get persistence statistics
+ * @param stats Output statistics
+ */
+void last_known_get_stats(last_known_stats_t *stats);
+
+#endif // LAST_KNOWN_H
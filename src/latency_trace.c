@@ -0,0 +1,291 @@
+/**
+ * @file latency_trace.c
+ * @brief Fix-to-pixel latency trace ring and histograms
+ */
+
+#include "latency_trace.h"
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/timing/timing.h>
+#include <stdio.h>
+
+#ifdef CONFIG_SHELL
+#include <zephyr/shell/shell.h>
+#endif
+
+/*
+ * Histogram buckets: values below 4 us have their own bucket, above that each
+ * octave is split in four, up to 2^24 us (16.7 s, larger values land in the
+ * last bucket). A bucket's upper bound is at most 25% above its lower bound.
+ */
+#define LATENCY_SUB_BITS        2
+#define LATENCY_MAX_OCTAVE      23
+#define LATENCY_BUCKETS         ((LATENCY_MAX_OCTAVE - LATENCY_SUB_BITS + 2) << LATENCY_SUB_BITS)
+
+/**
+ * @brief One trace: a timing counter value per point
+ */
+typedef struct {
+    timing_t at[LATENCY_POINT_COUNT];
+    atomic_t recorded;                  ///< BIT(point) once at[point] is set
+} latency_trace_t;
+
+/**
+ * @brief Histogram of one step
+ *
+ * Only the context recording the step's end point writes it. A full bucket
+ * halves all of them, so old samples fade instead of saturating.
+ */
+typedef struct {
+    uint16_t count[LATENCY_BUCKETS];
+    uint32_t samples;
+    uint32_t max_us;
+} latency_histogram_t;
+
+static latency_trace_t traces[LATENCY_TRACE_RING];
+static atomic_t open_seq;               ///< Sequence number of the open trace, 0 when none
+static uint32_t last_rx_ms;             ///< UART callback only
+static bool rx_seen;
+
+// [LATENCY_UART_RX] holds the whole trace, the others the step ending at that point
+static latency_histogram_t histograms[LATENCY_POINT_COUNT];
+
+static atomic_t traces_opened;
+static atomic_t traces_completed;
+static atomic_t traces_abandoned;
+
+static const char *const point_names[LATENCY_POINT_COUNT] = {
+    [LATENCY_UART_RX] = "rx",
+    [LATENCY_SENTENCE] = "sentence",
+    [LATENCY_PARSED] = "parsed",
+    [LATENCY_PUBLISHED] = "published",
+    [LATENCY_CONSUMED] = "consumed",
+    [LATENCY_HMI_DIRTY] = "dirty",
+    [LATENCY_DISPLAYED] = "displayed",
+};
+
+static unsigned int bucket_of(uint32_t us)
+{
+    if (us < BIT(LATENCY_SUB_BITS)) {
+        return us;
+    }
+
+    unsigned int octave = MIN(31 - __builtin_clz(us), LATENCY_MAX_OCTAVE);
+    unsigned int sub = (us >> (octave - LATENCY_SUB_BITS)) & BIT_MASK(LATENCY_SUB_BITS);
+
+    if (octave == LATENCY_MAX_OCTAVE && us >= BIT(LATENCY_MAX_OCTAVE + 1)) {
+        sub = BIT_MASK(LATENCY_SUB_BITS);
+    }
+    return ((octave - LATENCY_SUB_BITS + 1) << LATENCY_SUB_BITS) + sub;
+}
+
+static uint32_t bucket_upper_us(unsigned int bucket)
+{
+    if (bucket < BIT(LATENCY_SUB_BITS)) {
+        return bucket;
+    }
+
+    unsigned int octave = (bucket >> LATENCY_SUB_BITS) + LATENCY_SUB_BITS - 1;
+    unsigned int sub = bucket & BIT_MASK(LATENCY_SUB_BITS);
+
+    return ((BIT(LATENCY_SUB_BITS) + sub + 1) << (octave - LATENCY_SUB_BITS)) - 1;
+}
+
+static void histogram_add(latency_histogram_t *h, uint32_t us)
+{
+    unsigned int bucket = bucket_of(us);
+
+    if (h->count[bucket] == UINT16_MAX) {
+        for (int i = 0; i < LATENCY_BUCKETS; i++) {
+            h->count[i] /= 2;
+        }
+    }
+    h->count[bucket]++;
+    h->samples++;
+    h->max_us = MAX(h->max_us, us);
+}
+
+/**
+ * @brief Upper bound of the bucket holding the given percentile, 0 when empty
+ */
+static uint32_t histogram_percentile(const latency_histogram_t *h, unsigned int percent)
+{
+    uint32_t total = 0;
+
+    for (int i = 0; i < LATENCY_BUCKETS; i++) {
+        total += h->count[i];
+    }
+    if (total == 0) {
+        return 0;
+    }
+
+    uint32_t rank = DIV_ROUND_UP(total * percent, 100U);
+    uint32_t seen = 0;
+    for (int i = 0; i < LATENCY_BUCKETS; i++) {
+        seen += h->count[i];
+        if (seen >= rank) {
+            // The exact maximum is a better bound for the top bucket
+            return MIN(bucket_upper_us(i), h->max_us);
+        }
+    }
+    return h->max_us;
+}
+
+static uint32_t elapsed_us(const latency_trace_t *trace, latency_point_t from, latency_point_t to)
+{
+    timing_t start = trace->at[from];
+    timing_t end = trace->at[to];
+
+    return (uint32_t)(timing_cycles_to_ns(timing_cycles_get(&start, &end)) / 1000U);
+}
+
+void latency_trace_init(void)
+{
+    timing_init();
+    timing_start();
+}
+
+void latency_trace_rx(void)
+{
+    uint32_t now = k_uptime_get_32();
+    bool burst = !rx_seen || now - last_rx_ms >= LATENCY_TRACE_GAP_MS;
+
+    last_rx_ms = now;
+    rx_seen = true;
+    if (!burst) {
+        return;
+    }
+
+    atomic_val_t seq = atomic_inc(&traces_opened) + 1;
+    latency_trace_t *trace = &traces[seq % LATENCY_TRACE_RING];
+
+    atomic_clear(&trace->recorded);
+    trace->at[LATENCY_UART_RX] = timing_counter_get();
+    atomic_set(&trace->recorded, BIT(LATENCY_UART_RX));
+
+    // The previous epoch changed nothing on screen (or is still being drawn)
+    if (atomic_set(&open_seq, seq) != 0) {
+        atomic_inc(&traces_abandoned);
+    }
+}
+
+void latency_trace_mark(latency_point_t point)
+{
+    timing_t now = timing_counter_get();
+    atomic_val_t seq = atomic_get(&open_seq);
+
+    if (seq == 0 || point == LATENCY_UART_RX || point >= LATENCY_POINT_COUNT) {
+        return;
+    }
+
+    latency_trace_t *trace = &traces[seq % LATENCY_TRACE_RING];
+    atomic_val_t recorded = atomic_get(&trace->recorded);
+    if ((recorded & BIT(point)) || !(recorded & BIT(point - 1))) {
+        return;
+    }
+    trace->at[point] = now;
+    atomic_or(&trace->recorded, BIT(point));
+    histogram_add(&histograms[point], elapsed_us(trace, point - 1, point));
+
+    if (point == LATENCY_DISPLAYED && atomic_cas(&open_seq, seq, 0)) {
+        histogram_add(&histograms[LATENCY_UART_RX], elapsed_us(trace, LATENCY_UART_RX, point));
+        atomic_inc(&traces_completed);
+    }
+}
+
+void latency_trace_get_stats(latency_trace_stats_t *stats)
+{
+    if (!stats) {
+        return;
+    }
+
+    stats->opened = atomic_get(&traces_opened);
+    stats->completed = atomic_get(&traces_completed);
+    stats->abandoned = atomic_get(&traces_abandoned);
+    for (int i = 0; i < LATENCY_POINT_COUNT; i++) {
+        const latency_histogram_t *h = &histograms[i];
+
+        stats->step[i].samples = h->samples;
+        stats->step[i].p50_us = histogram_percentile(h, 50);
+        stats->step[i].p95_us = histogram_percentile(h, 95);
+        stats->step[i].max_us = h->max_us;
+    }
+}
+
+const char *latency_trace_point_name(latency_point_t point)
+{
+    return point < LATENCY_POINT_COUNT ? point_names[point] : "?";
+}
+
+void latency_trace_print(void)
+{
+    latency_trace_stats_t stats;
+    latency_trace_get_stats(&stats);
+
+    printk("Fix-to-pixel latency: %u traces, %u displayed, %u without a screen change; "
+           "p50/p95/max %u/%u/%u ms\n",
+           stats.opened, stats.completed, stats.abandoned,
+           stats.step[LATENCY_UART_RX].p50_us / 1000U, stats.step[LATENCY_UART_RX].p95_us / 1000U,
+           stats.step[LATENCY_UART_RX].max_us / 1000U);
+    for (int i = LATENCY_SENTENCE; i < LATENCY_POINT_COUNT; i++) {
+        printk("  %s->%s: p50/p95/max %u/%u/%u us (%u samples)\n",
+               point_names[i - 1], point_names[i], stats.step[i].p50_us, stats.step[i].p95_us,
+               stats.step[i].max_us, stats.step[i].samples);
+    }
+}
+
+#ifdef CONFIG_SHELL
+static int cmd_latency_show(const struct shell *sh, size_t argc, char **argv)
+{
+    latency_trace_stats_t stats;
+    latency_trace_get_stats(&stats);
+
+    shell_print(sh, "%u traces, %u displayed, %u without a screen change",
+                stats.opened, stats.completed, stats.abandoned);
+    shell_print(sh, "%-22s %8s %8s %8s %8s", "step", "samples", "p50 us", "p95 us", "max us");
+    for (int i = LATENCY_SENTENCE; i < LATENCY_POINT_COUNT; i++) {
+        char step[24];
+
+        snprintf(step, sizeof(step), "%s->%s", point_names[i - 1], point_names[i]);
+        shell_print(sh, "%-22s %8u %8u %8u %8u", step, stats.step[i].samples,
+                    stats.step[i].p50_us, stats.step[i].p95_us, stats.step[i].max_us);
+    }
+    shell_print(sh, "%-22s %8u %8u %8u %8u", "total", stats.step[LATENCY_UART_RX].samples,
+                stats.step[LATENCY_UART_RX].p50_us, stats.step[LATENCY_UART_RX].p95_us,
+                stats.step[LATENCY_UART_RX].max_us);
+    return 0;
+}
+
+static int cmd_latency_recent(const struct shell *sh, size_t argc, char **argv)
+{
+    atomic_val_t newest = atomic_get(&traces_opened);
+
+    // Oldest first; each line gives the step times in us, "-" where the trace stopped
+    for (atomic_val_t seq = MAX(newest - LATENCY_TRACE_RING + 1, 1); seq <= newest; seq++) {
+        const latency_trace_t *trace = &traces[seq % LATENCY_TRACE_RING];
+        atomic_val_t recorded = atomic_get(&trace->recorded);
+        char line[96];
+        int len = snprintf(line, sizeof(line), "#%ld", (long)seq);
+
+        for (int i = LATENCY_SENTENCE; i < LATENCY_POINT_COUNT && len < (int)sizeof(line); i++) {
+            if (recorded & BIT(i)) {
+                len += snprintf(&line[len], sizeof(line) - len, " %u",
+                                elapsed_us(trace, i - 1, i));
+            } else {
+                len += snprintf(&line[len], sizeof(line) - len, " -");
+            }
+        }
+        shell_print(sh, "%s", line);
+    }
+    return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(latency_cmds,
+    SHELL_CMD(show, NULL, "Per-step p50/p95/max of the fix-to-pixel pipeline", cmd_latency_show),
+    SHELL_CMD(recent, NULL, "Step times of the most recent traces", cmd_latency_recent),
+    SHELL_SUBCMD_SET_END
+);
+SHELL_CMD_REGISTER(latency, &latency_cmds, "GPS fix-to-pixel latency", cmd_latency_show);
+#endif
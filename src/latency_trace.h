@@ -0,0 +1,107 @@
+/**
+ * @file latency_trace.h
+ * @brief Fix-to-pixel latency: trace points from UART RX to the display write
+ *
+ * One trace follows a navigation epoch through the pipeline:
+ *
+ *   UART RX -> sentence complete -> parse done -> snapshot published ->
+ *   main loop consumed -> HMI dirty -> display write complete
+ *
+ * Each trace point is hit in one context only (UART callback, system work
+ * queue or main thread) and records the timing counter (CONFIG_TIMING_FUNCTIONS:
+ * the SoC's high-resolution timer, not the 32768 Hz system clock) once per
+ * trace, and only after the point before it, so the points need no lock. The first received
+ * bytes after a quiet line (LATENCY_TRACE_GAP_MS) open the next trace in a ring
+ * of LATENCY_TRACE_RING; a trace still open then never reached the screen
+ * (nothing visible changed) and is counted as abandoned.
+ *
+ * Each recorded step (previous point to this one) goes into a log-scale
+ * histogram (four buckets per octave of microseconds), and a trace reaching the
+ * display adds its total; p50, p95 and the maximum are read from them. Most
+ * epochs end at "published": the scheduler ticks the clock, and only a fix,
+ * move, date or resync makes the main loop consume one. With CONFIG_SHELL the
+ * "latency" command shows the histograms and the most recent traces.
+ */
+
+#ifndef LATENCY_TRACE_H
+#define LATENCY_TRACE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define LATENCY_TRACE_RING      16      ///< Most recent traces kept
+#define LATENCY_TRACE_GAP_MS    100     ///< Quiet line before bytes open a new trace (bursts are 1 Hz)
+
+/**
+ * @brief Trace points, in pipeline order
+ */
+typedef enum {
+    LATENCY_UART_RX = 0,        ///< First bytes of the epoch's burst (UART callback)
+    LATENCY_SENTENCE,           ///< First checksum-valid sentence or frame queued (UART callback)
+    LATENCY_PARSED,             ///< Parser changed the fix (work queue)
+    LATENCY_PUBLISHED,          ///< Snapshot and zbus events published (work queue)
+    LATENCY_CONSUMED,           ///< Main loop copied the snapshot (main thread)
+    LATENCY_HMI_DIRTY,          ///< A displayed value changed (main thread)
+    LATENCY_DISPLAYED,          ///< display_write() of the refresh returned (main thread)
+    LATENCY_POINT_COUNT,
+} latency_point_t;
+
+/**
+ * @brief Latency percentiles of one step (or of the whole trace)
+ */
+typedef struct {
+    uint32_t samples;
+    uint32_t p50_us;            ///< Upper bound of the bucket holding the median
+    uint32_t p95_us;
+    uint32_t max_us;            ///< Exact
+} latency_summary_t;
+
+/**
+ * @brief Trace statistics
+ */
+typedef struct {
+    uint32_t opened;            ///< Traces started
+    uint32_t completed;         ///< Traces that reached the display
+    uint32_t abandoned;         ///< Traces replaced before reaching it
+    /** Step from the previous point to this one; [LATENCY_UART_RX] is the whole trace */
+    latency_summary_t step[LATENCY_POINT_COUNT];
+} latency_trace_stats_t;
+
+/**
+ * @brief Start the timing counter; call once at boot, before the receiver runs
+ */
+void latency_trace_init(void);
+
+/**
+ * @brief Bytes arrived from the receiver (UART callback context)
+ *
+ * Opens a new trace when the line was quiet for LATENCY_TRACE_GAP_MS.
+ */
+void latency_trace_rx(void);
+
+/**
+ * @brief Record a trace point of the open trace
+ *
+ * Ignored if the point is already recorded, or the one before it is not; the
+ * step ending at the point goes into its histogram. Each point must only be
+ * recorded from one context. LATENCY_DISPLAYED completes the trace.
+ */
+void latency_trace_mark(latency_point_t point);
+
+/**
+ * @brief Get trace counts and per-step percentiles
+ * @param stats Output statistics
+ */
+void latency_trace_get_stats(latency_trace_stats_t *stats);
+
+/**
+ * @brief Name of a trace point ("rx", "sentence"...)
+ */
+const char *latency_trace_point_name(latency_point_t point);
+
+/**
+ * @brief Print the percentiles of each step (30 s status print)
+ */
+void latency_trace_print(void);
+
+#endif // LATENCY_TRACE_H
@@ -3,12 +3,19 @@
 #include <zephyr/drivers/display.h>
 #include <zephyr/drivers/gpio.h>
 #include <zephyr/drivers/uart.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/zbus/zbus.h>
+#include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <limits.h>
 #include <math.h>
 #include "font.h"
-#ifdef USE_NEO6M_GPS
+#if defined(USE_NEO6M_GPS)
     #include "gps_neo6m.h"
+#elif defined(USE_GPS_REPLAY)
+    #include "gps_replay.h"
 #else
     #include "gps_neo7m.h"
 #endif
@@ -19,6 +26,18 @@
 #include "bme280_sensor.h"
 #include "pmodals_sensor.h"
 #include "sd_card.h"
+#include "event_scheduler.h"
+#include "time_of_day.h"
+#include "calendar.h"
+#include "gps_events.h"
+#include "gps_position.h"
+#include "gnss_sats.h"
+#include "utc_clock.h"
+#include "last_known.h"
+#include "latency_trace.h"
+#ifdef USE_NEO7M_GPS
+    #include "gps_power.h"
+#endif
 
 // External prayer time function
 extern double convert_Gregor_2_Julian_Day(float d, int m, int y);
@@ -28,16 +47,252 @@ extern double convert_Gregor_2_Julian_Day(float d, int m, int y);
 // Variables for prayer calculations
 double Lng = 0.0, Lat = 0.0, D = 0.0;
 
-// Helper function to convert decimal hours to HH:MM format
-void decimal_to_time_string(double decimal_hours, char* time_str, size_t max_len) {
-    // Ensure positive value and within 24 hours
-    while (decimal_hours < 0) decimal_hours += 24;
-    while (decimal_hours >= 24) decimal_hours -= 24;
+// Format temperature as "21.5°C" from tenths of a degree without snprintf
+static void format_temperature(float celsius, char *out)
+{
+    int tenths = (int)lroundf(celsius * 10.0f);
+    char *p = out;
+
+    if (tenths < 0) {
+        *p++ = '-';
+        tenths = -tenths;
+    }
+    if (tenths >= 1000) {
+        *p++ = '0' + (tenths / 1000) % 10;
+    }
+    if (tenths >= 100) {
+        *p++ = '0' + (tenths / 100) % 10;
+    }
+    *p++ = '0' + (tenths / 10) % 10;
+    *p++ = '.';
+    *p++ = '0' + tenths % 10;
+    strcpy(p, "°C");
+}
+
+// Scheduler events are latched here and handled by the main thread after it wakes
+static atomic_t sched_pending;
+static atomic_t sched_next_prayer;
+static atomic_t sched_prayer_reached;
+
+static void on_sched_event(sched_event_type_t type, uint8_t index)
+{
+    if (type == SCHED_EVT_NEXT_PRAYER) {
+        atomic_set(&sched_next_prayer, index);
+    } else if (type == SCHED_EVT_PRAYER) {
+        atomic_set(&sched_prayer_reached, index);
+    }
+    atomic_or(&sched_pending, BIT(type));
+}
+
+// GPS events latched by the zbus listener and handled by the main thread
+enum {
+    GPS_PENDING_ACQUIRED = 0,
+    GPS_PENDING_LOST,
+    GPS_PENDING_MOVED,
+    GPS_PENDING_TIME,
+    GPS_PENDING_DATE,
+};
+static atomic_t gps_pending;
+
+// Main-thread GPS work: runs, runs without a new fix, prayer recalculations
+static uint32_t gps_runs, gps_redundant, gps_seen, prayer_recomputes;
+
+// Smoothed position the prayer times, nearest city and timezone were computed for
+static bool work_position_valid;
+static double work_latitude, work_longitude;
+static int work_city = -1;                 ///< Nearest city's index, -1 if none
+static city_data_t work_city_data;         ///< Its unpacked record
+static bool work_city_stale = true;
+static bool work_for_move;                 ///< Pending recalculation is for a move only
+
+// Position work skipped: fix events within the move threshold, city searches, redraws
+static uint32_t position_work_avoided, city_searches_avoided, redraws_avoided;
+
+// UTC date the prayer times were computed for
+static int32_t work_date_ordinal = -1;
+
+// Prayer times, dates and clock restored from the last-known state until GPS takes over
+static bool screen_restored, dates_restored;
+static atomic_t clock_restored;
+
+// Boot to the first prayer screen (from whichever source) and to the first one from GPS
+static uint32_t first_screen_ms, gps_screen_ms;
+
+static void on_gps_event(const struct zbus_channel *chan)
+{
+    if (chan == &gps_fix_chan) {
+        const gps_fix_msg_t *msg = zbus_chan_const_msg(chan);
+        switch (msg->event) {
+        case GPS_FIX_ACQUIRED:
+            atomic_or(&gps_pending, BIT(GPS_PENDING_ACQUIRED));
+            break;
+        case GPS_FIX_LOST:
+            atomic_or(&gps_pending, BIT(GPS_PENDING_LOST));
+            break;
+        default:
+            atomic_or(&gps_pending, BIT(GPS_PENDING_MOVED));
+            break;
+        }
+        sched_wake();
+    } else if (chan == &gps_date_chan) {
+        atomic_or(&gps_pending, BIT(GPS_PENDING_DATE));
+        sched_wake();
+    } else if (!sched_time_valid() || atomic_get(&clock_restored)) {
+        // Only the first UTC second matters (also replacing a clock restored at boot),
+        // the scheduler keeps time after that; it arrives at the 1 Hz rate main already wakes at
+        atomic_or(&gps_pending, BIT(GPS_PENDING_TIME));
+    }
+}
+
+ZBUS_LISTENER_DEFINE(main_gps_listener, on_gps_event);
+ZBUS_CHAN_ADD_OBS(gps_fix_chan, main_gps_listener, 0);
+ZBUS_CHAN_ADD_OBS(gps_time_chan, main_gps_listener, 0);
+ZBUS_CHAN_ADD_OBS(gps_date_chan, main_gps_listener, 0);
+
+// Re-anchor the scheduler clock from GPS local time; true when the UTC offset
+// changed since the previous resync (a DST transition or a new zone)
+static bool resync_local_clock(void)
+{
+    static int last_offset_min = INT_MIN;
+    int32_t local_sod;
+    int offset_min = gps_get_local_time(&local_sod);
+
+    if (local_sod < 0) {
+        return false;
+    }
+
+    struct gps_data gps;
+    gps_snapshot(&gps);
+    sched_set_time(local_sod);
+    printk("GPS UTC: %s -> Local (UTC%+d:%02d): %d s\n", gps.time_str, offset_min / 60,
+           abs(offset_min) % 60, local_sod);
 
-    int hours = (int)decimal_hours;
-    int minutes = (int)((decimal_hours - hours) * 60);
+    if (offset_min == last_offset_min) {
+        return false;
+    }
+    bool changed = (last_offset_min != INT_MIN);
+    last_offset_min = offset_min;
+#ifdef USE_NEO7M_GPS
+    // Fresh fix for the GPS date change, whatever the power policy is doing: the
+    // wake-up is at a UTC time, so it follows the offset
+    sched_clear_type(SCHED_EVT_GPS_WAKE);
+    sched_add(tod_wrap(GPS_POWER_WAKE_UTC_SOD + offset_min * 60), SCHED_EVT_GPS_WAKE, 0);
+#endif
+    return changed;
+}
+
+// Register the day's prayer and highlight-switch instants with the scheduler
+static void schedule_prayer_events(const int32_t prayer_sod[PRAYER_COUNT])
+{
+    sched_clear_type(SCHED_EVT_PRAYER);
+    sched_clear_type(SCHED_EVT_NEXT_PRAYER);
+
+    for (int i = 0; i < PRAYER_COUNT; i++) {
+        // At each prayer instant the highlight moves on to the following prayer
+        sched_add(prayer_sod[i], SCHED_EVT_NEXT_PRAYER, (i + 1) % PRAYER_COUNT);
 
-    snprintf(time_str, max_len, "%02d:%02d", hours, minutes);
+        // Athan only for the 5 main prayers, not Shuruq
+        if (i != PRAYER_SHURUQ) {
+            sched_add(prayer_sod[i], SCHED_EVT_PRAYER, i);
+        }
+    }
+}
+
+// Prayer times for a UTC date at the current Lat/Lng and prayer timezone, in
+// seconds since local midnight in display order
+static void calculate_prayer_times(int32_t date_ordinal, int32_t prayer_sod[PRAYER_COUNT])
+{
+    int year, month, day;
+    tod_civil_from_days(date_ordinal, &year, &month, &day);
+
+    // Set global day variable; the Julian Day is passed, not shared
+    D = (double)day;
+    double jd_ut = convert_Gregor_2_Julian_Day((float)day, month, year);
+
+    prayer_myFloats_t prayers = prayerStruct(jd_ut);
+    prayer_recomputes++;
+    prayer_times_to_sod(&prayers, prayer_sod);
+    work_date_ordinal = date_ordinal;
+}
+
+// Nearest city of the work position, by index in the city table
+static void set_work_city(int index)
+{
+    work_city = get_city_by_index(index, &work_city_data) ? index : -1;
+}
+
+// Persist what the prayer times were computed from (the write is coalesced)
+static void save_last_known(void)
+{
+    last_known_t lk = {
+        .latitude = work_latitude,
+        .longitude = work_longitude,
+        .date_ordinal = work_date_ordinal,
+        .city_index = (int16_t)work_city,
+        .zone = (work_city >= 0) ? work_city_data.tz : TZ_ZONE_FIXED,
+        .method = prayer_get_method(),
+        .asr_method = prayer_get_asr_method(),
+        .high_lat_rule = prayer_get_high_lat_rule(),
+    };
+    last_known_update(&lk);
+}
+
+// Prayer times from the last-known state: position, city, zone and settings of the
+// last calculation, for today when UTC survived a warm reset, otherwise for the
+// date of that calculation. GPS confirms or corrects them once it has a fix.
+static bool restore_last_known(int32_t prayer_sod[PRAYER_COUNT], int32_t *local_sod)
+{
+    last_known_t lk;
+    int64_t utc_ms;
+
+    *local_sod = TOD_INVALID;
+    if (last_known_init() != 0 || !last_known_get(&lk)) {
+        printk("No last-known state - waiting for GPS\n");
+        return false;
+    }
+
+    prayer_set_method(lk.method);
+    prayer_set_asr_method(lk.asr_method);
+    prayer_set_high_lat_rule(lk.high_lat_rule);
+
+    Lat = work_latitude = lk.latitude;
+    Lng = work_longitude = lk.longitude;
+    work_position_valid = true;
+    set_work_city(lk.city_index);
+    work_city_stale = false;
+
+    bool clock = last_known_utc_ms(&utc_ms);
+    int32_t utc_s = clock ? (int32_t)(utc_ms / 1000) :
+                            lk.date_ordinal * TOD_SECONDS_PER_DAY + TOD_SECONDS_PER_DAY / 2;
+    int32_t date_ordinal = utc_s / TOD_SECONDS_PER_DAY;
+
+    // Offset in effect at that instant (GPS has no UTC time yet to evaluate it)
+    tz_year_t tz;
+    if (lk.zone < TZ_ZONE_COUNT) {
+        tz_year_expand(&tz, lk.zone, 2000);
+        gps_set_timezone(lk.zone);
+    } else {
+        tz_year_fixed(&tz, gps_calculate_timezone_from_longitude(Lng) * 60);
+    }
+    int offset_min = tz_offset_min(&tz, utc_s);
+
+    // Prayer times use the offset of their day at local noon, as after a fix
+    int32_t noon_utc = date_ordinal * TOD_SECONDS_PER_DAY + TOD_SECONDS_PER_DAY / 2 -
+                       (int32_t)lround(Lng * 240.0);
+    prayer_set_timezone(tz_offset_min(&tz, noon_utc) / 60.0);
+
+    calculate_prayer_times(date_ordinal, prayer_sod);
+    if (clock) {
+        *local_sod = ((utc_s + offset_min * 60) % TOD_SECONDS_PER_DAY + TOD_SECONDS_PER_DAY) %
+                     TOD_SECONDS_PER_DAY;
+    }
+
+    int year, month, day;
+    tod_civil_from_days(date_ordinal, &year, &month, &day);
+    printk("Last-known: %.4f,%.4f (%s), UTC%+d:%02d, %02d/%02d/%04d (%s)\n", Lat, Lng,
+           (work_city >= 0) ? work_city_data.city_name : "no city", offset_min / 60, abs(offset_min) % 60,
+           day, month, year, clock ? "clock kept over reset" : "date of the last fix");
+    return true;
 }
 
 void main(void)
@@ -85,12 +340,77 @@ void main(void)
     // Backlight control (handled by display driver)
     printk("Backlight controlled by display driver\n");
 
+    // Initialize with default prayer times (new order with SHURUQ)
+    prayer_time_t current_prayers[PRAYER_COUNT] = {
+        {"Fajr", tod_from_hms(5, 30, 0), false},
+        {"Shuruq", tod_from_hms(6, 45, 0), false},
+        {"Dhuhr", tod_from_hms(12, 15, 0), false},
+        {"Asr", tod_from_hms(15, 45, 0), true},
+        {"Maghrib", tod_from_hms(18, 20, 0), false},
+        {"Isha", tod_from_hms(20, 0, 0), false}
+    };
+    int32_t prayer_sod[PRAYER_COUNT];
+    for (int i = 0; i < PRAYER_COUNT; i++) {
+        prayer_sod[i] = current_prayers[i].sod;
+    }
+
+    // Last-known state from flash: today's prayer times before GPS, sensors and SD card
+    int32_t restored_sod;
+    bool restored = restore_last_known(prayer_sod, &restored_sod);
+    if (restored) {
+        for (int i = 0; i < PRAYER_COUNT; i++) {
+            current_prayers[i].sod = prayer_sod[i];
+        }
+    }
+
+    // Set initial HMI data with dynamic next prayer detection
+    int next_prayer = get_next_prayer_index(restored_sod, prayer_sod);
+    hmi_set_prayer_times(current_prayers, next_prayer);
+    if (restored) {
+        int year, month, day;
+        tod_civil_from_days(work_date_ordinal, &year, &month, &day);
+        const calendar_snapshot_t *cal = calendar_update(year, month, day);
+        hmi_set_dates(cal->gregorian_str, cal->hijri_str, cal->day_short);
+        dates_restored = true;
+        hmi_set_countdown("");
+        hmi_set_city((work_city >= 0) ? work_city_data.city_name : "Last position");
+        hmi_set_last_known(true);
+        screen_restored = true;
+    } else {
+        hmi_set_countdown("Calculating...");
+        hmi_set_city("GPS Location...");
+    }
+
+    // Set default weather display (no temperature sensor)
+    hmi_set_weather("--°C");
+
+    hmi_set_current_time(restored_sod);
+    hmi_set_brightness(75);
+
+    // Force initial HMI display setup
+    printk("Performing initial HMI display setup...\n");
+    hmi_force_full_update(display_dev);
+    if (restored) {
+        first_screen_ms = k_uptime_get_32();
+        printk("Last-known prayer times shown %u ms after boot\n", first_screen_ms);
+    }
+
     // Initialize GPS
     printk("Initializing GPS...\n");
+    latency_trace_init();
     int gps_ret = gps_init();
     if (gps_ret != 0) {
         printk("GPS initialization failed: %d\n", gps_ret);
     }
+#ifdef USE_NEO7M_GPS
+    else {
+        // Duty-cycle the receiver once it has a fix
+        gps_power_init();
+    }
+#endif
+
+    // Keeps UTC between fixes and through outages; PPS input if wired
+    utc_clock_init();
 
     // Initialize speaker for Athan
     printk("Initializing Speaker...\n");
@@ -124,6 +444,7 @@ void main(void)
     printk("Initializing SD Card on SPI4 (CS: P1.06)...\n");
     printk("Note: This may take 5-10 seconds if no card is present\n");
     sd_card_set_display_device(display_dev);  // Set display for BMP images
+    bool splash_shown = false;
     int sd_ret = sd_card_init();
     printk("SD Card init returned: %d\n", sd_ret);
     if (sd_ret != 0) {
@@ -146,13 +467,16 @@ void main(void)
                    total_mb, block_count, block_size);
         }
 
-        // Display woof.bmp image from SD card
+        // Display woof.bmp image from SD card, unless prayer times are already shown
         printk("Displaying woof.bmp from SD card...\n");
-        int bmp_ret = sd_card_display_bmp_file("SD:/woof.bmp");
+        int bmp_ret = restored ? -EALREADY : sd_card_display_bmp_file("SD:/woof.bmp");
         if (bmp_ret == 0) {
             printk("BMP image displayed successfully!\n");
             printk("Image will be shown for 3 seconds...\n");
             k_msleep(3000);  // Show image for 3 seconds
+            splash_shown = true;
+        } else if (restored) {
+            printk("Skipping woof.bmp: last-known prayer times are on screen\n");
         } else {
             printk("Failed to display woof.bmp: error %d\n", bmp_ret);
             printk("Make sure woof.bmp exists in root directory of SD card\n");
@@ -162,53 +486,25 @@ void main(void)
     // Allow GPS to start receiving data
     k_msleep(200);
 
-    // Initialize with default prayer times (new order with SHURUQ)
-    prayer_time_t current_prayers[PRAYER_COUNT] = {
-        {"Fajr", "05:30", false},
-        {"Shuruq", "06:45", false},
-        {"Dhuhr", "12:15", false},
-        {"Asr", "15:45", true},
-        {"Maghrib", "18:20", false},
-        {"Isha", "20:00", false}
-    };
-
-    // Set initial HMI data with dynamic next prayer detection
-    // Create default prayer structure for initial calculation
-    prayer_myFloats_t default_prayers = {
-        .fajjir = 5.5,    // 05:30
-        .sunRise = 6.75,  // 06:45
-        .Dhuhur = 12.25,  // 12:15
-        .Assr = 15.75,    // 15:45
-        .Maghreb = 18.33, // 18:20
-        .Ishaa = 20.0     // 20:00
-    };
-    int next_prayer = get_next_prayer_index("--:--", &default_prayers);
-    hmi_set_prayer_times(current_prayers, next_prayer);
-    hmi_set_countdown("Calculating...");
-    hmi_set_city("GPS Location...");
-
-    // Set default weather display (no temperature sensor)
-    char temp_str[20];
-    snprintf(temp_str, sizeof(temp_str), "--°C");
-    hmi_set_weather(temp_str);
-
-    hmi_set_current_time("--:--");
-    hmi_set_brightness(75);
-
-    // Force initial HMI display setup
-    printk("Performing initial HMI display setup...\n");
-    hmi_force_full_update(display_dev);
+    // Splash replaced the screen: show the waiting screen again
+    if (splash_shown) {
+        hmi_force_full_update(display_dev);
 
-    // Allow initial display to complete
-    k_msleep(300);
+        // Allow initial display to complete
+        k_msleep(300);
+    }
 
     printk("Setup complete. Starting HMI display loop...\n");
 
-    bool prayer_times_calculated = false;
+    bool prayer_times_calculated = restored;
     bool sd_card_available = (sd_ret == 0);  // Track if SD card is working
 
     // Backlight test variables
     uint32_t last_backlight_test = 0;
+#ifdef USE_NEO7M_GPS
+    uint32_t last_fix_shown = 0;
+    uint32_t fix_latency_ms = 0, fix_latency_max_ms = 0;
+#endif
     const uint32_t backlight_interval = 30 * 1000; // 30 seconds in milliseconds
 
     // BME280 sensor reading variables
@@ -219,10 +515,42 @@ void main(void)
     uint32_t last_als_read = 0;
     const uint32_t als_interval = 2 * 1000; // Read ambient light every 2 seconds
 
+    // Event scheduler: main sleeps until the next second tick or day event
+    sched_init(on_sched_event);
+
+    // Hourly clock resync, offset by 30 s so it never coincides with a
+    // minute-aligned prayer instant
+    for (int h = 0; h < 24; h++) {
+        sched_add(h * 3600 + 30, SCHED_EVT_RESYNC, 0);
+    }
+
+    // Restored prayer times (and the clock, after a warm reset) until GPS takes over
+    if (restored) {
+        if (restored_sod != TOD_INVALID) {
+            sched_set_time(restored_sod);
+            atomic_set(&clock_restored, 1);
+        }
+        schedule_prayer_events(prayer_sod);
+    }
+
+    int32_t local_sod = restored_sod;
+
     // Keep running and update display
     while (1) {
+        // Sleep until the second tick or a scheduled event fires
+        sched_wait(K_FOREVER);
+        atomic_val_t pending = atomic_clear(&sched_pending);
+
+        // UTC for the next boot, should this one end in a warm reset
+        last_known_tick();
+
         // Process GPS data using polling
         gps_process_data();
+#ifdef USE_NEO7M_GPS
+        if (pending & BIT(SCHED_EVT_GPS_WAKE)) {
+            gps_power_full_tracking();
+        }
+#endif
 
         // Read PmodALS ambient light sensor periodically for auto-brightness
         // TEMPORARILY DISABLED for debugging
@@ -250,8 +578,8 @@ void main(void)
 
             if (read_ret == 0 && sensor_data.valid) {
                 // Update temperature display
-                char temp_display[20];
-                snprintf(temp_display, sizeof(temp_display), "%.1f°C", (double)sensor_data.temperature);
+                char temp_display[12];
+                format_temperature(sensor_data.temperature, temp_display);
                 hmi_set_weather(temp_display);
 
                 printk("BME280: %.1f°C, %.1f%%, %.1fhPa\n",
@@ -261,20 +589,78 @@ void main(void)
             last_sensor_read = sensor_time;
         }
 
-        // Update HMI with GPS data if available
-        extern struct gps_data current_gps;
+        // Satellite bars follow the GSV/GSA tables (each fix, GSV every fifth)
+        static uint32_t sats_seen;
+        static gnss_sats_t sats;
+        if (gnss_sats_generation() != sats_seen) {
+            sats_seen = gnss_sats_snapshot(&sats);
+            hmi_set_satellites(sats.used, sats.tracked);
+        }
+
+        // GPS events latched by the zbus listener since the last wakeup: the
+        // GPS-dependent work below only runs when one of them arrived
+        atomic_val_t gps_events = atomic_clear(&gps_pending);
+        static struct gps_data gps = { .utc_sod = TOD_INVALID };
         static bool dates_updated = false;
-        static char last_date[20] = {0};  // Track date changes for daily refresh
 
-        if (current_gps.date_valid) {
-            // Check if date changed (new day started) - trigger daily refresh
-            if (strlen(last_date) > 0 && strcmp(last_date, current_gps.date_str) != 0) {
-                printk("NEW DAY DETECTED! Date changed from '%s' to '%s'\n", last_date, current_gps.date_str);
+        if (gps_events) {
+            uint32_t generation = gps_snapshot(&gps);
+            latency_trace_mark(LATENCY_CONSUMED);
+            gps_runs++;
+            if (generation == gps_seen) {
+                gps_redundant++;
+            }
+            gps_seen = generation;
+        }
+
+        // Prayer times, city and timezone only follow a meaningful move of the smoothed
+        // position (including one made while the fix was lost)
+        if (gps_events & (BIT(GPS_PENDING_ACQUIRED) | BIT(GPS_PENDING_MOVED))) {
+            gps_fix_msg_t fix;
+            zbus_chan_read(&gps_fix_chan, &fix, K_NO_WAIT);
+
+            if (!work_position_valid ||
+                gps_position_moved(fix.latitude, fix.longitude, work_latitude, work_longitude)) {
+                if (work_position_valid) {
+                    printk("GPS position moved more than %.1f km - recalculating prayer times\n",
+                           GPS_POSITION_MOVE_KM);
+                    work_for_move = prayer_times_calculated;
+                }
+                work_latitude = fix.latitude;
+                work_longitude = fix.longitude;
+                work_position_valid = true;
+                work_city_stale = true;
+                prayer_times_calculated = false;
+            } else {
+                position_work_avoided++;
+            }
+        }
+
+        // GPS takes over from the last-known state: the prayer screen is already up
+        bool takeover = (gps_events & BIT(GPS_PENDING_ACQUIRED)) && screen_restored;
+        if (takeover) {
+            screen_restored = false;
+            hmi_set_last_known(false);
+            redraws_avoided++;
+        }
+
+        // Switch between the "Waiting for GPS" and the prayer screen; a first
+        // fix gets its full update from the prayer calculation below
+        if ((gps_events & BIT(GPS_PENDING_LOST)) ||
+            ((gps_events & BIT(GPS_PENDING_ACQUIRED)) && prayer_times_calculated && !takeover)) {
+            hmi_force_full_update(display_dev);
+        }
+
+        if (gps_events & BIT(GPS_PENDING_DATE)) {
+            // A date after the first one means a new day started - trigger daily refresh
+            if (dates_updated) {
+                printk("NEW DAY DETECTED! Date changed to '%s'\n", gps.date_str);
                 printk("Performing daily screen refresh and prayer time recalculation...\n");
 
-                // Reset flags to trigger fresh calculations
+                // Reset flags to trigger fresh calculations (same position: no city search)
                 dates_updated = false;
                 prayer_times_calculated = false;
+                work_for_move = false;
 
                 // Force complete screen refresh for new day
                 hmi_clear_screen(display_dev);
@@ -287,216 +673,158 @@ void main(void)
                 printk("Daily refresh completed - ready for new day!\n");
             }
 
-            // Update dates if needed
-            if (!dates_updated) {
-                hmi_set_dates(current_gps.date_str,
-                             current_gps.hijri_valid ? current_gps.hijri_date_str : "--/--/----",
-                             current_gps.day_valid ? current_gps.day_of_week : "---");
+            const calendar_snapshot_t *cal = calendar_get();
+
+            // The restored date is shown already; a different one needs new prayer times
+            bool date_confirmed = dates_restored && cal && cal->ordinal == work_date_ordinal;
+            if (dates_restored && !date_confirmed) {
+                printk("GPS date differs from the last-known one - recalculating prayer times\n");
+                prayer_times_calculated = false;
+            }
+            dates_restored = false;
+
+            if (cal) {
+                hmi_set_dates(cal->gregorian_str, cal->hijri_str, cal->day_short);
+            } else {
+                hmi_set_dates(gps.date_str, "--/--/----", "---");
+            }
+            if (date_confirmed) {
+                redraws_avoided++;
+            } else {
                 // Force full update for dates (one-time per day)
                 printk("About to force full update after date update...\n");
-                printk("Current time before date update: '%s'\n", current_gps.time_str);
+                printk("Current time before date update: '%s'\n", gps.time_str);
                 hmi_force_full_update(display_dev);
-                dates_updated = true;
-
-                // Store current date for daily change detection
-                strcpy(last_date, current_gps.date_str);
-                printk("Date update completed for: %s\n", last_date);
             }
+            dates_updated = true;
+            printk("Date update completed for: %s\n", gps.date_str);
         }
 
-        if (current_gps.valid) {
-            // Use GPS time as base, but update every second locally
-            static uint32_t last_gps_update = 0;
-            static char local_time[12] = {0};
-            static int last_seconds = -1;
-
-            uint32_t now = k_uptime_get_32();
-
-            // Update local time from GPS initially or every 60 seconds for sync
-            if (last_gps_update == 0 || (now - last_gps_update) > 60000) {
-                // Use GPS DST function to get local time with automatic DST
-                int offset = gps_get_local_time(local_time, sizeof(local_time));
-
-                if (strlen(local_time) >= 8) {
-                    last_seconds = (local_time[6] - '0') * 10 + (local_time[7] - '0');
-                    printk("GPS UTC: %s -> Local (UTC%+d): %s\n",
-                           current_gps.time_str, offset, local_time);
-                } else {
-                    strcpy(local_time, current_gps.time_str);
-                }
-
-                last_gps_update = now;
+        // Anchor the local clock on the first UTC second from the receiver, then
+        // on resync/rollover events
+        if (((gps_events & BIT(GPS_PENDING_TIME)) &&
+             (!sched_time_valid() || atomic_clear(&clock_restored))) ||
+            (pending & (BIT(SCHED_EVT_RESYNC) | BIT(SCHED_EVT_DATE_ROLLOVER)))) {
+            // Prayer times are local clock times: a new offset needs them again
+            if (resync_local_clock() && prayer_times_calculated) {
+                printk("UTC offset changed - recalculating prayer times\n");
+                prayer_times_calculated = false;
+                work_for_move = false;
             }
+        }
 
-            // Update seconds every 1000ms
-            static uint32_t last_second_update = 0;
-            if ((now - last_second_update) >= 1000) {
-                last_seconds++;
-                if (last_seconds >= 60) {
-                    // Handle minute rollover - resync with GPS using DST-aware function
-                    gps_get_local_time(local_time, sizeof(local_time));
-                    if (strlen(local_time) >= 8) {
-                        last_seconds = (local_time[6] - '0') * 10 + (local_time[7] - '0');
-                    }
-                } else {
-                    // Update just the seconds part
-                    local_time[6] = '0' + (last_seconds / 10);
-                    local_time[7] = '0' + (last_seconds % 10);
-                }
-                last_second_update = now;
+        if (gps.valid || screen_restored) {
+            // Local time is propagated by the scheduler between resyncs
+            if (sched_time_valid()) {
+                local_sod = sched_now();
             }
 
-            hmi_set_current_time(local_time);
-
-            // Update next prayer highlight continuously when prayer times are calculated
-            if (prayer_times_calculated) {
-                static prayer_myFloats_t current_prayer_floats;
-
-                // Update the prayer_myFloats_t structure with current prayer times
-                int fajr_h = (current_prayers[0].time[0] - '0') * 10 + (current_prayers[0].time[1] - '0');
-                int fajr_m = (current_prayers[0].time[3] - '0') * 10 + (current_prayers[0].time[4] - '0');
-                current_prayer_floats.fajjir = fajr_h + (fajr_m / 60.0);
-
-                int shuruq_h = (current_prayers[1].time[0] - '0') * 10 + (current_prayers[1].time[1] - '0');
-                int shuruq_m = (current_prayers[1].time[3] - '0') * 10 + (current_prayers[1].time[4] - '0');
-                current_prayer_floats.sunRise = shuruq_h + (shuruq_m / 60.0);
-
-                int dhuhr_h = (current_prayers[2].time[0] - '0') * 10 + (current_prayers[2].time[1] - '0');
-                int dhuhr_m = (current_prayers[2].time[3] - '0') * 10 + (current_prayers[2].time[4] - '0');
-                current_prayer_floats.Dhuhur = dhuhr_h + (dhuhr_m / 60.0);
+            hmi_set_current_time(local_sod);
 
-                int asr_h = (current_prayers[3].time[0] - '0') * 10 + (current_prayers[3].time[1] - '0');
-                int asr_m = (current_prayers[3].time[3] - '0') * 10 + (current_prayers[3].time[4] - '0');
-                current_prayer_floats.Assr = asr_h + (asr_m / 60.0);
-
-                int maghrib_h = (current_prayers[4].time[0] - '0') * 10 + (current_prayers[4].time[1] - '0');
-                int maghrib_m = (current_prayers[4].time[3] - '0') * 10 + (current_prayers[4].time[4] - '0');
-                current_prayer_floats.Maghreb = maghrib_h + (maghrib_m / 60.0);
-
-                int isha_h = (current_prayers[5].time[0] - '0') * 10 + (current_prayers[5].time[1] - '0');
-                int isha_m = (current_prayers[5].time[3] - '0') * 10 + (current_prayers[5].time[4] - '0');
-                current_prayer_floats.Ishaa = isha_h + (isha_m / 60.0);
-
-                // Get next prayer index based on current time
-                int next_prayer = get_next_prayer_index(local_time, &current_prayer_floats);
-
-                // Update highlight if next prayer changed
-                static int last_next_prayer = -1;
-                if (next_prayer != last_next_prayer) {
-                    hmi_set_prayer_times(current_prayers, next_prayer);
-                    hmi_force_full_update(display_dev);
-                    last_next_prayer = next_prayer;
-                    printk("Next prayer updated to index: %d (%s)\n", next_prayer, current_prayers[next_prayer].name);
-                }
+            // Next prayer highlight switches exactly at each prayer instant
+            if (prayer_times_calculated && (pending & BIT(SCHED_EVT_NEXT_PRAYER))) {
+                int next_prayer = (int)atomic_get(&sched_next_prayer);
+                hmi_set_prayer_times(current_prayers, next_prayer);
+                hmi_force_full_update(display_dev);
+                printk("Next prayer updated to index: %d (%s)\n", next_prayer, current_prayers[next_prayer].name);
             }
 
-            // Check for prayer time and trigger LED (only for 5 main prayers, excluding Shuruq)
-            if (prayer_times_calculated && strlen(local_time) >= 5) {
-                static char last_prayer_triggered[6] = {0};
-                char current_time_hhmm[6];
-                snprintf(current_time_hhmm, sizeof(current_time_hhmm), "%c%c:%c%c",
-                         local_time[0], local_time[1], local_time[3], local_time[4]);
-
-                // Check if current time matches any of the 5 main prayer times (excluding Shuruq at index 1)
-                for (int i = 0; i < PRAYER_COUNT; i++) {
-                    if (i == 1) continue; // Skip Shuruq (index 1)
-
-                    if (strcmp(current_time_hhmm, current_prayers[i].time) == 0) {
-                        // Check if we haven't already triggered for this prayer time
-                        if (strcmp(last_prayer_triggered, current_prayers[i].time) != 0) {
-                            printk("PRAYER TIME REACHED: %s at %s\n", current_prayers[i].name, current_prayers[i].time);
-                            strcpy(last_prayer_triggered, current_prayers[i].time);
-
-                            // Play Athan from SD card if available
-                            if (sd_card_available) {
-                                printk("Playing Athan from SD card (athan.wav) for %s prayer...\n", current_prayers[i].name);
-                                int audio_ret = sd_card_play_wav_file("SD:/athan.wav", 62500);
-                                if (audio_ret != 0) {
-                                    printk("Failed to play athan.wav from SD card: %d\n", audio_ret);
-                                    printk("Falling back to built-in athan tones...\n");
-                                    speaker_play_athan();
-                                } else {
-                                    printk("Athan playback completed successfully\n");
-                                }
-                            } else {
-                                // Fallback to built-in speaker tones if SD card not available
-                                printk("SD card not available, playing built-in Athan tones...\n");
-                                speaker_play_athan();
-                            }
-
-                            // Also trigger LED blinking
-                            Pray_Athan();
-                        }
-                        break;
+            // Prayer instant reached (only the 5 main prayers are scheduled, not Shuruq)
+            if (prayer_times_calculated && (pending & BIT(SCHED_EVT_PRAYER))) {
+                int i = (int)atomic_get(&sched_prayer_reached);
+                char hhmm[6];
+                tod_format_hhmm(current_prayers[i].sod, hhmm);
+                printk("PRAYER TIME REACHED: %s at %s\n", current_prayers[i].name, hhmm);
+
+                // Play Athan from SD card if available
+                if (sd_card_available) {
+                    printk("Playing Athan from SD card (athan.wav) for %s prayer...\n", current_prayers[i].name);
+                    int audio_ret = sd_card_play_wav_file("SD:/athan.wav", 62500);
+                    if (audio_ret != 0) {
+                        printk("Failed to play athan.wav from SD card: %d\n", audio_ret);
+                        printk("Falling back to built-in athan tones...\n");
+                        speaker_play_athan();
+                    } else {
+                        printk("Athan playback completed successfully\n");
                     }
+                } else {
+                    // Fallback to built-in speaker tones if SD card not available
+                    printk("SD card not available, playing built-in Athan tones...\n");
+                    speaker_play_athan();
                 }
+
+                // Also trigger LED blinking
+                Pray_Athan();
             }
 
             // Calculate prayer times when GPS is available and we haven't calculated yet
-            if (!prayer_times_calculated && current_gps.date_valid) {
+            if (!prayer_times_calculated && gps.date_valid && work_position_valid) {
                 printk("Calculating prayer times with GPS coordinates...\n");
 
-                // Set GPS coordinates for prayer calculations
-                Lat = current_gps.latitude;
-                Lng = current_gps.longitude;
+                // Smoothed GPS coordinates for prayer calculations
+                Lat = work_latitude;
+                Lng = work_longitude;
 
-                // Auto-configure timezone based on GPS coordinates
-                gps_auto_configure_timezone();
-
-                // Parse GPS date (format: DD/MM/YYYY) and set current Julian Day
-                int day, month, year;
-                if (sscanf(current_gps.date_str, "%d/%d/%d", &day, &month, &year) == 3) {
-                    // Set global day variable for prayer calculations
-                    D = (double)day;
-                    // Convert to Julian Day for prayer time calculations
-                    convert_Gregor_2_Julian_Day((float)day, month, year);
+                // Nearest city only after a move; its zone also gives the timezone
+                int previous_city = work_city;
+                if (work_city_stale) {
+                    set_work_city(find_nearest_city(Lat, Lng));
+                    work_city_stale = false;
+                } else {
+                    city_searches_avoided++;
                 }
+                gps_auto_configure_timezone((work_city >= 0) ? &work_city_data : NULL, Lng,
+                                            gps.date_ordinal);
 
-                // Find nearest city to GPS coordinates and update HMI
-                const city_data_t* nearest_city = find_nearest_city(current_gps.latitude, current_gps.longitude);
-                if (nearest_city) {
-                    printk("Nearest city found: %s (%s)\n", nearest_city->city_name, nearest_city->country);
-                    hmi_set_city(nearest_city->city_name);
+                // Update HMI with the nearest city
+                if (work_city >= 0) {
+                    printk("Nearest city found: %s (%s)\n", work_city_data.city_name, work_city_data.country);
+                    hmi_set_city(work_city_data.city_name);
                 } else {
                     printk("No city found, using coordinates\n");
                     char coord_str[20];
-                    snprintf(coord_str, sizeof(coord_str), "%.2f,%.2f", current_gps.latitude, current_gps.longitude);
+                    snprintf(coord_str, sizeof(coord_str), "%.2f,%.2f", Lat, Lng);
                     hmi_set_city(coord_str);
                 }
 
-                // Calculate prayer times
-                prayer_myFloats_t prayers = prayerStruct();
-
-                // Convert decimal hours to time strings and update display (new order with SHURUQ)
-                char time_str[6];
-
-                decimal_to_time_string(prayers.fajjir, time_str, sizeof(time_str));
-                strcpy(current_prayers[0].time, time_str);   // Fajr
-
-                decimal_to_time_string(prayers.sunRise, time_str, sizeof(time_str));
-                strcpy(current_prayers[1].time, time_str);   // Shuruq (Sunrise)
+                // Calculate prayer times for the GPS date
+                int32_t previous_sod[PRAYER_COUNT];
+                memcpy(previous_sod, prayer_sod, sizeof(previous_sod));
+                calculate_prayer_times(gps.date_ordinal, prayer_sod);
 
-                decimal_to_time_string(prayers.Dhuhur, time_str, sizeof(time_str));
-                strcpy(current_prayers[2].time, time_str);   // Dhuhr
-
-                decimal_to_time_string(prayers.Assr, time_str, sizeof(time_str));
-                strcpy(current_prayers[3].time, time_str);   // Asr
+                // Seconds since local midnight in display order, rounded to the minute
+                for (int i = 0; i < PRAYER_COUNT; i++) {
+                    current_prayers[i].sod = prayer_sod[i];
+                }
 
-                decimal_to_time_string(prayers.Maghreb, time_str, sizeof(time_str));
-                strcpy(current_prayers[4].time, time_str);   // Maghrib
+                // A move that changed neither a displayed minute nor the city needs no redraw
+                bool unchanged = work_for_move && work_city == previous_city &&
+                                 memcmp(previous_sod, prayer_sod, sizeof(previous_sod)) == 0;
+                work_for_move = false;
 
-                decimal_to_time_string(prayers.Ishaa, time_str, sizeof(time_str));
-                strcpy(current_prayers[5].time, time_str);   // Isha
+                // Hand the day's instants to the scheduler
+                schedule_prayer_events(prayer_sod);
 
                 // Update HMI with calculated prayer times using dynamic next prayer detection
-                int next_prayer = get_next_prayer_index(local_time, &prayers);
+                int next_prayer = get_next_prayer_index(local_sod, prayer_sod);
                 hmi_set_prayer_times(current_prayers, next_prayer);
                 hmi_set_countdown("");
 
                 // Force full update for prayer times (one-time)
-                hmi_force_full_update(display_dev);
+                if (unchanged) {
+                    redraws_avoided++;
+                } else {
+                    hmi_force_full_update(display_dev);
+                }
 
                 prayer_times_calculated = true;
+
+                // Boot to prayer times from GPS, and the state for the next boot
+                if (!gps_screen_ms) {
+                    gps_screen_ms = k_uptime_get_32();
+                    first_screen_ms = first_screen_ms ? first_screen_ms : gps_screen_ms;
+                }
+                save_last_known();
             }
         }
 
@@ -504,10 +832,120 @@ void main(void)
         uint32_t current_time = k_uptime_get_32();
         if (current_time - last_backlight_test >= backlight_interval) {
             printk("=== Status Update (every 30 seconds) ===\n");
-            printk("GPS Valid: %s\n", current_gps.valid ? "YES" : "NO");
+            printk("GPS Valid: %s\n", gps.valid ? "YES" : "NO");
             printk("Prayer Times Calculated: %s\n", prayer_times_calculated ? "YES" : "NO");
             printk("Display Working: YES\n");
 
+            // Main-thread wakeups (was 7200/h with the fixed 500 ms loop)
+            uint32_t wakeups, fired;
+            sched_get_stats(&wakeups, &fired);
+            printk("Main wakeups: %u (%u/h), scheduler events fired: %u\n",
+                   wakeups, (uint32_t)((uint64_t)wakeups * 3600000U / MAX(current_time, 1U)), fired);
+
+            // Date conversions (was 3 per RMC sentence, i.e. 10800/h at 1 Hz)
+            uint32_t cal_recomputes, cal_requests;
+            calendar_get_stats(&cal_recomputes, &cal_requests);
+            printk("Calendar conversions: %u (%u/h) for %u date updates\n",
+                   cal_recomputes, (uint32_t)((uint64_t)cal_recomputes * 3600000U / MAX(current_time, 1U)),
+                   cal_requests);
+
+            // GPS-dependent main-thread work (ran on every wakeup, 3600/h, when polled)
+            gps_events_stats_t ev;
+            gps_events_get_stats(&ev);
+            printk("GPS events: %u fix, %u moved, %u dates, %u seconds; main GPS work %u (%u/h), "
+                   "%u redundant, %u prayer recalculations\n",
+                   ev.fix, ev.moved, ev.date, ev.time, gps_runs,
+                   (uint32_t)((uint64_t)gps_runs * 3600000U / MAX(current_time, 1U)),
+                   gps_redundant, prayer_recomputes);
+
+            // Position filter: jitter held back, and position work it saved
+            gps_position_stats_t pos;
+            gps_position_get_stats(&pos);
+            printk("GPS position: %u fixes filtered (%u outliers, %u jumps), %u settled, %u restarts, "
+                   "%u raw moves suppressed; avoided %u recalculations, %u city searches, %u redraws\n",
+                   pos.fixes, pos.outliers, pos.jumps, pos.settled, pos.resets, ev.suppressed,
+                   position_work_avoided, city_searches_avoided, redraws_avoided);
+
+            // Satellite tables: what the bars and sky plot show, and GSV sequence health
+            gnss_sats_stats_t sv;
+            gnss_sats_get_stats(&sv);
+            printk("Satellites: %u used (fix %u), %u tracked, %u in view, %u in table; "
+                   "%u GSV sequences (%u broken), %u set, %u overflows\n",
+                   sats.used, sats.fix_type, sats.tracked, sats.in_view, sats.count,
+                   sv.sequences, sv.broken, sv.set, sv.overflows);
+
+            // Disciplined UTC: measured RTC drift and the error after the last GPS outage
+            utc_clock_stats_t clk;
+            utc_clock_get_stats(&clk);
+            printk("UTC clock: %s, drift %s%d.%03d ppm, %u samples, %u steps, %u PPS; "
+                   "since GPS %u s, last outage %u s error %d us\n",
+                   !clk.valid ? "no GPS time" : (clk.drift_valid ? "disciplined" : "anchored"),
+                   clk.drift_ppb < 0 ? "-" : "", abs(clk.drift_ppb) / 1000, abs(clk.drift_ppb) % 1000,
+                   clk.samples, clk.steps, clk.pps_edges, clk.since_gps_s, clk.holdover_s,
+                   clk.holdover_error_us);
+
+            // Boot to the first prayer screen, and flash writes of the last-known state
+            last_known_stats_t lk;
+            last_known_get_stats(&lk);
+            printk("First prayer screen: %u ms (%s), from GPS: %u ms; last-known state %s%s%s, "
+                   "%u updates, %u writes (%u unchanged, %u coalesced), %u errors\n",
+                   first_screen_ms, restored ? "last-known" : "GPS", gps_screen_ms,
+                   lk.loaded ? "loaded" : "none", lk.clock_retained ? " with clock" : "",
+                   lk.storage ? "" : " (no flash storage)",
+                   lk.updates, lk.writes, lk.unchanged, lk.coalesced, lk.errors);
+
+            // UART RX to display write, per pipeline step
+            latency_trace_print();
+
+#ifdef USE_NEO7M_GPS
+            // GPS RX wakeups (was 1000/s with the 1 ms uart_poll_in thread)
+            gps_rx_stats_t rx;
+            gps_get_rx_stats(&rx);
+            printk("GPS RX (%s): %u bytes, %u wakeups (%u/s), %u dropped lines, %u checksum errors, "
+                   "%u RX errors\n",
+                   (rx.protocol == GPS_PROTOCOL_UBX) ? "UBX" : "NMEA", rx.bytes, rx.rx_events + rx.work_runs,
+                   (uint32_t)((uint64_t)(rx.rx_events + rx.work_runs) * 1000U / MAX(current_time, 1U)),
+                   rx.lines_dropped, rx.checksum_errors, rx.rx_errors);
+            printk("GPS parse load: %u us/s at %u baud, fix-to-display %u ms (max %u ms)\n",
+                   (uint32_t)((uint64_t)rx.parse_us * 1000U / MAX(current_time, 1U)), rx.baud,
+                   fix_latency_ms, fix_latency_max_ms);
+
+            // Receiver duty cycle (seconds with output) and UART volume per day
+            gps_power_stats_t pw;
+            gps_power_get_stats(&pw);
+            printk("GPS power: stage %d, on %u%%, %u bytes/day, acquire/cyclic/time-only %u/%u/%u s\n",
+                   pw.stage, (uint32_t)((uint64_t)rx.active_s * 100000U / MAX(current_time, 1U)),
+                   (uint32_t)((uint64_t)rx.bytes * 86400000U / MAX(current_time, 1U)),
+                   pw.stage_s[GPS_POWER_ACQUIRE], pw.stage_s[GPS_POWER_CYCLIC],
+                   pw.stage_s[GPS_POWER_TIME_ONLY]);
+#endif
+
+#ifdef USE_GPS_REPLAY
+            // Replay soak: losses, parser throughput, fix and sentence-to-display latency
+            gps_replay_stats_t rp;
+            gps_replay_get_stats(&rp);
+            printk("GPS replay: %u bytes, %u messages, %u lost (%u bytes corrupted, %u dropped), "
+                   "parser %u kB/s\n",
+                   rp.bytes, rp.messages, rp.lost, rp.corrupted, rp.dropped, rp.parse_kbps);
+            printk("GPS replay latency: fix %u ms (max %u ms, %u fixes), to display p50/p90/p99/max "
+                   "%u/%u/%u/%u ms (%u samples)\n",
+                   rp.fix_latency_ms, rp.fix_latency_max_ms, rp.fixes,
+                   rp.e2e_p50_ms, rp.e2e_p90_ms, rp.e2e_p99_ms, rp.e2e_max_ms, rp.e2e_samples);
+#endif
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_ALL
+            // CPU idle share since the previous status update
+            static uint64_t last_idle_cycles, last_all_cycles;
+            k_thread_runtime_stats_t rt;
+            if (k_thread_runtime_stats_all_get(&rt) == 0) {
+                uint64_t all = rt.execution_cycles - last_all_cycles;
+                uint64_t idle = rt.idle_cycles - last_idle_cycles;
+                printk("CPU idle: %u%%\n", (uint32_t)(idle * 100U / MAX(all, 1U)));
+                last_all_cycles = rt.execution_cycles;
+                last_idle_cycles = rt.idle_cycles;
+            }
+#endif
+
             // Print raw GPS NMEA data for debugging
             gps_print_raw_data();
 
@@ -517,7 +955,22 @@ void main(void)
         // Update display with selective updates
         hmi_update_display(display_dev);
 
-        // 500ms delay for smooth time updates
-        k_msleep(500);
+#ifdef USE_GPS_REPLAY
+        // Sentence-in to display latency for the fix this refresh picked up
+        if (gps_events) {
+            gps_replay_displayed(gps.utc_sod);
+        }
+#endif
+
+#ifdef USE_NEO7M_GPS
+        // Fix-to-display latency: position update to the refresh that shows it
+        gps_rx_stats_t fix;
+        gps_get_rx_stats(&fix);
+        if (gps.valid && fix.last_fix_ms != last_fix_shown) {
+            fix_latency_ms = k_uptime_get_32() - fix.last_fix_ms;
+            fix_latency_max_ms = MAX(fix_latency_max_ms, fix_latency_ms);
+            last_fix_shown = fix.last_fix_ms;
+        }
+#endif
     }
-}
\ No newline at end of file
+}
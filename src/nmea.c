@@ -0,0 +1,395 @@
+/**
+ * @file nmea.c
+ * @brief Incremental NMEA 0183 tokenizer and fixed-point field parsers
+ */
+
+#include "nmea.h"
+
+enum {
+    NMEA_STATE_IDLE = 0,    // Waiting for '$'
+    NMEA_STATE_BODY,        // Between '$' and '*'
+    NMEA_STATE_CHECKSUM,    // Two hex digits after '*'
+};
+
+static int hex_value(uint8_t c)
+{
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    return -1;
+}
+
+// Field lengths are only known at the closing ',' or '*'
+static inline void close_field(nmea_sentence_t *s)
+{
+    nmea_span_t *f = &s->field[s->field_count - 1];
+    f->length = s->length - f->offset;
+}
+
+static bool framing_error(nmea_parser_t *parser)
+{
+    parser->framing_errors++;
+    parser->state = NMEA_STATE_IDLE;
+    return false;
+}
+
+void nmea_parser_init(nmea_parser_t *parser, nmea_sentence_t *sentence)
+{
+    *parser = (nmea_parser_t){ .sentence = sentence, .state = NMEA_STATE_IDLE };
+}
+
+bool nmea_parser_idle(const nmea_parser_t *parser)
+{
+    return parser->state == NMEA_STATE_IDLE;
+}
+
+void nmea_parser_abort(nmea_parser_t *parser)
+{
+    if (parser->state != NMEA_STATE_IDLE) {
+        framing_error(parser);
+    }
+}
+
+bool nmea_feed(nmea_parser_t *parser, uint8_t byte)
+{
+    nmea_sentence_t *s = parser->sentence;
+
+    // '$' always starts a new sentence, which also resynchronises after lost bytes
+    if (byte == '$') {
+        if (parser->state != NMEA_STATE_IDLE) {
+            parser->framing_errors++;
+        }
+        if (!s) {
+            parser->dropped++;
+            parser->state = NMEA_STATE_IDLE;
+            return false;
+        }
+        s->text[0] = '$';
+        s->length = 1;
+        s->field_count = 1;
+        s->field[0].offset = 1;
+        parser->checksum = 0;
+        parser->state = NMEA_STATE_BODY;
+        return false;
+    }
+
+    switch (parser->state) {
+    case NMEA_STATE_BODY:
+        if (byte == ',') {
+            close_field(s);
+            if (s->field_count >= NMEA_MAX_FIELDS) {
+                return framing_error(parser);
+            }
+            s->field[s->field_count++].offset = s->length + 1;
+        } else if (byte == '*') {
+            close_field(s);
+            s->text[s->length] = '\0';
+            parser->received = 0;
+            parser->state = NMEA_STATE_CHECKSUM;
+            return false;
+        } else if (byte < 32 || byte > 126) {
+            return framing_error(parser);
+        }
+
+        // Leave room for "*hh" within the 82 character limit
+        if (s->length >= NMEA_MAX_LENGTH - 3) {
+            return framing_error(parser);
+        }
+        parser->checksum ^= byte;
+        s->text[s->length++] = (char)byte;
+        return false;
+
+    case NMEA_STATE_CHECKSUM: {
+        int value = hex_value(byte);
+        if (value < 0) {
+            return framing_error(parser);
+        }
+
+        // XOR the transmitted checksum in: zero when it matches
+        parser->checksum ^= (parser->received == 0) ? (value << 4) : value;
+        if (++parser->received < 2) {
+            return false;
+        }
+
+        parser->state = NMEA_STATE_IDLE;
+        if (parser->checksum != 0) {
+            parser->checksum_errors++;
+            return false;
+        }
+        parser->sentences++;
+        return true;
+    }
+
+    default:
+        return false;   // Skip everything until the next '$'
+    }
+}
+
+size_t nmea_feed_block(nmea_parser_t *parser, const uint8_t *data, size_t len, bool *complete)
+{
+    size_t i = 0;
+
+    *complete = false;
+    while (i < len) {
+        // Fast path: plain characters inside a sentence. '$', '*' and ',' are all
+        // <= ',' and take the byte-wise path with everything else unusual
+        if (parser->state == NMEA_STATE_BODY) {
+            nmea_sentence_t *s = parser->sentence;
+            uint8_t length = s->length;
+            uint8_t checksum = parser->checksum;
+
+            while (i < len && data[i] > ',' && data[i] <= 126 && length < NMEA_MAX_LENGTH - 3) {
+                checksum ^= data[i];
+                s->text[length++] = (char)data[i++];
+            }
+            s->length = length;
+            parser->checksum = checksum;
+            if (i == len) {
+                break;
+            }
+        }
+
+        if (nmea_feed(parser, data[i++])) {
+            *complete = true;
+            break;
+        }
+    }
+
+    return i;
+}
+
+// Field text and length, NULL when the field is missing or empty
+static const char *field_text(const nmea_sentence_t *s, int field, int *length)
+{
+    if (field < 0 || field >= s->field_count || s->field[field].length == 0) {
+        return NULL;
+    }
+    *length = s->field[field].length;
+    return &s->text[s->field[field].offset];
+}
+
+static inline bool is_digit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+static inline int digits2(const char *p)
+{
+    return (p[0] - '0') * 10 + (p[1] - '0');
+}
+
+bool nmea_is(const nmea_sentence_t *s, const char *formatter)
+{
+    // Address is talker (2) + formatter (3)
+    if (s->field_count == 0 || s->field[0].length != 5) {
+        return false;
+    }
+    const char *f = &s->text[s->field[0].offset + 2];
+    return f[0] == formatter[0] && f[1] == formatter[1] && f[2] == formatter[2];
+}
+
+char nmea_char(const nmea_sentence_t *s, int field)
+{
+    int length;
+    const char *p = field_text(s, field, &length);
+    return p ? p[0] : '\0';
+}
+
+bool nmea_int(const nmea_sentence_t *s, int field, int32_t *value)
+{
+    int length;
+    const char *p = field_text(s, field, &length);
+    if (!p || length > 9) {
+        return false;
+    }
+
+    int32_t v = 0;
+    for (int i = 0; i < length; i++) {
+        if (!is_digit(p[i])) {
+            return false;
+        }
+        v = v * 10 + (p[i] - '0');
+    }
+    *value = v;
+    return true;
+}
+
+bool nmea_fixed(const nmea_sentence_t *s, int field, int decimals, int32_t *value)
+{
+    int length;
+    const char *p = field_text(s, field, &length);
+    if (!p) {
+        return false;
+    }
+
+    int i = 0;
+    bool negative = (p[0] == '-');
+    if (negative) {
+        i++;
+    }
+
+    // Integer part, then up to 'decimals' fraction digits; the rest is truncated
+    int32_t v = 0;
+    int digits = 0;
+    int kept = -1;      // Fraction digits kept, -1 before the point
+    for (; i < length; i++) {
+        if (p[i] == '.' && kept < 0) {
+            kept = 0;
+            continue;
+        }
+        if (!is_digit(p[i])) {
+            return false;
+        }
+        if (kept < decimals) {
+            if (++digits > 9) {
+                return false;
+            }
+            v = v * 10 + (p[i] - '0');
+            if (kept >= 0) {
+                kept++;
+            }
+        }
+    }
+
+    // Pad missing fraction digits; at most nine digits fit in an int32
+    kept = (kept < 0) ? 0 : kept;
+    if (digits + decimals - kept > 9) {
+        return false;
+    }
+    for (; kept < decimals; kept++) {
+        v *= 10;
+    }
+
+    *value = negative ? -v : v;
+    return true;
+}
+
+bool nmea_coord(const nmea_sentence_t *s, int field, int32_t *deg_e7)
+{
+    int length;
+    const char *p = field_text(s, field, &length);
+    char hemisphere = nmea_char(s, field + 1);
+    if (!p) {
+        return false;
+    }
+
+    // Whole part "dddmm": at least three digits before the point
+    int i = 0;
+    int32_t whole = 0;
+    for (; i < length && is_digit(p[i]); i++) {
+        if (i >= 5) {
+            return false;
+        }
+        whole = whole * 10 + (p[i] - '0');
+    }
+    if (i < 3) {
+        return false;
+    }
+
+    // Fraction of minutes in units of 1e-7 minute
+    int32_t fraction = 0;
+    int32_t scale = 1000000;
+    if (i < length && p[i] == '.') {
+        for (i++; i < length; i++) {
+            if (!is_digit(p[i])) {
+                return false;
+            }
+            fraction += (p[i] - '0') * scale;
+            scale /= 10;
+        }
+    } else if (i < length) {
+        return false;
+    }
+
+    int32_t degrees = whole / 100;
+    int32_t minutes = whole % 100;
+    if (degrees > 180 || minutes >= 60) {
+        return false;
+    }
+
+    int32_t value = degrees * 10000000 + (minutes * 10000000 + fraction + 30) / 60;
+
+    switch (hemisphere) {
+    case 'N':
+    case 'E':
+        *deg_e7 = value;
+        return true;
+    case 'S':
+    case 'W':
+        *deg_e7 = -value;
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool nmea_time(const nmea_sentence_t *s, int field, int32_t *ms_of_day)
+{
+    int length;
+    const char *p = field_text(s, field, &length);
+    if (!p || length < 6) {
+        return false;
+    }
+    for (int i = 0; i < 6; i++) {
+        if (!is_digit(p[i])) {
+            return false;
+        }
+    }
+
+    int hours = digits2(p);
+    int minutes = digits2(p + 2);
+    int seconds = digits2(p + 4);
+    if (hours > 23 || minutes > 59 || seconds > 60) {
+        return false;
+    }
+
+    // Optional ".s", ".ss" or ".sss"
+    int32_t ms = 0;
+    if (length > 6) {
+        if (p[6] != '.' || length > 10) {
+            return false;
+        }
+        int32_t scale = 100;
+        for (int i = 7; i < length; i++) {
+            if (!is_digit(p[i])) {
+                return false;
+            }
+            ms += (p[i] - '0') * scale;
+            scale /= 10;
+        }
+    }
+
+    *ms_of_day = ((hours * 60 + minutes) * 60 + seconds) * 1000 + ms;
+    return true;
+}
+
+bool nmea_date(const nmea_sentence_t *s, int field, int *year, int *month, int *day)
+{
+    int length;
+    const char *p = field_text(s, field, &length);
+    if (!p || length != 6) {
+        return false;
+    }
+    for (int i = 0; i < 6; i++) {
+        if (!is_digit(p[i])) {
+            return false;
+        }
+    }
+
+    int d = digits2(p);
+    int m = digits2(p + 2);
+    if (d < 1 || d > 31 || m < 1 || m > 12) {
+        return false;
+    }
+
+    *day = d;
+    *month = m;
+    *year = 2000 + digits2(p + 4);
+    return true;
+}
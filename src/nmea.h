@@ -0,0 +1,146 @@
+/**
+ * @file nmea.h
+ * @brief Incremental NMEA 0183 tokenizer with checksum validation and fixed-point fields
+ *
+ * Bytes are fed from the UART callback, one at a time or a DMA block at a time.
+ * The tokenizer writes the sentence straight into a caller-provided nmea_sentence_t, XORs the checksum on
+ * the fly and records every field as an offset/length span into that text. A
+ * sentence is only reported once its "*hh" checksum matches. Field values are
+ * then read in place with integer routines: no strtok, strlen, atof or sscanf.
+ */
+
+#ifndef NMEA_H
+#define NMEA_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define NMEA_MAX_LENGTH     82          ///< Longest sentence, '$' to checksum (NMEA 0183)
+#define NMEA_MAX_FIELDS     24          ///< Address plus up to 23 data fields (GSV has 20)
+
+/**
+ * @brief One field as a span of the sentence text
+ */
+typedef struct {
+    uint8_t offset;                     ///< Offset of the first character in text[]
+    uint8_t length;                     ///< Number of characters (0 = empty field)
+} nmea_span_t;
+
+/**
+ * @brief A checksum-verified sentence
+ *
+ * text[] holds the sentence from '$' up to (excluding) '*', NUL-terminated.
+ * field[0] is the address ("GPRMC"), field[1] the first data field.
+ */
+typedef struct {
+    char text[NMEA_MAX_LENGTH + 1];
+    uint8_t length;
+    uint8_t field_count;
+    nmea_span_t field[NMEA_MAX_FIELDS];
+} nmea_sentence_t;
+
+/**
+ * @brief Tokenizer state
+ *
+ * sentence is the buffer the next sentence is written to. While it is NULL every
+ * sentence start is counted as dropped and skipped; the caller may point it at a
+ * new buffer whenever nmea_parser_idle() is true.
+ */
+typedef struct {
+    nmea_sentence_t *sentence;          ///< Output buffer (NULL = drop sentences)
+    uint8_t state;
+    uint8_t checksum;                   ///< Running XOR between '$' and '*'
+    uint8_t received;                   ///< Checksum digits received so far
+    uint32_t sentences;                 ///< Sentences with a valid checksum
+    uint32_t checksum_errors;           ///< Sentences with a checksum mismatch
+    uint32_t framing_errors;            ///< Too long, too many fields, bad characters
+    uint32_t dropped;                   ///< Sentences skipped for lack of a buffer
+} nmea_parser_t;
+
+/**
+ * @brief Reset the tokenizer and its counters
+ * @param parser Tokenizer
+ * @param sentence First output buffer (may be NULL)
+ */
+void nmea_parser_init(nmea_parser_t *parser, nmea_sentence_t *sentence);
+
+/**
+ * @brief Feed one received byte
+ * @param parser Tokenizer
+ * @param byte Received byte
+ * @return true when parser->sentence now holds a complete, checksum-valid sentence
+ */
+bool nmea_feed(nmea_parser_t *parser, uint8_t byte);
+
+/**
+ * @brief Feed a block of received bytes (e.g. a DMA buffer), stopping after a sentence
+ *
+ * Same result as nmea_feed() byte by byte, with a tight loop for the sentence body.
+ * @param parser Tokenizer
+ * @param data Received bytes
+ * @param len Number of bytes
+ * @param complete Set when parser->sentence holds a complete, checksum-valid sentence
+ * @return Number of bytes consumed; call again with the rest
+ */
+size_t nmea_feed_block(nmea_parser_t *parser, const uint8_t *data, size_t len, bool *complete);
+
+/**
+ * @brief True between sentences, when the output buffer may be swapped
+ */
+bool nmea_parser_idle(const nmea_parser_t *parser);
+
+/**
+ * @brief Abandon the sentence in progress (counted as a framing error)
+ *
+ * Used when another protocol (UBX) takes over the byte stream mid-sentence.
+ */
+void nmea_parser_abort(nmea_parser_t *parser);
+
+/**
+ * @brief Check the sentence formatter ("RMC"), ignoring the talker ID (GP, GN, GL...)
+ */
+bool nmea_is(const nmea_sentence_t *s, const char *formatter);
+
+/**
+ * @brief First character of a field, or 0 when the field is empty or missing
+ */
+char nmea_char(const nmea_sentence_t *s, int field);
+
+/**
+ * @brief Parse an unsigned decimal integer field
+ * @return false when the field is empty, missing or not a number
+ */
+bool nmea_int(const nmea_sentence_t *s, int field, int32_t *value);
+
+/**
+ * @brief Parse a decimal field as a fixed-point integer
+ * @param s Sentence
+ * @param field Field index
+ * @param decimals Digits kept after the point (e.g. 2 gives centimetres from metres)
+ * @param value Output, value * 10^decimals, truncated; a leading '-' is accepted
+ * @return false when the field is empty, missing or not a number
+ */
+bool nmea_fixed(const nmea_sentence_t *s, int field, int decimals, int32_t *value);
+
+/**
+ * @brief Parse a "ddmm.mmmm"/"dddmm.mmmm" coordinate and its hemisphere field
+ * @param s Sentence
+ * @param field Coordinate field index; field + 1 holds N/S/E/W
+ * @param deg_e7 Output in degrees * 1e7, negative for S and W
+ * @return false when either field is empty or malformed
+ */
+bool nmea_coord(const nmea_sentence_t *s, int field, int32_t *deg_e7);
+
+/**
+ * @brief Parse a "hhmmss.sss" time field
+ * @param ms_of_day Output in milliseconds since midnight
+ */
+bool nmea_time(const nmea_sentence_t *s, int field, int32_t *ms_of_day);
+
+/**
+ * @brief Parse a "ddmmyy" date field (years 2000-2099)
+ */
+bool nmea_date(const nmea_sentence_t *s, int field, int *year, int *month, int *day);
+
+#endif // NMEA_H
@@ -1,38 +1,47 @@
 #include "prayerTime.h"
 #include "font.h"
-#ifdef USE_NEO6M_GPS
-    #include "gps_neo6m.h"
-#else
-    #include "gps_neo7m.h"
-#endif
+#include "time_of_day.h"
+#include "hijri.h"
+#include "prayer_methods.h"
+#include "ephemeris.h"
+#include "gnss_core.h"
 #include <zephyr/kernel.h>
 #include <zephyr/drivers/display.h>
 #include <zephyr/drivers/gpio.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <math.h>
 
 // External variables from main.c
 extern double Lng, Lat, D;
 
-// Prayer time calculation constants
-// Sun altitude at Fajr and Isha
-float fajr_Angle = 18;
-float isha_Angle = 17;
-// Factor of shadow length at Asr
-float asr_Angle_factor = 1;
-// Sun's declination
-int TimeZone = 1;  // Default UTC+1, will be auto-configured from GPS
+// Calculation method (build-time default, see CMakeLists.txt) and Asr factor
+#ifndef PRAYER_DEFAULT_METHOD
+#define PRAYER_DEFAULT_METHOD PRAYER_METHOD_MWL
+#endif
+#ifdef USE_HANAFI_ASR
+#define PRAYER_DEFAULT_ASR PRAYER_ASR_HANAFI
+#else
+#define PRAYER_DEFAULT_ASR PRAYER_ASR_STANDARD
+#endif
+static prayer_method_id_t prayer_method = PRAYER_DEFAULT_METHOD;
+static prayer_asr_method_t prayer_asr = PRAYER_DEFAULT_ASR;
+
+// High-latitude rule (build-time default, see CMakeLists.txt)
+#ifndef PRAYER_DEFAULT_HIGH_LAT
+#define PRAYER_DEFAULT_HIGH_LAT PRAYER_HIGH_LAT_MIDDLE_OF_NIGHT
+#endif
+static prayer_high_lat_rule_t prayer_high_lat = PRAYER_DEFAULT_HIGH_LAT;
+
+double TimeZone = 1;  // Hours, default UTC+1, will be auto-configured from GPS
 
 // Need M_PI constant for calculations
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
 
-// Global variable to store current Julian Day
-static double current_JulianDay = 0.0;
-
-
-// Convert Gregorian date to Julian Day
+// Convert Gregorian date to Julian Day (no shared state: callable from any thread)
 double convert_Gregor_2_Julian_Day(float d, int m, int y) {
     if (m <= 2) {
         m = m + 12;
@@ -41,124 +50,14 @@ double convert_Gregor_2_Julian_Day(float d, int m, int y) {
     
     int A = (int)floor(y / 100.0);
     int B = 2 - A + (int)floor(A / 4.0);
-    current_JulianDay = floor(365.25 * (y + 4716)) + floor(30.6001 * (m + 1)) + d + B - 1524.5;
-    
-    return current_JulianDay;
+    return floor(365.25 * (y + 4716)) + floor(30.6001 * (m + 1)) + d + B - 1524.5;
 }
 
-// Convert Gregorian date to Hijri calendar
+// Convert Gregorian date to Hijri calendar (Umm al-Qura table, tabular outside its range)
 hijri_date_t convert_Gregor_2_Hijri_Date(float D, int M, int X, double JD) {
-    int Ba, w;
-    if(M < 3) {
-        M += 12;
-        X -= 1;
-    }
-
-    int a = (int)floor(X / 100.0);
-
-    if(JD < 2299161) {
-        Ba = (int)JD;
-    } else {
-        Ba = 2 - a + (int)floor(a / 4.0);
-    }
-
-    long b = (long)floor(365.25 * X) + (long)floor(30.6001 * (M + 1)) + (long)D + 1722519 + Ba;
-
-    long c = (long)floor((b - 122.1) / 365.25);
-    
-    if(M > 2) {
-        X = c - 4716;
-    } else if (M < 3) {
-        X = c - 4715;
-    }
-
-    long d = (long)floor(365.25 * c);
-
-    long e = (long)floor((b - d) / 30.6001);
-    
-    if (e < 14) {
-        M = (int)(e - 1);
-    } else if (e > 13) {
-        M = (int)(e - 13);
-    }
-
-    D = (float)(b - d - (long)floor(30.6001 * e));
-
-    int reminderOfDiv = X % 4;
-    if(reminderOfDiv == 0) {
-        w = 1;
-    } else {
-        w = 2;
-    }
-
-    int N = (int)floor((275 * M) / 9.0) - (int)floor((M + 9) / 12.0) * w + (int)D - 30;
-
-    int A = X - 623;
-    
-    int B = (int)floor(A / 4.0);
-
-    int C = A % 4;
-    
-    float C1 = 365.2501f * C;
-    
-    int C2 = (int)floor(C1);
-
-    float Co = C1 - C2;
-    
-    if(Co > 0.5f) {
-        C2 += 1;
-    }
-
-    uint64_t D1 = 1461 * (uint64_t)B + 170 + C2;
-    
-    int Q = (int)floor((double)D1 / 10631.0);
-    
-    int R = (int)(D1 % 10631);
-    
-    int J = (int)floor(R / 354.0);
+    (void)JD;  // Kept for API compatibility; the conversion works on the integer date
 
-    int K = R % 354;
-    
-    int O = (int)floor((11 * J + 14) / 30.0);
-    
-    int H = 30 * Q + J + 1;  // Hijri Year
-    
-    int JJ = K - O + N - 1;  // Day number in hijri year
-
-    // Handle leap year or common year
-    if(JJ > 354) {
-        int CL = H % 30;
-        
-        float DL = (float)((11 * CL + 3) % 30);
-        
-        if(DL < 19) {
-            JJ -= 354;
-            H += 1;
-        } else if(DL > 18) {
-            JJ -= 355;
-            H += 1;
-        }
-    } else if(JJ == 0) {
-        JJ = 355;
-        H -= 1;
-    }
-
-    // Convert day of year to day and month
-    int S = (int)floor((JJ - 1) / 29.5);
-    
-    int month_Hijri = 1 + S;
-    int day_Hijri = (int)floor(JJ - (29.5 * S));
-    
-    printk("Hijri Date: %d/%d/%d\n", day_Hijri, month_Hijri, H);
-    
-    // Create and return the complete Hijri date structure
-    hijri_date_t hijri_date = {
-        .day = day_Hijri,
-        .month = month_Hijri,
-        .year = H
-    };
-    
-    return hijri_date;
+    return hijri_from_days(tod_days_from_civil(X, M, (int)D));
 }
 
 // Calculate day of the week from Julian Day
@@ -386,13 +285,12 @@ void prayer_time_print_hijri_date(const struct device *display_dev, int16_t x, i
 
 // Astronomical calculation functions for prayer times
 
-double degreeCorrected(long x) {
-    x = x % 360;
+double degreeCorrected(double x) {
+    x = fmod(x, 360.0);
     if (x < 0) {
-        x += 360;
+        x += 360.0;
     }
-    printk("degreeCorrected: %ld\n", x);
-    return (double)x;
+    return x;
 }
 
 double Degree_2_Radian(long double Degrees) {
@@ -405,138 +303,34 @@ double Radian_2_Degree(double Rad) {
     return degree;
 }
 
-double twilligt(double winkel) {
-    double twilligt_val = acos((-sin(Degree_2_Radian(winkel)) - (sin(D) * sin(Degree_2_Radian(Lat)))) / 
-                              (cos(D) * cos(Degree_2_Radian(Lat)))) / Degree_2_Radian(15);
-    
-    if (isnan(twilligt_val)) {
-        double twilligt_45 = acos((-sin(Degree_2_Radian(winkel)) - (sin(D) * sin(Degree_2_Radian(45)))) / 
-                                 (cos(D) * cos(Degree_2_Radian(45)))) / Degree_2_Radian(15);
-        return twilligt_45;
-    } else {
-        return twilligt_val;
-    }
-}
-
-double calc_asrAngle(int factor) {
-    long double acot = (M_PI / 2.0) - atan((double)factor + tan(Degree_2_Radian(Lat) - D));
-    double angle = acos(sin(acot - sin(Degree_2_Radian(Lat)) * sin(D)) / 
-                       (cos(Degree_2_Radian(Lat)) * cos(D))) / Degree_2_Radian(15);
-    return angle;
-}
-
-double calc_altitude(void) {
-    // Use current GPS seeHeight if available, otherwise use default value
-    double altitude_in_meter = 0.0;  // Default sea level
-    
-    if (current_gps.seeHeight_valid) {
-        altitude_in_meter = current_gps.seeHeight;
-        // Convert to integer representation for printk
-        int alt_int = (int)altitude_in_meter;
-        int alt_frac = (int)((altitude_in_meter - alt_int) * 10);
-        printk("Using GPS altitude: %d.%d meters\n", alt_int, alt_frac);
-    } else {
-        printk("GPS altitude not available, using sea level (0m)\n");
-    }
-    
-    double altitude_correction = (-2.076 * sqrt(altitude_in_meter)) / 60.0;
-    // Convert to integer representation for printk
-    int corr_int = (int)(altitude_correction * 1000);
-    printk("Altitude correction: %d.%03d degrees\n", corr_int / 1000, abs(corr_int % 1000));
-    return altitude_correction;
-}
-
-prayer_myFloats_t prayerStruct(void) {
+prayer_myFloats_t prayerStruct(double JD) {
     prayer_myFloats_t localStruct;
     
-    // Get current Julian Day
-    double JD = current_JulianDay;
     // Convert to integer representation for printk
     int jd_int = (int)JD;
     int jd_frac = (int)((JD - jd_int) * 1000000);
     printk("JulianDay: %d.%06d\n", jd_int, jd_frac);
     
-    // The time interval in julian centuries  
-    double T = (JD - 2451545)/36525;
-    
-    // Mean longitudes of sun L
-    double L = 280.4665 + (T * 36000.7698);
-    
-    // Mean longitudes of Moon L'
-    double L_Strich = 218.3165 + (T * 481267.8813);
-    
-    // Lng of ascending node of Moon Ω
-    double L_n = (125.04452 - (T*1934.136261) + (pow(T,2)*0.0020708) + (pow(T,3)/450000));
-    
-    // delta ψ
-    double delta_W = (-0.0047*sin(L_n)) - (-0.00036*sin(2*L)) - (0.0000638*sin(2*L_Strich)) + (0.0000583*sin(2*L_n));
-    
-    // delta ε
-    double delta_E = (0.0025*cos(L_n)) + (0.0001583*cos(2*L)) - (0.000027*cos(2*L_Strich)) - (0.00025*cos(2*L_n));
-    
-    // ε° The mean obliquity of the ecliptics
-    double Eo = 23.43929111 - (T*0.01300416667) + (pow(T,2)*0.0000001638) + (pow(T,3)*0.00000050361);
-    
-    // Obliquity of the ecliptic
-    double E = delta_E + Eo;
-    
-    // Time measured in julian millennia
-    double r = (JD - 2451545)/365250;
-    
-    // Sun's mean longitude
-    double Lo = 280.4664567 + (r*360007.6982779) + (pow(r,2)*0.03032028) + (pow(r,3)/49931) - (pow(r,4)/15300) - (pow(r,5)/2000000);
-    Lo = degreeCorrected((long)Lo);
-    
-    // Anomaly of the sun M, sun position
-    double M = 357.52911 + (35999.05029*T) - ((0.0001537*pow(T,2)));
-    M = degreeCorrected((long)M);
-    
-    // Eccentricity e of the Earth's orbit
-    double e = 0.016708634 - (0.000042037*T) - (0.0000001267*pow(T,2));
-    
-    // The sun's equation of center C
-    double C = ((1.914602 - (0.004817*T) - 0.000014*pow(T, 2))*sin(Degree_2_Radian(M))) + 
-               ((0.019993 - 0.000101*T)*sin(2*Degree_2_Radian(M))) + 
-               ((0.000289*sin(3*Degree_2_Radian(M))));
-    
-    // Sun True Longitude
-    double sun_True_Lng = (Lo + C);
-    
-    // Sun's right ascension
-    double a = atan2((cos(Degree_2_Radian(E))*sin(Degree_2_Radian(sun_True_Lng))), cos(Degree_2_Radian(sun_True_Lng)));
-    a = Radian_2_Degree(a);
-    
-    if (a < 0) {
-        a = (long)a % 360;
-    }
-    
+    // Sun position at approximate local noon from the build-time ephemeris backend
+    ephemeris_sun_t sun;
+    EPHEMERIS_BACKEND->sun(JD + 0.5 - Lng / 360.0, &sun);
+
     // Sun's declination
-    D = asin(sin(Degree_2_Radian(E))*sin(Degree_2_Radian(sun_True_Lng)));
-    
-    // The mean sidereal time at Greenwich θ°
-    double sideReal_Time = 280.46061837 + (360.98564736629*(JD - 2451545.0)) + (pow(T,2)*0.000387933) - (pow(T,3)/38710000);
-    sideReal_Time = (long)sideReal_Time % 360;
-    if(sideReal_Time < 0) {
-        sideReal_Time += 360;
-    }
-    
-    // Equation of time
-    double EqT = Lo - 0.0057183 - a + (double)(delta_W*cos(E));
-    // Convert to integer for printk
-    int eqt_int = (int)(EqT * 1000000);
-    printk("equation of time: %d.%06d\n", eqt_int / 1000000, abs(eqt_int % 1000000));
-    
-    double EqT_to_min = EqT/15;
-    int eqt_min_int = (int)(EqT_to_min * 1000000);
-    printk("equation of time in min: %d.%06d\n", eqt_min_int / 1000000, abs(eqt_min_int % 1000000));
+    D = sun.declination;
+
+    // Equation of time in hours
+    double EqT_to_min = sun.equation_of_time / 60.0;
+    int eqt_int = (int)(sun.equation_of_time * 1000);
+    printk("equation of time (%s): %d.%03d min\n", EPHEMERIS_BACKEND->name,
+           eqt_int / 1000, abs(eqt_int % 1000));
 
     // Debug: Show timezone being used for prayer calculations
     printk("\n[PRAYER CALC] ===== PRAYER TIME CALCULATION =====\n");
-    printk("[PRAYER CALC] Using TimeZone: UTC%+d\n", TimeZone);
+    printk("[PRAYER CALC] Using TimeZone: UTC%+.2f\n", TimeZone);
     printk("[PRAYER CALC] Longitude: %.6f\n", Lng);
     printk("[PRAYER CALC] Latitude: %.6f\n", Lat);
     printk("[PRAYER CALC] Formula: Dhuhr = 12 + TimeZone - (Lng/15) - EqT_to_min\n");
-    printk("[PRAYER CALC] Dhuhr = 12 + %d - (%.6f/15) - %.6f\n", TimeZone, Lng, EqT_to_min);
+    printk("[PRAYER CALC] Dhuhr = 12 + %.2f - (%.6f/15) - %.6f\n", TimeZone, Lng, EqT_to_min);
 
     // The 5 Prayers and sunrise and sunset
     double Dhuhr = 12 + TimeZone - (Lng/15) - EqT_to_min;
@@ -547,28 +341,29 @@ prayer_myFloats_t prayerStruct(void) {
     int lng_int = (int)(Lng * 1000000);
     printk("Lng: %d.%06d\n", lng_int / 1000000, abs(lng_int % 1000000));
     
-    // Get altitude correction
-    double alt_correction = calc_altitude();
-    
-    double Sunrise = Dhuhr - twilligt(0.833 - (-1)*alt_correction);
-    int sunrise_int = (int)(Sunrise * 1000);
-    
-    double Sunset = Dhuhr + twilligt(0.833 + (-1)*alt_correction);
-    int sunset_int = (int)(Sunset * 1000);
-    
-    double Asr = Dhuhr + calc_asrAngle(asr_Angle_factor);
-    int asr_int = (int)(Asr * 1000);
-    
-    // Maghrib = Sunset
-    double Magrib = Sunset;
-    int magrib_int = (int)(Magrib * 1000);
-    
-    double Ishaa = Dhuhr + twilligt(isha_Angle);
-    int ishaa_int = (int)(Ishaa * 1000);
-    
-    double Fajr = Dhuhr - twilligt(fajr_Angle);
-    int fajr_int = (int)(Fajr * 1000);
-    
+    // Fold latitude, declination and the method's angles into the day's terms once
+    struct gps_data gps;
+    gps_snapshot(&gps);
+    double elevation = gps.seeHeight_valid ? gps.seeHeight : 0.0;
+    prayer_day_terms_t day_terms;
+    prayer_day_terms_init(&day_terms, prayer_method, prayer_asr, Lat, D, elevation);
+    printk("[PRAYER CALC] Method: %s, Asr: %s, elevation: %d m\n", prayer_methods[prayer_method].name,
+           prayer_asr == PRAYER_ASR_HANAFI ? "Hanafi" : "Standard", (int)elevation);
+
+    // All events from the day's terms; high-latitude rules reuse sunrise/sunset (no extra trig)
+    prayer_day_offsets_t offsets;
+    int adjusted = prayer_day_offsets(&day_terms, prayer_high_lat, &offsets);
+    if (adjusted > 0) {
+        printk("[PRAYER CALC] High-latitude rule adjusted %d event(s)\n", adjusted);
+    }
+
+    double Sunrise = Dhuhr - offsets.sunrise;
+    double Sunset = Dhuhr + offsets.sunset;
+    double Asr = Dhuhr + offsets.asr;
+    double Magrib = Dhuhr + offsets.maghrib;
+    double Ishaa = Dhuhr + offsets.isha;
+    double Fajr = Dhuhr - offsets.fajr;
+
     // Fill the struct
     localStruct.Dhuhur = Dhuhr;
     localStruct.Assr = Asr;
@@ -591,40 +386,28 @@ prayer_myFloats_t prayerStruct(void) {
     return localStruct;
 }
 
+// Convert calculated prayer times to seconds since local midnight (display order)
+void prayer_times_to_sod(const prayer_myFloats_t* prayers, int32_t sod[PRAYER_TIMES_COUNT])
+{
+    sod[0] = tod_from_hours(prayers->fajjir);    // 0: Fajr
+    sod[1] = tod_from_hours(prayers->sunRise);   // 1: Shuruq (Sunrise)
+    sod[2] = tod_from_hours(prayers->Dhuhur);    // 2: Dhuhr
+    sod[3] = tod_from_hours(prayers->Assr);      // 3: Asr
+    sod[4] = tod_from_hours(prayers->Maghreb);   // 4: Maghrib
+    sod[5] = tod_from_hours(prayers->Ishaa);     // 5: Isha
+}
+
 // Function to determine next prayer based on current time
 // Returns prayer index (0=Fajr, 1=Shuruq, 2=Dhuhr, 3=Asr, 4=Maghrib, 5=Isha)
-int get_next_prayer_index(const char* current_time, const prayer_myFloats_t* prayers)
+int get_next_prayer_index(int32_t current_sod, const int32_t prayer_sod[PRAYER_TIMES_COUNT])
 {
-    if (!current_time || !prayers) {
+    if (current_sod < 0 || !prayer_sod) {
         return 3; // Default to Asr if invalid input
     }
 
-    // Parse current time (format: "HH:MM:SS" or "HH:MM")
-    int current_hour = 0, current_min = 0;
-    if (sscanf(current_time, "%d:%d", &current_hour, &current_min) < 2) {
-        return 3; // Default to Asr if parsing fails
-    }
-
-    // Convert current time to decimal hours
-    double current_time_decimal = current_hour + (current_min / 60.0);
-
-    // Prayer times in order: Fajr, Sunrise, Dhuhr, Asr, Maghrib, Isha
-    double prayer_times[6] = {
-        prayers->fajjir,    // 0: Fajr
-        prayers->sunRise,   // 1: Shuruq (Sunrise)
-        prayers->Dhuhur,    // 2: Dhuhr
-        prayers->Assr,      // 3: Asr
-        prayers->Maghreb,   // 4: Maghrib
-        prayers->Ishaa      // 5: Isha
-    };
-
     // Find next prayer after current time
-    for (int i = 0; i < 6; i++) {
-        // Ensure prayer times are within 24 hours
-        while (prayer_times[i] < 0) prayer_times[i] += 24;
-        while (prayer_times[i] >= 24) prayer_times[i] -= 24;
-
-        if (current_time_decimal < prayer_times[i]) {
+    for (int i = 0; i < PRAYER_TIMES_COUNT; i++) {
+        if (current_sod < prayer_sod[i]) {
             return i; // Return index of next prayer
         }
     }
@@ -665,13 +448,51 @@ void Pray_Athan(void) {
     #endif
 }
 
-void prayer_set_timezone(int timezone_offset)
+void prayer_set_timezone(double timezone_offset)
 {
     TimeZone = timezone_offset;
-    printk("[PRAYER] Timezone set to UTC%+d for prayer calculations\n", TimeZone);
+    printk("[PRAYER] Timezone set to UTC%+.2f for prayer calculations\n", TimeZone);
 }
 
-int prayer_get_timezone(void)
+double prayer_get_timezone(void)
 {
     return TimeZone;
-}
\ No newline at end of file
+}
+
+void prayer_set_method(prayer_method_id_t method)
+{
+    if (method < PRAYER_METHOD_COUNT) {
+        prayer_method = method;
+        printk("[PRAYER] Calculation method set to %s\n", prayer_methods[method].name);
+    }
+}
+
+prayer_method_id_t prayer_get_method(void)
+{
+    return prayer_method;
+}
+
+void prayer_set_asr_method(prayer_asr_method_t asr)
+{
+    // The value is the shadow factor itself, so anything else would be used as one
+    if (asr == PRAYER_ASR_STANDARD || asr == PRAYER_ASR_HANAFI) {
+        prayer_asr = asr;
+    }
+}
+
+prayer_asr_method_t prayer_get_asr_method(void)
+{
+    return prayer_asr;
+}
+
+void prayer_set_high_lat_rule(prayer_high_lat_rule_t rule)
+{
+    if (rule < PRAYER_HIGH_LAT_COUNT) {
+        prayer_high_lat = rule;
+    }
+}
+
+prayer_high_lat_rule_t prayer_get_high_lat_rule(void)
+{
+    return prayer_high_lat;
+}
@@ -3,6 +3,7 @@
 
 #include <stdint.h>
 #include <zephyr/device.h>
+#include "prayer_methods.h"
 
 // Structure to hold complete Hijri date
 typedef struct {
@@ -25,8 +26,8 @@ typedef struct {
 // Function to convert Gregorian date to Julian Day
 double convert_Gregor_2_Julian_Day(float d, int m, int y);
 
-// Function to convert Gregorian date to Hijri calendar
-// Parameters: D=Day, M=Month, X=Year, JD=Julian Day
+// Function to convert Gregorian date to Hijri calendar (see hijri.h)
+// Parameters: D=Day, M=Month, X=Year, JD=Julian Day (unused)
 // Returns: Complete Hijri date structure (day, month, year)
 hijri_date_t convert_Gregor_2_Hijri_Date(float D, int M, int X, double JD);
 
@@ -36,12 +37,9 @@ hijri_date_t convert_Gregor_2_Hijri_Date(float D, int M, int X, double JD);
 const char* day_Of_Weak(double JD);
 
 // Astronomical calculation functions for prayer times
-double degreeCorrected(long x);
+double degreeCorrected(double x);     // Reduce to 0-360 degrees, keeping the fraction
 double Degree_2_Radian(long double Degrees);
 double Radian_2_Degree(double Rad);
-double twilligt(double winkel);
-double calc_asrAngle(int factor);
-double calc_altitude(void);
 
 // Function to print current date and time
 void prayer_time_print_datetime(const struct device *display_dev, int16_t x, int16_t y, uint16_t text_color, uint16_t bg_color);
@@ -55,19 +53,45 @@ void prayer_time_draw_character(const struct device *display_dev, char c, int16_
 // Function to display Hijri date with day of week
 void prayer_time_print_hijri_date(const struct device *display_dev, int16_t x, int16_t y, hijri_date_t hijri_date, const char* day_name, uint16_t text_color, uint16_t bg_color);
 
-// Function to calculate all prayer times
-prayer_myFloats_t prayerStruct(void);
+// Function to calculate all prayer times for a Julian Day at 0h UT
+// (from convert_Gregor_2_Julian_Day())
+prayer_myFloats_t prayerStruct(double JD);
 
-// Function to determine next prayer based on current time
-int get_next_prayer_index(const char* current_time, const prayer_myFloats_t* prayers);
+// Number of daily times in display order (Fajr, Shuruq, Dhuhr, Asr, Maghrib, Isha)
+#define PRAYER_TIMES_COUNT 6
+
+// Convert calculated prayer times to seconds since local midnight in display order,
+// rounded to the nearest minute
+void prayer_times_to_sod(const prayer_myFloats_t* prayers, int32_t sod[PRAYER_TIMES_COUNT]);
+
+// Function to determine next prayer based on current time (seconds since local midnight)
+int get_next_prayer_index(int32_t current_sod, const int32_t prayer_sod[PRAYER_TIMES_COUNT]);
 
 // Function to blink LED1 for 1 minute at prayer time
 void Pray_Athan(void);
 
-// Function to set timezone offset for prayer calculations
-void prayer_set_timezone(int timezone_offset);
+// Function to set timezone offset for prayer calculations (hours, e.g. 5.5 for UTC+5:30)
+void prayer_set_timezone(double timezone_offset);
 
 // Function to get current timezone offset used for prayer calculations
-int prayer_get_timezone(void);
+double prayer_get_timezone(void);
+
+// Select the calculation method (takes effect at the next prayerStruct() call)
+void prayer_set_method(prayer_method_id_t method);
+
+// Get the current calculation method
+prayer_method_id_t prayer_get_method(void);
+
+// Select the Asr shadow factor (standard or Hanafi; other values are ignored)
+void prayer_set_asr_method(prayer_asr_method_t asr);
+
+// Get the current Asr shadow factor
+prayer_asr_method_t prayer_get_asr_method(void);
+
+// Select the high-latitude rule for Fajr, Isha and angle-based Maghrib
+void prayer_set_high_lat_rule(prayer_high_lat_rule_t rule);
+
+// Get the current high-latitude rule
+prayer_high_lat_rule_t prayer_get_high_lat_rule(void);
 
 #endif // PRAYER_TIME_H
\ No newline at end of file
@@ -0,0 +1,212 @@
+/**
+ * @file prayer_batch.c
+ * @brief Batch prayer time computation over structure-of-arrays city tables
+ */
+
+#include "prayer_batch.h"
+#include "ephemeris.h"
+#include "time_of_day.h"
+#include "world_cities.h"
+#include "tz_rules.h"
+#include <zephyr/kernel.h>
+#include <math.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define DEG2RADF        ((float)(M_PI / 180.0))
+#define RAD2HOURSF      ((float)(12.0 / M_PI))
+
+// Cities per chunk: 9 float arrays of this size stay on the stack (~1.1 KB)
+#define BATCH_CHUNK 32
+
+static float night_portion(prayer_high_lat_rule_t rule, float angle)
+{
+    switch (rule) {
+    case PRAYER_HIGH_LAT_ONE_SEVENTH:
+        return 1.0f / 7.0f;
+    case PRAYER_HIGH_LAT_ANGLE_BASED:
+        return angle / 60.0f;
+    case PRAYER_HIGH_LAT_MIDDLE_OF_NIGHT:
+    default:
+        return 0.5f;
+    }
+}
+
+void prayer_batch_day_init(prayer_batch_day_t *day, double jd_ut, prayer_method_id_t method,
+                           prayer_asr_method_t asr, prayer_high_lat_rule_t rule)
+{
+    if (method >= PRAYER_METHOD_COUNT) {
+        method = PRAYER_METHOD_MWL;
+    }
+    const prayer_method_t *m = &prayer_methods[method];
+
+    // Solar position at 12h UT plus its rate, so each city can move to its local noon
+    ephemeris_sun_t sun, before, after;
+    EPHEMERIS_BACKEND->sun(jd_ut + 0.5, &sun);
+    EPHEMERIS_BACKEND->sun(jd_ut, &before);
+    EPHEMERIS_BACKEND->sun(jd_ut + 1.0, &after);
+
+    // Local noon is longitude/360 of a day earlier per degree east
+    day->sin_dec = (float)sin(sun.declination);
+    day->cos_dec = (float)cos(sun.declination);
+    day->dec_per_deg = (float)(-(after.declination - before.declination) / 360.0);
+    day->eqt_hours = (float)(sun.equation_of_time / 60.0);
+    day->eqt_per_deg = (float)(-(after.equation_of_time - before.equation_of_time) / (360.0 * 60.0));
+    day->sin_sunrise = sinf(-0.833f * DEG2RADF);
+    day->sin_fajr = sinf(-m->fajr_angle * DEG2RADF);
+    day->sin_isha = sinf(-m->isha_angle * DEG2RADF);
+    day->sin_maghrib = sinf(-m->maghrib_angle * DEG2RADF);
+    day->asr_factor = (float)asr;
+    day->date_ordinal = (int32_t)floor(jd_ut - 2451544.5 + 0.5);
+    day->isha_offset_hours = m->isha_minutes / 60.0f;
+    day->fajr_portion = night_portion(rule, m->fajr_angle);
+    day->isha_portion = night_portion(rule, m->isha_angle);
+    day->maghrib_portion = night_portion(rule, m->maghrib_angle);
+    day->maghrib_at_sunset = (m->maghrib_angle == 0.0f);
+}
+
+static inline float clampf(float x)
+{
+    return (x < -1.0f) ? -1.0f : (x > 1.0f) ? 1.0f : x;
+}
+
+// Hours from noon for an altitude, capped at limit when later or never reached
+static inline float twilight_hours(float cos_h, float limit)
+{
+    float hours = acosf(clampf(cos_h)) * RAD2HOURSF;
+    bool unreachable = (cos_h < -1.0f) || (cos_h > 1.0f);
+    return (unreachable || hours > limit) ? limit : hours;
+}
+
+// Per-city kernel: SoA in, SoA out (local decimal hours), no city-dependent branches
+static void batch_kernel(const prayer_batch_day_t *day, const float *restrict latitude,
+                         const float *restrict longitude, const float *restrict tz_hours, int n,
+                         float *restrict fajr, float *restrict sunrise, float *restrict dhuhr,
+                         float *restrict asr, float *restrict maghrib, float *restrict isha)
+{
+    // Local copy keeps the per-day loads out of the loop
+    const prayer_batch_day_t d = *day;
+
+    // Per-day choices as blend weights: a select on a scalar flag does not vectorise
+    const float at_sunset = d.maghrib_at_sunset ? 1.0f : 0.0f;
+    const float fixed_isha = (d.isha_offset_hours > 0.0f) ? 1.0f : 0.0f;
+
+    for (int i = 0; i < n; i++) {
+        float phi = latitude[i] * DEG2RADF;
+        float sp = sinf(phi);
+        float cp = sqrtf(1.0f - sp * sp);   // |latitude| <= 90: no second trig call
+
+        // Declination at local noon: a shift below 0.25 degrees, first order is enough
+        float shift = d.dec_per_deg * longitude[i];
+        float sd = d.sin_dec + d.cos_dec * shift;
+        float cd = d.cos_dec - d.sin_dec * shift;
+        float a = sp * sd;
+        float inv_b = 1.0f / (cp * cd);
+
+        float eqt = d.eqt_hours + d.eqt_per_deg * longitude[i];
+        float noon = 12.0f + tz_hours[i] - longitude[i] / 15.0f - eqt;
+
+        // Sunrise/sunset, clamped to polar day and night
+        float half_day = acosf(clampf((d.sin_sunrise - a) * inv_b)) * RAD2HOURSF;
+        float night = 24.0f - 2.0f * half_day;
+
+        // Asr altitude: sin(acot(x)) = sign(x) / sqrt(1 + x^2) with x = f + tan|phi - dec|
+        float tan_zenith = fabsf(sp * cd - cp * sd) / (cp * cd + sp * sd);
+        float x = d.asr_factor + tan_zenith;
+        float sin_asr = copysignf(1.0f / sqrtf(1.0f + x * x), x);
+        float asr_h = twilight_hours((sin_asr - a) * inv_b, half_day);
+
+        float fajr_h = twilight_hours((d.sin_fajr - a) * inv_b, half_day + d.fajr_portion * night);
+        float maghrib_h = twilight_hours((d.sin_maghrib - a) * inv_b,
+                                         half_day + d.maghrib_portion * night);
+        maghrib_h += at_sunset * (half_day - maghrib_h);
+
+        float isha_fixed = fminf(maghrib_h + d.isha_offset_hours, half_day + 0.5f * night);
+        float isha_h = twilight_hours((d.sin_isha - a) * inv_b, half_day + d.isha_portion * night);
+        isha_h += fixed_isha * (isha_fixed - isha_h);
+
+        fajr[i] = noon - fajr_h;
+        sunrise[i] = noon - half_day;
+        dhuhr[i] = noon;
+        asr[i] = noon + asr_h;
+        maghrib[i] = noon + maghrib_h;
+        isha[i] = noon + isha_h;
+    }
+}
+
+// Decimal hours to seconds since local midnight, rounded to the minute
+static inline int32_t hours_to_sod(float hours)
+{
+    return tod_wrap((int32_t)lrintf(hours * 60.0f) * 60);
+}
+
+static void store_chunk(float hours[PRAYER_TIMES_COUNT][BATCH_CHUNK], int n,
+                        int32_t *const sod[PRAYER_TIMES_COUNT], int offset)
+{
+    for (int e = 0; e < PRAYER_TIMES_COUNT; e++) {
+        for (int i = 0; i < n; i++) {
+            sod[e][offset + i] = hours_to_sod(hours[e][i]);
+        }
+    }
+}
+
+void prayer_batch_compute(const prayer_batch_day_t *day, const float *latitude,
+                          const float *longitude, const float *tz_hours, int count,
+                          int32_t *const sod[PRAYER_TIMES_COUNT])
+{
+    float hours[PRAYER_TIMES_COUNT][BATCH_CHUNK];
+
+    for (int done = 0; done < count; done += BATCH_CHUNK) {
+        int n = MIN(BATCH_CHUNK, count - done);
+        batch_kernel(day, latitude + done, longitude + done, tz_hours + done, n,
+                     hours[0], hours[1], hours[2], hours[3], hours[4], hours[5]);
+        store_chunk(hours, n, sod, done);
+    }
+}
+
+int prayer_batch_world_cities(const prayer_batch_day_t *day, int first, int count,
+                              int32_t *const sod[PRAYER_TIMES_COUNT])
+{
+    int total = get_total_cities_count();
+    if (first < 0 || first >= total) {
+        return 0;
+    }
+    count = MIN(count, total - first);
+
+    float latitude[BATCH_CHUNK];
+    float longitude[BATCH_CHUNK];
+    float tz_hours[BATCH_CHUNK];
+    float hours[PRAYER_TIMES_COUNT][BATCH_CHUNK];
+
+    // Each zone's transitions are expanded once per year, then looked up per city
+    static tz_year_t zone_years[TZ_ZONE_COUNT];
+    int32_t noon_utc = day->date_ordinal * TOD_SECONDS_PER_DAY + TOD_SECONDS_PER_DAY / 2;
+    int year, month, mday;
+    tod_civil_from_days(day->date_ordinal, &year, &month, &mday);
+
+    for (int done = 0; done < count; done += BATCH_CHUNK) {
+        int n = MIN(BATCH_CHUNK, count - done);
+
+        // Gather the chunk from the city table into SoA
+        for (int i = 0; i < n; i++) {
+            city_data_t city;
+            get_city_by_index(first + done + i, &city);
+            tz_year_t *tz = &zone_years[city.tz];
+
+            if (tz->year != year) {
+                tz_year_expand(tz, city.tz, year);
+            }
+            latitude[i] = (float)city.latitude;
+            longitude[i] = (float)city.longitude;
+            tz_hours[i] = (float)tz_offset_min(tz, noon_utc) / 60.0f;
+        }
+
+        batch_kernel(day, latitude, longitude, tz_hours, n,
+                     hours[0], hours[1], hours[2], hours[3], hours[4], hours[5]);
+        store_chunk(hours, n, sod, done);
+    }
+
+    return count;
+}
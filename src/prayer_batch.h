@@ -0,0 +1,80 @@
+/**
+ * @file prayer_batch.h
+ * @brief Batch prayer time computation for many cities at once
+ *
+ * For a "world view" or a mosque network, today's times are needed for many
+ * locations. The solar terms (declination, equation of time) and the method's
+ * angle sines are the same for every city, so they are computed once per day in
+ * prayer_batch_day_init(); each city only shifts them linearly to its own local
+ * noon. The per-city kernel then runs over structure-of-arrays
+ * inputs in single precision: one sinf() of the latitude, five acosf() and
+ * selects instead of city-dependent branches, so it vectorises on the host and
+ * streams through small stack chunks on the MCU.
+ */
+
+#ifndef PRAYER_BATCH_H
+#define PRAYER_BATCH_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "prayerTime.h"
+
+/**
+ * @brief Per-day terms shared by every city
+ */
+typedef struct {
+    float sin_dec;              ///< sin(declination) at 12h UT
+    float cos_dec;              ///< cos(declination) at 12h UT
+    float dec_per_deg;          ///< Declination change per degree east (radians)
+    float eqt_hours;            ///< Equation of time at 12h UT (hours)
+    float eqt_per_deg;          ///< Equation of time change per degree east (hours)
+    float sin_sunrise;          ///< sin of the sunrise/sunset altitude (sea level)
+    float sin_fajr;             ///< sin of the Fajr altitude
+    float sin_isha;             ///< sin of the Isha altitude
+    float sin_maghrib;          ///< sin of the Maghrib altitude
+    float asr_factor;           ///< Asr shadow factor (1 or 2)
+    float isha_offset_hours;    ///< Fixed Isha interval, 0 when angle based
+    float fajr_portion;         ///< High-latitude night portions
+    float isha_portion;
+    float maghrib_portion;
+    bool maghrib_at_sunset;     ///< Maghrib equals sunset
+    int32_t date_ordinal;       ///< UTC date as days since 2000-01-01 (city DST)
+} prayer_batch_day_t;
+
+/**
+ * @brief Compute the shared terms of one day
+ * @param day Output terms
+ * @param jd_ut Julian Day at 0h UT of the date
+ * @param method Calculation method
+ * @param asr Asr shadow factor
+ * @param rule High-latitude rule
+ */
+void prayer_batch_day_init(prayer_batch_day_t *day, double jd_ut, prayer_method_id_t method,
+                           prayer_asr_method_t asr, prayer_high_lat_rule_t rule);
+
+/**
+ * @brief Compute today's times for a set of cities given as arrays
+ * @param day Shared terms from prayer_batch_day_init()
+ * @param latitude Latitudes in degrees
+ * @param longitude Longitudes in degrees (east positive)
+ * @param tz_hours UTC offsets in hours
+ * @param count Number of cities
+ * @param sod Output: PRAYER_TIMES_COUNT arrays of count entries, seconds since
+ *            local midnight in display order (Fajr, Shuruq, Dhuhr, Asr, Maghrib, Isha)
+ */
+void prayer_batch_compute(const prayer_batch_day_t *day, const float *latitude,
+                          const float *longitude, const float *tz_hours, int count,
+                          int32_t *const sod[PRAYER_TIMES_COUNT]);
+
+/**
+ * @brief Compute today's times for a range of city table entries (world_cities.h)
+ * @param day Shared terms from prayer_batch_day_init()
+ * @param first Index of the first city
+ * @param count Number of cities
+ * @param sod Output arrays as for prayer_batch_compute()
+ * @return Number of cities computed (clipped to the table size)
+ */
+int prayer_batch_world_cities(const prayer_batch_day_t *day, int first, int count,
+                              int32_t *const sod[PRAYER_TIMES_COUNT]);
+
+#endif // PRAYER_BATCH_H
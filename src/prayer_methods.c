@@ -0,0 +1,158 @@
+/**
+ * @file prayer_methods.c
+ * @brief Prayer time calculation method tables and per-day invariants
+ */
+
+#include "prayer_methods.h"
+#include <math.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define DEG2RAD(x) ((x) * (M_PI / 180.0))
+
+const prayer_method_t prayer_methods[PRAYER_METHOD_COUNT] = {
+    [PRAYER_METHOD_MWL]         = { "MWL",      18.0f, 17.0f,  0, 0.0f },
+    [PRAYER_METHOD_ISNA]        = { "ISNA",     15.0f, 15.0f,  0, 0.0f },
+    [PRAYER_METHOD_EGYPTIAN]    = { "Egypt",    19.5f, 17.5f,  0, 0.0f },
+    [PRAYER_METHOD_UMM_AL_QURA] = { "Makkah",   18.5f,  0.0f, 90, 0.0f },
+    [PRAYER_METHOD_KARACHI]     = { "Karachi",  18.0f, 18.0f,  0, 0.0f },
+    [PRAYER_METHOD_TEHRAN]      = { "Tehran",   17.7f, 14.0f,  0, 4.5f },
+};
+
+// Sines of each method's fixed angles, computed once on first use
+static struct {
+    double sin_fajr;
+    double sin_isha;
+    double sin_maghrib;
+} method_sines[PRAYER_METHOD_COUNT];
+static bool method_sines_ready = false;
+
+static void prepare_method_sines(void)
+{
+    for (int i = 0; i < PRAYER_METHOD_COUNT; i++) {
+        // Depression angles are altitudes below the horizon
+        method_sines[i].sin_fajr = sin(DEG2RAD(-(double)prayer_methods[i].fajr_angle));
+        method_sines[i].sin_isha = sin(DEG2RAD(-(double)prayer_methods[i].isha_angle));
+        method_sines[i].sin_maghrib = sin(DEG2RAD(-(double)prayer_methods[i].maghrib_angle));
+    }
+    method_sines_ready = true;
+}
+
+void prayer_day_terms_init(prayer_day_terms_t *terms, prayer_method_id_t method,
+                           prayer_asr_method_t asr, double lat_deg, double dec_rad,
+                           double elevation_m)
+{
+    if (!method_sines_ready) {
+        prepare_method_sines();
+    }
+    if (method >= PRAYER_METHOD_COUNT) {
+        method = PRAYER_METHOD_MWL;
+    }
+
+    const prayer_method_t *m = &prayer_methods[method];
+    double lat = DEG2RAD(lat_deg);
+    double sin_dec = sin(dec_rad);
+    double cos_dec = cos(dec_rad);
+
+    terms->sin_lat_sin_dec = sin(lat) * sin_dec;
+    terms->cos_lat_cos_dec = cos(lat) * cos_dec;
+
+    // Refraction and solar radius (0.833) plus the horizon dip at elevation
+    double dip = (elevation_m > 0.0) ? 0.0347 * sqrt(elevation_m) : 0.0;
+    terms->sin_sunrise = sin(DEG2RAD(-(0.833 + dip)));
+
+    terms->sin_fajr = method_sines[method].sin_fajr;
+    terms->sin_isha = method_sines[method].sin_isha;
+    terms->sin_maghrib = method_sines[method].sin_maghrib;
+    terms->isha_offset_hours = m->isha_minutes / 60.0;
+    terms->maghrib_at_sunset = (m->maghrib_angle == 0.0f);
+    terms->fajr_angle = m->fajr_angle;
+    terms->isha_angle = m->isha_angle;
+    terms->maghrib_angle = m->maghrib_angle;
+
+    // Asr: shadow equals factor times object height plus the noon shadow
+    double noon_shadow = tan(fabs(lat - dec_rad));
+    terms->sin_asr = sin(atan(1.0 / ((int)asr + noon_shadow)));
+}
+
+double prayer_hour_angle(const prayer_day_terms_t *terms, double sin_altitude)
+{
+    double cos_h = (sin_altitude - terms->sin_lat_sin_dec) / terms->cos_lat_cos_dec;
+
+    if (cos_h < -1.0 || cos_h > 1.0) {
+        return -1.0;    // The sun never reaches this altitude today
+    }
+
+    return acos(cos_h) / DEG2RAD(15.0);
+}
+
+static double night_portion(prayer_high_lat_rule_t rule, float angle)
+{
+    switch (rule) {
+    case PRAYER_HIGH_LAT_ONE_SEVENTH:
+        return 1.0 / 7.0;
+    case PRAYER_HIGH_LAT_ANGLE_BASED:
+        return angle / 60.0;
+    case PRAYER_HIGH_LAT_MIDDLE_OF_NIGHT:
+    default:
+        return 0.5;
+    }
+}
+
+// Cap the interval between an event and sunrise/sunset at its portion of the night
+static bool adjust_twilight(double *offset, double horizon_offset, double night,
+                            prayer_high_lat_rule_t rule, float angle)
+{
+    double limit = horizon_offset + night_portion(rule, angle) * night;
+
+    if (*offset < 0.0 || *offset > limit) {
+        *offset = limit;
+        return true;
+    }
+    return false;
+}
+
+int prayer_day_offsets(const prayer_day_terms_t *terms, prayer_high_lat_rule_t rule,
+                       prayer_day_offsets_t *out)
+{
+    int adjusted = 0;
+
+    // Sunrise/sunset: clamp polar day (12 h) and polar night (0 h) instead of failing
+    double cos_h = (terms->sin_sunrise - terms->sin_lat_sin_dec) / terms->cos_lat_cos_dec;
+    cos_h = (cos_h < -1.0) ? -1.0 : (cos_h > 1.0) ? 1.0 : cos_h;
+    double half_day = acos(cos_h) / DEG2RAD(15.0);
+    double night = 24.0 - 2.0 * half_day;
+
+    out->sunrise = half_day;
+    out->sunset = half_day;
+
+    // Asr is always reached while the sun is up; fall back to sunset otherwise
+    out->asr = prayer_hour_angle(terms, terms->sin_asr);
+    if (out->asr < 0.0 || out->asr > half_day) {
+        out->asr = half_day;
+        adjusted++;
+    }
+
+    out->fajr = prayer_hour_angle(terms, terms->sin_fajr);
+    adjusted += adjust_twilight(&out->fajr, half_day, night, rule, terms->fajr_angle);
+
+    if (terms->maghrib_at_sunset) {
+        out->maghrib = half_day;
+    } else {
+        out->maghrib = prayer_hour_angle(terms, terms->sin_maghrib);
+        adjusted += adjust_twilight(&out->maghrib, half_day, night, rule, terms->maghrib_angle);
+    }
+
+    if (terms->isha_offset_hours > 0.0) {
+        // A fixed interval may not run past the middle of a short summer night
+        out->isha = out->maghrib + terms->isha_offset_hours;
+        adjusted += adjust_twilight(&out->isha, half_day, night, PRAYER_HIGH_LAT_MIDDLE_OF_NIGHT, 0.0f);
+    } else {
+        out->isha = prayer_hour_angle(terms, terms->sin_isha);
+        adjusted += adjust_twilight(&out->isha, half_day, night, rule, terms->isha_angle);
+    }
+
+    return adjusted;
+}
@@ -0,0 +1,134 @@
+/**
+ * @file prayer_methods.h
+ * @brief Prayer time calculation methods as constant descriptor tables
+ *
+ * Each method is a const descriptor (twilight angles, fixed Isha interval, Maghrib
+ * angle). Selecting a method prepares the angle sines once; prayer_day_terms_init()
+ * then folds latitude and declination into per-day terms so that every prayer time
+ * of the day costs a single acos(), whatever the method.
+ */
+
+#ifndef PRAYER_METHODS_H
+#define PRAYER_METHODS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief Calculation method identifiers
+ */
+typedef enum {
+    PRAYER_METHOD_MWL = 0,          ///< Muslim World League (Fajr 18, Isha 17)
+    PRAYER_METHOD_ISNA,             ///< Islamic Society of North America (15, 15)
+    PRAYER_METHOD_EGYPTIAN,         ///< Egyptian General Authority of Survey (19.5, 17.5)
+    PRAYER_METHOD_UMM_AL_QURA,      ///< Umm al-Qura, Makkah (18.5, Isha 90 min after Maghrib)
+    PRAYER_METHOD_KARACHI,          ///< University of Islamic Sciences, Karachi (18, 18)
+    PRAYER_METHOD_TEHRAN,           ///< Institute of Geophysics, Tehran (17.7, 14, Maghrib 4.5)
+    PRAYER_METHOD_COUNT
+} prayer_method_id_t;
+
+/**
+ * @brief Asr shadow length factor
+ */
+typedef enum {
+    PRAYER_ASR_STANDARD = 1,        ///< Shafi'i, Maliki, Hanbali
+    PRAYER_ASR_HANAFI = 2,          ///< Hanafi
+} prayer_asr_method_t;
+
+/**
+ * @brief High-latitude rule for Fajr, Isha and angle-based Maghrib
+ *
+ * Each rule caps the interval between the event and sunrise (Fajr) or sunset
+ * (Isha, Maghrib) at a portion of the night. The cap is applied per event, and
+ * always when the sun never reaches the event's angle that day.
+ */
+typedef enum {
+    PRAYER_HIGH_LAT_MIDDLE_OF_NIGHT = 0,    ///< Half of the night (only bites where twilight never ends)
+    PRAYER_HIGH_LAT_ONE_SEVENTH,            ///< One seventh of the night
+    PRAYER_HIGH_LAT_ANGLE_BASED,            ///< Angle / 60 of the night
+    PRAYER_HIGH_LAT_COUNT
+} prayer_high_lat_rule_t;
+
+/**
+ * @brief Calculation method descriptor
+ */
+typedef struct {
+    const char *name;               ///< Short display name
+    float fajr_angle;               ///< Sun depression at Fajr (degrees)
+    float isha_angle;               ///< Sun depression at Isha (degrees), unused if isha_minutes
+    uint16_t isha_minutes;          ///< Fixed Isha interval after Maghrib, 0 = angle based
+    float maghrib_angle;            ///< Sun depression at Maghrib (degrees), 0 = at sunset
+} prayer_method_t;
+
+/**
+ * @brief Per-day invariants shared by all prayer times of one day
+ */
+typedef struct {
+    double sin_lat_sin_dec;         ///< sin(latitude) * sin(declination)
+    double cos_lat_cos_dec;         ///< cos(latitude) * cos(declination)
+    double sin_sunrise;             ///< sin of the sunrise/sunset altitude (refraction, elevation)
+    double sin_fajr;                ///< sin of the Fajr altitude
+    double sin_isha;                ///< sin of the Isha altitude (angle-based methods)
+    double sin_maghrib;             ///< sin of the Maghrib altitude (angle-based Maghrib)
+    double sin_asr;                 ///< sin of the Asr altitude, depends on declination
+    double isha_offset_hours;       ///< Fixed Isha interval in hours, 0 when angle based
+    bool maghrib_at_sunset;         ///< Maghrib equals sunset
+    float fajr_angle;               ///< Method angles, for the angle-based high-latitude rule
+    float isha_angle;
+    float maghrib_angle;
+} prayer_day_terms_t;
+
+/**
+ * @brief Event times of one day as hours from solar noon (Dhuhr)
+ */
+typedef struct {
+    double fajr;                    ///< Hours before noon
+    double sunrise;                 ///< Hours before noon
+    double asr;                     ///< Hours after noon
+    double sunset;                  ///< Hours after noon
+    double maghrib;                 ///< Hours after noon
+    double isha;                    ///< Hours after noon
+} prayer_day_offsets_t;
+
+/**
+ * @brief Method descriptors, indexed by prayer_method_id_t
+ */
+extern const prayer_method_t prayer_methods[PRAYER_METHOD_COUNT];
+
+/**
+ * @brief Precompute the day's invariants for a method
+ * @param terms Output terms
+ * @param method Method id
+ * @param asr Asr shadow factor
+ * @param lat_deg Latitude in degrees
+ * @param dec_rad Solar declination in radians
+ * @param elevation_m Observer elevation above sea level in meters
+ */
+void prayer_day_terms_init(prayer_day_terms_t *terms, prayer_method_id_t method,
+                           prayer_asr_method_t asr, double lat_deg, double dec_rad,
+                           double elevation_m);
+
+/**
+ * @brief Hour angle (in hours from solar noon) at which the sun has a given altitude
+ * @param terms Day terms from prayer_day_terms_init()
+ * @param sin_altitude Sine of the target altitude
+ * @return Hours between solar noon and the event, or -1.0 if the sun never
+ *         reaches that altitude today
+ */
+double prayer_hour_angle(const prayer_day_terms_t *terms, double sin_altitude);
+
+/**
+ * @brief Compute all event times of the day
+ *
+ * Costs at most five acos() calls. High-latitude adjustments use only the
+ * already known sunrise and sunset, so the worst case is fixed.
+ *
+ * @param terms Day terms from prayer_day_terms_init()
+ * @param rule High-latitude rule
+ * @param out Output offsets from solar noon (never NaN)
+ * @return Number of events adjusted by the high-latitude rule
+ */
+int prayer_day_offsets(const prayer_day_terms_t *terms, prayer_high_lat_rule_t rule,
+                       prayer_day_offsets_t *out);
+
+#endif // PRAYER_METHODS_H
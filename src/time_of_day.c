@@ -0,0 +1,88 @@
+/**
+ * @file time_of_day.c
+ * @brief Integer time-of-day conversions and table-driven formatting
+ */
+
+#include "time_of_day.h"
+#include <math.h>
+
+// "00".."99" packed back to back; index with value * 2
+static const char two_digits[200] = {
+    '0','0','0','1','0','2','0','3','0','4','0','5','0','6','0','7','0','8','0','9',
+    '1','0','1','1','1','2','1','3','1','4','1','5','1','6','1','7','1','8','1','9',
+    '2','0','2','1','2','2','2','3','2','4','2','5','2','6','2','7','2','8','2','9',
+    '3','0','3','1','3','2','3','3','3','4','3','5','3','6','3','7','3','8','3','9',
+    '4','0','4','1','4','2','4','3','4','4','4','5','4','6','4','7','4','8','4','9',
+    '5','0','5','1','5','2','5','3','5','4','5','5','5','6','5','7','5','8','5','9',
+    '6','0','6','1','6','2','6','3','6','4','6','5','6','6','6','7','6','8','6','9',
+    '7','0','7','1','7','2','7','3','7','4','7','5','7','6','7','7','7','8','7','9',
+    '8','0','8','1','8','2','8','3','8','4','8','5','8','6','8','7','8','8','8','9',
+    '9','0','9','1','9','2','9','3','9','4','9','5','9','6','9','7','9','8','9','9',
+};
+
+int32_t tod_from_hours(double decimal_hours)
+{
+    // Round to the nearest minute (the old string path truncated)
+    long minutes = lround(decimal_hours * 60.0);
+    return tod_wrap((int32_t)(minutes * 60));
+}
+
+int32_t tod_days_from_civil(int year, int month, int day)
+{
+    // Proleptic Gregorian, integer only (era-based, valid for any year)
+    year -= (month <= 2);
+    int32_t era = (year >= 0 ? year : year - 399) / 400;
+    int32_t yoe = year - era * 400;
+    int32_t doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    int32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    // 730425 = days from 0000-03-01 to 2000-01-01
+    return era * 146097 + doe - 730425;
+}
+
+void tod_civil_from_days(int32_t days, int *year, int *month, int *day)
+{
+    days += 730425;
+    int32_t era = (days >= 0 ? days : days - 146096) / 146097;
+    int32_t doe = days - era * 146097;
+    int32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    int32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    int32_t mp = (5 * doy + 2) / 153;
+    int d = doy - (153 * mp + 2) / 5 + 1;
+    int m = mp < 10 ? mp + 3 : mp - 9;
+
+    *year = yoe + era * 400 + (m <= 2);
+    *month = m;
+    *day = d;
+}
+
+void tod_put2(char *out, int value)
+{
+    out[0] = two_digits[value * 2];
+    out[1] = two_digits[value * 2 + 1];
+}
+
+void tod_format_hhmm(int32_t sod, char *out)
+{
+    if (sod < 0 || sod >= TOD_SECONDS_PER_DAY) {
+        out[0] = '-'; out[1] = '-'; out[2] = ':'; out[3] = '-'; out[4] = '-'; out[5] = '\0';
+        return;
+    }
+
+    int32_t minutes = sod / 60;
+    tod_put2(out, minutes / 60);
+    out[2] = ':';
+    tod_put2(out + 3, minutes % 60);
+    out[5] = '\0';
+}
+
+void tod_format_hhmmss(int32_t sod, char *out)
+{
+    tod_format_hhmm(sod, out);
+    out[5] = ':';
+    if (sod < 0 || sod >= TOD_SECONDS_PER_DAY) {
+        out[6] = '-'; out[7] = '-';
+    } else {
+        tod_put2(out + 6, sod % 60);
+    }
+    out[8] = '\0';
+}
@@ -0,0 +1,72 @@
+/**
+ * @file time_of_day.h
+ * @brief Compact integer time representation shared by GPS, prayer engine and HMI
+ *
+ * Times are carried as int32 seconds since local (or UTC) midnight and dates as a
+ * day ordinal (days since 2000-01-01). Text is produced only at render time with a
+ * table-driven two-digit formatter; no snprintf/sscanf is needed on the hot path.
+ */
+
+#ifndef TIME_OF_DAY_H
+#define TIME_OF_DAY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define TOD_SECONDS_PER_DAY 86400       ///< Seconds in one day
+#define TOD_INVALID         (-1)        ///< Marker for an unknown time of day
+
+/**
+ * @brief Build seconds-of-day from hour, minute and second fields
+ */
+static inline int32_t tod_from_hms(int hours, int minutes, int seconds)
+{
+    return (int32_t)hours * 3600 + minutes * 60 + seconds;
+}
+
+/**
+ * @brief Wrap any second count into the range 0-86399
+ */
+static inline int32_t tod_wrap(int32_t seconds)
+{
+    seconds %= TOD_SECONDS_PER_DAY;
+    return (seconds < 0) ? seconds + TOD_SECONDS_PER_DAY : seconds;
+}
+
+/**
+ * @brief Convert decimal hours to seconds-of-day, rounded to the nearest minute
+ * @param decimal_hours Time in hours (any range, wrapped into one day)
+ * @return Seconds since midnight, a whole number of minutes
+ */
+int32_t tod_from_hours(double decimal_hours);
+
+/**
+ * @brief Convert a Gregorian date to a day ordinal (days since 2000-01-01)
+ */
+int32_t tod_days_from_civil(int year, int month, int day);
+
+/**
+ * @brief Convert a day ordinal back to a Gregorian date
+ */
+void tod_civil_from_days(int32_t days, int *year, int *month, int *day);
+
+/**
+ * @brief Format "HH:MM" (6 bytes including terminator)
+ * @param sod Seconds since midnight, TOD_INVALID renders "--:--"
+ * @param out Output buffer of at least 6 bytes
+ */
+void tod_format_hhmm(int32_t sod, char *out);
+
+/**
+ * @brief Format "HH:MM:SS" (9 bytes including terminator)
+ * @param sod Seconds since midnight, TOD_INVALID renders "--:--:--"
+ * @param out Output buffer of at least 9 bytes
+ */
+void tod_format_hhmmss(int32_t sod, char *out);
+
+/**
+ * @brief Write a value 0-99 as two ASCII digits (no terminator)
+ */
+void tod_put2(char *out, int value);
+
+#endif // TIME_OF_DAY_H
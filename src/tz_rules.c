@@ -0,0 +1,199 @@
+/**
+ * @file tz_rules.c
+ * @brief Compiled timezone and DST rules
+ *
+ * Rules follow the current (2026) law of each region. Regions whose DST depends
+ * on the lunar calendar (Morocco, Palestine) use their usual Gregorian dates.
+ */
+
+#include "tz_rules.h"
+#include "time_of_day.h"
+#include <stddef.h>
+
+#define TZ_SECONDS_PER_DAY      86400
+
+/**
+ * @brief One POSIX rule change Mm.w.d/t
+ */
+typedef struct {
+    uint8_t month;                  ///< 1-12
+    uint8_t week;                   ///< 1-4, 5 = last
+    uint8_t wday;                   ///< 0 = Sunday
+    int16_t minute;                 ///< Wall clock minutes after midnight of that day
+} tz_change_t;
+
+/**
+ * @brief Compiled zone
+ */
+typedef struct {
+    const char *name;               ///< POSIX TZ string it was compiled from
+    int16_t std_min;                ///< Standard offset east of UTC, minutes
+    int16_t save_min;               ///< Added during DST, 0 = no DST
+    bool utc;                       ///< Change times are UTC (EU) instead of local wall clock
+    tz_change_t start;              ///< Local standard time (or UTC)
+    tz_change_t end;                ///< Local daylight time (or UTC)
+} tz_zone_t;
+
+#define FIXED(n, h, m)              { n, (h) * 60 + (m), 0, false, { 0 }, { 0 } }
+#define CHANGE(mo, w, d, t)         { mo, w, d, t }
+
+static const tz_zone_t tz_zones[TZ_ZONE_COUNT] = {
+    [TZ_UTC_M10]     = FIXED("<-10>10", -10, 0),
+    [TZ_UTC_M7]      = FIXED("<-07>7", -7, 0),
+    [TZ_UTC_M6]      = FIXED("<-06>6", -6, 0),
+    [TZ_UTC_M5]      = FIXED("<-05>5", -5, 0),
+    [TZ_UTC_M4]      = FIXED("<-04>4", -4, 0),
+    [TZ_UTC_M3]      = FIXED("<-03>3", -3, 0),
+    [TZ_UTC_M1]      = FIXED("<-01>1", -1, 0),
+    [TZ_UTC]         = FIXED("UTC0", 0, 0),
+    [TZ_UTC_P1]      = FIXED("<+01>-1", 1, 0),
+    [TZ_UTC_P2]      = FIXED("<+02>-2", 2, 0),
+    [TZ_UTC_P3]      = FIXED("<+03>-3", 3, 0),
+    [TZ_UTC_P3_30]   = FIXED("<+0330>-3:30", 3, 30),
+    [TZ_UTC_P4]      = FIXED("<+04>-4", 4, 0),
+    [TZ_UTC_P4_30]   = FIXED("<+0430>-4:30", 4, 30),
+    [TZ_UTC_P5]      = FIXED("<+05>-5", 5, 0),
+    [TZ_UTC_P5_30]   = FIXED("<+0530>-5:30", 5, 30),
+    [TZ_UTC_P5_45]   = FIXED("<+0545>-5:45", 5, 45),
+    [TZ_UTC_P6]      = FIXED("<+06>-6", 6, 0),
+    [TZ_UTC_P6_30]   = FIXED("<+0630>-6:30", 6, 30),
+    [TZ_UTC_P7]      = FIXED("<+07>-7", 7, 0),
+    [TZ_UTC_P8]      = FIXED("<+08>-8", 8, 0),
+    [TZ_UTC_P9]      = FIXED("<+09>-9", 9, 0),
+    [TZ_UTC_P9_30]   = FIXED("<+0930>-9:30", 9, 30),
+    [TZ_UTC_P10]     = FIXED("<+10>-10", 10, 0),
+    [TZ_UTC_P11]     = FIXED("<+11>-11", 11, 0),
+    [TZ_UTC_P12]     = FIXED("<+12>-12", 12, 0),
+    [TZ_UTC_P13]     = FIXED("<+13>-13", 13, 0),
+
+    // North America: second Sunday of March to first Sunday of November, 02:00 local
+    [TZ_US_PACIFIC]  = { "PST8PDT,M3.2.0,M11.1.0", -8 * 60, 60, false,
+                         CHANGE(3, 2, 0, 120), CHANGE(11, 1, 0, 120) },
+    [TZ_US_MOUNTAIN] = { "MST7MDT,M3.2.0,M11.1.0", -7 * 60, 60, false,
+                         CHANGE(3, 2, 0, 120), CHANGE(11, 1, 0, 120) },
+    [TZ_US_CENTRAL]  = { "CST6CDT,M3.2.0,M11.1.0", -6 * 60, 60, false,
+                         CHANGE(3, 2, 0, 120), CHANGE(11, 1, 0, 120) },
+    [TZ_US_EASTERN]  = { "EST5EDT,M3.2.0,M11.1.0", -5 * 60, 60, false,
+                         CHANGE(3, 2, 0, 120), CHANGE(11, 1, 0, 120) },
+    [TZ_US_ATLANTIC] = { "AST4ADT,M3.2.0,M11.1.0", -4 * 60, 60, false,
+                         CHANGE(3, 2, 0, 120), CHANGE(11, 1, 0, 120) },
+    [TZ_CUBA]        = { "CST5CDT,M3.2.0/0,M11.1.0/1", -5 * 60, 60, false,
+                         CHANGE(3, 2, 0, 0), CHANGE(11, 1, 0, 60) },
+    // Saturday 24:00 = Sunday 00:00
+    [TZ_CHILE]       = { "<-04>4<-03>,M9.1.6/24,M4.1.6/24", -4 * 60, 60, false,
+                         CHANGE(9, 1, 6, 1440), CHANGE(4, 1, 6, 1440) },
+
+    // EU: last Sunday of March to last Sunday of October, both at 01:00 UTC
+    [TZ_EU_WESTERN]  = { "WET0WEST,M3.5.0/1,M10.5.0", 0, 60, true,
+                         CHANGE(3, 5, 0, 60), CHANGE(10, 5, 0, 60) },
+    [TZ_EU_CENTRAL]  = { "CET-1CEST,M3.5.0,M10.5.0/3", 60, 60, true,
+                         CHANGE(3, 5, 0, 60), CHANGE(10, 5, 0, 60) },
+    [TZ_EU_EASTERN]  = { "EET-2EEST,M3.5.0/3,M10.5.0/4", 120, 60, true,
+                         CHANGE(3, 5, 0, 60), CHANGE(10, 5, 0, 60) },
+    [TZ_MOLDOVA]     = { "EET-2EEST,M3.5.0,M10.5.0/3", 120, 60, false,
+                         CHANGE(3, 5, 0, 120), CHANGE(10, 5, 0, 180) },
+    [TZ_LEBANON]     = { "EET-2EEST,M3.5.0/0,M10.5.0/0", 120, 60, false,
+                         CHANGE(3, 5, 0, 0), CHANGE(10, 5, 0, 0) },
+    // Friday before the last Sunday of March: fourth Thursday + 26 h
+    [TZ_ISRAEL]      = { "IST-2IDT,M3.4.4/26,M10.5.0", 120, 60, false,
+                         CHANGE(3, 4, 4, 26 * 60), CHANGE(10, 5, 0, 120) },
+    [TZ_PALESTINE]   = { "EET-2EEST,M3.4.4/50,M10.4.4/50", 120, 60, false,
+                         CHANGE(3, 4, 4, 50 * 60), CHANGE(10, 4, 4, 50 * 60) },
+    [TZ_EGYPT]       = { "EET-2EEST,M4.5.5/0,M10.5.4/24", 120, 60, false,
+                         CHANGE(4, 5, 5, 0), CHANGE(10, 5, 4, 1440) },
+
+    // Southern hemisphere: DST spans the new year
+    [TZ_AU_CENTRAL]  = { "ACST-9:30ACDT,M10.1.0,M4.1.0/3", 9 * 60 + 30, 60, false,
+                         CHANGE(10, 1, 0, 120), CHANGE(4, 1, 0, 180) },
+    [TZ_AU_EASTERN]  = { "AEST-10AEDT,M10.1.0,M4.1.0/3", 10 * 60, 60, false,
+                         CHANGE(10, 1, 0, 120), CHANGE(4, 1, 0, 180) },
+    [TZ_NEW_ZEALAND] = { "NZST-12NZDT,M9.5.0,M4.1.0/3", 12 * 60, 60, false,
+                         CHANGE(9, 5, 0, 120), CHANGE(4, 1, 0, 180) },
+};
+
+const char *tz_zone_name(uint8_t zone)
+{
+    if (zone >= TZ_ZONE_COUNT) {
+        return "fixed";
+    }
+    return tz_zones[zone].name;
+}
+
+/**
+ * @brief Day of a rule change as days since 2000-01-01 (a Saturday)
+ *
+ * Closed form: the first matching weekday of the month, plus whole weeks,
+ * one week back when "last" overruns the month.
+ */
+static int32_t change_day(int year, const tz_change_t *c)
+{
+    int32_t first = tod_days_from_civil(year, c->month, 1);
+    int32_t next = (c->month == 12) ? tod_days_from_civil(year + 1, 1, 1) :
+                                      tod_days_from_civil(year, c->month + 1, 1);
+    int first_wday = (int)(((first + 6) % 7 + 7) % 7);     // 0 = Sunday
+    int32_t day = first + (c->wday - first_wday + 7) % 7 + (c->week - 1) * 7;
+
+    if (day >= next) {
+        day -= 7;
+    }
+    return day;
+}
+
+void tz_year_expand(tz_year_t *t, uint8_t zone, int year)
+{
+    const tz_zone_t *z = &tz_zones[(zone < TZ_ZONE_COUNT) ? zone : TZ_UTC];
+
+    t->zone = zone;
+    t->year = (int16_t)year;
+    t->year_start = tod_days_from_civil(year, 1, 1) * TZ_SECONDS_PER_DAY;
+    t->year_end = tod_days_from_civil(year + 1, 1, 1) * TZ_SECONDS_PER_DAY;
+    t->std_min = z->std_min;
+    t->dst_min = z->std_min + z->save_min;
+
+    if (z->save_min == 0) {
+        t->dst_start = t->dst_end = t->year_start;
+        return;
+    }
+
+    // POSIX: the start is given in standard time, the end in daylight time
+    int32_t start_utc_min = z->utc ? 0 : t->std_min;
+    int32_t end_utc_min = z->utc ? 0 : t->dst_min;
+
+    t->dst_start = change_day(year, &z->start) * TZ_SECONDS_PER_DAY +
+                   (z->start.minute - start_utc_min) * 60;
+    t->dst_end = change_day(year, &z->end) * TZ_SECONDS_PER_DAY +
+                 (z->end.minute - end_utc_min) * 60;
+}
+
+void tz_year_fixed(tz_year_t *t, int offset_min)
+{
+    t->zone = TZ_ZONE_FIXED;
+    t->year = 0;
+    t->year_start = INT32_MIN;
+    t->year_end = INT32_MAX;
+    t->dst_start = t->dst_end = 0;
+    t->std_min = (int16_t)offset_min;
+    t->dst_min = (int16_t)offset_min;
+}
+
+bool tz_is_dst(tz_year_t *t, int32_t utc_s)
+{
+    if (utc_s < t->year_start || utc_s >= t->year_end) {
+        int year, month, day;
+        int32_t days = utc_s / TZ_SECONDS_PER_DAY - (utc_s % TZ_SECONDS_PER_DAY < 0);
+
+        tod_civil_from_days(days, &year, &month, &day);
+        tz_year_expand(t, t->zone, year);
+    }
+
+    if (t->dst_start <= t->dst_end) {
+        return utc_s >= t->dst_start && utc_s < t->dst_end;
+    }
+    // Southern hemisphere: DST from the end of the year into the next
+    return utc_s >= t->dst_start || utc_s < t->dst_end;
+}
+
+int tz_offset_min(tz_year_t *t, int32_t utc_s)
+{
+    return tz_is_dst(t, utc_s) ? t->dst_min : t->std_min;
+}
@@ -0,0 +1,131 @@
+/**
+ * @file tz_rules.h
+ * @brief Compiled timezone and DST rules with per-year transition tables
+ *
+ * Each zone is a standard offset in minutes plus an optional DST rule, written
+ * as the POSIX TZ string it was compiled from (e.g. "CET-1CEST,M3.5.0,M10.5.0/3").
+ * A rule change "Mm.w.d/t" is day d (0 = Sunday) of week w (1-4, 5 = last) of
+ * month m at time t (default 02:00, may exceed 24 h).
+ *
+ * Lookups go through a tz_year_t: the zone's rule is expanded once per year into
+ * its two UTC transition instants, after which an offset query is two compares.
+ */
+
+#ifndef TZ_RULES_H
+#define TZ_RULES_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief Zones used by the city table
+ *
+ * Fixed offsets are named after the offset; zones with DST after their region.
+ */
+typedef enum {
+    TZ_UTC_M10,
+    TZ_UTC_M7,
+    TZ_UTC_M6,
+    TZ_UTC_M5,
+    TZ_UTC_M4,
+    TZ_UTC_M3,
+    TZ_UTC_M1,
+    TZ_UTC,
+    TZ_UTC_P1,
+    TZ_UTC_P2,
+    TZ_UTC_P3,
+    TZ_UTC_P3_30,
+    TZ_UTC_P4,
+    TZ_UTC_P4_30,
+    TZ_UTC_P5,
+    TZ_UTC_P5_30,
+    TZ_UTC_P5_45,
+    TZ_UTC_P6,
+    TZ_UTC_P6_30,
+    TZ_UTC_P7,
+    TZ_UTC_P8,
+    TZ_UTC_P9,
+    TZ_UTC_P9_30,
+    TZ_UTC_P10,
+    TZ_UTC_P11,
+    TZ_UTC_P12,
+    TZ_UTC_P13,
+    TZ_US_PACIFIC,
+    TZ_US_MOUNTAIN,
+    TZ_US_CENTRAL,
+    TZ_US_EASTERN,
+    TZ_US_ATLANTIC,
+    TZ_CUBA,
+    TZ_CHILE,
+    TZ_EU_WESTERN,
+    TZ_EU_CENTRAL,
+    TZ_EU_EASTERN,
+    TZ_MOLDOVA,
+    TZ_LEBANON,
+    TZ_ISRAEL,
+    TZ_PALESTINE,
+    TZ_EGYPT,
+    TZ_AU_CENTRAL,
+    TZ_AU_EASTERN,
+    TZ_NEW_ZEALAND,
+    TZ_ZONE_COUNT,
+    TZ_ZONE_FIXED = 0xFF,           ///< tz_year_fixed(): an offset without a zone
+} tz_zone_id_t;
+
+/**
+ * @brief One zone's transitions in one year
+ *
+ * Instants are UTC seconds since 2000-01-01 00:00. Filled by tz_year_expand()
+ * or tz_year_fixed(); tz_offset_min() re-expands it when a query leaves the year.
+ */
+typedef struct {
+    uint8_t zone;                   ///< tz_zone_id_t
+    int16_t year;                   ///< Expanded UTC year, 0 = not expanded
+    int32_t year_start;             ///< First second of the year
+    int32_t year_end;               ///< First second of the next year
+    int32_t dst_start;              ///< DST begins (== dst_end when the zone has none)
+    int32_t dst_end;                ///< DST ends (before dst_start in the southern hemisphere)
+    int16_t std_min;                ///< Standard offset east of UTC, minutes
+    int16_t dst_min;                ///< Offset during DST, minutes
+} tz_year_t;
+
+/**
+ * @brief POSIX TZ string of a zone (log output)
+ * @return Rule string, "fixed" for TZ_ZONE_FIXED
+ */
+const char *tz_zone_name(uint8_t zone);
+
+/**
+ * @brief Expand a zone's rule for one UTC year
+ * @param t Output table
+ * @param zone Zone (tz_zone_id_t); unknown zones expand as UTC
+ * @param year Gregorian year
+ */
+void tz_year_expand(tz_year_t *t, uint8_t zone, int year);
+
+/**
+ * @brief Set a fixed offset without DST (e.g. estimated from the longitude)
+ * @param t Output table
+ * @param offset_min Offset east of UTC, minutes
+ */
+void tz_year_fixed(tz_year_t *t, int offset_min);
+
+/**
+ * @brief UTC offset at an instant, DST included
+ *
+ * O(1): two compares while utc_s stays in the expanded year, one expansion at
+ * the year change.
+ * @param t Table from tz_year_expand() or tz_year_fixed()
+ * @param utc_s UTC seconds since 2000-01-01 00:00
+ * @return Offset east of UTC, minutes
+ */
+int tz_offset_min(tz_year_t *t, int32_t utc_s);
+
+/**
+ * @brief Whether DST is in effect at an instant
+ * @param t Table from tz_year_expand() or tz_year_fixed()
+ * @param utc_s UTC seconds since 2000-01-01 00:00
+ */
+bool tz_is_dst(tz_year_t *t, int32_t utc_s);
+
+#endif // TZ_RULES_H
@@ -0,0 +1,288 @@
+/**
+ * @file ubx.c
+ * @brief u-blox UBX frame parser, builder and NAV-PVT decoding
+ */
+
+#include "ubx.h"
+#include <string.h>
+
+enum {
+    UBX_STATE_SYNC1 = 0,
+    UBX_STATE_SYNC2,
+    UBX_STATE_CLASS,
+    UBX_STATE_ID,
+    UBX_STATE_LENGTH1,
+    UBX_STATE_LENGTH2,
+    UBX_STATE_PAYLOAD,
+    UBX_STATE_CK_A,
+    UBX_STATE_CK_B,
+};
+
+static ubx_frame_t ubx_discard;
+
+// Little-endian field access: the layout is fixed, the host byte order is not
+static inline uint16_t get_u16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static inline uint32_t get_u32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline void put_u16(uint8_t *p, uint16_t value)
+{
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+}
+
+static inline void put_u32(uint8_t *p, uint32_t value)
+{
+    put_u16(p, (uint16_t)value);
+    put_u16(p + 2, (uint16_t)(value >> 16));
+}
+
+static inline void checksum_add(ubx_parser_t *parser, uint8_t byte)
+{
+    parser->ck_a += byte;
+    parser->ck_b += parser->ck_a;
+}
+
+void ubx_parser_init(ubx_parser_t *parser, ubx_frame_t *frame)
+{
+    *parser = (ubx_parser_t){ .frame = frame, .state = UBX_STATE_SYNC1 };
+}
+
+bool ubx_parser_idle(const ubx_parser_t *parser)
+{
+    return parser->state == UBX_STATE_SYNC1;
+}
+
+void ubx_parser_abort(ubx_parser_t *parser)
+{
+    parser->state = UBX_STATE_SYNC1;
+}
+
+bool ubx_feed(ubx_parser_t *parser, uint8_t byte)
+{
+    // Without a buffer the frame is still parsed (to stay in sync), then dropped
+    ubx_frame_t *f = parser->frame ? parser->frame : &ubx_discard;
+
+    switch (parser->state) {
+    case UBX_STATE_SYNC1:
+        if (byte == UBX_SYNC1) {
+            parser->state = UBX_STATE_SYNC2;
+        }
+        return false;
+
+    case UBX_STATE_SYNC2:
+        parser->state = (byte == UBX_SYNC2) ? UBX_STATE_CLASS :
+                        (byte == UBX_SYNC1) ? UBX_STATE_SYNC2 : UBX_STATE_SYNC1;
+        parser->ck_a = 0;
+        parser->ck_b = 0;
+        return false;
+
+    case UBX_STATE_CLASS:
+        checksum_add(parser, byte);
+        f->msg_class = byte;
+        parser->state = UBX_STATE_ID;
+        return false;
+
+    case UBX_STATE_ID:
+        checksum_add(parser, byte);
+        f->msg_id = byte;
+        parser->state = UBX_STATE_LENGTH1;
+        return false;
+
+    case UBX_STATE_LENGTH1:
+        checksum_add(parser, byte);
+        f->length = byte;
+        parser->state = UBX_STATE_LENGTH2;
+        return false;
+
+    case UBX_STATE_LENGTH2:
+        checksum_add(parser, byte);
+        f->length |= (uint16_t)byte << 8;
+        parser->index = 0;
+        // No frame the driver uses is longer: a larger length is a corrupted header or
+        // line noise, and waiting for up to 64 KB of "payload" would swallow the NMEA
+        if (f->length > UBX_MAX_PAYLOAD) {
+            parser->oversize++;
+            parser->state = UBX_STATE_SYNC1;
+            return false;
+        }
+        parser->state = (f->length > 0) ? UBX_STATE_PAYLOAD : UBX_STATE_CK_A;
+        return false;
+
+    case UBX_STATE_PAYLOAD:
+        checksum_add(parser, byte);
+        f->payload[parser->index] = byte;
+        if (++parser->index >= f->length) {
+            parser->state = UBX_STATE_CK_A;
+        }
+        return false;
+
+    case UBX_STATE_CK_A:
+        parser->state = (byte == parser->ck_a) ? UBX_STATE_CK_B : UBX_STATE_SYNC1;
+        if (parser->state == UBX_STATE_SYNC1) {
+            parser->checksum_errors++;
+        }
+        return false;
+
+    case UBX_STATE_CK_B:
+        parser->state = UBX_STATE_SYNC1;
+        if (byte != parser->ck_b) {
+            parser->checksum_errors++;
+            return false;
+        }
+        if (!parser->frame) {
+            parser->dropped++;
+            return false;
+        }
+        parser->frames++;
+        return true;
+
+    default:
+        parser->state = UBX_STATE_SYNC1;
+        return false;
+    }
+}
+
+size_t ubx_build(uint8_t *out, uint8_t msg_class, uint8_t msg_id,
+                 const uint8_t *payload, uint16_t length)
+{
+    out[0] = UBX_SYNC1;
+    out[1] = UBX_SYNC2;
+    out[2] = msg_class;
+    out[3] = msg_id;
+    out[4] = (uint8_t)(length & 0xFF);
+    out[5] = (uint8_t)(length >> 8);
+    if (length > 0) {
+        memcpy(&out[6], payload, length);
+    }
+
+    uint8_t ck_a = 0;
+    uint8_t ck_b = 0;
+    for (size_t i = 2; i < 6u + length; i++) {
+        ck_a += out[i];
+        ck_b += ck_a;
+    }
+    out[6 + length] = ck_a;
+    out[7 + length] = ck_b;
+
+    return length + UBX_FRAME_OVERHEAD;
+}
+
+size_t ubx_build_cfg_msg(uint8_t *out, uint8_t msg_class, uint8_t msg_id, uint8_t rate)
+{
+    const uint8_t payload[3] = { msg_class, msg_id, rate };
+    return ubx_build(out, UBX_CLASS_CFG, UBX_ID_CFG_MSG, payload, sizeof(payload));
+}
+
+size_t ubx_build_cfg_prt(uint8_t *out, uint32_t baud)
+{
+    uint8_t payload[20] = { 0 };
+
+    payload[0] = 1;                     // portID: UART1
+    put_u32(&payload[4], 0x000008D0);   // mode: 8 data bits, no parity, 1 stop bit
+    put_u32(&payload[8], baud);
+    put_u16(&payload[12], 0x0003);      // inProtoMask: UBX + NMEA
+    put_u16(&payload[14], 0x0003);      // outProtoMask: UBX (ACKs, NAV-PVT) + NMEA
+    return ubx_build(out, UBX_CLASS_CFG, UBX_ID_CFG_PRT, payload, sizeof(payload));
+}
+
+size_t ubx_build_cfg_rate(uint8_t *out, uint16_t meas_rate_ms)
+{
+    uint8_t payload[6];
+
+    put_u16(&payload[0], meas_rate_ms);
+    put_u16(&payload[2], 1);            // navRate: every measurement
+    put_u16(&payload[4], 1);            // timeRef: GPS time
+    return ubx_build(out, UBX_CLASS_CFG, UBX_ID_CFG_RATE, payload, sizeof(payload));
+}
+
+size_t ubx_build_cfg_pm2(uint8_t *out, uint32_t update_period_ms, uint32_t search_period_ms,
+                         uint16_t on_time_s)
+{
+    uint8_t payload[UBX_CFG_PM2_LENGTH] = { 0 };
+
+    payload[0] = 1;                     // version
+    // flags: waitTimeFix, updateRTC, updateEPH; mode 0 = ON/OFF operation
+    put_u32(&payload[4], (1u << 10) | (1u << 11) | (1u << 12));
+    put_u32(&payload[8], update_period_ms);
+    put_u32(&payload[12], search_period_ms);
+    put_u16(&payload[20], on_time_s);
+    return ubx_build(out, UBX_CLASS_CFG, UBX_ID_CFG_PM2, payload, sizeof(payload));
+}
+
+size_t ubx_build_cfg_rxm(uint8_t *out, uint8_t lp_mode)
+{
+    const uint8_t payload[2] = { 8, lp_mode };  // reserved1 must be 8
+
+    return ubx_build(out, UBX_CLASS_CFG, UBX_ID_CFG_RXM, payload, sizeof(payload));
+}
+
+size_t ubx_build_nav_pvt(uint8_t *out, const ubx_nav_pvt_t *pvt)
+{
+    uint8_t payload[UBX_NAV_PVT_MIN_LENGTH] = { 0 };
+
+    put_u32(&payload[0], pvt->itow_ms);
+    put_u16(&payload[4], pvt->year);
+    payload[6] = pvt->month;
+    payload[7] = pvt->day;
+    payload[8] = pvt->hour;
+    payload[9] = pvt->minute;
+    payload[10] = pvt->second;
+    payload[11] = (pvt->date_valid ? 0x01 : 0) | (pvt->time_valid ? 0x02 : 0);
+    payload[20] = pvt->fix_type;
+    payload[21] = pvt->fix_ok ? 0x01 : 0;
+    payload[23] = pvt->num_sv;
+    put_u32(&payload[24], (uint32_t)pvt->lon_e7);
+    put_u32(&payload[28], (uint32_t)pvt->lat_e7);
+    put_u32(&payload[32], (uint32_t)pvt->height_mm);
+    put_u32(&payload[36], (uint32_t)pvt->hmsl_mm);
+    put_u32(&payload[40], pvt->h_acc_mm);
+    put_u16(&payload[76], pvt->pdop);
+    return ubx_build(out, UBX_CLASS_NAV, UBX_ID_NAV_PVT, payload, sizeof(payload));
+}
+
+bool ubx_decode_nav_pvt(const ubx_frame_t *frame, ubx_nav_pvt_t *pvt)
+{
+    if (frame->msg_class != UBX_CLASS_NAV || frame->msg_id != UBX_ID_NAV_PVT ||
+        frame->length < UBX_NAV_PVT_MIN_LENGTH) {
+        return false;
+    }
+
+    const uint8_t *p = frame->payload;
+
+    pvt->itow_ms = get_u32(&p[0]);
+    pvt->year = get_u16(&p[4]);
+    pvt->month = p[6];
+    pvt->day = p[7];
+    pvt->hour = p[8];
+    pvt->minute = p[9];
+    pvt->second = p[10];
+    pvt->date_valid = (p[11] & 0x01) != 0;
+    pvt->time_valid = (p[11] & 0x02) != 0;
+    pvt->fix_type = p[20];
+    pvt->fix_ok = (p[21] & 0x01) != 0;
+    pvt->num_sv = p[23];
+    pvt->lon_e7 = (int32_t)get_u32(&p[24]);
+    pvt->lat_e7 = (int32_t)get_u32(&p[28]);
+    pvt->height_mm = (int32_t)get_u32(&p[32]);
+    pvt->hmsl_mm = (int32_t)get_u32(&p[36]);
+    pvt->h_acc_mm = get_u32(&p[40]);
+    pvt->pdop = get_u16(&p[76]);
+
+    return true;
+}
+
+int ubx_ack_result(const ubx_frame_t *frame, uint8_t msg_class, uint8_t msg_id)
+{
+    if (frame->msg_class != UBX_CLASS_ACK || frame->length < 2 ||
+        frame->payload[0] != msg_class || frame->payload[1] != msg_id) {
+        return -1;
+    }
+    return (frame->msg_id == UBX_ID_ACK_ACK) ? 1 : 0;
+}
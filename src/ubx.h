@@ -0,0 +1,194 @@
+/**
+ * @file ubx.h
+ * @brief u-blox UBX binary protocol: frame parser, frame builder and NAV-PVT decoding
+ *
+ * A UBX frame is: 0xB5 0x62, class, id, payload length (little endian, 2 bytes),
+ * payload, and an 8-bit Fletcher checksum over class..payload. NAV-PVT carries
+ * date, time, fix, position, height and satellite count in one fixed-layout frame
+ * (84-byte payload on protocol 14 / NEO-7, 92 bytes from protocol 15 / M8), so one
+ * frame per second replaces the whole NMEA burst.
+ *
+ * NAV-PVT needs protocol 14 or later: a NEO-6 (protocol 6/7) NAKs it and the
+ * driver stays on NMEA.
+ */
+
+#ifndef UBX_H
+#define UBX_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define UBX_SYNC1               0xB5
+#define UBX_SYNC2               0x62
+#define UBX_MAX_PAYLOAD         100     ///< Largest payload accepted (NAV-PVT is 84 or 92)
+#define UBX_FRAME_OVERHEAD      8       ///< Sync, class, id, length, checksum
+
+// Message classes and IDs used by the driver
+#define UBX_CLASS_NAV           0x01
+#define UBX_CLASS_ACK           0x05
+#define UBX_CLASS_CFG           0x06
+#define UBX_CLASS_NMEA          0xF0    ///< Standard NMEA messages, for CFG-MSG
+#define UBX_ID_NAV_PVT          0x07
+#define UBX_ID_ACK_NAK          0x00
+#define UBX_ID_ACK_ACK          0x01
+#define UBX_ID_CFG_PRT          0x00
+#define UBX_ID_CFG_MSG          0x01
+#define UBX_ID_CFG_RATE         0x08
+#define UBX_ID_CFG_RXM          0x11
+#define UBX_ID_CFG_PM2          0x3B
+
+#define UBX_NAV_PVT_MIN_LENGTH  84      ///< Protocol 14 payload length
+#define UBX_CFG_PM2_LENGTH      44      ///< CFG-PM2 payload length (version 1)
+
+// CFG-RXM low-power modes
+#define UBX_RXM_CONTINUOUS      0       ///< Continuous tracking (maximum performance)
+#define UBX_RXM_POWER_SAVE      1       ///< Power save mode, operation set by CFG-PM2
+
+/**
+ * @brief A received frame with a valid checksum
+ */
+typedef struct {
+    uint8_t msg_class;
+    uint8_t msg_id;
+    uint16_t length;                    ///< Payload length
+    uint8_t payload[UBX_MAX_PAYLOAD];
+} ubx_frame_t;
+
+/**
+ * @brief Frame parser state
+ *
+ * Like the NMEA tokenizer, the frame is written straight into a caller-provided
+ * buffer; while frame is NULL complete frames are counted as dropped.
+ */
+typedef struct {
+    ubx_frame_t *frame;                 ///< Output buffer (NULL = drop frames)
+    uint8_t state;
+    uint8_t ck_a;                       ///< Running Fletcher checksum
+    uint8_t ck_b;
+    uint16_t index;                     ///< Payload bytes received
+    uint32_t frames;                    ///< Frames with a valid checksum
+    uint32_t checksum_errors;           ///< Frames failing the checksum
+    uint32_t oversize;                  ///< Headers announcing more than UBX_MAX_PAYLOAD (resynchronised)
+    uint32_t dropped;                   ///< Frames skipped for lack of a buffer
+} ubx_parser_t;
+
+/**
+ * @brief NAV-PVT fields used by the firmware
+ */
+typedef struct {
+    uint32_t itow_ms;                   ///< GPS time of week (ms)
+    uint16_t year;                      ///< UTC year
+    uint8_t month;                      ///< UTC month (1-12)
+    uint8_t day;                        ///< UTC day (1-31)
+    uint8_t hour;                       ///< UTC hour
+    uint8_t minute;                     ///< UTC minute
+    uint8_t second;                     ///< UTC second (0-60)
+    bool date_valid;                    ///< validDate flag
+    bool time_valid;                    ///< validTime flag
+    uint8_t fix_type;                   ///< 0 none, 2 = 2D, 3 = 3D, ...
+    bool fix_ok;                        ///< gnssFixOK flag
+    uint8_t num_sv;                     ///< Satellites used
+    int32_t lon_e7;                     ///< Longitude (degrees * 1e7)
+    int32_t lat_e7;                     ///< Latitude (degrees * 1e7)
+    int32_t height_mm;                  ///< Height above ellipsoid (mm)
+    int32_t hmsl_mm;                    ///< Height above mean sea level (mm)
+    uint32_t h_acc_mm;                  ///< Horizontal accuracy estimate (mm)
+    uint16_t pdop;                      ///< Position DOP * 100
+} ubx_nav_pvt_t;
+
+/**
+ * @brief Reset the parser and its counters
+ */
+void ubx_parser_init(ubx_parser_t *parser, ubx_frame_t *frame);
+
+/**
+ * @brief True between frames
+ */
+bool ubx_parser_idle(const ubx_parser_t *parser);
+
+/**
+ * @brief Abandon the frame in progress and wait for the next sync bytes
+ */
+void ubx_parser_abort(ubx_parser_t *parser);
+
+/**
+ * @brief Feed one received byte
+ * @return true when parser->frame now holds a complete, checksum-valid frame
+ */
+bool ubx_feed(ubx_parser_t *parser, uint8_t byte);
+
+/**
+ * @brief Build a frame with checksum
+ * @param out Output buffer, at least length + UBX_FRAME_OVERHEAD bytes
+ * @param msg_class Message class
+ * @param msg_id Message ID
+ * @param payload Payload (may be NULL when length is 0)
+ * @param length Payload length
+ * @return Frame length in bytes
+ */
+size_t ubx_build(uint8_t *out, uint8_t msg_class, uint8_t msg_id,
+                 const uint8_t *payload, uint16_t length);
+
+/**
+ * @brief Build a CFG-MSG frame setting the output rate of one message on the current port
+ * @return Frame length in bytes (11)
+ */
+size_t ubx_build_cfg_msg(uint8_t *out, uint8_t msg_class, uint8_t msg_id, uint8_t rate);
+
+/**
+ * @brief Build a CFG-PRT frame for UART1: 8N1 at the given baud rate, UBX and NMEA in and out
+ * @return Frame length in bytes (28)
+ */
+size_t ubx_build_cfg_prt(uint8_t *out, uint32_t baud);
+
+/**
+ * @brief Build a CFG-RATE frame: one navigation solution per measurement, GPS time aligned
+ * @param out Output buffer
+ * @param meas_rate_ms Measurement period in milliseconds (1000 = 1 Hz)
+ * @return Frame length in bytes (14)
+ */
+size_t ubx_build_cfg_rate(uint8_t *out, uint16_t meas_rate_ms);
+
+/**
+ * @brief Build a CFG-PM2 frame for ON/OFF operation
+ *
+ * The receiver wakes every update period, stays on until it has a fix (and a
+ * valid time) plus on_time, then switches its RF section off. Takes effect once
+ * CFG-RXM selects power save mode.
+ * @param out Output buffer, at least UBX_CFG_PM2_LENGTH + UBX_FRAME_OVERHEAD bytes
+ * @param update_period_ms Time between fixes
+ * @param search_period_ms Retry period when a fix could not be obtained
+ * @param on_time_s Time to stay on after a fix
+ * @return Frame length in bytes (52)
+ */
+size_t ubx_build_cfg_pm2(uint8_t *out, uint32_t update_period_ms, uint32_t search_period_ms,
+                         uint16_t on_time_s);
+
+/**
+ * @brief Build a CFG-RXM frame selecting continuous or power save operation
+ * @param out Output buffer
+ * @param lp_mode UBX_RXM_CONTINUOUS or UBX_RXM_POWER_SAVE
+ * @return Frame length in bytes (10)
+ */
+size_t ubx_build_cfg_rxm(uint8_t *out, uint8_t lp_mode);
+
+/**
+ * @brief Build a NAV-PVT frame (protocol 14 layout) from decoded fields, for replay
+ * @return Frame length in bytes (92)
+ */
+size_t ubx_build_nav_pvt(uint8_t *out, const ubx_nav_pvt_t *pvt);
+
+/**
+ * @brief Decode a NAV-PVT frame
+ * @return false when the frame is not NAV-PVT or too short
+ */
+bool ubx_decode_nav_pvt(const ubx_frame_t *frame, ubx_nav_pvt_t *pvt);
+
+/**
+ * @brief Check an ACK-ACK/ACK-NAK frame against the acknowledged message
+ * @return 1 for ACK, 0 for NAK, -1 when the frame does not acknowledge that message
+ */
+int ubx_ack_result(const ubx_frame_t *frame, uint8_t msg_class, uint8_t msg_id);
+
+#endif // UBX_H
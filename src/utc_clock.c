@@ -0,0 +1,291 @@
+/**
+ * @file utc_clock.c
+ * @brief Disciplined UTC clock implementation
+ *
+ * The clock is the offset d = local - UTC as a line over local time:
+ * d(L) = anchor_d + (L - anchor_local) * drift. now() evaluates it once, so a
+ * query costs one multiplication and a civil date conversion.
+ */
+
+#include "utc_clock.h"
+#include "gps_events.h"
+#include "time_of_day.h"
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/zbus/zbus.h>
+#if DT_NODE_EXISTS(DT_ALIAS(gps_pps))
+    #include <zephyr/drivers/gpio.h>
+#endif
+
+#define US_PER_DAY      (86400LL * 1000000LL)
+
+static struct k_spinlock clock_lock;
+
+// Clock line (clock_lock)
+static bool clock_valid;
+static int64_t anchor_local_us;         ///< Local time of the anchor
+static int64_t anchor_d_us;             ///< local - UTC at the anchor
+static int32_t drift_ppb;               ///< d grows by this per local second, in ns
+static bool drift_valid;
+
+// Estimation window (GPS parser context)
+static int64_t window_start_us;
+static int64_t window_min_local_us;
+static int64_t window_min_d_us;
+static int64_t window_min_err_us;       ///< Residual of the minimum against the clock line
+static bool window_open;
+static int64_t ref_local_us;            ///< Previous window minimum
+static int64_t ref_d_us;
+static bool ref_valid;
+static int64_t last_sample_us;
+
+static utc_clock_stats_t clock_stats;
+
+#if DT_NODE_EXISTS(DT_ALIAS(gps_pps))
+static const struct gpio_dt_spec pps_gpio = GPIO_DT_SPEC_GET(DT_ALIAS(gps_pps), gpios);
+static struct gpio_callback pps_cb;
+static int64_t pps_local_us = -1;       ///< Last PPS edge (clock_lock)
+#endif
+
+/**
+ * @brief Local time: kernel uptime, the low-frequency RTC on nRF
+ */
+static int64_t local_us(void)
+{
+    return (int64_t)k_ticks_to_us_floor64(k_uptime_ticks());
+}
+
+/**
+ * @brief Estimated local - UTC at local time L (clock_lock held)
+ */
+static int64_t offset_at(int64_t local)
+{
+    // Per millisecond first: no overflow for years at the drift limit
+    return anchor_d_us + (local - anchor_local_us) / 1000 * drift_ppb / 1000000;
+}
+
+static void set_anchor(int64_t local, int64_t d)
+{
+    k_spinlock_key_t key = k_spin_lock(&clock_lock);
+    anchor_local_us = local;
+    anchor_d_us = d;
+    clock_valid = true;
+    k_spin_unlock(&clock_lock, key);
+}
+
+/**
+ * @brief Start a new estimation window at sample (L, d) with residual err
+ */
+static void window_reset(int64_t local, int64_t d, int64_t err)
+{
+    window_start_us = local;
+    window_min_local_us = local;
+    window_min_d_us = d;
+    window_min_err_us = err;
+    window_open = true;
+}
+
+/**
+ * @brief Close the window: its minimum becomes the anchor and a drift measurement
+ */
+static void window_close(void)
+{
+    int64_t span = window_min_local_us - ref_local_us;
+
+    // Minima close together (the end of one window, the start of the next) give
+    // the delay noise over a short span: keep the reference for a longer one
+    if (ref_valid && span < UTC_CLOCK_WINDOW_S * 1000000LL / 2) {
+        set_anchor(window_min_local_us, window_min_d_us);
+        return;
+    }
+
+    if (ref_valid) {
+        int64_t measured = (window_min_d_us - ref_d_us) * 1000000000LL / span;
+
+        if (measured > -UTC_CLOCK_MAX_PPM * 1000LL && measured < UTC_CLOCK_MAX_PPM * 1000LL) {
+            k_spinlock_key_t key = k_spin_lock(&clock_lock);
+            // Light smoothing: each window is already a minimum over hundreds of seconds
+            drift_ppb = drift_valid ? drift_ppb + (int32_t)(measured - drift_ppb) / 4 : (int32_t)measured;
+            drift_valid = true;
+            k_spin_unlock(&clock_lock, key);
+        }
+    }
+
+    ref_local_us = window_min_local_us;
+    ref_d_us = window_min_d_us;
+    ref_valid = true;
+    set_anchor(window_min_local_us, window_min_d_us);
+}
+
+/**
+ * @brief GPS says UTC was utc_us at local time local (GPS parser context)
+ */
+static void clock_sample(int64_t utc_us, int64_t local)
+{
+    int64_t d = local - utc_us;
+
+    clock_stats.samples++;
+
+    if (!clock_valid) {
+        set_anchor(local, d);
+        window_reset(local, d, 0);
+        last_sample_us = local;
+        printk("UTC clock: anchored to GPS\n");
+        return;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&clock_lock);
+    int64_t err = d - offset_at(local);
+    k_spin_unlock(&clock_lock, key);
+
+    // First sample after an outage: how far the clock got off on its own
+    if (local - last_sample_us > UTC_CLOCK_HOLDOVER_S * 1000000LL) {
+        clock_stats.holdover_s = (uint32_t)((local - last_sample_us) / 1000000);
+        clock_stats.holdover_error_us = (int32_t)CLAMP(err, INT32_MIN, INT32_MAX);
+    }
+    last_sample_us = local;
+
+    // GPS time jumped (or the clock is far off): start over, keep the drift
+    if (err > UTC_CLOCK_STEP_MS * 1000LL || err < -UTC_CLOCK_STEP_MS * 1000LL) {
+        set_anchor(local, d);
+        window_reset(local, d, 0);
+        ref_valid = false;
+        clock_stats.steps++;
+        return;
+    }
+
+    // Delays only make samples late: an early one is a better phase right away.
+    // The line moves by err, and so do the residuals measured against it
+    if (err < 0) {
+        set_anchor(local, d);
+        window_min_err_us -= err;
+        err = 0;
+    }
+
+    // Minimum residual, not minimum d: d itself trends by the drift across the window
+    if (!window_open) {
+        window_reset(local, d, err);
+    } else if (err < window_min_err_us) {
+        window_min_local_us = local;
+        window_min_d_us = d;
+        window_min_err_us = err;
+    }
+
+    if (local - window_start_us >= UTC_CLOCK_WINDOW_S * 1000000LL) {
+        window_close();
+        window_open = false;
+    }
+}
+
+/**
+ * @brief New UTC second from the receiver (GPS parser context)
+ */
+static void on_gps_time(const struct zbus_channel *chan)
+{
+    const gps_time_msg_t *msg = zbus_chan_const_msg(chan);
+    int64_t local = local_us();
+
+    if (msg->utc_sod < 0 || msg->date_ordinal < 0) {
+        return;
+    }
+
+#if DT_NODE_EXISTS(DT_ALIAS(gps_pps))
+    // The message labels the PPS edge that started its second
+    k_spinlock_key_t key = k_spin_lock(&clock_lock);
+    if (pps_local_us >= 0 && local - pps_local_us < 1000000) {
+        local = pps_local_us;
+    }
+    k_spin_unlock(&clock_lock, key);
+#endif
+
+    clock_sample((int64_t)msg->date_ordinal * US_PER_DAY + (int64_t)msg->utc_sod * 1000000, local);
+}
+
+ZBUS_LISTENER_DEFINE(utc_clock_listener, on_gps_time);
+ZBUS_CHAN_ADD_OBS(gps_time_chan, utc_clock_listener, 0);
+
+#if DT_NODE_EXISTS(DT_ALIAS(gps_pps))
+static void pps_isr(const struct device *dev, struct gpio_callback *cb, uint32_t pins)
+{
+    int64_t now = local_us();
+    k_spinlock_key_t key = k_spin_lock(&clock_lock);
+    pps_local_us = now;
+    clock_stats.pps_edges++;
+    k_spin_unlock(&clock_lock, key);
+}
+#endif
+
+int utc_clock_init(void)
+{
+#if DT_NODE_EXISTS(DT_ALIAS(gps_pps))
+    if (!gpio_is_ready_dt(&pps_gpio)) {
+        printk("UTC clock: PPS GPIO not ready\n");
+        return -ENODEV;
+    }
+
+    int ret = gpio_pin_configure_dt(&pps_gpio, GPIO_INPUT);
+    if (ret == 0) {
+        ret = gpio_pin_interrupt_configure_dt(&pps_gpio, GPIO_INT_EDGE_TO_ACTIVE);
+    }
+    if (ret < 0) {
+        printk("UTC clock: PPS configuration failed (%d)\n", ret);
+        return ret;
+    }
+
+    gpio_init_callback(&pps_cb, pps_isr, BIT(pps_gpio.pin));
+    gpio_add_callback(pps_gpio.port, &pps_cb);
+    clock_stats.pps = true;
+    printk("UTC clock: PPS input on pin %d\n", pps_gpio.pin);
+#endif
+    return 0;
+}
+
+int64_t utc_clock_now_ms(void)
+{
+    int64_t local = local_us();
+    int64_t utc_us = -1000;
+
+    k_spinlock_key_t key = k_spin_lock(&clock_lock);
+    if (clock_valid) {
+        utc_us = local - offset_at(local);
+    }
+    k_spin_unlock(&clock_lock, key);
+
+    return utc_us / 1000;
+}
+
+bool utc_clock_get(utc_clock_time_t *out)
+{
+    int64_t utc_ms = utc_clock_now_ms();
+
+    if (utc_ms < 0 || !out) {
+        return false;
+    }
+
+    int64_t day_ms = utc_ms % 86400000LL;
+
+    out->utc_ms = utc_ms;
+    out->date_ordinal = (int32_t)(utc_ms / 86400000LL);
+    out->sod = (int32_t)(day_ms / 1000);
+    out->ms = (uint16_t)(day_ms % 1000);
+    tod_civil_from_days(out->date_ordinal, &out->year, &out->month, &out->day);
+    return true;
+}
+
+void utc_clock_get_stats(utc_clock_stats_t *stats)
+{
+    if (!stats) {
+        return;
+    }
+
+    int64_t local = local_us();
+    k_spinlock_key_t key = k_spin_lock(&clock_lock);
+    *stats = clock_stats;
+    stats->valid = clock_valid;
+    stats->drift_valid = drift_valid;
+    stats->drift_ppb = drift_ppb;
+    k_spin_unlock(&clock_lock, key);
+
+    stats->since_gps_s = clock_valid ? (uint32_t)((local - last_sample_us) / 1000000) : 0;
+}
@@ -0,0 +1,87 @@
+/**
+ * @file utc_clock.h
+ * @brief Disciplined UTC clock: GPS time propagated by the system clock with drift correction
+ *
+ * UTC is held as a 64-bit microsecond count since 2000-01-01 00:00 UTC, anchored
+ * to GPS time (gps_time_chan) and carried forward by the kernel uptime, which on
+ * the nRF boards is the 32768 Hz RTC. Between anchors the RTC's measured rate
+ * error is corrected, so the clock keeps time through GPS outages and between
+ * the fixes of the power-save duty cycle.
+ *
+ * GPS samples are timestamped when the time message has been parsed, which adds
+ * a delay that varies with the sentence's position in the UART buffer. Delays
+ * are one-sided, so each estimation window keeps its earliest sample (minimum
+ * delay) as the phase anchor and the drift is taken from successive window
+ * minima. A constant output delay of the receiver stays in the phase.
+ *
+ * PPS: with a devicetree alias gps-pps (a node with a gpios property on the
+ * receiver's timepulse output), each second is timestamped at its PPS edge
+ * instead and the receiver delay drops out.
+ */
+
+#ifndef UTC_CLOCK_H
+#define UTC_CLOCK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define UTC_CLOCK_WINDOW_S      256     ///< Drift estimation window (local seconds)
+#define UTC_CLOCK_STEP_MS       500     ///< Larger disagreement with GPS re-anchors (steps) the clock
+#define UTC_CLOCK_MAX_PPM       1000    ///< Drift estimates beyond this are rejected
+#define UTC_CLOCK_HOLDOVER_S    10      ///< Gap between GPS samples counted as an outage
+
+/**
+ * @brief UTC from the clock, in civil form
+ */
+typedef struct {
+    int64_t utc_ms;                 ///< Milliseconds since 2000-01-01 00:00 UTC
+    int32_t date_ordinal;           ///< Days since 2000-01-01
+    int year;
+    int month;                      ///< 1-12
+    int day;                        ///< 1-31
+    int32_t sod;                    ///< UTC seconds since midnight
+    uint16_t ms;                    ///< Milliseconds into the second
+} utc_clock_time_t;
+
+/**
+ * @brief Clock statistics
+ */
+typedef struct {
+    bool valid;                     ///< Anchored to GPS at least once
+    bool drift_valid;               ///< Drift measured over at least one window
+    bool pps;                       ///< PPS input configured
+    int32_t drift_ppb;              ///< Local clock rate error (+ = runs fast), parts per billion
+    uint32_t samples;               ///< GPS seconds used
+    uint32_t steps;                 ///< Re-anchors after a disagreement > UTC_CLOCK_STEP_MS
+    uint32_t pps_edges;
+    uint32_t since_gps_s;           ///< Time since the last GPS sample
+    uint32_t holdover_s;            ///< Length of the last outage
+    int32_t holdover_error_us;      ///< Clock error when GPS came back after it (+ = clock ahead, includes that sample's delay)
+} utc_clock_stats_t;
+
+/**
+ * @brief Configure the PPS input (when wired); GPS samples need no setup
+ * @return 0 on success, negative errno if the PPS pin could not be configured
+ */
+int utc_clock_init(void);
+
+/**
+ * @brief Current UTC in milliseconds since 2000-01-01 00:00 UTC (O(1), any context)
+ * @return Milliseconds, or -1 before the first GPS time
+ */
+int64_t utc_clock_now_ms(void);
+
+/**
+ * @brief Current UTC as civil date and time (O(1), any context)
+ * @param out Output time
+ * @return false before the first GPS time (out untouched)
+ */
+bool utc_clock_get(utc_clock_time_t *out);
+
+/**
+ * @brief Get clock statistics
+ * @param stats Output statistics
+ */
+void utc_clock_get_stats(utc_clock_stats_t *stats);
+
+#endif // UTC_CLOCK_H
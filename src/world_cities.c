@@ -2,69 +2,67 @@
 #include <string.h>
 #include <math.h>
 
-const city_data_t* find_city_by_name(const char* city_name)
+int find_city_by_name(const char* city_name)
 {
     if (!city_name) {
-        return NULL;
+        return -1;
     }
-    
-    for (int i = 0; i < WORLD_CITIES_COUNT; i++) {
-        if (strcmp(world_cities[i].city_name, city_name) == 0) {
-            return &world_cities[i];
+
+    for (int i = 0; i < world_cities_count; i++) {
+        if (strcmp(&world_city_names[world_city_records[i].name], city_name) == 0) {
+            return i;
         }
     }
-    
-    return NULL; // City not found
+
+    return -1; // City not found
 }
 
 int get_total_cities_count(void)
 {
-    return WORLD_CITIES_COUNT;
+    return world_cities_count;
 }
 
-const city_data_t* get_city_by_index(int index)
+bool get_city_by_index(int index, city_data_t* city)
 {
-    if (index < 0 || index >= WORLD_CITIES_COUNT) {
-        return NULL;
+    if (index < 0 || index >= world_cities_count) {
+        return false;
     }
-    
-    return &world_cities[index];
-}
 
-static double calculate_distance(double lat1, double lon1, double lat2, double lon2)
-{
-    // Calculate distance between two points using Haversine formula (simplified)
-    double dlat = lat2 - lat1;
-    double dlon = lon2 - lon1;
-    
-    // Simple euclidean distance approximation for nearby points
-    // More accurate than full Haversine for city matching purposes
-    double distance = sqrt(dlat * dlat + dlon * dlon);
-    return distance;
+    const city_record_t *record = &world_city_records[index];
+    city->city_name = &world_city_names[record->name];
+    city->latitude = (double)world_city_positions[index].latitude / CITY_COORD_SCALE;
+    city->longitude = (double)world_city_positions[index].longitude / CITY_COORD_SCALE;
+    city->tz = record->tz;
+    city->country[0] = record->country[0];
+    city->country[1] = record->country[1];
+    city->country[2] = '\0';
+    return true;
 }
 
-const city_data_t* find_nearest_city(double latitude, double longitude)
+int find_nearest_city(double latitude, double longitude)
 {
-    if (WORLD_CITIES_COUNT == 0) {
-        return NULL;
+    if (world_cities_count == 0) {
+        return -1;
     }
-    
-    const city_data_t* nearest_city = &world_cities[0];
-    double min_distance = calculate_distance(latitude, longitude, 
-                                           world_cities[0].latitude, 
-                                           world_cities[0].longitude);
-    
+
+    // Simple euclidean distance approximation for nearby points, in table units
+    // and squared: the same order as the distance in degrees, without sqrt
+    int32_t lat = (int32_t)lround(latitude * CITY_COORD_SCALE);
+    int32_t lon = (int32_t)lround(longitude * CITY_COORD_SCALE);
+    int nearest_city = -1;
+    int64_t min_distance = INT64_MAX;
+
     // Search through all cities to find the nearest one
-    for (int i = 1; i < WORLD_CITIES_COUNT; i++) {
-        double distance = calculate_distance(latitude, longitude,
-                                           world_cities[i].latitude,
-                                           world_cities[i].longitude);
-        
+    for (int i = 0; i < world_cities_count; i++) {
+        int64_t dlat = world_city_positions[i].latitude - lat;
+        int64_t dlon = world_city_positions[i].longitude - lon;
+        int64_t distance = dlat * dlat + dlon * dlon;
+
         if (distance < min_distance) {
             min_distance = distance;
-            nearest_city = &world_cities[i];
+            nearest_city = i;
         }
     }
-    
+
     return nearest_city;
-}
\ No newline at end of file
+}
@@ -1,2436 +1,52 @@
 #ifndef WORLD_CITIES_H
 #define WORLD_CITIES_H
 
+#include <stdint.h>
+#include <stdbool.h>
+#include "tz_rules.h"
+
+#define CITY_COORD_SCALE 100000     // Table coordinates are in 1e-5 degrees (about 1 m)
+
+// Packed table (world_cities_data.c, generated by tools/gen_city_table.py from
+// tools/world_cities.csv); use the functions below
+
+// Position of a city: one dense array for the nearest-city scan
 typedef struct {
-    char city_name[25];
+    int32_t latitude;     // 1e-5 degrees, + = North
+    int32_t longitude;    // 1e-5 degrees, + = East
+} city_position_t;
+
+// Rest of a city's record
+typedef struct {
+    uint16_t name;        // Offset of the NUL-terminated name in world_city_names
+    uint8_t tz;           // Timezone and DST rules (tz_zone_id_t)
+    char country[2];      // ISO 3166 alpha-2, not NUL-terminated
+} city_record_t;
+
+extern const city_position_t world_city_positions[];
+extern const city_record_t world_city_records[];
+extern const char world_city_names[];
+extern const int world_cities_count;
+
+// A city unpacked from the table
+typedef struct city_data {
+    const char *city_name;  // In the name pool, valid for good
     double latitude;
     double longitude;
-    int timezone_offset;  // Hours from UTC
-    char country[4];
+    uint8_t tz;           // Timezone and DST rules (tz_zone_id_t)
+    char country[3];
 } city_data_t;
 
-static const city_data_t world_cities[] = {
-    // Saudi Arabia
-    {"Mecca", 21.3891, 39.8579, 3, "SA"},
-    {"Medina", 24.5247, 39.5692, 3, "SA"},
-    {"Riyadh", 24.7136, 46.6753, 3, "SA"},
-    {"Jeddah", 21.4858, 39.1925, 3, "SA"},
-    {"Dammam", 26.4282, 50.1044, 3, "SA"},
-    {"Khobar", 26.2172, 50.1971, 3, "SA"},
-    {"Taif", 21.2703, 40.4158, 3, "SA"},
-    {"Abha", 18.2164, 42.5053, 3, "SA"},
-    {"Tabuk", 28.3998, 36.5780, 3, "SA"},
-    {"Hail", 27.5114, 41.6900, 3, "SA"},
-    
-    // United Arab Emirates
-    {"Dubai", 25.2048, 55.2708, 4, "AE"},
-    {"Abu Dhabi", 24.2992, 54.6973, 4, "AE"},
-    {"Sharjah", 25.3463, 55.4209, 4, "AE"},
-    {"Ajman", 25.4052, 55.5136, 4, "AE"},
-    {"Fujairah", 25.1288, 56.3264, 4, "AE"},
-    {"Ras Al Khaimah", 25.7889, 55.9761, 4, "AE"},
-    {"Umm Al Quwain", 25.5647, 55.6550, 4, "AE"},
-    
-    // Egypt
-    {"Cairo", 30.0444, 31.2357, 3, "EG"},
-    {"Alexandria", 31.2001, 29.9187, 3, "EG"},
-    {"Giza", 30.0131, 31.2089, 3, "EG"},
-    {"Luxor", 25.6872, 32.6396, 3, "EG"},
-    {"Aswan", 24.0889, 32.8998, 3, "EG"},
-    {"Port Said", 31.2653, 32.3019, 3, "EG"},
-    {"Suez", 29.9668, 32.5498, 3, "EG"},
-    {"Hurghada", 27.2574, 33.8129, 3, "EG"},
-    {"Sharm El Sheikh", 27.9158, 34.3300, 3, "EG"},
-    
-    // Turkey
-    {"Istanbul", 41.0082, 28.9784, 4, "TR"},
-    {"Ankara", 39.9334, 32.8597, 4, "TR"},
-    {"Izmir", 38.4192, 27.1287, 4, "TR"},
-    {"Bursa", 40.1826, 29.0665, 4, "TR"},
-    {"Antalya", 36.8969, 30.7133, 4, "TR"},
-    {"Konya", 37.8713, 32.4846, 4, "TR"},
-    {"Adana", 37.0000, 35.3213, 4, "TR"},
-    {"Gaziantep", 37.0662, 37.3833, 4, "TR"},
-    {"Kayseri", 38.7312, 35.4787, 4, "TR"},
-    {"Eskisehir", 39.7767, 30.5206, 4, "TR"},
-    {"Diyarbakir", 37.9144, 40.2306, 4, "TR"},
-    {"Samsun", 41.2867, 36.3300, 4, "TR"},
-    {"Denizli", 37.7765, 29.0864, 4, "TR"},
-    {"Malatya", 38.3552, 38.3095, 4, "TR"},
-    {"Kahramanmaras", 37.5858, 36.9371, 4, "TR"},
-    {"Erzurum", 39.9334, 41.2678, 4, "TR"},
-    {"Van", 38.4891, 43.4089, 4, "TR"},
-    {"Batman", 37.8812, 41.1351, 4, "TR"},
-    {"Elazığ", 38.6810, 39.2264, 4, "TR"},
-    {"Icel", 36.8000, 34.6333, 4, "TR"},
-    {"Manisa", 38.6191, 27.4289, 4, "TR"},
-    {"Sivas", 39.7477, 37.0179, 4, "TR"},
-    {"Gebze", 40.7654, 29.4305, 4, "TR"},
-    {"Balıkesir", 39.6484, 27.8826, 4, "TR"},
-    {"Sanliurfa", 37.1591, 38.7969, 4, "TR"},
-    {"Trabzon", 41.0015, 39.7178, 4, "TR"},
-    {"Ordu", 40.9839, 37.8764, 4, "TR"},
-    {"Aydin", 37.8444, 27.8458, 4, "TR"},
-    {"Usak", 38.6823, 29.4082, 4, "TR"},
-    {"Isparta", 37.7648, 30.5566, 4, "TR"},
-    {"Afyon", 38.7507, 30.5567, 4, "TR"},
-    {"Zonguldak", 41.4564, 31.7987, 4, "TR"},
-    {"Tokat", 40.3167, 36.5500, 4, "TR"},
-    
-    // Iran
-    {"Tehran", 35.6892, 51.3890, 4, "IR"},
-    {"Mashhad", 36.2605, 59.6168, 4, "IR"},
-    {"Isfahan", 32.6546, 51.6680, 4, "IR"},
-    {"Karaj", 35.8327, 50.9916, 4, "IR"},
-    {"Tabriz", 38.0800, 46.2919, 4, "IR"},
-    {"Shiraz", 29.5918, 52.5837, 4, "IR"},
-    {"Qom", 34.6401, 50.8764, 4, "IR"},
-    {"Ahvaz", 31.3183, 48.6706, 4, "IR"},
-    {"Kermanshah", 34.3142, 47.0650, 4, "IR"},
-    {"Urmia", 37.5527, 45.0761, 4, "IR"},
-    {"Zahedan", 29.4963, 60.8629, 4, "IR"},
-    {"Rasht", 37.2808, 49.5832, 4, "IR"},
-    {"Kerman", 30.2832, 57.0788, 4, "IR"},
-    {"Hamadan", 34.7992, 48.5146, 4, "IR"},
-    {"Arak", 34.0954, 49.7013, 4, "IR"},
-    {"Yazd", 31.8974, 54.3569, 4, "IR"},
-    {"Ardabil", 38.2498, 48.2933, 4, "IR"},
-    {"Bandar Abbas", 27.1865, 56.2808, 4, "IR"},
-    {"Eslamshahr", 35.5522, 51.2301, 4, "IR"},
-    {"Zanjan", 36.6736, 48.4787, 4, "IR"},
-    {"Sanandaj", 35.3150, 46.9988, 4, "IR"},
-    {"Qazvin", 36.2688, 50.0041, 4, "IR"},
-    {"Khomeynishahr", 32.6857, 51.5264, 4, "IR"},
-    {"Dezful", 32.3846, 48.4798, 4, "IR"},
-    {"Nasim Shahr", 35.7061, 51.0097, 4, "IR"},
-    {"Khorramshahr", 30.4402, 48.1661, 4, "IR"},
-    {"Shahrud", 36.4181, 54.9756, 4, "IR"},
-    {"Gorgan", 36.8427, 54.4441, 4, "IR"},
-    {"Neyshabur", 36.2135, 58.7958, 4, "IR"},
-    {"Sari", 36.5633, 53.0601, 4, "IR"},
-    {"Babol", 36.5510, 52.6786, 4, "IR"},
-    {"Abadan", 30.3392, 48.3043, 4, "IR"},
-    {"Khorramabad", 33.4878, 48.3558, 4, "IR"},
-    {"Ilam", 33.6374, 46.4227, 4, "IR"},
-    {"Mahabad", 36.7630, 45.7222, 4, "IR"},
-    {"Varamin", 35.3236, 51.6456, 4, "IR"},
-    
-    // Iraq
-    {"Baghdad", 33.3152, 44.3661, 3, "IQ"},
-    {"Basra", 30.5085, 47.7804, 3, "IQ"},
-    {"Erbil", 36.1911, 44.0093, 3, "IQ"},
-    {"Najaf", 32.0000, 44.3333, 3, "IQ"},
-    {"Karbala", 32.6109, 44.0249, 3, "IQ"},
-    {"Mosul", 36.3350, 43.1189, 3, "IQ"},
-    {"Sulaymaniyah", 35.5650, 45.4329, 3, "IQ"},
-    {"Kirkuk", 35.4681, 44.3922, 3, "IQ"},
-    {"Hillah", 32.4722, 44.4397, 3, "IQ"},
-    {"Samarra", 34.1950, 43.8747, 3, "IQ"},
-    {"Ramadi", 33.4205, 43.3097, 3, "IQ"},
-    {"Fallujah", 33.3506, 43.7819, 3, "IQ"},
-    {"Tikrit", 34.6128, 43.6781, 3, "IQ"},
-    {"Baqubah", 33.7500, 44.6500, 3, "IQ"},
-    {"Nasiriyah", 31.0569, 46.2575, 3, "IQ"},
-    {"Amara", 31.8400, 47.1447, 3, "IQ"},
-    {"Kut", 32.5128, 45.8183, 3, "IQ"},
-    {"Diwaniyah", 31.9928, 44.9258, 3, "IQ"},
-    {"Dohuk", 36.8606, 42.9581, 3, "IQ"},
-    {"Zakho", 37.1431, 42.6881, 3, "IQ"},
-    
-    // Jordan
-    {"Amman", 31.9454, 35.9284, 2, "JO"},
-    {"Zarqa", 32.0728, 36.0876, 2, "JO"},
-    {"Irbid", 32.5556, 35.8500, 2, "JO"},
-    {"Aqaba", 29.5321, 35.0063, 2, "JO"},
-    {"Salt", 32.0393, 35.7270, 2, "JO"},
-    
-    // Lebanon
-    {"Beirut", 33.8938, 35.5018, 2, "LB"},
-    {"Tripoli", 34.4372, 35.8433, 2, "LB"},
-    {"Sidon", 33.5633, 35.3714, 2, "LB"},
-    {"Tyre", 33.2704, 35.2038, 2, "LB"},
-    
-    // Syria
-    {"Damascus", 33.5138, 36.2765, 2, "SY"},
-    {"Aleppo", 36.2021, 37.1343, 2, "SY"},
-    {"Homs", 34.7394, 36.7237, 2, "SY"},
-    {"Latakia", 35.5376, 35.7781, 2, "SY"},
-    
-    // Palestine/Israel
-    {"Jerusalem", 31.7683, 35.2137, 2, "PS"},
-    {"Gaza", 31.3547, 34.3088, 2, "PS"},
-    {"Tel Aviv", 32.0853, 34.7818, 2, "IL"},
-    {"Haifa", 32.7940, 35.0423, 2, "IL"},
-    
-    // Kuwait
-    {"Kuwait City", 29.3759, 47.9774, 3, "KW"},
-    {"Ahmadi", 29.0930, 48.0841, 3, "KW"},
-    {"Hawalli", 29.3326, 48.0286, 3, "KW"},
-    
-    // Qatar
-    {"Doha", 25.2854, 51.5310, 3, "QA"},
-    {"Al Rayyan", 25.2919, 51.4240, 3, "QA"},
-    {"Umm Salal", 25.4057, 51.4064, 3, "QA"},
-    
-    // Bahrain
-    {"Manama", 26.2285, 50.5860, 3, "BH"},
-    {"Riffa", 26.1467, 50.5550, 3, "BH"},
-    {"Muharraq", 26.2720, 50.6480, 3, "BH"},
-    
-    // Oman
-    {"Muscat", 23.5859, 58.4059, 4, "OM"},
-    {"Salalah", 17.0151, 54.0924, 4, "OM"},
-    {"Sohar", 24.3563, 56.7527, 4, "OM"},
-    
-    // Yemen
-    {"Sanaa", 15.3694, 44.1910, 3, "YE"},
-    {"Aden", 12.7797, 45.0365, 3, "YE"},
-    {"Taiz", 13.5795, 44.0206, 3, "YE"},
-    
-    // Morocco
-    {"Casablanca", 33.5731, -7.5898, 1, "MA"},
-    {"Rabat", 34.0209, -6.8416, 1, "MA"},
-    {"Fez", 34.0181, -5.0078, 1, "MA"},
-    {"Marrakech", 31.6295, -7.9811, 1, "MA"},
-    {"Agadir", 30.4278, -9.5981, 1, "MA"},
-    {"Tangier", 35.7595, -5.8340, 1, "MA"},
-    {"Meknes", 33.8935, -5.5473, 1, "MA"},
-    {"Oujda", 34.6814, -1.9086, 1, "MA"},
-    {"Kenitra", 34.2610, -6.5802, 1, "MA"},
-    {"Tetouan", 35.5889, -5.368, 1, "MA"},
-    {"Safi", 32.2994, -9.2372, 1, "MA"},
-    {"Mohammedia", 33.6866, -7.3837, 1, "MA"},
-    {"Khouribga", 32.8811, -6.9063, 1, "MA"},
-    {"El Jadida", 33.2316, -8.5007, 1, "MA"},
-    {"Beni Mellal", 32.3373, -6.3498, 1, "MA"},
-    {"Nador", 35.1681, -2.9287, 1, "MA"},
-    {"Taza", 34.2100, -4.0100, 1, "MA"},
-    {"Settat", 33.0013, -7.6161, 1, "MA"},
-    {"Larache", 35.1932, -6.1563, 1, "MA"},
-    {"Ksar El Kebir", 35.0017, -5.9044, 1, "MA"},
-    {"Khemisset", 33.8244, -6.0661, 1, "MA"},
-    {"Guelmim", 28.9870, -10.0574, 1, "MA"},
-    {"Berkane", 34.9181, -2.3217, 1, "MA"},
-    {"Taourirt", 34.4110, -2.8953, 1, "MA"},
-    {"Errachidia", 31.9314, -4.4244, 1, "MA"},
-    {"Ouarzazate", 30.9189, -6.8935, 1, "MA"},
-    {"Tiznit", 29.6974, -9.7316, 1, "MA"},
-    {"Al Hoceima", 35.2517, -3.9372, 1, "MA"},
-    {"Taroudannt", 30.4703, -8.8770, 1, "MA"},
-    {"Essaouira", 31.5085, -9.7595, 1, "MA"},
-    
-    // Algeria
-    {"Algiers", 36.7538, 3.0588, 1, "DZ"},
-    {"Oran", 35.6976, -0.6337, 1, "DZ"},
-    {"Constantine", 36.3650, 6.6147, 1, "DZ"},
-    {"Annaba", 36.9000, 7.7667, 1, "DZ"},
-    {"Blida", 36.4203, 2.8277, 1, "DZ"},
-    {"Batna", 35.5559, 6.1741, 1, "DZ"},
-    {"Djelfa", 34.6721, 3.2631, 1, "DZ"},
-    {"Setif", 36.1904, 5.4033, 1, "DZ"},
-    {"Sidi Bel Abbes", 35.1977, -0.6388, 1, "DZ"},
-    {"Biskra", 34.8481, 5.7281, 1, "DZ"},
-    {"Tebessa", 35.4975, 8.1207, 1, "DZ"},
-    {"El Oued", 33.3568, 6.8531, 1, "DZ"},
-    {"Skikda", 36.8761, 6.9086, 1, "DZ"},
-    {"Tiaret", 35.3712, 1.3170, 1, "DZ"},
-    {"Bejaïa", 36.7525, 5.0686, 1, "DZ"},
-    {"Tlemcen", 34.8780, -1.3150, 1, "DZ"},
-    {"Ouargla", 31.9539, 5.3281, 1, "DZ"},
-    {"Bechar", 31.6177, -2.2204, 1, "DZ"},
-    {"Mostaganem", 35.9315, 0.0892, 1, "DZ"},
-    {"Bordj Bou Arréridj", 36.0731, 4.7687, 1, "DZ"},
-    {"Chlef", 36.1654, 1.3347, 1, "DZ"},
-    {"Souk Ahras", 36.2863, 7.9518, 1, "DZ"},
-    {"El Tarf", 36.7672, 8.3137, 1, "DZ"},
-    {"Jijel", 36.8190, 5.7667, 1, "DZ"},
-    {"Relizane", 35.7361, 0.5558, 1, "DZ"},
-    {"Mascara", 35.3968, 0.1405, 1, "DZ"},
-    {"Ouled Djellal", 34.4134, 5.0921, 1, "DZ"},
-    {"Bou Saada", 35.2187, 4.1857, 1, "DZ"},
-    
-    // Tunisia
-    {"Tunis", 36.8065, 10.1815, 1, "TN"},
-    {"Sfax", 34.7406, 10.7603, 1, "TN"},
-    {"Sousse", 35.8256, 10.6411, 1, "TN"},
-    {"Kairouan", 35.6781, 10.0963, 1, "TN"},
-    {"Ettadhamen", 36.8749, 10.1823, 1, "TN"},
-    {"Bizerte", 37.2746, 9.8739, 1, "TN"},
-    {"Gabès", 33.8815, 10.0982, 1, "TN"},
-    {"Ariana", 36.8663, 10.1647, 1, "TN"},
-    {"Gafsa", 34.4250, 8.7842, 1, "TN"},
-    {"Kasserine", 35.1676, 8.8363, 1, "TN"},
-    {"Monastir", 35.7643, 10.8113, 1, "TN"},
-    {"Ben Arous", 36.7545, 10.2176, 1, "TN"},
-    {"Temara", 33.9178, 10.7166, 1, "TN"},
-    {"Mahdia", 35.5047, 11.0622, 1, "TN"},
-    {"El Kef", 36.1741, 8.7050, 1, "TN"},
-    {"Medenine", 33.3545, 10.5055, 1, "TN"},
-    {"Nabeul", 36.4561, 10.7376, 1, "TN"},
-    {"Tataouine", 32.9297, 10.4518, 1, "TN"},
-    {"Beja", 36.7256, 9.1816, 1, "TN"},
-    {"Jendouba", 36.5011, 8.7803, 1, "TN"},
-    {"Zaghouan", 36.4031, 10.1425, 1, "TN"},
-    {"Siliana", 36.0836, 9.3701, 1, "TN"},
-    {"Sidi Bouzid", 35.0388, 9.4891, 1, "TN"},
-    
-    // Libya
-    {"Tripoli", 32.8872, 13.1913, 2, "LY"},
-    {"Benghazi", 32.1165, 20.0686, 2, "LY"},
-    {"Misrata", 32.3764, 15.0925, 2, "LY"},
-    {"Bayda", 32.7569, 21.7559, 2, "LY"},
-    {"Sabha", 27.0377, 14.4283, 2, "LY"},
-    {"Zawiya", 32.7573, 12.7278, 2, "LY"},
-    {"Zliten", 32.4673, 14.5687, 2, "LY"},
-    {"Ajdabiya", 30.7554, 20.2263, 2, "LY"},
-    {"Tobruk", 32.0840, 23.9578, 2, "LY"},
-    {"Sirte", 31.2089, 16.5887, 2, "LY"},
-    {"Al Khums", 32.6487, 14.2617, 2, "LY"},
-    {"Marj", 32.4926, 20.8312, 2, "LY"},
-    {"Gharyan", 32.1728, 13.0203, 2, "LY"},
-    {"Derna", 32.7569, 22.6367, 2, "LY"},
-    {"Murzuq", 25.9154, 13.9180, 2, "LY"},
-    {"Ghat", 24.9648, 10.1802, 2, "LY"},
-    {"Waddan", 29.1614, 16.1390, 2, "LY"},
-    
-    // Sudan
-    {"Khartoum", 15.5007, 32.5599, 2, "SD"},
-    {"Omdurman", 15.6445, 32.4777, 2, "SD"},
-    {"Port Sudan", 19.6348, 37.2152, 2, "SD"},
-    
-    // Pakistan
-    {"Karachi", 24.8607, 67.0011, 5, "PK"},
-    {"Lahore", 31.5204, 74.3587, 5, "PK"},
-    {"Islamabad", 33.7294, 73.0931, 5, "PK"},
-    {"Faisalabad", 31.4504, 73.1350, 5, "PK"},
-    {"Rawalpindi", 33.5651, 73.0169, 5, "PK"},
-    {"Multan", 30.1575, 71.5249, 5, "PK"},
-    {"Hyderabad", 25.3960, 68.3578, 5, "PK"},
-    {"Gujranwala", 32.1877, 74.1945, 5, "PK"},
-    {"Peshawar", 34.0151, 71.5249, 5, "PK"},
-    {"Quetta", 30.1798, 66.9750, 5, "PK"},
-    
-    // India
-    {"New Delhi", 28.6139, 77.2090, 5, "IN"},
-    {"Mumbai", 19.0760, 72.8777, 5, "IN"},
-    {"Kolkata", 22.5726, 88.3639, 5, "IN"},
-    {"Chennai", 13.0827, 80.2707, 5, "IN"},
-    {"Bangalore", 12.9716, 77.5946, 5, "IN"},
-    {"Hyderabad", 17.3850, 78.4867, 5, "IN"},
-    {"Ahmedabad", 23.0225, 72.5714, 5, "IN"},
-    {"Pune", 18.5204, 73.8567, 5, "IN"},
-    {"Surat", 21.1702, 72.8311, 5, "IN"},
-    {"Jaipur", 26.9124, 75.7873, 5, "IN"},
-    {"Lucknow", 26.8467, 80.9462, 5, "IN"},
-    {"Kanpur", 26.4499, 80.3319, 5, "IN"},
-    {"Nagpur", 21.1458, 79.0882, 5, "IN"},
-    {"Indore", 22.7196, 75.8577, 5, "IN"},
-    {"Bhopal", 23.2599, 77.4126, 5, "IN"},
-    {"Visakhapatnam", 17.6868, 83.2185, 5, "IN"},
-    {"Patna", 25.5941, 85.1376, 5, "IN"},
-    {"Vadodara", 22.3072, 73.1812, 5, "IN"},
-    {"Ghaziabad", 28.6692, 77.4538, 5, "IN"},
-    {"Ludhiana", 30.9010, 75.8573, 5, "IN"},
-    {"Agra", 27.1767, 78.0081, 5, "IN"},
-    {"Nashville", 11.0168, 76.9558, 5, "IN"},
-    {"Faridabad", 28.4089, 77.3178, 5, "IN"},
-    {"Meerut", 28.9845, 77.7064, 5, "IN"},
-    {"Rajkot", 22.3039, 70.8022, 5, "IN"},
-    {"Kalyan", 19.2403, 73.1305, 5, "IN"},
-    {"Vasai-Virar", 19.4912, 72.8054, 5, "IN"},
-    {"Varanasi", 25.3176, 82.9739, 5, "IN"},
-    {"Srinagar", 34.0837, 74.7973, 5, "IN"},
-    {"Aurangabad", 19.8762, 75.3433, 5, "IN"},
-    {"Dhanbad", 23.7957, 86.4304, 5, "IN"},
-    {"Amritsar", 31.6340, 74.8723, 5, "IN"},
-    {"Navi Mumbai", 19.0330, 73.0297, 5, "IN"},
-    {"Allahabad", 25.4358, 81.8463, 5, "IN"},
-    {"Ranchi", 23.3441, 85.3096, 5, "IN"},
-    {"Howrah", 22.5958, 88.2636, 5, "IN"},
-    {"Coimbatore", 11.0168, 76.9558, 5, "IN"},
-    {"Jabalpur", 23.1815, 79.9864, 5, "IN"},
-    {"Gwalior", 26.2183, 78.1828, 5, "IN"},
-    {"Vijayawada", 16.5062, 80.6480, 5, "IN"},
-    {"Jodhpur", 26.2389, 73.0243, 5, "IN"},
-    {"Madurai", 9.9252, 78.1198, 5, "IN"},
-    {"Raipur", 21.2514, 81.6296, 5, "IN"},
-    {"Kota", 25.2138, 75.8648, 5, "IN"},
-    {"Guwahati", 26.1445, 91.7362, 5, "IN"},
-    {"Chandigarh", 30.7333, 76.7794, 5, "IN"},
-    {"Solapur", 17.6599, 75.9064, 5, "IN"},
-    {"Hubli-Dharwad", 15.3647, 75.1240, 5, "IN"},
-    {"Bareilly", 28.3670, 79.4304, 5, "IN"},
-    {"Moradabad", 28.8386, 78.7733, 5, "IN"},
-    {"Mysore", 12.2958, 76.6394, 5, "IN"},
-    {"Gurgaon", 28.4595, 77.0266, 5, "IN"},
-    {"Aligarh", 27.8974, 78.0880, 5, "IN"},
-    {"Jalandhar", 31.3260, 75.5762, 5, "IN"},
-    {"Tiruchirappalli", 10.7905, 78.7047, 5, "IN"},
-    {"Bhubaneswar", 20.2961, 85.8245, 5, "IN"},
-    {"Salem", 11.6643, 78.1460, 5, "IN"},
-    {"Warangal", 17.9689, 79.5941, 5, "IN"},
-    {"Mira-Bhayandar", 19.2952, 72.8544, 5, "IN"},
-    {"Thiruvananthapuram", 8.5241, 76.9366, 5, "IN"},
-    {"Bhiwandi", 19.3002, 73.0577, 5, "IN"},
-    {"Saharanpur", 29.9680, 77.5552, 5, "IN"},
-    {"Guntur", 16.3067, 80.4365, 5, "IN"},
-    {"Amravati", 20.9374, 77.7796, 5, "IN"},
-    {"Bikaner", 28.0229, 73.3119, 5, "IN"},
-    {"Noida", 28.5355, 77.3910, 5, "IN"},
-    {"Jamshedpur", 22.8046, 86.2029, 5, "IN"},
-    {"Bhilai Nagar", 21.1938, 81.3509, 5, "IN"},
-    {"Cuttack", 20.4625, 85.8828, 5, "IN"},
-    
-    // Bangladesh
-    {"Dhaka", 23.8103, 90.4125, 6, "BD"},
-    {"Chittagong", 22.3569, 91.7832, 6, "BD"},
-    {"Sylhet", 24.8949, 91.8687, 6, "BD"},
-    {"Rajshahi", 24.3745, 88.6042, 6, "BD"},
-    {"Khulna", 22.8456, 89.5403, 6, "BD"},
-    {"Barisal", 22.7010, 90.3535, 6, "BD"},
-    
-    // Afghanistan
-    {"Kabul", 34.5553, 69.2075, 4, "AF"},
-    {"Kandahar", 31.6180, 65.7372, 4, "AF"},
-    {"Herat", 34.3482, 62.1997, 4, "AF"},
-    {"Mazar-i-Sharif", 36.7081, 67.1103, 4, "AF"},
-    {"Jalalabad", 34.4257, 70.4518, 4, "AF"},
-    {"Kunduz", 36.7289, 68.8539, 4, "AF"},
-    {"Ghazni", 33.5539, 68.4173, 4, "AF"},
-    {"Lashkar Gah", 31.5836, 64.3708, 4, "AF"},
-    {"Khost", 33.3378, 69.9167, 4, "AF"},
-    {"Taloqan", 36.7356, 69.5347, 4, "AF"},
-    {"Pul-e-Khumri", 35.9442, 68.7153, 4, "AF"},
-    {"Faizabad", 37.1167, 70.5833, 4, "AF"},
-    {"Gardez", 33.5969, 69.2228, 4, "AF"},
-    {"Bamyan", 34.8208, 67.8256, 4, "AF"},
-    
-    // Indonesia
-    {"Jakarta", -6.2088, 106.8456, 7, "ID"},
-    {"Surabaya", -7.2575, 112.7521, 7, "ID"},
-    {"Bandung", -6.9175, 107.6191, 7, "ID"},
-    {"Medan", 3.5952, 98.6722, 7, "ID"},
-    {"Bekasi", -6.2383, 106.9756, 7, "ID"},
-    {"Tangerang", -6.1783, 106.6319, 7, "ID"},
-    {"Depok", -6.4025, 106.7942, 7, "ID"},
-    {"Semarang", -6.9667, 110.4167, 7, "ID"},
-    {"Palembang", -2.9761, 104.7754, 7, "ID"},
-    {"Makassar", -5.1477, 119.4327, 8, "ID"},
-    {"Yogyakarta", -7.7956, 110.3695, 7, "ID"},
-    {"Denpasar", -8.6500, 115.2167, 8, "ID"},
-    {"Malang", -7.9797, 112.6304, 7, "ID"},
-    {"Bogor", -6.5944, 106.7892, 7, "ID"},
-    {"Batam", 1.1307, 104.0533, 7, "ID"},
-    {"Pekanbaru", 0.5333, 101.4500, 7, "ID"},
-    {"Bandar Lampung", -5.3971, 105.2668, 7, "ID"},
-    {"Padang", -0.9492, 100.3543, 7, "ID"},
-    {"Samarinda", -0.5000, 117.1533, 8, "ID"},
-    {"Balikpapan", -1.2675, 116.8289, 8, "ID"},
-    {"Jambi", -1.6101, 103.6131, 7, "ID"},
-    {"Cimahi", -6.8721, 107.5428, 7, "ID"},
-    {"Surakarta", -7.5563, 110.8316, 7, "ID"},
-    {"Banjarmasin", -3.3194, 114.5906, 8, "ID"},
-    {"Kupang", -10.1718, 123.6044, 8, "ID"},
-    {"Pontianak", -0.0263, 109.3425, 7, "ID"},
-    {"Manado", 1.4748, 124.8421, 8, "ID"},
-    {"Ambon", -3.6954, 128.1814, 9, "ID"},
-    {"Jayapura", -2.5489, 140.7197, 9, "ID"},
-    {"Banda Aceh", 5.5483, 95.3238, 7, "ID"},
-    {"Mataram", -8.5729, 116.1004, 8, "ID"},
-    {"Kendari", -3.9450, 122.4989, 8, "ID"},
-    {"Palu", -0.8917, 119.8707, 8, "ID"},
-    {"Ternate", 0.7875, 127.3783, 9, "ID"},
-    {"Bengkulu", -3.8004, 102.2655, 7, "ID"},
-    {"Gorontalo", 0.5435, 123.0682, 8, "ID"},
-    {"Mamuju", -2.6763, 118.8947, 8, "ID"},
-    {"Sorong", -0.8833, 131.2500, 9, "ID"},
-    
-    // Malaysia
-    {"Kuala Lumpur", 3.1390, 101.6869, 8, "MY"},
-    {"George Town", 5.4164, 100.3327, 8, "MY"},
-    {"Ipoh", 4.5841, 101.0829, 8, "MY"},
-    {"Shah Alam", 3.0733, 101.5185, 8, "MY"},
-    {"Petaling Jaya", 3.1073, 101.6067, 8, "MY"},
-    {"Johor Bahru", 1.4655, 103.7578, 8, "MY"},
-    {"Kota Kinabalu", 5.9804, 116.0735, 8, "MY"},
-    {"Kuching", 1.5533, 110.3592, 8, "MY"},
-    {"Subang Jaya", 3.1513, 101.5864, 8, "MY"},
-    {"Ampang Jaya", 3.1478, 101.7617, 8, "MY"},
-    {"Kuantan", 3.8077, 103.3260, 8, "MY"},
-    {"Alor Setar", 6.1248, 100.3678, 8, "MY"},
-    {"Sandakan", 5.8402, 118.1179, 8, "MY"},
-    {"Taiping", 4.8511, 100.7208, 8, "MY"},
-    {"Sibu", 2.3000, 111.8167, 8, "MY"},
-    {"Miri", 4.3897, 113.9911, 8, "MY"},
-    {"Kuala Terengganu", 5.3302, 103.1408, 8, "MY"},
-    {"Bintulu", 3.1667, 113.0333, 8, "MY"},
-    {"Kota Bharu", 6.1333, 102.2500, 8, "MY"},
-    {"Sungai Petani", 5.6469, 100.4877, 8, "MY"},
-    {"Tawau", 4.2546, 117.8906, 8, "MY"},
-    {"Kulim", 5.3667, 100.5667, 8, "MY"},
-    {"Muar", 2.0442, 102.5689, 8, "MY"},
-    {"Teluk Intan", 4.0225, 101.0217, 8, "MY"},
-    {"Batu Pahat", 1.8542, 102.9325, 8, "MY"},
-    {"Kluang", 2.0333, 103.3167, 8, "MY"},
-    {"Port Dickson", 2.5394, 101.8069, 8, "MY"},
-    {"Pasir Gudang", 1.4731, 103.9048, 8, "MY"},
-    {"Nilai", 2.8208, 101.7971, 8, "MY"},
-    {"Rawang", 3.3214, 101.5764, 8, "MY"},
-    {"Segamat", 2.5167, 102.8167, 8, "MY"},
-    {"Temerloh", 3.4500, 102.4167, 8, "MY"},
-    {"Bentong", 3.5225, 101.9086, 8, "MY"},
-    {"Bagan Serai", 5.0094, 100.5481, 8, "MY"},
-    {"Raub", 3.7900, 101.8567, 8, "MY"},
-    {"Bukit Mertajam", 5.3631, 100.4631, 8, "MY"},
-    {"Lumut", 4.2319, 100.6297, 8, "MY"},
-    {"Klang", 3.0442, 101.4450, 8, "MY"},
-    {"Kajang", 2.9923, 101.7901, 8, "MY"},
-    {"Seremban", 2.7297, 101.9381, 8, "MY"},
-    {"Malacca", 2.1896, 102.2501, 8, "MY"},
-    {"Kuala Selangor", 3.3392, 101.2517, 8, "MY"},
-    {"Kepala Batas", 5.5167, 100.3833, 8, "MY"},
-    
-    // Singapore
-    {"Singapore", 1.3521, 103.8198, 8, "SG"},
-    
-    // Brunei
-    {"Bandar Seri Begawan", 4.9031, 114.9398, 8, "BN"},
-    
-    // Thailand
-    {"Bangkok", 13.7563, 100.5018, 7, "TH"},
-    {"Chiang Mai", 18.7883, 98.9853, 7, "TH"},
-    {"Phuket", 7.8804, 98.3923, 7, "TH"},
-    {"Pattaya", 12.9236, 100.8825, 7, "TH"},
-    {"Hat Yai", 7.0167, 100.4667, 7, "TH"},
-    {"Nakhon Ratchasima", 14.9799, 102.0977, 7, "TH"},
-    {"Khon Kaen", 16.4419, 102.8360, 7, "TH"},
-    {"Udon Thani", 17.4138, 102.7858, 7, "TH"},
-    {"Chiang Rai", 19.9105, 99.8406, 7, "TH"},
-    {"Rayong", 12.6806, 101.2567, 7, "TH"},
-    {"Pitsanulok", 16.8211, 100.2659, 7, "TH"},
-    {"Lampang", 18.2932, 99.4837, 7, "TH"},
-    {"Nakhon Si Thammarat", 8.4304, 99.9631, 7, "TH"},
-    {"Ubon Ratchathani", 15.2286, 104.8558, 7, "TH"},
-    {"Songkhla", 7.1756, 100.5921, 7, "TH"},
-    {"Nonthaburi", 13.8621, 100.5144, 7, "TH"},
-    {"Pak Kret", 13.9097, 100.5033, 7, "TH"},
-    {"Si Racha", 13.1736, 100.9319, 7, "TH"},
-    {"Trang", 7.5563, 99.6114, 7, "TH"},
-    {"Krabi", 8.0863, 98.9063, 7, "TH"},
-    {"Hua Hin", 12.5706, 99.9581, 7, "TH"},
-    {"Saraburi", 14.5289, 100.9106, 7, "TH"},
-    {"Surin", 14.8818, 103.4936, 7, "TH"},
-    {"Surat Thani", 9.1382, 99.3215, 7, "TH"},
-    {"Nakhon Pathom", 13.8199, 100.0642, 7, "TH"},
-    {"Ratchaburi", 13.5282, 99.8133, 7, "TH"},
-    {"Phetchabun", 16.4192, 101.1608, 7, "TH"},
-    {"Samut Prakan", 13.5990, 100.5998, 7, "TH"},
-    {"Chon Buri", 13.3611, 100.9847, 7, "TH"},
-    {"Nakhon Nayok", 14.2069, 101.2130, 7, "TH"},
-    {"Kanchanaburi", 14.0227, 99.5478, 7, "TH"},
-    {"Mae Sot", 16.7161, 98.5644, 7, "TH"},
-    {"Phrae", 18.1459, 100.1410, 7, "TH"},
-    {"Nan", 18.7838, 100.7792, 7, "TH"},
-    {"Phayao", 19.1921, 99.8986, 7, "TH"},
-    {"Sukhothai", 17.0061, 99.8230, 7, "TH"},
-    {"Uttaradit", 17.6200, 100.0992, 7, "TH"},
-    {"Tak", 16.8834, 99.1328, 7, "TH"},
-    {"Phitsanulok", 16.8211, 100.2659, 7, "TH"},
-    {"Lop Buri", 14.7995, 100.6533, 7, "TH"},
-    {"Ayutthaya", 14.3692, 100.5877, 7, "TH"},
-    
-    // Philippines
-    {"Manila", 14.5995, 120.9842, 8, "PH"},
-    {"Quezon City", 14.6760, 121.0437, 8, "PH"},
-    {"Davao", 7.1907, 125.4553, 8, "PH"},
-    {"Cebu", 10.3157, 123.8854, 8, "PH"},
-    {"Caloocan", 14.6507, 120.9678, 8, "PH"},
-    {"Zamboanga City", 6.9214, 122.0790, 8, "PH"},
-    {"Taguig", 14.5176, 121.0509, 8, "PH"},
-    {"Antipolo", 14.5873, 121.1755, 8, "PH"},
-    {"Pasig", 14.5764, 121.0851, 8, "PH"},
-    {"Cagayan de Oro", 8.4542, 124.6319, 8, "PH"},
-    {"Paranaque", 14.4779, 121.0198, 8, "PH"},
-    {"Dasmarinas", 14.3294, 120.9367, 8, "PH"},
-    {"Valenzuela", 14.7000, 120.9833, 8, "PH"},
-    {"Bacoor", 14.4590, 120.9395, 8, "PH"},
-    {"General Santos", 6.1164, 125.1716, 8, "PH"},
-    {"Las Pinas", 14.4506, 120.9822, 8, "PH"},
-    {"Makati", 14.5547, 121.0244, 8, "PH"},
-    {"Marikina", 14.6507, 121.1029, 8, "PH"},
-    {"Muntinlupa", 14.4072, 121.0398, 8, "PH"},
-    {"Mandaluyong", 14.5794, 121.0359, 8, "PH"},
-    {"Bacolod", 10.6319, 122.9951, 8, "PH"},
-    {"San Jose del Monte", 14.8136, 121.0453, 8, "PH"},
-    {"Iligan", 8.2280, 124.2452, 8, "PH"},
-    {"Marikina", 14.6507, 121.1029, 8, "PH"},
-    {"Malabon", 14.6553, 120.9662, 8, "PH"},
-    {"Navotas", 14.6691, 120.9484, 8, "PH"},
-    {"Angeles", 15.1500, 120.5833, 8, "PH"},
-    {"Iloilo", 10.7202, 122.5621, 8, "PH"},
-    {"Butuan", 8.9475, 125.5436, 8, "PH"},
-    {"Tarlac", 15.4778, 120.5958, 8, "PH"},
-    {"Olongapo", 14.8294, 120.2825, 8, "PH"},
-    {"Cabanatuan", 15.4858, 120.9653, 8, "PH"},
-    {"San Fernando", 15.0333, 120.6833, 8, "PH"},
-    {"Laoag", 18.1969, 120.5928, 8, "PH"},
-    {"Baguio", 16.4023, 120.5960, 8, "PH"},
-    {"Legazpi", 13.1391, 123.7436, 8, "PH"},
-    {"Tacloban", 11.2428, 125.0072, 8, "PH"},
-    {"Naga", 13.6218, 123.1948, 8, "PH"},
-    {"Dagupan", 16.0433, 120.3383, 8, "PH"},
-    {"Malolos", 14.8433, 120.8108, 8, "PH"},
-    {"San Pablo", 14.0683, 121.3256, 8, "PH"},
-    {"Batangas City", 13.7565, 121.0583, 8, "PH"},
-    {"Lucena", 13.9372, 121.617, 8, "PH"},
-    {"Imus", 14.4297, 120.9367, 8, "PH"},
-    {"General Trias", 14.3858, 120.8803, 8, "PH"},
-    {"Trece Martires", 14.2833, 120.8667, 8, "PH"},
-    
-    // Vietnam
-    {"Ho Chi Minh City", 10.8231, 106.6297, 7, "VN"},
-    {"Hanoi", 21.0285, 105.8542, 7, "VN"},
-    {"Da Nang", 16.0471, 108.2068, 7, "VN"},
-    {"Hai Phong", 20.8449, 106.6881, 7, "VN"},
-    {"Can Tho", 10.0452, 105.7469, 7, "VN"},
-    {"Bien Hoa", 10.9451, 106.8238, 7, "VN"},
-    {"Hue", 16.4637, 107.5909, 7, "VN"},
-    {"Nha Trang", 12.2388, 109.1967, 7, "VN"},
-    {"Buon Ma Thuot", 12.6667, 108.0833, 7, "VN"},
-    {"Quy Nhon", 13.7667, 109.2333, 7, "VN"},
-    {"Vung Tau", 10.3460, 107.0843, 7, "VN"},
-    {"Nam Dinh", 20.4167, 106.1667, 7, "VN"},
-    {"Phan Thiet", 10.9333, 108.1000, 7, "VN"},
-    {"Long Xuyen", 10.3833, 105.4333, 7, "VN"},
-    {"Thai Nguyen", 21.5833, 105.8333, 7, "VN"},
-    {"Thanh Hoa", 19.8000, 105.7667, 7, "VN"},
-    {"Rach Gia", 10.0167, 105.0833, 7, "VN"},
-    {"Cam Ranh", 11.9214, 109.1583, 7, "VN"},
-    {"Vinh", 18.6833, 105.6833, 7, "VN"},
-    {"My Tho", 10.3500, 106.3667, 7, "VN"},
-    {"Da Lat", 11.9404, 108.4583, 7, "VN"},
-    {"Cao Lanh", 10.4667, 105.6333, 7, "VN"},
-    {"Pleiku", 13.9833, 108.0000, 7, "VN"},
-    {"Kontum", 14.3500, 107.9833, 7, "VN"},
-    {"Dong Hoi", 17.4833, 106.6000, 7, "VN"},
-    {"Tam Ky", 15.5667, 108.4833, 7, "VN"},
-    {"Vi Thanh", 9.7833, 105.4667, 7, "VN"},
-    {"Phu Ly", 20.5400, 105.9167, 7, "VN"},
-    {"Uong Bi", 21.0333, 106.7667, 7, "VN"},
-    {"Bac Lieu", 9.2833, 105.7167, 7, "VN"},
-    {"Nghi Son", 19.5833, 105.8167, 7, "VN"},
-    {"Soc Trang", 9.6000, 105.9667, 7, "VN"},
-    {"Kon Tum", 14.3500, 107.9833, 7, "VN"},
-    {"Ha Tinh", 18.3333, 105.9000, 7, "VN"},
-    {"Bac Giang", 21.2667, 106.2000, 7, "VN"},
-    {"Viet Tri", 21.3167, 105.4333, 7, "VN"},
-    {"Ben Tre", 10.2333, 106.3833, 7, "VN"},
-    {"Bac Kan", 22.1500, 105.8333, 7, "VN"},
-    {"Ca Mau", 9.1833, 105.1500, 7, "VN"},
-    {"Tra Vinh", 9.9500, 106.3333, 7, "VN"},
-    
-    // China
-    {"Beijing", 39.9042, 116.4074, 8, "CN"},
-    {"Shanghai", 31.2304, 121.4737, 8, "CN"},
-    {"Guangzhou", 23.1291, 113.2644, 8, "CN"},
-    {"Shenzhen", 22.5431, 114.0579, 8, "CN"},
-    {"Chengdu", 30.5728, 104.0668, 8, "CN"},
-    {"Tianjin", 39.3434, 117.3616, 8, "CN"},
-    {"Wuhan", 30.5928, 114.3055, 8, "CN"},
-    {"Xi'an", 34.3416, 108.9398, 8, "CN"},
-    {"Hangzhou", 30.2741, 120.1551, 8, "CN"},
-    {"Nanjing", 32.0603, 118.7969, 8, "CN"},
-    {"Chongqing", 29.4316, 106.9123, 8, "CN"},
-    {"Qingdao", 36.0986, 120.3719, 8, "CN"},
-    {"Dalian", 38.9140, 121.6147, 8, "CN"},
-    {"Urumqi", 43.8256, 87.6168, 8, "CN"},
-    {"Dongguan", 23.0489, 113.7447, 8, "CN"},
-    {"Foshan", 23.0218, 113.1219, 8, "CN"},
-    {"Shenyang", 41.8057, 123.4315, 8, "CN"},
-    {"Harbin", 45.7732, 126.6614, 8, "CN"},
-    {"Suzhou", 31.2989, 120.5853, 8, "CN"},
-    {"Zhengzhou", 34.7466, 113.6254, 8, "CN"},
-    {"Jinan", 36.6512, 117.1201, 8, "CN"},
-    {"Changsha", 28.2282, 112.9388, 8, "CN"},
-    {"Kunming", 25.0389, 102.7183, 8, "CN"},
-    {"Taiyuan", 37.8706, 112.5489, 8, "CN"},
-    {"Xiamen", 24.4798, 118.0819, 8, "CN"},
-    {"Hefei", 31.8639, 117.2808, 8, "CN"},
-    {"Shijiazhuang", 38.0428, 114.5149, 8, "CN"},
-    {"Changchun", 43.8175, 125.3235, 8, "CN"},
-    {"Wenzhou", 27.9944, 120.6694, 8, "CN"},
-    {"Ningbo", 29.8683, 121.5440, 8, "CN"},
-    {"Wuxi", 31.4912, 120.3124, 8, "CN"},
-    {"Lanzhou", 36.0611, 103.8343, 8, "CN"},
-    {"Nanchang", 28.6820, 115.8581, 8, "CN"},
-    {"Fuzhou", 26.0745, 119.2965, 8, "CN"},
-    {"Nanning", 22.8170, 108.3669, 8, "CN"},
-    {"Guiyang", 26.6477, 106.6302, 8, "CN"},
-    {"Tangshan", 39.6243, 118.1944, 8, "CN"},
-    {"Baotou", 40.6522, 109.8403, 8, "CN"},
-    {"Zibo", 36.8133, 118.0548, 8, "CN"},
-    {"Yantai", 37.5365, 121.3997, 8, "CN"},
-    {"Weifang", 36.7067, 119.1619, 8, "CN"},
-    {"Hohhot", 40.8414, 111.7522, 8, "CN"},
-    {"Handan", 36.6253, 114.5392, 8, "CN"},
-    {"Zhuhai", 22.2769, 113.5678, 8, "CN"},
-    {"Jining", 35.4151, 116.5872, 8, "CN"},
-    {"Luoyang", 34.6186, 112.4537, 8, "CN"},
-    {"Baoding", 38.8740, 115.4648, 8, "CN"},
-    {"Anshan", 41.1089, 122.9944, 8, "CN"},
-    {"Xuzhou", 34.2058, 117.2840, 8, "CN"},
-    {"Shaoxing", 30.0003, 120.5810, 8, "CN"},
-    {"Jinhua", 29.1062, 119.6494, 8, "CN"},
-    {"Liuzhou", 24.3146, 109.4281, 8, "CN"},
-    {"Yangzhou", 32.3972, 119.4215, 8, "CN"},
-    {"Xining", 36.6171, 101.7782, 8, "CN"},
-    {"Yinchuan", 38.4681, 106.2731, 8, "CN"},
-    {"Lhasa", 29.6544, 91.1206, 8, "CN"},
-    
-    // Kazakhstan
-    {"Almaty", 43.2220, 76.8512, 6, "KZ"},
-    {"Nur-Sultan", 51.1605, 71.4704, 6, "KZ"},
-    {"Shymkent", 42.3000, 69.5667, 6, "KZ"},
-    {"Aktobe", 50.3000, 57.1667, 5, "KZ"},
-    {"Taraz", 42.9000, 71.3667, 6, "KZ"},
-    {"Pavlodar", 52.3000, 76.9500, 6, "KZ"},
-    {"Ust-Kamenogorsk", 49.9500, 82.6167, 6, "KZ"},
-    {"Semey", 50.4111, 80.2275, 6, "KZ"},
-    {"Aktau", 43.6500, 51.2000, 5, "KZ"},
-    {"Kostanay", 53.2167, 63.6333, 6, "KZ"},
-    {"Kyzylorda", 44.8500, 65.5167, 6, "KZ"},
-    {"Oral", 51.2333, 51.3667, 5, "KZ"},
-    {"Atyrau", 47.1167, 51.8833, 5, "KZ"},
-    {"Petropavlovsk", 54.8667, 69.1500, 6, "KZ"},
-    {"Temirtau", 50.0667, 72.9667, 6, "KZ"},
-    {"Aktau", 43.6500, 51.2000, 5, "KZ"},
-    {"Rudny", 52.9667, 63.1333, 6, "KZ"},
-    {"Ekibastuz", 51.7167, 75.3167, 6, "KZ"},
-    {"Taldykorgan", 45.0167, 78.3833, 6, "KZ"},
-    {"Zhezkazgan", 47.8000, 67.7167, 6, "KZ"},
-    {"Turkestan", 43.2975, 68.2519, 6, "KZ"},
-    
-    // Uzbekistan
-    {"Tashkent", 41.2995, 69.2401, 5, "UZ"},
-    {"Samarkand", 39.6270, 66.9750, 5, "UZ"},
-    {"Namangan", 40.9983, 71.6726, 5, "UZ"},
-    {"Bukhara", 39.7747, 64.4286, 5, "UZ"},
-    {"Andijan", 40.7821, 72.3442, 5, "UZ"},
-    {"Nukus", 42.4608, 59.6105, 5, "UZ"},
-    {"Fergana", 40.3842, 71.7843, 5, "UZ"},
-    {"Kokand", 40.5283, 70.9428, 5, "UZ"},
-    {"Margilan", 40.4731, 71.7249, 5, "UZ"},
-    {"Chirchiq", 41.4681, 69.5822, 5, "UZ"},
-    {"Termez", 37.2242, 67.2783, 5, "UZ"},
-    {"Angren", 41.0167, 70.1436, 5, "UZ"},
-    {"Jizzakh", 40.1158, 67.8422, 5, "UZ"},
-    {"Navoi", 40.0844, 65.3792, 5, "UZ"},
-    {"Qarshi", 38.8606, 65.7892, 5, "UZ"},
-    {"Gulistan", 40.4892, 68.7842, 5, "UZ"},
-    {"Urgench", 41.5500, 60.6333, 5, "UZ"},
-    {"Bekabad", 40.2167, 69.2667, 5, "UZ"},
-    {"Khiva", 41.3775, 60.3619, 5, "UZ"},
-    {"Denau", 38.2667, 67.9000, 5, "UZ"},
-    
-    // Kyrgyzstan
-    {"Bishkek", 42.8746, 74.5698, 6, "KG"},
-    {"Osh", 40.5283, 72.7985, 6, "KG"},
-    {"Jalal-Abad", 40.9333, 72.9333, 6, "KG"},
-    {"Karakol", 42.4908, 78.3933, 6, "KG"},
-    {"Tokmok", 42.8419, 75.2981, 6, "KG"},
-    {"Uzgen", 40.7667, 73.3000, 6, "KG"},
-    {"Naryn", 41.4286, 76.0039, 6, "KG"},
-    {"Talas", 42.5228, 72.2428, 6, "KG"},
-    {"Batken", 40.0619, 70.8181, 6, "KG"},
-    {"Kant", 42.8919, 74.8517, 6, "KG"},
-    {"Kara-Balta", 42.8142, 73.8497, 6, "KG"},
-    {"Cholpon-Ata", 42.6486, 77.0831, 6, "KG"},
-    {"Kara-Suu", 40.7044, 72.8697, 6, "KG"},
-    {"Balykchy", 42.4603, 76.1869, 6, "KG"},
-    
-    // Tajikistan
-    {"Dushanbe", 38.5598, 68.7870, 5, "TJ"},
-    {"Khujand", 40.2833, 69.6167, 5, "TJ"},
-    {"Kulob", 37.9164, 69.7850, 5, "TJ"},
-    {"Qurghonteppa", 37.8353, 68.7811, 5, "TJ"},
-    {"Istaravshan", 39.9142, 69.0031, 5, "TJ"},
-    {"Isfara", 40.1281, 70.6275, 5, "TJ"},
-    {"Panjakent", 39.4944, 67.6097, 5, "TJ"},
-    {"Kanibadam", 40.2992, 69.5142, 5, "TJ"},
-    {"Tursunzoda", 38.5144, 68.3142, 5, "TJ"},
-    {"Vahdat", 38.5567, 68.9731, 5, "TJ"},
-    {"Khorugh", 37.4903, 71.5533, 5, "TJ"},
-    {"Hisor", 38.5239, 68.5478, 5, "TJ"},
-    {"Bokhtar", 37.8353, 68.7811, 5, "TJ"},
-    {"Dangara", 38.0944, 69.3342, 5, "TJ"},
-    
-    // Turkmenistan
-    {"Ashgabat", 37.9601, 58.3261, 5, "TM"},
-    {"Turkmenbashi", 40.0225, 52.9553, 5, "TM"},
-    {"Dashoguz", 41.8367, 59.9667, 5, "TM"},
-    {"Mary", 37.5947, 61.8306, 5, "TM"},
-    {"Balkanabat", 39.5108, 54.3667, 5, "TM"},
-    {"Bayramaly", 37.6167, 62.1667, 5, "TM"},
-    {"Turkmenbashi", 40.0225, 52.9553, 5, "TM"},
-    {"Serdar", 38.9667, 56.2833, 5, "TM"},
-    {"Gumdag", 38.4667, 56.5167, 5, "TM"},
-    {"Magdanly", 35.4833, 62.0833, 5, "TM"},
-    {"Tejen", 37.3833, 60.5000, 5, "TM"},
-    {"Yoloten", 37.2967, 62.3556, 5, "TM"},
-    
-    // Azerbaijan
-    {"Baku", 40.4093, 49.8671, 4, "AZ"},
-    {"Ganja", 40.6828, 46.3606, 4, "AZ"},
-    
-    // Georgia
-    {"Tbilisi", 41.7151, 44.8271, 4, "GE"},
-    {"Batumi", 41.6168, 41.6367, 4, "GE"},
-    {"Kutaisi", 42.2679, 42.7059, 4, "GE"},
-    {"Rustavi", 41.5495, 44.9991, 4, "GE"},
-    {"Gori", 41.9847, 44.1086, 4, "GE"},
-    {"Zugdidi", 42.5088, 41.8708, 4, "GE"},
-    {"Poti", 42.1508, 41.6675, 4, "GE"},
-    {"Kobuleti", 41.8192, 41.7750, 4, "GE"},
-    {"Khashuri", 41.9928, 43.5997, 4, "GE"},
-    {"Samtredia", 42.1642, 42.3300, 4, "GE"},
-    {"Senaki", 42.2736, 42.0658, 4, "GE"},
-    {"Zestaponi", 42.1094, 43.0556, 4, "GE"},
-    {"Marneuli", 41.4756, 44.8067, 4, "GE"},
-    {"Telavi", 41.9167, 45.4667, 4, "GE"},
-    
-    // Armenia
-    {"Yerevan", 40.1792, 44.4991, 4, "AM"},
-    {"Gyumri", 40.7894, 43.8406, 4, "AM"},
-    {"Vanadzor", 40.8058, 44.4939, 4, "AM"},
-    {"Vagharshapat", 40.1561, 44.2919, 4, "AM"},
-    {"Hrazdan", 40.4975, 44.7658, 4, "AM"},
-    {"Abovyan", 40.2694, 44.6358, 4, "AM"},
-    {"Kapan", 39.2069, 46.4053, 4, "AM"},
-    {"Armavir", 40.1539, 43.9994, 4, "AM"},
-    {"Gavar", 40.3617, 45.1256, 4, "AM"},
-    {"Artashat", 39.9597, 44.5553, 4, "AM"},
-    {"Goris", 39.5061, 46.3392, 4, "AM"},
-    {"Ashtarak", 40.2942, 44.3597, 4, "AM"},
-    
-    // Russia
-    {"Moscow", 55.7558, 37.6176, 3, "RU"},
-    {"Saint Petersburg", 59.9311, 30.3609, 3, "RU"},
-    {"Novosibirsk", 55.0084, 82.9357, 7, "RU"},
-    {"Yekaterinburg", 56.8431, 60.6454, 5, "RU"},
-    {"Nizhny Novgorod", 56.2965, 43.9361, 3, "RU"},
-    {"Kazan", 55.8304, 49.0661, 3, "RU"},
-    {"Chelyabinsk", 55.1644, 61.4368, 5, "RU"},
-    {"Omsk", 54.9885, 73.3242, 6, "RU"},
-    {"Samara", 53.2001, 50.1500, 4, "RU"},
-    {"Rostov-on-Don", 47.2357, 39.7015, 3, "RU"},
-    {"Ufa", 54.7388, 55.9721, 5, "RU"},
-    {"Krasnoyarsk", 56.0184, 92.8672, 7, "RU"},
-    {"Voronezh", 51.6720, 39.1843, 3, "RU"},
-    {"Perm", 58.0105, 56.2502, 5, "RU"},
-    {"Volgograd", 48.7080, 44.5133, 4, "RU"},
-    {"Krasnodar", 45.0355, 38.9753, 3, "RU"},
-    
-    // Japan
-    {"Tokyo", 35.6762, 139.6503, 9, "JP"},
-    {"Yokohama", 35.4478, 139.6425, 9, "JP"},
-    {"Osaka", 34.6937, 135.5023, 9, "JP"},
-    {"Nagoya", 35.1815, 136.9066, 9, "JP"},
-    {"Sapporo", 43.0642, 141.3469, 9, "JP"},
-    {"Fukuoka", 33.5904, 130.4017, 9, "JP"},
-    {"Kobe", 34.6901, 135.1956, 9, "JP"},
-    {"Kyoto", 35.0116, 135.7681, 9, "JP"},
-    {"Kawasaki", 35.5308, 139.7029, 9, "JP"},
-    {"Hiroshima", 34.3853, 132.4553, 9, "JP"},
-    {"Sendai", 38.2682, 140.8694, 9, "JP"},
-    {"Kitakyushu", 33.8834, 130.8751, 9, "JP"},
-    {"Chiba", 35.6074, 140.1065, 9, "JP"},
-    {"Sakai", 34.5664, 135.4823, 9, "JP"},
-    {"Niigata", 37.9161, 139.0364, 9, "JP"},
-    {"Hamamatsu", 34.7108, 137.7261, 9, "JP"},
-    {"Okayama", 34.6551, 133.9195, 9, "JP"},
-    {"Sagamihara", 35.5761, 139.3831, 9, "JP"},
-    {"Funabashi", 35.6950, 139.9828, 9, "JP"},
-    {"Hachioji", 35.6561, 139.3344, 9, "JP"},
-    {"Kagoshima", 31.5966, 130.5571, 9, "JP"},
-    {"Kawaguchi", 35.8076, 139.7245, 9, "JP"},
-    {"Himeji", 34.8153, 134.6850, 9, "JP"},
-    {"Suita", 34.7608, 135.5145, 9, "JP"},
-    {"Kanazawa", 36.5944, 136.6256, 9, "JP"},
-    {"Matsuyama", 33.8416, 132.7656, 9, "JP"},
-    {"Utsunomiya", 36.5658, 139.8836, 9, "JP"},
-    {"Matsudo", 35.7847, 139.9016, 9, "JP"},
-    {"Kawagoe", 35.9253, 139.4856, 9, "JP"},
-    {"Kochi", 33.5597, 133.5311, 9, "JP"},
-    {"Takamatsu", 34.3402, 134.0434, 9, "JP"},
-    {"Toyama", 36.6959, 137.2139, 9, "JP"},
-    {"Toyonaka", 34.7825, 135.4695, 9, "JP"},
-    {"Gifu", 35.3912, 136.7223, 9, "JP"},
-    {"Fujisawa", 35.3418, 139.4839, 9, "JP"},
-    {"Kashiwa", 35.8617, 139.9750, 9, "JP"},
-    {"Miyazaki", 31.9077, 131.4202, 9, "JP"},
-    {"Toyohashi", 34.7692, 137.3914, 9, "JP"},
-    {"Nagano", 36.6513, 138.1810, 9, "JP"},
-    {"Iwaki", 37.0481, 140.8870, 9, "JP"},
-    {"Asahikawa", 43.7706, 142.3649, 9, "JP"},
-    
-    // South Korea
-    {"Seoul", 37.5665, 126.9780, 9, "KR"},
-    {"Busan", 35.1796, 129.0756, 9, "KR"},
-    {"Incheon", 37.4563, 126.7052, 9, "KR"},
-    {"Daegu", 35.8714, 128.6014, 9, "KR"},
-    {"Daejeon", 36.3504, 127.3845, 9, "KR"},
-    {"Gwangju", 35.1595, 126.8526, 9, "KR"},
-    {"Ulsan", 35.5384, 129.3114, 9, "KR"},
-    {"Suwon", 37.2636, 127.0286, 9, "KR"},
-    {"Changwon", 35.2272, 128.6811, 9, "KR"},
-    {"Goyang", 37.6564, 126.8353, 9, "KR"},
-    {"Yongin", 37.2411, 127.1775, 9, "KR"},
-    {"Seongnam", 37.4449, 127.1388, 9, "KR"},
-    {"Bucheon", 37.4989, 126.7831, 9, "KR"},
-    {"Ansan", 37.3236, 126.8219, 9, "KR"},
-    {"Cheongju", 36.6424, 127.4890, 9, "KR"},
-    {"Jeonju", 35.8428, 127.1480, 9, "KR"},
-    {"Anyang", 37.3943, 126.9568, 9, "KR"},
-    {"Cheonan", 36.8151, 127.1139, 9, "KR"},
-    {"Pohang", 36.0190, 129.3435, 9, "KR"},
-    {"Uijeongbu", 37.7387, 127.0473, 9, "KR"},
-    {"Siheung", 37.3807, 126.8031, 9, "KR"},
-    {"Pyeongtaek", 36.9923, 127.1128, 9, "KR"},
-    {"Gimhae", 35.2285, 128.8890, 9, "KR"},
-    {"Hwaseong", 37.2067, 126.8167, 9, "KR"},
-    {"Gumi", 36.1136, 128.3445, 9, "KR"},
-    {"Asan", 36.7898, 127.0042, 9, "KR"},
-    {"Wonju", 37.3422, 127.9202, 9, "KR"},
-    {"Gimpo", 37.6150, 126.7158, 9, "KR"},
-    {"Iksan", 35.9483, 126.9576, 9, "KR"},
-    {"Gunsan", 35.9676, 126.7367, 9, "KR"},
-    
-    // North Korea
-    {"Pyongyang", 39.0392, 125.7625, 9, "KP"},
-    
-    // Mongolia
-    {"Ulaanbaatar", 47.8864, 106.9057, 8, "MN"},
-    
-    // Nepal
-    {"Kathmandu", 27.7172, 85.3240, 5, "NP"},
-    {"Pokhara", 28.2096, 83.9856, 5, "NP"},
-    
-    // Bhutan
-    {"Thimphu", 27.4728, 89.6390, 6, "BT"},
-    
-    // Sri Lanka
-    {"Colombo", 6.9271, 79.8612, 5, "LK"},
-    {"Kandy", 7.2906, 80.6337, 5, "LK"},
-    {"Galle", 6.0535, 80.2210, 5, "LK"},
-    
-    // Maldives
-    {"Male", 4.1755, 73.5093, 5, "MV"},
-    
-    // Myanmar
-    {"Yangon", 16.8409, 96.1735, 6, "MM"},
-    {"Mandalay", 21.9588, 96.0891, 6, "MM"},
-    {"Naypyidaw", 19.7633, 96.0785, 6, "MM"},
-    
-    // Cambodia
-    {"Phnom Penh", 11.5449, 104.8922, 7, "KH"},
-    {"Siem Reap", 13.3671, 103.8448, 7, "KH"},
-    
-    // Laos
-    {"Vientiane", 17.9757, 102.6331, 7, "LA"},
-    {"Luang Prabang", 19.8845, 102.1350, 7, "LA"},
-    
-    // Europe
-    // United Kingdom
-    {"London", 51.5074, -0.1278, 1, "GB"},
-    {"Birmingham", 52.4862, -1.8904, 1, "GB"},
-    {"Manchester", 53.4808, -2.2426, 1, "GB"},
-    {"Liverpool", 53.4084, -2.9916, 1, "GB"},
-    {"Leeds", 53.8008, -1.5491, 1, "GB"},
-    {"Sheffield", 53.3811, -1.4701, 1, "GB"},
-    {"Edinburgh", 55.9533, -3.1883, 1, "GB"},
-    {"Glasgow", 55.8642, -4.2518, 1, "GB"},
-    {"Cardiff", 51.4816, -3.1791, 1, "GB"},
-    {"Belfast", 54.5973, -5.9301, 1, "GB"},
-    {"Bristol", 51.4545, -2.5879, 1, "GB"},
-    {"Leicester", 52.6369, -1.1398, 1, "GB"},
-    {"Coventry", 52.4068, -1.5197, 1, "GB"},
-    {"Hull", 53.7676, -0.3274, 1, "GB"},
-    {"Bradford", 53.7960, -1.7594, 1, "GB"},
-    {"Nottingham", 52.9548, -1.1581, 1, "GB"},
-    {"Plymouth", 50.3755, -4.1427, 1, "GB"},
-    {"Stoke-on-Trent", 53.0027, -2.1794, 1, "GB"},
-    {"Wolverhampton", 52.5862, -2.1282, 1, "GB"},
-    {"Derby", 52.9225, -1.4746, 1, "GB"},
-    {"Swansea", 51.6214, -3.9436, 1, "GB"},
-    {"Southampton", 50.9097, -1.4044, 1, "GB"},
-    {"Salford", 53.4831, -2.2931, 1, "GB"},
-    {"Aberdeen", 57.1497, -2.0943, 1, "GB"},
-    {"Westminster", 51.4994, -0.1319, 1, "GB"},
-    {"Portsmouth", 50.8198, -1.0880, 1, "GB"},
-    {"York", 53.9591, -1.0815, 1, "GB"},
-    {"Peterborough", 52.5695, -0.2405, 1, "GB"},
-    {"Dundee", 56.4620, -2.9707, 1, "GB"},
-    {"Lancaster", 54.0466, -2.8007, 1, "GB"},
-    {"Oxford", 51.7520, -1.2577, 1, "GB"},
-    {"Newport", 51.5842, -2.9977, 1, "GB"},
-    {"Preston", 53.7632, -2.7031, 1, "GB"},
-    {"St Albans", 51.7518, -0.3363, 1, "GB"},
-    {"Norwich", 52.6309, 1.2974, 1, "GB"},
-    {"Chester", 53.1906, -2.8919, 1, "GB"},
-    {"Dundee", 56.4620, -2.9707, 1, "GB"},
-    {"Exeter", 50.7184, -3.5339, 1, "GB"},
-    {"Gloucester", 51.8642, -2.2381, 1, "GB"},
-    {"Scunthorpe", 53.5916, -0.6443, 1, "GB"},
-    {"Sunderland", 54.9069, -1.3838, 1, "GB"},
-    {"Ipswich", 52.0594, 1.1550, 1, "GB"},
-    {"Blackpool", 53.8175, -3.0357, 1, "GB"},
-    {"Middlesbrough", 54.5742, -1.2351, 1, "GB"},
-    {"Bolton", 53.5768, -2.4282, 1, "GB"},
-    {"Bournemouth", 50.7192, -1.8808, 1, "GB"},
-    {"Cambridge", 52.2053, 0.1218, 1, "GB"},
-    {"Crewe", 53.0963, -2.4411, 1, "GB"},
-    {"Doncaster", 53.5228, -1.1285, 1, "GB"},
-    {"Gillingham", 51.3890, 0.5471, 1, "GB"},
-    {"Hemel Hempstead", 51.7453, -0.4669, 1, "GB"},
-    {"Ipswich", 52.0594, 1.1550, 1, "GB"},
-    
-    // France
-    {"Paris", 48.8566, 2.3522, 2, "FR"},
-    {"Marseille", 43.2965, 5.3698, 2, "FR"},
-    {"Lyon", 45.7640, 4.8357, 2, "FR"},
-    {"Toulouse", 43.6047, 1.4442, 2, "FR"},
-    {"Nice", 43.7102, 7.2620, 2, "FR"},
-    {"Nantes", 47.2184, -1.5536, 2, "FR"},
-    {"Montpellier", 43.6110, 3.8767, 2, "FR"},
-    {"Strasbourg", 48.5734, 7.7521, 2, "FR"},
-    {"Bordeaux", 44.8378, -0.5792, 2, "FR"},
-    {"Lille", 50.6292, 3.0573, 2, "FR"},
-    {"Rennes", 48.1173, -1.6778, 2, "FR"},
-    {"Reims", 49.2583, 4.0317, 2, "FR"},
-    {"Le Havre", 49.4944, 0.1079, 2, "FR"},
-    {"Saint-Etienne", 45.4397, 4.3872, 2, "FR"},
-    {"Toulon", 43.1242, 5.9280, 2, "FR"},
-    {"Angers", 47.4784, -0.5632, 2, "FR"},
-    {"Grenoble", 45.1885, 5.7245, 2, "FR"},
-    {"Dijon", 47.3220, 5.0415, 2, "FR"},
-    {"Nimes", 43.8367, 4.3601, 2, "FR"},
-    {"Aix-en-Provence", 43.5297, 5.4474, 2, "FR"},
-    {"Brest", 48.3905, -4.4861, 2, "FR"},
-    {"Le Mans", 48.0061, 0.1996, 2, "FR"},
-    {"Amiens", 49.8941, 2.2958, 2, "FR"},
-    {"Tours", 47.3941, 0.6848, 2, "FR"},
-    {"Limoges", 45.8336, 1.2611, 2, "FR"},
-    {"Clermont-Ferrand", 45.7797, 3.0863, 2, "FR"},
-    {"Villeurbanne", 45.7797, 4.8814, 2, "FR"},
-    {"Besancon", 47.2380, 6.0243, 2, "FR"},
-    {"Metz", 49.1193, 6.1757, 2, "FR"},
-    {"Orleans", 47.9029, 1.9093, 2, "FR"},
-    {"Rouen", 49.4431, 1.0993, 2, "FR"},
-    {"Mulhouse", 47.7508, 7.3359, 2, "FR"},
-    {"Caen", 49.1829, -0.3707, 2, "FR"},
-    {"Nancy", 48.6921, 6.1844, 2, "FR"},
-    {"Argenteuil", 48.9474, 2.2742, 2, "FR"},
-    {"Saint-Denis", 48.9362, 2.3574, 2, "FR"},
-    {"Roubaix", 50.6942, 3.1746, 2, "FR"},
-    {"Tourcoing", 50.7236, 3.1615, 2, "FR"},
-    {"Nanterre", 48.8924, 2.2069, 2, "FR"},
-    {"Avignon", 43.9493, 4.8055, 2, "FR"},
-    {"Creteil", 48.7905, 2.4551, 2, "FR"},
-    {"Poitiers", 46.5802, 0.3404, 2, "FR"},
-    {"Versailles", 48.8014, 2.1301, 2, "FR"},
-    {"Pau", 43.2951, -0.3707, 2, "FR"},
-    {"La Rochelle", 46.1603, -1.1511, 2, "FR"},
-    {"Calais", 50.9513, 1.8587, 2, "FR"},
-    {"Cannes", 43.5528, 7.0174, 2, "FR"},
-    {"Ajaccio", 41.9196, 8.7386, 2, "FR"},
-    
-    // Germany
-    {"Berlin", 52.5200, 13.4050, 2, "DE"},
-    {"Hamburg", 53.5511, 9.9937, 2, "DE"},
-    {"Munich", 48.1351, 11.5820, 2, "DE"},
-    {"Cologne", 50.9375, 6.9603, 2, "DE"},
-    {"Frankfurt", 50.1109, 8.6821, 2, "DE"},
-    {"Stuttgart", 48.7758, 9.1829, 2, "DE"},
-    {"Dusseldorf", 51.2277, 6.7735, 2, "DE"},
-    {"Dortmund", 51.5136, 7.4653, 2, "DE"},
-    {"Essen", 51.4556, 7.0116, 2, "DE"},
-    {"Leipzig", 51.3397, 12.3731, 2, "DE"},
-    {"Bremen", 53.0793, 8.8017, 2, "DE"},
-    {"Dresden", 51.0504, 13.7373, 2, "DE"},
-    {"Hanover", 52.3759, 9.7320, 2, "DE"},
-    {"Nuremberg", 49.4521, 11.0767, 2, "DE"},
-    {"Duisburg", 51.4344, 6.7623, 2, "DE"},
-    {"Bochum", 51.4819, 7.2162, 2, "DE"},
-    {"Wuppertal", 51.2562, 7.1508, 1, "DE"},  // UTC+1 (CET)
-    {"Bielefeld", 52.0302, 8.5325, 2, "DE"},
-    {"Bonn", 50.7374, 7.0982, 2, "DE"},
-    {"Munster", 51.9607, 7.6261, 2, "DE"},
-    {"Karlsruhe", 49.0069, 8.4037, 2, "DE"},
-    {"Mannheim", 49.4875, 8.4660, 2, "DE"},
-    {"Augsburg", 48.3705, 10.8978, 2, "DE"},
-    {"Wiesbaden", 50.0826, 8.2400, 2, "DE"},
-    {"Gelsenkirchen", 51.5177, 7.0857, 2, "DE"},
-    {"Monchengladbach", 51.1805, 6.4428, 2, "DE"},
-    {"Braunschweig", 52.2689, 10.5268, 2, "DE"},
-    {"Chemnitz", 50.8278, 12.9214, 2, "DE"},
-    {"Kiel", 54.3233, 10.1228, 2, "DE"},
-    {"Aachen", 50.7753, 6.0839, 2, "DE"},
-    {"Halle", 51.4825, 11.9697, 2, "DE"},
-    {"Magdeburg", 52.1205, 11.6276, 2, "DE"},
-    {"Freiburg", 47.9990, 7.8421, 2, "DE"},
-    {"Krefeld", 51.3388, 6.5853, 2, "DE"},
-    {"Lubeck", 53.8654, 10.6865, 2, "DE"},
-    {"Oberhausen", 51.4963, 6.8516, 2, "DE"},
-    {"Erfurt", 50.9848, 11.0299, 2, "DE"},
-    {"Mainz", 49.9929, 8.2473, 2, "DE"},
-    {"Rostock", 54.0887, 12.1431, 2, "DE"},
-    {"Kassel", 51.3127, 9.4797, 2, "DE"},
-    {"Hagen", 51.3670, 7.4632, 2, "DE"},
-    {"Potsdam", 52.3906, 13.0645, 2, "DE"},
-    {"Saarbrucken", 49.2401, 6.9969, 2, "DE"},
-    {"Hamm", 51.6806, 7.8142, 2, "DE"},
-    {"Mulheim", 51.4267, 6.8833, 2, "DE"},
-    {"Ludwigshafen", 49.4774, 8.4451, 2, "DE"},
-    {"Leverkusen", 51.0458, 6.9845, 2, "DE"},
-    {"Oldenburg", 53.1435, 8.2146, 2, "DE"},
-    {"Neuss", 51.2048, 6.6883, 2, "DE"},
-    {"Solingen", 51.1652, 7.0679, 2, "DE"},
-    {"Heidelberg", 49.3988, 8.6724, 2, "DE"},
-    {"Darmstadt", 49.8728, 8.6512, 2, "DE"},
-    {"Paderborn", 51.7189, 8.7575, 2, "DE"},
-    {"Regensburg", 49.0134, 12.1016, 2, "DE"},
-    {"Ingolstadt", 48.7665, 11.4257, 2, "DE"},
-    {"Wurzburg", 49.7913, 9.9534, 2, "DE"},
-    {"Furth", 49.4771, 10.9888, 2, "DE"},
-    {"Wolfsburg", 52.4227, 10.7865, 2, "DE"},
-    {"Offenbach", 50.0955, 8.7761, 2, "DE"},
-    {"Ulm", 48.4011, 9.9876, 2, "DE"},
-    {"Heilbronn", 49.1427, 9.2109, 2, "DE"},
-    {"Pforzheim", 48.8910, 8.6984, 2, "DE"},
-    {"Gottingen", 51.5412, 9.9158, 2, "DE"},
-    {"Bottrop", 51.5216, 6.9289, 2, "DE"},
-    {"Trier", 49.7596, 6.6441, 2, "DE"},
-    {"Recklinghausen", 51.6142, 7.1976, 2, "DE"},
-    {"Reutlingen", 48.4919, 9.2044, 2, "DE"},
-    {"Bremerhaven", 53.5396, 8.5809, 2, "DE"},
-    {"Koblenz", 50.3569, 7.5890, 2, "DE"},
-    {"Bergisch Gladbach", 50.9919, 7.1298, 2, "DE"},
-    {"Jena", 50.9278, 11.5861, 2, "DE"},
-    {"Remscheid", 51.1790, 7.1896, 2, "DE"},
-    {"Erlangen", 49.5897, 11.0040, 2, "DE"},
-    {"Moers", 51.4508, 6.6407, 2, "DE"},
-    {"Siegen", 50.8749, 8.0244, 2, "DE"},
-    {"Hildesheim", 52.1561, 9.9511, 2, "DE"},
-    {"Salzgitter", 52.1536, 10.4006, 2, "DE"},
-    
-    // Italy
-    {"Rome", 41.9028, 12.4964, 2, "IT"},
-    {"Milan", 45.4642, 9.1900, 2, "IT"},
-    {"Naples", 40.8518, 14.2681, 2, "IT"},
-    {"Turin", 45.0703, 7.6869, 2, "IT"},
-    {"Palermo", 38.1157, 13.3615, 2, "IT"},
-    {"Genoa", 44.4056, 8.9463, 2, "IT"},
-    {"Bologna", 44.4949, 11.3426, 2, "IT"},
-    {"Florence", 43.7696, 11.2558, 2, "IT"},
-    {"Bari", 41.1171, 16.8719, 2, "IT"},
-    {"Catania", 37.5079, 15.0830, 2, "IT"},
-    {"Venice", 45.4408, 12.3155, 2, "IT"},
-    {"Verona", 45.4384, 10.9916, 2, "IT"},
-    {"Messina", 38.1938, 15.5540, 2, "IT"},
-    {"Padua", 45.4064, 11.8768, 2, "IT"},
-    {"Trieste", 45.6495, 13.7768, 2, "IT"},
-    {"Taranto", 40.4668, 17.2725, 2, "IT"},
-    {"Brescia", 45.5416, 10.2118, 2, "IT"},
-    {"Prato", 43.8777, 11.1023, 2, "IT"},
-    {"Reggio Calabria", 38.1113, 15.6619, 2, "IT"},
-    {"Modena", 44.6471, 10.9252, 2, "IT"},
-    {"Reggio Emilia", 44.6989, 10.6306, 2, "IT"},
-    {"Perugia", 43.1122, 12.3888, 2, "IT"},
-    {"Livorno", 43.5482, 10.3116, 2, "IT"},
-    {"Ravenna", 44.4173, 12.1989, 2, "IT"},
-    {"Cagliari", 39.2238, 9.1217, 2, "IT"},
-    {"Foggia", 41.4621, 15.5444, 2, "IT"},
-    {"Rimini", 44.0678, 12.5695, 2, "IT"},
-    {"Salerno", 40.6824, 14.7681, 2, "IT"},
-    {"Ferrara", 44.8381, 11.6193, 2, "IT"},
-    {"Sassari", 40.7259, 8.5599, 2, "IT"},
-    {"Latina", 41.4677, 12.9032, 2, "IT"},
-    {"Giugliano", 40.9292, 14.1934, 2, "IT"},
-    {"Monza", 45.5845, 9.2744, 2, "IT"},
-    {"Syracuse", 37.0755, 15.2866, 2, "IT"},
-    {"Pescara", 42.4584, 14.2139, 2, "IT"},
-    {"Bergamo", 45.6983, 9.6773, 2, "IT"},
-    {"Forlì", 44.2226, 12.0401, 2, "IT"},
-    {"Trento", 46.0664, 11.1257, 2, "IT"},
-    {"Vicenza", 45.5455, 11.5353, 2, "IT"},
-    {"Terni", 42.5633, 12.6431, 2, "IT"},
-    {"Bolzano", 46.4983, 11.3548, 2, "IT"},
-    {"Novara", 45.4469, 8.6196, 2, "IT"},
-    {"Piacenza", 45.0526, 9.6925, 2, "IT"},
-    {"Ancona", 43.6158, 13.5189, 2, "IT"},
-    
-    // Spain
-    {"Madrid", 40.4168, -3.7038, 2, "ES"},
-    {"Barcelona", 41.3851, 2.1734, 2, "ES"},
-    {"Valencia", 39.4699, -0.3763, 2, "ES"},
-    {"Seville", 37.3891, -5.9845, 2, "ES"},
-    {"Zaragoza", 41.6488, -0.8891, 2, "ES"},
-    {"Malaga", 36.7213, -4.4214, 2, "ES"},
-    {"Murcia", 37.9922, -1.1307, 2, "ES"},
-    {"Palma", 39.5696, 2.6502, 2, "ES"},
-    {"Las Palmas", 28.1248, -15.4300, 0, "ES"},
-    {"Bilbao", 43.2627, -2.9253, 2, "ES"},
-    {"Alicante", 38.3452, -0.4810, 2, "ES"},
-    {"Cordoba", 37.8882, -4.7794, 2, "ES"},
-    {"Valladolid", 41.6523, -4.7245, 2, "ES"},
-    {"Vigo", 42.2406, -8.7207, 2, "ES"},
-    {"Gijon", 43.5322, -5.6611, 2, "ES"},
-    {"Hospitalet", 41.3598, 2.1003, 2, "ES"},
-    {"Vitoria-Gasteiz", 42.8467, -2.6716, 2, "ES"},
-    {"A Coruña", 43.3623, -8.4115, 2, "ES"},
-    {"Elche", 38.2622, -0.7011, 2, "ES"},
-    {"Granada", 37.1773, -3.5986, 2, "ES"},
-    {"Oviedo", 43.3614, -5.8593, 2, "ES"},
-    {"Badalona", 41.4501, 2.2471, 2, "ES"},
-    {"Cartagena", 37.6063, -0.9858, 2, "ES"},
-    {"Terrassa", 41.5640, 2.0110, 2, "ES"},
-    {"Jerez de la Frontera", 36.6969, -6.1266, 2, "ES"},
-    {"Sabadell", 41.5432, 2.1083, 2, "ES"},
-    {"Mostoles", 40.3229, -3.8644, 2, "ES"},
-    {"Santa Cruz de Tenerife", 28.4636, -16.2518, 0, "ES"},
-    {"Pamplona", 42.8125, -1.6458, 2, "ES"},
-    {"Almeria", 36.8381, -2.4597, 2, "ES"},
-    {"Alcala de Henares", 40.4817, -3.3616, 2, "ES"},
-    {"Fuenlabrada", 40.2817, -3.7947, 2, "ES"},
-    {"Leganes", 40.3272, -3.7636, 2, "ES"},
-    {"Getafe", 40.3058, -3.7319, 2, "ES"},
-    {"Santander", 43.4623, -3.8099, 2, "ES"},
-    {"Castellon", 39.9864, -0.0513, 2, "ES"},
-    {"Burgos", 42.3439, -3.6965, 2, "ES"},
-    {"Albacete", 38.9943, -1.8585, 2, "ES"},
-    {"Alcorcon", 40.3456, -3.8242, 2, "ES"},
-    {"San Sebastian", 43.3183, -1.9812, 2, "ES"},
-    {"Salamanca", 40.9701, -5.6635, 2, "ES"},
-    {"Huelva", 37.2614, -6.9447, 2, "ES"},
-    {"Lleida", 41.6176, 0.6200, 2, "ES"},
-    {"Leon", 42.5987, -5.5671, 2, "ES"},
-    {"Cadiz", 36.5297, -6.2923, 2, "ES"},
-    {"Tarragona", 41.1189, 1.2445, 2, "ES"},
-    {"Badajoz", 38.8794, -6.9706, 2, "ES"},
-    
-    // Portugal
-    {"Lisbon", 38.7223, -9.1393, 0, "PT"},
-    {"Porto", 41.1579, -8.6291, 0, "PT"},
-    {"Braga", 41.5518, -8.4229, 0, "PT"},
-    {"Coimbra", 40.2033, -8.4103, 0, "PT"},
-    {"Funchal", 32.6669, -16.9241, 0, "PT"},
-    {"Amadora", 38.7538, -9.2322, 0, "PT"},
-    {"Almada", 38.6793, -9.1568, 0, "PT"},
-    {"Agualva-Cacem", 38.7554, -9.3089, 0, "PT"},
-    {"Queluz", 38.7572, -9.2543, 0, "PT"},
-    {"Setubal", 38.5244, -8.8882, 0, "PT"},
-    {"Barreiro", 38.6632, -9.0722, 0, "PT"},
-    {"Odivelas", 38.7931, -9.1836, 0, "PT"},
-    {"Aveiro", 40.6443, -8.6455, 0, "PT"},
-    {"Corroios", 38.6436, -9.1459, 0, "PT"},
-    {"Loures", 38.8314, -9.1658, 0, "PT"},
-    {"Evora", 38.5714, -7.9081, 0, "PT"},
-    {"Rio Tinto", 41.1800, -8.5595, 0, "PT"},
-    {"Gondomar", 41.1068, -8.5323, 0, "PT"},
-    {"Vila Nova de Gaia", 41.1239, -8.6124, 0, "PT"},
-    {"Matosinhos", 41.1820, -8.6898, 0, "PT"},
-    {"Faro", 37.0194, -7.9322, 0, "PT"},
-    {"Leiria", 39.7437, -8.8071, 0, "PT"},
-    {"Viseu", 40.6566, -7.9122, 0, "PT"},
-    {"Guimaraes", 41.4426, -8.2988, 0, "PT"},
-    {"Viana do Castelo", 41.6938, -8.8343, 0, "PT"},
-    {"Portimao", 37.1364, -8.5376, 0, "PT"},
-    {"Braganca", 41.8061, -6.7570, 0, "PT"},
-    
-    // Netherlands
-    {"Amsterdam", 52.3676, 4.9041, 2, "NL"},
-    {"Rotterdam", 51.9244, 4.4777, 2, "NL"},
-    {"The Hague", 52.0705, 4.3007, 2, "NL"},
-    {"Utrecht", 52.0907, 5.1214, 2, "NL"},
-    {"Eindhoven", 51.4416, 5.4697, 2, "NL"},
-    {"Tilburg", 51.5555, 5.0913, 2, "NL"},
-    {"Groningen", 53.2194, 6.5665, 2, "NL"},
-    {"Almere", 52.3508, 5.2647, 2, "NL"},
-    {"Breda", 51.5719, 4.7683, 2, "NL"},
-    {"Nijmegen", 51.8126, 5.8372, 2, "NL"},
-    {"Enschede", 52.2215, 6.8937, 2, "NL"},
-    {"Haarlem", 52.3874, 4.6462, 2, "NL"},
-    {"Arnhem", 51.9851, 5.8987, 2, "NL"},
-    {"Zaanstad", 52.4689, 4.8289, 2, "NL"},
-    {"Amersfoort", 52.1561, 5.3878, 2, "NL"},
-    {"Apeldoorn", 52.2112, 5.9699, 2, "NL"},
-    {"s-Hertogenbosch", 51.6978, 5.3037, 2, "NL"},
-    {"Hoofddorp", 52.3019, 4.6890, 2, "NL"},
-    {"Maastricht", 50.8514, 5.6909, 2, "NL"},
-    {"Leiden", 52.1601, 4.4970, 2, "NL"},
-    {"Dordrecht", 51.8133, 4.6901, 2, "NL"},
-    {"Zoetermeer", 52.0575, 4.4932, 2, "NL"},
-    {"Zwolle", 52.5168, 6.0830, 2, "NL"},
-    {"Deventer", 52.2549, 6.1636, 2, "NL"},
-    {"Delft", 52.0116, 4.3571, 2, "NL"},
-    {"Alkmaar", 52.6316, 4.7492, 2, "NL"},
-    {"Leeuwarden", 53.2012, 5.7999, 2, "NL"},
-    {"Venlo", 51.3704, 6.1724, 2, "NL"},
-    
-    // Belgium
-    {"Brussels", 50.8503, 4.3517, 2, "BE"},
-    {"Antwerp", 51.2194, 4.4025, 2, "BE"},
-    {"Ghent", 51.0500, 3.7303, 2, "BE"},
-    {"Charleroi", 50.4108, 4.4446, 2, "BE"},
-    {"Liege", 50.6326, 5.5797, 2, "BE"},
-    {"Bruges", 51.2093, 3.2247, 2, "BE"},
-    {"Namur", 50.4669, 4.8719, 2, "BE"},
-    {"Leuven", 50.8798, 4.7005, 2, "BE"},
-    {"Mons", 50.4542, 3.9564, 2, "BE"},
-    {"Aalst", 50.9368, 4.0397, 2, "BE"},
-    {"Mechelen", 51.0282, 4.4777, 2, "BE"},
-    {"La Louviere", 50.4792, 4.1878, 2, "BE"},
-    {"Kortrijk", 50.8262, 3.2648, 2, "BE"},
-    {"Hasselt", 50.9307, 5.3378, 2, "BE"},
-    {"Sint-Niklaas", 51.1658, 4.1430, 2, "BE"},
-    {"Oostende", 51.2213, 2.9271, 2, "BE"},
-    {"Tournai", 50.6054, 3.3890, 2, "BE"},
-    {"Genk", 50.9658, 5.5037, 2, "BE"},
-    {"Seraing", 50.6122, 5.4992, 2, "BE"},
-    {"Roeselare", 50.9481, 3.1269, 2, "BE"},
-    
-    // Switzerland
-    {"Zurich", 47.3769, 8.5417, 2, "CH"},
-    {"Geneva", 46.2044, 6.1432, 2, "CH"},
-    {"Basel", 47.5596, 7.5886, 2, "CH"},
-    {"Bern", 46.9481, 7.4474, 2, "CH"},
-    {"Lausanne", 46.5197, 6.6323, 2, "CH"},
-    {"Winterthur", 47.4979, 8.7242, 2, "CH"},
-    {"Lucerne", 47.0502, 8.3093, 2, "CH"},
-    {"St. Gallen", 47.4245, 9.3767, 2, "CH"},
-    {"Lugano", 46.0037, 8.9511, 2, "CH"},
-    {"Biel/Bienne", 47.1368, 7.2463, 2, "CH"},
-    {"Thun", 46.7581, 7.6284, 2, "CH"},
-    {"Koniz", 46.9242, 7.4141, 2, "CH"},
-    {"La Chaux-de-Fonds", 47.1011, 6.8267, 2, "CH"},
-    {"Fribourg", 46.8056, 7.1608, 2, "CH"},
-    {"Schaffhausen", 47.6951, 8.6351, 2, "CH"},
-    {"Chur", 46.8480, 9.5336, 2, "CH"},
-    {"Vernier", 46.2022, 6.0852, 2, "CH"},
-    {"Neuchatel", 47.0169, 6.9432, 2, "CH"},
-    {"Uster", 47.3467, 8.7208, 2, "CH"},
-    {"Sion", 46.2276, 7.3588, 2, "CH"},
-    
-    // Austria
-    {"Vienna", 48.2082, 16.3738, 2, "AT"},
-    {"Graz", 47.0707, 15.4395, 2, "AT"},
-    {"Linz", 48.3069, 14.2858, 2, "AT"},
-    {"Salzburg", 47.8095, 13.0550, 2, "AT"},
-    {"Innsbruck", 47.2692, 11.4041, 2, "AT"},
-    
-    // Czech Republic
-    {"Prague", 50.0755, 14.4378, 2, "CZ"},
-    {"Brno", 49.1951, 16.6068, 2, "CZ"},
-    {"Ostrava", 49.8209, 18.2625, 2, "CZ"},
-    {"Plzen", 49.7384, 13.3736, 2, "CZ"},
-    {"Liberec", 50.7663, 15.0543, 2, "CZ"},
-    {"Olomouc", 49.5955, 17.2517, 2, "CZ"},
-    {"Usti nad Labem", 50.6607, 14.0323, 2, "CZ"},
-    {"Ceske Budejovice", 48.9745, 14.4743, 2, "CZ"},
-    {"Hradec Kralove", 50.2093, 15.8327, 2, "CZ"},
-    {"Pardubice", 50.0404, 15.7663, 2, "CZ"},
-    {"Zlin", 49.2267, 17.6696, 2, "CZ"},
-    {"Havirov", 49.7798, 18.4370, 2, "CZ"},
-    {"Kladno", 50.1467, 14.1028, 2, "CZ"},
-    {"Most", 50.5030, 13.6364, 2, "CZ"},
-    {"Opava", 49.9387, 17.9026, 2, "CZ"},
-    {"Frydek-Mistek", 49.6835, 18.3350, 2, "CZ"},
-    {"Karviná", 49.8537, 18.5425, 2, "CZ"},
-    {"Jihlava", 49.3961, 15.5906, 2, "CZ"},
-    {"Teplice", 50.6402, 13.8246, 2, "CZ"},
-    {"Decin", 50.7820, 14.2072, 2, "CZ"},
-    
-    // Slovakia
-    {"Bratislava", 48.1486, 17.1077, 2, "SK"},
-    {"Kosice", 48.7164, 21.2611, 2, "SK"},
-    {"Presov", 49.0012, 21.2397, 2, "SK"},
-    {"Zilina", 49.2231, 18.7397, 2, "SK"},
-    {"Nitra", 48.3081, 18.0711, 2, "SK"},
-    {"Banska Bystrica", 48.7362, 19.1534, 2, "SK"},
-    {"Trnava", 48.3774, 17.5893, 2, "SK"},
-    {"Martin", 49.0664, 18.92161, 2, "SK"},
-    {"Trencin", 48.8946, 18.0446, 2, "SK"},
-    {"Poprad", 49.0614, 20.2986, 2, "SK"},
-    {"Prievidza", 48.7740, 18.6267, 2, "SK"},
-    {"Zvolen", 48.5744, 19.1240, 2, "SK"},
-    {"Nove Zamky", 47.9855, 18.1641, 2, "SK"},
-    {"Michalovce", 48.7543, 21.9194, 2, "SK"},
-    {"Spisska Nova Ves", 48.9448, 20.5677, 2, "SK"},
-    
-    // Hungary
-    {"Budapest", 47.4979, 19.0402, 2, "HU"},
-    {"Debrecen", 47.5316, 21.6273, 2, "HU"},
-    {"Szeged", 46.2530, 20.1414, 2, "HU"},
-    {"Miskolc", 48.1034, 20.7784, 2, "HU"},
-    {"Pecs", 46.0727, 18.2320, 2, "HU"},
-    {"Gyor", 47.6875, 17.6504, 2, "HU"},
-    {"Nyiregyhaza", 47.9559, 21.7186, 2, "HU"},
-    {"Kecskemet", 46.9077, 19.6856, 2, "HU"},
-    {"Szekesfehervar", 47.1901, 18.4104, 2, "HU"},
-    {"Szombathely", 47.2306, 16.6218, 2, "HU"},
-    {"Erd", 47.3637, 18.9228, 2, "HU"},
-    {"Tatabanya", 47.5694, 18.3925, 2, "HU"},
-    {"Kaposvar", 46.3661, 17.7945, 2, "HU"},
-    {"Bekes", 46.7697, 21.1324, 2, "HU"},
-    {"Veszprem", 47.0930, 17.9104, 2, "HU"},
-    {"Zalaegerszeg", 46.8398, 16.8438, 2, "HU"},
-    {"Sopron", 47.6850, 16.5804, 2, "HU"},
-    {"Eger", 47.9015, 20.3734, 2, "HU"},
-    {"Nagykanizsa", 46.4535, 16.9944, 2, "HU"},
-    {"Dunakeszi", 47.6386, 19.1397, 2, "HU"},
-    
-    // Poland
-    {"Warsaw", 52.2297, 21.0122, 2, "PL"},
-    {"Krakow", 50.0647, 19.9450, 2, "PL"},
-    {"Lodz", 51.7592, 19.4560, 2, "PL"},
-    {"Wroclaw", 51.1079, 17.0385, 2, "PL"},
-    {"Poznan", 52.4064, 16.9252, 2, "PL"},
-    {"Gdansk", 54.3520, 18.6466, 2, "PL"},
-    {"Szczecin", 53.4289, 14.5530, 2, "PL"},
-    {"Bydgoszcz", 53.1235, 18.0084, 2, "PL"},
-    {"Lublin", 51.2465, 22.5684, 2, "PL"},
-    {"Katowice", 50.2649, 19.0238, 2, "PL"},
-    {"Bialystok", 53.1325, 23.1688, 2, "PL"},
-    {"Gdynia", 54.5189, 18.5305, 2, "PL"},
-    {"Czestochowa", 50.7971, 19.1200, 2, "PL"},
-    {"Radom", 51.4027, 21.1471, 2, "PL"},
-    {"Sosnowiec", 50.2863, 19.1041, 2, "PL"},
-    {"Torun", 53.0138, 18.5984, 2, "PL"},
-    {"Kielce", 50.8661, 20.6286, 2, "PL"},
-    {"Gliwice", 50.2945, 18.6714, 2, "PL"},
-    {"Zabrze", 50.3249, 18.7857, 2, "PL"},
-    {"Bytom", 50.3483, 18.9384, 2, "PL"},
-    {"Bielsko-Biala", 49.8225, 19.0444, 2, "PL"},
-    {"Olsztyn", 53.7784, 20.4801, 2, "PL"},
-    {"Rzeszow", 50.0412, 21.9991, 2, "PL"},
-    {"Ruda Slaska", 50.2584, 18.8648, 2, "PL"},
-    {"Rybnik", 50.0971, 18.5463, 2, "PL"},
-    {"Tychy", 50.1357, 18.9666, 2, "PL"},
-    {"Dabrowa Gornicza", 50.3218, 19.1982, 2, "PL"},
-    {"Plock", 52.5463, 19.7065, 2, "PL"},
-    {"Elblag", 54.1522, 19.4044, 2, "PL"},
-    {"Opole", 50.6751, 17.9213, 2, "PL"},
-    {"Walbrzych", 50.7841, 16.2844, 2, "PL"},
-    {"Zielona Gora", 51.9356, 15.5062, 2, "PL"},
-    {"Tarnow", 50.0121, 20.9859, 2, "PL"},
-    {"Chorzow", 50.2946, 18.9533, 2, "PL"},
-    {"Kalisz", 51.7487, 18.0948, 2, "PL"},
-    {"Koszalin", 54.1943, 16.1714, 2, "PL"},
-    {"Legnica", 51.2070, 16.1619, 2, "PL"},
-    
-    // Romania
-    {"Bucharest", 44.4268, 26.1025, 3, "RO"},
-    {"Cluj-Napoca", 46.7712, 23.6236, 3, "RO"},
-    {"Timisoara", 45.7489, 21.2087, 3, "RO"},
-    {"Iasi", 47.1585, 27.6014, 3, "RO"},
-    {"Constanta", 44.1598, 28.6348, 3, "RO"},
-    
-    // Bulgaria
-    {"Sofia", 42.6977, 23.3219, 3, "BG"},
-    {"Plovdiv", 42.1354, 24.7453, 3, "BG"},
-    {"Varna", 43.2141, 27.9147, 3, "BG"},
-    {"Burgas", 42.5048, 27.4626, 3, "BG"},
-    
-    // Serbia
-    {"Belgrade", 44.7866, 20.4489, 2, "RS"},
-    {"Novi Sad", 45.2671, 19.8335, 2, "RS"},
-    {"Nis", 43.3209, 21.8958, 2, "RS"},
-    
-    // Croatia
-    {"Zagreb", 45.8150, 15.9819, 2, "HR"},
-    {"Split", 43.5081, 16.4402, 2, "HR"},
-    {"Rijeka", 45.3271, 14.4422, 2, "HR"},
-    {"Osijek", 45.5550, 18.6955, 2, "HR"},
-    
-    // Bosnia and Herzegovina
-    {"Sarajevo", 43.8486, 18.3564, 2, "BA"},
-    {"Banja Luka", 44.7722, 17.1910, 2, "BA"},
-    {"Tuzla", 44.5386, 18.6708, 2, "BA"},
-    
-    // Slovenia
-    {"Ljubljana", 46.0569, 14.5058, 2, "SI"},
-    {"Maribor", 46.5547, 15.6467, 2, "SI"},
-    
-    // North Macedonia
-    {"Skopje", 41.9973, 21.4280, 2, "MK"},
-    {"Bitola", 41.0314, 21.3347, 2, "MK"},
-    
-    // Montenegro
-    {"Podgorica", 42.4304, 19.2594, 2, "ME"},
-    
-    // Albania
-    {"Tirana", 41.3275, 19.8187, 2, "AL"},
-    {"Durres", 41.3146, 19.4498, 2, "AL"},
-    
-    // Kosovo
-    {"Pristina", 42.6629, 21.1655, 1, "XK"},
-    
-    // Greece
-    {"Athens", 37.9755, 23.7348, 3, "GR"},
-    {"Thessaloniki", 40.6401, 22.9444, 3, "GR"},
-    {"Patras", 38.2466, 21.7346, 3, "GR"},
-    {"Heraklion", 35.3387, 25.1442, 3, "GR"},
-    
-    // Cyprus
-    {"Nicosia", 35.1856, 33.3823, 2, "CY"},
-    {"Limassol", 34.6851, 33.0384, 2, "CY"},
-    
-    // Malta
-    {"Valletta", 35.8997, 14.5147, 1, "MT"},
-    
-    // Nordic Countries
-    // Sweden
-    {"Stockholm", 59.3293, 18.0686, 2, "SE"},
-    {"Gothenburg", 57.7089, 11.9746, 2, "SE"},
-    {"Malmo", 55.6050, 13.0038, 2, "SE"},
-    {"Uppsala", 59.8586, 17.6389, 2, "SE"},
-    {"Vasteras", 59.6099, 16.5448, 2, "SE"},
-    {"Orebro", 59.2741, 15.2066, 2, "SE"},
-    {"Linkoping", 58.4108, 15.6214, 2, "SE"},
-    {"Helsingborg", 56.0465, 12.6945, 2, "SE"},
-    {"Jonkoping", 57.7826, 14.1618, 2, "SE"},
-    {"Norrkoping", 58.5877, 16.1924, 2, "SE"},
-    {"Lund", 55.7047, 13.1910, 2, "SE"},
-    {"Umea", 63.8284, 20.2597, 2, "SE"},
-    {"Gavle", 60.6749, 17.1413, 2, "SE"},
-    {"Boras", 57.7210, 12.9401, 2, "SE"},
-    {"Sodertalje", 59.1955, 17.6253, 2, "SE"},
-    {"Eskilstuna", 59.3708, 16.5077, 2, "SE"},
-    {"Karlstad", 59.3793, 13.5036, 2, "SE"},
-    {"Taby", 59.4439, 18.0687, 2, "SE"},
-    {"Vaxjo", 56.8777, 14.8091, 2, "SE"},
-    {"Halmstad", 56.6745, 12.8578, 2, "SE"},
-    {"Sundsvall", 62.3908, 17.3069, 2, "SE"},
-    {"Lulea", 65.5848, 22.1547, 2, "SE"},
-    {"Trollhattan", 58.2836, 12.2888, 2, "SE"},
-    {"Kristianstad", 56.0294, 14.1567, 2, "SE"},
-    {"Uddevalla", 58.3518, 11.9424, 2, "SE"},
-    
-    // Norway
-    {"Oslo", 59.9139, 10.7522, 2, "NO"},
-    {"Bergen", 60.3913, 5.3221, 2, "NO"},
-    {"Trondheim", 63.4305, 10.3951, 2, "NO"},
-    {"Stavanger", 58.9700, 5.7331, 2, "NO"},
-    {"Baerum", 59.8939, 10.5464, 2, "NO"},
-    {"Kristiansand", 58.1599, 8.0182, 2, "NO"},
-    {"Fredrikstad", 59.2181, 10.9298, 2, "NO"},
-    {"Sandnes", 58.8516, 5.7361, 2, "NO"},
-    {"Tromsø", 69.6492, 18.9553, 2, "NO"},
-    {"Sarpsborg", 59.2839, 11.1091, 2, "NO"},
-    {"Skien", 59.2090, 9.6134, 2, "NO"},
-    {"Ålesund", 62.4722, 6.1495, 2, "NO"},
-    {"Tonsberg", 59.2677, 10.4070, 2, "NO"},
-    {"Moss", 59.4369, 10.6566, 2, "NO"},
-    {"Haugesund", 59.4138, 5.2680, 2, "NO"},
-    {"Sandefjord", 59.1311, 10.2166, 2, "NO"},
-    {"Arendal", 58.4608, 8.7720, 2, "NO"},
-    {"Bodø", 67.2804, 14.4049, 2, "NO"},
-    {"Drammen", 59.7439, 10.2045, 2, "NO"},
-    {"Asker", 59.8436, 10.4348, 2, "NO"},
-    {"Lillehammer", 61.1153, 10.4664, 2, "NO"},
-    {"Mo i Rana", 66.3128, 14.1420, 2, "NO"},
-    
-    // Denmark
-    {"Copenhagen", 55.6761, 12.5683, 2, "DK"},
-    {"Aarhus", 56.1629, 10.2039, 2, "DK"},
-    {"Odense", 55.4038, 10.4024, 2, "DK"},
-    {"Aalborg", 57.0488, 9.9217, 2, "DK"},
-    {"Esbjerg", 55.4717, 8.4482, 2, "DK"},
-    {"Randers", 56.4607, 10.0369, 2, "DK"},
-    {"Kolding", 55.4904, 9.4720, 2, "DK"},
-    {"Horsens", 55.8607, 9.8500, 2, "DK"},
-    {"Vejle", 55.7090, 9.5357, 2, "DK"},
-    {"Roskilde", 55.6419, 12.0803, 2, "DK"},
-    {"Herning", 56.1369, 8.9747, 2, "DK"},
-    {"Silkeborg", 56.1697, 9.5451, 2, "DK"},
-    {"Naestved", 55.2301, 11.7610, 2, "DK"},
-    {"Fredericia", 55.5661, 9.7519, 2, "DK"},
-    {"Viborg", 56.4533, 9.4022, 2, "DK"},
-    {"Køge", 55.4581, 12.1823, 2, "DK"},
-    {"Holstebro", 56.3601, 8.6164, 2, "DK"},
-    {"Taastrup", 55.6505, 12.3007, 2, "DK"},
-    {"Slagelse", 55.4028, 11.3544, 2, "DK"},
-    {"Hillerød", 55.9291, 12.3008, 2, "DK"},
-    
-    // Finland
-    {"Helsinki", 60.1699, 24.9384, 3, "FI"},
-    {"Espoo", 60.2055, 24.6559, 3, "FI"},
-    {"Tampere", 61.4991, 23.7871, 3, "FI"},
-    {"Vantaa", 60.2934, 25.0378, 3, "FI"},
-    {"Turku", 60.4518, 22.2666, 3, "FI"},
-    {"Oulu", 65.0121, 25.4651, 3, "FI"},
-    {"Lahti", 60.9827, 25.6612, 3, "FI"},
-    {"Kuopio", 62.8924, 27.6780, 3, "FI"},
-    {"Jyvaskyla", 62.2415, 25.7209, 3, "FI"},
-    {"Pori", 61.4851, 21.7974, 3, "FI"},
-    {"Lappeenranta", 61.0587, 28.1878, 3, "FI"},
-    {"Vaasa", 63.0960, 21.6158, 3, "FI"},
-    {"Joensuu", 62.6010, 29.7636, 3, "FI"},
-    {"Hameenlinna", 60.9959, 24.4641, 3, "FI"},
-    {"Kotka", 60.4664, 26.9458, 3, "FI"},
-    {"Seinajoki", 62.7903, 22.8404, 3, "FI"},
-    {"Rovaniemi", 66.5039, 25.7294, 3, "FI"},
-    {"Mikkeli", 61.6884, 27.2722, 3, "FI"},
-    {"Kouvola", 60.8674, 26.7041, 3, "FI"},
-    {"Porvoo", 60.3925, 25.6651, 3, "FI"},
-    {"Rauma", 61.1274, 21.5103, 3, "FI"},
-    {"Savonlinna", 61.8670, 28.8810, 3, "FI"},
-    
-    // Iceland
-    {"Reykjavik", 64.1466, -21.9426, 0, "IS"},
-    
-    // Baltic States
-    // Lithuania
-    {"Vilnius", 54.6872, 25.2797, 3, "LT"},
-    {"Kaunas", 54.8985, 23.9036, 3, "LT"},
-    {"Klaipeda", 55.7033, 21.1443, 3, "LT"},
-    
-    // Latvia
-    {"Riga", 56.9496, 24.1052, 3, "LV"},
-    {"Daugavpils", 55.8747, 26.5360, 3, "LV"},
-    {"Liepaja", 56.5053, 21.0107, 3, "LV"},
-    
-    // Estonia
-    {"Tallinn", 59.4370, 24.7536, 3, "EE"},
-    {"Tartu", 58.3780, 26.7290, 3, "EE"},
-    {"Narva", 59.3772, 28.1903, 3, "EE"},
-    
-    // Eastern Europe
-    // Ukraine
-    {"Kiev", 50.4501, 30.5234, 2, "UA"},
-    {"Kharkiv", 49.9935, 36.2304, 2, "UA"},
-    {"Odessa", 46.4825, 30.7233, 2, "UA"},
-    {"Dnipro", 48.4647, 35.0462, 2, "UA"},
-    {"Lviv", 49.8397, 24.0297, 2, "UA"},
-    
-    // Belarus
-    {"Minsk", 53.9045, 27.5615, 3, "BY"},
-    {"Gomel", 52.4345, 31.0136, 3, "BY"},
-    {"Mogilev", 53.9168, 30.3449, 3, "BY"},
-    
-    // Moldova
-    {"Chisinau", 47.0105, 28.8638, 2, "MD"},
-    {"Tiraspol", 46.8403, 29.6433, 2, "MD"},
-    
-    // Americas
-    // United States
-    {"New York", 40.7128, -74.0060, -5, "US"},
-    {"Los Angeles", 34.0522, -118.2437, -8, "US"},
-    {"Chicago", 41.8781, -87.6298, -6, "US"},
-    {"Houston", 29.7604, -95.3698, -6, "US"},
-    {"Phoenix", 33.4484, -112.0740, -7, "US"},
-    {"Philadelphia", 39.9526, -75.1652, -5, "US"},
-    {"San Antonio", 29.4241, -98.4936, -6, "US"},
-    {"San Diego", 32.7157, -117.1611, -8, "US"},
-    {"Dallas", 32.7767, -96.7970, -6, "US"},
-    {"San Jose", 37.3382, -121.8863, -8, "US"},
-    {"Austin", 30.2672, -97.7431, -6, "US"},
-    {"Jacksonville", 30.3322, -81.6557, -5, "US"},
-    {"Fort Worth", 32.7555, -97.3308, -6, "US"},
-    {"Columbus", 39.9612, -82.9988, -5, "US"},
-    {"Charlotte", 35.2271, -80.8431, -5, "US"},
-    {"San Francisco", 37.7749, -122.4194, -8, "US"},
-    {"Indianapolis", 39.7684, -86.1581, -5, "US"},
-    {"Seattle", 47.6062, -122.3321, -8, "US"},
-    {"Denver", 39.7392, -104.9903, -7, "US"},
-    {"Washington", 38.9072, -77.0369, -5, "US"},
-    {"Boston", 42.3601, -71.0589, -5, "US"},
-    {"El Paso", 31.7619, -106.4850, -7, "US"},
-    {"Nashville", 36.1627, -86.7816, -6, "US"},
-    {"Detroit", 42.3314, -83.0458, -5, "US"},
-    {"Oklahoma City", 35.4676, -97.5164, -6, "US"},
-    {"Portland", 45.5152, -122.6784, -8, "US"},
-    {"Las Vegas", 36.1699, -115.1398, -8, "US"},
-    {"Memphis", 35.1495, -90.0490, -6, "US"},
-    {"Louisville", 38.2527, -85.7585, -5, "US"},
-    {"Baltimore", 39.2904, -76.6122, -5, "US"},
-    {"Milwaukee", 43.0389, -87.9065, -6, "US"},
-    {"Albuquerque", 35.0844, -106.6504, -7, "US"},
-    {"Tucson", 32.2226, -110.9747, -7, "US"},
-    {"Fresno", 36.7378, -119.7871, -8, "US"},
-    {"Sacramento", 38.5816, -121.4944, -8, "US"},
-    {"Mesa", 33.4152, -111.8315, -7, "US"},
-    {"Kansas City", 39.0997, -94.5786, -6, "US"},
-    {"Atlanta", 33.7490, -84.3880, -5, "US"},
-    {"Long Beach", 33.7701, -118.1937, -8, "US"},
-    {"Colorado Springs", 38.8339, -104.8214, -7, "US"},
-    {"Raleigh", 35.7796, -78.6382, -5, "US"},
-    {"Miami", 25.7617, -80.1918, -5, "US"},
-    {"Virginia Beach", 36.8529, -75.9780, -5, "US"},
-    {"Omaha", 41.2565, -95.9345, -6, "US"},
-    {"Oakland", 37.8044, -122.2711, -8, "US"},
-    {"Minneapolis", 44.9778, -93.2650, -6, "US"},
-    {"Tulsa", 36.1540, -95.9928, -6, "US"},
-    {"Arlington", 32.7357, -97.1081, -6, "US"},
-    {"New Orleans", 29.9511, -90.0715, -6, "US"},
-    {"Wichita", 37.6872, -97.3301, -6, "US"},
-    {"Cleveland", 41.4993, -81.6944, -5, "US"},
-    {"Tampa", 27.9506, -82.4572, -5, "US"},
-    {"Bakersfield", 35.3733, -119.0187, -8, "US"},
-    {"Aurora", 39.7294, -104.8319, -7, "US"},
-    {"Honolulu", 21.3099, -157.8581, -10, "US"},
-    {"Anaheim", 33.8366, -117.9143, -8, "US"},
-    {"Santa Ana", 33.7455, -117.8677, -8, "US"},
-    {"Corpus Christi", 27.8006, -97.3964, -6, "US"},
-    {"Riverside", 33.9533, -117.3962, -8, "US"},
-    {"Lexington", 38.0406, -84.5037, -5, "US"},
-    {"Stockton", 37.9577, -121.2908, -8, "US"},
-    {"Henderson", 36.0397, -114.9817, -8, "US"},
-    {"Saint Paul", 44.9537, -93.0900, -6, "US"},
-    {"St. Louis", 38.6270, -90.1994, -6, "US"},
-    {"Cincinnati", 39.1031, -84.5120, -5, "US"},
-    {"Pittsburgh", 40.4406, -79.9959, -5, "US"},
-    
-    // Canada
-    {"Toronto", 43.6532, -79.3832, -5, "CA"},
-    {"Montreal", 45.5017, -73.5673, -5, "CA"},
-    {"Vancouver", 49.2827, -123.1207, -8, "CA"},
-    {"Calgary", 51.0447, -114.0719, -7, "CA"},
-    {"Edmonton", 53.5461, -113.4938, -7, "CA"},
-    {"Ottawa", 45.4215, -75.6972, -5, "CA"},
-    {"Winnipeg", 49.8951, -97.1384, -6, "CA"},
-    {"Quebec City", 46.8139, -71.2080, -5, "CA"},
-    {"Hamilton", 43.2557, -79.8711, -5, "CA"},
-    {"Kitchener", 43.4643, -80.5204, -5, "CA"},
-    {"London", 42.9849, -81.2453, -5, "CA"},
-    {"Halifax", 44.6488, -63.5752, -4, "CA"},
-    
-    // Mexico
-    {"Mexico City", 19.4326, -99.1332, -6, "MX"},
-    {"Guadalajara", 20.6597, -103.3496, -6, "MX"},
-    {"Monterrey", 25.6866, -100.3161, -6, "MX"},
-    {"Puebla", 19.0414, -98.2063, -6, "MX"},
-    {"Tijuana", 32.5149, -117.0382, -8, "MX"},
-    {"León", 21.1619, -101.6921, -6, "MX"},
-    {"Juárez", 31.6904, -106.4245, -7, "MX"},
-    {"Zapopan", 20.7214, -103.3918, -6, "MX"},
-    {"Nezahualcóyotl", 19.4003, -99.0146, -6, "MX"},
-    {"Chihuahua", 28.6353, -106.0889, -7, "MX"},
-    
-    // Brazil
-    {"São Paulo", -23.5505, -46.6333, -3, "BR"},
-    {"Rio de Janeiro", -22.9068, -43.1729, -3, "BR"},
-    {"Brasília", -15.8267, -47.9218, -3, "BR"},
-    {"Salvador", -12.9714, -38.5014, -3, "BR"},
-    {"Fortaleza", -3.7172, -38.5433, -3, "BR"},
-    {"Belo Horizonte", -19.9167, -43.9345, -3, "BR"},
-    {"Manaus", -3.1190, -60.0217, -4, "BR"},
-    {"Curitiba", -25.4284, -49.2733, -3, "BR"},
-    {"Recife", -8.0476, -34.8770, -3, "BR"},
-    {"Goiânia", -16.6864, -49.2643, -3, "BR"},
-    {"Belém", -1.4558, -48.5044, -3, "BR"},
-    {"Porto Alegre", -30.0346, -51.2177, -3, "BR"},
-    {"Guarulhos", -23.4538, -46.5333, -3, "BR"},
-    {"Campinas", -22.9099, -47.0626, -3, "BR"},
-    {"São Luís", -2.5387, -44.2825, -3, "BR"},
-    
-    // Argentina
-    {"Buenos Aires", -34.6037, -58.3816, -3, "AR"},
-    {"Córdoba", -31.4201, -64.1888, -3, "AR"},
-    {"Rosario", -32.9442, -60.6505, -3, "AR"},
-    {"Mendoza", -32.8908, -68.8272, -3, "AR"},
-    {"La Plata", -34.9205, -57.9536, -3, "AR"},
-    {"San Miguel de Tucumán", -26.8241, -65.2226, -3, "AR"},
-    {"Mar del Plata", -38.0023, -57.5575, -3, "AR"},
-    {"Salta", -24.7859, -65.4117, -3, "AR"},
-    {"Santa Fe", -31.6333, -60.7000, -3, "AR"},
-    
-    // Colombia
-    {"Bogotá", 4.7110, -74.0721, -5, "CO"},
-    {"Medellín", 6.2442, -75.5812, -5, "CO"},
-    {"Cali", 3.4516, -76.5320, -5, "CO"},
-    {"Barranquilla", 10.9639, -74.7964, -5, "CO"},
-    {"Cartagena", 10.3910, -75.4794, -5, "CO"},
-    
-    // Peru
-    {"Lima", -12.0464, -77.0428, -5, "PE"},
-    {"Arequipa", -16.4090, -71.5375, -5, "PE"},
-    {"Trujillo", -8.1090, -79.0215, -5, "PE"},
-    {"Chiclayo", -6.7714, -79.8374, -5, "PE"},
-    {"Cusco", -13.5319, -71.9675, -5, "PE"},
-    
-    // Chile
-    {"Santiago", -33.4489, -70.6693, -4, "CL"},
-    {"Valparaíso", -33.0472, -71.6127, -4, "CL"},
-    {"Concepción", -36.8270, -73.0498, -4, "CL"},
-    {"La Serena", -29.9027, -71.2489, -4, "CL"},
-    {"Antofagasta", -23.6509, -70.3975, -4, "CL"},
-    
-    // Ecuador
-    {"Quito", -0.1807, -78.4678, -5, "EC"},
-    {"Guayaquil", -2.1700, -79.9224, -5, "EC"},
-    {"Cuenca", -2.9001, -79.0059, -5, "EC"},
-    
-    // Venezuela
-    {"Caracas", 10.4806, -66.9036, -4, "VE"},
-    {"Maracaibo", 10.6666, -71.6124, -4, "VE"},
-    {"Valencia", 10.1621, -68.0077, -4, "VE"},
-    {"Barquisimeto", 10.0647, -69.3570, -4, "VE"},
-    
-    // Uruguay
-    {"Montevideo", -34.9011, -56.1645, -3, "UY"},
-    {"Salto", -31.3833, -57.9667, -3, "UY"},
-    
-    // Paraguay
-    {"Asunción", -25.2637, -57.5759, -3, "PY"},
-    {"Ciudad del Este", -25.5095, -54.6161, -3, "PY"},
-    
-    // Bolivia
-    {"La Paz", -16.5000, -68.1500, -4, "BO"},
-    {"Santa Cruz", -17.8146, -63.1561, -4, "BO"},
-    {"Cochabamba", -17.3895, -66.1568, -4, "BO"},
-    
-    // Guyana
-    {"Georgetown", 6.8013, -58.1551, -4, "GY"},
-    
-    // Suriname
-    {"Paramaribo", 5.8520, -55.2038, -3, "SR"},
-    
-    // French Guiana
-    {"Cayenne", 4.9041, -52.3128, -3, "GF"},
-    
-    // Central America
-    // Guatemala
-    {"Guatemala City", 14.6349, -90.5069, -6, "GT"},
-    
-    // Belize
-    {"Belize City", 17.5045, -88.1962, -6, "BZ"},
-    
-    // El Salvador
-    {"San Salvador", 13.6929, -89.2182, -6, "SV"},
-    
-    // Honduras
-    {"Tegucigalpa", 14.0723, -87.1921, -6, "HN"},
-    
-    // Nicaragua
-    {"Managua", 12.1364, -86.2514, -6, "NI"},
-    
-    // Costa Rica
-    {"San José", 9.9281, -84.0907, -6, "CR"},
-    
-    // Panama
-    {"Panama City", 8.9824, -79.5199, -5, "PA"},
-    
-    // Caribbean
-    // Cuba
-    {"Havana", 23.1136, -82.3666, -5, "CU"},
-    {"Santiago de Cuba", 20.0247, -75.8219, -5, "CU"},
-    
-    // Jamaica
-    {"Kingston", 17.9970, -76.7936, -5, "JM"},
-    
-    // Haiti
-    {"Port-au-Prince", 18.5944, -72.3074, -5, "HT"},
-    
-    // Dominican Republic
-    {"Santo Domingo", 18.4861, -69.9312, -4, "DO"},
-    
-    // Puerto Rico
-    {"San Juan", 18.4655, -66.1057, -4, "PR"},
-    
-    // Trinidad and Tobago
-    {"Port of Spain", 10.6596, -61.5089, -4, "TT"},
-    
-    // Barbados
-    {"Bridgetown", 13.1019, -59.6165, -4, "BB"},
-    
-    // Africa
-    // Nigeria
-    {"Lagos", 6.5244, 3.3792, 1, "NG"},
-    {"Abuja", 9.0579, 7.4951, 1, "NG"},
-    {"Kano", 12.0022, 8.5920, 1, "NG"},
-    {"Ibadan", 7.3775, 3.9470, 1, "NG"},
-    {"Port Harcourt", 4.8156, 7.0498, 1, "NG"},
-    {"Benin City", 6.3350, 5.6037, 1, "NG"},
-    {"Maiduguri", 11.8311, 13.1511, 1, "NG"},
-    {"Zaria", 11.0804, 7.7076, 1, "NG"},
-    {"Aba", 5.1066, 7.3668, 1, "NG"},
-    {"Jos", 9.9285, 8.8921, 1, "NG"},
-    {"Ilorin", 8.4966, 4.5426, 1, "NG"},
-    {"Oyo", 7.8402, 3.9339, 1, "NG"},
-    {"Enugu", 6.4403, 7.4939, 1, "NG"},
-    {"Abeokuta", 7.1475, 3.3619, 1, "NG"},
-    {"Kaduna", 10.5105, 7.4165, 1, "NG"},
-    {"Ogbomoso", 8.1227, 4.2436, 1, "NG"},
-    {"Sokoto", 13.0622, 5.2433, 1, "NG"},
-    {"Onitsha", 6.1645, 6.7862, 1, "NG"},
-    {"Warri", 5.5160, 5.7500, 1, "NG"},
-    {"Okene", 7.5519, 6.2350, 1, "NG"},
-    {"Calabar", 4.9517, 8.3220, 1, "NG"},
-    {"Uyo", 5.0104, 7.8564, 1, "NG"},
-    {"Katsina", 12.9908, 7.6006, 1, "NG"},
-    {"Ado-Ekiti", 7.6180, 5.2205, 1, "NG"},
-    {"Bauchi", 10.3158, 9.8442, 1, "NG"},
-    {"Ikeja", 6.6018, 3.3515, 1, "NG"},
-    {"Makurdi", 7.7341, 8.5120, 1, "NG"},
-    {"Minna", 9.6177, 6.5569, 1, "NG"},
-    {"Effon-Alaiye", 7.6459, 4.9209, 1, "NG"},
-    {"Ilesa", 7.6284, 4.7419, 1, "NG"},
-    {"Akure", 7.2571, 5.2058, 1, "NG"},
-    {"Ikere-Ekiti", 7.5008, 5.2308, 1, "NG"},
-    {"Oghara", 5.5555, 5.9281, 1, "NG"},
-    {"Iseyin", 7.9667, 3.6000, 1, "NG"},
-    {"Sango Ota", 6.6833, 3.2667, 1, "NG"},
-    {"Owo", 7.1964, 5.5869, 1, "NG"},
-    {"Iwo", 7.6306, 4.1823, 1, "NG"},
-    {"Ikirun", 7.9167, 4.6667, 1, "NG"},
-    {"Shagamu", 6.8333, 3.6667, 1, "NG"},
-    {"Jimeta", 9.2833, 12.4667, 1, "NG"},
-    
-    // South Africa
-    {"Johannesburg", -26.2041, 28.0473, 2, "ZA"},
-    {"Cape Town", -33.9249, 18.4241, 2, "ZA"},
-    {"Durban", -29.8587, 31.0218, 2, "ZA"},
-    {"Pretoria", -25.7479, 28.2293, 2, "ZA"},
-    {"Port Elizabeth", -33.9608, 25.6022, 2, "ZA"},
-    {"Pietermaritzburg", -29.6144, 30.3922, 2, "ZA"},
-    {"Benoni", -26.1884, 28.3206, 2, "ZA"},
-    {"Tembisa", -25.9967, 28.2294, 2, "ZA"},
-    {"East London", -33.0153, 27.9116, 2, "ZA"},
-    {"Vereeniging", -26.6734, 27.9267, 2, "ZA"},
-    {"Bloemfontein", -29.0852, 26.1596, 2, "ZA"},
-    {"Boksburg", -26.2084, 28.2626, 2, "ZA"},
-    {"Welkom", -27.9772, 26.7353, 2, "ZA"},
-    {"Krugersdorp", -26.0855, 27.7756, 2, "ZA"},
-    {"Diepsloot", -25.9326, 28.0131, 2, "ZA"},
-    {"Botshabelo", -29.2333, 26.7167, 2, "ZA"},
-    {"Brakpan", -26.2367, 28.3697, 2, "ZA"},
-    {"Witbank", -25.8676, 29.2368, 2, "ZA"},
-    {"Oberholzer", -26.2000, 27.8500, 2, "ZA"},
-    {"Germiston", -26.2309, 28.1775, 2, "ZA"},
-    {"Springs", -26.2500, 28.4000, 2, "ZA"},
-    {"Roodepoort", -26.1625, 27.8702, 2, "ZA"},
-    {"Randburg", -26.0937, 28.0031, 2, "ZA"},
-    {"Vanderbijlpark", -26.7067, 27.8372, 2, "ZA"},
-    {"Centurion", -25.8601, 28.1887, 2, "ZA"},
-    {"Uitenhage", -33.7581, 25.3969, 2, "ZA"},
-    {"Midrand", -25.9953, 28.1293, 2, "ZA"},
-    {"Vryheid", -27.7696, 30.7915, 2, "ZA"},
-    {"Klerksdorp", -26.8668, 26.6612, 2, "ZA"},
-    {"Newcastle", -27.7574, 29.9317, 2, "ZA"},
-    {"Carletonville", -26.3598, 27.3948, 2, "ZA"},
-    {"Nigel", -26.4315, 28.4772, 2, "ZA"},
-    {"Mpumalanga", -25.5653, 30.5279, 2, "ZA"},
-    {"Bethal", -26.4667, 29.4667, 2, "ZA"},
-    {"Potchefstroom", -26.7140, 27.0982, 2, "ZA"},
-    {"Rustenburg", -25.6669, 27.2418, 2, "ZA"},
-    {"Sasolburg", -26.8132, 27.8151, 2, "ZA"},
-    {"Virginia", -28.1042, 26.8652, 2, "ZA"},
-    {"Brits", -25.6354, 27.7811, 2, "ZA"},
-    {"Phalaborwa", -23.9429, 31.1410, 2, "ZA"},
-    {"Polokwane", -23.9045, 29.4689, 2, "ZA"},
-    
-    // Kenya
-    {"Nairobi", -1.2921, 36.8219, 3, "KE"},
-    {"Mombasa", -4.0435, 39.6682, 3, "KE"},
-    {"Kisumu", -0.0917, 34.7680, 3, "KE"},
-    {"Nakuru", -0.3031, 36.0800, 3, "KE"},
-    {"Eldoret", 0.5143, 35.2698, 3, "KE"},
-    {"Kehancha", -1.0833, 34.4833, 3, "KE"},
-    {"Kitale", 1.0167, 35.0167, 3, "KE"},
-    {"Malindi", -3.2167, 40.1167, 3, "KE"},
-    {"Garissa", -0.4569, 39.6582, 3, "KE"},
-    {"Kakamega", 0.2827, 34.7519, 3, "KE"},
-    {"Thika", -1.0395, 37.0693, 3, "KE"},
-    {"Lamu", -2.2717, 40.9020, 3, "KE"},
-    {"Nyeri", -0.4167, 36.9500, 3, "KE"},
-    {"Machakos", -1.5177, 37.2634, 3, "KE"},
-    {"Meru", 0.0500, 37.6500, 3, "KE"},
-    {"Kericho", -0.3681, 35.2839, 3, "KE"},
-    {"Embu", -0.5391, 37.4506, 3, "KE"},
-    {"Migori", -1.0634, 34.4731, 3, "KE"},
-    {"Kapenguria", 1.2389, 35.1117, 3, "KE"},
-    {"Wajir", 1.7471, 40.0632, 3, "KE"},
-    
-    // Ethiopia
-    {"Addis Ababa", 9.1450, 40.4897, 3, "ET"},
-    {"Dire Dawa", 9.5915, 41.8661, 3, "ET"},
-    {"Mekelle", 13.4967, 39.4755, 3, "ET"},
-    {"Adama", 8.5400, 39.2689, 3, "ET"},
-    {"Gondar", 12.6090, 37.4739, 3, "ET"},
-    {"Awassa", 7.0500, 38.4667, 3, "ET"},
-    {"Bahir Dar", 11.5942, 37.3615, 3, "ET"},
-    {"Dessie", 11.1167, 39.6333, 3, "ET"},
-    {"Jimma", 7.6833, 36.8333, 3, "ET"},
-    {"Jijiga", 9.3500, 42.8000, 3, "ET"},
-    {"Shashemene", 7.2000, 38.6000, 3, "ET"},
-    {"Nekemte", 9.0833, 36.5500, 3, "ET"},
-    {"Debre Markos", 10.3500, 37.7167, 3, "ET"},
-    {"Harar", 9.3167, 42.1167, 3, "ET"},
-    {"Debre Berhan", 9.6833, 39.5333, 3, "ET"},
-    {"Dilla", 6.4167, 38.3167, 3, "ET"},
-    {"Arba Minch", 6.0333, 37.5500, 3, "ET"},
-    {"Hosaena", 7.5500, 37.8500, 3, "ET"},
-    {"Debre Zeit", 8.7500, 39.0000, 3, "ET"},
-    {"Ambo", 8.9833, 37.8500, 3, "ET"},
-    
-    // Ghana
-    {"Accra", 5.6037, -0.1870, 0, "GH"},
-    {"Kumasi", 6.6885, -1.6244, 0, "GH"},
-    {"Tamale", 9.4008, -0.8393, 0, "GH"},
-    {"Takoradi", 4.8845, -1.7554, 0, "GH"},
-    {"Tema", 5.6698, 0.0166, 0, "GH"},
-    {"Cape Coast", 5.1053, -1.2466, 0, "GH"},
-    {"Obuasi", 6.2022, -1.6596, 0, "GH"},
-    {"Koforidua", 6.0943, -0.2640, 0, "GH"},
-    {"Sunyani", 7.3369, -2.3265, 0, "GH"},
-    {"Ho", 6.6054, 0.4719, 0, "GH"},
-    {"Techiman", 7.5887, -1.9393, 0, "GH"},
-    {"Wa", 10.0606, -2.5075, 0, "GH"},
-    {"Bolgatanga", 10.7856, -0.8516, 0, "GH"},
-    {"Tarkwa", 5.3037, -1.9966, 0, "GH"},
-    {"Winneba", 5.3510, -0.6136, 0, "GH"},
-    {"Dunkwa-on-Offin", 5.9667, -1.7833, 0, "GH"},
-    
-    // Senegal
-    {"Dakar", 14.7167, -17.4677, 0, "SN"},
-    {"Touba", 14.8500, -15.8833, 0, "SN"},
-    {"Thiès", 14.7886, -16.9236, 0, "SN"},
-    {"Kaolack", 14.1333, -16.0667, 0, "SN"},
-    {"Mbour", 14.4203, -16.9619, 0, "SN"},
-    {"Saint-Louis", 16.0469, -16.4814, 0, "SN"},
-    {"Ziguinchor", 12.5681, -16.2719, 0, "SN"},
-    {"Diourbel", 14.6522, -16.2283, 0, "SN"},
-    {"Louga", 15.6181, -16.2403, 0, "SN"},
-    {"Tambacounda", 13.7708, -13.6681, 0, "SN"},
-    {"Kolda", 12.8944, -14.9406, 0, "SN"},
-    {"Fatick", 14.3347, -16.4119, 0, "SN"},
-    {"Matam", 15.6556, -13.2553, 0, "SN"},
-    {"Kedougou", 12.5606, -12.1731, 0, "SN"},
-    
-    // Morocco (already included above)
-    // Tunisia (already included above)
-    // Algeria (already included above)
-    // Libya (already included above)
-    // Egypt (already included above)
-    // Sudan (already included above)
-    
-    // Tanzania
-    {"Dar es Salaam", -6.7924, 39.2083, 3, "TZ"},
-    {"Mwanza", -2.5164, 32.9175, 3, "TZ"},
-    {"Arusha", -3.3869, 36.6830, 3, "TZ"},
-    {"Dodoma", -6.1630, 35.7516, 3, "TZ"},
-    {"Mbeya", -8.9094, 33.4608, 3, "TZ"},
-    {"Morogoro", -6.8235, 37.6588, 3, "TZ"},
-    {"Tanga", -5.0678, 39.0992, 3, "TZ"},
-    {"Tabora", -5.0167, 32.8333, 3, "TZ"},
-    {"Kigoma", -4.8772, 29.6269, 3, "TZ"},
-    {"Mtwara", -10.2669, 40.1828, 3, "TZ"},
-    {"Musoma", -1.5000, 33.8000, 3, "TZ"},
-    {"Iringa", -7.7667, 35.7000, 3, "TZ"},
-    {"Singida", -4.8167, 34.7500, 3, "TZ"},
-    {"Njombe", -9.3333, 34.7667, 3, "TZ"},
-    {"Bukoba", -1.3314, 31.8120, 3, "TZ"},
-    {"Songea", -10.6833, 35.6500, 3, "TZ"},
-    {"Sumbawanga", -7.9667, 31.6167, 3, "TZ"},
-    {"Lindi", -10.0000, 39.7167, 3, "TZ"},
-    {"Shinyanga", -3.6667, 33.4167, 3, "TZ"},
-    {"Zanzibar City", -6.1659, 39.2026, 3, "TZ"},
-    
-    // Uganda
-    {"Kampala", 0.3476, 32.5825, 3, "UG"},
-    {"Gulu", 2.7833, 32.3000, 3, "UG"},
-    {"Lira", 2.2500, 32.9000, 3, "UG"},
-    {"Mbarara", -0.6069, 30.6478, 3, "UG"},
-    {"Jinja", 0.4236, 33.2042, 3, "UG"},
-    {"Mbale", 1.0833, 34.1750, 3, "UG"},
-    {"Mukono", 0.3533, 32.7553, 3, "UG"},
-    {"Kasese", 0.1833, 30.0833, 3, "UG"},
-    {"Masaka", -0.3375, 31.7331, 3, "UG"},
-    {"Entebbe", 0.0667, 32.4667, 3, "UG"},
-    {"Kabale", -1.2481, 29.9900, 3, "UG"},
-    {"Arua", 3.0333, 30.9167, 3, "UG"},
-    {"Kitgum", 3.2833, 32.8833, 3, "UG"},
-    {"Koboko", 3.4000, 30.9667, 3, "UG"},
-    {"Iganga", 0.6167, 33.4667, 3, "UG"},
-    {"Soroti", 1.7167, 33.6000, 3, "UG"},
-    {"Fort Portal", 0.6714, 30.2747, 3, "UG"},
-    {"Hoima", 1.4333, 31.3500, 3, "UG"},
-    {"Pader", 3.0000, 33.1000, 3, "UG"},
-    {"Tororo", 0.6928, 34.1806, 3, "UG"},
-    
-    // Rwanda
-    {"Kigali", -1.9706, 30.1044, 2, "RW"},
-    {"Butare", -2.5967, 29.7414, 2, "RW"},
-    {"Gitarama", -2.0750, 29.7564, 2, "RW"},
-    {"Ruhengeri", -1.4994, 29.6342, 2, "RW"},
-    {"Gisenyi", -1.7028, 29.2581, 2, "RW"},
-    {"Byumba", -1.5833, 30.0667, 2, "RW"},
-    {"Cyangugu", -2.4833, 28.9167, 2, "RW"},
-    {"Kibungo", -2.1667, 30.5333, 2, "RW"},
-    {"Kibuye", -2.0606, 29.3486, 2, "RW"},
-    {"Gikongoro", -2.4167, 29.5667, 2, "RW"},
-    
-    // Burundi
-    {"Bujumbura", -3.3614, 29.3599, 2, "BI"},
-    {"Gitega", -3.4264, 29.9306, 2, "BI"},
-    {"Muyinga", -2.8453, 30.3428, 2, "BI"},
-    {"Ngozi", -2.9075, 29.8308, 2, "BI"},
-    {"Ruyigi", -3.4764, 30.2497, 2, "BI"},
-    {"Kayanza", -2.9219, 29.6292, 2, "BI"},
-    {"Bururi", -3.9486, 29.6244, 2, "BI"},
-    {"Muramvya", -3.2683, 29.6083, 2, "BI"},
-    {"Rutana", -3.9283, 29.9928, 2, "BI"},
-    {"Makamba", -4.1383, 29.8044, 2, "BI"},
-    
-    // Democratic Republic of Congo
-    {"Kinshasa", -4.4419, 15.2663, 1, "CD"},
-    {"Lubumbashi", -11.6649, 27.4794, 2, "CD"},
-    {"Mbuji-Mayi", -6.1364, 23.5897, 2, "CD"},
-    {"Kisangani", 0.5167, 25.2000, 2, "CD"},
-    {"Masina", -4.3833, 15.3917, 1, "CD"},
-    {"Kananga", -5.8906, 22.4136, 2, "CD"},
-    {"Likasi", -10.9847, 26.7384, 2, "CD"},
-    {"Kolwezi", -10.7147, 25.4665, 2, "CD"},
-    {"Tshikapa", -6.4167, 20.8000, 1, "CD"},
-    {"Beni", 0.4833, 29.4667, 2, "CD"},
-    {"Bukavu", -2.5081, 28.8608, 2, "CD"},
-    {"Mwene-Ditu", -7.0000, 23.4500, 2, "CD"},
-    {"Kikwit", -5.0411, 18.8164, 1, "CD"},
-    {"Mbandaka", 0.0465, 18.2606, 1, "CD"},
-    {"Matadi", -5.8386, 13.4631, 1, "CD"},
-    {"Uvira", -3.3906, 29.1394, 2, "CD"},
-    {"Butembo", 0.1417, 29.2914, 2, "CD"},
-    {"Gandajika", -6.7450, 23.9533, 2, "CD"},
-    {"Kalemie", -5.9278, 29.1944, 2, "CD"},
-    {"Goma", -1.6792, 29.2403, 2, "CD"},
-    
-    // Republic of Congo
-    {"Brazzaville", -4.2634, 15.2429, 1, "CG"},
-    {"Pointe-Noire", -4.7692, 11.8636, 1, "CG"},
-    {"Dolisie", -4.1975, 12.6683, 1, "CG"},
-    {"Nkayi", -4.2167, 13.2833, 1, "CG"},
-    {"Mossendjo", -2.9333, 12.7000, 1, "CG"},
-    {"Impfondo", 1.6167, 18.0667, 1, "CG"},
-    {"Ouesso", 1.6136, 16.0519, 1, "CG"},
-    {"Madingou", -4.1667, 13.5500, 1, "CG"},
-    {"Owando", -0.4833, 15.9000, 1, "CG"},
-    {"Sibiti", -3.6833, 13.3500, 1, "CG"},
-    
-    // Central African Republic
-    {"Bangui", 4.3947, 18.5582, 1, "CF"},
-    {"Bimbo", 4.2536, 18.4183, 1, "CF"},
-    {"Berbérati", 4.2611, 15.7919, 1, "CF"},
-    {"Carnot", 4.9428, 15.8756, 1, "CF"},
-    {"Bambari", 5.7617, 20.6756, 1, "CF"},
-    {"Bouar", 5.9333, 15.6000, 1, "CF"},
-    {"Bossangoa", 6.4833, 17.4500, 1, "CF"},
-    {"Bria", 6.5167, 21.9833, 1, "CF"},
-    {"Bangassou", 4.7414, 22.8181, 1, "CF"},
-    {"Nola", 3.5267, 16.0456, 1, "CF"},
-    
-    // Chad
-    {"N'Djamena", 12.1348, 15.0557, 1, "TD"},
-    {"Moundou", 8.5667, 16.0833, 1, "TD"},
-    {"Sarh", 9.1500, 18.3833, 1, "TD"},
-    {"Abéché", 13.8267, 20.8322, 1, "TD"},
-    {"Koumra", 8.9167, 17.5500, 1, "TD"},
-    {"Pala", 9.3667, 14.9167, 1, "TD"},
-    {"Am Timan", 11.0333, 20.2833, 1, "TD"},
-    {"Bongor", 10.2833, 15.3667, 1, "TD"},
-    {"Mongo", 12.1833, 18.6833, 1, "TD"},
-    {"Doba", 8.6500, 16.8500, 1, "TD"},
-    {"Ati", 13.2167, 18.3333, 1, "TD"},
-    {"Laï", 9.3967, 16.3000, 1, "TD"},
-    {"Kelo", 9.3083, 15.8067, 1, "TD"},
-    {"Mao", 14.1200, 15.3100, 1, "TD"},
-    {"Biltine", 14.5333, 20.9167, 1, "TD"},
-    
-    // Cameroon
-    {"Yaoundé", 3.8480, 11.5021, 1, "CM"},
-    {"Douala", 4.0511, 9.7679, 1, "CM"},
-    {"Bamenda", 5.9597, 10.1489, 1, "CM"},
-    {"Bafoussam", 5.4761, 10.4200, 1, "CM"},
-    {"Garoua", 9.3014, 13.3964, 1, "CM"},
-    {"Maroua", 10.5906, 14.3156, 1, "CM"},
-    {"Nkongsamba", 4.9547, 9.9400, 1, "CM"},
-    {"Bertoua", 4.5775, 13.6847, 1, "CM"},
-    {"Edéa", 3.8000, 10.1333, 1, "CM"},
-    {"Loum", 4.7167, 9.7333, 1, "CM"},
-    {"Kumba", 4.6336, 9.4569, 1, "CM"},
-    {"Ngaoundéré", 7.3167, 13.5833, 1, "CM"},
-    {"Ebolowa", 2.9147, 11.1539, 1, "CM"},
-    {"Kribi", 2.9333, 9.9167, 1, "CM"},
-    {"Tiko", 4.0733, 9.3603, 1, "CM"},
-    {"Mbalmayo", 3.5167, 11.5000, 1, "CM"},
-    {"Dschang", 5.4500, 10.0500, 1, "CM"},
-    {"Mbouda", 5.6267, 10.2547, 1, "CM"},
-    {"Foumban", 5.7278, 10.9017, 1, "CM"},
-    {"Limbe", 4.0156, 9.2144, 1, "CM"},
-    
-    // Gabon
-    {"Libreville", 0.4162, 9.4673, 1, "GA"},
-    
-    // Equatorial Guinea
-    {"Malabo", 3.7558, 8.7825, 1, "GQ"},
-    
-    // São Tomé and Príncipe
-    {"São Tomé", 0.1864, 6.6131, 0, "ST"},
-    
-    // Angola
-    {"Luanda", -8.8390, 13.2894, 1, "AO"},
-    
-    // Namibia
-    {"Windhoek", -22.9576, 17.0832, 1, "NA"},
-    
-    // Botswana
-    {"Gaborone", -24.6282, 25.9231, 2, "BW"},
-    {"Francistown", -21.1669, 27.508, 2, "BW"},
-    {"Molepolole", -24.4167, 25.4833, 2, "BW"},
-    {"Serowe", -22.3833, 26.7167, 2, "BW"},
-    {"Selibe Phikwe", -22.0058, 27.8475, 2, "BW"},
-    {"Maun", -19.9833, 23.4167, 2, "BW"},
-    {"Kanye", -24.9833, 25.3333, 2, "BW"},
-    {"Mochudi", -24.4333, 26.1500, 2, "BW"},
-    {"Mahalapye", -23.1000, 26.7667, 2, "BW"},
-    {"Palapye", -22.5333, 27.1333, 2, "BW"},
-    {"Jwaneng", -24.6000, 24.7167, 2, "BW"},
-    {"Lobatse", -25.2167, 25.6667, 2, "BW"},
-    
-    // Zimbabwe
-    {"Harare", -17.8252, 31.0335, 2, "ZW"},
-    {"Bulawayo", -20.1619, 28.5906, 2, "ZW"},
-    {"Chitungwiza", -18.0167, 31.0833, 2, "ZW"},
-    {"Mutare", -18.9667, 32.6667, 2, "ZW"},
-    {"Epworth", -17.8900, 31.1467, 2, "ZW"},
-    {"Gweru", -19.4500, 29.8167, 2, "ZW"},
-    {"Kwekwe", -18.9167, 29.8167, 2, "ZW"},
-    {"Kadoma", -18.3333, 29.9167, 2, "ZW"},
-    {"Masvingo", -20.0638, 30.8278, 2, "ZW"},
-    {"Chinhoyi", -17.3667, 30.2000, 2, "ZW"},
-    {"Norton", -17.8833, 30.7000, 2, "ZW"},
-    {"Marondera", -18.1854, 31.5524, 2, "ZW"},
-    {"Ruwa", -17.8900, 31.2467, 2, "ZW"},
-    {"Chegutu", -18.1333, 30.1333, 2, "ZW"},
-    {"Zvishavane", -20.3333, 30.0333, 2, "ZW"},
-    {"Bindura", -17.3000, 31.3167, 2, "ZW"},
-    {"Beitbridge", -22.2167, 30.0000, 2, "ZW"},
-    {"Redcliff", -19.0333, 29.7833, 2, "ZW"},
-    {"Victoria Falls", -17.9244, 25.8322, 2, "ZW"},
-    {"Hwange", -18.3667, 26.5000, 2, "ZW"},
-    
-    // Zambia
-    {"Lusaka", -15.3875, 28.3228, 2, "ZM"},
-    {"Kitwe", -12.8024, 28.2134, 2, "ZM"},
-    {"Ndola", -12.9587, 28.6366, 2, "ZM"},
-    {"Kabwe", -14.4469, 28.4464, 2, "ZM"},
-    {"Chingola", -12.5289, 27.8619, 2, "ZM"},
-    {"Mufulira", -12.5500, 28.2410, 2, "ZM"},
-    {"Luanshya", -13.1367, 28.4167, 2, "ZM"},
-    {"Livingstone", -17.8419, 25.8544, 2, "ZM"},
-    {"Kasama", -10.2129, 31.1807, 2, "ZM"},
-    {"Chipata", -13.6306, 32.6464, 2, "ZM"},
-    {"Mazabuka", -15.8600, 27.7483, 2, "ZM"},
-    {"Choma", -16.8088, 26.9881, 2, "ZM"},
-    {"Kapiri Mposhi", -13.9708, 28.6700, 2, "ZM"},
-    {"Mongu", -15.2548, 23.1317, 2, "ZM"},
-    {"Kafue", -15.7694, 28.1811, 2, "ZM"},
-    
-    // Malawi
-    {"Lilongwe", -13.9626, 33.7741, 2, "MW"},
-    {"Blantyre", -15.7861, 35.0058, 2, "MW"},
-    {"Mzuzu", -11.4648, 34.0100, 2, "MW"},
-    {"Zomba", -15.3850, 35.3189, 2, "MW"},
-    {"Kasungu", -13.0167, 33.4833, 2, "MW"},
-    {"Mangochi", -14.4783, 35.2642, 2, "MW"},
-    {"Salima", -13.7583, 34.4597, 2, "MW"},
-    {"Liwonde", -15.0606, 35.2239, 2, "MW"},
-    {"Karonga", -9.9333, 33.9333, 2, "MW"},
-    {"Nsanje", -16.9197, 35.2614, 2, "MW"},
-    {"Machinga", -14.9833, 35.5167, 2, "MW"},
-    {"Dedza", -14.3783, 34.3331, 2, "MW"},
-    
-    // Mozambique
-    {"Maputo", -25.9692, 32.5732, 2, "MZ"},
-    {"Beira", -19.8436, 34.8389, 2, "MZ"},
-    {"Nampula", -15.1165, 39.2666, 2, "MZ"},
-    {"Chimoio", -19.1164, 33.4839, 2, "MZ"},
-    {"Nacala", -14.5428, 40.6725, 2, "MZ"},
-    {"Quelimane", -17.8786, 36.8883, 2, "MZ"},
-    {"Tete", -16.1564, 33.5867, 2, "MZ"},
-    {"Xai-Xai", -25.0519, 33.6444, 2, "MZ"},
-    {"Lichinga", -13.3133, 35.2406, 2, "MZ"},
-    {"Pemba", -12.9745, 40.5178, 2, "MZ"},
-    {"Inhambane", -23.8650, 35.3833, 2, "MZ"},
-    {"Dondo", -19.6097, 34.7431, 2, "MZ"},
-    {"Gurué", -15.4667, 36.9833, 2, "MZ"},
-    {"Maxixe", -23.8597, 35.3472, 2, "MZ"},
-    {"Angoche", -16.2325, 39.9083, 2, "MZ"},
-    
-    // Madagascar
-    {"Antananarivo", -18.8792, 47.5079, 3, "MG"},
-    {"Toamasina", -18.1492, 49.4022, 3, "MG"},
-    {"Antsirabe", -19.8667, 47.0167, 3, "MG"},
-    {"Fianarantsoa", -21.4500, 47.0833, 3, "MG"},
-    {"Mahajanga", -15.7167, 46.3167, 3, "MG"},
-    {"Toliara", -23.3500, 43.6667, 3, "MG"},
-    {"Antsiranana", -12.2792, 49.2911, 3, "MG"},
-    {"Morondava", -20.2833, 44.2833, 3, "MG"},
-    {"Ambovombe", -25.1667, 46.0833, 3, "MG"},
-    {"Manakara", -22.1333, 48.0167, 3, "MG"},
-    {"Mananjary", -21.2167, 48.3333, 3, "MG"},
-    {"Sambava", -14.2667, 50.1667, 3, "MG"},
-    {"Fort Dauphin", -25.0281, 46.9975, 3, "MG"},
-    {"Maintirano", -18.0500, 44.0333, 3, "MG"},
-    {"Vatomandry", -19.3333, 48.9667, 3, "MG"},
-    
-    // Mauritius
-    {"Port Louis", -20.1654, 57.5015, 4, "MU"},
-    {"Beau Bassin-Rose Hill", -20.2333, 57.4667, 4, "MU"},
-    {"Vacoas-Phoenix", -20.2981, 57.4789, 4, "MU"},
-    {"Curepipe", -20.3167, 57.5167, 4, "MU"},
-    {"Quatre Bornes", -20.2667, 57.4833, 4, "MU"},
-    {"Triolet", -20.0500, 57.5500, 4, "MU"},
-    {"Goodlands", -20.0333, 57.5833, 4, "MU"},
-    {"Centre de Flacq", -20.2000, 57.7167, 4, "MU"},
-    {"Mahebourg", -20.4064, 57.7000, 4, "MU"},
-    {"Saint Pierre", -20.2167, 57.5167, 4, "MU"},
-    
-    // Seychelles
-    {"Victoria", -4.6796, 55.4920, 4, "SC"},
-    
-    // Comoros
-    {"Moroni", -11.7172, 43.2473, 3, "KM"},
-    
-    // Djibouti
-    {"Djibouti", 11.8251, 42.5903, 3, "DJ"},
-    
-    // Eritrea
-    {"Asmara", 15.3229, 38.9251, 3, "ER"},
-    
-    // Somalia
-    {"Mogadishu", 2.0469, 45.3182, 3, "SO"},
-    
-    // Ivory Coast
-    {"Abidjan", 5.3364, -4.0267, 0, "CI"},
-    {"Yamoussoukro", 6.8276, -5.2893, 0, "CI"},
-    
-    // Burkina Faso
-    {"Ouagadougou", 12.3714, -1.5197, 0, "BF"},
-    
-    // Mali
-    {"Bamako", 12.6392, -8.0029, 0, "ML"},
-    
-    // Niger
-    {"Niamey", 13.5116, 2.1254, 1, "NE"},
-    
-    // Guinea
-    {"Conakry", 9.6412, -13.5784, 0, "GN"},
-    
-    // Sierra Leone
-    {"Freetown", 8.4657, -13.2317, 0, "SL"},
-    
-    // Liberia
-    {"Monrovia", 6.2907, -10.7605, 0, "LR"},
-    
-    // Gambia
-    {"Banjul", 13.4549, -16.5790, 0, "GM"},
-    
-    // Guinea-Bissau
-    {"Bissau", 11.8037, -15.1804, 0, "GW"},
-    
-    // Cape Verde
-    {"Praia", 14.9177, -23.5092, -1, "CV"},
-    
-    // Togo
-    {"Lomé", 6.1319, 1.2228, 0, "TG"},
-    
-    // Benin
-    {"Porto-Novo", 6.4968, 2.6281, 1, "BJ"},
-    {"Cotonou", 6.4023, 2.5059, 1, "BJ"},
-    
-    // Lesotho
-    {"Maseru", -29.3151, 27.4869, 2, "LS"},
-    
-    // Swaziland
-    {"Mbabane", -26.3054, 31.1367, 2, "SZ"},
-    
-    // Oceania
-    // Australia
-    {"Sydney", -33.8688, 151.2093, 10, "AU"},
-    {"Melbourne", -37.8136, 144.9631, 10, "AU"},
-    {"Brisbane", -27.4698, 153.0251, 10, "AU"},
-    {"Perth", -31.9505, 115.8605, 8, "AU"},
-    {"Adelaide", -34.9285, 138.6007, 9, "AU"},
-    {"Canberra", -35.2809, 149.1300, 10, "AU"},
-    {"Gold Coast", -28.0167, 153.4000, 10, "AU"},
-    {"Newcastle", -32.9283, 151.7817, 10, "AU"},
-    {"Wollongong", -34.4278, 150.8931, 10, "AU"},
-    {"Darwin", -12.4634, 130.8456, 9, "AU"},
-    {"Hobart", -42.8821, 147.3272, 10, "AU"},
-    
-    // New Zealand
-    {"Auckland", -36.8485, 174.7633, 12, "NZ"},
-    {"Wellington", -41.2865, 174.7762, 12, "NZ"},
-    {"Christchurch", -43.5321, 172.6362, 12, "NZ"},
-    {"Hamilton", -37.7870, 175.2793, 12, "NZ"},
-    {"Dunedin", -45.8788, 170.5028, 12, "NZ"},
-    
-    // Papua New Guinea
-    {"Port Moresby", -9.4438, 147.1803, 10, "PG"},
-    
-    // Fiji
-    {"Suva", -18.1416, 178.4419, 12, "FJ"},
-    
-    // Solomon Islands
-    {"Honiara", -9.4280, 159.9498, 11, "SB"},
-    
-    // Vanuatu
-    {"Port Vila", -17.7334, 168.3273, 11, "VU"},
-    
-    // New Caledonia
-    {"Nouméa", -22.2758, 166.4581, 11, "NC"},
-    
-    // French Polynesia
-    {"Papeete", -17.5516, -149.5585, -10, "PF"},
-    
-    // Samoa
-    {"Apia", -13.8506, -171.7513, 13, "WS"},
-    
-    // Tonga
-    {"Nuku'alofa", -21.1390, -175.2018, 13, "TO"},
-    
-    // Palau
-    {"Ngerulmud", 7.5006, 134.6242, 9, "PW"},
-    
-    // Micronesia
-    {"Palikir", 6.9248, 158.1611, 11, "FM"},
-    
-    // Marshall Islands
-    {"Majuro", 7.1315, 171.1845, 12, "MH"},
-    
-    // Kiribati
-    {"Tarawa", 1.3278, 172.977, 12, "KI"},
-    
-    // Nauru
-    {"Yaren", -0.5477, 166.9209, 12, "NR"},
-    
-    // Tuvalu
-    {"Funafuti", -8.5243, 179.1942, 12, "TV"}
-};
-
-#define WORLD_CITIES_COUNT (sizeof(world_cities) / sizeof(world_cities[0]))
-
-// Function to find city by name
-const city_data_t* find_city_by_name(const char* city_name);
+// Function to find city by name (index, -1 if not found)
+int find_city_by_name(const char* city_name);
 
 // Function to get total number of cities
 int get_total_cities_count(void);
 
-// Function to get city by index
-const city_data_t* get_city_by_index(int index);
+// Function to unpack the city at an index (false if out of range)
+bool get_city_by_index(int index, city_data_t* city);
 
-// Function to find nearest city to GPS coordinates
-const city_data_t* find_nearest_city(double latitude, double longitude);
+// Function to find nearest city to GPS coordinates (index, -1 if the table is empty)
+int find_nearest_city(double latitude, double longitude);
 
-#endif // WORLD_CITIES_H
\ No newline at end of file
+#endif // WORLD_CITIES_H
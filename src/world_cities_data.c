@@ -0,0 +1,6478 @@
+/**
+ * @file world_cities_data.c
+ * @brief City table (generated by tools/gen_city_table.py from tools/world_cities.csv)
+ *
+ * 2028 cities: 8-byte positions, 6-byte records and a 17245-byte name pool
+ * (17432 bytes before sharing), 45637 bytes in all.
+ * Do not edit by hand, edit the CSV and regenerate instead.
+ */
+
+#include "world_cities.h"
+
+const int world_cities_count = 2028;
+
+// Names, NUL-separated; a name equal to or ending another one points into it
+const char world_city_names[] =
+    "Mecca\0"
+    "Medina\0"
+    "Riyadh\0"
+    "Jeddah\0"
+    "Dammam\0"
+    "Khobar\0"
+    "Taif\0"
+    "Abha\0"
+    "Tabuk\0"
+    "Hail\0"
+    "Dubai\0"
+    "Abu Dhabi\0"
+    "Sharjah\0"
+    "Ajman\0"
+    "Fujairah\0"
+    "Ras Al Khaimah\0"
+    "Umm Al Quwain\0"
+    "Cairo\0"
+    "Alexandria\0"
+    "Giza\0"
+    "Luxor\0"
+    "Aswan\0"
+    "Port Said\0"
+    "Suez\0"
+    "Hurghada\0"
+    "Sharm El Sheikh\0"
+    "Istanbul\0"
+    "Ankara\0"
+    "Izmir\0"
+    "Bursa\0"
+    "Antalya\0"
+    "Konya\0"
+    "Adana\0"
+    "Gaziantep\0"
+    "Kayseri\0"
+    "Eskisehir\0"
+    "Diyarbakir\0"
+    "Samsun\0"
+    "Denizli\0"
+    "Malatya\0"
+    "Kahramanmaras\0"
+    "Erzurum\0"
+    "Van\0"
+    "Batman\0"
+    "Elaz\304\261\304\237\0"
+    "Icel\0"
+    "Manisa\0"
+    "Sivas\0"
+    "Gebze\0"
+    "Bal\304\261kesir\0"
+    "Sanliurfa\0"
+    "Trabzon\0"
+    "Ordu\0"
+    "Aydin\0"
+    "Usak\0"
+    "Isparta\0"
+    "Afyon\0"
+    "Zonguldak\0"
+    "Tokat\0"
+    "Tehran\0"
+    "Mashhad\0"
+    "Isfahan\0"
+    "Karaj\0"
+    "Tabriz\0"
+    "Shiraz\0"
+    "Qom\0"
+    "Ahvaz\0"
+    "Kermanshah\0"
+    "Urmia\0"
+    "Zahedan\0"
+    "Rasht\0"
+    "Kerman\0"
+    "Hamadan\0"
+    "Arak\0"
+    "Yazd\0"
+    "Ardabil\0"
+    "Bandar Abbas\0"
+    "Eslamshahr\0"
+    "Zanjan\0"
+    "Sanandaj\0"
+    "Qazvin\0"
+    "Khomeynishahr\0"
+    "Dezful\0"
+    "Nasim Shahr\0"
+    "Khorramshahr\0"
+    "Shahrud\0"
+    "Gorgan\0"
+    "Neyshabur\0"
+    "Sari\0"
+    "Babol\0"
+    "Abadan\0"
+    "Khorramabad\0"
+    "Ilam\0"
+    "Mahabad\0"
+    "Varamin\0"
+    "Baghdad\0"
+    "Basra\0"
+    "Erbil\0"
+    "Najaf\0"
+    "Karbala\0"
+    "Mosul\0"
+    "Sulaymaniyah\0"
+    "Kirkuk\0"
+    "Hillah\0"
+    "Samarra\0"
+    "Ramadi\0"
+    "Fallujah\0"
+    "Tikrit\0"
+    "Baqubah\0"
+    "Nasiriyah\0"
+    "Amara\0"
+    "Kut\0"
+    "Diwaniyah\0"
+    "Dohuk\0"
+    "Zakho\0"
+    "Amman\0"
+    "Zarqa\0"
+    "Irbid\0"
+    "Aqaba\0"
+    "Salt\0"
+    "Beirut\0"
+    "Tripoli\0"
+    "Sidon\0"
+    "Tyre\0"
+    "Damascus\0"
+    "Aleppo\0"
+    "Homs\0"
+    "Latakia\0"
+    "Jerusalem\0"
+    "Gaza\0"
+    "Tel Aviv\0"
+    "Haifa\0"
+    "Kuwait City\0"
+    "Ahmadi\0"
+    "Hawalli\0"
+    "Doha\0"
+    "Al Rayyan\0"
+    "Umm Salal\0"
+    "Manama\0"
+    "Riffa\0"
+    "Muharraq\0"
+    "Muscat\0"
+    "Salalah\0"
+    "Sohar\0"
+    "Sanaa\0"
+    "Aden\0"
+    "Taiz\0"
+    "Casablanca\0"
+    "Rabat\0"
+    "Fez\0"
+    "Marrakech\0"
+    "Agadir\0"
+    "Tangier\0"
+    "Meknes\0"
+    "Oujda\0"
+    "Kenitra\0"
+    "Tetouan\0"
+    "Safi\0"
+    "Mohammedia\0"
+    "Khouribga\0"
+    "El Jadida\0"
+    "Beni Mellal\0"
+    "Nador\0"
+    "Taza\0"
+    "Settat\0"
+    "Larache\0"
+    "Ksar El Kebir\0"
+    "Khemisset\0"
+    "Guelmim\0"
+    "Berkane\0"
+    "Taourirt\0"
+    "Errachidia\0"
+    "Ouarzazate\0"
+    "Tiznit\0"
+    "Al Hoceima\0"
+    "Taroudannt\0"
+    "Essaouira\0"
+    "Algiers\0"
+    "Oran\0"
+    "Constantine\0"
+    "Annaba\0"
+    "Blida\0"
+    "Batna\0"
+    "Djelfa\0"
+    "Setif\0"
+    "Sidi Bel Abbes\0"
+    "Biskra\0"
+    "Tebessa\0"
+    "El Oued\0"
+    "Skikda\0"
+    "Tiaret\0"
+    "Beja\303\257a\0"
+    "Tlemcen\0"
+    "Ouargla\0"
+    "Bechar\0"
+    "Mostaganem\0"
+    "Bordj Bou Arr\303\251ridj\0"
+    "Chlef\0"
+    "Souk Ahras\0"
+    "El Tarf\0"
+    "Jijel\0"
+    "Relizane\0"
+    "Mascara\0"
+    "Ouled Djellal\0"
+    "Bou Saada\0"
+    "Tunis\0"
+    "Sfax\0"
+    "Sousse\0"
+    "Kairouan\0"
+    "Ettadhamen\0"
+    "Bizerte\0"
+    "Gab\303\250s\0"
+    "Ariana\0"
+    "Gafsa\0"
+    "Kasserine\0"
+    "Monastir\0"
+    "Ben Arous\0"
+    "Temara\0"
+    "Mahdia\0"
+    "El Kef\0"
+    "Medenine\0"
+    "Nabeul\0"
+    "Tataouine\0"
+    "Beja\0"
+    "Jendouba\0"
+    "Zaghouan\0"
+    "Siliana\0"
+    "Sidi Bouzid\0"
+    "Benghazi\0"
+    "Misrata\0"
+    "Bayda\0"
+    "Sabha\0"
+    "Zawiya\0"
+    "Zliten\0"
+    "Ajdabiya\0"
+    "Tobruk\0"
+    "Sirte\0"
+    "Al Khums\0"
+    "Marj\0"
+    "Gharyan\0"
+    "Derna\0"
+    "Murzuq\0"
+    "Ghat\0"
+    "Waddan\0"
+    "Khartoum\0"
+    "Omdurman\0"
+    "Port Sudan\0"
+    "Karachi\0"
+    "Lahore\0"
+    "Islamabad\0"
+    "Faisalabad\0"
+    "Rawalpindi\0"
+    "Multan\0"
+    "Hyderabad\0"
+    "Gujranwala\0"
+    "Peshawar\0"
+    "Quetta\0"
+    "New Delhi\0"
+    "Kolkata\0"
+    "Chennai\0"
+    "Bangalore\0"
+    "Ahmedabad\0"
+    "Pune\0"
+    "Surat\0"
+    "Jaipur\0"
+    "Lucknow\0"
+    "Kanpur\0"
+    "Nagpur\0"
+    "Indore\0"
+    "Bhopal\0"
+    "Visakhapatnam\0"
+    "Patna\0"
+    "Vadodara\0"
+    "Ghaziabad\0"
+    "Ludhiana\0"
+    "Agra\0"
+    "Nashville\0"
+    "Faridabad\0"
+    "Meerut\0"
+    "Rajkot\0"
+    "Kalyan\0"
+    "Vasai-Virar\0"
+    "Varanasi\0"
+    "Srinagar\0"
+    "Aurangabad\0"
+    "Dhanbad\0"
+    "Amritsar\0"
+    "Navi Mumbai\0"
+    "Allahabad\0"
+    "Ranchi\0"
+    "Howrah\0"
+    "Coimbatore\0"
+    "Jabalpur\0"
+    "Gwalior\0"
+    "Vijayawada\0"
+    "Jodhpur\0"
+    "Madurai\0"
+    "Raipur\0"
+    "Kota\0"
+    "Guwahati\0"
+    "Chandigarh\0"
+    "Solapur\0"
+    "Hubli-Dharwad\0"
+    "Bareilly\0"
+    "Moradabad\0"
+    "Mysore\0"
+    "Gurgaon\0"
+    "Aligarh\0"
+    "Jalandhar\0"
+    "Tiruchirappalli\0"
+    "Bhubaneswar\0"
+    "Salem\0"
+    "Warangal\0"
+    "Mira-Bhayandar\0"
+    "Thiruvananthapuram\0"
+    "Bhiwandi\0"
+    "Saharanpur\0"
+    "Guntur\0"
+    "Amravati\0"
+    "Bikaner\0"
+    "Noida\0"
+    "Jamshedpur\0"
+    "Bhilai Nagar\0"
+    "Cuttack\0"
+    "Dhaka\0"
+    "Chittagong\0"
+    "Sylhet\0"
+    "Rajshahi\0"
+    "Khulna\0"
+    "Barisal\0"
+    "Kabul\0"
+    "Kandahar\0"
+    "Herat\0"
+    "Mazar-i-Sharif\0"
+    "Jalalabad\0"
+    "Kunduz\0"
+    "Ghazni\0"
+    "Lashkar Gah\0"
+    "Khost\0"
+    "Taloqan\0"
+    "Pul-e-Khumri\0"
+    "Faizabad\0"
+    "Gardez\0"
+    "Bamyan\0"
+    "Jakarta\0"
+    "Surabaya\0"
+    "Bandung\0"
+    "Medan\0"
+    "Bekasi\0"
+    "Tangerang\0"
+    "Depok\0"
+    "Semarang\0"
+    "Palembang\0"
+    "Makassar\0"
+    "Yogyakarta\0"
+    "Denpasar\0"
+    "Malang\0"
+    "Bogor\0"
+    "Batam\0"
+    "Pekanbaru\0"
+    "Bandar Lampung\0"
+    "Padang\0"
+    "Samarinda\0"
+    "Balikpapan\0"
+    "Jambi\0"
+    "Cimahi\0"
+    "Surakarta\0"
+    "Banjarmasin\0"
+    "Kupang\0"
+    "Pontianak\0"
+    "Manado\0"
+    "Ambon\0"
+    "Jayapura\0"
+    "Banda Aceh\0"
+    "Mataram\0"
+    "Kendari\0"
+    "Palu\0"
+    "Ternate\0"
+    "Bengkulu\0"
+    "Gorontalo\0"
+    "Mamuju\0"
+    "Sorong\0"
+    "Kuala Lumpur\0"
+    "George Town\0"
+    "Ipoh\0"
+    "Shah Alam\0"
+    "Petaling Jaya\0"
+    "Johor Bahru\0"
+    "Kota Kinabalu\0"
+    "Kuching\0"
+    "Subang Jaya\0"
+    "Ampang Jaya\0"
+    "Kuantan\0"
+    "Alor Setar\0"
+    "Sandakan\0"
+    "Taiping\0"
+    "Sibu\0"
+    "Miri\0"
+    "Kuala Terengganu\0"
+    "Bintulu\0"
+    "Kota Bharu\0"
+    "Sungai Petani\0"
+    "Tawau\0"
+    "Kulim\0"
+    "Muar\0"
+    "Teluk Intan\0"
+    "Batu Pahat\0"
+    "Kluang\0"
+    "Port Dickson\0"
+    "Pasir Gudang\0"
+    "Nilai\0"
+    "Rawang\0"
+    "Segamat\0"
+    "Temerloh\0"
+    "Bentong\0"
+    "Bagan Serai\0"
+    "Raub\0"
+    "Bukit Mertajam\0"
+    "Lumut\0"
+    "Klang\0"
+    "Kajang\0"
+    "Seremban\0"
+    "Malacca\0"
+    "Kuala Selangor\0"
+    "Kepala Batas\0"
+    "Singapore\0"
+    "Bandar Seri Begawan\0"
+    "Bangkok\0"
+    "Chiang Mai\0"
+    "Phuket\0"
+    "Pattaya\0"
+    "Hat Yai\0"
+    "Nakhon Ratchasima\0"
+    "Khon Kaen\0"
+    "Udon Thani\0"
+    "Chiang Rai\0"
+    "Rayong\0"
+    "Pitsanulok\0"
+    "Lampang\0"
+    "Nakhon Si Thammarat\0"
+    "Ubon Ratchathani\0"
+    "Songkhla\0"
+    "Nonthaburi\0"
+    "Pak Kret\0"
+    "Si Racha\0"
+    "Krabi\0"
+    "Hua Hin\0"
+    "Saraburi\0"
+    "Surin\0"
+    "Surat Thani\0"
+    "Nakhon Pathom\0"
+    "Ratchaburi\0"
+    "Phetchabun\0"
+    "Samut Prakan\0"
+    "Chon Buri\0"
+    "Nakhon Nayok\0"
+    "Kanchanaburi\0"
+    "Mae Sot\0"
+    "Phrae\0"
+    "Nan\0"
+    "Phayao\0"
+    "Sukhothai\0"
+    "Uttaradit\0"
+    "Tak\0"
+    "Phitsanulok\0"
+    "Lop Buri\0"
+    "Ayutthaya\0"
+    "Manila\0"
+    "Quezon City\0"
+    "Davao\0"
+    "Cebu\0"
+    "Caloocan\0"
+    "Zamboanga City\0"
+    "Taguig\0"
+    "Antipolo\0"
+    "Pasig\0"
+    "Cagayan de Oro\0"
+    "Paranaque\0"
+    "Dasmarinas\0"
+    "Valenzuela\0"
+    "Bacoor\0"
+    "General Santos\0"
+    "Las Pinas\0"
+    "Makati\0"
+    "Marikina\0"
+    "Muntinlupa\0"
+    "Mandaluyong\0"
+    "Bacolod\0"
+    "San Jose del Monte\0"
+    "Iligan\0"
+    "Malabon\0"
+    "Navotas\0"
+    "Iloilo\0"
+    "Butuan\0"
+    "Tarlac\0"
+    "Olongapo\0"
+    "Cabanatuan\0"
+    "San Fernando\0"
+    "Laoag\0"
+    "Baguio\0"
+    "Legazpi\0"
+    "Tacloban\0"
+    "Naga\0"
+    "Dagupan\0"
+    "Malolos\0"
+    "San Pablo\0"
+    "Batangas City\0"
+    "Lucena\0"
+    "Imus\0"
+    "General Trias\0"
+    "Trece Martires\0"
+    "Ho Chi Minh City\0"
+    "Hanoi\0"
+    "Da Nang\0"
+    "Hai Phong\0"
+    "Can Tho\0"
+    "Bien Hoa\0"
+    "Hue\0"
+    "Nha Trang\0"
+    "Buon Ma Thuot\0"
+    "Quy Nhon\0"
+    "Vung Tau\0"
+    "Nam Dinh\0"
+    "Phan Thiet\0"
+    "Long Xuyen\0"
+    "Thai Nguyen\0"
+    "Thanh Hoa\0"
+    "Rach Gia\0"
+    "Cam Ranh\0"
+    "My Tho\0"
+    "Da Lat\0"
+    "Cao Lanh\0"
+    "Pleiku\0"
+    "Kontum\0"
+    "Dong Hoi\0"
+    "Tam Ky\0"
+    "Vi Thanh\0"
+    "Phu Ly\0"
+    "Uong Bi\0"
+    "Bac Lieu\0"
+    "Nghi Son\0"
+    "Soc Trang\0"
+    "Kon Tum\0"
+    "Ha Tinh\0"
+    "Bac Giang\0"
+    "Viet Tri\0"
+    "Ben Tre\0"
+    "Bac Kan\0"
+    "Ca Mau\0"
+    "Tra Vinh\0"
+    "Beijing\0"
+    "Shanghai\0"
+    "Guangzhou\0"
+    "Shenzhen\0"
+    "Chengdu\0"
+    "Tianjin\0"
+    "Wuhan\0"
+    "Xi'an\0"
+    "Hangzhou\0"
+    "Nanjing\0"
+    "Chongqing\0"
+    "Qingdao\0"
+    "Dalian\0"
+    "Urumqi\0"
+    "Dongguan\0"
+    "Foshan\0"
+    "Shenyang\0"
+    "Harbin\0"
+    "Suzhou\0"
+    "Zhengzhou\0"
+    "Jinan\0"
+    "Changsha\0"
+    "Kunming\0"
+    "Taiyuan\0"
+    "Xiamen\0"
+    "Hefei\0"
+    "Shijiazhuang\0"
+    "Changchun\0"
+    "Wenzhou\0"
+    "Ningbo\0"
+    "Wuxi\0"
+    "Lanzhou\0"
+    "Nanchang\0"
+    "Fuzhou\0"
+    "Nanning\0"
+    "Guiyang\0"
+    "Tangshan\0"
+    "Baotou\0"
+    "Zibo\0"
+    "Yantai\0"
+    "Weifang\0"
+    "Hohhot\0"
+    "Handan\0"
+    "Zhuhai\0"
+    "Jining\0"
+    "Luoyang\0"
+    "Baoding\0"
+    "Anshan\0"
+    "Xuzhou\0"
+    "Shaoxing\0"
+    "Jinhua\0"
+    "Liuzhou\0"
+    "Yangzhou\0"
+    "Xining\0"
+    "Yinchuan\0"
+    "Lhasa\0"
+    "Almaty\0"
+    "Nur-Sultan\0"
+    "Shymkent\0"
+    "Aktobe\0"
+    "Taraz\0"
+    "Pavlodar\0"
+    "Ust-Kamenogorsk\0"
+    "Semey\0"
+    "Aktau\0"
+    "Kostanay\0"
+    "Kyzylorda\0"
+    "Oral\0"
+    "Atyrau\0"
+    "Petropavlovsk\0"
+    "Temirtau\0"
+    "Rudny\0"
+    "Ekibastuz\0"
+    "Taldykorgan\0"
+    "Zhezkazgan\0"
+    "Turkestan\0"
+    "Tashkent\0"
+    "Samarkand\0"
+    "Namangan\0"
+    "Bukhara\0"
+    "Andijan\0"
+    "Nukus\0"
+    "Fergana\0"
+    "Kokand\0"
+    "Margilan\0"
+    "Chirchiq\0"
+    "Termez\0"
+    "Angren\0"
+    "Jizzakh\0"
+    "Navoi\0"
+    "Qarshi\0"
+    "Gulistan\0"
+    "Urgench\0"
+    "Bekabad\0"
+    "Khiva\0"
+    "Denau\0"
+    "Bishkek\0"
+    "Osh\0"
+    "Jalal-Abad\0"
+    "Karakol\0"
+    "Tokmok\0"
+    "Uzgen\0"
+    "Naryn\0"
+    "Talas\0"
+    "Batken\0"
+    "Kant\0"
+    "Kara-Balta\0"
+    "Cholpon-Ata\0"
+    "Kara-Suu\0"
+    "Balykchy\0"
+    "Dushanbe\0"
+    "Khujand\0"
+    "Kulob\0"
+    "Qurghonteppa\0"
+    "Istaravshan\0"
+    "Isfara\0"
+    "Panjakent\0"
+    "Kanibadam\0"
+    "Tursunzoda\0"
+    "Vahdat\0"
+    "Khorugh\0"
+    "Hisor\0"
+    "Bokhtar\0"
+    "Dangara\0"
+    "Ashgabat\0"
+    "Turkmenbashi\0"
+    "Dashoguz\0"
+    "Mary\0"
+    "Balkanabat\0"
+    "Bayramaly\0"
+    "Serdar\0"
+    "Gumdag\0"
+    "Magdanly\0"
+    "Tejen\0"
+    "Yoloten\0"
+    "Baku\0"
+    "Ganja\0"
+    "Tbilisi\0"
+    "Batumi\0"
+    "Kutaisi\0"
+    "Rustavi\0"
+    "Gori\0"
+    "Zugdidi\0"
+    "Poti\0"
+    "Kobuleti\0"
+    "Khashuri\0"
+    "Samtredia\0"
+    "Senaki\0"
+    "Zestaponi\0"
+    "Marneuli\0"
+    "Telavi\0"
+    "Yerevan\0"
+    "Gyumri\0"
+    "Vanadzor\0"
+    "Vagharshapat\0"
+    "Hrazdan\0"
+    "Abovyan\0"
+    "Kapan\0"
+    "Armavir\0"
+    "Gavar\0"
+    "Artashat\0"
+    "Goris\0"
+    "Ashtarak\0"
+    "Moscow\0"
+    "Saint Petersburg\0"
+    "Novosibirsk\0"
+    "Yekaterinburg\0"
+    "Nizhny Novgorod\0"
+    "Kazan\0"
+    "Chelyabinsk\0"
+    "Omsk\0"
+    "Samara\0"
+    "Rostov-on-Don\0"
+    "Ufa\0"
+    "Krasnoyarsk\0"
+    "Voronezh\0"
+    "Perm\0"
+    "Volgograd\0"
+    "Krasnodar\0"
+    "Tokyo\0"
+    "Yokohama\0"
+    "Osaka\0"
+    "Nagoya\0"
+    "Sapporo\0"
+    "Fukuoka\0"
+    "Kobe\0"
+    "Kyoto\0"
+    "Kawasaki\0"
+    "Hiroshima\0"
+    "Sendai\0"
+    "Kitakyushu\0"
+    "Chiba\0"
+    "Sakai\0"
+    "Niigata\0"
+    "Hamamatsu\0"
+    "Okayama\0"
+    "Sagamihara\0"
+    "Funabashi\0"
+    "Hachioji\0"
+    "Kagoshima\0"
+    "Kawaguchi\0"
+    "Himeji\0"
+    "Suita\0"
+    "Kanazawa\0"
+    "Matsuyama\0"
+    "Utsunomiya\0"
+    "Matsudo\0"
+    "Kawagoe\0"
+    "Kochi\0"
+    "Takamatsu\0"
+    "Toyama\0"
+    "Toyonaka\0"
+    "Gifu\0"
+    "Fujisawa\0"
+    "Kashiwa\0"
+    "Miyazaki\0"
+    "Toyohashi\0"
+    "Nagano\0"
+    "Iwaki\0"
+    "Asahikawa\0"
+    "Seoul\0"
+    "Busan\0"
+    "Incheon\0"
+    "Daegu\0"
+    "Daejeon\0"
+    "Gwangju\0"
+    "Ulsan\0"
+    "Suwon\0"
+    "Changwon\0"
+    "Goyang\0"
+    "Yongin\0"
+    "Seongnam\0"
+    "Bucheon\0"
+    "Ansan\0"
+    "Cheongju\0"
+    "Jeonju\0"
+    "Anyang\0"
+    "Cheonan\0"
+    "Pohang\0"
+    "Uijeongbu\0"
+    "Siheung\0"
+    "Pyeongtaek\0"
+    "Gimhae\0"
+    "Hwaseong\0"
+    "Gumi\0"
+    "Asan\0"
+    "Wonju\0"
+    "Gimpo\0"
+    "Iksan\0"
+    "Gunsan\0"
+    "Pyongyang\0"
+    "Ulaanbaatar\0"
+    "Kathmandu\0"
+    "Pokhara\0"
+    "Thimphu\0"
+    "Colombo\0"
+    "Kandy\0"
+    "Galle\0"
+    "Male\0"
+    "Yangon\0"
+    "Mandalay\0"
+    "Naypyidaw\0"
+    "Phnom Penh\0"
+    "Siem Reap\0"
+    "Vientiane\0"
+    "Luang Prabang\0"
+    "Birmingham\0"
+    "Manchester\0"
+    "Liverpool\0"
+    "Leeds\0"
+    "Sheffield\0"
+    "Edinburgh\0"
+    "Glasgow\0"
+    "Cardiff\0"
+    "Belfast\0"
+    "Bristol\0"
+    "Leicester\0"
+    "Coventry\0"
+    "Hull\0"
+    "Bradford\0"
+    "Nottingham\0"
+    "Plymouth\0"
+    "Stoke-on-Trent\0"
+    "Wolverhampton\0"
+    "Derby\0"
+    "Swansea\0"
+    "Southampton\0"
+    "Salford\0"
+    "Aberdeen\0"
+    "Westminster\0"
+    "Portsmouth\0"
+    "Peterborough\0"
+    "Dundee\0"
+    "Lancaster\0"
+    "Oxford\0"
+    "Newport\0"
+    "Preston\0"
+    "St Albans\0"
+    "Norwich\0"
+    "Chester\0"
+    "Exeter\0"
+    "Gloucester\0"
+    "Scunthorpe\0"
+    "Sunderland\0"
+    "Ipswich\0"
+    "Blackpool\0"
+    "Middlesbrough\0"
+    "Bolton\0"
+    "Bournemouth\0"
+    "Cambridge\0"
+    "Crewe\0"
+    "Doncaster\0"
+    "Gillingham\0"
+    "Hemel Hempstead\0"
+    "Paris\0"
+    "Marseille\0"
+    "Lyon\0"
+    "Toulouse\0"
+    "Nice\0"
+    "Nantes\0"
+    "Montpellier\0"
+    "Strasbourg\0"
+    "Bordeaux\0"
+    "Lille\0"
+    "Rennes\0"
+    "Reims\0"
+    "Le Havre\0"
+    "Saint-Etienne\0"
+    "Toulon\0"
+    "Angers\0"
+    "Grenoble\0"
+    "Dijon\0"
+    "Nimes\0"
+    "Aix-en-Provence\0"
+    "Brest\0"
+    "Le Mans\0"
+    "Amiens\0"
+    "Tours\0"
+    "Limoges\0"
+    "Clermont-Ferrand\0"
+    "Villeurbanne\0"
+    "Besancon\0"
+    "Metz\0"
+    "Rouen\0"
+    "Mulhouse\0"
+    "Caen\0"
+    "Nancy\0"
+    "Argenteuil\0"
+    "Saint-Denis\0"
+    "Roubaix\0"
+    "Tourcoing\0"
+    "Nanterre\0"
+    "Avignon\0"
+    "Creteil\0"
+    "Poitiers\0"
+    "Versailles\0"
+    "Pau\0"
+    "La Rochelle\0"
+    "Calais\0"
+    "Cannes\0"
+    "Ajaccio\0"
+    "Berlin\0"
+    "Hamburg\0"
+    "Munich\0"
+    "Cologne\0"
+    "Frankfurt\0"
+    "Stuttgart\0"
+    "Dusseldorf\0"
+    "Dortmund\0"
+    "Essen\0"
+    "Leipzig\0"
+    "Bremen\0"
+    "Dresden\0"
+    "Hanover\0"
+    "Nuremberg\0"
+    "Duisburg\0"
+    "Bochum\0"
+    "Wuppertal\0"
+    "Bielefeld\0"
+    "Bonn\0"
+    "Munster\0"
+    "Karlsruhe\0"
+    "Mannheim\0"
+    "Augsburg\0"
+    "Wiesbaden\0"
+    "Gelsenkirchen\0"
+    "Monchengladbach\0"
+    "Braunschweig\0"
+    "Chemnitz\0"
+    "Kiel\0"
+    "Aachen\0"
+    "Halle\0"
+    "Magdeburg\0"
+    "Freiburg\0"
+    "Krefeld\0"
+    "Lubeck\0"
+    "Oberhausen\0"
+    "Erfurt\0"
+    "Mainz\0"
+    "Rostock\0"
+    "Kassel\0"
+    "Hagen\0"
+    "Potsdam\0"
+    "Saarbrucken\0"
+    "Hamm\0"
+    "Mulheim\0"
+    "Ludwigshafen\0"
+    "Leverkusen\0"
+    "Oldenburg\0"
+    "Neuss\0"
+    "Solingen\0"
+    "Heidelberg\0"
+    "Darmstadt\0"
+    "Paderborn\0"
+    "Regensburg\0"
+    "Ingolstadt\0"
+    "Wurzburg\0"
+    "Furth\0"
+    "Wolfsburg\0"
+    "Offenbach\0"
+    "Ulm\0"
+    "Heilbronn\0"
+    "Pforzheim\0"
+    "Gottingen\0"
+    "Bottrop\0"
+    "Trier\0"
+    "Recklinghausen\0"
+    "Reutlingen\0"
+    "Bremerhaven\0"
+    "Koblenz\0"
+    "Bergisch Gladbach\0"
+    "Jena\0"
+    "Remscheid\0"
+    "Erlangen\0"
+    "Moers\0"
+    "Siegen\0"
+    "Hildesheim\0"
+    "Salzgitter\0"
+    "Rome\0"
+    "Milan\0"
+    "Naples\0"
+    "Turin\0"
+    "Palermo\0"
+    "Genoa\0"
+    "Bologna\0"
+    "Florence\0"
+    "Bari\0"
+    "Catania\0"
+    "Venice\0"
+    "Verona\0"
+    "Messina\0"
+    "Padua\0"
+    "Trieste\0"
+    "Taranto\0"
+    "Brescia\0"
+    "Prato\0"
+    "Reggio Calabria\0"
+    "Modena\0"
+    "Reggio Emilia\0"
+    "Perugia\0"
+    "Livorno\0"
+    "Ravenna\0"
+    "Cagliari\0"
+    "Foggia\0"
+    "Rimini\0"
+    "Salerno\0"
+    "Ferrara\0"
+    "Sassari\0"
+    "Latina\0"
+    "Giugliano\0"
+    "Monza\0"
+    "Syracuse\0"
+    "Pescara\0"
+    "Bergamo\0"
+    "Forl\303\254\0"
+    "Trento\0"
+    "Vicenza\0"
+    "Terni\0"
+    "Bolzano\0"
+    "Novara\0"
+    "Piacenza\0"
+    "Ancona\0"
+    "Madrid\0"
+    "Barcelona\0"
+    "Valencia\0"
+    "Seville\0"
+    "Zaragoza\0"
+    "Malaga\0"
+    "Murcia\0"
+    "Palma\0"
+    "Las Palmas\0"
+    "Bilbao\0"
+    "Alicante\0"
+    "Cordoba\0"
+    "Valladolid\0"
+    "Vigo\0"
+    "Gijon\0"
+    "Hospitalet\0"
+    "Vitoria-Gasteiz\0"
+    "A Coru\303\261a\0"
+    "Elche\0"
+    "Granada\0"
+    "Oviedo\0"
+    "Badalona\0"
+    "Cartagena\0"
+    "Terrassa\0"
+    "Jerez de la Frontera\0"
+    "Sabadell\0"
+    "Mostoles\0"
+    "Santa Cruz de Tenerife\0"
+    "Pamplona\0"
+    "Almeria\0"
+    "Alcala de Henares\0"
+    "Fuenlabrada\0"
+    "Leganes\0"
+    "Getafe\0"
+    "Santander\0"
+    "Castellon\0"
+    "Burgos\0"
+    "Albacete\0"
+    "Alcorcon\0"
+    "San Sebastian\0"
+    "Salamanca\0"
+    "Huelva\0"
+    "Lleida\0"
+    "Leon\0"
+    "Cadiz\0"
+    "Tarragona\0"
+    "Badajoz\0"
+    "Lisbon\0"
+    "Porto\0"
+    "Braga\0"
+    "Coimbra\0"
+    "Funchal\0"
+    "Amadora\0"
+    "Almada\0"
+    "Agualva-Cacem\0"
+    "Queluz\0"
+    "Setubal\0"
+    "Barreiro\0"
+    "Odivelas\0"
+    "Aveiro\0"
+    "Corroios\0"
+    "Loures\0"
+    "Evora\0"
+    "Rio Tinto\0"
+    "Gondomar\0"
+    "Vila Nova de Gaia\0"
+    "Matosinhos\0"
+    "Faro\0"
+    "Leiria\0"
+    "Viseu\0"
+    "Guimaraes\0"
+    "Viana do Castelo\0"
+    "Portimao\0"
+    "Braganca\0"
+    "Amsterdam\0"
+    "Rotterdam\0"
+    "The Hague\0"
+    "Utrecht\0"
+    "Eindhoven\0"
+    "Tilburg\0"
+    "Groningen\0"
+    "Almere\0"
+    "Breda\0"
+    "Nijmegen\0"
+    "Enschede\0"
+    "Haarlem\0"
+    "Arnhem\0"
+    "Zaanstad\0"
+    "Amersfoort\0"
+    "Apeldoorn\0"
+    "s-Hertogenbosch\0"
+    "Hoofddorp\0"
+    "Maastricht\0"
+    "Leiden\0"
+    "Dordrecht\0"
+    "Zoetermeer\0"
+    "Zwolle\0"
+    "Deventer\0"
+    "Delft\0"
+    "Alkmaar\0"
+    "Leeuwarden\0"
+    "Venlo\0"
+    "Brussels\0"
+    "Antwerp\0"
+    "Ghent\0"
+    "Charleroi\0"
+    "Liege\0"
+    "Bruges\0"
+    "Namur\0"
+    "Leuven\0"
+    "Mons\0"
+    "Aalst\0"
+    "Mechelen\0"
+    "La Louviere\0"
+    "Kortrijk\0"
+    "Hasselt\0"
+    "Sint-Niklaas\0"
+    "Oostende\0"
+    "Tournai\0"
+    "Genk\0"
+    "Seraing\0"
+    "Roeselare\0"
+    "Zurich\0"
+    "Geneva\0"
+    "Basel\0"
+    "Bern\0"
+    "Lausanne\0"
+    "Winterthur\0"
+    "Lucerne\0"
+    "St. Gallen\0"
+    "Lugano\0"
+    "Biel/Bienne\0"
+    "Thun\0"
+    "Koniz\0"
+    "La Chaux-de-Fonds\0"
+    "Fribourg\0"
+    "Schaffhausen\0"
+    "Chur\0"
+    "Vernier\0"
+    "Neuchatel\0"
+    "Uster\0"
+    "Sion\0"
+    "Vienna\0"
+    "Graz\0"
+    "Linz\0"
+    "Salzburg\0"
+    "Innsbruck\0"
+    "Prague\0"
+    "Brno\0"
+    "Ostrava\0"
+    "Plzen\0"
+    "Liberec\0"
+    "Olomouc\0"
+    "Usti nad Labem\0"
+    "Ceske Budejovice\0"
+    "Hradec Kralove\0"
+    "Pardubice\0"
+    "Zlin\0"
+    "Havirov\0"
+    "Kladno\0"
+    "Most\0"
+    "Opava\0"
+    "Frydek-Mistek\0"
+    "Karvin\303\241\0"
+    "Jihlava\0"
+    "Teplice\0"
+    "Decin\0"
+    "Bratislava\0"
+    "Kosice\0"
+    "Presov\0"
+    "Zilina\0"
+    "Nitra\0"
+    "Banska Bystrica\0"
+    "Trnava\0"
+    "Martin\0"
+    "Trencin\0"
+    "Poprad\0"
+    "Prievidza\0"
+    "Zvolen\0"
+    "Nove Zamky\0"
+    "Michalovce\0"
+    "Spisska Nova Ves\0"
+    "Budapest\0"
+    "Debrecen\0"
+    "Szeged\0"
+    "Miskolc\0"
+    "Pecs\0"
+    "Gyor\0"
+    "Nyiregyhaza\0"
+    "Kecskemet\0"
+    "Szekesfehervar\0"
+    "Szombathely\0"
+    "Erd\0"
+    "Tatabanya\0"
+    "Kaposvar\0"
+    "Bekes\0"
+    "Veszprem\0"
+    "Zalaegerszeg\0"
+    "Sopron\0"
+    "Eger\0"
+    "Nagykanizsa\0"
+    "Dunakeszi\0"
+    "Warsaw\0"
+    "Krakow\0"
+    "Lodz\0"
+    "Wroclaw\0"
+    "Poznan\0"
+    "Gdansk\0"
+    "Szczecin\0"
+    "Bydgoszcz\0"
+    "Lublin\0"
+    "Katowice\0"
+    "Bialystok\0"
+    "Gdynia\0"
+    "Czestochowa\0"
+    "Radom\0"
+    "Sosnowiec\0"
+    "Torun\0"
+    "Kielce\0"
+    "Gliwice\0"
+    "Zabrze\0"
+    "Bytom\0"
+    "Bielsko-Biala\0"
+    "Olsztyn\0"
+    "Rzeszow\0"
+    "Ruda Slaska\0"
+    "Rybnik\0"
+    "Tychy\0"
+    "Dabrowa Gornicza\0"
+    "Plock\0"
+    "Elblag\0"
+    "Opole\0"
+    "Walbrzych\0"
+    "Zielona Gora\0"
+    "Tarnow\0"
+    "Chorzow\0"
+    "Kalisz\0"
+    "Koszalin\0"
+    "Legnica\0"
+    "Bucharest\0"
+    "Cluj-Napoca\0"
+    "Timisoara\0"
+    "Iasi\0"
+    "Constanta\0"
+    "Sofia\0"
+    "Plovdiv\0"
+    "Varna\0"
+    "Burgas\0"
+    "Belgrade\0"
+    "Novi Sad\0"
+    "Nis\0"
+    "Zagreb\0"
+    "Split\0"
+    "Rijeka\0"
+    "Osijek\0"
+    "Sarajevo\0"
+    "Banja Luka\0"
+    "Tuzla\0"
+    "Ljubljana\0"
+    "Maribor\0"
+    "Skopje\0"
+    "Bitola\0"
+    "Podgorica\0"
+    "Tirana\0"
+    "Durres\0"
+    "Pristina\0"
+    "Athens\0"
+    "Thessaloniki\0"
+    "Patras\0"
+    "Heraklion\0"
+    "Nicosia\0"
+    "Limassol\0"
+    "Valletta\0"
+    "Stockholm\0"
+    "Gothenburg\0"
+    "Malmo\0"
+    "Uppsala\0"
+    "Vasteras\0"
+    "Orebro\0"
+    "Linkoping\0"
+    "Helsingborg\0"
+    "Jonkoping\0"
+    "Norrkoping\0"
+    "Lund\0"
+    "Umea\0"
+    "Gavle\0"
+    "Boras\0"
+    "Sodertalje\0"
+    "Eskilstuna\0"
+    "Karlstad\0"
+    "Taby\0"
+    "Vaxjo\0"
+    "Halmstad\0"
+    "Sundsvall\0"
+    "Lulea\0"
+    "Trollhattan\0"
+    "Kristianstad\0"
+    "Uddevalla\0"
+    "Oslo\0"
+    "Bergen\0"
+    "Trondheim\0"
+    "Stavanger\0"
+    "Baerum\0"
+    "Kristiansand\0"
+    "Fredrikstad\0"
+    "Sandnes\0"
+    "Troms\303\270\0"
+    "Sarpsborg\0"
+    "Skien\0"
+    "\303\205lesund\0"
+    "Tonsberg\0"
+    "Moss\0"
+    "Haugesund\0"
+    "Sandefjord\0"
+    "Arendal\0"
+    "Bod\303\270\0"
+    "Drammen\0"
+    "Asker\0"
+    "Lillehammer\0"
+    "Mo i Rana\0"
+    "Copenhagen\0"
+    "Aarhus\0"
+    "Odense\0"
+    "Aalborg\0"
+    "Esbjerg\0"
+    "Randers\0"
+    "Kolding\0"
+    "Horsens\0"
+    "Vejle\0"
+    "Roskilde\0"
+    "Herning\0"
+    "Silkeborg\0"
+    "Naestved\0"
+    "Fredericia\0"
+    "Viborg\0"
+    "K\303\270ge\0"
+    "Holstebro\0"
+    "Taastrup\0"
+    "Slagelse\0"
+    "Hiller\303\270d\0"
+    "Helsinki\0"
+    "Espoo\0"
+    "Tampere\0"
+    "Vantaa\0"
+    "Turku\0"
+    "Oulu\0"
+    "Lahti\0"
+    "Kuopio\0"
+    "Jyvaskyla\0"
+    "Pori\0"
+    "Lappeenranta\0"
+    "Vaasa\0"
+    "Joensuu\0"
+    "Hameenlinna\0"
+    "Kotka\0"
+    "Seinajoki\0"
+    "Rovaniemi\0"
+    "Mikkeli\0"
+    "Kouvola\0"
+    "Porvoo\0"
+    "Rauma\0"
+    "Savonlinna\0"
+    "Reykjavik\0"
+    "Vilnius\0"
+    "Kaunas\0"
+    "Klaipeda\0"
+    "Riga\0"
+    "Daugavpils\0"
+    "Liepaja\0"
+    "Tallinn\0"
+    "Tartu\0"
+    "Narva\0"
+    "Kiev\0"
+    "Kharkiv\0"
+    "Odessa\0"
+    "Dnipro\0"
+    "Lviv\0"
+    "Minsk\0"
+    "Gomel\0"
+    "Mogilev\0"
+    "Chisinau\0"
+    "Tiraspol\0"
+    "New York\0"
+    "Los Angeles\0"
+    "Chicago\0"
+    "Houston\0"
+    "Philadelphia\0"
+    "San Antonio\0"
+    "San Diego\0"
+    "Dallas\0"
+    "San Jose\0"
+    "Austin\0"
+    "Jacksonville\0"
+    "Fort Worth\0"
+    "Columbus\0"
+    "Charlotte\0"
+    "San Francisco\0"
+    "Indianapolis\0"
+    "Seattle\0"
+    "Denver\0"
+    "Washington\0"
+    "Boston\0"
+    "El Paso\0"
+    "Detroit\0"
+    "Oklahoma City\0"
+    "Portland\0"
+    "Las Vegas\0"
+    "Memphis\0"
+    "Louisville\0"
+    "Baltimore\0"
+    "Milwaukee\0"
+    "Albuquerque\0"
+    "Tucson\0"
+    "Fresno\0"
+    "Sacramento\0"
+    "Mesa\0"
+    "Kansas City\0"
+    "Atlanta\0"
+    "Long Beach\0"
+    "Colorado Springs\0"
+    "Raleigh\0"
+    "Miami\0"
+    "Virginia Beach\0"
+    "Omaha\0"
+    "Oakland\0"
+    "Minneapolis\0"
+    "Tulsa\0"
+    "Arlington\0"
+    "New Orleans\0"
+    "Wichita\0"
+    "Cleveland\0"
+    "Tampa\0"
+    "Bakersfield\0"
+    "Aurora\0"
+    "Honolulu\0"
+    "Anaheim\0"
+    "Santa Ana\0"
+    "Corpus Christi\0"
+    "Riverside\0"
+    "Lexington\0"
+    "Stockton\0"
+    "Henderson\0"
+    "Saint Paul\0"
+    "St. Louis\0"
+    "Cincinnati\0"
+    "Pittsburgh\0"
+    "Toronto\0"
+    "Montreal\0"
+    "Vancouver\0"
+    "Calgary\0"
+    "Edmonton\0"
+    "Ottawa\0"
+    "Winnipeg\0"
+    "Quebec City\0"
+    "Hamilton\0"
+    "Kitchener\0"
+    "Halifax\0"
+    "Mexico City\0"
+    "Guadalajara\0"
+    "Monterrey\0"
+    "Puebla\0"
+    "Tijuana\0"
+    "Le\303\263n\0"
+    "Ju\303\241rez\0"
+    "Zapopan\0"
+    "Nezahualc\303\263yotl\0"
+    "Chihuahua\0"
+    "S\303\243o Paulo\0"
+    "Rio de Janeiro\0"
+    "Bras\303\255lia\0"
+    "Fortaleza\0"
+    "Belo Horizonte\0"
+    "Manaus\0"
+    "Curitiba\0"
+    "Recife\0"
+    "Goi\303\242nia\0"
+    "Bel\303\251m\0"
+    "Porto Alegre\0"
+    "Guarulhos\0"
+    "Campinas\0"
+    "S\303\243o Lu\303\255s\0"
+    "Buenos Aires\0"
+    "C\303\263rdoba\0"
+    "Rosario\0"
+    "Mendoza\0"
+    "La Plata\0"
+    "San Miguel de Tucum\303\241n\0"
+    "Mar del Plata\0"
+    "Salta\0"
+    "Santa Fe\0"
+    "Bogot\303\241\0"
+    "Medell\303\255n\0"
+    "Cali\0"
+    "Barranquilla\0"
+    "Lima\0"
+    "Arequipa\0"
+    "Trujillo\0"
+    "Chiclayo\0"
+    "Cusco\0"
+    "Santiago\0"
+    "Valpara\303\255so\0"
+    "Concepci\303\263n\0"
+    "La Serena\0"
+    "Antofagasta\0"
+    "Quito\0"
+    "Guayaquil\0"
+    "Cuenca\0"
+    "Caracas\0"
+    "Maracaibo\0"
+    "Barquisimeto\0"
+    "Montevideo\0"
+    "Salto\0"
+    "Asunci\303\263n\0"
+    "Ciudad del Este\0"
+    "La Paz\0"
+    "Santa Cruz\0"
+    "Cochabamba\0"
+    "Georgetown\0"
+    "Paramaribo\0"
+    "Cayenne\0"
+    "Guatemala City\0"
+    "Belize City\0"
+    "San Salvador\0"
+    "Tegucigalpa\0"
+    "Managua\0"
+    "San Jos\303\251\0"
+    "Panama City\0"
+    "Havana\0"
+    "Santiago de Cuba\0"
+    "Kingston\0"
+    "Port-au-Prince\0"
+    "Santo Domingo\0"
+    "San Juan\0"
+    "Port of Spain\0"
+    "Bridgetown\0"
+    "Lagos\0"
+    "Abuja\0"
+    "Kano\0"
+    "Ibadan\0"
+    "Port Harcourt\0"
+    "Benin City\0"
+    "Maiduguri\0"
+    "Zaria\0"
+    "Aba\0"
+    "Jos\0"
+    "Ilorin\0"
+    "Oyo\0"
+    "Enugu\0"
+    "Abeokuta\0"
+    "Kaduna\0"
+    "Ogbomoso\0"
+    "Sokoto\0"
+    "Onitsha\0"
+    "Warri\0"
+    "Okene\0"
+    "Calabar\0"
+    "Uyo\0"
+    "Katsina\0"
+    "Ado-Ekiti\0"
+    "Bauchi\0"
+    "Ikeja\0"
+    "Makurdi\0"
+    "Minna\0"
+    "Effon-Alaiye\0"
+    "Ilesa\0"
+    "Akure\0"
+    "Ikere-Ekiti\0"
+    "Oghara\0"
+    "Iseyin\0"
+    "Sango Ota\0"
+    "Owo\0"
+    "Iwo\0"
+    "Ikirun\0"
+    "Shagamu\0"
+    "Jimeta\0"
+    "Johannesburg\0"
+    "Cape Town\0"
+    "Durban\0"
+    "Pretoria\0"
+    "Port Elizabeth\0"
+    "Pietermaritzburg\0"
+    "Benoni\0"
+    "Tembisa\0"
+    "East London\0"
+    "Vereeniging\0"
+    "Bloemfontein\0"
+    "Boksburg\0"
+    "Welkom\0"
+    "Krugersdorp\0"
+    "Diepsloot\0"
+    "Botshabelo\0"
+    "Brakpan\0"
+    "Witbank\0"
+    "Oberholzer\0"
+    "Germiston\0"
+    "Roodepoort\0"
+    "Randburg\0"
+    "Vanderbijlpark\0"
+    "Centurion\0"
+    "Uitenhage\0"
+    "Midrand\0"
+    "Vryheid\0"
+    "Klerksdorp\0"
+    "Newcastle\0"
+    "Carletonville\0"
+    "Nigel\0"
+    "Mpumalanga\0"
+    "Bethal\0"
+    "Potchefstroom\0"
+    "Rustenburg\0"
+    "Sasolburg\0"
+    "Virginia\0"
+    "Brits\0"
+    "Phalaborwa\0"
+    "Polokwane\0"
+    "Nairobi\0"
+    "Mombasa\0"
+    "Kisumu\0"
+    "Nakuru\0"
+    "Eldoret\0"
+    "Kehancha\0"
+    "Kitale\0"
+    "Malindi\0"
+    "Garissa\0"
+    "Kakamega\0"
+    "Thika\0"
+    "Lamu\0"
+    "Nyeri\0"
+    "Machakos\0"
+    "Meru\0"
+    "Kericho\0"
+    "Embu\0"
+    "Migori\0"
+    "Kapenguria\0"
+    "Wajir\0"
+    "Addis Ababa\0"
+    "Dire Dawa\0"
+    "Mekelle\0"
+    "Adama\0"
+    "Gondar\0"
+    "Awassa\0"
+    "Bahir Dar\0"
+    "Dessie\0"
+    "Jimma\0"
+    "Jijiga\0"
+    "Shashemene\0"
+    "Nekemte\0"
+    "Debre Markos\0"
+    "Harar\0"
+    "Debre Berhan\0"
+    "Dilla\0"
+    "Arba Minch\0"
+    "Hosaena\0"
+    "Debre Zeit\0"
+    "Ambo\0"
+    "Accra\0"
+    "Kumasi\0"
+    "Tamale\0"
+    "Takoradi\0"
+    "Tema\0"
+    "Cape Coast\0"
+    "Obuasi\0"
+    "Koforidua\0"
+    "Sunyani\0"
+    "Ho\0"
+    "Techiman\0"
+    "Wa\0"
+    "Bolgatanga\0"
+    "Tarkwa\0"
+    "Winneba\0"
+    "Dunkwa-on-Offin\0"
+    "Dakar\0"
+    "Touba\0"
+    "Thi\303\250s\0"
+    "Kaolack\0"
+    "Mbour\0"
+    "Saint-Louis\0"
+    "Ziguinchor\0"
+    "Diourbel\0"
+    "Louga\0"
+    "Tambacounda\0"
+    "Kolda\0"
+    "Fatick\0"
+    "Matam\0"
+    "Kedougou\0"
+    "Dar es Salaam\0"
+    "Mwanza\0"
+    "Arusha\0"
+    "Dodoma\0"
+    "Mbeya\0"
+    "Morogoro\0"
+    "Tanga\0"
+    "Tabora\0"
+    "Kigoma\0"
+    "Mtwara\0"
+    "Musoma\0"
+    "Iringa\0"
+    "Singida\0"
+    "Njombe\0"
+    "Bukoba\0"
+    "Songea\0"
+    "Sumbawanga\0"
+    "Lindi\0"
+    "Shinyanga\0"
+    "Zanzibar City\0"
+    "Kampala\0"
+    "Gulu\0"
+    "Lira\0"
+    "Mbarara\0"
+    "Jinja\0"
+    "Mbale\0"
+    "Mukono\0"
+    "Kasese\0"
+    "Masaka\0"
+    "Entebbe\0"
+    "Kabale\0"
+    "Arua\0"
+    "Kitgum\0"
+    "Koboko\0"
+    "Iganga\0"
+    "Soroti\0"
+    "Fort Portal\0"
+    "Hoima\0"
+    "Pader\0"
+    "Tororo\0"
+    "Kigali\0"
+    "Butare\0"
+    "Gitarama\0"
+    "Ruhengeri\0"
+    "Gisenyi\0"
+    "Byumba\0"
+    "Cyangugu\0"
+    "Kibungo\0"
+    "Kibuye\0"
+    "Gikongoro\0"
+    "Bujumbura\0"
+    "Gitega\0"
+    "Muyinga\0"
+    "Ngozi\0"
+    "Ruyigi\0"
+    "Kayanza\0"
+    "Bururi\0"
+    "Muramvya\0"
+    "Rutana\0"
+    "Makamba\0"
+    "Kinshasa\0"
+    "Lubumbashi\0"
+    "Mbuji-Mayi\0"
+    "Kisangani\0"
+    "Masina\0"
+    "Kananga\0"
+    "Likasi\0"
+    "Kolwezi\0"
+    "Tshikapa\0"
+    "Beni\0"
+    "Bukavu\0"
+    "Mwene-Ditu\0"
+    "Kikwit\0"
+    "Mbandaka\0"
+    "Matadi\0"
+    "Uvira\0"
+    "Butembo\0"
+    "Gandajika\0"
+    "Kalemie\0"
+    "Goma\0"
+    "Brazzaville\0"
+    "Pointe-Noire\0"
+    "Dolisie\0"
+    "Nkayi\0"
+    "Mossendjo\0"
+    "Impfondo\0"
+    "Ouesso\0"
+    "Madingou\0"
+    "Owando\0"
+    "Sibiti\0"
+    "Bangui\0"
+    "Bimbo\0"
+    "Berb\303\251rati\0"
+    "Carnot\0"
+    "Bambari\0"
+    "Bouar\0"
+    "Bossangoa\0"
+    "Bria\0"
+    "Bangassou\0"
+    "Nola\0"
+    "N'Djamena\0"
+    "Moundou\0"
+    "Sarh\0"
+    "Ab\303\251ch\303\251\0"
+    "Koumra\0"
+    "Pala\0"
+    "Am Timan\0"
+    "Bongor\0"
+    "Mongo\0"
+    "Doba\0"
+    "Ati\0"
+    "La\303\257\0"
+    "Kelo\0"
+    "Mao\0"
+    "Biltine\0"
+    "Yaound\303\251\0"
+    "Douala\0"
+    "Bamenda\0"
+    "Bafoussam\0"
+    "Garoua\0"
+    "Maroua\0"
+    "Nkongsamba\0"
+    "Bertoua\0"
+    "Ed\303\251a\0"
+    "Loum\0"
+    "Kumba\0"
+    "Ngaound\303\251r\303\251\0"
+    "Ebolowa\0"
+    "Kribi\0"
+    "Tiko\0"
+    "Mbalmayo\0"
+    "Dschang\0"
+    "Mbouda\0"
+    "Foumban\0"
+    "Limbe\0"
+    "Libreville\0"
+    "Malabo\0"
+    "S\303\243o Tom\303\251\0"
+    "Luanda\0"
+    "Windhoek\0"
+    "Gaborone\0"
+    "Francistown\0"
+    "Molepolole\0"
+    "Serowe\0"
+    "Selibe Phikwe\0"
+    "Maun\0"
+    "Kanye\0"
+    "Mochudi\0"
+    "Mahalapye\0"
+    "Palapye\0"
+    "Jwaneng\0"
+    "Lobatse\0"
+    "Harare\0"
+    "Bulawayo\0"
+    "Chitungwiza\0"
+    "Mutare\0"
+    "Epworth\0"
+    "Gweru\0"
+    "Kwekwe\0"
+    "Kadoma\0"
+    "Masvingo\0"
+    "Chinhoyi\0"
+    "Norton\0"
+    "Marondera\0"
+    "Ruwa\0"
+    "Chegutu\0"
+    "Zvishavane\0"
+    "Bindura\0"
+    "Beitbridge\0"
+    "Redcliff\0"
+    "Victoria Falls\0"
+    "Hwange\0"
+    "Lusaka\0"
+    "Kitwe\0"
+    "Ndola\0"
+    "Kabwe\0"
+    "Chingola\0"
+    "Mufulira\0"
+    "Luanshya\0"
+    "Livingstone\0"
+    "Kasama\0"
+    "Chipata\0"
+    "Mazabuka\0"
+    "Choma\0"
+    "Kapiri Mposhi\0"
+    "Mongu\0"
+    "Kafue\0"
+    "Lilongwe\0"
+    "Blantyre\0"
+    "Mzuzu\0"
+    "Zomba\0"
+    "Kasungu\0"
+    "Mangochi\0"
+    "Salima\0"
+    "Liwonde\0"
+    "Karonga\0"
+    "Nsanje\0"
+    "Machinga\0"
+    "Dedza\0"
+    "Maputo\0"
+    "Beira\0"
+    "Nampula\0"
+    "Chimoio\0"
+    "Nacala\0"
+    "Quelimane\0"
+    "Tete\0"
+    "Xai-Xai\0"
+    "Lichinga\0"
+    "Pemba\0"
+    "Inhambane\0"
+    "Dondo\0"
+    "Guru\303\251\0"
+    "Maxixe\0"
+    "Angoche\0"
+    "Antananarivo\0"
+    "Toamasina\0"
+    "Antsirabe\0"
+    "Fianarantsoa\0"
+    "Mahajanga\0"
+    "Toliara\0"
+    "Antsiranana\0"
+    "Morondava\0"
+    "Ambovombe\0"
+    "Manakara\0"
+    "Mananjary\0"
+    "Sambava\0"
+    "Fort Dauphin\0"
+    "Maintirano\0"
+    "Vatomandry\0"
+    "Port Louis\0"
+    "Beau Bassin-Rose Hill\0"
+    "Vacoas-Phoenix\0"
+    "Curepipe\0"
+    "Quatre Bornes\0"
+    "Triolet\0"
+    "Goodlands\0"
+    "Centre de Flacq\0"
+    "Mahebourg\0"
+    "Saint Pierre\0"
+    "Victoria\0"
+    "Moroni\0"
+    "Djibouti\0"
+    "Asmara\0"
+    "Mogadishu\0"
+    "Abidjan\0"
+    "Yamoussoukro\0"
+    "Ouagadougou\0"
+    "Bamako\0"
+    "Niamey\0"
+    "Conakry\0"
+    "Freetown\0"
+    "Monrovia\0"
+    "Banjul\0"
+    "Bissau\0"
+    "Praia\0"
+    "Lom\303\251\0"
+    "Porto-Novo\0"
+    "Cotonou\0"
+    "Maseru\0"
+    "Mbabane\0"
+    "Sydney\0"
+    "Melbourne\0"
+    "Brisbane\0"
+    "Perth\0"
+    "Adelaide\0"
+    "Canberra\0"
+    "Gold Coast\0"
+    "Wollongong\0"
+    "Darwin\0"
+    "Hobart\0"
+    "Auckland\0"
+    "Wellington\0"
+    "Christchurch\0"
+    "Dunedin\0"
+    "Port Moresby\0"
+    "Suva\0"
+    "Honiara\0"
+    "Port Vila\0"
+    "Noum\303\251a\0"
+    "Papeete\0"
+    "Apia\0"
+    "Nuku'alofa\0"
+    "Ngerulmud\0"
+    "Palikir\0"
+    "Majuro\0"
+    "Tarawa\0"
+    "Yaren\0"
+    "Funafuti";
+
+// Latitude, longitude in 1e-5 degrees
+const city_position_t world_city_positions[2028] = {
+    // Saudi Arabia
+    { 2138910, 3985790 }, // Mecca
+    { 2452470, 3956920 }, // Medina
+    { 2471360, 4667530 }, // Riyadh
+    { 2148580, 3919250 }, // Jeddah
+    { 2642820, 5010440 }, // Dammam
+    { 2621720, 5019710 }, // Khobar
+    { 2127030, 4041580 }, // Taif
+    { 1821640, 4250530 }, // Abha
+    { 2839980, 3657800 }, // Tabuk
+    { 2751140, 4169000 }, // Hail
+    // United Arab Emirates
+    { 2520480, 5527080 }, // Dubai
+    { 2429920, 5469730 }, // Abu Dhabi
+    { 2534630, 5542090 }, // Sharjah
+    { 2540520, 5551360 }, // Ajman
+    { 2512880, 5632640 }, // Fujairah
+    { 2578890, 5597610 }, // Ras Al Khaimah
+    { 2556470, 5565500 }, // Umm Al Quwain
+    // Egypt
+    { 3004440, 3123570 }, // Cairo
+    { 3120010, 2991870 }, // Alexandria
+    { 3001310, 3120890 }, // Giza
+    { 2568720, 3263960 }, // Luxor
+    { 2408890, 3289980 }, // Aswan
+    { 3126530, 3230190 }, // Port Said
+    { 2996680, 3254980 }, // Suez
+    { 2725740, 3381290 }, // Hurghada
+    { 2791580, 3433000 }, // Sharm El Sheikh
+    // Turkey
+    { 4100820, 2897840 }, // Istanbul
+    { 3993340, 3285970 }, // Ankara
+    { 3841920, 2712870 }, // Izmir
+    { 4018260, 2906650 }, // Bursa
+    { 3689690, 3071330 }, // Antalya
+    { 3787130, 3248460 }, // Konya
+    { 3700000, 3532130 }, // Adana
+    { 3706620, 3738330 }, // Gaziantep
+    { 3873120, 3547870 }, // Kayseri
+    { 3977670, 3052060 }, // Eskisehir
+    { 3791440, 4023060 }, // Diyarbakir
+    { 4128670, 3633000 }, // Samsun
+    { 3777650, 2908640 }, // Denizli
+    { 3835520, 3830950 }, // Malatya
+    { 3758580, 3693710 }, // Kahramanmaras
+    { 3993340, 4126780 }, // Erzurum
+    { 3848910, 4340890 }, // Van
+    { 3788120, 4113510 }, // Batman
+    { 3868100, 3922640 }, // Elazığ
+    { 3680000, 3463330 }, // Icel
+    { 3861910, 2742890 }, // Manisa
+    { 3974770, 3701790 }, // Sivas
+    { 4076540, 2943050 }, // Gebze
+    { 3964840, 2788260 }, // Balıkesir
+    { 3715910, 3879690 }, // Sanliurfa
+    { 4100150, 3971780 }, // Trabzon
+    { 4098390, 3787640 }, // Ordu
+    { 3784440, 2784580 }, // Aydin
+    { 3868230, 2940820 }, // Usak
+    { 3776480, 3055660 }, // Isparta
+    { 3875070, 3055670 }, // Afyon
+    { 4145640, 3179870 }, // Zonguldak
+    { 4031670, 3655000 }, // Tokat
+    // Iran
+    { 3568920, 5138900 }, // Tehran
+    { 3626050, 5961680 }, // Mashhad
+    { 3265460, 5166800 }, // Isfahan
+    { 3583270, 5099160 }, // Karaj
+    { 3808000, 4629190 }, // Tabriz
+    { 2959180, 5258370 }, // Shiraz
+    { 3464010, 5087640 }, // Qom
+    { 3131830, 4867060 }, // Ahvaz
+    { 3431420, 4706500 }, // Kermanshah
+    { 3755270, 4507610 }, // Urmia
+    { 2949630, 6086290 }, // Zahedan
+    { 3728080, 4958320 }, // Rasht
+    { 3028320, 5707880 }, // Kerman
+    { 3479920, 4851460 }, // Hamadan
+    { 3409540, 4970130 }, // Arak
+    { 3189740, 5435690 }, // Yazd
+    { 3824980, 4829330 }, // Ardabil
+    { 2718650, 5628080 }, // Bandar Abbas
+    { 3555220, 5123010 }, // Eslamshahr
+    { 3667360, 4847870 }, // Zanjan
+    { 3531500, 4699880 }, // Sanandaj
+    { 3626880, 5000410 }, // Qazvin
+    { 3268570, 5152640 }, // Khomeynishahr
+    { 3238460, 4847980 }, // Dezful
+    { 3570610, 5100970 }, // Nasim Shahr
+    { 3044020, 4816610 }, // Khorramshahr
+    { 3641810, 5497560 }, // Shahrud
+    { 3684270, 5444410 }, // Gorgan
+    { 3621350, 5879580 }, // Neyshabur
+    { 3656330, 5306010 }, // Sari
+    { 3655100, 5267860 }, // Babol
+    { 3033920, 4830430 }, // Abadan
+    { 3348780, 4835580 }, // Khorramabad
+    { 3363740, 4642270 }, // Ilam
+    { 3676300, 4572220 }, // Mahabad
+    { 3532360, 5164560 }, // Varamin
+    // Iraq
+    { 3331520, 4436610 }, // Baghdad
+    { 3050850, 4778040 }, // Basra
+    { 3619110, 4400930 }, // Erbil
+    { 3200000, 4433330 }, // Najaf
+    { 3261090, 4402490 }, // Karbala
+    { 3633500, 4311890 }, // Mosul
+    { 3556500, 4543290 }, // Sulaymaniyah
+    { 3546810, 4439220 }, // Kirkuk
+    { 3247220, 4443970 }, // Hillah
+    { 3419500, 4387470 }, // Samarra
+    { 3342050, 4330970 }, // Ramadi
+    { 3335060, 4378190 }, // Fallujah
+    { 3461280, 4367810 }, // Tikrit
+    { 3375000, 4465000 }, // Baqubah
+    { 3105690, 4625750 }, // Nasiriyah
+    { 3184000, 4714470 }, // Amara
+    { 3251280, 4581830 }, // Kut
+    { 3199280, 4492580 }, // Diwaniyah
+    { 3686060, 4295810 }, // Dohuk
+    { 3714310, 4268810 }, // Zakho
+    // Jordan
+    { 3194540, 3592840 }, // Amman
+    { 3207280, 3608760 }, // Zarqa
+    { 3255560, 3585000 }, // Irbid
+    { 2953210, 3500630 }, // Aqaba
+    { 3203930, 3572700 }, // Salt
+    // Lebanon
+    { 3389380, 3550180 }, // Beirut
+    { 3443720, 3584330 }, // Tripoli
+    { 3356330, 3537140 }, // Sidon
+    { 3327040, 3520380 }, // Tyre
+    // Syria
+    { 3351380, 3627650 }, // Damascus
+    { 3620210, 3713430 }, // Aleppo
+    { 3473940, 3672370 }, // Homs
+    { 3553760, 3577810 }, // Latakia
+    // Palestine/Israel
+    { 3176830, 3521370 }, // Jerusalem
+    { 3135470, 3430880 }, // Gaza
+    { 3208530, 3478180 }, // Tel Aviv
+    { 3279400, 3504230 }, // Haifa
+    // Kuwait
+    { 2937590, 4797740 }, // Kuwait City
+    { 2909300, 4808410 }, // Ahmadi
+    { 2933260, 4802860 }, // Hawalli
+    // Qatar
+    { 2528540, 5153100 }, // Doha
+    { 2529190, 5142400 }, // Al Rayyan
+    { 2540570, 5140640 }, // Umm Salal
+    // Bahrain
+    { 2622850, 5058600 }, // Manama
+    { 2614670, 5055500 }, // Riffa
+    { 2627200, 5064800 }, // Muharraq
+    // Oman
+    { 2358590, 5840590 }, // Muscat
+    { 1701510, 5409240 }, // Salalah
+    { 2435630, 5675270 }, // Sohar
+    // Yemen
+    { 1536940, 4419100 }, // Sanaa
+    { 1277970, 4503650 }, // Aden
+    { 1357950, 4402060 }, // Taiz
+    // Morocco
+    { 3357310, -758980 }, // Casablanca
+    { 3402090, -684160 }, // Rabat
+    { 3401810, -500780 }, // Fez
+    { 3162950, -798110 }, // Marrakech
+    { 3042780, -959810 }, // Agadir
+    { 3575950, -583400 }, // Tangier
+    { 3389350, -554730 }, // Meknes
+    { 3468140, -190860 }, // Oujda
+    { 3426100, -658020 }, // Kenitra
+    { 3558890, -536800 }, // Tetouan
+    { 3229940, -923720 }, // Safi
+    { 3368660, -738370 }, // Mohammedia
+    { 3288110, -690630 }, // Khouribga
+    { 3323160, -850070 }, // El Jadida
+    { 3233730, -634980 }, // Beni Mellal
+    { 3516810, -292870 }, // Nador
+    { 3421000, -401000 }, // Taza
+    { 3300130, -761610 }, // Settat
+    { 3519320, -615630 }, // Larache
+    { 3500170, -590440 }, // Ksar El Kebir
+    { 3382440, -606610 }, // Khemisset
+    { 2898700, -1005740 }, // Guelmim
+    { 3491810, -232170 }, // Berkane
+    { 3441100, -289530 }, // Taourirt
+    { 3193140, -442440 }, // Errachidia
+    { 3091890, -689350 }, // Ouarzazate
+    { 2969740, -973160 }, // Tiznit
+    { 3525170, -393720 }, // Al Hoceima
+    { 3047030, -887700 }, // Taroudannt
+    { 3150850, -975950 }, // Essaouira
+    // Algeria
+    { 3675380, 305880 }, // Algiers
+    { 3569760, -63370 }, // Oran
+    { 3636500, 661470 }, // Constantine
+    { 3690000, 776670 }, // Annaba
+    { 3642030, 282770 }, // Blida
+    { 3555590, 617410 }, // Batna
+    { 3467210, 326310 }, // Djelfa
+    { 3619040, 540330 }, // Setif
+    { 3519770, -63880 }, // Sidi Bel Abbes
+    { 3484810, 572810 }, // Biskra
+    { 3549750, 812070 }, // Tebessa
+    { 3335680, 685310 }, // El Oued
+    { 3687610, 690860 }, // Skikda
+    { 3537120, 131700 }, // Tiaret
+    { 3675250, 506860 }, // Bejaïa
+    { 3487800, -131500 }, // Tlemcen
+    { 3195390, 532810 }, // Ouargla
+    { 3161770, -222040 }, // Bechar
+    { 3593150, 8920 }, // Mostaganem
+    { 3607310, 476870 }, // Bordj Bou Arréridj
+    { 3616540, 133470 }, // Chlef
+    { 3628630, 795180 }, // Souk Ahras
+    { 3676720, 831370 }, // El Tarf
+    { 3681900, 576670 }, // Jijel
+    { 3573610, 55580 }, // Relizane
+    { 3539680, 14050 }, // Mascara
+    { 3441340, 509210 }, // Ouled Djellal
+    { 3521870, 418570 }, // Bou Saada
+    // Tunisia
+    { 3680650, 1018150 }, // Tunis
+    { 3474060, 1076030 }, // Sfax
+    { 3582560, 1064110 }, // Sousse
+    { 3567810, 1009630 }, // Kairouan
+    { 3687490, 1018230 }, // Ettadhamen
+    { 3727460, 987390 }, // Bizerte
+    { 3388150, 1009820 }, // Gabès
+    { 3686630, 1016470 }, // Ariana
+    { 3442500, 878420 }, // Gafsa
+    { 3516760, 883630 }, // Kasserine
+    { 3576430, 1081130 }, // Monastir
+    { 3675450, 1021760 }, // Ben Arous
+    { 3391780, 1071660 }, // Temara
+    { 3550470, 1106220 }, // Mahdia
+    { 3617410, 870500 }, // El Kef
+    { 3335450, 1050550 }, // Medenine
+    { 3645610, 1073760 }, // Nabeul
+    { 3292970, 1045180 }, // Tataouine
+    { 3672560, 918160 }, // Beja
+    { 3650110, 878030 }, // Jendouba
+    { 3640310, 1014250 }, // Zaghouan
+    { 3608360, 937010 }, // Siliana
+    { 3503880, 948910 }, // Sidi Bouzid
+    // Libya
+    { 3288720, 1319130 }, // Tripoli
+    { 3211650, 2006860 }, // Benghazi
+    { 3237640, 1509250 }, // Misrata
+    { 3275690, 2175590 }, // Bayda
+    { 2703770, 1442830 }, // Sabha
+    { 3275730, 1272780 }, // Zawiya
+    { 3246730, 1456870 }, // Zliten
+    { 3075540, 2022630 }, // Ajdabiya
+    { 3208400, 2395780 }, // Tobruk
+    { 3120890, 1658870 }, // Sirte
+    { 3264870, 1426170 }, // Al Khums
+    { 3249260, 2083120 }, // Marj
+    { 3217280, 1302030 }, // Gharyan
+    { 3275690, 2263670 }, // Derna
+    { 2591540, 1391800 }, // Murzuq
+    { 2496480, 1018020 }, // Ghat
+    { 2916140, 1613900 }, // Waddan
+    // Sudan
+    { 1550070, 3255990 }, // Khartoum
+    { 1564450, 3247770 }, // Omdurman
+    { 1963480, 3721520 }, // Port Sudan
+    // Pakistan
+    { 2486070, 6700110 }, // Karachi
+    { 3152040, 7435870 }, // Lahore
+    { 3372940, 7309310 }, // Islamabad
+    { 3145040, 7313500 }, // Faisalabad
+    { 3356510, 7301690 }, // Rawalpindi
+    { 3015750, 7152490 }, // Multan
+    { 2539600, 6835780 }, // Hyderabad
+    { 3218770, 7419450 }, // Gujranwala
+    { 3401510, 7152490 }, // Peshawar
+    { 3017980, 6697500 }, // Quetta
+    // India
+    { 2861390, 7720900 }, // New Delhi
+    { 1907600, 7287770 }, // Mumbai
+    { 2257260, 8836390 }, // Kolkata
+    { 1308270, 8027070 }, // Chennai
+    { 1297160, 7759460 }, // Bangalore
+    { 1738500, 7848670 }, // Hyderabad
+    { 2302250, 7257140 }, // Ahmedabad
+    { 1852040, 7385670 }, // Pune
+    { 2117020, 7283110 }, // Surat
+    { 2691240, 7578730 }, // Jaipur
+    { 2684670, 8094620 }, // Lucknow
+    { 2644990, 8033190 }, // Kanpur
+    { 2114580, 7908820 }, // Nagpur
+    { 2271960, 7585770 }, // Indore
+    { 2325990, 7741260 }, // Bhopal
+    { 1768680, 8321850 }, // Visakhapatnam
+    { 2559410, 8513760 }, // Patna
+    { 2230720, 7318120 }, // Vadodara
+    { 2866920, 7745380 }, // Ghaziabad
+    { 3090100, 7585730 }, // Ludhiana
+    { 2717670, 7800810 }, // Agra
+    { 1101680, 7695580 }, // Nashville
+    { 2840890, 7731780 }, // Faridabad
+    { 2898450, 7770640 }, // Meerut
+    { 2230390, 7080220 }, // Rajkot
+    { 1924030, 7313050 }, // Kalyan
+    { 1949120, 7280540 }, // Vasai-Virar
+    { 2531760, 8297390 }, // Varanasi
+    { 3408370, 7479730 }, // Srinagar
+    { 1987620, 7534330 }, // Aurangabad
+    { 2379570, 8643040 }, // Dhanbad
+    { 3163400, 7487230 }, // Amritsar
+    { 1903300, 7302970 }, // Navi Mumbai
+    { 2543580, 8184630 }, // Allahabad
+    { 2334410, 8530960 }, // Ranchi
+    { 2259580, 8826360 }, // Howrah
+    { 1101680, 7695580 }, // Coimbatore
+    { 2318150, 7998640 }, // Jabalpur
+    { 2621830, 7818280 }, // Gwalior
+    { 1650620, 8064800 }, // Vijayawada
+    { 2623890, 7302430 }, // Jodhpur
+    { 992520, 7811980 }, // Madurai
+    { 2125140, 8162960 }, // Raipur
+    { 2521380, 7586480 }, // Kota
+    { 2614450, 9173620 }, // Guwahati
+    { 3073330, 7677940 }, // Chandigarh
+    { 1765990, 7590640 }, // Solapur
+    { 1536470, 7512400 }, // Hubli-Dharwad
+    { 2836700, 7943040 }, // Bareilly
+    { 2883860, 7877330 }, // Moradabad
+    { 1229580, 7663940 }, // Mysore
+    { 2845950, 7702660 }, // Gurgaon
+    { 2789740, 7808800 }, // Aligarh
+    { 3132600, 7557620 }, // Jalandhar
+    { 1079050, 7870470 }, // Tiruchirappalli
+    { 2029610, 8582450 }, // Bhubaneswar
+    { 1166430, 7814600 }, // Salem
+    { 1796890, 7959410 }, // Warangal
+    { 1929520, 7285440 }, // Mira-Bhayandar
+    { 852410, 7693660 }, // Thiruvananthapuram
+    { 1930020, 7305770 }, // Bhiwandi
+    { 2996800, 7755520 }, // Saharanpur
+    { 1630670, 8043650 }, // Guntur
+    { 2093740, 7777960 }, // Amravati
+    { 2802290, 7331190 }, // Bikaner
+    { 2853550, 7739100 }, // Noida
+    { 2280460, 8620290 }, // Jamshedpur
+    { 2119380, 8135090 }, // Bhilai Nagar
+    { 2046250, 8588280 }, // Cuttack
+    // Bangladesh
+    { 2381030, 9041250 }, // Dhaka
+    { 2235690, 9178320 }, // Chittagong
+    { 2489490, 9186870 }, // Sylhet
+    { 2437450, 8860420 }, // Rajshahi
+    { 2284560, 8954030 }, // Khulna
+    { 2270100, 9035350 }, // Barisal
+    // Afghanistan
+    { 3455530, 6920750 }, // Kabul
+    { 3161800, 6573720 }, // Kandahar
+    { 3434820, 6219970 }, // Herat
+    { 3670810, 6711030 }, // Mazar-i-Sharif
+    { 3442570, 7045180 }, // Jalalabad
+    { 3672890, 6885390 }, // Kunduz
+    { 3355390, 6841730 }, // Ghazni
+    { 3158360, 6437080 }, // Lashkar Gah
+    { 3333780, 6991670 }, // Khost
+    { 3673560, 6953470 }, // Taloqan
+    { 3594420, 6871530 }, // Pul-e-Khumri
+    { 3711670, 7058330 }, // Faizabad
+    { 3359690, 6922280 }, // Gardez
+    { 3482080, 6782560 }, // Bamyan
+    // Indonesia
+    { -620880, 10684560 }, // Jakarta
+    { -725750, 11275210 }, // Surabaya
+    { -691750, 10761910 }, // Bandung
+    { 359520, 9867220 }, // Medan
+    { -623830, 10697560 }, // Bekasi
+    { -617830, 10663190 }, // Tangerang
+    { -640250, 10679420 }, // Depok
+    { -696670, 11041670 }, // Semarang
+    { -297610, 10477540 }, // Palembang
+    { -514770, 11943270 }, // Makassar
+    { -779560, 11036950 }, // Yogyakarta
+    { -865000, 11521670 }, // Denpasar
+    { -797970, 11263040 }, // Malang
+    { -659440, 10678920 }, // Bogor
+    { 113070, 10405330 }, // Batam
+    { 53330, 10145000 }, // Pekanbaru
+    { -539710, 10526680 }, // Bandar Lampung
+    { -94920, 10035430 }, // Padang
+    { -50000, 11715330 }, // Samarinda
+    { -126750, 11682890 }, // Balikpapan
+    { -161010, 10361310 }, // Jambi
+    { -687210, 10754280 }, // Cimahi
+    { -755630, 11083160 }, // Surakarta
+    { -331940, 11459060 }, // Banjarmasin
+    { -1017180, 12360440 }, // Kupang
+    { -2630, 10934250 }, // Pontianak
+    { 147480, 12484210 }, // Manado
+    { -369540, 12818140 }, // Ambon
+    { -254890, 14071970 }, // Jayapura
+    { 554830, 9532380 }, // Banda Aceh
+    { -857290, 11610040 }, // Mataram
+    { -394500, 12249890 }, // Kendari
+    { -89170, 11987070 }, // Palu
+    { 78750, 12737830 }, // Ternate
+    { -380040, 10226550 }, // Bengkulu
+    { 54350, 12306820 }, // Gorontalo
+    { -267630, 11889470 }, // Mamuju
+    { -88330, 13125000 }, // Sorong
+    // Malaysia
+    { 313900, 10168690 }, // Kuala Lumpur
+    { 541640, 10033270 }, // George Town
+    { 458410, 10108290 }, // Ipoh
+    { 307330, 10151850 }, // Shah Alam
+    { 310730, 10160670 }, // Petaling Jaya
+    { 146550, 10375780 }, // Johor Bahru
+    { 598040, 11607350 }, // Kota Kinabalu
+    { 155330, 11035920 }, // Kuching
+    { 315130, 10158640 }, // Subang Jaya
+    { 314780, 10176170 }, // Ampang Jaya
+    { 380770, 10332600 }, // Kuantan
+    { 612480, 10036780 }, // Alor Setar
+    { 584020, 11811790 }, // Sandakan
+    { 485110, 10072080 }, // Taiping
+    { 230000, 11181670 }, // Sibu
+    { 438970, 11399110 }, // Miri
+    { 533020, 10314080 }, // Kuala Terengganu
+    { 316670, 11303330 }, // Bintulu
+    { 613330, 10225000 }, // Kota Bharu
+    { 564690, 10048770 }, // Sungai Petani
+    { 425460, 11789060 }, // Tawau
+    { 536670, 10056670 }, // Kulim
+    { 204420, 10256890 }, // Muar
+    { 402250, 10102170 }, // Teluk Intan
+    { 185420, 10293250 }, // Batu Pahat
+    { 203330, 10331670 }, // Kluang
+    { 253940, 10180690 }, // Port Dickson
+    { 147310, 10390480 }, // Pasir Gudang
+    { 282080, 10179710 }, // Nilai
+    { 332140, 10157640 }, // Rawang
+    { 251670, 10281670 }, // Segamat
+    { 345000, 10241670 }, // Temerloh
+    { 352250, 10190860 }, // Bentong
+    { 500940, 10054810 }, // Bagan Serai
+    { 379000, 10185670 }, // Raub
+    { 536310, 10046310 }, // Bukit Mertajam
+    { 423190, 10062970 }, // Lumut
+    { 304420, 10144500 }, // Klang
+    { 299230, 10179010 }, // Kajang
+    { 272970, 10193810 }, // Seremban
+    { 218960, 10225010 }, // Malacca
+    { 333920, 10125170 }, // Kuala Selangor
+    { 551670, 10038330 }, // Kepala Batas
+    // Singapore
+    { 135210, 10381980 }, // Singapore
+    // Brunei
+    { 490310, 11493980 }, // Bandar Seri Begawan
+    // Thailand
+    { 1375630, 10050180 }, // Bangkok
+    { 1878830, 9898530 }, // Chiang Mai
+    { 788040, 9839230 }, // Phuket
+    { 1292360, 10088250 }, // Pattaya
+    { 701670, 10046670 }, // Hat Yai
+    { 1497990, 10209770 }, // Nakhon Ratchasima
+    { 1644190, 10283600 }, // Khon Kaen
+    { 1741380, 10278580 }, // Udon Thani
+    { 1991050, 9984060 }, // Chiang Rai
+    { 1268060, 10125670 }, // Rayong
+    { 1682110, 10026590 }, // Pitsanulok
+    { 1829320, 9948370 }, // Lampang
+    { 843040, 9996310 }, // Nakhon Si Thammarat
+    { 1522860, 10485580 }, // Ubon Ratchathani
+    { 717560, 10059210 }, // Songkhla
+    { 1386210, 10051440 }, // Nonthaburi
+    { 1390970, 10050330 }, // Pak Kret
+    { 1317360, 10093190 }, // Si Racha
+    { 755630, 9961140 }, // Trang
+    { 808630, 9890630 }, // Krabi
+    { 1257060, 9995810 }, // Hua Hin
+    { 1452890, 10091060 }, // Saraburi
+    { 1488180, 10349360 }, // Surin
+    { 913820, 9932150 }, // Surat Thani
+    { 1381990, 10006420 }, // Nakhon Pathom
+    { 1352820, 9981330 }, // Ratchaburi
+    { 1641920, 10116080 }, // Phetchabun
+    { 1359900, 10059980 }, // Samut Prakan
+    { 1336110, 10098470 }, // Chon Buri
+    { 1420690, 10121300 }, // Nakhon Nayok
+    { 1402270, 9954780 }, // Kanchanaburi
+    { 1671610, 9856440 }, // Mae Sot
+    { 1814590, 10014100 }, // Phrae
+    { 1878380, 10077920 }, // Nan
+    { 1919210, 9989860 }, // Phayao
+    { 1700610, 9982300 }, // Sukhothai
+    { 1762000, 10009920 }, // Uttaradit
+    { 1688340, 9913280 }, // Tak
+    { 1682110, 10026590 }, // Phitsanulok
+    { 1479950, 10065330 }, // Lop Buri
+    { 1436920, 10058770 }, // Ayutthaya
+    // Philippines
+    { 1459950, 12098420 }, // Manila
+    { 1467600, 12104370 }, // Quezon City
+    { 719070, 12545530 }, // Davao
+    { 1031570, 12388540 }, // Cebu
+    { 1465070, 12096780 }, // Caloocan
+    { 692140, 12207900 }, // Zamboanga City
+    { 1451760, 12105090 }, // Taguig
+    { 1458730, 12117550 }, // Antipolo
+    { 1457640, 12108510 }, // Pasig
+    { 845420, 12463190 }, // Cagayan de Oro
+    { 1447790, 12101980 }, // Paranaque
+    { 1432940, 12093670 }, // Dasmarinas
+    { 1470000, 12098330 }, // Valenzuela
+    { 1445900, 12093950 }, // Bacoor
+    { 611640, 12517160 }, // General Santos
+    { 1445060, 12098220 }, // Las Pinas
+    { 1455470, 12102440 }, // Makati
+    { 1465070, 12110290 }, // Marikina
+    { 1440720, 12103980 }, // Muntinlupa
+    { 1457940, 12103590 }, // Mandaluyong
+    { 1063190, 12299510 }, // Bacolod
+    { 1481360, 12104530 }, // San Jose del Monte
+    { 822800, 12424520 }, // Iligan
+    { 1465070, 12110290 }, // Marikina
+    { 1465530, 12096620 }, // Malabon
+    { 1466910, 12094840 }, // Navotas
+    { 1515000, 12058330 }, // Angeles
+    { 1072020, 12256210 }, // Iloilo
+    { 894750, 12554360 }, // Butuan
+    { 1547780, 12059580 }, // Tarlac
+    { 1482940, 12028250 }, // Olongapo
+    { 1548580, 12096530 }, // Cabanatuan
+    { 1503330, 12068330 }, // San Fernando
+    { 1819690, 12059280 }, // Laoag
+    { 1640230, 12059600 }, // Baguio
+    { 1313910, 12374360 }, // Legazpi
+    { 1124280, 12500720 }, // Tacloban
+    { 1362180, 12319480 }, // Naga
+    { 1604330, 12033830 }, // Dagupan
+    { 1484330, 12081080 }, // Malolos
+    { 1406830, 12132560 }, // San Pablo
+    { 1375650, 12105830 }, // Batangas City
+    { 1393720, 12161700 }, // Lucena
+    { 1442970, 12093670 }, // Imus
+    { 1438580, 12088030 }, // General Trias
+    { 1428330, 12086670 }, // Trece Martires
+    // Vietnam
+    { 1082310, 10662970 }, // Ho Chi Minh City
+    { 2102850, 10585420 }, // Hanoi
+    { 1604710, 10820680 }, // Da Nang
+    { 2084490, 10668810 }, // Hai Phong
+    { 1004520, 10574690 }, // Can Tho
+    { 1094510, 10682380 }, // Bien Hoa
+    { 1646370, 10759090 }, // Hue
+    { 1223880, 10919670 }, // Nha Trang
+    { 1266670, 10808330 }, // Buon Ma Thuot
+    { 1376670, 10923330 }, // Quy Nhon
+    { 1034600, 10708430 }, // Vung Tau
+    { 2041670, 10616670 }, // Nam Dinh
+    { 1093330, 10810000 }, // Phan Thiet
+    { 1038330, 10543330 }, // Long Xuyen
+    { 2158330, 10583330 }, // Thai Nguyen
+    { 1980000, 10576670 }, // Thanh Hoa
+    { 1001670, 10508330 }, // Rach Gia
+    { 1192140, 10915830 }, // Cam Ranh
+    { 1868330, 10568330 }, // Vinh
+    { 1035000, 10636670 }, // My Tho
+    { 1194040, 10845830 }, // Da Lat
+    { 1046670, 10563330 }, // Cao Lanh
+    { 1398330, 10800000 }, // Pleiku
+    { 1435000, 10798330 }, // Kontum
+    { 1748330, 10660000 }, // Dong Hoi
+    { 1556670, 10848330 }, // Tam Ky
+    { 978330, 10546670 }, // Vi Thanh
+    { 2054000, 10591670 }, // Phu Ly
+    { 2103330, 10676670 }, // Uong Bi
+    { 928330, 10571670 }, // Bac Lieu
+    { 1958330, 10581670 }, // Nghi Son
+    { 960000, 10596670 }, // Soc Trang
+    { 1435000, 10798330 }, // Kon Tum
+    { 1833330, 10590000 }, // Ha Tinh
+    { 2126670, 10620000 }, // Bac Giang
+    { 2131670, 10543330 }, // Viet Tri
+    { 1023330, 10638330 }, // Ben Tre
+    { 2215000, 10583330 }, // Bac Kan
+    { 918330, 10515000 }, // Ca Mau
+    { 995000, 10633330 }, // Tra Vinh
+    // China
+    { 3990420, 11640740 }, // Beijing
+    { 3123040, 12147370 }, // Shanghai
+    { 2312910, 11326440 }, // Guangzhou
+    { 2254310, 11405790 }, // Shenzhen
+    { 3057280, 10406680 }, // Chengdu
+    { 3934340, 11736160 }, // Tianjin
+    { 3059280, 11430550 }, // Wuhan
+    { 3434160, 10893980 }, // Xi'an
+    { 3027410, 12015510 }, // Hangzhou
+    { 3206030, 11879690 }, // Nanjing
+    { 2943160, 10691230 }, // Chongqing
+    { 3609860, 12037190 }, // Qingdao
+    { 3891400, 12161470 }, // Dalian
+    { 4382560, 8761680 }, // Urumqi
+    { 2304890, 11374470 }, // Dongguan
+    { 2302180, 11312190 }, // Foshan
+    { 4180570, 12343150 }, // Shenyang
+    { 4577320, 12666140 }, // Harbin
+    { 3129890, 12058530 }, // Suzhou
+    { 3474660, 11362540 }, // Zhengzhou
+    { 3665120, 11712010 }, // Jinan
+    { 2822820, 11293880 }, // Changsha
+    { 2503890, 10271830 }, // Kunming
+    { 3787060, 11254890 }, // Taiyuan
+    { 2447980, 11808190 }, // Xiamen
+    { 3186390, 11728080 }, // Hefei
+    { 3804280, 11451490 }, // Shijiazhuang
+    { 4381750, 12532350 }, // Changchun
+    { 2799440, 12066940 }, // Wenzhou
+    { 2986830, 12154400 }, // Ningbo
+    { 3149120, 12031240 }, // Wuxi
+    { 3606110, 10383430 }, // Lanzhou
+    { 2868200, 11585810 }, // Nanchang
+    { 2607450, 11929650 }, // Fuzhou
+    { 2281700, 10836690 }, // Nanning
+    { 2664770, 10663020 }, // Guiyang
+    { 3962430, 11819440 }, // Tangshan
+    { 4065220, 10984030 }, // Baotou
+    { 3681330, 11805480 }, // Zibo
+    { 3753650, 12139970 }, // Yantai
+    { 3670670, 11916190 }, // Weifang
+    { 4084140, 11175220 }, // Hohhot
+    { 3662530, 11453920 }, // Handan
+    { 2227690, 11356780 }, // Zhuhai
+    { 3541510, 11658720 }, // Jining
+    { 3461860, 11245370 }, // Luoyang
+    { 3887400, 11546480 }, // Baoding
+    { 4110890, 12299440 }, // Anshan
+    { 3420580, 11728400 }, // Xuzhou
+    { 3000030, 12058100 }, // Shaoxing
+    { 2910620, 11964940 }, // Jinhua
+    { 2431460, 10942810 }, // Liuzhou
+    { 3239720, 11942150 }, // Yangzhou
+    { 3661710, 10177820 }, // Xining
+    { 3846810, 10627310 }, // Yinchuan
+    { 2965440, 9112060 }, // Lhasa
+    // Kazakhstan
+    { 4322200, 7685120 }, // Almaty
+    { 5116050, 7147040 }, // Nur-Sultan
+    { 4230000, 6956670 }, // Shymkent
+    { 5030000, 5716670 }, // Aktobe
+    { 4290000, 7136670 }, // Taraz
+    { 5230000, 7695000 }, // Pavlodar
+    { 4995000, 8261670 }, // Ust-Kamenogorsk
+    { 5041110, 8022750 }, // Semey
+    { 4365000, 5120000 }, // Aktau
+    { 5321670, 6363330 }, // Kostanay
+    { 4485000, 6551670 }, // Kyzylorda
+    { 5123330, 5136670 }, // Oral
+    { 4711670, 5188330 }, // Atyrau
+    { 5486670, 6915000 }, // Petropavlovsk
+    { 5006670, 7296670 }, // Temirtau
+    { 4365000, 5120000 }, // Aktau
+    { 5296670, 6313330 }, // Rudny
+    { 5171670, 7531670 }, // Ekibastuz
+    { 4501670, 7838330 }, // Taldykorgan
+    { 4780000, 6771670 }, // Zhezkazgan
+    { 4329750, 6825190 }, // Turkestan
+    // Uzbekistan
+    { 4129950, 6924010 }, // Tashkent
+    { 3962700, 6697500 }, // Samarkand
+    { 4099830, 7167260 }, // Namangan
+    { 3977470, 6442860 }, // Bukhara
+    { 4078210, 7234420 }, // Andijan
+    { 4246080, 5961050 }, // Nukus
+    { 4038420, 7178430 }, // Fergana
+    { 4052830, 7094280 }, // Kokand
+    { 4047310, 7172490 }, // Margilan
+    { 4146810, 6958220 }, // Chirchiq
+    { 3722420, 6727830 }, // Termez
+    { 4101670, 7014360 }, // Angren
+    { 4011580, 6784220 }, // Jizzakh
+    { 4008440, 6537920 }, // Navoi
+    { 3886060, 6578920 }, // Qarshi
+    { 4048920, 6878420 }, // Gulistan
+    { 4155000, 6063330 }, // Urgench
+    { 4021670, 6926670 }, // Bekabad
+    { 4137750, 6036190 }, // Khiva
+    { 3826670, 6790000 }, // Denau
+    // Kyrgyzstan
+    { 4287460, 7456980 }, // Bishkek
+    { 4052830, 7279850 }, // Osh
+    { 4093330, 7293330 }, // Jalal-Abad
+    { 4249080, 7839330 }, // Karakol
+    { 4284190, 7529810 }, // Tokmok
+    { 4076670, 7330000 }, // Uzgen
+    { 4142860, 7600390 }, // Naryn
+    { 4252280, 7224280 }, // Talas
+    { 4006190, 7081810 }, // Batken
+    { 4289190, 7485170 }, // Kant
+    { 4281420, 7384970 }, // Kara-Balta
+    { 4264860, 7708310 }, // Cholpon-Ata
+    { 4070440, 7286970 }, // Kara-Suu
+    { 4246030, 7618690 }, // Balykchy
+    // Tajikistan
+    { 3855980, 6878700 }, // Dushanbe
+    { 4028330, 6961670 }, // Khujand
+    { 3791640, 6978500 }, // Kulob
+    { 3783530, 6878110 }, // Qurghonteppa
+    { 3991420, 6900310 }, // Istaravshan
+    { 4012810, 7062750 }, // Isfara
+    { 3949440, 6760970 }, // Panjakent
+    { 4029920, 6951420 }, // Kanibadam
+    { 3851440, 6831420 }, // Tursunzoda
+    { 3855670, 6897310 }, // Vahdat
+    { 3749030, 7155330 }, // Khorugh
+    { 3852390, 6854780 }, // Hisor
+    { 3783530, 6878110 }, // Bokhtar
+    { 3809440, 6933420 }, // Dangara
+    // Turkmenistan
+    { 3796010, 5832610 }, // Ashgabat
+    { 4002250, 5295530 }, // Turkmenbashi
+    { 4183670, 5996670 }, // Dashoguz
+    { 3759470, 6183060 }, // Mary
+    { 3951080, 5436670 }, // Balkanabat
+    { 3761670, 6216670 }, // Bayramaly
+    { 4002250, 5295530 }, // Turkmenbashi
+    { 3896670, 5628330 }, // Serdar
+    { 3846670, 5651670 }, // Gumdag
+    { 3548330, 6208330 }, // Magdanly
+    { 3738330, 6050000 }, // Tejen
+    { 3729670, 6235560 }, // Yoloten
+    // Azerbaijan
+    { 4040930, 4986710 }, // Baku
+    { 4068280, 4636060 }, // Ganja
+    // Georgia
+    { 4171510, 4482710 }, // Tbilisi
+    { 4161680, 4163670 }, // Batumi
+    { 4226790, 4270590 }, // Kutaisi
+    { 4154950, 4499910 }, // Rustavi
+    { 4198470, 4410860 }, // Gori
+    { 4250880, 4187080 }, // Zugdidi
+    { 4215080, 4166750 }, // Poti
+    { 4181920, 4177500 }, // Kobuleti
+    { 4199280, 4359970 }, // Khashuri
+    { 4216420, 4233000 }, // Samtredia
+    { 4227360, 4206580 }, // Senaki
+    { 4210940, 4305560 }, // Zestaponi
+    { 4147560, 4480670 }, // Marneuli
+    { 4191670, 4546670 }, // Telavi
+    // Armenia
+    { 4017920, 4449910 }, // Yerevan
+    { 4078940, 4384060 }, // Gyumri
+    { 4080580, 4449390 }, // Vanadzor
+    { 4015610, 4429190 }, // Vagharshapat
+    { 4049750, 4476580 }, // Hrazdan
+    { 4026940, 4463580 }, // Abovyan
+    { 3920690, 4640530 }, // Kapan
+    { 4015390, 4399940 }, // Armavir
+    { 4036170, 4512560 }, // Gavar
+    { 3995970, 4455530 }, // Artashat
+    { 3950610, 4633920 }, // Goris
+    { 4029420, 4435970 }, // Ashtarak
+    // Russia
+    { 5575580, 3761760 }, // Moscow
+    { 5993110, 3036090 }, // Saint Petersburg
+    { 5500840, 8293570 }, // Novosibirsk
+    { 5684310, 6064540 }, // Yekaterinburg
+    { 5629650, 4393610 }, // Nizhny Novgorod
+    { 5583040, 4906610 }, // Kazan
+    { 5516440, 6143680 }, // Chelyabinsk
+    { 5498850, 7332420 }, // Omsk
+    { 5320010, 5015000 }, // Samara
+    { 4723570, 3970150 }, // Rostov-on-Don
+    { 5473880, 5597210 }, // Ufa
+    { 5601840, 9286720 }, // Krasnoyarsk
+    { 5167200, 3918430 }, // Voronezh
+    { 5801050, 5625020 }, // Perm
+    { 4870800, 4451330 }, // Volgograd
+    { 4503550, 3897530 }, // Krasnodar
+    // Japan
+    { 3567620, 13965030 }, // Tokyo
+    { 3544780, 13964250 }, // Yokohama
+    { 3469370, 13550230 }, // Osaka
+    { 3518150, 13690660 }, // Nagoya
+    { 4306420, 14134690 }, // Sapporo
+    { 3359040, 13040170 }, // Fukuoka
+    { 3469010, 13519560 }, // Kobe
+    { 3501160, 13576810 }, // Kyoto
+    { 3553080, 13970290 }, // Kawasaki
+    { 3438530, 13245530 }, // Hiroshima
+    { 3826820, 14086940 }, // Sendai
+    { 3388340, 13087510 }, // Kitakyushu
+    { 3560740, 14010650 }, // Chiba
+    { 3456640, 13548230 }, // Sakai
+    { 3791610, 13903640 }, // Niigata
+    { 3471080, 13772610 }, // Hamamatsu
+    { 3465510, 13391950 }, // Okayama
+    { 3557610, 13938310 }, // Sagamihara
+    { 3569500, 13998280 }, // Funabashi
+    { 3565610, 13933440 }, // Hachioji
+    { 3159660, 13055710 }, // Kagoshima
+    { 3580760, 13972450 }, // Kawaguchi
+    { 3481530, 13468500 }, // Himeji
+    { 3476080, 13551450 }, // Suita
+    { 3659440, 13662560 }, // Kanazawa
+    { 3384160, 13276560 }, // Matsuyama
+    { 3656580, 13988360 }, // Utsunomiya
+    { 3578470, 13990160 }, // Matsudo
+    { 3592530, 13948560 }, // Kawagoe
+    { 3355970, 13353110 }, // Kochi
+    { 3434020, 13404340 }, // Takamatsu
+    { 3669590, 13721390 }, // Toyama
+    { 3478250, 13546950 }, // Toyonaka
+    { 3539120, 13672230 }, // Gifu
+    { 3534180, 13948390 }, // Fujisawa
+    { 3586170, 13997500 }, // Kashiwa
+    { 3190770, 13142020 }, // Miyazaki
+    { 3476920, 13739140 }, // Toyohashi
+    { 3665130, 13818100 }, // Nagano
+    { 3704810, 14088700 }, // Iwaki
+    { 4377060, 14236490 }, // Asahikawa
+    // South Korea
+    { 3756650, 12697800 }, // Seoul
+    { 3517960, 12907560 }, // Busan
+    { 3745630, 12670520 }, // Incheon
+    { 3587140, 12860140 }, // Daegu
+    { 3635040, 12738450 }, // Daejeon
+    { 3515950, 12685260 }, // Gwangju
+    { 3553840, 12931140 }, // Ulsan
+    { 3726360, 12702860 }, // Suwon
+    { 3522720, 12868110 }, // Changwon
+    { 3765640, 12683530 }, // Goyang
+    { 3724110, 12717750 }, // Yongin
+    { 3744490, 12713880 }, // Seongnam
+    { 3749890, 12678310 }, // Bucheon
+    { 3732360, 12682190 }, // Ansan
+    { 3664240, 12748900 }, // Cheongju
+    { 3584280, 12714800 }, // Jeonju
+    { 3739430, 12695680 }, // Anyang
+    { 3681510, 12711390 }, // Cheonan
+    { 3601900, 12934350 }, // Pohang
+    { 3773870, 12704730 }, // Uijeongbu
+    { 3738070, 12680310 }, // Siheung
+    { 3699230, 12711280 }, // Pyeongtaek
+    { 3522850, 12888900 }, // Gimhae
+    { 3720670, 12681670 }, // Hwaseong
+    { 3611360, 12834450 }, // Gumi
+    { 3678980, 12700420 }, // Asan
+    { 3734220, 12792020 }, // Wonju
+    { 3761500, 12671580 }, // Gimpo
+    { 3594830, 12695760 }, // Iksan
+    { 3596760, 12673670 }, // Gunsan
+    // North Korea
+    { 3903920, 12576250 }, // Pyongyang
+    // Mongolia
+    { 4788640, 10690570 }, // Ulaanbaatar
+    // Nepal
+    { 2771720, 8532400 }, // Kathmandu
+    { 2820960, 8398560 }, // Pokhara
+    // Bhutan
+    { 2747280, 8963900 }, // Thimphu
+    // Sri Lanka
+    { 692710, 7986120 }, // Colombo
+    { 729060, 8063370 }, // Kandy
+    { 605350, 8022100 }, // Galle
+    // Maldives
+    { 417550, 7350930 }, // Male
+    // Myanmar
+    { 1684090, 9617350 }, // Yangon
+    { 2195880, 9608910 }, // Mandalay
+    { 1976330, 9607850 }, // Naypyidaw
+    // Cambodia
+    { 1154490, 10489220 }, // Phnom Penh
+    { 1336710, 10384480 }, // Siem Reap
+    // Laos
+    { 1797570, 10263310 }, // Vientiane
+    { 1988450, 10213500 }, // Luang Prabang
+    // Europe
+    // United Kingdom
+    { 5150740, -12780 }, // London
+    { 5248620, -189040 }, // Birmingham
+    { 5348080, -224260 }, // Manchester
+    { 5340840, -299160 }, // Liverpool
+    { 5380080, -154910 }, // Leeds
+    { 5338110, -147010 }, // Sheffield
+    { 5595330, -318830 }, // Edinburgh
+    { 5586420, -425180 }, // Glasgow
+    { 5148160, -317910 }, // Cardiff
+    { 5459730, -593010 }, // Belfast
+    { 5145450, -258790 }, // Bristol
+    { 5263690, -113980 }, // Leicester
+    { 5240680, -151970 }, // Coventry
+    { 5376760, -32740 }, // Hull
+    { 5379600, -175940 }, // Bradford
+    { 5295480, -115810 }, // Nottingham
+    { 5037550, -414270 }, // Plymouth
+    { 5300270, -217940 }, // Stoke-on-Trent
+    { 5258620, -212820 }, // Wolverhampton
+    { 5292250, -147460 }, // Derby
+    { 5162140, -394360 }, // Swansea
+    { 5090970, -140440 }, // Southampton
+    { 5348310, -229310 }, // Salford
+    { 5714970, -209430 }, // Aberdeen
+    { 5149940, -13190 }, // Westminster
+    { 5081980, -108800 }, // Portsmouth
+    { 5395910, -108150 }, // York
+    { 5256950, -24050 }, // Peterborough
+    { 5646200, -297070 }, // Dundee
+    { 5404660, -280070 }, // Lancaster
+    { 5175200, -125770 }, // Oxford
+    { 5158420, -299770 }, // Newport
+    { 5376320, -270310 }, // Preston
+    { 5175180, -33630 }, // St Albans
+    { 5263090, 129740 }, // Norwich
+    { 5319060, -289190 }, // Chester
+    { 5646200, -297070 }, // Dundee
+    { 5071840, -353390 }, // Exeter
+    { 5186420, -223810 }, // Gloucester
+    { 5359160, -64430 }, // Scunthorpe
+    { 5490690, -138380 }, // Sunderland
+    { 5205940, 115500 }, // Ipswich
+    { 5381750, -303570 }, // Blackpool
+    { 5457420, -123510 }, // Middlesbrough
+    { 5357680, -242820 }, // Bolton
+    { 5071920, -188080 }, // Bournemouth
+    { 5220530, 12180 }, // Cambridge
+    { 5309630, -244110 }, // Crewe
+    { 5352280, -112850 }, // Doncaster
+    { 5138900, 54710 }, // Gillingham
+    { 5174530, -46690 }, // Hemel Hempstead
+    { 5205940, 115500 }, // Ipswich
+    // France
+    { 4885660, 235220 }, // Paris
+    { 4329650, 536980 }, // Marseille
+    { 4576400, 483570 }, // Lyon
+    { 4360470, 144420 }, // Toulouse
+    { 4371020, 726200 }, // Nice
+    { 4721840, -155360 }, // Nantes
+    { 4361100, 387670 }, // Montpellier
+    { 4857340, 775210 }, // Strasbourg
+    { 4483780, -57920 }, // Bordeaux
+    { 5062920, 305730 }, // Lille
+    { 4811730, -167780 }, // Rennes
+    { 4925830, 403170 }, // Reims
+    { 4949440, 10790 }, // Le Havre
+    { 4543970, 438720 }, // Saint-Etienne
+    { 4312420, 592800 }, // Toulon
+    { 4747840, -56320 }, // Angers
+    { 4518850, 572450 }, // Grenoble
+    { 4732200, 504150 }, // Dijon
+    { 4383670, 436010 }, // Nimes
+    { 4352970, 544740 }, // Aix-en-Provence
+    { 4839050, -448610 }, // Brest
+    { 4800610, 19960 }, // Le Mans
+    { 4989410, 229580 }, // Amiens
+    { 4739410, 68480 }, // Tours
+    { 4583360, 126110 }, // Limoges
+    { 4577970, 308630 }, // Clermont-Ferrand
+    { 4577970, 488140 }, // Villeurbanne
+    { 4723800, 602430 }, // Besancon
+    { 4911930, 617570 }, // Metz
+    { 4790290, 190930 }, // Orleans
+    { 4944310, 109930 }, // Rouen
+    { 4775080, 733590 }, // Mulhouse
+    { 4918290, -37070 }, // Caen
+    { 4869210, 618440 }, // Nancy
+    { 4894740, 227420 }, // Argenteuil
+    { 4893620, 235740 }, // Saint-Denis
+    { 5069420, 317460 }, // Roubaix
+    { 5072360, 316150 }, // Tourcoing
+    { 4889240, 220690 }, // Nanterre
+    { 4394930, 480550 }, // Avignon
+    { 4879050, 245510 }, // Creteil
+    { 4658020, 34040 }, // Poitiers
+    { 4880140, 213010 }, // Versailles
+    { 4329510, -37070 }, // Pau
+    { 4616030, -115110 }, // La Rochelle
+    { 5095130, 185870 }, // Calais
+    { 4355280, 701740 }, // Cannes
+    { 4191960, 873860 }, // Ajaccio
+    // Germany
+    { 5252000, 1340500 }, // Berlin
+    { 5355110, 999370 }, // Hamburg
+    { 4813510, 1158200 }, // Munich
+    { 5093750, 696030 }, // Cologne
+    { 5011090, 868210 }, // Frankfurt
+    { 4877580, 918290 }, // Stuttgart
+    { 5122770, 677350 }, // Dusseldorf
+    { 5151360, 746530 }, // Dortmund
+    { 5145560, 701160 }, // Essen
+    { 5133970, 1237310 }, // Leipzig
+    { 5307930, 880170 }, // Bremen
+    { 5105040, 1373730 }, // Dresden
+    { 5237590, 973200 }, // Hanover
+    { 4945210, 1107670 }, // Nuremberg
+    { 5143440, 676230 }, // Duisburg
+    { 5148190, 721620 }, // Bochum
+    { 5125620, 715080 }, // Wuppertal
+    { 5203020, 853250 }, // Bielefeld
+    { 5073740, 709820 }, // Bonn
+    { 5196070, 762610 }, // Munster
+    { 4900690, 840370 }, // Karlsruhe
+    { 4948750, 846600 }, // Mannheim
+    { 4837050, 1089780 }, // Augsburg
+    { 5008260, 824000 }, // Wiesbaden
+    { 5151770, 708570 }, // Gelsenkirchen
+    { 5118050, 644280 }, // Monchengladbach
+    { 5226890, 1052680 }, // Braunschweig
+    { 5082780, 1292140 }, // Chemnitz
+    { 5432330, 1012280 }, // Kiel
+    { 5077530, 608390 }, // Aachen
+    { 5148250, 1196970 }, // Halle
+    { 5212050, 1162760 }, // Magdeburg
+    { 4799900, 784210 }, // Freiburg
+    { 5133880, 658530 }, // Krefeld
+    { 5386540, 1068650 }, // Lubeck
+    { 5149630, 685160 }, // Oberhausen
+    { 5098480, 1102990 }, // Erfurt
+    { 4999290, 824730 }, // Mainz
+    { 5408870, 1214310 }, // Rostock
+    { 5131270, 947970 }, // Kassel
+    { 5136700, 746320 }, // Hagen
+    { 5239060, 1306450 }, // Potsdam
+    { 4924010, 699690 }, // Saarbrucken
+    { 5168060, 781420 }, // Hamm
+    { 5142670, 688330 }, // Mulheim
+    { 4947740, 844510 }, // Ludwigshafen
+    { 5104580, 698450 }, // Leverkusen
+    { 5314350, 821460 }, // Oldenburg
+    { 5120480, 668830 }, // Neuss
+    { 5116520, 706790 }, // Solingen
+    { 4939880, 867240 }, // Heidelberg
+    { 4987280, 865120 }, // Darmstadt
+    { 5171890, 875750 }, // Paderborn
+    { 4901340, 1210160 }, // Regensburg
+    { 4876650, 1142570 }, // Ingolstadt
+    { 4979130, 995340 }, // Wurzburg
+    { 4947710, 1098880 }, // Furth
+    { 5242270, 1078650 }, // Wolfsburg
+    { 5009550, 877610 }, // Offenbach
+    { 4840110, 998760 }, // Ulm
+    { 4914270, 921090 }, // Heilbronn
+    { 4889100, 869840 }, // Pforzheim
+    { 5154120, 991580 }, // Gottingen
+    { 5152160, 692890 }, // Bottrop
+    { 4975960, 664410 }, // Trier
+    { 5161420, 719760 }, // Recklinghausen
+    { 4849190, 920440 }, // Reutlingen
+    { 5353960, 858090 }, // Bremerhaven
+    { 5035690, 758900 }, // Koblenz
+    { 5099190, 712980 }, // Bergisch Gladbach
+    { 5092780, 1158610 }, // Jena
+    { 5117900, 718960 }, // Remscheid
+    { 4958970, 1100400 }, // Erlangen
+    { 5145080, 664070 }, // Moers
+    { 5087490, 802440 }, // Siegen
+    { 5215610, 995110 }, // Hildesheim
+    { 5215360, 1040060 }, // Salzgitter
+    // Italy
+    { 4190280, 1249640 }, // Rome
+    { 4546420, 919000 }, // Milan
+    { 4085180, 1426810 }, // Naples
+    { 4507030, 768690 }, // Turin
+    { 3811570, 1336150 }, // Palermo
+    { 4440560, 894630 }, // Genoa
+    { 4449490, 1134260 }, // Bologna
+    { 4376960, 1125580 }, // Florence
+    { 4111710, 1687190 }, // Bari
+    { 3750790, 1508300 }, // Catania
+    { 4544080, 1231550 }, // Venice
+    { 4543840, 1099160 }, // Verona
+    { 3819380, 1555400 }, // Messina
+    { 4540640, 1187680 }, // Padua
+    { 4564950, 1377680 }, // Trieste
+    { 4046680, 1727250 }, // Taranto
+    { 4554160, 1021180 }, // Brescia
+    { 4387770, 1110230 }, // Prato
+    { 3811130, 1566190 }, // Reggio Calabria
+    { 4464710, 1092520 }, // Modena
+    { 4469890, 1063060 }, // Reggio Emilia
+    { 4311220, 1238880 }, // Perugia
+    { 4354820, 1031160 }, // Livorno
+    { 4441730, 1219890 }, // Ravenna
+    { 3922380, 912170 }, // Cagliari
+    { 4146210, 1554440 }, // Foggia
+    { 4406780, 1256950 }, // Rimini
+    { 4068240, 1476810 }, // Salerno
+    { 4483810, 1161930 }, // Ferrara
+    { 4072590, 855990 }, // Sassari
+    { 4146770, 1290320 }, // Latina
+    { 4092920, 1419340 }, // Giugliano
+    { 4558450, 927440 }, // Monza
+    { 3707550, 1528660 }, // Syracuse
+    { 4245840, 1421390 }, // Pescara
+    { 4569830, 967730 }, // Bergamo
+    { 4422260, 1204010 }, // Forlì
+    { 4606640, 1112570 }, // Trento
+    { 4554550, 1153530 }, // Vicenza
+    { 4256330, 1264310 }, // Terni
+    { 4649830, 1135480 }, // Bolzano
+    { 4544690, 861960 }, // Novara
+    { 4505260, 969250 }, // Piacenza
+    { 4361580, 1351890 }, // Ancona
+    // Spain
+    { 4041680, -370380 }, // Madrid
+    { 4138510, 217340 }, // Barcelona
+    { 3946990, -37630 }, // Valencia
+    { 3738910, -598450 }, // Seville
+    { 4164880, -88910 }, // Zaragoza
+    { 3672130, -442140 }, // Malaga
+    { 3799220, -113070 }, // Murcia
+    { 3956960, 265020 }, // Palma
+    { 2812480, -1543000 }, // Las Palmas
+    { 4326270, -292530 }, // Bilbao
+    { 3834520, -48100 }, // Alicante
+    { 3788820, -477940 }, // Cordoba
+    { 4165230, -472450 }, // Valladolid
+    { 4224060, -872070 }, // Vigo
+    { 4353220, -566110 }, // Gijon
+    { 4135980, 210030 }, // Hospitalet
+    { 4284670, -267160 }, // Vitoria-Gasteiz
+    { 4336230, -841150 }, // A Coruña
+    { 3826220, -70110 }, // Elche
+    { 3717730, -359860 }, // Granada
+    { 4336140, -585930 }, // Oviedo
+    { 4145010, 224710 }, // Badalona
+    { 3760630, -98580 }, // Cartagena
+    { 4156400, 201100 }, // Terrassa
+    { 3669690, -612660 }, // Jerez de la Frontera
+    { 4154320, 210830 }, // Sabadell
+    { 4032290, -386440 }, // Mostoles
+    { 2846360, -1625180 }, // Santa Cruz de Tenerife
+    { 4281250, -164580 }, // Pamplona
+    { 3683810, -245970 }, // Almeria
+    { 4048170, -336160 }, // Alcala de Henares
+    { 4028170, -379470 }, // Fuenlabrada
+    { 4032720, -376360 }, // Leganes
+    { 4030580, -373190 }, // Getafe
+    { 4346230, -380990 }, // Santander
+    { 3998640, -5130 }, // Castellon
+    { 4234390, -369650 }, // Burgos
+    { 3899430, -185850 }, // Albacete
+    { 4034560, -382420 }, // Alcorcon
+    { 4331830, -198120 }, // San Sebastian
+    { 4097010, -566350 }, // Salamanca
+    { 3726140, -694470 }, // Huelva
+    { 4161760, 62000 }, // Lleida
+    { 4259870, -556710 }, // Leon
+    { 3652970, -629230 }, // Cadiz
+    { 4111890, 124450 }, // Tarragona
+    { 3887940, -697060 }, // Badajoz
+    // Portugal
+    { 3872230, -913930 }, // Lisbon
+    { 4115790, -862910 }, // Porto
+    { 4155180, -842290 }, // Braga
+    { 4020330, -841030 }, // Coimbra
+    { 3266690, -1692410 }, // Funchal
+    { 3875380, -923220 }, // Amadora
+    { 3867930, -915680 }, // Almada
+    { 3875540, -930890 }, // Agualva-Cacem
+    { 3875720, -925430 }, // Queluz
+    { 3852440, -888820 }, // Setubal
+    { 3866320, -907220 }, // Barreiro
+    { 3879310, -918360 }, // Odivelas
+    { 4064430, -864550 }, // Aveiro
+    { 3864360, -914590 }, // Corroios
+    { 3883140, -916580 }, // Loures
+    { 3857140, -790810 }, // Evora
+    { 4118000, -855950 }, // Rio Tinto
+    { 4110680, -853230 }, // Gondomar
+    { 4112390, -861240 }, // Vila Nova de Gaia
+    { 4118200, -868980 }, // Matosinhos
+    { 3701940, -793220 }, // Faro
+    { 3974370, -880710 }, // Leiria
+    { 4065660, -791220 }, // Viseu
+    { 4144260, -829880 }, // Guimaraes
+    { 4169380, -883430 }, // Viana do Castelo
+    { 3713640, -853760 }, // Portimao
+    { 4180610, -675700 }, // Braganca
+    // Netherlands
+    { 5236760, 490410 }, // Amsterdam
+    { 5192440, 447770 }, // Rotterdam
+    { 5207050, 430070 }, // The Hague
+    { 5209070, 512140 }, // Utrecht
+    { 5144160, 546970 }, // Eindhoven
+    { 5155550, 509130 }, // Tilburg
+    { 5321940, 656650 }, // Groningen
+    { 5235080, 526470 }, // Almere
+    { 5157190, 476830 }, // Breda
+    { 5181260, 583720 }, // Nijmegen
+    { 5222150, 689370 }, // Enschede
+    { 5238740, 464620 }, // Haarlem
+    { 5198510, 589870 }, // Arnhem
+    { 5246890, 482890 }, // Zaanstad
+    { 5215610, 538780 }, // Amersfoort
+    { 5221120, 596990 }, // Apeldoorn
+    { 5169780, 530370 }, // s-Hertogenbosch
+    { 5230190, 468900 }, // Hoofddorp
+    { 5085140, 569090 }, // Maastricht
+    { 5216010, 449700 }, // Leiden
+    { 5181330, 469010 }, // Dordrecht
+    { 5205750, 449320 }, // Zoetermeer
+    { 5251680, 608300 }, // Zwolle
+    { 5225490, 616360 }, // Deventer
+    { 5201160, 435710 }, // Delft
+    { 5263160, 474920 }, // Alkmaar
+    { 5320120, 579990 }, // Leeuwarden
+    { 5137040, 617240 }, // Venlo
+    // Belgium
+    { 5085030, 435170 }, // Brussels
+    { 5121940, 440250 }, // Antwerp
+    { 5105000, 373030 }, // Ghent
+    { 5041080, 444460 }, // Charleroi
+    { 5063260, 557970 }, // Liege
+    { 5120930, 322470 }, // Bruges
+    { 5046690, 487190 }, // Namur
+    { 5087980, 470050 }, // Leuven
+    { 5045420, 395640 }, // Mons
+    { 5093680, 403970 }, // Aalst
+    { 5102820, 447770 }, // Mechelen
+    { 5047920, 418780 }, // La Louviere
+    { 5082620, 326480 }, // Kortrijk
+    { 5093070, 533780 }, // Hasselt
+    { 5116580, 414300 }, // Sint-Niklaas
+    { 5122130, 292710 }, // Oostende
+    { 5060540, 338900 }, // Tournai
+    { 5096580, 550370 }, // Genk
+    { 5061220, 549920 }, // Seraing
+    { 5094810, 312690 }, // Roeselare
+    // Switzerland
+    { 4737690, 854170 }, // Zurich
+    { 4620440, 614320 }, // Geneva
+    { 4755960, 758860 }, // Basel
+    { 4694810, 744740 }, // Bern
+    { 4651970, 663230 }, // Lausanne
+    { 4749790, 872420 }, // Winterthur
+    { 4705020, 830930 }, // Lucerne
+    { 4742450, 937670 }, // St. Gallen
+    { 4600370, 895110 }, // Lugano
+    { 4713680, 724630 }, // Biel/Bienne
+    { 4675810, 762840 }, // Thun
+    { 4692420, 741410 }, // Koniz
+    { 4710110, 682670 }, // La Chaux-de-Fonds
+    { 4680560, 716080 }, // Fribourg
+    { 4769510, 863510 }, // Schaffhausen
+    { 4684800, 953360 }, // Chur
+    { 4620220, 608520 }, // Vernier
+    { 4701690, 694320 }, // Neuchatel
+    { 4734670, 872080 }, // Uster
+    { 4622760, 735880 }, // Sion
+    // Austria
+    { 4820820, 1637380 }, // Vienna
+    { 4707070, 1543950 }, // Graz
+    { 4830690, 1428580 }, // Linz
+    { 4780950, 1305500 }, // Salzburg
+    { 4726920, 1140410 }, // Innsbruck
+    // Czech Republic
+    { 5007550, 1443780 }, // Prague
+    { 4919510, 1660680 }, // Brno
+    { 4982090, 1826250 }, // Ostrava
+    { 4973840, 1337360 }, // Plzen
+    { 5076630, 1505430 }, // Liberec
+    { 4959550, 1725170 }, // Olomouc
+    { 5066070, 1403230 }, // Usti nad Labem
+    { 4897450, 1447430 }, // Ceske Budejovice
+    { 5020930, 1583270 }, // Hradec Kralove
+    { 5004040, 1576630 }, // Pardubice
+    { 4922670, 1766960 }, // Zlin
+    { 4977980, 1843700 }, // Havirov
+    { 5014670, 1410280 }, // Kladno
+    { 5050300, 1363640 }, // Most
+    { 4993870, 1790260 }, // Opava
+    { 4968350, 1833500 }, // Frydek-Mistek
+    { 4985370, 1854250 }, // Karviná
+    { 4939610, 1559060 }, // Jihlava
+    { 5064020, 1382460 }, // Teplice
+    { 5078200, 1420720 }, // Decin
+    // Slovakia
+    { 4814860, 1710770 }, // Bratislava
+    { 4871640, 2126110 }, // Kosice
+    { 4900120, 2123970 }, // Presov
+    { 4922310, 1873970 }, // Zilina
+    { 4830810, 1807110 }, // Nitra
+    { 4873620, 1915340 }, // Banska Bystrica
+    { 4837740, 1758930 }, // Trnava
+    { 4906640, 1892161 }, // Martin
+    { 4889460, 1804460 }, // Trencin
+    { 4906140, 2029860 }, // Poprad
+    { 4877400, 1862670 }, // Prievidza
+    { 4857440, 1912400 }, // Zvolen
+    { 4798550, 1816410 }, // Nove Zamky
+    { 4875430, 2191940 }, // Michalovce
+    { 4894480, 2056770 }, // Spisska Nova Ves
+    // Hungary
+    { 4749790, 1904020 }, // Budapest
+    { 4753160, 2162730 }, // Debrecen
+    { 4625300, 2014140 }, // Szeged
+    { 4810340, 2077840 }, // Miskolc
+    { 4607270, 1823200 }, // Pecs
+    { 4768750, 1765040 }, // Gyor
+    { 4795590, 2171860 }, // Nyiregyhaza
+    { 4690770, 1968560 }, // Kecskemet
+    { 4719010, 1841040 }, // Szekesfehervar
+    { 4723060, 1662180 }, // Szombathely
+    { 4736370, 1892280 }, // Erd
+    { 4756940, 1839250 }, // Tatabanya
+    { 4636610, 1779450 }, // Kaposvar
+    { 4676970, 2113240 }, // Bekes
+    { 4709300, 1791040 }, // Veszprem
+    { 4683980, 1684380 }, // Zalaegerszeg
+    { 4768500, 1658040 }, // Sopron
+    { 4790150, 2037340 }, // Eger
+    { 4645350, 1699440 }, // Nagykanizsa
+    { 4763860, 1913970 }, // Dunakeszi
+    // Poland
+    { 5222970, 2101220 }, // Warsaw
+    { 5006470, 1994500 }, // Krakow
+    { 5175920, 1945600 }, // Lodz
+    { 5110790, 1703850 }, // Wroclaw
+    { 5240640, 1692520 }, // Poznan
+    { 5435200, 1864660 }, // Gdansk
+    { 5342890, 1455300 }, // Szczecin
+    { 5312350, 1800840 }, // Bydgoszcz
+    { 5124650, 2256840 }, // Lublin
+    { 5026490, 1902380 }, // Katowice
+    { 5313250, 2316880 }, // Bialystok
+    { 5451890, 1853050 }, // Gdynia
+    { 5079710, 1912000 }, // Czestochowa
+    { 5140270, 2114710 }, // Radom
+    { 5028630, 1910410 }, // Sosnowiec
+    { 5301380, 1859840 }, // Torun
+    { 5086610, 2062860 }, // Kielce
+    { 5029450, 1867140 }, // Gliwice
+    { 5032490, 1878570 }, // Zabrze
+    { 5034830, 1893840 }, // Bytom
+    { 4982250, 1904440 }, // Bielsko-Biala
+    { 5377840, 2048010 }, // Olsztyn
+    { 5004120, 2199910 }, // Rzeszow
+    { 5025840, 1886480 }, // Ruda Slaska
+    { 5009710, 1854630 }, // Rybnik
+    { 5013570, 1896660 }, // Tychy
+    { 5032180, 1919820 }, // Dabrowa Gornicza
+    { 5254630, 1970650 }, // Plock
+    { 5415220, 1940440 }, // Elblag
+    { 5067510, 1792130 }, // Opole
+    { 5078410, 1628440 }, // Walbrzych
+    { 5193560, 1550620 }, // Zielona Gora
+    { 5001210, 2098590 }, // Tarnow
+    { 5029460, 1895330 }, // Chorzow
+    { 5174870, 1809480 }, // Kalisz
+    { 5419430, 1617140 }, // Koszalin
+    { 5120700, 1616190 }, // Legnica
+    // Romania
+    { 4442680, 2610250 }, // Bucharest
+    { 4677120, 2362360 }, // Cluj-Napoca
+    { 4574890, 2120870 }, // Timisoara
+    { 4715850, 2760140 }, // Iasi
+    { 4415980, 2863480 }, // Constanta
+    // Bulgaria
+    { 4269770, 2332190 }, // Sofia
+    { 4213540, 2474530 }, // Plovdiv
+    { 4321410, 2791470 }, // Varna
+    { 4250480, 2746260 }, // Burgas
+    // Serbia
+    { 4478660, 2044890 }, // Belgrade
+    { 4526710, 1983350 }, // Novi Sad
+    { 4332090, 2189580 }, // Nis
+    // Croatia
+    { 4581500, 1598190 }, // Zagreb
+    { 4350810, 1644020 }, // Split
+    { 4532710, 1444220 }, // Rijeka
+    { 4555500, 1869550 }, // Osijek
+    // Bosnia and Herzegovina
+    { 4384860, 1835640 }, // Sarajevo
+    { 4477220, 1719100 }, // Banja Luka
+    { 4453860, 1867080 }, // Tuzla
+    // Slovenia
+    { 4605690, 1450580 }, // Ljubljana
+    { 4655470, 1564670 }, // Maribor
+    // North Macedonia
+    { 4199730, 2142800 }, // Skopje
+    { 4103140, 2133470 }, // Bitola
+    // Montenegro
+    { 4243040, 1925940 }, // Podgorica
+    // Albania
+    { 4132750, 1981870 }, // Tirana
+    { 4131460, 1944980 }, // Durres
+    // Kosovo
+    { 4266290, 2116550 }, // Pristina
+    // Greece
+    { 3797550, 2373480 }, // Athens
+    { 4064010, 2294440 }, // Thessaloniki
+    { 3824660, 2173460 }, // Patras
+    { 3533870, 2514420 }, // Heraklion
+    // Cyprus
+    { 3518560, 3338230 }, // Nicosia
+    { 3468510, 3303840 }, // Limassol
+    // Malta
+    { 3589970, 1451470 }, // Valletta
+    // Nordic Countries
+    // Sweden
+    { 5932930, 1806860 }, // Stockholm
+    { 5770890, 1197460 }, // Gothenburg
+    { 5560500, 1300380 }, // Malmo
+    { 5985860, 1763890 }, // Uppsala
+    { 5960990, 1654480 }, // Vasteras
+    { 5927410, 1520660 }, // Orebro
+    { 5841080, 1562140 }, // Linkoping
+    { 5604650, 1269450 }, // Helsingborg
+    { 5778260, 1416180 }, // Jonkoping
+    { 5858770, 1619240 }, // Norrkoping
+    { 5570470, 1319100 }, // Lund
+    { 6382840, 2025970 }, // Umea
+    { 6067490, 1714130 }, // Gavle
+    { 5772100, 1294010 }, // Boras
+    { 5919550, 1762530 }, // Sodertalje
+    { 5937080, 1650770 }, // Eskilstuna
+    { 5937930, 1350360 }, // Karlstad
+    { 5944390, 1806870 }, // Taby
+    { 5687770, 1480910 }, // Vaxjo
+    { 5667450, 1285780 }, // Halmstad
+    { 6239080, 1730690 }, // Sundsvall
+    { 6558480, 2215470 }, // Lulea
+    { 5828360, 1228880 }, // Trollhattan
+    { 5602940, 1415670 }, // Kristianstad
+    { 5835180, 1194240 }, // Uddevalla
+    // Norway
+    { 5991390, 1075220 }, // Oslo
+    { 6039130, 532210 }, // Bergen
+    { 6343050, 1039510 }, // Trondheim
+    { 5897000, 573310 }, // Stavanger
+    { 5989390, 1054640 }, // Baerum
+    { 5815990, 801820 }, // Kristiansand
+    { 5921810, 1092980 }, // Fredrikstad
+    { 5885160, 573610 }, // Sandnes
+    { 6964920, 1895530 }, // Tromsø
+    { 5928390, 1110910 }, // Sarpsborg
+    { 5920900, 961340 }, // Skien
+    { 6247220, 614950 }, // Ålesund
+    { 5926770, 1040700 }, // Tonsberg
+    { 5943690, 1065660 }, // Moss
+    { 5941380, 526800 }, // Haugesund
+    { 5913110, 1021660 }, // Sandefjord
+    { 5846080, 877200 }, // Arendal
+    { 6728040, 1440490 }, // Bodø
+    { 5974390, 1020450 }, // Drammen
+    { 5984360, 1043480 }, // Asker
+    { 6111530, 1046640 }, // Lillehammer
+    { 6631280, 1414200 }, // Mo i Rana
+    // Denmark
+    { 5567610, 1256830 }, // Copenhagen
+    { 5616290, 1020390 }, // Aarhus
+    { 5540380, 1040240 }, // Odense
+    { 5704880, 992170 }, // Aalborg
+    { 5547170, 844820 }, // Esbjerg
+    { 5646070, 1003690 }, // Randers
+    { 5549040, 947200 }, // Kolding
+    { 5586070, 985000 }, // Horsens
+    { 5570900, 953570 }, // Vejle
+    { 5564190, 1208030 }, // Roskilde
+    { 5613690, 897470 }, // Herning
+    { 5616970, 954510 }, // Silkeborg
+    { 5523010, 1176100 }, // Naestved
+    { 5556610, 975190 }, // Fredericia
+    { 5645330, 940220 }, // Viborg
+    { 5545810, 1218230 }, // Køge
+    { 5636010, 861640 }, // Holstebro
+    { 5565050, 1230070 }, // Taastrup
+    { 5540280, 1135440 }, // Slagelse
+    { 5592910, 1230080 }, // Hillerød
+    // Finland
+    { 6016990, 2493840 }, // Helsinki
+    { 6020550, 2465590 }, // Espoo
+    { 6149910, 2378710 }, // Tampere
+    { 6029340, 2503780 }, // Vantaa
+    { 6045180, 2226660 }, // Turku
+    { 6501210, 2546510 }, // Oulu
+    { 6098270, 2566120 }, // Lahti
+    { 6289240, 2767800 }, // Kuopio
+    { 6224150, 2572090 }, // Jyvaskyla
+    { 6148510, 2179740 }, // Pori
+    { 6105870, 2818780 }, // Lappeenranta
+    { 6309600, 2161580 }, // Vaasa
+    { 6260100, 2976360 }, // Joensuu
+    { 6099590, 2446410 }, // Hameenlinna
+    { 6046640, 2694580 }, // Kotka
+    { 6279030, 2284040 }, // Seinajoki
+    { 6650390, 2572940 }, // Rovaniemi
+    { 6168840, 2727220 }, // Mikkeli
+    { 6086740, 2670410 }, // Kouvola
+    { 6039250, 2566510 }, // Porvoo
+    { 6112740, 2151030 }, // Rauma
+    { 6186700, 2888100 }, // Savonlinna
+    // Iceland
+    { 6414660, -2194260 }, // Reykjavik
+    // Baltic States
+    // Lithuania
+    { 5468720, 2527970 }, // Vilnius
+    { 5489850, 2390360 }, // Kaunas
+    { 5570330, 2114430 }, // Klaipeda
+    // Latvia
+    { 5694960, 2410520 }, // Riga
+    { 5587470, 2653600 }, // Daugavpils
+    { 5650530, 2101070 }, // Liepaja
+    // Estonia
+    { 5943700, 2475360 }, // Tallinn
+    { 5837800, 2672900 }, // Tartu
+    { 5937720, 2819030 }, // Narva
+    // Eastern Europe
+    // Ukraine
+    { 5045010, 3052340 }, // Kiev
+    { 4999350, 3623040 }, // Kharkiv
+    { 4648250, 3072330 }, // Odessa
+    { 4846470, 3504620 }, // Dnipro
+    { 4983970, 2402970 }, // Lviv
+    // Belarus
+    { 5390450, 2756150 }, // Minsk
+    { 5243450, 3101360 }, // Gomel
+    { 5391680, 3034490 }, // Mogilev
+    // Moldova
+    { 4701050, 2886380 }, // Chisinau
+    { 4684030, 2964330 }, // Tiraspol
+    // Americas
+    // United States
+    { 4071280, -7400600 }, // New York
+    { 3405220, -11824370 }, // Los Angeles
+    { 4187810, -8762980 }, // Chicago
+    { 2976040, -9536980 }, // Houston
+    { 3344840, -11207400 }, // Phoenix
+    { 3995260, -7516520 }, // Philadelphia
+    { 2942410, -9849360 }, // San Antonio
+    { 3271570, -11716110 }, // San Diego
+    { 3277670, -9679700 }, // Dallas
+    { 3733820, -12188630 }, // San Jose
+    { 3026720, -9774310 }, // Austin
+    { 3033220, -8165570 }, // Jacksonville
+    { 3275550, -9733080 }, // Fort Worth
+    { 3996120, -8299880 }, // Columbus
+    { 3522710, -8084310 }, // Charlotte
+    { 3777490, -12241940 }, // San Francisco
+    { 3976840, -8615810 }, // Indianapolis
+    { 4760620, -12233210 }, // Seattle
+    { 3973920, -10499030 }, // Denver
+    { 3890720, -7703690 }, // Washington
+    { 4236010, -7105890 }, // Boston
+    { 3176190, -10648500 }, // El Paso
+    { 3616270, -8678160 }, // Nashville
+    { 4233140, -8304580 }, // Detroit
+    { 3546760, -9751640 }, // Oklahoma City
+    { 4551520, -12267840 }, // Portland
+    { 3616990, -11513980 }, // Las Vegas
+    { 3514950, -9004900 }, // Memphis
+    { 3825270, -8575850 }, // Louisville
+    { 3929040, -7661220 }, // Baltimore
+    { 4303890, -8790650 }, // Milwaukee
+    { 3508440, -10665040 }, // Albuquerque
+    { 3222260, -11097470 }, // Tucson
+    { 3673780, -11978710 }, // Fresno
+    { 3858160, -12149440 }, // Sacramento
+    { 3341520, -11183150 }, // Mesa
+    { 3909970, -9457860 }, // Kansas City
+    { 3374900, -8438800 }, // Atlanta
+    { 3377010, -11819370 }, // Long Beach
+    { 3883390, -10482140 }, // Colorado Springs
+    { 3577960, -7863820 }, // Raleigh
+    { 2576170, -8019180 }, // Miami
+    { 3685290, -7597800 }, // Virginia Beach
+    { 4125650, -9593450 }, // Omaha
+    { 3780440, -12227110 }, // Oakland
+    { 4497780, -9326500 }, // Minneapolis
+    { 3615400, -9599280 }, // Tulsa
+    { 3273570, -9710810 }, // Arlington
+    { 2995110, -9007150 }, // New Orleans
+    { 3768720, -9733010 }, // Wichita
+    { 4149930, -8169440 }, // Cleveland
+    { 2795060, -8245720 }, // Tampa
+    { 3537330, -11901870 }, // Bakersfield
+    { 3972940, -10483190 }, // Aurora
+    { 2130990, -15785810 }, // Honolulu
+    { 3383660, -11791430 }, // Anaheim
+    { 3374550, -11786770 }, // Santa Ana
+    { 2780060, -9739640 }, // Corpus Christi
+    { 3395330, -11739620 }, // Riverside
+    { 3804060, -8450370 }, // Lexington
+    { 3795770, -12129080 }, // Stockton
+    { 3603970, -11498170 }, // Henderson
+    { 4495370, -9309000 }, // Saint Paul
+    { 3862700, -9019940 }, // St. Louis
+    { 3910310, -8451200 }, // Cincinnati
+    { 4044060, -7999590 }, // Pittsburgh
+    // Canada
+    { 4365320, -7938320 }, // Toronto
+    { 4550170, -7356730 }, // Montreal
+    { 4928270, -12312070 }, // Vancouver
+    { 5104470, -11407190 }, // Calgary
+    { 5354610, -11349380 }, // Edmonton
+    { 4542150, -7569720 }, // Ottawa
+    { 4989510, -9713840 }, // Winnipeg
+    { 4681390, -7120800 }, // Quebec City
+    { 4325570, -7987110 }, // Hamilton
+    { 4346430, -8052040 }, // Kitchener
+    { 4298490, -8124530 }, // London
+    { 4464880, -6357520 }, // Halifax
+    // Mexico
+    { 1943260, -9913320 }, // Mexico City
+    { 2065970, -10334960 }, // Guadalajara
+    { 2568660, -10031610 }, // Monterrey
+    { 1904140, -9820630 }, // Puebla
+    { 3251490, -11703820 }, // Tijuana
+    { 2116190, -10169210 }, // León
+    { 3169040, -10642450 }, // Juárez
+    { 2072140, -10339180 }, // Zapopan
+    { 1940030, -9901460 }, // Nezahualcóyotl
+    { 2863530, -10608890 }, // Chihuahua
+    // Brazil
+    { -2355050, -4663330 }, // São Paulo
+    { -2290680, -4317290 }, // Rio de Janeiro
+    { -1582670, -4792180 }, // Brasília
+    { -1297140, -3850140 }, // Salvador
+    { -371720, -3854330 }, // Fortaleza
+    { -1991670, -4393450 }, // Belo Horizonte
+    { -311900, -6002170 }, // Manaus
+    { -2542840, -4927330 }, // Curitiba
+    { -804760, -3487700 }, // Recife
+    { -1668640, -4926430 }, // Goiânia
+    { -145580, -4850440 }, // Belém
+    { -3003460, -5121770 }, // Porto Alegre
+    { -2345380, -4653330 }, // Guarulhos
+    { -2290990, -4706260 }, // Campinas
+    { -253870, -4428250 }, // São Luís
+    // Argentina
+    { -3460370, -5838160 }, // Buenos Aires
+    { -3142010, -6418880 }, // Córdoba
+    { -3294420, -6065050 }, // Rosario
+    { -3289080, -6882720 }, // Mendoza
+    { -3492050, -5795360 }, // La Plata
+    { -2682410, -6522260 }, // San Miguel de Tucumán
+    { -3800230, -5755750 }, // Mar del Plata
+    { -2478590, -6541170 }, // Salta
+    { -3163330, -6070000 }, // Santa Fe
+    // Colombia
+    { 471100, -7407210 }, // Bogotá
+    { 624420, -7558120 }, // Medellín
+    { 345160, -7653200 }, // Cali
+    { 1096390, -7479640 }, // Barranquilla
+    { 1039100, -7547940 }, // Cartagena
+    // Peru
+    { -1204640, -7704280 }, // Lima
+    { -1640900, -7153750 }, // Arequipa
+    { -810900, -7902150 }, // Trujillo
+    { -677140, -7983740 }, // Chiclayo
+    { -1353190, -7196750 }, // Cusco
+    // Chile
+    { -3344890, -7066930 }, // Santiago
+    { -3304720, -7161270 }, // Valparaíso
+    { -3682700, -7304980 }, // Concepción
+    { -2990270, -7124890 }, // La Serena
+    { -2365090, -7039750 }, // Antofagasta
+    // Ecuador
+    { -18070, -7846780 }, // Quito
+    { -217000, -7992240 }, // Guayaquil
+    { -290010, -7900590 }, // Cuenca
+    // Venezuela
+    { 1048060, -6690360 }, // Caracas
+    { 1066660, -7161240 }, // Maracaibo
+    { 1016210, -6800770 }, // Valencia
+    { 1006470, -6935700 }, // Barquisimeto
+    // Uruguay
+    { -3490110, -5616450 }, // Montevideo
+    { -3138330, -5796670 }, // Salto
+    // Paraguay
+    { -2526370, -5757590 }, // Asunción
+    { -2550950, -5461610 }, // Ciudad del Este
+    // Bolivia
+    { -1650000, -6815000 }, // La Paz
+    { -1781460, -6315610 }, // Santa Cruz
+    { -1738950, -6615680 }, // Cochabamba
+    // Guyana
+    { 680130, -5815510 }, // Georgetown
+    // Suriname
+    { 585200, -5520380 }, // Paramaribo
+    // French Guiana
+    { 490410, -5231280 }, // Cayenne
+    // Central America
+    // Guatemala
+    { 1463490, -9050690 }, // Guatemala City
+    // Belize
+    { 1750450, -8819620 }, // Belize City
+    // El Salvador
+    { 1369290, -8921820 }, // San Salvador
+    // Honduras
+    { 1407230, -8719210 }, // Tegucigalpa
+    // Nicaragua
+    { 1213640, -8625140 }, // Managua
+    // Costa Rica
+    { 992810, -8409070 }, // San José
+    // Panama
+    { 898240, -7951990 }, // Panama City
+    // Caribbean
+    // Cuba
+    { 2311360, -8236660 }, // Havana
+    { 2002470, -7582190 }, // Santiago de Cuba
+    // Jamaica
+    { 1799700, -7679360 }, // Kingston
+    // Haiti
+    { 1859440, -7230740 }, // Port-au-Prince
+    // Dominican Republic
+    { 1848610, -6993120 }, // Santo Domingo
+    // Puerto Rico
+    { 1846550, -6610570 }, // San Juan
+    // Trinidad and Tobago
+    { 1065960, -6150890 }, // Port of Spain
+    // Barbados
+    { 1310190, -5961650 }, // Bridgetown
+    // Africa
+    // Nigeria
+    { 652440, 337920 }, // Lagos
+    { 905790, 749510 }, // Abuja
+    { 1200220, 859200 }, // Kano
+    { 737750, 394700 }, // Ibadan
+    { 481560, 704980 }, // Port Harcourt
+    { 633500, 560370 }, // Benin City
+    { 1183110, 1315110 }, // Maiduguri
+    { 1108040, 770760 }, // Zaria
+    { 510660, 736680 }, // Aba
+    { 992850, 889210 }, // Jos
+    { 849660, 454260 }, // Ilorin
+    { 784020, 393390 }, // Oyo
+    { 644030, 749390 }, // Enugu
+    { 714750, 336190 }, // Abeokuta
+    { 1051050, 741650 }, // Kaduna
+    { 812270, 424360 }, // Ogbomoso
+    { 1306220, 524330 }, // Sokoto
+    { 616450, 678620 }, // Onitsha
+    { 551600, 575000 }, // Warri
+    { 755190, 623500 }, // Okene
+    { 495170, 832200 }, // Calabar
+    { 501040, 785640 }, // Uyo
+    { 1299080, 760060 }, // Katsina
+    { 761800, 522050 }, // Ado-Ekiti
+    { 1031580, 984420 }, // Bauchi
+    { 660180, 335150 }, // Ikeja
+    { 773410, 851200 }, // Makurdi
+    { 961770, 655690 }, // Minna
+    { 764590, 492090 }, // Effon-Alaiye
+    { 762840, 474190 }, // Ilesa
+    { 725710, 520580 }, // Akure
+    { 750080, 523080 }, // Ikere-Ekiti
+    { 555550, 592810 }, // Oghara
+    { 796670, 360000 }, // Iseyin
+    { 668330, 326670 }, // Sango Ota
+    { 719640, 558690 }, // Owo
+    { 763060, 418230 }, // Iwo
+    { 791670, 466670 }, // Ikirun
+    { 683330, 366670 }, // Shagamu
+    { 928330, 1246670 }, // Jimeta
+    // South Africa
+    { -2620410, 2804730 }, // Johannesburg
+    { -3392490, 1842410 }, // Cape Town
+    { -2985870, 3102180 }, // Durban
+    { -2574790, 2822930 }, // Pretoria
+    { -3396080, 2560220 }, // Port Elizabeth
+    { -2961440, 3039220 }, // Pietermaritzburg
+    { -2618840, 2832060 }, // Benoni
+    { -2599670, 2822940 }, // Tembisa
+    { -3301530, 2791160 }, // East London
+    { -2667340, 2792670 }, // Vereeniging
+    { -2908520, 2615960 }, // Bloemfontein
+    { -2620840, 2826260 }, // Boksburg
+    { -2797720, 2673530 }, // Welkom
+    { -2608550, 2777560 }, // Krugersdorp
+    { -2593260, 2801310 }, // Diepsloot
+    { -2923330, 2671670 }, // Botshabelo
+    { -2623670, 2836970 }, // Brakpan
+    { -2586760, 2923680 }, // Witbank
+    { -2620000, 2785000 }, // Oberholzer
+    { -2623090, 2817750 }, // Germiston
+    { -2625000, 2840000 }, // Springs
+    { -2616250, 2787020 }, // Roodepoort
+    { -2609370, 2800310 }, // Randburg
+    { -2670670, 2783720 }, // Vanderbijlpark
+    { -2586010, 2818870 }, // Centurion
+    { -3375810, 2539690 }, // Uitenhage
+    { -2599530, 2812930 }, // Midrand
+    { -2776960, 3079150 }, // Vryheid
+    { -2686680, 2666120 }, // Klerksdorp
+    { -2775740, 2993170 }, // Newcastle
+    { -2635980, 2739480 }, // Carletonville
+    { -2643150, 2847720 }, // Nigel
+    { -2556530, 3052790 }, // Mpumalanga
+    { -2646670, 2946670 }, // Bethal
+    { -2671400, 2709820 }, // Potchefstroom
+    { -2566690, 2724180 }, // Rustenburg
+    { -2681320, 2781510 }, // Sasolburg
+    { -2810420, 2686520 }, // Virginia
+    { -2563540, 2778110 }, // Brits
+    { -2394290, 3114100 }, // Phalaborwa
+    { -2390450, 2946890 }, // Polokwane
+    // Kenya
+    { -129210, 3682190 }, // Nairobi
+    { -404350, 3966820 }, // Mombasa
+    { -9170, 3476800 }, // Kisumu
+    { -30310, 3608000 }, // Nakuru
+    { 51430, 3526980 }, // Eldoret
+    { -108330, 3448330 }, // Kehancha
+    { 101670, 3501670 }, // Kitale
+    { -321670, 4011670 }, // Malindi
+    { -45690, 3965820 }, // Garissa
+    { 28270, 3475190 }, // Kakamega
+    { -103950, 3706930 }, // Thika
+    { -227170, 4090200 }, // Lamu
+    { -41670, 3695000 }, // Nyeri
+    { -151770, 3726340 }, // Machakos
+    { 5000, 3765000 }, // Meru
+    { -36810, 3528390 }, // Kericho
+    { -53910, 3745060 }, // Embu
+    { -106340, 3447310 }, // Migori
+    { 123890, 3511170 }, // Kapenguria
+    { 174710, 4006320 }, // Wajir
+    // Ethiopia
+    { 914500, 4048970 }, // Addis Ababa
+    { 959150, 4186610 }, // Dire Dawa
+    { 1349670, 3947550 }, // Mekelle
+    { 854000, 3926890 }, // Adama
+    { 1260900, 3747390 }, // Gondar
+    { 705000, 3846670 }, // Awassa
+    { 1159420, 3736150 }, // Bahir Dar
+    { 1111670, 3963330 }, // Dessie
+    { 768330, 3683330 }, // Jimma
+    { 935000, 4280000 }, // Jijiga
+    { 720000, 3860000 }, // Shashemene
+    { 908330, 3655000 }, // Nekemte
+    { 1035000, 3771670 }, // Debre Markos
+    { 931670, 4211670 }, // Harar
+    { 968330, 3953330 }, // Debre Berhan
+    { 641670, 3831670 }, // Dilla
+    { 603330, 3755000 }, // Arba Minch
+    { 755000, 3785000 }, // Hosaena
+    { 875000, 3900000 }, // Debre Zeit
+    { 898330, 3785000 }, // Ambo
+    // Ghana
+    { 560370, -18700 }, // Accra
+    { 668850, -162440 }, // Kumasi
+    { 940080, -83930 }, // Tamale
+    { 488450, -175540 }, // Takoradi
+    { 566980, 1660 }, // Tema
+    { 510530, -124660 }, // Cape Coast
+    { 620220, -165960 }, // Obuasi
+    { 609430, -26400 }, // Koforidua
+    { 733690, -232650 }, // Sunyani
+    { 660540, 47190 }, // Ho
+    { 758870, -193930 }, // Techiman
+    { 1006060, -250750 }, // Wa
+    { 1078560, -85160 }, // Bolgatanga
+    { 530370, -199660 }, // Tarkwa
+    { 535100, -61360 }, // Winneba
+    { 596670, -178330 }, // Dunkwa-on-Offin
+    // Senegal
+    { 1471670, -1746770 }, // Dakar
+    { 1485000, -1588330 }, // Touba
+    { 1478860, -1692360 }, // Thiès
+    { 1413330, -1606670 }, // Kaolack
+    { 1442030, -1696190 }, // Mbour
+    { 1604690, -1648140 }, // Saint-Louis
+    { 1256810, -1627190 }, // Ziguinchor
+    { 1465220, -1622830 }, // Diourbel
+    { 1561810, -1624030 }, // Louga
+    { 1377080, -1366810 }, // Tambacounda
+    { 1289440, -1494060 }, // Kolda
+    { 1433470, -1641190 }, // Fatick
+    { 1565560, -1325530 }, // Matam
+    { 1256060, -1217310 }, // Kedougou
+    // Morocco (already included above)
+    // Tunisia (already included above)
+    // Algeria (already included above)
+    // Libya (already included above)
+    // Egypt (already included above)
+    // Sudan (already included above)
+    // Tanzania
+    { -679240, 3920830 }, // Dar es Salaam
+    { -251640, 3291750 }, // Mwanza
+    { -338690, 3668300 }, // Arusha
+    { -616300, 3575160 }, // Dodoma
+    { -890940, 3346080 }, // Mbeya
+    { -682350, 3765880 }, // Morogoro
+    { -506780, 3909920 }, // Tanga
+    { -501670, 3283330 }, // Tabora
+    { -487720, 2962690 }, // Kigoma
+    { -1026690, 4018280 }, // Mtwara
+    { -150000, 3380000 }, // Musoma
+    { -776670, 3570000 }, // Iringa
+    { -481670, 3475000 }, // Singida
+    { -933330, 3476670 }, // Njombe
+    { -133140, 3181200 }, // Bukoba
+    { -1068330, 3565000 }, // Songea
+    { -796670, 3161670 }, // Sumbawanga
+    { -1000000, 3971670 }, // Lindi
+    { -366670, 3341670 }, // Shinyanga
+    { -616590, 3920260 }, // Zanzibar City
+    // Uganda
+    { 34760, 3258250 }, // Kampala
+    { 278330, 3230000 }, // Gulu
+    { 225000, 3290000 }, // Lira
+    { -60690, 3064780 }, // Mbarara
+    { 42360, 3320420 }, // Jinja
+    { 108330, 3417500 }, // Mbale
+    { 35330, 3275530 }, // Mukono
+    { 18330, 3008330 }, // Kasese
+    { -33750, 3173310 }, // Masaka
+    { 6670, 3246670 }, // Entebbe
+    { -124810, 2999000 }, // Kabale
+    { 303330, 3091670 }, // Arua
+    { 328330, 3288330 }, // Kitgum
+    { 340000, 3096670 }, // Koboko
+    { 61670, 3346670 }, // Iganga
+    { 171670, 3360000 }, // Soroti
+    { 67140, 3027470 }, // Fort Portal
+    { 143330, 3135000 }, // Hoima
+    { 300000, 3310000 }, // Pader
+    { 69280, 3418060 }, // Tororo
+    // Rwanda
+    { -197060, 3010440 }, // Kigali
+    { -259670, 2974140 }, // Butare
+    { -207500, 2975640 }, // Gitarama
+    { -149940, 2963420 }, // Ruhengeri
+    { -170280, 2925810 }, // Gisenyi
+    { -158330, 3006670 }, // Byumba
+    { -248330, 2891670 }, // Cyangugu
+    { -216670, 3053330 }, // Kibungo
+    { -206060, 2934860 }, // Kibuye
+    { -241670, 2956670 }, // Gikongoro
+    // Burundi
+    { -336140, 2935990 }, // Bujumbura
+    { -342640, 2993060 }, // Gitega
+    { -284530, 3034280 }, // Muyinga
+    { -290750, 2983080 }, // Ngozi
+    { -347640, 3024970 }, // Ruyigi
+    { -292190, 2962920 }, // Kayanza
+    { -394860, 2962440 }, // Bururi
+    { -326830, 2960830 }, // Muramvya
+    { -392830, 2999280 }, // Rutana
+    { -413830, 2980440 }, // Makamba
+    // Democratic Republic of Congo
+    { -444190, 1526630 }, // Kinshasa
+    { -1166490, 2747940 }, // Lubumbashi
+    { -613640, 2358970 }, // Mbuji-Mayi
+    { 51670, 2520000 }, // Kisangani
+    { -438330, 1539170 }, // Masina
+    { -589060, 2241360 }, // Kananga
+    { -1098470, 2673840 }, // Likasi
+    { -1071470, 2546650 }, // Kolwezi
+    { -641670, 2080000 }, // Tshikapa
+    { 48330, 2946670 }, // Beni
+    { -250810, 2886080 }, // Bukavu
+    { -700000, 2345000 }, // Mwene-Ditu
+    { -504110, 1881640 }, // Kikwit
+    { 4650, 1826060 }, // Mbandaka
+    { -583860, 1346310 }, // Matadi
+    { -339060, 2913940 }, // Uvira
+    { 14170, 2929140 }, // Butembo
+    { -674500, 2395330 }, // Gandajika
+    { -592780, 2919440 }, // Kalemie
+    { -167920, 2924030 }, // Goma
+    // Republic of Congo
+    { -426340, 1524290 }, // Brazzaville
+    { -476920, 1186360 }, // Pointe-Noire
+    { -419750, 1266830 }, // Dolisie
+    { -421670, 1328330 }, // Nkayi
+    { -293330, 1270000 }, // Mossendjo
+    { 161670, 1806670 }, // Impfondo
+    { 161360, 1605190 }, // Ouesso
+    { -416670, 1355000 }, // Madingou
+    { -48330, 1590000 }, // Owando
+    { -368330, 1335000 }, // Sibiti
+    // Central African Republic
+    { 439470, 1855820 }, // Bangui
+    { 425360, 1841830 }, // Bimbo
+    { 426110, 1579190 }, // Berbérati
+    { 494280, 1587560 }, // Carnot
+    { 576170, 2067560 }, // Bambari
+    { 593330, 1560000 }, // Bouar
+    { 648330, 1745000 }, // Bossangoa
+    { 651670, 2198330 }, // Bria
+    { 474140, 2281810 }, // Bangassou
+    { 352670, 1604560 }, // Nola
+    // Chad
+    { 1213480, 1505570 }, // N'Djamena
+    { 856670, 1608330 }, // Moundou
+    { 915000, 1838330 }, // Sarh
+    { 1382670, 2083220 }, // Abéché
+    { 891670, 1755000 }, // Koumra
+    { 936670, 1491670 }, // Pala
+    { 1103330, 2028330 }, // Am Timan
+    { 1028330, 1536670 }, // Bongor
+    { 1218330, 1868330 }, // Mongo
+    { 865000, 1685000 }, // Doba
+    { 1321670, 1833330 }, // Ati
+    { 939670, 1630000 }, // Laï
+    { 930830, 1580670 }, // Kelo
+    { 1412000, 1531000 }, // Mao
+    { 1453330, 2091670 }, // Biltine
+    // Cameroon
+    { 384800, 1150210 }, // Yaoundé
+    { 405110, 976790 }, // Douala
+    { 595970, 1014890 }, // Bamenda
+    { 547610, 1042000 }, // Bafoussam
+    { 930140, 1339640 }, // Garoua
+    { 1059060, 1431560 }, // Maroua
+    { 495470, 994000 }, // Nkongsamba
+    { 457750, 1368470 }, // Bertoua
+    { 380000, 1013330 }, // Edéa
+    { 471670, 973330 }, // Loum
+    { 463360, 945690 }, // Kumba
+    { 731670, 1358330 }, // Ngaoundéré
+    { 291470, 1115390 }, // Ebolowa
+    { 293330, 991670 }, // Kribi
+    { 407330, 936030 }, // Tiko
+    { 351670, 1150000 }, // Mbalmayo
+    { 545000, 1005000 }, // Dschang
+    { 562670, 1025470 }, // Mbouda
+    { 572780, 1090170 }, // Foumban
+    { 401560, 921440 }, // Limbe
+    // Gabon
+    { 41620, 946730 }, // Libreville
+    // Equatorial Guinea
+    { 375580, 878250 }, // Malabo
+    // São Tomé and Príncipe
+    { 18640, 661310 }, // São Tomé
+    // Angola
+    { -883900, 1328940 }, // Luanda
+    // Namibia
+    { -2295760, 1708320 }, // Windhoek
+    // Botswana
+    { -2462820, 2592310 }, // Gaborone
+    { -2116690, 2750800 }, // Francistown
+    { -2441670, 2548330 }, // Molepolole
+    { -2238330, 2671670 }, // Serowe
+    { -2200580, 2784750 }, // Selibe Phikwe
+    { -1998330, 2341670 }, // Maun
+    { -2498330, 2533330 }, // Kanye
+    { -2443330, 2615000 }, // Mochudi
+    { -2310000, 2676670 }, // Mahalapye
+    { -2253330, 2713330 }, // Palapye
+    { -2460000, 2471670 }, // Jwaneng
+    { -2521670, 2566670 }, // Lobatse
+    // Zimbabwe
+    { -1782520, 3103350 }, // Harare
+    { -2016190, 2859060 }, // Bulawayo
+    { -1801670, 3108330 }, // Chitungwiza
+    { -1896670, 3266670 }, // Mutare
+    { -1789000, 3114670 }, // Epworth
+    { -1945000, 2981670 }, // Gweru
+    { -1891670, 2981670 }, // Kwekwe
+    { -1833330, 2991670 }, // Kadoma
+    { -2006380, 3082780 }, // Masvingo
+    { -1736670, 3020000 }, // Chinhoyi
+    { -1788330, 3070000 }, // Norton
+    { -1818540, 3155240 }, // Marondera
+    { -1789000, 3124670 }, // Ruwa
+    { -1813330, 3013330 }, // Chegutu
+    { -2033330, 3003330 }, // Zvishavane
+    { -1730000, 3131670 }, // Bindura
+    { -2221670, 3000000 }, // Beitbridge
+    { -1903330, 2978330 }, // Redcliff
+    { -1792440, 2583220 }, // Victoria Falls
+    { -1836670, 2650000 }, // Hwange
+    // Zambia
+    { -1538750, 2832280 }, // Lusaka
+    { -1280240, 2821340 }, // Kitwe
+    { -1295870, 2863660 }, // Ndola
+    { -1444690, 2844640 }, // Kabwe
+    { -1252890, 2786190 }, // Chingola
+    { -1255000, 2824100 }, // Mufulira
+    { -1313670, 2841670 }, // Luanshya
+    { -1784190, 2585440 }, // Livingstone
+    { -1021290, 3118070 }, // Kasama
+    { -1363060, 3264640 }, // Chipata
+    { -1586000, 2774830 }, // Mazabuka
+    { -1680880, 2698810 }, // Choma
+    { -1397080, 2867000 }, // Kapiri Mposhi
+    { -1525480, 2313170 }, // Mongu
+    { -1576940, 2818110 }, // Kafue
+    // Malawi
+    { -1396260, 3377410 }, // Lilongwe
+    { -1578610, 3500580 }, // Blantyre
+    { -1146480, 3401000 }, // Mzuzu
+    { -1538500, 3531890 }, // Zomba
+    { -1301670, 3348330 }, // Kasungu
+    { -1447830, 3526420 }, // Mangochi
+    { -1375830, 3445970 }, // Salima
+    { -1506060, 3522390 }, // Liwonde
+    { -993330, 3393330 }, // Karonga
+    { -1691970, 3526140 }, // Nsanje
+    { -1498330, 3551670 }, // Machinga
+    { -1437830, 3433310 }, // Dedza
+    // Mozambique
+    { -2596920, 3257320 }, // Maputo
+    { -1984360, 3483890 }, // Beira
+    { -1511650, 3926660 }, // Nampula
+    { -1911640, 3348390 }, // Chimoio
+    { -1454280, 4067250 }, // Nacala
+    { -1787860, 3688830 }, // Quelimane
+    { -1615640, 3358670 }, // Tete
+    { -2505190, 3364440 }, // Xai-Xai
+    { -1331330, 3524060 }, // Lichinga
+    { -1297450, 4051780 }, // Pemba
+    { -2386500, 3538330 }, // Inhambane
+    { -1960970, 3474310 }, // Dondo
+    { -1546670, 3698330 }, // Gurué
+    { -2385970, 3534720 }, // Maxixe
+    { -1623250, 3990830 }, // Angoche
+    // Madagascar
+    { -1887920, 4750790 }, // Antananarivo
+    { -1814920, 4940220 }, // Toamasina
+    { -1986670, 4701670 }, // Antsirabe
+    { -2145000, 4708330 }, // Fianarantsoa
+    { -1571670, 4631670 }, // Mahajanga
+    { -2335000, 4366670 }, // Toliara
+    { -1227920, 4929110 }, // Antsiranana
+    { -2028330, 4428330 }, // Morondava
+    { -2516670, 4608330 }, // Ambovombe
+    { -2213330, 4801670 }, // Manakara
+    { -2121670, 4833330 }, // Mananjary
+    { -1426670, 5016670 }, // Sambava
+    { -2502810, 4699750 }, // Fort Dauphin
+    { -1805000, 4403330 }, // Maintirano
+    { -1933330, 4896670 }, // Vatomandry
+    // Mauritius
+    { -2016540, 5750150 }, // Port Louis
+    { -2023330, 5746670 }, // Beau Bassin-Rose Hill
+    { -2029810, 5747890 }, // Vacoas-Phoenix
+    { -2031670, 5751670 }, // Curepipe
+    { -2026670, 5748330 }, // Quatre Bornes
+    { -2005000, 5755000 }, // Triolet
+    { -2003330, 5758330 }, // Goodlands
+    { -2020000, 5771670 }, // Centre de Flacq
+    { -2040640, 5770000 }, // Mahebourg
+    { -2021670, 5751670 }, // Saint Pierre
+    // Seychelles
+    { -467960, 5549200 }, // Victoria
+    // Comoros
+    { -1171720, 4324730 }, // Moroni
+    // Djibouti
+    { 1182510, 4259030 }, // Djibouti
+    // Eritrea
+    { 1532290, 3892510 }, // Asmara
+    // Somalia
+    { 204690, 4531820 }, // Mogadishu
+    // Ivory Coast
+    { 533640, -402670 }, // Abidjan
+    { 682760, -528930 }, // Yamoussoukro
+    // Burkina Faso
+    { 1237140, -151970 }, // Ouagadougou
+    // Mali
+    { 1263920, -800290 }, // Bamako
+    // Niger
+    { 1351160, 212540 }, // Niamey
+    // Guinea
+    { 964120, -1357840 }, // Conakry
+    // Sierra Leone
+    { 846570, -1323170 }, // Freetown
+    // Liberia
+    { 629070, -1076050 }, // Monrovia
+    // Gambia
+    { 1345490, -1657900 }, // Banjul
+    // Guinea-Bissau
+    { 1180370, -1518040 }, // Bissau
+    // Cape Verde
+    { 1491770, -2350920 }, // Praia
+    // Togo
+    { 613190, 122280 }, // Lomé
+    // Benin
+    { 649680, 262810 }, // Porto-Novo
+    { 640230, 250590 }, // Cotonou
+    // Lesotho
+    { -2931510, 2748690 }, // Maseru
+    // Swaziland
+    { -2630540, 3113670 }, // Mbabane
+    // Oceania
+    // Australia
+    { -3386880, 15120930 }, // Sydney
+    { -3781360, 14496310 }, // Melbourne
+    { -2746980, 15302510 }, // Brisbane
+    { -3195050, 11586050 }, // Perth
+    { -3492850, 13860070 }, // Adelaide
+    { -3528090, 14913000 }, // Canberra
+    { -2801670, 15340000 }, // Gold Coast
+    { -3292830, 15178170 }, // Newcastle
+    { -3442780, 15089310 }, // Wollongong
+    { -1246340, 13084560 }, // Darwin
+    { -4288210, 14732720 }, // Hobart
+    // New Zealand
+    { -3684850, 17476330 }, // Auckland
+    { -4128650, 17477620 }, // Wellington
+    { -4353210, 17263620 }, // Christchurch
+    { -3778700, 17527930 }, // Hamilton
+    { -4587880, 17050280 }, // Dunedin
+    // Papua New Guinea
+    { -944380, 14718030 }, // Port Moresby
+    // Fiji
+    { -1814160, 17844190 }, // Suva
+    // Solomon Islands
+    { -942800, 15994980 }, // Honiara
+    // Vanuatu
+    { -1773340, 16832730 }, // Port Vila
+    // New Caledonia
+    { -2227580, 16645810 }, // Nouméa
+    // French Polynesia
+    { -1755160, -14955850 }, // Papeete
+    // Samoa
+    { -1385060, -17175130 }, // Apia
+    // Tonga
+    { -2113900, -17520180 }, // Nuku'alofa
+    // Palau
+    { 750060, 13462420 }, // Ngerulmud
+    // Micronesia
+    { 692480, 15816110 }, // Palikir
+    // Marshall Islands
+    { 713150, 17118450 }, // Majuro
+    // Kiribati
+    { 132780, 17297700 }, // Tarawa
+    // Nauru
+    { -54770, 16692090 }, // Yaren
+    // Tuvalu
+    { -852430, 17919420 }, // Funafuti
+};
+
+// Name offset, zone, country
+const city_record_t world_city_records[2028] = {
+    // Saudi Arabia
+    { 0, TZ_UTC_P3, { 'S', 'A' } }, // Mecca
+    { 6, TZ_UTC_P3, { 'S', 'A' } }, // Medina
+    { 13, TZ_UTC_P3, { 'S', 'A' } }, // Riyadh
+    { 20, TZ_UTC_P3, { 'S', 'A' } }, // Jeddah
+    { 27, TZ_UTC_P3, { 'S', 'A' } }, // Dammam
+    { 34, TZ_UTC_P3, { 'S', 'A' } }, // Khobar
+    { 41, TZ_UTC_P3, { 'S', 'A' } }, // Taif
+    { 46, TZ_UTC_P3, { 'S', 'A' } }, // Abha
+    { 51, TZ_UTC_P3, { 'S', 'A' } }, // Tabuk
+    { 57, TZ_UTC_P3, { 'S', 'A' } }, // Hail
+    // United Arab Emirates
+    { 62, TZ_UTC_P4, { 'A', 'E' } }, // Dubai
+    { 68, TZ_UTC_P4, { 'A', 'E' } }, // Abu Dhabi
+    { 78, TZ_UTC_P4, { 'A', 'E' } }, // Sharjah
+    { 86, TZ_UTC_P4, { 'A', 'E' } }, // Ajman
+    { 92, TZ_UTC_P4, { 'A', 'E' } }, // Fujairah
+    { 101, TZ_UTC_P4, { 'A', 'E' } }, // Ras Al Khaimah
+    { 116, TZ_UTC_P4, { 'A', 'E' } }, // Umm Al Quwain
+    // Egypt
+    { 130, TZ_EGYPT, { 'E', 'G' } }, // Cairo
+    { 136, TZ_EGYPT, { 'E', 'G' } }, // Alexandria
+    { 147, TZ_EGYPT, { 'E', 'G' } }, // Giza
+    { 152, TZ_EGYPT, { 'E', 'G' } }, // Luxor
+    { 158, TZ_EGYPT, { 'E', 'G' } }, // Aswan
+    { 164, TZ_EGYPT, { 'E', 'G' } }, // Port Said
+    { 174, TZ_EGYPT, { 'E', 'G' } }, // Suez
+    { 179, TZ_EGYPT, { 'E', 'G' } }, // Hurghada
+    { 188, TZ_EGYPT, { 'E', 'G' } }, // Sharm El Sheikh
+    // Turkey
+    { 204, TZ_UTC_P3, { 'T', 'R' } }, // Istanbul
+    { 213, TZ_UTC_P3, { 'T', 'R' } }, // Ankara
+    { 220, TZ_UTC_P3, { 'T', 'R' } }, // Izmir
+    { 226, TZ_UTC_P3, { 'T', 'R' } }, // Bursa
+    { 232, TZ_UTC_P3, { 'T', 'R' } }, // Antalya
+    { 240, TZ_UTC_P3, { 'T', 'R' } }, // Konya
+    { 246, TZ_UTC_P3, { 'T', 'R' } }, // Adana
+    { 252, TZ_UTC_P3, { 'T', 'R' } }, // Gaziantep
+    { 262, TZ_UTC_P3, { 'T', 'R' } }, // Kayseri
+    { 270, TZ_UTC_P3, { 'T', 'R' } }, // Eskisehir
+    { 280, TZ_UTC_P3, { 'T', 'R' } }, // Diyarbakir
+    { 291, TZ_UTC_P3, { 'T', 'R' } }, // Samsun
+    { 298, TZ_UTC_P3, { 'T', 'R' } }, // Denizli
+    { 306, TZ_UTC_P3, { 'T', 'R' } }, // Malatya
+    { 314, TZ_UTC_P3, { 'T', 'R' } }, // Kahramanmaras
+    { 328, TZ_UTC_P3, { 'T', 'R' } }, // Erzurum
+    { 336, TZ_UTC_P3, { 'T', 'R' } }, // Van
+    { 340, TZ_UTC_P3, { 'T', 'R' } }, // Batman
+    { 347, TZ_UTC_P3, { 'T', 'R' } }, // Elazığ
+    { 356, TZ_UTC_P3, { 'T', 'R' } }, // Icel
+    { 361, TZ_UTC_P3, { 'T', 'R' } }, // Manisa
+    { 368, TZ_UTC_P3, { 'T', 'R' } }, // Sivas
+    { 374, TZ_UTC_P3, { 'T', 'R' } }, // Gebze
+    { 380, TZ_UTC_P3, { 'T', 'R' } }, // Balıkesir
+    { 391, TZ_UTC_P3, { 'T', 'R' } }, // Sanliurfa
+    { 401, TZ_UTC_P3, { 'T', 'R' } }, // Trabzon
+    { 409, TZ_UTC_P3, { 'T', 'R' } }, // Ordu
+    { 414, TZ_UTC_P3, { 'T', 'R' } }, // Aydin
+    { 420, TZ_UTC_P3, { 'T', 'R' } }, // Usak
+    { 425, TZ_UTC_P3, { 'T', 'R' } }, // Isparta
+    { 433, TZ_UTC_P3, { 'T', 'R' } }, // Afyon
+    { 439, TZ_UTC_P3, { 'T', 'R' } }, // Zonguldak
+    { 449, TZ_UTC_P3, { 'T', 'R' } }, // Tokat
+    // Iran
+    { 455, TZ_UTC_P3_30, { 'I', 'R' } }, // Tehran
+    { 462, TZ_UTC_P3_30, { 'I', 'R' } }, // Mashhad
+    { 470, TZ_UTC_P3_30, { 'I', 'R' } }, // Isfahan
+    { 478, TZ_UTC_P3_30, { 'I', 'R' } }, // Karaj
+    { 484, TZ_UTC_P3_30, { 'I', 'R' } }, // Tabriz
+    { 491, TZ_UTC_P3_30, { 'I', 'R' } }, // Shiraz
+    { 498, TZ_UTC_P3_30, { 'I', 'R' } }, // Qom
+    { 502, TZ_UTC_P3_30, { 'I', 'R' } }, // Ahvaz
+    { 508, TZ_UTC_P3_30, { 'I', 'R' } }, // Kermanshah
+    { 519, TZ_UTC_P3_30, { 'I', 'R' } }, // Urmia
+    { 525, TZ_UTC_P3_30, { 'I', 'R' } }, // Zahedan
+    { 533, TZ_UTC_P3_30, { 'I', 'R' } }, // Rasht
+    { 539, TZ_UTC_P3_30, { 'I', 'R' } }, // Kerman
+    { 546, TZ_UTC_P3_30, { 'I', 'R' } }, // Hamadan
+    { 554, TZ_UTC_P3_30, { 'I', 'R' } }, // Arak
+    { 559, TZ_UTC_P3_30, { 'I', 'R' } }, // Yazd
+    { 564, TZ_UTC_P3_30, { 'I', 'R' } }, // Ardabil
+    { 572, TZ_UTC_P3_30, { 'I', 'R' } }, // Bandar Abbas
+    { 585, TZ_UTC_P3_30, { 'I', 'R' } }, // Eslamshahr
+    { 596, TZ_UTC_P3_30, { 'I', 'R' } }, // Zanjan
+    { 603, TZ_UTC_P3_30, { 'I', 'R' } }, // Sanandaj
+    { 612, TZ_UTC_P3_30, { 'I', 'R' } }, // Qazvin
+    { 619, TZ_UTC_P3_30, { 'I', 'R' } }, // Khomeynishahr
+    { 633, TZ_UTC_P3_30, { 'I', 'R' } }, // Dezful
+    { 640, TZ_UTC_P3_30, { 'I', 'R' } }, // Nasim Shahr
+    { 652, TZ_UTC_P3_30, { 'I', 'R' } }, // Khorramshahr
+    { 665, TZ_UTC_P3_30, { 'I', 'R' } }, // Shahrud
+    { 673, TZ_UTC_P3_30, { 'I', 'R' } }, // Gorgan
+    { 680, TZ_UTC_P3_30, { 'I', 'R' } }, // Neyshabur
+    { 690, TZ_UTC_P3_30, { 'I', 'R' } }, // Sari
+    { 695, TZ_UTC_P3_30, { 'I', 'R' } }, // Babol
+    { 701, TZ_UTC_P3_30, { 'I', 'R' } }, // Abadan
+    { 708, TZ_UTC_P3_30, { 'I', 'R' } }, // Khorramabad
+    { 720, TZ_UTC_P3_30, { 'I', 'R' } }, // Ilam
+    { 725, TZ_UTC_P3_30, { 'I', 'R' } }, // Mahabad
+    { 733, TZ_UTC_P3_30, { 'I', 'R' } }, // Varamin
+    // Iraq
+    { 741, TZ_UTC_P3, { 'I', 'Q' } }, // Baghdad
+    { 749, TZ_UTC_P3, { 'I', 'Q' } }, // Basra
+    { 755, TZ_UTC_P3, { 'I', 'Q' } }, // Erbil
+    { 761, TZ_UTC_P3, { 'I', 'Q' } }, // Najaf
+    { 767, TZ_UTC_P3, { 'I', 'Q' } }, // Karbala
+    { 775, TZ_UTC_P3, { 'I', 'Q' } }, // Mosul
+    { 781, TZ_UTC_P3, { 'I', 'Q' } }, // Sulaymaniyah
+    { 794, TZ_UTC_P3, { 'I', 'Q' } }, // Kirkuk
+    { 801, TZ_UTC_P3, { 'I', 'Q' } }, // Hillah
+    { 808, TZ_UTC_P3, { 'I', 'Q' } }, // Samarra
+    { 816, TZ_UTC_P3, { 'I', 'Q' } }, // Ramadi
+    { 823, TZ_UTC_P3, { 'I', 'Q' } }, // Fallujah
+    { 832, TZ_UTC_P3, { 'I', 'Q' } }, // Tikrit
+    { 839, TZ_UTC_P3, { 'I', 'Q' } }, // Baqubah
+    { 847, TZ_UTC_P3, { 'I', 'Q' } }, // Nasiriyah
+    { 857, TZ_UTC_P3, { 'I', 'Q' } }, // Amara
+    { 863, TZ_UTC_P3, { 'I', 'Q' } }, // Kut
+    { 867, TZ_UTC_P3, { 'I', 'Q' } }, // Diwaniyah
+    { 877, TZ_UTC_P3, { 'I', 'Q' } }, // Dohuk
+    { 883, TZ_UTC_P3, { 'I', 'Q' } }, // Zakho
+    // Jordan
+    { 889, TZ_UTC_P3, { 'J', 'O' } }, // Amman
+    { 895, TZ_UTC_P3, { 'J', 'O' } }, // Zarqa
+    { 901, TZ_UTC_P3, { 'J', 'O' } }, // Irbid
+    { 907, TZ_UTC_P3, { 'J', 'O' } }, // Aqaba
+    { 913, TZ_UTC_P3, { 'J', 'O' } }, // Salt
+    // Lebanon
+    { 918, TZ_LEBANON, { 'L', 'B' } }, // Beirut
+    { 925, TZ_LEBANON, { 'L', 'B' } }, // Tripoli
+    { 933, TZ_LEBANON, { 'L', 'B' } }, // Sidon
+    { 939, TZ_LEBANON, { 'L', 'B' } }, // Tyre
+    // Syria
+    { 944, TZ_UTC_P3, { 'S', 'Y' } }, // Damascus
+    { 953, TZ_UTC_P3, { 'S', 'Y' } }, // Aleppo
+    { 960, TZ_UTC_P3, { 'S', 'Y' } }, // Homs
+    { 965, TZ_UTC_P3, { 'S', 'Y' } }, // Latakia
+    // Palestine/Israel
+    { 973, TZ_PALESTINE, { 'P', 'S' } }, // Jerusalem
+    { 983, TZ_PALESTINE, { 'P', 'S' } }, // Gaza
+    { 988, TZ_ISRAEL, { 'I', 'L' } }, // Tel Aviv
+    { 997, TZ_ISRAEL, { 'I', 'L' } }, // Haifa
+    // Kuwait
+    { 1003, TZ_UTC_P3, { 'K', 'W' } }, // Kuwait City
+    { 1015, TZ_UTC_P3, { 'K', 'W' } }, // Ahmadi
+    { 1022, TZ_UTC_P3, { 'K', 'W' } }, // Hawalli
+    // Qatar
+    { 1030, TZ_UTC_P3, { 'Q', 'A' } }, // Doha
+    { 1035, TZ_UTC_P3, { 'Q', 'A' } }, // Al Rayyan
+    { 1045, TZ_UTC_P3, { 'Q', 'A' } }, // Umm Salal
+    // Bahrain
+    { 1055, TZ_UTC_P3, { 'B', 'H' } }, // Manama
+    { 1062, TZ_UTC_P3, { 'B', 'H' } }, // Riffa
+    { 1068, TZ_UTC_P3, { 'B', 'H' } }, // Muharraq
+    // Oman
+    { 1077, TZ_UTC_P4, { 'O', 'M' } }, // Muscat
+    { 1084, TZ_UTC_P4, { 'O', 'M' } }, // Salalah
+    { 1092, TZ_UTC_P4, { 'O', 'M' } }, // Sohar
+    // Yemen
+    { 1098, TZ_UTC_P3, { 'Y', 'E' } }, // Sanaa
+    { 1104, TZ_UTC_P3, { 'Y', 'E' } }, // Aden
+    { 1109, TZ_UTC_P3, { 'Y', 'E' } }, // Taiz
+    // Morocco
+    { 1114, TZ_UTC_P1, { 'M', 'A' } }, // Casablanca
+    { 1125, TZ_UTC_P1, { 'M', 'A' } }, // Rabat
+    { 1131, TZ_UTC_P1, { 'M', 'A' } }, // Fez
+    { 1135, TZ_UTC_P1, { 'M', 'A' } }, // Marrakech
+    { 1145, TZ_UTC_P1, { 'M', 'A' } }, // Agadir
+    { 1152, TZ_UTC_P1, { 'M', 'A' } }, // Tangier
+    { 1160, TZ_UTC_P1, { 'M', 'A' } }, // Meknes
+    { 1167, TZ_UTC_P1, { 'M', 'A' } }, // Oujda
+    { 1173, TZ_UTC_P1, { 'M', 'A' } }, // Kenitra
+    { 1181, TZ_UTC_P1, { 'M', 'A' } }, // Tetouan
+    { 1189, TZ_UTC_P1, { 'M', 'A' } }, // Safi
+    { 1194, TZ_UTC_P1, { 'M', 'A' } }, // Mohammedia
+    { 1205, TZ_UTC_P1, { 'M', 'A' } }, // Khouribga
+    { 1215, TZ_UTC_P1, { 'M', 'A' } }, // El Jadida
+    { 1225, TZ_UTC_P1, { 'M', 'A' } }, // Beni Mellal
+    { 1237, TZ_UTC_P1, { 'M', 'A' } }, // Nador
+    { 1243, TZ_UTC_P1, { 'M', 'A' } }, // Taza
+    { 1248, TZ_UTC_P1, { 'M', 'A' } }, // Settat
+    { 1255, TZ_UTC_P1, { 'M', 'A' } }, // Larache
+    { 1263, TZ_UTC_P1, { 'M', 'A' } }, // Ksar El Kebir
+    { 1277, TZ_UTC_P1, { 'M', 'A' } }, // Khemisset
+    { 1287, TZ_UTC_P1, { 'M', 'A' } }, // Guelmim
+    { 1295, TZ_UTC_P1, { 'M', 'A' } }, // Berkane
+    { 1303, TZ_UTC_P1, { 'M', 'A' } }, // Taourirt
+    { 1312, TZ_UTC_P1, { 'M', 'A' } }, // Errachidia
+    { 1323, TZ_UTC_P1, { 'M', 'A' } }, // Ouarzazate
+    { 1334, TZ_UTC_P1, { 'M', 'A' } }, // Tiznit
+    { 1341, TZ_UTC_P1, { 'M', 'A' } }, // Al Hoceima
+    { 1352, TZ_UTC_P1, { 'M', 'A' } }, // Taroudannt
+    { 1363, TZ_UTC_P1, { 'M', 'A' } }, // Essaouira
+    // Algeria
+    { 1373, TZ_UTC_P1, { 'D', 'Z' } }, // Algiers
+    { 1381, TZ_UTC_P1, { 'D', 'Z' } }, // Oran
+    { 1386, TZ_UTC_P1, { 'D', 'Z' } }, // Constantine
+    { 1398, TZ_UTC_P1, { 'D', 'Z' } }, // Annaba
+    { 1405, TZ_UTC_P1, { 'D', 'Z' } }, // Blida
+    { 1411, TZ_UTC_P1, { 'D', 'Z' } }, // Batna
+    { 1417, TZ_UTC_P1, { 'D', 'Z' } }, // Djelfa
+    { 1424, TZ_UTC_P1, { 'D', 'Z' } }, // Setif
+    { 1430, TZ_UTC_P1, { 'D', 'Z' } }, // Sidi Bel Abbes
+    { 1445, TZ_UTC_P1, { 'D', 'Z' } }, // Biskra
+    { 1452, TZ_UTC_P1, { 'D', 'Z' } }, // Tebessa
+    { 1460, TZ_UTC_P1, { 'D', 'Z' } }, // El Oued
+    { 1468, TZ_UTC_P1, { 'D', 'Z' } }, // Skikda
+    { 1475, TZ_UTC_P1, { 'D', 'Z' } }, // Tiaret
+    { 1482, TZ_UTC_P1, { 'D', 'Z' } }, // Bejaïa
+    { 1490, TZ_UTC_P1, { 'D', 'Z' } }, // Tlemcen
+    { 1498, TZ_UTC_P1, { 'D', 'Z' } }, // Ouargla
+    { 1506, TZ_UTC_P1, { 'D', 'Z' } }, // Bechar
+    { 1513, TZ_UTC_P1, { 'D', 'Z' } }, // Mostaganem
+    { 1524, TZ_UTC_P1, { 'D', 'Z' } }, // Bordj Bou Arréridj
+    { 1544, TZ_UTC_P1, { 'D', 'Z' } }, // Chlef
+    { 1550, TZ_UTC_P1, { 'D', 'Z' } }, // Souk Ahras
+    { 1561, TZ_UTC_P1, { 'D', 'Z' } }, // El Tarf
+    { 1569, TZ_UTC_P1, { 'D', 'Z' } }, // Jijel
+    { 1575, TZ_UTC_P1, { 'D', 'Z' } }, // Relizane
+    { 1584, TZ_UTC_P1, { 'D', 'Z' } }, // Mascara
+    { 1592, TZ_UTC_P1, { 'D', 'Z' } }, // Ouled Djellal
+    { 1606, TZ_UTC_P1, { 'D', 'Z' } }, // Bou Saada
+    // Tunisia
+    { 1616, TZ_UTC_P1, { 'T', 'N' } }, // Tunis
+    { 1622, TZ_UTC_P1, { 'T', 'N' } }, // Sfax
+    { 1627, TZ_UTC_P1, { 'T', 'N' } }, // Sousse
+    { 1634, TZ_UTC_P1, { 'T', 'N' } }, // Kairouan
+    { 1643, TZ_UTC_P1, { 'T', 'N' } }, // Ettadhamen
+    { 1654, TZ_UTC_P1, { 'T', 'N' } }, // Bizerte
+    { 1662, TZ_UTC_P1, { 'T', 'N' } }, // Gabès
+    { 1669, TZ_UTC_P1, { 'T', 'N' } }, // Ariana
+    { 1676, TZ_UTC_P1, { 'T', 'N' } }, // Gafsa
+    { 1682, TZ_UTC_P1, { 'T', 'N' } }, // Kasserine
+    { 1692, TZ_UTC_P1, { 'T', 'N' } }, // Monastir
+    { 1701, TZ_UTC_P1, { 'T', 'N' } }, // Ben Arous
+    { 1711, TZ_UTC_P1, { 'T', 'N' } }, // Temara
+    { 1718, TZ_UTC_P1, { 'T', 'N' } }, // Mahdia
+    { 1725, TZ_UTC_P1, { 'T', 'N' } }, // El Kef
+    { 1732, TZ_UTC_P1, { 'T', 'N' } }, // Medenine
+    { 1741, TZ_UTC_P1, { 'T', 'N' } }, // Nabeul
+    { 1748, TZ_UTC_P1, { 'T', 'N' } }, // Tataouine
+    { 1758, TZ_UTC_P1, { 'T', 'N' } }, // Beja
+    { 1763, TZ_UTC_P1, { 'T', 'N' } }, // Jendouba
+    { 1772, TZ_UTC_P1, { 'T', 'N' } }, // Zaghouan
+    { 1781, TZ_UTC_P1, { 'T', 'N' } }, // Siliana
+    { 1789, TZ_UTC_P1, { 'T', 'N' } }, // Sidi Bouzid
+    // Libya
+    { 925, TZ_UTC_P2, { 'L', 'Y' } }, // Tripoli
+    { 1801, TZ_UTC_P2, { 'L', 'Y' } }, // Benghazi
+    { 1810, TZ_UTC_P2, { 'L', 'Y' } }, // Misrata
+    { 1818, TZ_UTC_P2, { 'L', 'Y' } }, // Bayda
+    { 1824, TZ_UTC_P2, { 'L', 'Y' } }, // Sabha
+    { 1830, TZ_UTC_P2, { 'L', 'Y' } }, // Zawiya
+    { 1837, TZ_UTC_P2, { 'L', 'Y' } }, // Zliten
+    { 1844, TZ_UTC_P2, { 'L', 'Y' } }, // Ajdabiya
+    { 1853, TZ_UTC_P2, { 'L', 'Y' } }, // Tobruk
+    { 1860, TZ_UTC_P2, { 'L', 'Y' } }, // Sirte
+    { 1866, TZ_UTC_P2, { 'L', 'Y' } }, // Al Khums
+    { 1875, TZ_UTC_P2, { 'L', 'Y' } }, // Marj
+    { 1880, TZ_UTC_P2, { 'L', 'Y' } }, // Gharyan
+    { 1888, TZ_UTC_P2, { 'L', 'Y' } }, // Derna
+    { 1894, TZ_UTC_P2, { 'L', 'Y' } }, // Murzuq
+    { 1901, TZ_UTC_P2, { 'L', 'Y' } }, // Ghat
+    { 1906, TZ_UTC_P2, { 'L', 'Y' } }, // Waddan
+    // Sudan
+    { 1913, TZ_UTC_P2, { 'S', 'D' } }, // Khartoum
+    { 1922, TZ_UTC_P2, { 'S', 'D' } }, // Omdurman
+    { 1931, TZ_UTC_P2, { 'S', 'D' } }, // Port Sudan
+    // Pakistan
+    { 1942, TZ_UTC_P5, { 'P', 'K' } }, // Karachi
+    { 1950, TZ_UTC_P5, { 'P', 'K' } }, // Lahore
+    { 1957, TZ_UTC_P5, { 'P', 'K' } }, // Islamabad
+    { 1967, TZ_UTC_P5, { 'P', 'K' } }, // Faisalabad
+    { 1978, TZ_UTC_P5, { 'P', 'K' } }, // Rawalpindi
+    { 1989, TZ_UTC_P5, { 'P', 'K' } }, // Multan
+    { 1996, TZ_UTC_P5, { 'P', 'K' } }, // Hyderabad
+    { 2006, TZ_UTC_P5, { 'P', 'K' } }, // Gujranwala
+    { 2017, TZ_UTC_P5, { 'P', 'K' } }, // Peshawar
+    { 2026, TZ_UTC_P5, { 'P', 'K' } }, // Quetta
+    // India
+    { 2033, TZ_UTC_P5_30, { 'I', 'N' } }, // New Delhi
+    { 2290, TZ_UTC_P5_30, { 'I', 'N' } }, // Mumbai
+    { 2043, TZ_UTC_P5_30, { 'I', 'N' } }, // Kolkata
+    { 2051, TZ_UTC_P5_30, { 'I', 'N' } }, // Chennai
+    { 2059, TZ_UTC_P5_30, { 'I', 'N' } }, // Bangalore
+    { 1996, TZ_UTC_P5_30, { 'I', 'N' } }, // Hyderabad
+    { 2069, TZ_UTC_P5_30, { 'I', 'N' } }, // Ahmedabad
+    { 2079, TZ_UTC_P5_30, { 'I', 'N' } }, // Pune
+    { 2084, TZ_UTC_P5_30, { 'I', 'N' } }, // Surat
+    { 2090, TZ_UTC_P5_30, { 'I', 'N' } }, // Jaipur
+    { 2097, TZ_UTC_P5_30, { 'I', 'N' } }, // Lucknow
+    { 2105, TZ_UTC_P5_30, { 'I', 'N' } }, // Kanpur
+    { 2112, TZ_UTC_P5_30, { 'I', 'N' } }, // Nagpur
+    { 2119, TZ_UTC_P5_30, { 'I', 'N' } }, // Indore
+    { 2126, TZ_UTC_P5_30, { 'I', 'N' } }, // Bhopal
+    { 2133, TZ_UTC_P5_30, { 'I', 'N' } }, // Visakhapatnam
+    { 2147, TZ_UTC_P5_30, { 'I', 'N' } }, // Patna
+    { 2153, TZ_UTC_P5_30, { 'I', 'N' } }, // Vadodara
+    { 2162, TZ_UTC_P5_30, { 'I', 'N' } }, // Ghaziabad
+    { 2172, TZ_UTC_P5_30, { 'I', 'N' } }, // Ludhiana
+    { 2181, TZ_UTC_P5_30, { 'I', 'N' } }, // Agra
+    { 2186, TZ_UTC_P5_30, { 'I', 'N' } }, // Nashville
+    { 2196, TZ_UTC_P5_30, { 'I', 'N' } }, // Faridabad
+    { 2206, TZ_UTC_P5_30, { 'I', 'N' } }, // Meerut
+    { 2213, TZ_UTC_P5_30, { 'I', 'N' } }, // Rajkot
+    { 2220, TZ_UTC_P5_30, { 'I', 'N' } }, // Kalyan
+    { 2227, TZ_UTC_P5_30, { 'I', 'N' } }, // Vasai-Virar
+    { 2239, TZ_UTC_P5_30, { 'I', 'N' } }, // Varanasi
+    { 2248, TZ_UTC_P5_30, { 'I', 'N' } }, // Srinagar
+    { 2257, TZ_UTC_P5_30, { 'I', 'N' } }, // Aurangabad
+    { 2268, TZ_UTC_P5_30, { 'I', 'N' } }, // Dhanbad
+    { 2276, TZ_UTC_P5_30, { 'I', 'N' } }, // Amritsar
+    { 2285, TZ_UTC_P5_30, { 'I', 'N' } }, // Navi Mumbai
+    { 2297, TZ_UTC_P5_30, { 'I', 'N' } }, // Allahabad
+    { 2307, TZ_UTC_P5_30, { 'I', 'N' } }, // Ranchi
+    { 2314, TZ_UTC_P5_30, { 'I', 'N' } }, // Howrah
+    { 2321, TZ_UTC_P5_30, { 'I', 'N' } }, // Coimbatore
+    { 2332, TZ_UTC_P5_30, { 'I', 'N' } }, // Jabalpur
+    { 2341, TZ_UTC_P5_30, { 'I', 'N' } }, // Gwalior
+    { 2349, TZ_UTC_P5_30, { 'I', 'N' } }, // Vijayawada
+    { 2360, TZ_UTC_P5_30, { 'I', 'N' } }, // Jodhpur
+    { 2368, TZ_UTC_P5_30, { 'I', 'N' } }, // Madurai
+    { 2376, TZ_UTC_P5_30, { 'I', 'N' } }, // Raipur
+    { 2383, TZ_UTC_P5_30, { 'I', 'N' } }, // Kota
+    { 2388, TZ_UTC_P5_30, { 'I', 'N' } }, // Guwahati
+    { 2397, TZ_UTC_P5_30, { 'I', 'N' } }, // Chandigarh
+    { 2408, TZ_UTC_P5_30, { 'I', 'N' } }, // Solapur
+    { 2416, TZ_UTC_P5_30, { 'I', 'N' } }, // Hubli-Dharwad
+    { 2430, TZ_UTC_P5_30, { 'I', 'N' } }, // Bareilly
+    { 2439, TZ_UTC_P5_30, { 'I', 'N' } }, // Moradabad
+    { 2449, TZ_UTC_P5_30, { 'I', 'N' } }, // Mysore
+    { 2456, TZ_UTC_P5_30, { 'I', 'N' } }, // Gurgaon
+    { 2464, TZ_UTC_P5_30, { 'I', 'N' } }, // Aligarh
+    { 2472, TZ_UTC_P5_30, { 'I', 'N' } }, // Jalandhar
+    { 2482, TZ_UTC_P5_30, { 'I', 'N' } }, // Tiruchirappalli
+    { 2498, TZ_UTC_P5_30, { 'I', 'N' } }, // Bhubaneswar
+    { 2510, TZ_UTC_P5_30, { 'I', 'N' } }, // Salem
+    { 2516, TZ_UTC_P5_30, { 'I', 'N' } }, // Warangal
+    { 2525, TZ_UTC_P5_30, { 'I', 'N' } }, // Mira-Bhayandar
+    { 2540, TZ_UTC_P5_30, { 'I', 'N' } }, // Thiruvananthapuram
+    { 2559, TZ_UTC_P5_30, { 'I', 'N' } }, // Bhiwandi
+    { 2568, TZ_UTC_P5_30, { 'I', 'N' } }, // Saharanpur
+    { 2579, TZ_UTC_P5_30, { 'I', 'N' } }, // Guntur
+    { 2586, TZ_UTC_P5_30, { 'I', 'N' } }, // Amravati
+    { 2595, TZ_UTC_P5_30, { 'I', 'N' } }, // Bikaner
+    { 2603, TZ_UTC_P5_30, { 'I', 'N' } }, // Noida
+    { 2609, TZ_UTC_P5_30, { 'I', 'N' } }, // Jamshedpur
+    { 2620, TZ_UTC_P5_30, { 'I', 'N' } }, // Bhilai Nagar
+    { 2633, TZ_UTC_P5_30, { 'I', 'N' } }, // Cuttack
+    // Bangladesh
+    { 2641, TZ_UTC_P6, { 'B', 'D' } }, // Dhaka
+    { 2647, TZ_UTC_P6, { 'B', 'D' } }, // Chittagong
+    { 2658, TZ_UTC_P6, { 'B', 'D' } }, // Sylhet
+    { 2665, TZ_UTC_P6, { 'B', 'D' } }, // Rajshahi
+    { 2674, TZ_UTC_P6, { 'B', 'D' } }, // Khulna
+    { 2681, TZ_UTC_P6, { 'B', 'D' } }, // Barisal
+    // Afghanistan
+    { 2689, TZ_UTC_P4_30, { 'A', 'F' } }, // Kabul
+    { 2695, TZ_UTC_P4_30, { 'A', 'F' } }, // Kandahar
+    { 2704, TZ_UTC_P4_30, { 'A', 'F' } }, // Herat
+    { 2710, TZ_UTC_P4_30, { 'A', 'F' } }, // Mazar-i-Sharif
+    { 2725, TZ_UTC_P4_30, { 'A', 'F' } }, // Jalalabad
+    { 2735, TZ_UTC_P4_30, { 'A', 'F' } }, // Kunduz
+    { 2742, TZ_UTC_P4_30, { 'A', 'F' } }, // Ghazni
+    { 2749, TZ_UTC_P4_30, { 'A', 'F' } }, // Lashkar Gah
+    { 2761, TZ_UTC_P4_30, { 'A', 'F' } }, // Khost
+    { 2767, TZ_UTC_P4_30, { 'A', 'F' } }, // Taloqan
+    { 2775, TZ_UTC_P4_30, { 'A', 'F' } }, // Pul-e-Khumri
+    { 2788, TZ_UTC_P4_30, { 'A', 'F' } }, // Faizabad
+    { 2797, TZ_UTC_P4_30, { 'A', 'F' } }, // Gardez
+    { 2804, TZ_UTC_P4_30, { 'A', 'F' } }, // Bamyan
+    // Indonesia
+    { 2811, TZ_UTC_P7, { 'I', 'D' } }, // Jakarta
+    { 2819, TZ_UTC_P7, { 'I', 'D' } }, // Surabaya
+    { 2828, TZ_UTC_P7, { 'I', 'D' } }, // Bandung
+    { 2836, TZ_UTC_P7, { 'I', 'D' } }, // Medan
+    { 2842, TZ_UTC_P7, { 'I', 'D' } }, // Bekasi
+    { 2849, TZ_UTC_P7, { 'I', 'D' } }, // Tangerang
+    { 2859, TZ_UTC_P7, { 'I', 'D' } }, // Depok
+    { 2865, TZ_UTC_P7, { 'I', 'D' } }, // Semarang
+    { 2874, TZ_UTC_P7, { 'I', 'D' } }, // Palembang
+    { 2884, TZ_UTC_P8, { 'I', 'D' } }, // Makassar
+    { 2893, TZ_UTC_P7, { 'I', 'D' } }, // Yogyakarta
+    { 2904, TZ_UTC_P8, { 'I', 'D' } }, // Denpasar
+    { 2913, TZ_UTC_P7, { 'I', 'D' } }, // Malang
+    { 2920, TZ_UTC_P7, { 'I', 'D' } }, // Bogor
+    { 2926, TZ_UTC_P7, { 'I', 'D' } }, // Batam
+    { 2932, TZ_UTC_P7, { 'I', 'D' } }, // Pekanbaru
+    { 2942, TZ_UTC_P7, { 'I', 'D' } }, // Bandar Lampung
+    { 2957, TZ_UTC_P7, { 'I', 'D' } }, // Padang
+    { 2964, TZ_UTC_P8, { 'I', 'D' } }, // Samarinda
+    { 2974, TZ_UTC_P8, { 'I', 'D' } }, // Balikpapan
+    { 2985, TZ_UTC_P7, { 'I', 'D' } }, // Jambi
+    { 2991, TZ_UTC_P7, { 'I', 'D' } }, // Cimahi
+    { 2998, TZ_UTC_P7, { 'I', 'D' } }, // Surakarta
+    { 3008, TZ_UTC_P8, { 'I', 'D' } }, // Banjarmasin
+    { 3020, TZ_UTC_P8, { 'I', 'D' } }, // Kupang
+    { 3027, TZ_UTC_P7, { 'I', 'D' } }, // Pontianak
+    { 3037, TZ_UTC_P8, { 'I', 'D' } }, // Manado
+    { 3044, TZ_UTC_P9, { 'I', 'D' } }, // Ambon
+    { 3050, TZ_UTC_P9, { 'I', 'D' } }, // Jayapura
+    { 3059, TZ_UTC_P7, { 'I', 'D' } }, // Banda Aceh
+    { 3070, TZ_UTC_P8, { 'I', 'D' } }, // Mataram
+    { 3078, TZ_UTC_P8, { 'I', 'D' } }, // Kendari
+    { 3086, TZ_UTC_P8, { 'I', 'D' } }, // Palu
+    { 3091, TZ_UTC_P9, { 'I', 'D' } }, // Ternate
+    { 3099, TZ_UTC_P7, { 'I', 'D' } }, // Bengkulu
+    { 3108, TZ_UTC_P8, { 'I', 'D' } }, // Gorontalo
+    { 3118, TZ_UTC_P8, { 'I', 'D' } }, // Mamuju
+    { 3125, TZ_UTC_P9, { 'I', 'D' } }, // Sorong
+    // Malaysia
+    { 3132, TZ_UTC_P8, { 'M', 'Y' } }, // Kuala Lumpur
+    { 3145, TZ_UTC_P8, { 'M', 'Y' } }, // George Town
+    { 3157, TZ_UTC_P8, { 'M', 'Y' } }, // Ipoh
+    { 3162, TZ_UTC_P8, { 'M', 'Y' } }, // Shah Alam
+    { 3172, TZ_UTC_P8, { 'M', 'Y' } }, // Petaling Jaya
+    { 3186, TZ_UTC_P8, { 'M', 'Y' } }, // Johor Bahru
+    { 3198, TZ_UTC_P8, { 'M', 'Y' } }, // Kota Kinabalu
+    { 3212, TZ_UTC_P8, { 'M', 'Y' } }, // Kuching
+    { 3220, TZ_UTC_P8, { 'M', 'Y' } }, // Subang Jaya
+    { 3232, TZ_UTC_P8, { 'M', 'Y' } }, // Ampang Jaya
+    { 3244, TZ_UTC_P8, { 'M', 'Y' } }, // Kuantan
+    { 3252, TZ_UTC_P8, { 'M', 'Y' } }, // Alor Setar
+    { 3263, TZ_UTC_P8, { 'M', 'Y' } }, // Sandakan
+    { 3272, TZ_UTC_P8, { 'M', 'Y' } }, // Taiping
+    { 3280, TZ_UTC_P8, { 'M', 'Y' } }, // Sibu
+    { 3285, TZ_UTC_P8, { 'M', 'Y' } }, // Miri
+    { 3290, TZ_UTC_P8, { 'M', 'Y' } }, // Kuala Terengganu
+    { 3307, TZ_UTC_P8, { 'M', 'Y' } }, // Bintulu
+    { 3315, TZ_UTC_P8, { 'M', 'Y' } }, // Kota Bharu
+    { 3326, TZ_UTC_P8, { 'M', 'Y' } }, // Sungai Petani
+    { 3340, TZ_UTC_P8, { 'M', 'Y' } }, // Tawau
+    { 3346, TZ_UTC_P8, { 'M', 'Y' } }, // Kulim
+    { 3352, TZ_UTC_P8, { 'M', 'Y' } }, // Muar
+    { 3357, TZ_UTC_P8, { 'M', 'Y' } }, // Teluk Intan
+    { 3369, TZ_UTC_P8, { 'M', 'Y' } }, // Batu Pahat
+    { 3380, TZ_UTC_P8, { 'M', 'Y' } }, // Kluang
+    { 3387, TZ_UTC_P8, { 'M', 'Y' } }, // Port Dickson
+    { 3400, TZ_UTC_P8, { 'M', 'Y' } }, // Pasir Gudang
+    { 3413, TZ_UTC_P8, { 'M', 'Y' } }, // Nilai
+    { 3419, TZ_UTC_P8, { 'M', 'Y' } }, // Rawang
+    { 3426, TZ_UTC_P8, { 'M', 'Y' } }, // Segamat
+    { 3434, TZ_UTC_P8, { 'M', 'Y' } }, // Temerloh
+    { 3443, TZ_UTC_P8, { 'M', 'Y' } }, // Bentong
+    { 3451, TZ_UTC_P8, { 'M', 'Y' } }, // Bagan Serai
+    { 3463, TZ_UTC_P8, { 'M', 'Y' } }, // Raub
+    { 3468, TZ_UTC_P8, { 'M', 'Y' } }, // Bukit Mertajam
+    { 3483, TZ_UTC_P8, { 'M', 'Y' } }, // Lumut
+    { 3489, TZ_UTC_P8, { 'M', 'Y' } }, // Klang
+    { 3495, TZ_UTC_P8, { 'M', 'Y' } }, // Kajang
+    { 3502, TZ_UTC_P8, { 'M', 'Y' } }, // Seremban
+    { 3511, TZ_UTC_P8, { 'M', 'Y' } }, // Malacca
+    { 3519, TZ_UTC_P8, { 'M', 'Y' } }, // Kuala Selangor
+    { 3534, TZ_UTC_P8, { 'M', 'Y' } }, // Kepala Batas
+    // Singapore
+    { 3547, TZ_UTC_P8, { 'S', 'G' } }, // Singapore
+    // Brunei
+    { 3557, TZ_UTC_P8, { 'B', 'N' } }, // Bandar Seri Begawan
+    // Thailand
+    { 3577, TZ_UTC_P7, { 'T', 'H' } }, // Bangkok
+    { 3585, TZ_UTC_P7, { 'T', 'H' } }, // Chiang Mai
+    { 3596, TZ_UTC_P7, { 'T', 'H' } }, // Phuket
+    { 3603, TZ_UTC_P7, { 'T', 'H' } }, // Pattaya
+    { 3611, TZ_UTC_P7, { 'T', 'H' } }, // Hat Yai
+    { 3619, TZ_UTC_P7, { 'T', 'H' } }, // Nakhon Ratchasima
+    { 3637, TZ_UTC_P7, { 'T', 'H' } }, // Khon Kaen
+    { 3647, TZ_UTC_P7, { 'T', 'H' } }, // Udon Thani
+    { 3658, TZ_UTC_P7, { 'T', 'H' } }, // Chiang Rai
+    { 3669, TZ_UTC_P7, { 'T', 'H' } }, // Rayong
+    { 3676, TZ_UTC_P7, { 'T', 'H' } }, // Pitsanulok
+    { 3687, TZ_UTC_P7, { 'T', 'H' } }, // Lampang
+    { 3695, TZ_UTC_P7, { 'T', 'H' } }, // Nakhon Si Thammarat
+    { 3715, TZ_UTC_P7, { 'T', 'H' } }, // Ubon Ratchathani
+    { 3732, TZ_UTC_P7, { 'T', 'H' } }, // Songkhla
+    { 3741, TZ_UTC_P7, { 'T', 'H' } }, // Nonthaburi
+    { 3752, TZ_UTC_P7, { 'T', 'H' } }, // Pak Kret
+    { 3761, TZ_UTC_P7, { 'T', 'H' } }, // Si Racha
+    { 4456, TZ_UTC_P7, { 'T', 'H' } }, // Trang
+    { 3770, TZ_UTC_P7, { 'T', 'H' } }, // Krabi
+    { 3776, TZ_UTC_P7, { 'T', 'H' } }, // Hua Hin
+    { 3784, TZ_UTC_P7, { 'T', 'H' } }, // Saraburi
+    { 3793, TZ_UTC_P7, { 'T', 'H' } }, // Surin
+    { 3799, TZ_UTC_P7, { 'T', 'H' } }, // Surat Thani
+    { 3811, TZ_UTC_P7, { 'T', 'H' } }, // Nakhon Pathom
+    { 3825, TZ_UTC_P7, { 'T', 'H' } }, // Ratchaburi
+    { 3836, TZ_UTC_P7, { 'T', 'H' } }, // Phetchabun
+    { 3847, TZ_UTC_P7, { 'T', 'H' } }, // Samut Prakan
+    { 3860, TZ_UTC_P7, { 'T', 'H' } }, // Chon Buri
+    { 3870, TZ_UTC_P7, { 'T', 'H' } }, // Nakhon Nayok
+    { 3883, TZ_UTC_P7, { 'T', 'H' } }, // Kanchanaburi
+    { 3896, TZ_UTC_P7, { 'T', 'H' } }, // Mae Sot
+    { 3904, TZ_UTC_P7, { 'T', 'H' } }, // Phrae
+    { 3910, TZ_UTC_P7, { 'T', 'H' } }, // Nan
+    { 3914, TZ_UTC_P7, { 'T', 'H' } }, // Phayao
+    { 3921, TZ_UTC_P7, { 'T', 'H' } }, // Sukhothai
+    { 3931, TZ_UTC_P7, { 'T', 'H' } }, // Uttaradit
+    { 3941, TZ_UTC_P7, { 'T', 'H' } }, // Tak
+    { 3945, TZ_UTC_P7, { 'T', 'H' } }, // Phitsanulok
+    { 3957, TZ_UTC_P7, { 'T', 'H' } }, // Lop Buri
+    { 3966, TZ_UTC_P7, { 'T', 'H' } }, // Ayutthaya
+    // Philippines
+    { 3976, TZ_UTC_P8, { 'P', 'H' } }, // Manila
+    { 3983, TZ_UTC_P8, { 'P', 'H' } }, // Quezon City
+    { 3995, TZ_UTC_P8, { 'P', 'H' } }, // Davao
+    { 4001, TZ_UTC_P8, { 'P', 'H' } }, // Cebu
+    { 4006, TZ_UTC_P8, { 'P', 'H' } }, // Caloocan
+    { 4015, TZ_UTC_P8, { 'P', 'H' } }, // Zamboanga City
+    { 4030, TZ_UTC_P8, { 'P', 'H' } }, // Taguig
+    { 4037, TZ_UTC_P8, { 'P', 'H' } }, // Antipolo
+    { 4046, TZ_UTC_P8, { 'P', 'H' } }, // Pasig
+    { 4052, TZ_UTC_P8, { 'P', 'H' } }, // Cagayan de Oro
+    { 4067, TZ_UTC_P8, { 'P', 'H' } }, // Paranaque
+    { 4077, TZ_UTC_P8, { 'P', 'H' } }, // Dasmarinas
+    { 4088, TZ_UTC_P8, { 'P', 'H' } }, // Valenzuela
+    { 4099, TZ_UTC_P8, { 'P', 'H' } }, // Bacoor
+    { 4106, TZ_UTC_P8, { 'P', 'H' } }, // General Santos
+    { 4121, TZ_UTC_P8, { 'P', 'H' } }, // Las Pinas
+    { 4131, TZ_UTC_P8, { 'P', 'H' } }, // Makati
+    { 4138, TZ_UTC_P8, { 'P', 'H' } }, // Marikina
+    { 4147, TZ_UTC_P8, { 'P', 'H' } }, // Muntinlupa
+    { 4158, TZ_UTC_P8, { 'P', 'H' } }, // Mandaluyong
+    { 4170, TZ_UTC_P8, { 'P', 'H' } }, // Bacolod
+    { 4178, TZ_UTC_P8, { 'P', 'H' } }, // San Jose del Monte
+    { 4197, TZ_UTC_P8, { 'P', 'H' } }, // Iligan
+    { 4138, TZ_UTC_P8, { 'P', 'H' } }, // Marikina
+    { 4204, TZ_UTC_P8, { 'P', 'H' } }, // Malabon
+    { 4212, TZ_UTC_P8, { 'P', 'H' } }, // Navotas
+    { 12089, TZ_UTC_P8, { 'P', 'H' } }, // Angeles
+    { 4220, TZ_UTC_P8, { 'P', 'H' } }, // Iloilo
+    { 4227, TZ_UTC_P8, { 'P', 'H' } }, // Butuan
+    { 4234, TZ_UTC_P8, { 'P', 'H' } }, // Tarlac
+    { 4241, TZ_UTC_P8, { 'P', 'H' } }, // Olongapo
+    { 4250, TZ_UTC_P8, { 'P', 'H' } }, // Cabanatuan
+    { 4261, TZ_UTC_P8, { 'P', 'H' } }, // San Fernando
+    { 4274, TZ_UTC_P8, { 'P', 'H' } }, // Laoag
+    { 4280, TZ_UTC_P8, { 'P', 'H' } }, // Baguio
+    { 4287, TZ_UTC_P8, { 'P', 'H' } }, // Legazpi
+    { 4295, TZ_UTC_P8, { 'P', 'H' } }, // Tacloban
+    { 4304, TZ_UTC_P8, { 'P', 'H' } }, // Naga
+    { 4309, TZ_UTC_P8, { 'P', 'H' } }, // Dagupan
+    { 4317, TZ_UTC_P8, { 'P', 'H' } }, // Malolos
+    { 4325, TZ_UTC_P8, { 'P', 'H' } }, // San Pablo
+    { 4335, TZ_UTC_P8, { 'P', 'H' } }, // Batangas City
+    { 4349, TZ_UTC_P8, { 'P', 'H' } }, // Lucena
+    { 4356, TZ_UTC_P8, { 'P', 'H' } }, // Imus
+    { 4361, TZ_UTC_P8, { 'P', 'H' } }, // General Trias
+    { 4375, TZ_UTC_P8, { 'P', 'H' } }, // Trece Martires
+    // Vietnam
+    { 4390, TZ_UTC_P7, { 'V', 'N' } }, // Ho Chi Minh City
+    { 4407, TZ_UTC_P7, { 'V', 'N' } }, // Hanoi
+    { 4413, TZ_UTC_P7, { 'V', 'N' } }, // Da Nang
+    { 4421, TZ_UTC_P7, { 'V', 'N' } }, // Hai Phong
+    { 4431, TZ_UTC_P7, { 'V', 'N' } }, // Can Tho
+    { 4439, TZ_UTC_P7, { 'V', 'N' } }, // Bien Hoa
+    { 4448, TZ_UTC_P7, { 'V', 'N' } }, // Hue
+    { 4452, TZ_UTC_P7, { 'V', 'N' } }, // Nha Trang
+    { 4462, TZ_UTC_P7, { 'V', 'N' } }, // Buon Ma Thuot
+    { 4476, TZ_UTC_P7, { 'V', 'N' } }, // Quy Nhon
+    { 4485, TZ_UTC_P7, { 'V', 'N' } }, // Vung Tau
+    { 4494, TZ_UTC_P7, { 'V', 'N' } }, // Nam Dinh
+    { 4503, TZ_UTC_P7, { 'V', 'N' } }, // Phan Thiet
+    { 4514, TZ_UTC_P7, { 'V', 'N' } }, // Long Xuyen
+    { 4525, TZ_UTC_P7, { 'V', 'N' } }, // Thai Nguyen
+    { 4537, TZ_UTC_P7, { 'V', 'N' } }, // Thanh Hoa
+    { 4547, TZ_UTC_P7, { 'V', 'N' } }, // Rach Gia
+    { 4556, TZ_UTC_P7, { 'V', 'N' } }, // Cam Ranh
+    { 4732, TZ_UTC_P7, { 'V', 'N' } }, // Vinh
+    { 4565, TZ_UTC_P7, { 'V', 'N' } }, // My Tho
+    { 4572, TZ_UTC_P7, { 'V', 'N' } }, // Da Lat
+    { 4579, TZ_UTC_P7, { 'V', 'N' } }, // Cao Lanh
+    { 4588, TZ_UTC_P7, { 'V', 'N' } }, // Pleiku
+    { 4595, TZ_UTC_P7, { 'V', 'N' } }, // Kontum
+    { 4602, TZ_UTC_P7, { 'V', 'N' } }, // Dong Hoi
+    { 4611, TZ_UTC_P7, { 'V', 'N' } }, // Tam Ky
+    { 4618, TZ_UTC_P7, { 'V', 'N' } }, // Vi Thanh
+    { 4627, TZ_UTC_P7, { 'V', 'N' } }, // Phu Ly
+    { 4634, TZ_UTC_P7, { 'V', 'N' } }, // Uong Bi
+    { 4642, TZ_UTC_P7, { 'V', 'N' } }, // Bac Lieu
+    { 4651, TZ_UTC_P7, { 'V', 'N' } }, // Nghi Son
+    { 4660, TZ_UTC_P7, { 'V', 'N' } }, // Soc Trang
+    { 4670, TZ_UTC_P7, { 'V', 'N' } }, // Kon Tum
+    { 4678, TZ_UTC_P7, { 'V', 'N' } }, // Ha Tinh
+    { 4686, TZ_UTC_P7, { 'V', 'N' } }, // Bac Giang
+    { 4696, TZ_UTC_P7, { 'V', 'N' } }, // Viet Tri
+    { 4705, TZ_UTC_P7, { 'V', 'N' } }, // Ben Tre
+    { 4713, TZ_UTC_P7, { 'V', 'N' } }, // Bac Kan
+    { 4721, TZ_UTC_P7, { 'V', 'N' } }, // Ca Mau
+    { 4728, TZ_UTC_P7, { 'V', 'N' } }, // Tra Vinh
+    // China
+    { 4737, TZ_UTC_P8, { 'C', 'N' } }, // Beijing
+    { 4745, TZ_UTC_P8, { 'C', 'N' } }, // Shanghai
+    { 4754, TZ_UTC_P8, { 'C', 'N' } }, // Guangzhou
+    { 4764, TZ_UTC_P8, { 'C', 'N' } }, // Shenzhen
+    { 4773, TZ_UTC_P8, { 'C', 'N' } }, // Chengdu
+    { 4781, TZ_UTC_P8, { 'C', 'N' } }, // Tianjin
+    { 4789, TZ_UTC_P8, { 'C', 'N' } }, // Wuhan
+    { 4795, TZ_UTC_P8, { 'C', 'N' } }, // Xi'an
+    { 4801, TZ_UTC_P8, { 'C', 'N' } }, // Hangzhou
+    { 4810, TZ_UTC_P8, { 'C', 'N' } }, // Nanjing
+    { 4818, TZ_UTC_P8, { 'C', 'N' } }, // Chongqing
+    { 4828, TZ_UTC_P8, { 'C', 'N' } }, // Qingdao
+    { 4836, TZ_UTC_P8, { 'C', 'N' } }, // Dalian
+    { 4843, TZ_UTC_P8, { 'C', 'N' } }, // Urumqi
+    { 4850, TZ_UTC_P8, { 'C', 'N' } }, // Dongguan
+    { 4859, TZ_UTC_P8, { 'C', 'N' } }, // Foshan
+    { 4866, TZ_UTC_P8, { 'C', 'N' } }, // Shenyang
+    { 4875, TZ_UTC_P8, { 'C', 'N' } }, // Harbin
+    { 4882, TZ_UTC_P8, { 'C', 'N' } }, // Suzhou
+    { 4889, TZ_UTC_P8, { 'C', 'N' } }, // Zhengzhou
+    { 4899, TZ_UTC_P8, { 'C', 'N' } }, // Jinan
+    { 4905, TZ_UTC_P8, { 'C', 'N' } }, // Changsha
+    { 4914, TZ_UTC_P8, { 'C', 'N' } }, // Kunming
+    { 4922, TZ_UTC_P8, { 'C', 'N' } }, // Taiyuan
+    { 4930, TZ_UTC_P8, { 'C', 'N' } }, // Xiamen
+    { 4937, TZ_UTC_P8, { 'C', 'N' } }, // Hefei
+    { 4943, TZ_UTC_P8, { 'C', 'N' } }, // Shijiazhuang
+    { 4956, TZ_UTC_P8, { 'C', 'N' } }, // Changchun
+    { 4966, TZ_UTC_P8, { 'C', 'N' } }, // Wenzhou
+    { 4974, TZ_UTC_P8, { 'C', 'N' } }, // Ningbo
+    { 4981, TZ_UTC_P8, { 'C', 'N' } }, // Wuxi
+    { 4986, TZ_UTC_P8, { 'C', 'N' } }, // Lanzhou
+    { 4994, TZ_UTC_P8, { 'C', 'N' } }, // Nanchang
+    { 5003, TZ_UTC_P8, { 'C', 'N' } }, // Fuzhou
+    { 5010, TZ_UTC_P8, { 'C', 'N' } }, // Nanning
+    { 5018, TZ_UTC_P8, { 'C', 'N' } }, // Guiyang
+    { 5026, TZ_UTC_P8, { 'C', 'N' } }, // Tangshan
+    { 5035, TZ_UTC_P8, { 'C', 'N' } }, // Baotou
+    { 5042, TZ_UTC_P8, { 'C', 'N' } }, // Zibo
+    { 5047, TZ_UTC_P8, { 'C', 'N' } }, // Yantai
+    { 5054, TZ_UTC_P8, { 'C', 'N' } }, // Weifang
+    { 5062, TZ_UTC_P8, { 'C', 'N' } }, // Hohhot
+    { 5069, TZ_UTC_P8, { 'C', 'N' } }, // Handan
+    { 5076, TZ_UTC_P8, { 'C', 'N' } }, // Zhuhai
+    { 5083, TZ_UTC_P8, { 'C', 'N' } }, // Jining
+    { 5090, TZ_UTC_P8, { 'C', 'N' } }, // Luoyang
+    { 5098, TZ_UTC_P8, { 'C', 'N' } }, // Baoding
+    { 5106, TZ_UTC_P8, { 'C', 'N' } }, // Anshan
+    { 5113, TZ_UTC_P8, { 'C', 'N' } }, // Xuzhou
+    { 5120, TZ_UTC_P8, { 'C', 'N' } }, // Shaoxing
+    { 5129, TZ_UTC_P8, { 'C', 'N' } }, // Jinhua
+    { 5136, TZ_UTC_P8, { 'C', 'N' } }, // Liuzhou
+    { 5144, TZ_UTC_P8, { 'C', 'N' } }, // Yangzhou
+    { 5153, TZ_UTC_P8, { 'C', 'N' } }, // Xining
+    { 5160, TZ_UTC_P8, { 'C', 'N' } }, // Yinchuan
+    { 5169, TZ_UTC_P8, { 'C', 'N' } }, // Lhasa
+    // Kazakhstan
+    { 5175, TZ_UTC_P5, { 'K', 'Z' } }, // Almaty
+    { 5182, TZ_UTC_P5, { 'K', 'Z' } }, // Nur-Sultan
+    { 5193, TZ_UTC_P5, { 'K', 'Z' } }, // Shymkent
+    { 5202, TZ_UTC_P5, { 'K', 'Z' } }, // Aktobe
+    { 5209, TZ_UTC_P5, { 'K', 'Z' } }, // Taraz
+    { 5215, TZ_UTC_P5, { 'K', 'Z' } }, // Pavlodar
+    { 5224, TZ_UTC_P5, { 'K', 'Z' } }, // Ust-Kamenogorsk
+    { 5240, TZ_UTC_P5, { 'K', 'Z' } }, // Semey
+    { 5246, TZ_UTC_P5, { 'K', 'Z' } }, // Aktau
+    { 5252, TZ_UTC_P5, { 'K', 'Z' } }, // Kostanay
+    { 5261, TZ_UTC_P5, { 'K', 'Z' } }, // Kyzylorda
+    { 5271, TZ_UTC_P5, { 'K', 'Z' } }, // Oral
+    { 5276, TZ_UTC_P5, { 'K', 'Z' } }, // Atyrau
+    { 5283, TZ_UTC_P5, { 'K', 'Z' } }, // Petropavlovsk
+    { 5297, TZ_UTC_P5, { 'K', 'Z' } }, // Temirtau
+    { 5246, TZ_UTC_P5, { 'K', 'Z' } }, // Aktau
+    { 5306, TZ_UTC_P5, { 'K', 'Z' } }, // Rudny
+    { 5312, TZ_UTC_P5, { 'K', 'Z' } }, // Ekibastuz
+    { 5322, TZ_UTC_P5, { 'K', 'Z' } }, // Taldykorgan
+    { 5334, TZ_UTC_P5, { 'K', 'Z' } }, // Zhezkazgan
+    { 5345, TZ_UTC_P5, { 'K', 'Z' } }, // Turkestan
+    // Uzbekistan
+    { 5355, TZ_UTC_P5, { 'U', 'Z' } }, // Tashkent
+    { 5364, TZ_UTC_P5, { 'U', 'Z' } }, // Samarkand
+    { 5374, TZ_UTC_P5, { 'U', 'Z' } }, // Namangan
+    { 5383, TZ_UTC_P5, { 'U', 'Z' } }, // Bukhara
+    { 5391, TZ_UTC_P5, { 'U', 'Z' } }, // Andijan
+    { 5399, TZ_UTC_P5, { 'U', 'Z' } }, // Nukus
+    { 5405, TZ_UTC_P5, { 'U', 'Z' } }, // Fergana
+    { 5413, TZ_UTC_P5, { 'U', 'Z' } }, // Kokand
+    { 5420, TZ_UTC_P5, { 'U', 'Z' } }, // Margilan
+    { 5429, TZ_UTC_P5, { 'U', 'Z' } }, // Chirchiq
+    { 5438, TZ_UTC_P5, { 'U', 'Z' } }, // Termez
+    { 5445, TZ_UTC_P5, { 'U', 'Z' } }, // Angren
+    { 5452, TZ_UTC_P5, { 'U', 'Z' } }, // Jizzakh
+    { 5460, TZ_UTC_P5, { 'U', 'Z' } }, // Navoi
+    { 5466, TZ_UTC_P5, { 'U', 'Z' } }, // Qarshi
+    { 5473, TZ_UTC_P5, { 'U', 'Z' } }, // Gulistan
+    { 5482, TZ_UTC_P5, { 'U', 'Z' } }, // Urgench
+    { 5490, TZ_UTC_P5, { 'U', 'Z' } }, // Bekabad
+    { 5498, TZ_UTC_P5, { 'U', 'Z' } }, // Khiva
+    { 5504, TZ_UTC_P5, { 'U', 'Z' } }, // Denau
+    // Kyrgyzstan
+    { 5510, TZ_UTC_P6, { 'K', 'G' } }, // Bishkek
+    { 5518, TZ_UTC_P6, { 'K', 'G' } }, // Osh
+    { 5522, TZ_UTC_P6, { 'K', 'G' } }, // Jalal-Abad
+    { 5533, TZ_UTC_P6, { 'K', 'G' } }, // Karakol
+    { 5541, TZ_UTC_P6, { 'K', 'G' } }, // Tokmok
+    { 5548, TZ_UTC_P6, { 'K', 'G' } }, // Uzgen
+    { 5554, TZ_UTC_P6, { 'K', 'G' } }, // Naryn
+    { 5560, TZ_UTC_P6, { 'K', 'G' } }, // Talas
+    { 5566, TZ_UTC_P6, { 'K', 'G' } }, // Batken
+    { 5573, TZ_UTC_P6, { 'K', 'G' } }, // Kant
+    { 5578, TZ_UTC_P6, { 'K', 'G' } }, // Kara-Balta
+    { 5589, TZ_UTC_P6, { 'K', 'G' } }, // Cholpon-Ata
+    { 5601, TZ_UTC_P6, { 'K', 'G' } }, // Kara-Suu
+    { 5610, TZ_UTC_P6, { 'K', 'G' } }, // Balykchy
+    // Tajikistan
+    { 5619, TZ_UTC_P5, { 'T', 'J' } }, // Dushanbe
+    { 5628, TZ_UTC_P5, { 'T', 'J' } }, // Khujand
+    { 5636, TZ_UTC_P5, { 'T', 'J' } }, // Kulob
+    { 5642, TZ_UTC_P5, { 'T', 'J' } }, // Qurghonteppa
+    { 5655, TZ_UTC_P5, { 'T', 'J' } }, // Istaravshan
+    { 5667, TZ_UTC_P5, { 'T', 'J' } }, // Isfara
+    { 5674, TZ_UTC_P5, { 'T', 'J' } }, // Panjakent
+    { 5684, TZ_UTC_P5, { 'T', 'J' } }, // Kanibadam
+    { 5694, TZ_UTC_P5, { 'T', 'J' } }, // Tursunzoda
+    { 5705, TZ_UTC_P5, { 'T', 'J' } }, // Vahdat
+    { 5712, TZ_UTC_P5, { 'T', 'J' } }, // Khorugh
+    { 5720, TZ_UTC_P5, { 'T', 'J' } }, // Hisor
+    { 5726, TZ_UTC_P5, { 'T', 'J' } }, // Bokhtar
+    { 5734, TZ_UTC_P5, { 'T', 'J' } }, // Dangara
+    // Turkmenistan
+    { 5742, TZ_UTC_P5, { 'T', 'M' } }, // Ashgabat
+    { 5751, TZ_UTC_P5, { 'T', 'M' } }, // Turkmenbashi
+    { 5764, TZ_UTC_P5, { 'T', 'M' } }, // Dashoguz
+    { 5773, TZ_UTC_P5, { 'T', 'M' } }, // Mary
+    { 5778, TZ_UTC_P5, { 'T', 'M' } }, // Balkanabat
+    { 5789, TZ_UTC_P5, { 'T', 'M' } }, // Bayramaly
+    { 5751, TZ_UTC_P5, { 'T', 'M' } }, // Turkmenbashi
+    { 5799, TZ_UTC_P5, { 'T', 'M' } }, // Serdar
+    { 5806, TZ_UTC_P5, { 'T', 'M' } }, // Gumdag
+    { 5813, TZ_UTC_P5, { 'T', 'M' } }, // Magdanly
+    { 5822, TZ_UTC_P5, { 'T', 'M' } }, // Tejen
+    { 5828, TZ_UTC_P5, { 'T', 'M' } }, // Yoloten
+    // Azerbaijan
+    { 5836, TZ_UTC_P4, { 'A', 'Z' } }, // Baku
+    { 5841, TZ_UTC_P4, { 'A', 'Z' } }, // Ganja
+    // Georgia
+    { 5847, TZ_UTC_P4, { 'G', 'E' } }, // Tbilisi
+    { 5855, TZ_UTC_P4, { 'G', 'E' } }, // Batumi
+    { 5862, TZ_UTC_P4, { 'G', 'E' } }, // Kutaisi
+    { 5870, TZ_UTC_P4, { 'G', 'E' } }, // Rustavi
+    { 5878, TZ_UTC_P4, { 'G', 'E' } }, // Gori
+    { 5883, TZ_UTC_P4, { 'G', 'E' } }, // Zugdidi
+    { 5891, TZ_UTC_P4, { 'G', 'E' } }, // Poti
+    { 5896, TZ_UTC_P4, { 'G', 'E' } }, // Kobuleti
+    { 5905, TZ_UTC_P4, { 'G', 'E' } }, // Khashuri
+    { 5914, TZ_UTC_P4, { 'G', 'E' } }, // Samtredia
+    { 5924, TZ_UTC_P4, { 'G', 'E' } }, // Senaki
+    { 5931, TZ_UTC_P4, { 'G', 'E' } }, // Zestaponi
+    { 5941, TZ_UTC_P4, { 'G', 'E' } }, // Marneuli
+    { 5950, TZ_UTC_P4, { 'G', 'E' } }, // Telavi
+    // Armenia
+    { 5957, TZ_UTC_P4, { 'A', 'M' } }, // Yerevan
+    { 5965, TZ_UTC_P4, { 'A', 'M' } }, // Gyumri
+    { 5972, TZ_UTC_P4, { 'A', 'M' } }, // Vanadzor
+    { 5981, TZ_UTC_P4, { 'A', 'M' } }, // Vagharshapat
+    { 5994, TZ_UTC_P4, { 'A', 'M' } }, // Hrazdan
+    { 6002, TZ_UTC_P4, { 'A', 'M' } }, // Abovyan
+    { 6010, TZ_UTC_P4, { 'A', 'M' } }, // Kapan
+    { 6016, TZ_UTC_P4, { 'A', 'M' } }, // Armavir
+    { 6024, TZ_UTC_P4, { 'A', 'M' } }, // Gavar
+    { 6030, TZ_UTC_P4, { 'A', 'M' } }, // Artashat
+    { 6039, TZ_UTC_P4, { 'A', 'M' } }, // Goris
+    { 6045, TZ_UTC_P4, { 'A', 'M' } }, // Ashtarak
+    // Russia
+    { 6054, TZ_UTC_P3, { 'R', 'U' } }, // Moscow
+    { 6061, TZ_UTC_P3, { 'R', 'U' } }, // Saint Petersburg
+    { 6078, TZ_UTC_P7, { 'R', 'U' } }, // Novosibirsk
+    { 6090, TZ_UTC_P5, { 'R', 'U' } }, // Yekaterinburg
+    { 6104, TZ_UTC_P3, { 'R', 'U' } }, // Nizhny Novgorod
+    { 6120, TZ_UTC_P3, { 'R', 'U' } }, // Kazan
+    { 6126, TZ_UTC_P5, { 'R', 'U' } }, // Chelyabinsk
+    { 6138, TZ_UTC_P6, { 'R', 'U' } }, // Omsk
+    { 6143, TZ_UTC_P4, { 'R', 'U' } }, // Samara
+    { 6150, TZ_UTC_P3, { 'R', 'U' } }, // Rostov-on-Don
+    { 6164, TZ_UTC_P5, { 'R', 'U' } }, // Ufa
+    { 6168, TZ_UTC_P7, { 'R', 'U' } }, // Krasnoyarsk
+    { 6180, TZ_UTC_P3, { 'R', 'U' } }, // Voronezh
+    { 6189, TZ_UTC_P5, { 'R', 'U' } }, // Perm
+    { 6194, TZ_UTC_P3, { 'R', 'U' } }, // Volgograd
+    { 6204, TZ_UTC_P3, { 'R', 'U' } }, // Krasnodar
+    // Japan
+    { 6214, TZ_UTC_P9, { 'J', 'P' } }, // Tokyo
+    { 6220, TZ_UTC_P9, { 'J', 'P' } }, // Yokohama
+    { 6229, TZ_UTC_P9, { 'J', 'P' } }, // Osaka
+    { 6235, TZ_UTC_P9, { 'J', 'P' } }, // Nagoya
+    { 6242, TZ_UTC_P9, { 'J', 'P' } }, // Sapporo
+    { 6250, TZ_UTC_P9, { 'J', 'P' } }, // Fukuoka
+    { 6258, TZ_UTC_P9, { 'J', 'P' } }, // Kobe
+    { 6263, TZ_UTC_P9, { 'J', 'P' } }, // Kyoto
+    { 6269, TZ_UTC_P9, { 'J', 'P' } }, // Kawasaki
+    { 6278, TZ_UTC_P9, { 'J', 'P' } }, // Hiroshima
+    { 6288, TZ_UTC_P9, { 'J', 'P' } }, // Sendai
+    { 6295, TZ_UTC_P9, { 'J', 'P' } }, // Kitakyushu
+    { 6306, TZ_UTC_P9, { 'J', 'P' } }, // Chiba
+    { 6312, TZ_UTC_P9, { 'J', 'P' } }, // Sakai
+    { 6318, TZ_UTC_P9, { 'J', 'P' } }, // Niigata
+    { 6326, TZ_UTC_P9, { 'J', 'P' } }, // Hamamatsu
+    { 6336, TZ_UTC_P9, { 'J', 'P' } }, // Okayama
+    { 6344, TZ_UTC_P9, { 'J', 'P' } }, // Sagamihara
+    { 6355, TZ_UTC_P9, { 'J', 'P' } }, // Funabashi
+    { 6365, TZ_UTC_P9, { 'J', 'P' } }, // Hachioji
+    { 6374, TZ_UTC_P9, { 'J', 'P' } }, // Kagoshima
+    { 6384, TZ_UTC_P9, { 'J', 'P' } }, // Kawaguchi
+    { 6394, TZ_UTC_P9, { 'J', 'P' } }, // Himeji
+    { 6401, TZ_UTC_P9, { 'J', 'P' } }, // Suita
+    { 6407, TZ_UTC_P9, { 'J', 'P' } }, // Kanazawa
+    { 6416, TZ_UTC_P9, { 'J', 'P' } }, // Matsuyama
+    { 6426, TZ_UTC_P9, { 'J', 'P' } }, // Utsunomiya
+    { 6437, TZ_UTC_P9, { 'J', 'P' } }, // Matsudo
+    { 6445, TZ_UTC_P9, { 'J', 'P' } }, // Kawagoe
+    { 6453, TZ_UTC_P9, { 'J', 'P' } }, // Kochi
+    { 6459, TZ_UTC_P9, { 'J', 'P' } }, // Takamatsu
+    { 6469, TZ_UTC_P9, { 'J', 'P' } }, // Toyama
+    { 6476, TZ_UTC_P9, { 'J', 'P' } }, // Toyonaka
+    { 6485, TZ_UTC_P9, { 'J', 'P' } }, // Gifu
+    { 6490, TZ_UTC_P9, { 'J', 'P' } }, // Fujisawa
+    { 6499, TZ_UTC_P9, { 'J', 'P' } }, // Kashiwa
+    { 6507, TZ_UTC_P9, { 'J', 'P' } }, // Miyazaki
+    { 6516, TZ_UTC_P9, { 'J', 'P' } }, // Toyohashi
+    { 6526, TZ_UTC_P9, { 'J', 'P' } }, // Nagano
+    { 6533, TZ_UTC_P9, { 'J', 'P' } }, // Iwaki
+    { 6539, TZ_UTC_P9, { 'J', 'P' } }, // Asahikawa
+    // South Korea
+    { 6549, TZ_UTC_P9, { 'K', 'R' } }, // Seoul
+    { 6555, TZ_UTC_P9, { 'K', 'R' } }, // Busan
+    { 6561, TZ_UTC_P9, { 'K', 'R' } }, // Incheon
+    { 6569, TZ_UTC_P9, { 'K', 'R' } }, // Daegu
+    { 6575, TZ_UTC_P9, { 'K', 'R' } }, // Daejeon
+    { 6583, TZ_UTC_P9, { 'K', 'R' } }, // Gwangju
+    { 6591, TZ_UTC_P9, { 'K', 'R' } }, // Ulsan
+    { 6597, TZ_UTC_P9, { 'K', 'R' } }, // Suwon
+    { 6603, TZ_UTC_P9, { 'K', 'R' } }, // Changwon
+    { 6612, TZ_UTC_P9, { 'K', 'R' } }, // Goyang
+    { 6619, TZ_UTC_P9, { 'K', 'R' } }, // Yongin
+    { 6626, TZ_UTC_P9, { 'K', 'R' } }, // Seongnam
+    { 6635, TZ_UTC_P9, { 'K', 'R' } }, // Bucheon
+    { 6643, TZ_UTC_P9, { 'K', 'R' } }, // Ansan
+    { 6649, TZ_UTC_P9, { 'K', 'R' } }, // Cheongju
+    { 6658, TZ_UTC_P9, { 'K', 'R' } }, // Jeonju
+    { 6665, TZ_UTC_P9, { 'K', 'R' } }, // Anyang
+    { 6672, TZ_UTC_P9, { 'K', 'R' } }, // Cheonan
+    { 6680, TZ_UTC_P9, { 'K', 'R' } }, // Pohang
+    { 6687, TZ_UTC_P9, { 'K', 'R' } }, // Uijeongbu
+    { 6697, TZ_UTC_P9, { 'K', 'R' } }, // Siheung
+    { 6705, TZ_UTC_P9, { 'K', 'R' } }, // Pyeongtaek
+    { 6716, TZ_UTC_P9, { 'K', 'R' } }, // Gimhae
+    { 6723, TZ_UTC_P9, { 'K', 'R' } }, // Hwaseong
+    { 6732, TZ_UTC_P9, { 'K', 'R' } }, // Gumi
+    { 6737, TZ_UTC_P9, { 'K', 'R' } }, // Asan
+    { 6742, TZ_UTC_P9, { 'K', 'R' } }, // Wonju
+    { 6748, TZ_UTC_P9, { 'K', 'R' } }, // Gimpo
+    { 6754, TZ_UTC_P9, { 'K', 'R' } }, // Iksan
+    { 6760, TZ_UTC_P9, { 'K', 'R' } }, // Gunsan
+    // North Korea
+    { 6767, TZ_UTC_P9, { 'K', 'P' } }, // Pyongyang
+    // Mongolia
+    { 6777, TZ_UTC_P8, { 'M', 'N' } }, // Ulaanbaatar
+    // Nepal
+    { 6789, TZ_UTC_P5_45, { 'N', 'P' } }, // Kathmandu
+    { 6799, TZ_UTC_P5_45, { 'N', 'P' } }, // Pokhara
+    // Bhutan
+    { 6807, TZ_UTC_P6, { 'B', 'T' } }, // Thimphu
+    // Sri Lanka
+    { 6815, TZ_UTC_P5_30, { 'L', 'K' } }, // Colombo
+    { 6823, TZ_UTC_P5_30, { 'L', 'K' } }, // Kandy
+    { 6829, TZ_UTC_P5_30, { 'L', 'K' } }, // Galle
+    // Maldives
+    { 6835, TZ_UTC_P5, { 'M', 'V' } }, // Male
+    // Myanmar
+    { 6840, TZ_UTC_P6_30, { 'M', 'M' } }, // Yangon
+    { 6847, TZ_UTC_P6_30, { 'M', 'M' } }, // Mandalay
+    { 6856, TZ_UTC_P6_30, { 'M', 'M' } }, // Naypyidaw
+    // Cambodia
+    { 6866, TZ_UTC_P7, { 'K', 'H' } }, // Phnom Penh
+    { 6877, TZ_UTC_P7, { 'K', 'H' } }, // Siem Reap
+    // Laos
+    { 6887, TZ_UTC_P7, { 'L', 'A' } }, // Vientiane
+    { 6897, TZ_UTC_P7, { 'L', 'A' } }, // Luang Prabang
+    // Europe
+    // United Kingdom
+    { 13984, TZ_EU_WESTERN, { 'G', 'B' } }, // London
+    { 6911, TZ_EU_WESTERN, { 'G', 'B' } }, // Birmingham
+    { 6922, TZ_EU_WESTERN, { 'G', 'B' } }, // Manchester
+    { 6933, TZ_EU_WESTERN, { 'G', 'B' } }, // Liverpool
+    { 6943, TZ_EU_WESTERN, { 'G', 'B' } }, // Leeds
+    { 6949, TZ_EU_WESTERN, { 'G', 'B' } }, // Sheffield
+    { 6959, TZ_EU_WESTERN, { 'G', 'B' } }, // Edinburgh
+    { 6969, TZ_EU_WESTERN, { 'G', 'B' } }, // Glasgow
+    { 6977, TZ_EU_WESTERN, { 'G', 'B' } }, // Cardiff
+    { 6985, TZ_EU_WESTERN, { 'G', 'B' } }, // Belfast
+    { 6993, TZ_EU_WESTERN, { 'G', 'B' } }, // Bristol
+    { 7001, TZ_EU_WESTERN, { 'G', 'B' } }, // Leicester
+    { 7011, TZ_EU_WESTERN, { 'G', 'B' } }, // Coventry
+    { 7020, TZ_EU_WESTERN, { 'G', 'B' } }, // Hull
+    { 7025, TZ_EU_WESTERN, { 'G', 'B' } }, // Bradford
+    { 7034, TZ_EU_WESTERN, { 'G', 'B' } }, // Nottingham
+    { 7045, TZ_EU_WESTERN, { 'G', 'B' } }, // Plymouth
+    { 7054, TZ_EU_WESTERN, { 'G', 'B' } }, // Stoke-on-Trent
+    { 7069, TZ_EU_WESTERN, { 'G', 'B' } }, // Wolverhampton
+    { 7083, TZ_EU_WESTERN, { 'G', 'B' } }, // Derby
+    { 7089, TZ_EU_WESTERN, { 'G', 'B' } }, // Swansea
+    { 7097, TZ_EU_WESTERN, { 'G', 'B' } }, // Southampton
+    { 7109, TZ_EU_WESTERN, { 'G', 'B' } }, // Salford
+    { 7117, TZ_EU_WESTERN, { 'G', 'B' } }, // Aberdeen
+    { 7126, TZ_EU_WESTERN, { 'G', 'B' } }, // Westminster
+    { 7138, TZ_EU_WESTERN, { 'G', 'B' } }, // Portsmouth
+    { 12080, TZ_EU_WESTERN, { 'G', 'B' } }, // York
+    { 7149, TZ_EU_WESTERN, { 'G', 'B' } }, // Peterborough
+    { 7162, TZ_EU_WESTERN, { 'G', 'B' } }, // Dundee
+    { 7169, TZ_EU_WESTERN, { 'G', 'B' } }, // Lancaster
+    { 7179, TZ_EU_WESTERN, { 'G', 'B' } }, // Oxford
+    { 7186, TZ_EU_WESTERN, { 'G', 'B' } }, // Newport
+    { 7194, TZ_EU_WESTERN, { 'G', 'B' } }, // Preston
+    { 7202, TZ_EU_WESTERN, { 'G', 'B' } }, // St Albans
+    { 7212, TZ_EU_WESTERN, { 'G', 'B' } }, // Norwich
+    { 7220, TZ_EU_WESTERN, { 'G', 'B' } }, // Chester
+    { 7162, TZ_EU_WESTERN, { 'G', 'B' } }, // Dundee
+    { 7228, TZ_EU_WESTERN, { 'G', 'B' } }, // Exeter
+    { 7235, TZ_EU_WESTERN, { 'G', 'B' } }, // Gloucester
+    { 7246, TZ_EU_WESTERN, { 'G', 'B' } }, // Scunthorpe
+    { 7257, TZ_EU_WESTERN, { 'G', 'B' } }, // Sunderland
+    { 7268, TZ_EU_WESTERN, { 'G', 'B' } }, // Ipswich
+    { 7276, TZ_EU_WESTERN, { 'G', 'B' } }, // Blackpool
+    { 7286, TZ_EU_WESTERN, { 'G', 'B' } }, // Middlesbrough
+    { 7300, TZ_EU_WESTERN, { 'G', 'B' } }, // Bolton
+    { 7307, TZ_EU_WESTERN, { 'G', 'B' } }, // Bournemouth
+    { 7319, TZ_EU_WESTERN, { 'G', 'B' } }, // Cambridge
+    { 7329, TZ_EU_WESTERN, { 'G', 'B' } }, // Crewe
+    { 7335, TZ_EU_WESTERN, { 'G', 'B' } }, // Doncaster
+    { 7345, TZ_EU_WESTERN, { 'G', 'B' } }, // Gillingham
+    { 7356, TZ_EU_WESTERN, { 'G', 'B' } }, // Hemel Hempstead
+    { 7268, TZ_EU_WESTERN, { 'G', 'B' } }, // Ipswich
+    // France
+    { 7372, TZ_EU_CENTRAL, { 'F', 'R' } }, // Paris
+    { 7378, TZ_EU_CENTRAL, { 'F', 'R' } }, // Marseille
+    { 7388, TZ_EU_CENTRAL, { 'F', 'R' } }, // Lyon
+    { 7393, TZ_EU_CENTRAL, { 'F', 'R' } }, // Toulouse
+    { 7402, TZ_EU_CENTRAL, { 'F', 'R' } }, // Nice
+    { 7407, TZ_EU_CENTRAL, { 'F', 'R' } }, // Nantes
+    { 7414, TZ_EU_CENTRAL, { 'F', 'R' } }, // Montpellier
+    { 7426, TZ_EU_CENTRAL, { 'F', 'R' } }, // Strasbourg
+    { 7437, TZ_EU_CENTRAL, { 'F', 'R' } }, // Bordeaux
+    { 7446, TZ_EU_CENTRAL, { 'F', 'R' } }, // Lille
+    { 7452, TZ_EU_CENTRAL, { 'F', 'R' } }, // Rennes
+    { 7459, TZ_EU_CENTRAL, { 'F', 'R' } }, // Reims
+    { 7465, TZ_EU_CENTRAL, { 'F', 'R' } }, // Le Havre
+    { 7474, TZ_EU_CENTRAL, { 'F', 'R' } }, // Saint-Etienne
+    { 7488, TZ_EU_CENTRAL, { 'F', 'R' } }, // Toulon
+    { 7495, TZ_EU_CENTRAL, { 'F', 'R' } }, // Angers
+    { 7502, TZ_EU_CENTRAL, { 'F', 'R' } }, // Grenoble
+    { 7511, TZ_EU_CENTRAL, { 'F', 'R' } }, // Dijon
+    { 7517, TZ_EU_CENTRAL, { 'F', 'R' } }, // Nimes
+    { 7523, TZ_EU_CENTRAL, { 'F', 'R' } }, // Aix-en-Provence
+    { 7539, TZ_EU_CENTRAL, { 'F', 'R' } }, // Brest
+    { 7545, TZ_EU_CENTRAL, { 'F', 'R' } }, // Le Mans
+    { 7553, TZ_EU_CENTRAL, { 'F', 'R' } }, // Amiens
+    { 7560, TZ_EU_CENTRAL, { 'F', 'R' } }, // Tours
+    { 7566, TZ_EU_CENTRAL, { 'F', 'R' } }, // Limoges
+    { 7574, TZ_EU_CENTRAL, { 'F', 'R' } }, // Clermont-Ferrand
+    { 7591, TZ_EU_CENTRAL, { 'F', 'R' } }, // Villeurbanne
+    { 7604, TZ_EU_CENTRAL, { 'F', 'R' } }, // Besancon
+    { 7613, TZ_EU_CENTRAL, { 'F', 'R' } }, // Metz
+    { 12527, TZ_EU_CENTRAL, { 'F', 'R' } }, // Orleans
+    { 7618, TZ_EU_CENTRAL, { 'F', 'R' } }, // Rouen
+    { 7624, TZ_EU_CENTRAL, { 'F', 'R' } }, // Mulhouse
+    { 7633, TZ_EU_CENTRAL, { 'F', 'R' } }, // Caen
+    { 7638, TZ_EU_CENTRAL, { 'F', 'R' } }, // Nancy
+    { 7644, TZ_EU_CENTRAL, { 'F', 'R' } }, // Argenteuil
+    { 7655, TZ_EU_CENTRAL, { 'F', 'R' } }, // Saint-Denis
+    { 7667, TZ_EU_CENTRAL, { 'F', 'R' } }, // Roubaix
+    { 7675, TZ_EU_CENTRAL, { 'F', 'R' } }, // Tourcoing
+    { 7685, TZ_EU_CENTRAL, { 'F', 'R' } }, // Nanterre
+    { 7694, TZ_EU_CENTRAL, { 'F', 'R' } }, // Avignon
+    { 7702, TZ_EU_CENTRAL, { 'F', 'R' } }, // Creteil
+    { 7710, TZ_EU_CENTRAL, { 'F', 'R' } }, // Poitiers
+    { 7719, TZ_EU_CENTRAL, { 'F', 'R' } }, // Versailles
+    { 7730, TZ_EU_CENTRAL, { 'F', 'R' } }, // Pau
+    { 7734, TZ_EU_CENTRAL, { 'F', 'R' } }, // La Rochelle
+    { 7746, TZ_EU_CENTRAL, { 'F', 'R' } }, // Calais
+    { 7753, TZ_EU_CENTRAL, { 'F', 'R' } }, // Cannes
+    { 7760, TZ_EU_CENTRAL, { 'F', 'R' } }, // Ajaccio
+    // Germany
+    { 7768, TZ_EU_CENTRAL, { 'D', 'E' } }, // Berlin
+    { 7775, TZ_EU_CENTRAL, { 'D', 'E' } }, // Hamburg
+    { 7783, TZ_EU_CENTRAL, { 'D', 'E' } }, // Munich
+    { 7790, TZ_EU_CENTRAL, { 'D', 'E' } }, // Cologne
+    { 7798, TZ_EU_CENTRAL, { 'D', 'E' } }, // Frankfurt
+    { 7808, TZ_EU_CENTRAL, { 'D', 'E' } }, // Stuttgart
+    { 7818, TZ_EU_CENTRAL, { 'D', 'E' } }, // Dusseldorf
+    { 7829, TZ_EU_CENTRAL, { 'D', 'E' } }, // Dortmund
+    { 7838, TZ_EU_CENTRAL, { 'D', 'E' } }, // Essen
+    { 7844, TZ_EU_CENTRAL, { 'D', 'E' } }, // Leipzig
+    { 7852, TZ_EU_CENTRAL, { 'D', 'E' } }, // Bremen
+    { 7859, TZ_EU_CENTRAL, { 'D', 'E' } }, // Dresden
+    { 7867, TZ_EU_CENTRAL, { 'D', 'E' } }, // Hanover
+    { 7875, TZ_EU_CENTRAL, { 'D', 'E' } }, // Nuremberg
+    { 7885, TZ_EU_CENTRAL, { 'D', 'E' } }, // Duisburg
+    { 7894, TZ_EU_CENTRAL, { 'D', 'E' } }, // Bochum
+    { 7901, TZ_EU_CENTRAL, { 'D', 'E' } }, // Wuppertal
+    { 7911, TZ_EU_CENTRAL, { 'D', 'E' } }, // Bielefeld
+    { 7921, TZ_EU_CENTRAL, { 'D', 'E' } }, // Bonn
+    { 7926, TZ_EU_CENTRAL, { 'D', 'E' } }, // Munster
+    { 7934, TZ_EU_CENTRAL, { 'D', 'E' } }, // Karlsruhe
+    { 7944, TZ_EU_CENTRAL, { 'D', 'E' } }, // Mannheim
+    { 7953, TZ_EU_CENTRAL, { 'D', 'E' } }, // Augsburg
+    { 7962, TZ_EU_CENTRAL, { 'D', 'E' } }, // Wiesbaden
+    { 7972, TZ_EU_CENTRAL, { 'D', 'E' } }, // Gelsenkirchen
+    { 7986, TZ_EU_CENTRAL, { 'D', 'E' } }, // Monchengladbach
+    { 8002, TZ_EU_CENTRAL, { 'D', 'E' } }, // Braunschweig
+    { 8015, TZ_EU_CENTRAL, { 'D', 'E' } }, // Chemnitz
+    { 8024, TZ_EU_CENTRAL, { 'D', 'E' } }, // Kiel
+    { 8029, TZ_EU_CENTRAL, { 'D', 'E' } }, // Aachen
+    { 8036, TZ_EU_CENTRAL, { 'D', 'E' } }, // Halle
+    { 8042, TZ_EU_CENTRAL, { 'D', 'E' } }, // Magdeburg
+    { 8052, TZ_EU_CENTRAL, { 'D', 'E' } }, // Freiburg
+    { 8061, TZ_EU_CENTRAL, { 'D', 'E' } }, // Krefeld
+    { 8069, TZ_EU_CENTRAL, { 'D', 'E' } }, // Lubeck
+    { 8076, TZ_EU_CENTRAL, { 'D', 'E' } }, // Oberhausen
+    { 8087, TZ_EU_CENTRAL, { 'D', 'E' } }, // Erfurt
+    { 8094, TZ_EU_CENTRAL, { 'D', 'E' } }, // Mainz
+    { 8100, TZ_EU_CENTRAL, { 'D', 'E' } }, // Rostock
+    { 8108, TZ_EU_CENTRAL, { 'D', 'E' } }, // Kassel
+    { 8115, TZ_EU_CENTRAL, { 'D', 'E' } }, // Hagen
+    { 8121, TZ_EU_CENTRAL, { 'D', 'E' } }, // Potsdam
+    { 8129, TZ_EU_CENTRAL, { 'D', 'E' } }, // Saarbrucken
+    { 8141, TZ_EU_CENTRAL, { 'D', 'E' } }, // Hamm
+    { 8146, TZ_EU_CENTRAL, { 'D', 'E' } }, // Mulheim
+    { 8154, TZ_EU_CENTRAL, { 'D', 'E' } }, // Ludwigshafen
+    { 8167, TZ_EU_CENTRAL, { 'D', 'E' } }, // Leverkusen
+    { 8178, TZ_EU_CENTRAL, { 'D', 'E' } }, // Oldenburg
+    { 8188, TZ_EU_CENTRAL, { 'D', 'E' } }, // Neuss
+    { 8194, TZ_EU_CENTRAL, { 'D', 'E' } }, // Solingen
+    { 8203, TZ_EU_CENTRAL, { 'D', 'E' } }, // Heidelberg
+    { 8214, TZ_EU_CENTRAL, { 'D', 'E' } }, // Darmstadt
+    { 8224, TZ_EU_CENTRAL, { 'D', 'E' } }, // Paderborn
+    { 8234, TZ_EU_CENTRAL, { 'D', 'E' } }, // Regensburg
+    { 8245, TZ_EU_CENTRAL, { 'D', 'E' } }, // Ingolstadt
+    { 8256, TZ_EU_CENTRAL, { 'D', 'E' } }, // Wurzburg
+    { 8265, TZ_EU_CENTRAL, { 'D', 'E' } }, // Furth
+    { 8271, TZ_EU_CENTRAL, { 'D', 'E' } }, // Wolfsburg
+    { 8281, TZ_EU_CENTRAL, { 'D', 'E' } }, // Offenbach
+    { 8291, TZ_EU_CENTRAL, { 'D', 'E' } }, // Ulm
+    { 8295, TZ_EU_CENTRAL, { 'D', 'E' } }, // Heilbronn
+    { 8305, TZ_EU_CENTRAL, { 'D', 'E' } }, // Pforzheim
+    { 8315, TZ_EU_CENTRAL, { 'D', 'E' } }, // Gottingen
+    { 8325, TZ_EU_CENTRAL, { 'D', 'E' } }, // Bottrop
+    { 8333, TZ_EU_CENTRAL, { 'D', 'E' } }, // Trier
+    { 8339, TZ_EU_CENTRAL, { 'D', 'E' } }, // Recklinghausen
+    { 8354, TZ_EU_CENTRAL, { 'D', 'E' } }, // Reutlingen
+    { 8365, TZ_EU_CENTRAL, { 'D', 'E' } }, // Bremerhaven
+    { 8377, TZ_EU_CENTRAL, { 'D', 'E' } }, // Koblenz
+    { 8385, TZ_EU_CENTRAL, { 'D', 'E' } }, // Bergisch Gladbach
+    { 8403, TZ_EU_CENTRAL, { 'D', 'E' } }, // Jena
+    { 8408, TZ_EU_CENTRAL, { 'D', 'E' } }, // Remscheid
+    { 8418, TZ_EU_CENTRAL, { 'D', 'E' } }, // Erlangen
+    { 8427, TZ_EU_CENTRAL, { 'D', 'E' } }, // Moers
+    { 8433, TZ_EU_CENTRAL, { 'D', 'E' } }, // Siegen
+    { 8440, TZ_EU_CENTRAL, { 'D', 'E' } }, // Hildesheim
+    { 8451, TZ_EU_CENTRAL, { 'D', 'E' } }, // Salzgitter
+    // Italy
+    { 8462, TZ_EU_CENTRAL, { 'I', 'T' } }, // Rome
+    { 8467, TZ_EU_CENTRAL, { 'I', 'T' } }, // Milan
+    { 8473, TZ_EU_CENTRAL, { 'I', 'T' } }, // Naples
+    { 8480, TZ_EU_CENTRAL, { 'I', 'T' } }, // Turin
+    { 8486, TZ_EU_CENTRAL, { 'I', 'T' } }, // Palermo
+    { 8494, TZ_EU_CENTRAL, { 'I', 'T' } }, // Genoa
+    { 8500, TZ_EU_CENTRAL, { 'I', 'T' } }, // Bologna
+    { 8508, TZ_EU_CENTRAL, { 'I', 'T' } }, // Florence
+    { 8517, TZ_EU_CENTRAL, { 'I', 'T' } }, // Bari
+    { 8522, TZ_EU_CENTRAL, { 'I', 'T' } }, // Catania
+    { 8530, TZ_EU_CENTRAL, { 'I', 'T' } }, // Venice
+    { 8537, TZ_EU_CENTRAL, { 'I', 'T' } }, // Verona
+    { 8544, TZ_EU_CENTRAL, { 'I', 'T' } }, // Messina
+    { 8552, TZ_EU_CENTRAL, { 'I', 'T' } }, // Padua
+    { 8558, TZ_EU_CENTRAL, { 'I', 'T' } }, // Trieste
+    { 8566, TZ_EU_CENTRAL, { 'I', 'T' } }, // Taranto
+    { 8574, TZ_EU_CENTRAL, { 'I', 'T' } }, // Brescia
+    { 8582, TZ_EU_CENTRAL, { 'I', 'T' } }, // Prato
+    { 8588, TZ_EU_CENTRAL, { 'I', 'T' } }, // Reggio Calabria
+    { 8604, TZ_EU_CENTRAL, { 'I', 'T' } }, // Modena
+    { 8611, TZ_EU_CENTRAL, { 'I', 'T' } }, // Reggio Emilia
+    { 8625, TZ_EU_CENTRAL, { 'I', 'T' } }, // Perugia
+    { 8633, TZ_EU_CENTRAL, { 'I', 'T' } }, // Livorno
+    { 8641, TZ_EU_CENTRAL, { 'I', 'T' } }, // Ravenna
+    { 8649, TZ_EU_CENTRAL, { 'I', 'T' } }, // Cagliari
+    { 8658, TZ_EU_CENTRAL, { 'I', 'T' } }, // Foggia
+    { 8665, TZ_EU_CENTRAL, { 'I', 'T' } }, // Rimini
+    { 8672, TZ_EU_CENTRAL, { 'I', 'T' } }, // Salerno
+    { 8680, TZ_EU_CENTRAL, { 'I', 'T' } }, // Ferrara
+    { 8688, TZ_EU_CENTRAL, { 'I', 'T' } }, // Sassari
+    { 8696, TZ_EU_CENTRAL, { 'I', 'T' } }, // Latina
+    { 8703, TZ_EU_CENTRAL, { 'I', 'T' } }, // Giugliano
+    { 8713, TZ_EU_CENTRAL, { 'I', 'T' } }, // Monza
+    { 8719, TZ_EU_CENTRAL, { 'I', 'T' } }, // Syracuse
+    { 8728, TZ_EU_CENTRAL, { 'I', 'T' } }, // Pescara
+    { 8736, TZ_EU_CENTRAL, { 'I', 'T' } }, // Bergamo
+    { 8744, TZ_EU_CENTRAL, { 'I', 'T' } }, // Forlì
+    { 8751, TZ_EU_CENTRAL, { 'I', 'T' } }, // Trento
+    { 8758, TZ_EU_CENTRAL, { 'I', 'T' } }, // Vicenza
+    { 8766, TZ_EU_CENTRAL, { 'I', 'T' } }, // Terni
+    { 8772, TZ_EU_CENTRAL, { 'I', 'T' } }, // Bolzano
+    { 8780, TZ_EU_CENTRAL, { 'I', 'T' } }, // Novara
+    { 8787, TZ_EU_CENTRAL, { 'I', 'T' } }, // Piacenza
+    { 8796, TZ_EU_CENTRAL, { 'I', 'T' } }, // Ancona
+    // Spain
+    { 8803, TZ_EU_CENTRAL, { 'E', 'S' } }, // Madrid
+    { 8810, TZ_EU_CENTRAL, { 'E', 'S' } }, // Barcelona
+    { 8820, TZ_EU_CENTRAL, { 'E', 'S' } }, // Valencia
+    { 8829, TZ_EU_CENTRAL, { 'E', 'S' } }, // Seville
+    { 8837, TZ_EU_CENTRAL, { 'E', 'S' } }, // Zaragoza
+    { 8846, TZ_EU_CENTRAL, { 'E', 'S' } }, // Malaga
+    { 8853, TZ_EU_CENTRAL, { 'E', 'S' } }, // Murcia
+    { 8860, TZ_EU_CENTRAL, { 'E', 'S' } }, // Palma
+    { 8866, TZ_EU_WESTERN, { 'E', 'S' } }, // Las Palmas
+    { 8877, TZ_EU_CENTRAL, { 'E', 'S' } }, // Bilbao
+    { 8884, TZ_EU_CENTRAL, { 'E', 'S' } }, // Alicante
+    { 8893, TZ_EU_CENTRAL, { 'E', 'S' } }, // Cordoba
+    { 8901, TZ_EU_CENTRAL, { 'E', 'S' } }, // Valladolid
+    { 8912, TZ_EU_CENTRAL, { 'E', 'S' } }, // Vigo
+    { 8917, TZ_EU_CENTRAL, { 'E', 'S' } }, // Gijon
+    { 8923, TZ_EU_CENTRAL, { 'E', 'S' } }, // Hospitalet
+    { 8934, TZ_EU_CENTRAL, { 'E', 'S' } }, // Vitoria-Gasteiz
+    { 8950, TZ_EU_CENTRAL, { 'E', 'S' } }, // A Coruña
+    { 8960, TZ_EU_CENTRAL, { 'E', 'S' } }, // Elche
+    { 8966, TZ_EU_CENTRAL, { 'E', 'S' } }, // Granada
+    { 8974, TZ_EU_CENTRAL, { 'E', 'S' } }, // Oviedo
+    { 8981, TZ_EU_CENTRAL, { 'E', 'S' } }, // Badalona
+    { 8990, TZ_EU_CENTRAL, { 'E', 'S' } }, // Cartagena
+    { 9000, TZ_EU_CENTRAL, { 'E', 'S' } }, // Terrassa
+    { 9009, TZ_EU_CENTRAL, { 'E', 'S' } }, // Jerez de la Frontera
+    { 9030, TZ_EU_CENTRAL, { 'E', 'S' } }, // Sabadell
+    { 9039, TZ_EU_CENTRAL, { 'E', 'S' } }, // Mostoles
+    { 9048, TZ_EU_WESTERN, { 'E', 'S' } }, // Santa Cruz de Tenerife
+    { 9071, TZ_EU_CENTRAL, { 'E', 'S' } }, // Pamplona
+    { 9080, TZ_EU_CENTRAL, { 'E', 'S' } }, // Almeria
+    { 9088, TZ_EU_CENTRAL, { 'E', 'S' } }, // Alcala de Henares
+    { 9106, TZ_EU_CENTRAL, { 'E', 'S' } }, // Fuenlabrada
+    { 9118, TZ_EU_CENTRAL, { 'E', 'S' } }, // Leganes
+    { 9126, TZ_EU_CENTRAL, { 'E', 'S' } }, // Getafe
+    { 9133, TZ_EU_CENTRAL, { 'E', 'S' } }, // Santander
+    { 9143, TZ_EU_CENTRAL, { 'E', 'S' } }, // Castellon
+    { 9153, TZ_EU_CENTRAL, { 'E', 'S' } }, // Burgos
+    { 9160, TZ_EU_CENTRAL, { 'E', 'S' } }, // Albacete
+    { 9169, TZ_EU_CENTRAL, { 'E', 'S' } }, // Alcorcon
+    { 9178, TZ_EU_CENTRAL, { 'E', 'S' } }, // San Sebastian
+    { 9192, TZ_EU_CENTRAL, { 'E', 'S' } }, // Salamanca
+    { 9202, TZ_EU_CENTRAL, { 'E', 'S' } }, // Huelva
+    { 9209, TZ_EU_CENTRAL, { 'E', 'S' } }, // Lleida
+    { 9216, TZ_EU_CENTRAL, { 'E', 'S' } }, // Leon
+    { 9221, TZ_EU_CENTRAL, { 'E', 'S' } }, // Cadiz
+    { 9227, TZ_EU_CENTRAL, { 'E', 'S' } }, // Tarragona
+    { 9237, TZ_EU_CENTRAL, { 'E', 'S' } }, // Badajoz
+    // Portugal
+    { 9245, TZ_EU_WESTERN, { 'P', 'T' } }, // Lisbon
+    { 9252, TZ_EU_WESTERN, { 'P', 'T' } }, // Porto
+    { 9258, TZ_EU_WESTERN, { 'P', 'T' } }, // Braga
+    { 9264, TZ_EU_WESTERN, { 'P', 'T' } }, // Coimbra
+    { 9272, TZ_EU_WESTERN, { 'P', 'T' } }, // Funchal
+    { 9280, TZ_EU_WESTERN, { 'P', 'T' } }, // Amadora
+    { 9288, TZ_EU_WESTERN, { 'P', 'T' } }, // Almada
+    { 9295, TZ_EU_WESTERN, { 'P', 'T' } }, // Agualva-Cacem
+    { 9309, TZ_EU_WESTERN, { 'P', 'T' } }, // Queluz
+    { 9316, TZ_EU_WESTERN, { 'P', 'T' } }, // Setubal
+    { 9324, TZ_EU_WESTERN, { 'P', 'T' } }, // Barreiro
+    { 9333, TZ_EU_WESTERN, { 'P', 'T' } }, // Odivelas
+    { 9342, TZ_EU_WESTERN, { 'P', 'T' } }, // Aveiro
+    { 9349, TZ_EU_WESTERN, { 'P', 'T' } }, // Corroios
+    { 9358, TZ_EU_WESTERN, { 'P', 'T' } }, // Loures
+    { 9365, TZ_EU_WESTERN, { 'P', 'T' } }, // Evora
+    { 9371, TZ_EU_WESTERN, { 'P', 'T' } }, // Rio Tinto
+    { 9381, TZ_EU_WESTERN, { 'P', 'T' } }, // Gondomar
+    { 9390, TZ_EU_WESTERN, { 'P', 'T' } }, // Vila Nova de Gaia
+    { 9408, TZ_EU_WESTERN, { 'P', 'T' } }, // Matosinhos
+    { 9419, TZ_EU_WESTERN, { 'P', 'T' } }, // Faro
+    { 9424, TZ_EU_WESTERN, { 'P', 'T' } }, // Leiria
+    { 9431, TZ_EU_WESTERN, { 'P', 'T' } }, // Viseu
+    { 9437, TZ_EU_WESTERN, { 'P', 'T' } }, // Guimaraes
+    { 9447, TZ_EU_WESTERN, { 'P', 'T' } }, // Viana do Castelo
+    { 9464, TZ_EU_WESTERN, { 'P', 'T' } }, // Portimao
+    { 9473, TZ_EU_WESTERN, { 'P', 'T' } }, // Braganca
+    // Netherlands
+    { 9482, TZ_EU_CENTRAL, { 'N', 'L' } }, // Amsterdam
+    { 9492, TZ_EU_CENTRAL, { 'N', 'L' } }, // Rotterdam
+    { 9502, TZ_EU_CENTRAL, { 'N', 'L' } }, // The Hague
+    { 9512, TZ_EU_CENTRAL, { 'N', 'L' } }, // Utrecht
+    { 9520, TZ_EU_CENTRAL, { 'N', 'L' } }, // Eindhoven
+    { 9530, TZ_EU_CENTRAL, { 'N', 'L' } }, // Tilburg
+    { 9538, TZ_EU_CENTRAL, { 'N', 'L' } }, // Groningen
+    { 9548, TZ_EU_CENTRAL, { 'N', 'L' } }, // Almere
+    { 9555, TZ_EU_CENTRAL, { 'N', 'L' } }, // Breda
+    { 9561, TZ_EU_CENTRAL, { 'N', 'L' } }, // Nijmegen
+    { 9570, TZ_EU_CENTRAL, { 'N', 'L' } }, // Enschede
+    { 9579, TZ_EU_CENTRAL, { 'N', 'L' } }, // Haarlem
+    { 9587, TZ_EU_CENTRAL, { 'N', 'L' } }, // Arnhem
+    { 9594, TZ_EU_CENTRAL, { 'N', 'L' } }, // Zaanstad
+    { 9603, TZ_EU_CENTRAL, { 'N', 'L' } }, // Amersfoort
+    { 9614, TZ_EU_CENTRAL, { 'N', 'L' } }, // Apeldoorn
+    { 9624, TZ_EU_CENTRAL, { 'N', 'L' } }, // s-Hertogenbosch
+    { 9640, TZ_EU_CENTRAL, { 'N', 'L' } }, // Hoofddorp
+    { 9650, TZ_EU_CENTRAL, { 'N', 'L' } }, // Maastricht
+    { 9661, TZ_EU_CENTRAL, { 'N', 'L' } }, // Leiden
+    { 9668, TZ_EU_CENTRAL, { 'N', 'L' } }, // Dordrecht
+    { 9678, TZ_EU_CENTRAL, { 'N', 'L' } }, // Zoetermeer
+    { 9689, TZ_EU_CENTRAL, { 'N', 'L' } }, // Zwolle
+    { 9696, TZ_EU_CENTRAL, { 'N', 'L' } }, // Deventer
+    { 9705, TZ_EU_CENTRAL, { 'N', 'L' } }, // Delft
+    { 9711, TZ_EU_CENTRAL, { 'N', 'L' } }, // Alkmaar
+    { 9719, TZ_EU_CENTRAL, { 'N', 'L' } }, // Leeuwarden
+    { 9730, TZ_EU_CENTRAL, { 'N', 'L' } }, // Venlo
+    // Belgium
+    { 9736, TZ_EU_CENTRAL, { 'B', 'E' } }, // Brussels
+    { 9745, TZ_EU_CENTRAL, { 'B', 'E' } }, // Antwerp
+    { 9753, TZ_EU_CENTRAL, { 'B', 'E' } }, // Ghent
+    { 9759, TZ_EU_CENTRAL, { 'B', 'E' } }, // Charleroi
+    { 9769, TZ_EU_CENTRAL, { 'B', 'E' } }, // Liege
+    { 9775, TZ_EU_CENTRAL, { 'B', 'E' } }, // Bruges
+    { 9782, TZ_EU_CENTRAL, { 'B', 'E' } }, // Namur
+    { 9788, TZ_EU_CENTRAL, { 'B', 'E' } }, // Leuven
+    { 9795, TZ_EU_CENTRAL, { 'B', 'E' } }, // Mons
+    { 9800, TZ_EU_CENTRAL, { 'B', 'E' } }, // Aalst
+    { 9806, TZ_EU_CENTRAL, { 'B', 'E' } }, // Mechelen
+    { 9815, TZ_EU_CENTRAL, { 'B', 'E' } }, // La Louviere
+    { 9827, TZ_EU_CENTRAL, { 'B', 'E' } }, // Kortrijk
+    { 9836, TZ_EU_CENTRAL, { 'B', 'E' } }, // Hasselt
+    { 9844, TZ_EU_CENTRAL, { 'B', 'E' } }, // Sint-Niklaas
+    { 9857, TZ_EU_CENTRAL, { 'B', 'E' } }, // Oostende
+    { 9866, TZ_EU_CENTRAL, { 'B', 'E' } }, // Tournai
+    { 9874, TZ_EU_CENTRAL, { 'B', 'E' } }, // Genk
+    { 9879, TZ_EU_CENTRAL, { 'B', 'E' } }, // Seraing
+    { 9887, TZ_EU_CENTRAL, { 'B', 'E' } }, // Roeselare
+    // Switzerland
+    { 9897, TZ_EU_CENTRAL, { 'C', 'H' } }, // Zurich
+    { 9904, TZ_EU_CENTRAL, { 'C', 'H' } }, // Geneva
+    { 9911, TZ_EU_CENTRAL, { 'C', 'H' } }, // Basel
+    { 9917, TZ_EU_CENTRAL, { 'C', 'H' } }, // Bern
+    { 9922, TZ_EU_CENTRAL, { 'C', 'H' } }, // Lausanne
+    { 9931, TZ_EU_CENTRAL, { 'C', 'H' } }, // Winterthur
+    { 9942, TZ_EU_CENTRAL, { 'C', 'H' } }, // Lucerne
+    { 9950, TZ_EU_CENTRAL, { 'C', 'H' } }, // St. Gallen
+    { 9961, TZ_EU_CENTRAL, { 'C', 'H' } }, // Lugano
+    { 9968, TZ_EU_CENTRAL, { 'C', 'H' } }, // Biel/Bienne
+    { 9980, TZ_EU_CENTRAL, { 'C', 'H' } }, // Thun
+    { 9985, TZ_EU_CENTRAL, { 'C', 'H' } }, // Koniz
+    { 9991, TZ_EU_CENTRAL, { 'C', 'H' } }, // La Chaux-de-Fonds
+    { 10009, TZ_EU_CENTRAL, { 'C', 'H' } }, // Fribourg
+    { 10018, TZ_EU_CENTRAL, { 'C', 'H' } }, // Schaffhausen
+    { 10031, TZ_EU_CENTRAL, { 'C', 'H' } }, // Chur
+    { 10036, TZ_EU_CENTRAL, { 'C', 'H' } }, // Vernier
+    { 10044, TZ_EU_CENTRAL, { 'C', 'H' } }, // Neuchatel
+    { 10054, TZ_EU_CENTRAL, { 'C', 'H' } }, // Uster
+    { 10060, TZ_EU_CENTRAL, { 'C', 'H' } }, // Sion
+    // Austria
+    { 10065, TZ_EU_CENTRAL, { 'A', 'T' } }, // Vienna
+    { 10072, TZ_EU_CENTRAL, { 'A', 'T' } }, // Graz
+    { 10077, TZ_EU_CENTRAL, { 'A', 'T' } }, // Linz
+    { 10082, TZ_EU_CENTRAL, { 'A', 'T' } }, // Salzburg
+    { 10091, TZ_EU_CENTRAL, { 'A', 'T' } }, // Innsbruck
+    // Czech Republic
+    { 10101, TZ_EU_CENTRAL, { 'C', 'Z' } }, // Prague
+    { 10108, TZ_EU_CENTRAL, { 'C', 'Z' } }, // Brno
+    { 10113, TZ_EU_CENTRAL, { 'C', 'Z' } }, // Ostrava
+    { 10121, TZ_EU_CENTRAL, { 'C', 'Z' } }, // Plzen
+    { 10127, TZ_EU_CENTRAL, { 'C', 'Z' } }, // Liberec
+    { 10135, TZ_EU_CENTRAL, { 'C', 'Z' } }, // Olomouc
+    { 10143, TZ_EU_CENTRAL, { 'C', 'Z' } }, // Usti nad Labem
+    { 10158, TZ_EU_CENTRAL, { 'C', 'Z' } }, // Ceske Budejovice
+    { 10175, TZ_EU_CENTRAL, { 'C', 'Z' } }, // Hradec Kralove
+    { 10190, TZ_EU_CENTRAL, { 'C', 'Z' } }, // Pardubice
+    { 10200, TZ_EU_CENTRAL, { 'C', 'Z' } }, // Zlin
+    { 10205, TZ_EU_CENTRAL, { 'C', 'Z' } }, // Havirov
+    { 10213, TZ_EU_CENTRAL, { 'C', 'Z' } }, // Kladno
+    { 10220, TZ_EU_CENTRAL, { 'C', 'Z' } }, // Most
+    { 10225, TZ_EU_CENTRAL, { 'C', 'Z' } }, // Opava
+    { 10231, TZ_EU_CENTRAL, { 'C', 'Z' } }, // Frydek-Mistek
+    { 10245, TZ_EU_CENTRAL, { 'C', 'Z' } }, // Karviná
+    { 10254, TZ_EU_CENTRAL, { 'C', 'Z' } }, // Jihlava
+    { 10262, TZ_EU_CENTRAL, { 'C', 'Z' } }, // Teplice
+    { 10270, TZ_EU_CENTRAL, { 'C', 'Z' } }, // Decin
+    // Slovakia
+    { 10276, TZ_EU_CENTRAL, { 'S', 'K' } }, // Bratislava
+    { 10287, TZ_EU_CENTRAL, { 'S', 'K' } }, // Kosice
+    { 10294, TZ_EU_CENTRAL, { 'S', 'K' } }, // Presov
+    { 10301, TZ_EU_CENTRAL, { 'S', 'K' } }, // Zilina
+    { 10308, TZ_EU_CENTRAL, { 'S', 'K' } }, // Nitra
+    { 10314, TZ_EU_CENTRAL, { 'S', 'K' } }, // Banska Bystrica
+    { 10330, TZ_EU_CENTRAL, { 'S', 'K' } }, // Trnava
+    { 10337, TZ_EU_CENTRAL, { 'S', 'K' } }, // Martin
+    { 10344, TZ_EU_CENTRAL, { 'S', 'K' } }, // Trencin
+    { 10352, TZ_EU_CENTRAL, { 'S', 'K' } }, // Poprad
+    { 10359, TZ_EU_CENTRAL, { 'S', 'K' } }, // Prievidza
+    { 10369, TZ_EU_CENTRAL, { 'S', 'K' } }, // Zvolen
+    { 10376, TZ_EU_CENTRAL, { 'S', 'K' } }, // Nove Zamky
+    { 10387, TZ_EU_CENTRAL, { 'S', 'K' } }, // Michalovce
+    { 10398, TZ_EU_CENTRAL, { 'S', 'K' } }, // Spisska Nova Ves
+    // Hungary
+    { 10415, TZ_EU_CENTRAL, { 'H', 'U' } }, // Budapest
+    { 10424, TZ_EU_CENTRAL, { 'H', 'U' } }, // Debrecen
+    { 10433, TZ_EU_CENTRAL, { 'H', 'U' } }, // Szeged
+    { 10440, TZ_EU_CENTRAL, { 'H', 'U' } }, // Miskolc
+    { 10448, TZ_EU_CENTRAL, { 'H', 'U' } }, // Pecs
+    { 10453, TZ_EU_CENTRAL, { 'H', 'U' } }, // Gyor
+    { 10458, TZ_EU_CENTRAL, { 'H', 'U' } }, // Nyiregyhaza
+    { 10470, TZ_EU_CENTRAL, { 'H', 'U' } }, // Kecskemet
+    { 10480, TZ_EU_CENTRAL, { 'H', 'U' } }, // Szekesfehervar
+    { 10495, TZ_EU_CENTRAL, { 'H', 'U' } }, // Szombathely
+    { 10507, TZ_EU_CENTRAL, { 'H', 'U' } }, // Erd
+    { 10511, TZ_EU_CENTRAL, { 'H', 'U' } }, // Tatabanya
+    { 10521, TZ_EU_CENTRAL, { 'H', 'U' } }, // Kaposvar
+    { 10530, TZ_EU_CENTRAL, { 'H', 'U' } }, // Bekes
+    { 10536, TZ_EU_CENTRAL, { 'H', 'U' } }, // Veszprem
+    { 10545, TZ_EU_CENTRAL, { 'H', 'U' } }, // Zalaegerszeg
+    { 10558, TZ_EU_CENTRAL, { 'H', 'U' } }, // Sopron
+    { 10565, TZ_EU_CENTRAL, { 'H', 'U' } }, // Eger
+    { 10570, TZ_EU_CENTRAL, { 'H', 'U' } }, // Nagykanizsa
+    { 10582, TZ_EU_CENTRAL, { 'H', 'U' } }, // Dunakeszi
+    // Poland
+    { 10592, TZ_EU_CENTRAL, { 'P', 'L' } }, // Warsaw
+    { 10599, TZ_EU_CENTRAL, { 'P', 'L' } }, // Krakow
+    { 10606, TZ_EU_CENTRAL, { 'P', 'L' } }, // Lodz
+    { 10611, TZ_EU_CENTRAL, { 'P', 'L' } }, // Wroclaw
+    { 10619, TZ_EU_CENTRAL, { 'P', 'L' } }, // Poznan
+    { 10626, TZ_EU_CENTRAL, { 'P', 'L' } }, // Gdansk
+    { 10633, TZ_EU_CENTRAL, { 'P', 'L' } }, // Szczecin
+    { 10642, TZ_EU_CENTRAL, { 'P', 'L' } }, // Bydgoszcz
+    { 10652, TZ_EU_CENTRAL, { 'P', 'L' } }, // Lublin
+    { 10659, TZ_EU_CENTRAL, { 'P', 'L' } }, // Katowice
+    { 10668, TZ_EU_CENTRAL, { 'P', 'L' } }, // Bialystok
+    { 10678, TZ_EU_CENTRAL, { 'P', 'L' } }, // Gdynia
+    { 10685, TZ_EU_CENTRAL, { 'P', 'L' } }, // Czestochowa
+    { 10697, TZ_EU_CENTRAL, { 'P', 'L' } }, // Radom
+    { 10703, TZ_EU_CENTRAL, { 'P', 'L' } }, // Sosnowiec
+    { 10713, TZ_EU_CENTRAL, { 'P', 'L' } }, // Torun
+    { 10719, TZ_EU_CENTRAL, { 'P', 'L' } }, // Kielce
+    { 10726, TZ_EU_CENTRAL, { 'P', 'L' } }, // Gliwice
+    { 10734, TZ_EU_CENTRAL, { 'P', 'L' } }, // Zabrze
+    { 10741, TZ_EU_CENTRAL, { 'P', 'L' } }, // Bytom
+    { 10747, TZ_EU_CENTRAL, { 'P', 'L' } }, // Bielsko-Biala
+    { 10761, TZ_EU_CENTRAL, { 'P', 'L' } }, // Olsztyn
+    { 10769, TZ_EU_CENTRAL, { 'P', 'L' } }, // Rzeszow
+    { 10777, TZ_EU_CENTRAL, { 'P', 'L' } }, // Ruda Slaska
+    { 10789, TZ_EU_CENTRAL, { 'P', 'L' } }, // Rybnik
+    { 10796, TZ_EU_CENTRAL, { 'P', 'L' } }, // Tychy
+    { 10802, TZ_EU_CENTRAL, { 'P', 'L' } }, // Dabrowa Gornicza
+    { 10819, TZ_EU_CENTRAL, { 'P', 'L' } }, // Plock
+    { 10825, TZ_EU_CENTRAL, { 'P', 'L' } }, // Elblag
+    { 10832, TZ_EU_CENTRAL, { 'P', 'L' } }, // Opole
+    { 10838, TZ_EU_CENTRAL, { 'P', 'L' } }, // Walbrzych
+    { 10848, TZ_EU_CENTRAL, { 'P', 'L' } }, // Zielona Gora
+    { 10861, TZ_EU_CENTRAL, { 'P', 'L' } }, // Tarnow
+    { 10868, TZ_EU_CENTRAL, { 'P', 'L' } }, // Chorzow
+    { 10876, TZ_EU_CENTRAL, { 'P', 'L' } }, // Kalisz
+    { 10883, TZ_EU_CENTRAL, { 'P', 'L' } }, // Koszalin
+    { 10892, TZ_EU_CENTRAL, { 'P', 'L' } }, // Legnica
+    // Romania
+    { 10900, TZ_EU_EASTERN, { 'R', 'O' } }, // Bucharest
+    { 10910, TZ_EU_EASTERN, { 'R', 'O' } }, // Cluj-Napoca
+    { 10922, TZ_EU_EASTERN, { 'R', 'O' } }, // Timisoara
+    { 10932, TZ_EU_EASTERN, { 'R', 'O' } }, // Iasi
+    { 10937, TZ_EU_EASTERN, { 'R', 'O' } }, // Constanta
+    // Bulgaria
+    { 10947, TZ_EU_EASTERN, { 'B', 'G' } }, // Sofia
+    { 10953, TZ_EU_EASTERN, { 'B', 'G' } }, // Plovdiv
+    { 10961, TZ_EU_EASTERN, { 'B', 'G' } }, // Varna
+    { 10967, TZ_EU_EASTERN, { 'B', 'G' } }, // Burgas
+    // Serbia
+    { 10974, TZ_EU_CENTRAL, { 'R', 'S' } }, // Belgrade
+    { 10983, TZ_EU_CENTRAL, { 'R', 'S' } }, // Novi Sad
+    { 10992, TZ_EU_CENTRAL, { 'R', 'S' } }, // Nis
+    // Croatia
+    { 10996, TZ_EU_CENTRAL, { 'H', 'R' } }, // Zagreb
+    { 11003, TZ_EU_CENTRAL, { 'H', 'R' } }, // Split
+    { 11009, TZ_EU_CENTRAL, { 'H', 'R' } }, // Rijeka
+    { 11016, TZ_EU_CENTRAL, { 'H', 'R' } }, // Osijek
+    // Bosnia and Herzegovina
+    { 11023, TZ_EU_CENTRAL, { 'B', 'A' } }, // Sarajevo
+    { 11032, TZ_EU_CENTRAL, { 'B', 'A' } }, // Banja Luka
+    { 11043, TZ_EU_CENTRAL, { 'B', 'A' } }, // Tuzla
+    // Slovenia
+    { 11049, TZ_EU_CENTRAL, { 'S', 'I' } }, // Ljubljana
+    { 11059, TZ_EU_CENTRAL, { 'S', 'I' } }, // Maribor
+    // North Macedonia
+    { 11067, TZ_EU_CENTRAL, { 'M', 'K' } }, // Skopje
+    { 11074, TZ_EU_CENTRAL, { 'M', 'K' } }, // Bitola
+    // Montenegro
+    { 11081, TZ_EU_CENTRAL, { 'M', 'E' } }, // Podgorica
+    // Albania
+    { 11091, TZ_EU_CENTRAL, { 'A', 'L' } }, // Tirana
+    { 11098, TZ_EU_CENTRAL, { 'A', 'L' } }, // Durres
+    // Kosovo
+    { 11105, TZ_EU_CENTRAL, { 'X', 'K' } }, // Pristina
+    // Greece
+    { 11114, TZ_EU_EASTERN, { 'G', 'R' } }, // Athens
+    { 11121, TZ_EU_EASTERN, { 'G', 'R' } }, // Thessaloniki
+    { 11134, TZ_EU_EASTERN, { 'G', 'R' } }, // Patras
+    { 11141, TZ_EU_EASTERN, { 'G', 'R' } }, // Heraklion
+    // Cyprus
+    { 11151, TZ_EU_EASTERN, { 'C', 'Y' } }, // Nicosia
+    { 11159, TZ_EU_EASTERN, { 'C', 'Y' } }, // Limassol
+    // Malta
+    { 11168, TZ_EU_CENTRAL, { 'M', 'T' } }, // Valletta
+    // Nordic Countries
+    // Sweden
+    { 11177, TZ_EU_CENTRAL, { 'S', 'E' } }, // Stockholm
+    { 11187, TZ_EU_CENTRAL, { 'S', 'E' } }, // Gothenburg
+    { 11198, TZ_EU_CENTRAL, { 'S', 'E' } }, // Malmo
+    { 11204, TZ_EU_CENTRAL, { 'S', 'E' } }, // Uppsala
+    { 11212, TZ_EU_CENTRAL, { 'S', 'E' } }, // Vasteras
+    { 11221, TZ_EU_CENTRAL, { 'S', 'E' } }, // Orebro
+    { 11228, TZ_EU_CENTRAL, { 'S', 'E' } }, // Linkoping
+    { 11238, TZ_EU_CENTRAL, { 'S', 'E' } }, // Helsingborg
+    { 11250, TZ_EU_CENTRAL, { 'S', 'E' } }, // Jonkoping
+    { 11260, TZ_EU_CENTRAL, { 'S', 'E' } }, // Norrkoping
+    { 11271, TZ_EU_CENTRAL, { 'S', 'E' } }, // Lund
+    { 11276, TZ_EU_CENTRAL, { 'S', 'E' } }, // Umea
+    { 11281, TZ_EU_CENTRAL, { 'S', 'E' } }, // Gavle
+    { 11287, TZ_EU_CENTRAL, { 'S', 'E' } }, // Boras
+    { 11293, TZ_EU_CENTRAL, { 'S', 'E' } }, // Sodertalje
+    { 11304, TZ_EU_CENTRAL, { 'S', 'E' } }, // Eskilstuna
+    { 11315, TZ_EU_CENTRAL, { 'S', 'E' } }, // Karlstad
+    { 11324, TZ_EU_CENTRAL, { 'S', 'E' } }, // Taby
+    { 11329, TZ_EU_CENTRAL, { 'S', 'E' } }, // Vaxjo
+    { 11335, TZ_EU_CENTRAL, { 'S', 'E' } }, // Halmstad
+    { 11344, TZ_EU_CENTRAL, { 'S', 'E' } }, // Sundsvall
+    { 11354, TZ_EU_CENTRAL, { 'S', 'E' } }, // Lulea
+    { 11360, TZ_EU_CENTRAL, { 'S', 'E' } }, // Trollhattan
+    { 11372, TZ_EU_CENTRAL, { 'S', 'E' } }, // Kristianstad
+    { 11385, TZ_EU_CENTRAL, { 'S', 'E' } }, // Uddevalla
+    // Norway
+    { 11395, TZ_EU_CENTRAL, { 'N', 'O' } }, // Oslo
+    { 11400, TZ_EU_CENTRAL, { 'N', 'O' } }, // Bergen
+    { 11407, TZ_EU_CENTRAL, { 'N', 'O' } }, // Trondheim
+    { 11417, TZ_EU_CENTRAL, { 'N', 'O' } }, // Stavanger
+    { 11427, TZ_EU_CENTRAL, { 'N', 'O' } }, // Baerum
+    { 11434, TZ_EU_CENTRAL, { 'N', 'O' } }, // Kristiansand
+    { 11447, TZ_EU_CENTRAL, { 'N', 'O' } }, // Fredrikstad
+    { 11459, TZ_EU_CENTRAL, { 'N', 'O' } }, // Sandnes
+    { 11467, TZ_EU_CENTRAL, { 'N', 'O' } }, // Tromsø
+    { 11475, TZ_EU_CENTRAL, { 'N', 'O' } }, // Sarpsborg
+    { 11485, TZ_EU_CENTRAL, { 'N', 'O' } }, // Skien
+    { 11491, TZ_EU_CENTRAL, { 'N', 'O' } }, // Ålesund
+    { 11500, TZ_EU_CENTRAL, { 'N', 'O' } }, // Tonsberg
+    { 11509, TZ_EU_CENTRAL, { 'N', 'O' } }, // Moss
+    { 11514, TZ_EU_CENTRAL, { 'N', 'O' } }, // Haugesund
+    { 11524, TZ_EU_CENTRAL, { 'N', 'O' } }, // Sandefjord
+    { 11535, TZ_EU_CENTRAL, { 'N', 'O' } }, // Arendal
+    { 11543, TZ_EU_CENTRAL, { 'N', 'O' } }, // Bodø
+    { 11549, TZ_EU_CENTRAL, { 'N', 'O' } }, // Drammen
+    { 11557, TZ_EU_CENTRAL, { 'N', 'O' } }, // Asker
+    { 11563, TZ_EU_CENTRAL, { 'N', 'O' } }, // Lillehammer
+    { 11575, TZ_EU_CENTRAL, { 'N', 'O' } }, // Mo i Rana
+    // Denmark
+    { 11585, TZ_EU_CENTRAL, { 'D', 'K' } }, // Copenhagen
+    { 11596, TZ_EU_CENTRAL, { 'D', 'K' } }, // Aarhus
+    { 11603, TZ_EU_CENTRAL, { 'D', 'K' } }, // Odense
+    { 11610, TZ_EU_CENTRAL, { 'D', 'K' } }, // Aalborg
+    { 11618, TZ_EU_CENTRAL, { 'D', 'K' } }, // Esbjerg
+    { 11626, TZ_EU_CENTRAL, { 'D', 'K' } }, // Randers
+    { 11634, TZ_EU_CENTRAL, { 'D', 'K' } }, // Kolding
+    { 11642, TZ_EU_CENTRAL, { 'D', 'K' } }, // Horsens
+    { 11650, TZ_EU_CENTRAL, { 'D', 'K' } }, // Vejle
+    { 11656, TZ_EU_CENTRAL, { 'D', 'K' } }, // Roskilde
+    { 11665, TZ_EU_CENTRAL, { 'D', 'K' } }, // Herning
+    { 11673, TZ_EU_CENTRAL, { 'D', 'K' } }, // Silkeborg
+    { 11683, TZ_EU_CENTRAL, { 'D', 'K' } }, // Naestved
+    { 11692, TZ_EU_CENTRAL, { 'D', 'K' } }, // Fredericia
+    { 11703, TZ_EU_CENTRAL, { 'D', 'K' } }, // Viborg
+    { 11710, TZ_EU_CENTRAL, { 'D', 'K' } }, // Køge
+    { 11716, TZ_EU_CENTRAL, { 'D', 'K' } }, // Holstebro
+    { 11726, TZ_EU_CENTRAL, { 'D', 'K' } }, // Taastrup
+    { 11735, TZ_EU_CENTRAL, { 'D', 'K' } }, // Slagelse
+    { 11744, TZ_EU_CENTRAL, { 'D', 'K' } }, // Hillerød
+    // Finland
+    { 11754, TZ_EU_EASTERN, { 'F', 'I' } }, // Helsinki
+    { 11763, TZ_EU_EASTERN, { 'F', 'I' } }, // Espoo
+    { 11769, TZ_EU_EASTERN, { 'F', 'I' } }, // Tampere
+    { 11777, TZ_EU_EASTERN, { 'F', 'I' } }, // Vantaa
+    { 11784, TZ_EU_EASTERN, { 'F', 'I' } }, // Turku
+    { 11790, TZ_EU_EASTERN, { 'F', 'I' } }, // Oulu
+    { 11795, TZ_EU_EASTERN, { 'F', 'I' } }, // Lahti
+    { 11801, TZ_EU_EASTERN, { 'F', 'I' } }, // Kuopio
+    { 11808, TZ_EU_EASTERN, { 'F', 'I' } }, // Jyvaskyla
+    { 11818, TZ_EU_EASTERN, { 'F', 'I' } }, // Pori
+    { 11823, TZ_EU_EASTERN, { 'F', 'I' } }, // Lappeenranta
+    { 11836, TZ_EU_EASTERN, { 'F', 'I' } }, // Vaasa
+    { 11842, TZ_EU_EASTERN, { 'F', 'I' } }, // Joensuu
+    { 11850, TZ_EU_EASTERN, { 'F', 'I' } }, // Hameenlinna
+    { 11862, TZ_EU_EASTERN, { 'F', 'I' } }, // Kotka
+    { 11868, TZ_EU_EASTERN, { 'F', 'I' } }, // Seinajoki
+    { 11878, TZ_EU_EASTERN, { 'F', 'I' } }, // Rovaniemi
+    { 11888, TZ_EU_EASTERN, { 'F', 'I' } }, // Mikkeli
+    { 11896, TZ_EU_EASTERN, { 'F', 'I' } }, // Kouvola
+    { 11904, TZ_EU_EASTERN, { 'F', 'I' } }, // Porvoo
+    { 11911, TZ_EU_EASTERN, { 'F', 'I' } }, // Rauma
+    { 11917, TZ_EU_EASTERN, { 'F', 'I' } }, // Savonlinna
+    // Iceland
+    { 11928, TZ_UTC, { 'I', 'S' } }, // Reykjavik
+    // Baltic States
+    // Lithuania
+    { 11938, TZ_EU_EASTERN, { 'L', 'T' } }, // Vilnius
+    { 11946, TZ_EU_EASTERN, { 'L', 'T' } }, // Kaunas
+    { 11953, TZ_EU_EASTERN, { 'L', 'T' } }, // Klaipeda
+    // Latvia
+    { 11962, TZ_EU_EASTERN, { 'L', 'V' } }, // Riga
+    { 11967, TZ_EU_EASTERN, { 'L', 'V' } }, // Daugavpils
+    { 11978, TZ_EU_EASTERN, { 'L', 'V' } }, // Liepaja
+    // Estonia
+    { 11986, TZ_EU_EASTERN, { 'E', 'E' } }, // Tallinn
+    { 11994, TZ_EU_EASTERN, { 'E', 'E' } }, // Tartu
+    { 12000, TZ_EU_EASTERN, { 'E', 'E' } }, // Narva
+    // Eastern Europe
+    // Ukraine
+    { 12006, TZ_EU_EASTERN, { 'U', 'A' } }, // Kiev
+    { 12011, TZ_EU_EASTERN, { 'U', 'A' } }, // Kharkiv
+    { 12019, TZ_EU_EASTERN, { 'U', 'A' } }, // Odessa
+    { 12026, TZ_EU_EASTERN, { 'U', 'A' } }, // Dnipro
+    { 12033, TZ_EU_EASTERN, { 'U', 'A' } }, // Lviv
+    // Belarus
+    { 12038, TZ_UTC_P3, { 'B', 'Y' } }, // Minsk
+    { 12044, TZ_UTC_P3, { 'B', 'Y' } }, // Gomel
+    { 12050, TZ_UTC_P3, { 'B', 'Y' } }, // Mogilev
+    // Moldova
+    { 12058, TZ_MOLDOVA, { 'M', 'D' } }, // Chisinau
+    { 12067, TZ_MOLDOVA, { 'M', 'D' } }, // Tiraspol
+    // Americas
+    // United States
+    { 12076, TZ_US_EASTERN, { 'U', 'S' } }, // New York
+    { 12085, TZ_US_PACIFIC, { 'U', 'S' } }, // Los Angeles
+    { 12097, TZ_US_CENTRAL, { 'U', 'S' } }, // Chicago
+    { 12105, TZ_US_CENTRAL, { 'U', 'S' } }, // Houston
+    { 16740, TZ_UTC_M7, { 'U', 'S' } }, // Phoenix
+    { 12113, TZ_US_EASTERN, { 'U', 'S' } }, // Philadelphia
+    { 12126, TZ_US_CENTRAL, { 'U', 'S' } }, // San Antonio
+    { 12138, TZ_US_PACIFIC, { 'U', 'S' } }, // San Diego
+    { 12148, TZ_US_CENTRAL, { 'U', 'S' } }, // Dallas
+    { 12155, TZ_US_PACIFIC, { 'U', 'S' } }, // San Jose
+    { 12164, TZ_US_CENTRAL, { 'U', 'S' } }, // Austin
+    { 12171, TZ_US_EASTERN, { 'U', 'S' } }, // Jacksonville
+    { 12184, TZ_US_CENTRAL, { 'U', 'S' } }, // Fort Worth
+    { 12195, TZ_US_EASTERN, { 'U', 'S' } }, // Columbus
+    { 12204, TZ_US_EASTERN, { 'U', 'S' } }, // Charlotte
+    { 12214, TZ_US_PACIFIC, { 'U', 'S' } }, // San Francisco
+    { 12228, TZ_US_EASTERN, { 'U', 'S' } }, // Indianapolis
+    { 12241, TZ_US_PACIFIC, { 'U', 'S' } }, // Seattle
+    { 12249, TZ_US_MOUNTAIN, { 'U', 'S' } }, // Denver
+    { 12256, TZ_US_EASTERN, { 'U', 'S' } }, // Washington
+    { 12267, TZ_US_EASTERN, { 'U', 'S' } }, // Boston
+    { 12274, TZ_US_MOUNTAIN, { 'U', 'S' } }, // El Paso
+    { 2186, TZ_US_CENTRAL, { 'U', 'S' } }, // Nashville
+    { 12282, TZ_US_EASTERN, { 'U', 'S' } }, // Detroit
+    { 12290, TZ_US_CENTRAL, { 'U', 'S' } }, // Oklahoma City
+    { 12304, TZ_US_PACIFIC, { 'U', 'S' } }, // Portland
+    { 12313, TZ_US_PACIFIC, { 'U', 'S' } }, // Las Vegas
+    { 12323, TZ_US_CENTRAL, { 'U', 'S' } }, // Memphis
+    { 12331, TZ_US_EASTERN, { 'U', 'S' } }, // Louisville
+    { 12342, TZ_US_EASTERN, { 'U', 'S' } }, // Baltimore
+    { 12352, TZ_US_CENTRAL, { 'U', 'S' } }, // Milwaukee
+    { 12362, TZ_US_MOUNTAIN, { 'U', 'S' } }, // Albuquerque
+    { 12374, TZ_UTC_M7, { 'U', 'S' } }, // Tucson
+    { 12381, TZ_US_PACIFIC, { 'U', 'S' } }, // Fresno
+    { 12388, TZ_US_PACIFIC, { 'U', 'S' } }, // Sacramento
+    { 12399, TZ_UTC_M7, { 'U', 'S' } }, // Mesa
+    { 12404, TZ_US_CENTRAL, { 'U', 'S' } }, // Kansas City
+    { 12416, TZ_US_EASTERN, { 'U', 'S' } }, // Atlanta
+    { 12424, TZ_US_PACIFIC, { 'U', 'S' } }, // Long Beach
+    { 12435, TZ_US_MOUNTAIN, { 'U', 'S' } }, // Colorado Springs
+    { 12452, TZ_US_EASTERN, { 'U', 'S' } }, // Raleigh
+    { 12460, TZ_US_EASTERN, { 'U', 'S' } }, // Miami
+    { 12466, TZ_US_EASTERN, { 'U', 'S' } }, // Virginia Beach
+    { 12481, TZ_US_CENTRAL, { 'U', 'S' } }, // Omaha
+    { 12487, TZ_US_PACIFIC, { 'U', 'S' } }, // Oakland
+    { 12495, TZ_US_CENTRAL, { 'U', 'S' } }, // Minneapolis
+    { 12507, TZ_US_CENTRAL, { 'U', 'S' } }, // Tulsa
+    { 12513, TZ_US_CENTRAL, { 'U', 'S' } }, // Arlington
+    { 12523, TZ_US_CENTRAL, { 'U', 'S' } }, // New Orleans
+    { 12535, TZ_US_CENTRAL, { 'U', 'S' } }, // Wichita
+    { 12543, TZ_US_EASTERN, { 'U', 'S' } }, // Cleveland
+    { 12553, TZ_US_EASTERN, { 'U', 'S' } }, // Tampa
+    { 12559, TZ_US_PACIFIC, { 'U', 'S' } }, // Bakersfield
+    { 12571, TZ_US_MOUNTAIN, { 'U', 'S' } }, // Aurora
+    { 12578, TZ_UTC_M10, { 'U', 'S' } }, // Honolulu
+    { 12587, TZ_US_PACIFIC, { 'U', 'S' } }, // Anaheim
+    { 12595, TZ_US_PACIFIC, { 'U', 'S' } }, // Santa Ana
+    { 12605, TZ_US_CENTRAL, { 'U', 'S' } }, // Corpus Christi
+    { 12620, TZ_US_PACIFIC, { 'U', 'S' } }, // Riverside
+    { 12630, TZ_US_EASTERN, { 'U', 'S' } }, // Lexington
+    { 12640, TZ_US_PACIFIC, { 'U', 'S' } }, // Stockton
+    { 12649, TZ_US_PACIFIC, { 'U', 'S' } }, // Henderson
+    { 12659, TZ_US_CENTRAL, { 'U', 'S' } }, // Saint Paul
+    { 12670, TZ_US_CENTRAL, { 'U', 'S' } }, // St. Louis
+    { 12680, TZ_US_EASTERN, { 'U', 'S' } }, // Cincinnati
+    { 12691, TZ_US_EASTERN, { 'U', 'S' } }, // Pittsburgh
+    // Canada
+    { 12702, TZ_US_EASTERN, { 'C', 'A' } }, // Toronto
+    { 12710, TZ_US_EASTERN, { 'C', 'A' } }, // Montreal
+    { 12719, TZ_US_PACIFIC, { 'C', 'A' } }, // Vancouver
+    { 12729, TZ_US_MOUNTAIN, { 'C', 'A' } }, // Calgary
+    { 12737, TZ_US_MOUNTAIN, { 'C', 'A' } }, // Edmonton
+    { 12746, TZ_US_EASTERN, { 'C', 'A' } }, // Ottawa
+    { 12753, TZ_US_CENTRAL, { 'C', 'A' } }, // Winnipeg
+    { 12762, TZ_US_EASTERN, { 'C', 'A' } }, // Quebec City
+    { 12774, TZ_US_EASTERN, { 'C', 'A' } }, // Hamilton
+    { 12783, TZ_US_EASTERN, { 'C', 'A' } }, // Kitchener
+    { 13984, TZ_US_EASTERN, { 'C', 'A' } }, // London
+    { 12793, TZ_US_ATLANTIC, { 'C', 'A' } }, // Halifax
+    // Mexico
+    { 12801, TZ_UTC_M6, { 'M', 'X' } }, // Mexico City
+    { 12813, TZ_UTC_M6, { 'M', 'X' } }, // Guadalajara
+    { 12825, TZ_UTC_M6, { 'M', 'X' } }, // Monterrey
+    { 12835, TZ_UTC_M6, { 'M', 'X' } }, // Puebla
+    { 12842, TZ_US_PACIFIC, { 'M', 'X' } }, // Tijuana
+    { 12850, TZ_UTC_M6, { 'M', 'X' } }, // León
+    { 12856, TZ_US_MOUNTAIN, { 'M', 'X' } }, // Juárez
+    { 12864, TZ_UTC_M6, { 'M', 'X' } }, // Zapopan
+    { 12872, TZ_UTC_M6, { 'M', 'X' } }, // Nezahualcóyotl
+    { 12888, TZ_UTC_M6, { 'M', 'X' } }, // Chihuahua
+    // Brazil
+    { 12898, TZ_UTC_M3, { 'B', 'R' } }, // São Paulo
+    { 12909, TZ_UTC_M3, { 'B', 'R' } }, // Rio de Janeiro
+    { 12924, TZ_UTC_M3, { 'B', 'R' } }, // Brasília
+    { 13456, TZ_UTC_M3, { 'B', 'R' } }, // Salvador
+    { 12934, TZ_UTC_M3, { 'B', 'R' } }, // Fortaleza
+    { 12944, TZ_UTC_M3, { 'B', 'R' } }, // Belo Horizonte
+    { 12959, TZ_UTC_M4, { 'B', 'R' } }, // Manaus
+    { 12966, TZ_UTC_M3, { 'B', 'R' } }, // Curitiba
+    { 12975, TZ_UTC_M3, { 'B', 'R' } }, // Recife
+    { 12982, TZ_UTC_M3, { 'B', 'R' } }, // Goiânia
+    { 12991, TZ_UTC_M3, { 'B', 'R' } }, // Belém
+    { 12998, TZ_UTC_M3, { 'B', 'R' } }, // Porto Alegre
+    { 13011, TZ_UTC_M3, { 'B', 'R' } }, // Guarulhos
+    { 13021, TZ_UTC_M3, { 'B', 'R' } }, // Campinas
+    { 13030, TZ_UTC_M3, { 'B', 'R' } }, // São Luís
+    // Argentina
+    { 13041, TZ_UTC_M3, { 'A', 'R' } }, // Buenos Aires
+    { 13054, TZ_UTC_M3, { 'A', 'R' } }, // Córdoba
+    { 13063, TZ_UTC_M3, { 'A', 'R' } }, // Rosario
+    { 13071, TZ_UTC_M3, { 'A', 'R' } }, // Mendoza
+    { 13079, TZ_UTC_M3, { 'A', 'R' } }, // La Plata
+    { 13088, TZ_UTC_M3, { 'A', 'R' } }, // San Miguel de Tucumán
+    { 13111, TZ_UTC_M3, { 'A', 'R' } }, // Mar del Plata
+    { 13125, TZ_UTC_M3, { 'A', 'R' } }, // Salta
+    { 13131, TZ_UTC_M3, { 'A', 'R' } }, // Santa Fe
+    // Colombia
+    { 13140, TZ_UTC_M5, { 'C', 'O' } }, // Bogotá
+    { 13148, TZ_UTC_M5, { 'C', 'O' } }, // Medellín
+    { 13158, TZ_UTC_M5, { 'C', 'O' } }, // Cali
+    { 13163, TZ_UTC_M5, { 'C', 'O' } }, // Barranquilla
+    { 8990, TZ_UTC_M5, { 'C', 'O' } }, // Cartagena
+    // Peru
+    { 13176, TZ_UTC_M5, { 'P', 'E' } }, // Lima
+    { 13181, TZ_UTC_M5, { 'P', 'E' } }, // Arequipa
+    { 13190, TZ_UTC_M5, { 'P', 'E' } }, // Trujillo
+    { 13199, TZ_UTC_M5, { 'P', 'E' } }, // Chiclayo
+    { 13208, TZ_UTC_M5, { 'P', 'E' } }, // Cusco
+    // Chile
+    { 13214, TZ_CHILE, { 'C', 'L' } }, // Santiago
+    { 13223, TZ_CHILE, { 'C', 'L' } }, // Valparaíso
+    { 13235, TZ_CHILE, { 'C', 'L' } }, // Concepción
+    { 13247, TZ_CHILE, { 'C', 'L' } }, // La Serena
+    { 13257, TZ_CHILE, { 'C', 'L' } }, // Antofagasta
+    // Ecuador
+    { 13269, TZ_UTC_M5, { 'E', 'C' } }, // Quito
+    { 13275, TZ_UTC_M5, { 'E', 'C' } }, // Guayaquil
+    { 13285, TZ_UTC_M5, { 'E', 'C' } }, // Cuenca
+    // Venezuela
+    { 13292, TZ_UTC_M4, { 'V', 'E' } }, // Caracas
+    { 13300, TZ_UTC_M4, { 'V', 'E' } }, // Maracaibo
+    { 8820, TZ_UTC_M4, { 'V', 'E' } }, // Valencia
+    { 13310, TZ_UTC_M4, { 'V', 'E' } }, // Barquisimeto
+    // Uruguay
+    { 13323, TZ_UTC_M3, { 'U', 'Y' } }, // Montevideo
+    { 13334, TZ_UTC_M3, { 'U', 'Y' } }, // Salto
+    // Paraguay
+    { 13340, TZ_UTC_M3, { 'P', 'Y' } }, // Asunción
+    { 13350, TZ_UTC_M3, { 'P', 'Y' } }, // Ciudad del Este
+    // Bolivia
+    { 13366, TZ_UTC_M4, { 'B', 'O' } }, // La Paz
+    { 13373, TZ_UTC_M4, { 'B', 'O' } }, // Santa Cruz
+    { 13384, TZ_UTC_M4, { 'B', 'O' } }, // Cochabamba
+    // Guyana
+    { 13395, TZ_UTC_M4, { 'G', 'Y' } }, // Georgetown
+    // Suriname
+    { 13406, TZ_UTC_M3, { 'S', 'R' } }, // Paramaribo
+    // French Guiana
+    { 13417, TZ_UTC_M3, { 'G', 'F' } }, // Cayenne
+    // Central America
+    // Guatemala
+    { 13425, TZ_UTC_M6, { 'G', 'T' } }, // Guatemala City
+    // Belize
+    { 13440, TZ_UTC_M6, { 'B', 'Z' } }, // Belize City
+    // El Salvador
+    { 13452, TZ_UTC_M6, { 'S', 'V' } }, // San Salvador
+    // Honduras
+    { 13465, TZ_UTC_M6, { 'H', 'N' } }, // Tegucigalpa
+    // Nicaragua
+    { 13477, TZ_UTC_M6, { 'N', 'I' } }, // Managua
+    // Costa Rica
+    { 13485, TZ_UTC_M6, { 'C', 'R' } }, // San José
+    // Panama
+    { 13495, TZ_UTC_M5, { 'P', 'A' } }, // Panama City
+    // Caribbean
+    // Cuba
+    { 13507, TZ_CUBA, { 'C', 'U' } }, // Havana
+    { 13514, TZ_CUBA, { 'C', 'U' } }, // Santiago de Cuba
+    // Jamaica
+    { 13531, TZ_UTC_M5, { 'J', 'M' } }, // Kingston
+    // Haiti
+    { 13540, TZ_US_EASTERN, { 'H', 'T' } }, // Port-au-Prince
+    // Dominican Republic
+    { 13555, TZ_UTC_M4, { 'D', 'O' } }, // Santo Domingo
+    // Puerto Rico
+    { 13569, TZ_UTC_M4, { 'P', 'R' } }, // San Juan
+    // Trinidad and Tobago
+    { 13578, TZ_UTC_M4, { 'T', 'T' } }, // Port of Spain
+    // Barbados
+    { 13592, TZ_UTC_M4, { 'B', 'B' } }, // Bridgetown
+    // Africa
+    // Nigeria
+    { 13603, TZ_UTC_P1, { 'N', 'G' } }, // Lagos
+    { 13609, TZ_UTC_P1, { 'N', 'G' } }, // Abuja
+    { 13615, TZ_UTC_P1, { 'N', 'G' } }, // Kano
+    { 13620, TZ_UTC_P1, { 'N', 'G' } }, // Ibadan
+    { 13627, TZ_UTC_P1, { 'N', 'G' } }, // Port Harcourt
+    { 13641, TZ_UTC_P1, { 'N', 'G' } }, // Benin City
+    { 13652, TZ_UTC_P1, { 'N', 'G' } }, // Maiduguri
+    { 13662, TZ_UTC_P1, { 'N', 'G' } }, // Zaria
+    { 13668, TZ_UTC_P1, { 'N', 'G' } }, // Aba
+    { 13672, TZ_UTC_P1, { 'N', 'G' } }, // Jos
+    { 13676, TZ_UTC_P1, { 'N', 'G' } }, // Ilorin
+    { 13683, TZ_UTC_P1, { 'N', 'G' } }, // Oyo
+    { 13687, TZ_UTC_P1, { 'N', 'G' } }, // Enugu
+    { 13693, TZ_UTC_P1, { 'N', 'G' } }, // Abeokuta
+    { 13702, TZ_UTC_P1, { 'N', 'G' } }, // Kaduna
+    { 13709, TZ_UTC_P1, { 'N', 'G' } }, // Ogbomoso
+    { 13718, TZ_UTC_P1, { 'N', 'G' } }, // Sokoto
+    { 13725, TZ_UTC_P1, { 'N', 'G' } }, // Onitsha
+    { 13733, TZ_UTC_P1, { 'N', 'G' } }, // Warri
+    { 13739, TZ_UTC_P1, { 'N', 'G' } }, // Okene
+    { 13745, TZ_UTC_P1, { 'N', 'G' } }, // Calabar
+    { 13753, TZ_UTC_P1, { 'N', 'G' } }, // Uyo
+    { 13757, TZ_UTC_P1, { 'N', 'G' } }, // Katsina
+    { 13765, TZ_UTC_P1, { 'N', 'G' } }, // Ado-Ekiti
+    { 13775, TZ_UTC_P1, { 'N', 'G' } }, // Bauchi
+    { 13782, TZ_UTC_P1, { 'N', 'G' } }, // Ikeja
+    { 13788, TZ_UTC_P1, { 'N', 'G' } }, // Makurdi
+    { 13796, TZ_UTC_P1, { 'N', 'G' } }, // Minna
+    { 13802, TZ_UTC_P1, { 'N', 'G' } }, // Effon-Alaiye
+    { 13815, TZ_UTC_P1, { 'N', 'G' } }, // Ilesa
+    { 13821, TZ_UTC_P1, { 'N', 'G' } }, // Akure
+    { 13827, TZ_UTC_P1, { 'N', 'G' } }, // Ikere-Ekiti
+    { 13839, TZ_UTC_P1, { 'N', 'G' } }, // Oghara
+    { 13846, TZ_UTC_P1, { 'N', 'G' } }, // Iseyin
+    { 13853, TZ_UTC_P1, { 'N', 'G' } }, // Sango Ota
+    { 13863, TZ_UTC_P1, { 'N', 'G' } }, // Owo
+    { 13867, TZ_UTC_P1, { 'N', 'G' } }, // Iwo
+    { 13871, TZ_UTC_P1, { 'N', 'G' } }, // Ikirun
+    { 13878, TZ_UTC_P1, { 'N', 'G' } }, // Shagamu
+    { 13886, TZ_UTC_P1, { 'N', 'G' } }, // Jimeta
+    // South Africa
+    { 13893, TZ_UTC_P2, { 'Z', 'A' } }, // Johannesburg
+    { 13906, TZ_UTC_P2, { 'Z', 'A' } }, // Cape Town
+    { 13916, TZ_UTC_P2, { 'Z', 'A' } }, // Durban
+    { 13923, TZ_UTC_P2, { 'Z', 'A' } }, // Pretoria
+    { 13932, TZ_UTC_P2, { 'Z', 'A' } }, // Port Elizabeth
+    { 13947, TZ_UTC_P2, { 'Z', 'A' } }, // Pietermaritzburg
+    { 13964, TZ_UTC_P2, { 'Z', 'A' } }, // Benoni
+    { 13971, TZ_UTC_P2, { 'Z', 'A' } }, // Tembisa
+    { 13979, TZ_UTC_P2, { 'Z', 'A' } }, // East London
+    { 13991, TZ_UTC_P2, { 'Z', 'A' } }, // Vereeniging
+    { 14003, TZ_UTC_P2, { 'Z', 'A' } }, // Bloemfontein
+    { 14016, TZ_UTC_P2, { 'Z', 'A' } }, // Boksburg
+    { 14025, TZ_UTC_P2, { 'Z', 'A' } }, // Welkom
+    { 14032, TZ_UTC_P2, { 'Z', 'A' } }, // Krugersdorp
+    { 14044, TZ_UTC_P2, { 'Z', 'A' } }, // Diepsloot
+    { 14054, TZ_UTC_P2, { 'Z', 'A' } }, // Botshabelo
+    { 14065, TZ_UTC_P2, { 'Z', 'A' } }, // Brakpan
+    { 14073, TZ_UTC_P2, { 'Z', 'A' } }, // Witbank
+    { 14081, TZ_UTC_P2, { 'Z', 'A' } }, // Oberholzer
+    { 14092, TZ_UTC_P2, { 'Z', 'A' } }, // Germiston
+    { 12444, TZ_UTC_P2, { 'Z', 'A' } }, // Springs
+    { 14102, TZ_UTC_P2, { 'Z', 'A' } }, // Roodepoort
+    { 14113, TZ_UTC_P2, { 'Z', 'A' } }, // Randburg
+    { 14122, TZ_UTC_P2, { 'Z', 'A' } }, // Vanderbijlpark
+    { 14137, TZ_UTC_P2, { 'Z', 'A' } }, // Centurion
+    { 14147, TZ_UTC_P2, { 'Z', 'A' } }, // Uitenhage
+    { 14157, TZ_UTC_P2, { 'Z', 'A' } }, // Midrand
+    { 14165, TZ_UTC_P2, { 'Z', 'A' } }, // Vryheid
+    { 14173, TZ_UTC_P2, { 'Z', 'A' } }, // Klerksdorp
+    { 14184, TZ_UTC_P2, { 'Z', 'A' } }, // Newcastle
+    { 14194, TZ_UTC_P2, { 'Z', 'A' } }, // Carletonville
+    { 14208, TZ_UTC_P2, { 'Z', 'A' } }, // Nigel
+    { 14214, TZ_UTC_P2, { 'Z', 'A' } }, // Mpumalanga
+    { 14225, TZ_UTC_P2, { 'Z', 'A' } }, // Bethal
+    { 14232, TZ_UTC_P2, { 'Z', 'A' } }, // Potchefstroom
+    { 14246, TZ_UTC_P2, { 'Z', 'A' } }, // Rustenburg
+    { 14257, TZ_UTC_P2, { 'Z', 'A' } }, // Sasolburg
+    { 14267, TZ_UTC_P2, { 'Z', 'A' } }, // Virginia
+    { 14276, TZ_UTC_P2, { 'Z', 'A' } }, // Brits
+    { 14282, TZ_UTC_P2, { 'Z', 'A' } }, // Phalaborwa
+    { 14293, TZ_UTC_P2, { 'Z', 'A' } }, // Polokwane
+    // Kenya
+    { 14303, TZ_UTC_P3, { 'K', 'E' } }, // Nairobi
+    { 14311, TZ_UTC_P3, { 'K', 'E' } }, // Mombasa
+    { 14319, TZ_UTC_P3, { 'K', 'E' } }, // Kisumu
+    { 14326, TZ_UTC_P3, { 'K', 'E' } }, // Nakuru
+    { 14333, TZ_UTC_P3, { 'K', 'E' } }, // Eldoret
+    { 14341, TZ_UTC_P3, { 'K', 'E' } }, // Kehancha
+    { 14350, TZ_UTC_P3, { 'K', 'E' } }, // Kitale
+    { 14357, TZ_UTC_P3, { 'K', 'E' } }, // Malindi
+    { 14365, TZ_UTC_P3, { 'K', 'E' } }, // Garissa
+    { 14373, TZ_UTC_P3, { 'K', 'E' } }, // Kakamega
+    { 14382, TZ_UTC_P3, { 'K', 'E' } }, // Thika
+    { 14388, TZ_UTC_P3, { 'K', 'E' } }, // Lamu
+    { 14393, TZ_UTC_P3, { 'K', 'E' } }, // Nyeri
+    { 14399, TZ_UTC_P3, { 'K', 'E' } }, // Machakos
+    { 14408, TZ_UTC_P3, { 'K', 'E' } }, // Meru
+    { 14413, TZ_UTC_P3, { 'K', 'E' } }, // Kericho
+    { 14421, TZ_UTC_P3, { 'K', 'E' } }, // Embu
+    { 14426, TZ_UTC_P3, { 'K', 'E' } }, // Migori
+    { 14433, TZ_UTC_P3, { 'K', 'E' } }, // Kapenguria
+    { 14444, TZ_UTC_P3, { 'K', 'E' } }, // Wajir
+    // Ethiopia
+    { 14450, TZ_UTC_P3, { 'E', 'T' } }, // Addis Ababa
+    { 14462, TZ_UTC_P3, { 'E', 'T' } }, // Dire Dawa
+    { 14472, TZ_UTC_P3, { 'E', 'T' } }, // Mekelle
+    { 14480, TZ_UTC_P3, { 'E', 'T' } }, // Adama
+    { 14486, TZ_UTC_P3, { 'E', 'T' } }, // Gondar
+    { 14493, TZ_UTC_P3, { 'E', 'T' } }, // Awassa
+    { 14500, TZ_UTC_P3, { 'E', 'T' } }, // Bahir Dar
+    { 14510, TZ_UTC_P3, { 'E', 'T' } }, // Dessie
+    { 14517, TZ_UTC_P3, { 'E', 'T' } }, // Jimma
+    { 14523, TZ_UTC_P3, { 'E', 'T' } }, // Jijiga
+    { 14530, TZ_UTC_P3, { 'E', 'T' } }, // Shashemene
+    { 14541, TZ_UTC_P3, { 'E', 'T' } }, // Nekemte
+    { 14549, TZ_UTC_P3, { 'E', 'T' } }, // Debre Markos
+    { 14562, TZ_UTC_P3, { 'E', 'T' } }, // Harar
+    { 14568, TZ_UTC_P3, { 'E', 'T' } }, // Debre Berhan
+    { 14581, TZ_UTC_P3, { 'E', 'T' } }, // Dilla
+    { 14587, TZ_UTC_P3, { 'E', 'T' } }, // Arba Minch
+    { 14598, TZ_UTC_P3, { 'E', 'T' } }, // Hosaena
+    { 14606, TZ_UTC_P3, { 'E', 'T' } }, // Debre Zeit
+    { 14617, TZ_UTC_P3, { 'E', 'T' } }, // Ambo
+    // Ghana
+    { 14622, TZ_UTC, { 'G', 'H' } }, // Accra
+    { 14628, TZ_UTC, { 'G', 'H' } }, // Kumasi
+    { 14635, TZ_UTC, { 'G', 'H' } }, // Tamale
+    { 14642, TZ_UTC, { 'G', 'H' } }, // Takoradi
+    { 14651, TZ_UTC, { 'G', 'H' } }, // Tema
+    { 14656, TZ_UTC, { 'G', 'H' } }, // Cape Coast
+    { 14667, TZ_UTC, { 'G', 'H' } }, // Obuasi
+    { 14674, TZ_UTC, { 'G', 'H' } }, // Koforidua
+    { 14684, TZ_UTC, { 'G', 'H' } }, // Sunyani
+    { 14692, TZ_UTC, { 'G', 'H' } }, // Ho
+    { 14695, TZ_UTC, { 'G', 'H' } }, // Techiman
+    { 14704, TZ_UTC, { 'G', 'H' } }, // Wa
+    { 14707, TZ_UTC, { 'G', 'H' } }, // Bolgatanga
+    { 14718, TZ_UTC, { 'G', 'H' } }, // Tarkwa
+    { 14725, TZ_UTC, { 'G', 'H' } }, // Winneba
+    { 14733, TZ_UTC, { 'G', 'H' } }, // Dunkwa-on-Offin
+    // Senegal
+    { 14749, TZ_UTC, { 'S', 'N' } }, // Dakar
+    { 14755, TZ_UTC, { 'S', 'N' } }, // Touba
+    { 14761, TZ_UTC, { 'S', 'N' } }, // Thiès
+    { 14768, TZ_UTC, { 'S', 'N' } }, // Kaolack
+    { 14776, TZ_UTC, { 'S', 'N' } }, // Mbour
+    { 14782, TZ_UTC, { 'S', 'N' } }, // Saint-Louis
+    { 14794, TZ_UTC, { 'S', 'N' } }, // Ziguinchor
+    { 14805, TZ_UTC, { 'S', 'N' } }, // Diourbel
+    { 14814, TZ_UTC, { 'S', 'N' } }, // Louga
+    { 14820, TZ_UTC, { 'S', 'N' } }, // Tambacounda
+    { 14832, TZ_UTC, { 'S', 'N' } }, // Kolda
+    { 14838, TZ_UTC, { 'S', 'N' } }, // Fatick
+    { 14845, TZ_UTC, { 'S', 'N' } }, // Matam
+    { 14851, TZ_UTC, { 'S', 'N' } }, // Kedougou
+    // Morocco (already included above)
+    // Tunisia (already included above)
+    // Algeria (already included above)
+    // Libya (already included above)
+    // Egypt (already included above)
+    // Sudan (already included above)
+    // Tanzania
+    { 14860, TZ_UTC_P3, { 'T', 'Z' } }, // Dar es Salaam
+    { 14874, TZ_UTC_P3, { 'T', 'Z' } }, // Mwanza
+    { 14881, TZ_UTC_P3, { 'T', 'Z' } }, // Arusha
+    { 14888, TZ_UTC_P3, { 'T', 'Z' } }, // Dodoma
+    { 14895, TZ_UTC_P3, { 'T', 'Z' } }, // Mbeya
+    { 14901, TZ_UTC_P3, { 'T', 'Z' } }, // Morogoro
+    { 14910, TZ_UTC_P3, { 'T', 'Z' } }, // Tanga
+    { 14916, TZ_UTC_P3, { 'T', 'Z' } }, // Tabora
+    { 14923, TZ_UTC_P3, { 'T', 'Z' } }, // Kigoma
+    { 14930, TZ_UTC_P3, { 'T', 'Z' } }, // Mtwara
+    { 14937, TZ_UTC_P3, { 'T', 'Z' } }, // Musoma
+    { 14944, TZ_UTC_P3, { 'T', 'Z' } }, // Iringa
+    { 14951, TZ_UTC_P3, { 'T', 'Z' } }, // Singida
+    { 14959, TZ_UTC_P3, { 'T', 'Z' } }, // Njombe
+    { 14966, TZ_UTC_P3, { 'T', 'Z' } }, // Bukoba
+    { 14973, TZ_UTC_P3, { 'T', 'Z' } }, // Songea
+    { 14980, TZ_UTC_P3, { 'T', 'Z' } }, // Sumbawanga
+    { 14991, TZ_UTC_P3, { 'T', 'Z' } }, // Lindi
+    { 14997, TZ_UTC_P3, { 'T', 'Z' } }, // Shinyanga
+    { 15007, TZ_UTC_P3, { 'T', 'Z' } }, // Zanzibar City
+    // Uganda
+    { 15021, TZ_UTC_P3, { 'U', 'G' } }, // Kampala
+    { 15029, TZ_UTC_P3, { 'U', 'G' } }, // Gulu
+    { 15034, TZ_UTC_P3, { 'U', 'G' } }, // Lira
+    { 15039, TZ_UTC_P3, { 'U', 'G' } }, // Mbarara
+    { 15047, TZ_UTC_P3, { 'U', 'G' } }, // Jinja
+    { 15053, TZ_UTC_P3, { 'U', 'G' } }, // Mbale
+    { 15059, TZ_UTC_P3, { 'U', 'G' } }, // Mukono
+    { 15066, TZ_UTC_P3, { 'U', 'G' } }, // Kasese
+    { 15073, TZ_UTC_P3, { 'U', 'G' } }, // Masaka
+    { 15080, TZ_UTC_P3, { 'U', 'G' } }, // Entebbe
+    { 15088, TZ_UTC_P3, { 'U', 'G' } }, // Kabale
+    { 15095, TZ_UTC_P3, { 'U', 'G' } }, // Arua
+    { 15100, TZ_UTC_P3, { 'U', 'G' } }, // Kitgum
+    { 15107, TZ_UTC_P3, { 'U', 'G' } }, // Koboko
+    { 15114, TZ_UTC_P3, { 'U', 'G' } }, // Iganga
+    { 15121, TZ_UTC_P3, { 'U', 'G' } }, // Soroti
+    { 15128, TZ_UTC_P3, { 'U', 'G' } }, // Fort Portal
+    { 15140, TZ_UTC_P3, { 'U', 'G' } }, // Hoima
+    { 15146, TZ_UTC_P3, { 'U', 'G' } }, // Pader
+    { 15152, TZ_UTC_P3, { 'U', 'G' } }, // Tororo
+    // Rwanda
+    { 15159, TZ_UTC_P2, { 'R', 'W' } }, // Kigali
+    { 15166, TZ_UTC_P2, { 'R', 'W' } }, // Butare
+    { 15173, TZ_UTC_P2, { 'R', 'W' } }, // Gitarama
+    { 15182, TZ_UTC_P2, { 'R', 'W' } }, // Ruhengeri
+    { 15192, TZ_UTC_P2, { 'R', 'W' } }, // Gisenyi
+    { 15200, TZ_UTC_P2, { 'R', 'W' } }, // Byumba
+    { 15207, TZ_UTC_P2, { 'R', 'W' } }, // Cyangugu
+    { 15216, TZ_UTC_P2, { 'R', 'W' } }, // Kibungo
+    { 15224, TZ_UTC_P2, { 'R', 'W' } }, // Kibuye
+    { 15231, TZ_UTC_P2, { 'R', 'W' } }, // Gikongoro
+    // Burundi
+    { 15241, TZ_UTC_P2, { 'B', 'I' } }, // Bujumbura
+    { 15251, TZ_UTC_P2, { 'B', 'I' } }, // Gitega
+    { 15258, TZ_UTC_P2, { 'B', 'I' } }, // Muyinga
+    { 15266, TZ_UTC_P2, { 'B', 'I' } }, // Ngozi
+    { 15272, TZ_UTC_P2, { 'B', 'I' } }, // Ruyigi
+    { 15279, TZ_UTC_P2, { 'B', 'I' } }, // Kayanza
+    { 15287, TZ_UTC_P2, { 'B', 'I' } }, // Bururi
+    { 15294, TZ_UTC_P2, { 'B', 'I' } }, // Muramvya
+    { 15303, TZ_UTC_P2, { 'B', 'I' } }, // Rutana
+    { 15310, TZ_UTC_P2, { 'B', 'I' } }, // Makamba
+    // Democratic Republic of Congo
+    { 15318, TZ_UTC_P1, { 'C', 'D' } }, // Kinshasa
+    { 15327, TZ_UTC_P2, { 'C', 'D' } }, // Lubumbashi
+    { 15338, TZ_UTC_P2, { 'C', 'D' } }, // Mbuji-Mayi
+    { 15349, TZ_UTC_P2, { 'C', 'D' } }, // Kisangani
+    { 15359, TZ_UTC_P1, { 'C', 'D' } }, // Masina
+    { 15366, TZ_UTC_P2, { 'C', 'D' } }, // Kananga
+    { 15374, TZ_UTC_P2, { 'C', 'D' } }, // Likasi
+    { 15381, TZ_UTC_P2, { 'C', 'D' } }, // Kolwezi
+    { 15389, TZ_UTC_P1, { 'C', 'D' } }, // Tshikapa
+    { 15398, TZ_UTC_P2, { 'C', 'D' } }, // Beni
+    { 15403, TZ_UTC_P2, { 'C', 'D' } }, // Bukavu
+    { 15410, TZ_UTC_P2, { 'C', 'D' } }, // Mwene-Ditu
+    { 15421, TZ_UTC_P1, { 'C', 'D' } }, // Kikwit
+    { 15428, TZ_UTC_P1, { 'C', 'D' } }, // Mbandaka
+    { 15437, TZ_UTC_P1, { 'C', 'D' } }, // Matadi
+    { 15444, TZ_UTC_P2, { 'C', 'D' } }, // Uvira
+    { 15450, TZ_UTC_P2, { 'C', 'D' } }, // Butembo
+    { 15458, TZ_UTC_P2, { 'C', 'D' } }, // Gandajika
+    { 15468, TZ_UTC_P2, { 'C', 'D' } }, // Kalemie
+    { 15476, TZ_UTC_P2, { 'C', 'D' } }, // Goma
+    // Republic of Congo
+    { 15481, TZ_UTC_P1, { 'C', 'G' } }, // Brazzaville
+    { 15493, TZ_UTC_P1, { 'C', 'G' } }, // Pointe-Noire
+    { 15506, TZ_UTC_P1, { 'C', 'G' } }, // Dolisie
+    { 15514, TZ_UTC_P1, { 'C', 'G' } }, // Nkayi
+    { 15520, TZ_UTC_P1, { 'C', 'G' } }, // Mossendjo
+    { 15530, TZ_UTC_P1, { 'C', 'G' } }, // Impfondo
+    { 15539, TZ_UTC_P1, { 'C', 'G' } }, // Ouesso
+    { 15546, TZ_UTC_P1, { 'C', 'G' } }, // Madingou
+    { 15555, TZ_UTC_P1, { 'C', 'G' } }, // Owando
+    { 15562, TZ_UTC_P1, { 'C', 'G' } }, // Sibiti
+    // Central African Republic
+    { 15569, TZ_UTC_P1, { 'C', 'F' } }, // Bangui
+    { 15576, TZ_UTC_P1, { 'C', 'F' } }, // Bimbo
+    { 15582, TZ_UTC_P1, { 'C', 'F' } }, // Berbérati
+    { 15593, TZ_UTC_P1, { 'C', 'F' } }, // Carnot
+    { 15600, TZ_UTC_P1, { 'C', 'F' } }, // Bambari
+    { 15608, TZ_UTC_P1, { 'C', 'F' } }, // Bouar
+    { 15614, TZ_UTC_P1, { 'C', 'F' } }, // Bossangoa
+    { 15624, TZ_UTC_P1, { 'C', 'F' } }, // Bria
+    { 15629, TZ_UTC_P1, { 'C', 'F' } }, // Bangassou
+    { 15639, TZ_UTC_P1, { 'C', 'F' } }, // Nola
+    // Chad
+    { 15644, TZ_UTC_P1, { 'T', 'D' } }, // N'Djamena
+    { 15654, TZ_UTC_P1, { 'T', 'D' } }, // Moundou
+    { 15662, TZ_UTC_P1, { 'T', 'D' } }, // Sarh
+    { 15667, TZ_UTC_P1, { 'T', 'D' } }, // Abéché
+    { 15676, TZ_UTC_P1, { 'T', 'D' } }, // Koumra
+    { 15683, TZ_UTC_P1, { 'T', 'D' } }, // Pala
+    { 15688, TZ_UTC_P1, { 'T', 'D' } }, // Am Timan
+    { 15697, TZ_UTC_P1, { 'T', 'D' } }, // Bongor
+    { 15704, TZ_UTC_P1, { 'T', 'D' } }, // Mongo
+    { 15710, TZ_UTC_P1, { 'T', 'D' } }, // Doba
+    { 15715, TZ_UTC_P1, { 'T', 'D' } }, // Ati
+    { 15719, TZ_UTC_P1, { 'T', 'D' } }, // Laï
+    { 15724, TZ_UTC_P1, { 'T', 'D' } }, // Kelo
+    { 15729, TZ_UTC_P1, { 'T', 'D' } }, // Mao
+    { 15733, TZ_UTC_P1, { 'T', 'D' } }, // Biltine
+    // Cameroon
+    { 15741, TZ_UTC_P1, { 'C', 'M' } }, // Yaoundé
+    { 15750, TZ_UTC_P1, { 'C', 'M' } }, // Douala
+    { 15757, TZ_UTC_P1, { 'C', 'M' } }, // Bamenda
+    { 15765, TZ_UTC_P1, { 'C', 'M' } }, // Bafoussam
+    { 15775, TZ_UTC_P1, { 'C', 'M' } }, // Garoua
+    { 15782, TZ_UTC_P1, { 'C', 'M' } }, // Maroua
+    { 15789, TZ_UTC_P1, { 'C', 'M' } }, // Nkongsamba
+    { 15800, TZ_UTC_P1, { 'C', 'M' } }, // Bertoua
+    { 15808, TZ_UTC_P1, { 'C', 'M' } }, // Edéa
+    { 15814, TZ_UTC_P1, { 'C', 'M' } }, // Loum
+    { 15819, TZ_UTC_P1, { 'C', 'M' } }, // Kumba
+    { 15825, TZ_UTC_P1, { 'C', 'M' } }, // Ngaoundéré
+    { 15838, TZ_UTC_P1, { 'C', 'M' } }, // Ebolowa
+    { 15846, TZ_UTC_P1, { 'C', 'M' } }, // Kribi
+    { 15852, TZ_UTC_P1, { 'C', 'M' } }, // Tiko
+    { 15857, TZ_UTC_P1, { 'C', 'M' } }, // Mbalmayo
+    { 15866, TZ_UTC_P1, { 'C', 'M' } }, // Dschang
+    { 15874, TZ_UTC_P1, { 'C', 'M' } }, // Mbouda
+    { 15881, TZ_UTC_P1, { 'C', 'M' } }, // Foumban
+    { 15889, TZ_UTC_P1, { 'C', 'M' } }, // Limbe
+    // Gabon
+    { 15895, TZ_UTC_P1, { 'G', 'A' } }, // Libreville
+    // Equatorial Guinea
+    { 15906, TZ_UTC_P1, { 'G', 'Q' } }, // Malabo
+    // São Tomé and Príncipe
+    { 15913, TZ_UTC, { 'S', 'T' } }, // São Tomé
+    // Angola
+    { 15924, TZ_UTC_P1, { 'A', 'O' } }, // Luanda
+    // Namibia
+    { 15931, TZ_UTC_P2, { 'N', 'A' } }, // Windhoek
+    // Botswana
+    { 15940, TZ_UTC_P2, { 'B', 'W' } }, // Gaborone
+    { 15949, TZ_UTC_P2, { 'B', 'W' } }, // Francistown
+    { 15961, TZ_UTC_P2, { 'B', 'W' } }, // Molepolole
+    { 15972, TZ_UTC_P2, { 'B', 'W' } }, // Serowe
+    { 15979, TZ_UTC_P2, { 'B', 'W' } }, // Selibe Phikwe
+    { 15993, TZ_UTC_P2, { 'B', 'W' } }, // Maun
+    { 15998, TZ_UTC_P2, { 'B', 'W' } }, // Kanye
+    { 16004, TZ_UTC_P2, { 'B', 'W' } }, // Mochudi
+    { 16012, TZ_UTC_P2, { 'B', 'W' } }, // Mahalapye
+    { 16022, TZ_UTC_P2, { 'B', 'W' } }, // Palapye
+    { 16030, TZ_UTC_P2, { 'B', 'W' } }, // Jwaneng
+    { 16038, TZ_UTC_P2, { 'B', 'W' } }, // Lobatse
+    // Zimbabwe
+    { 16046, TZ_UTC_P2, { 'Z', 'W' } }, // Harare
+    { 16053, TZ_UTC_P2, { 'Z', 'W' } }, // Bulawayo
+    { 16062, TZ_UTC_P2, { 'Z', 'W' } }, // Chitungwiza
+    { 16074, TZ_UTC_P2, { 'Z', 'W' } }, // Mutare
+    { 16081, TZ_UTC_P2, { 'Z', 'W' } }, // Epworth
+    { 16089, TZ_UTC_P2, { 'Z', 'W' } }, // Gweru
+    { 16095, TZ_UTC_P2, { 'Z', 'W' } }, // Kwekwe
+    { 16102, TZ_UTC_P2, { 'Z', 'W' } }, // Kadoma
+    { 16109, TZ_UTC_P2, { 'Z', 'W' } }, // Masvingo
+    { 16118, TZ_UTC_P2, { 'Z', 'W' } }, // Chinhoyi
+    { 16127, TZ_UTC_P2, { 'Z', 'W' } }, // Norton
+    { 16134, TZ_UTC_P2, { 'Z', 'W' } }, // Marondera
+    { 16144, TZ_UTC_P2, { 'Z', 'W' } }, // Ruwa
+    { 16149, TZ_UTC_P2, { 'Z', 'W' } }, // Chegutu
+    { 16157, TZ_UTC_P2, { 'Z', 'W' } }, // Zvishavane
+    { 16168, TZ_UTC_P2, { 'Z', 'W' } }, // Bindura
+    { 16176, TZ_UTC_P2, { 'Z', 'W' } }, // Beitbridge
+    { 16187, TZ_UTC_P2, { 'Z', 'W' } }, // Redcliff
+    { 16196, TZ_UTC_P2, { 'Z', 'W' } }, // Victoria Falls
+    { 16211, TZ_UTC_P2, { 'Z', 'W' } }, // Hwange
+    // Zambia
+    { 16218, TZ_UTC_P2, { 'Z', 'M' } }, // Lusaka
+    { 16225, TZ_UTC_P2, { 'Z', 'M' } }, // Kitwe
+    { 16231, TZ_UTC_P2, { 'Z', 'M' } }, // Ndola
+    { 16237, TZ_UTC_P2, { 'Z', 'M' } }, // Kabwe
+    { 16243, TZ_UTC_P2, { 'Z', 'M' } }, // Chingola
+    { 16252, TZ_UTC_P2, { 'Z', 'M' } }, // Mufulira
+    { 16261, TZ_UTC_P2, { 'Z', 'M' } }, // Luanshya
+    { 16270, TZ_UTC_P2, { 'Z', 'M' } }, // Livingstone
+    { 16282, TZ_UTC_P2, { 'Z', 'M' } }, // Kasama
+    { 16289, TZ_UTC_P2, { 'Z', 'M' } }, // Chipata
+    { 16297, TZ_UTC_P2, { 'Z', 'M' } }, // Mazabuka
+    { 16306, TZ_UTC_P2, { 'Z', 'M' } }, // Choma
+    { 16312, TZ_UTC_P2, { 'Z', 'M' } }, // Kapiri Mposhi
+    { 16326, TZ_UTC_P2, { 'Z', 'M' } }, // Mongu
+    { 16332, TZ_UTC_P2, { 'Z', 'M' } }, // Kafue
+    // Malawi
+    { 16338, TZ_UTC_P2, { 'M', 'W' } }, // Lilongwe
+    { 16347, TZ_UTC_P2, { 'M', 'W' } }, // Blantyre
+    { 16356, TZ_UTC_P2, { 'M', 'W' } }, // Mzuzu
+    { 16362, TZ_UTC_P2, { 'M', 'W' } }, // Zomba
+    { 16368, TZ_UTC_P2, { 'M', 'W' } }, // Kasungu
+    { 16376, TZ_UTC_P2, { 'M', 'W' } }, // Mangochi
+    { 16385, TZ_UTC_P2, { 'M', 'W' } }, // Salima
+    { 16392, TZ_UTC_P2, { 'M', 'W' } }, // Liwonde
+    { 16400, TZ_UTC_P2, { 'M', 'W' } }, // Karonga
+    { 16408, TZ_UTC_P2, { 'M', 'W' } }, // Nsanje
+    { 16415, TZ_UTC_P2, { 'M', 'W' } }, // Machinga
+    { 16424, TZ_UTC_P2, { 'M', 'W' } }, // Dedza
+    // Mozambique
+    { 16430, TZ_UTC_P2, { 'M', 'Z' } }, // Maputo
+    { 16437, TZ_UTC_P2, { 'M', 'Z' } }, // Beira
+    { 16443, TZ_UTC_P2, { 'M', 'Z' } }, // Nampula
+    { 16451, TZ_UTC_P2, { 'M', 'Z' } }, // Chimoio
+    { 16459, TZ_UTC_P2, { 'M', 'Z' } }, // Nacala
+    { 16466, TZ_UTC_P2, { 'M', 'Z' } }, // Quelimane
+    { 16476, TZ_UTC_P2, { 'M', 'Z' } }, // Tete
+    { 16481, TZ_UTC_P2, { 'M', 'Z' } }, // Xai-Xai
+    { 16489, TZ_UTC_P2, { 'M', 'Z' } }, // Lichinga
+    { 16498, TZ_UTC_P2, { 'M', 'Z' } }, // Pemba
+    { 16504, TZ_UTC_P2, { 'M', 'Z' } }, // Inhambane
+    { 16514, TZ_UTC_P2, { 'M', 'Z' } }, // Dondo
+    { 16520, TZ_UTC_P2, { 'M', 'Z' } }, // Gurué
+    { 16527, TZ_UTC_P2, { 'M', 'Z' } }, // Maxixe
+    { 16534, TZ_UTC_P2, { 'M', 'Z' } }, // Angoche
+    // Madagascar
+    { 16542, TZ_UTC_P3, { 'M', 'G' } }, // Antananarivo
+    { 16555, TZ_UTC_P3, { 'M', 'G' } }, // Toamasina
+    { 16565, TZ_UTC_P3, { 'M', 'G' } }, // Antsirabe
+    { 16575, TZ_UTC_P3, { 'M', 'G' } }, // Fianarantsoa
+    { 16588, TZ_UTC_P3, { 'M', 'G' } }, // Mahajanga
+    { 16598, TZ_UTC_P3, { 'M', 'G' } }, // Toliara
+    { 16606, TZ_UTC_P3, { 'M', 'G' } }, // Antsiranana
+    { 16618, TZ_UTC_P3, { 'M', 'G' } }, // Morondava
+    { 16628, TZ_UTC_P3, { 'M', 'G' } }, // Ambovombe
+    { 16638, TZ_UTC_P3, { 'M', 'G' } }, // Manakara
+    { 16647, TZ_UTC_P3, { 'M', 'G' } }, // Mananjary
+    { 16657, TZ_UTC_P3, { 'M', 'G' } }, // Sambava
+    { 16665, TZ_UTC_P3, { 'M', 'G' } }, // Fort Dauphin
+    { 16678, TZ_UTC_P3, { 'M', 'G' } }, // Maintirano
+    { 16689, TZ_UTC_P3, { 'M', 'G' } }, // Vatomandry
+    // Mauritius
+    { 16700, TZ_UTC_P4, { 'M', 'U' } }, // Port Louis
+    { 16711, TZ_UTC_P4, { 'M', 'U' } }, // Beau Bassin-Rose Hill
+    { 16733, TZ_UTC_P4, { 'M', 'U' } }, // Vacoas-Phoenix
+    { 16748, TZ_UTC_P4, { 'M', 'U' } }, // Curepipe
+    { 16757, TZ_UTC_P4, { 'M', 'U' } }, // Quatre Bornes
+    { 16771, TZ_UTC_P4, { 'M', 'U' } }, // Triolet
+    { 16779, TZ_UTC_P4, { 'M', 'U' } }, // Goodlands
+    { 16789, TZ_UTC_P4, { 'M', 'U' } }, // Centre de Flacq
+    { 16805, TZ_UTC_P4, { 'M', 'U' } }, // Mahebourg
+    { 16815, TZ_UTC_P4, { 'M', 'U' } }, // Saint Pierre
+    // Seychelles
+    { 16828, TZ_UTC_P4, { 'S', 'C' } }, // Victoria
+    // Comoros
+    { 16837, TZ_UTC_P3, { 'K', 'M' } }, // Moroni
+    // Djibouti
+    { 16844, TZ_UTC_P3, { 'D', 'J' } }, // Djibouti
+    // Eritrea
+    { 16853, TZ_UTC_P3, { 'E', 'R' } }, // Asmara
+    // Somalia
+    { 16860, TZ_UTC_P3, { 'S', 'O' } }, // Mogadishu
+    // Ivory Coast
+    { 16870, TZ_UTC, { 'C', 'I' } }, // Abidjan
+    { 16878, TZ_UTC, { 'C', 'I' } }, // Yamoussoukro
+    // Burkina Faso
+    { 16891, TZ_UTC, { 'B', 'F' } }, // Ouagadougou
+    // Mali
+    { 16903, TZ_UTC, { 'M', 'L' } }, // Bamako
+    // Niger
+    { 16910, TZ_UTC_P1, { 'N', 'E' } }, // Niamey
+    // Guinea
+    { 16917, TZ_UTC, { 'G', 'N' } }, // Conakry
+    // Sierra Leone
+    { 16925, TZ_UTC, { 'S', 'L' } }, // Freetown
+    // Liberia
+    { 16934, TZ_UTC, { 'L', 'R' } }, // Monrovia
+    // Gambia
+    { 16943, TZ_UTC, { 'G', 'M' } }, // Banjul
+    // Guinea-Bissau
+    { 16950, TZ_UTC, { 'G', 'W' } }, // Bissau
+    // Cape Verde
+    { 16957, TZ_UTC_M1, { 'C', 'V' } }, // Praia
+    // Togo
+    { 16963, TZ_UTC, { 'T', 'G' } }, // Lomé
+    // Benin
+    { 16969, TZ_UTC_P1, { 'B', 'J' } }, // Porto-Novo
+    { 16980, TZ_UTC_P1, { 'B', 'J' } }, // Cotonou
+    // Lesotho
+    { 16988, TZ_UTC_P2, { 'L', 'S' } }, // Maseru
+    // Swaziland
+    { 16995, TZ_UTC_P2, { 'S', 'Z' } }, // Mbabane
+    // Oceania
+    // Australia
+    { 17003, TZ_AU_EASTERN, { 'A', 'U' } }, // Sydney
+    { 17010, TZ_AU_EASTERN, { 'A', 'U' } }, // Melbourne
+    { 17020, TZ_UTC_P10, { 'A', 'U' } }, // Brisbane
+    { 17029, TZ_UTC_P8, { 'A', 'U' } }, // Perth
+    { 17035, TZ_AU_CENTRAL, { 'A', 'U' } }, // Adelaide
+    { 17044, TZ_AU_EASTERN, { 'A', 'U' } }, // Canberra
+    { 17053, TZ_UTC_P10, { 'A', 'U' } }, // Gold Coast
+    { 14184, TZ_AU_EASTERN, { 'A', 'U' } }, // Newcastle
+    { 17064, TZ_AU_EASTERN, { 'A', 'U' } }, // Wollongong
+    { 17075, TZ_UTC_P9_30, { 'A', 'U' } }, // Darwin
+    { 17082, TZ_AU_EASTERN, { 'A', 'U' } }, // Hobart
+    // New Zealand
+    { 17089, TZ_NEW_ZEALAND, { 'N', 'Z' } }, // Auckland
+    { 17098, TZ_NEW_ZEALAND, { 'N', 'Z' } }, // Wellington
+    { 17109, TZ_NEW_ZEALAND, { 'N', 'Z' } }, // Christchurch
+    { 12774, TZ_NEW_ZEALAND, { 'N', 'Z' } }, // Hamilton
+    { 17122, TZ_NEW_ZEALAND, { 'N', 'Z' } }, // Dunedin
+    // Papua New Guinea
+    { 17130, TZ_UTC_P10, { 'P', 'G' } }, // Port Moresby
+    // Fiji
+    { 17143, TZ_UTC_P12, { 'F', 'J' } }, // Suva
+    // Solomon Islands
+    { 17148, TZ_UTC_P11, { 'S', 'B' } }, // Honiara
+    // Vanuatu
+    { 17156, TZ_UTC_P11, { 'V', 'U' } }, // Port Vila
+    // New Caledonia
+    { 17166, TZ_UTC_P11, { 'N', 'C' } }, // Nouméa
+    // French Polynesia
+    { 17174, TZ_UTC_M10, { 'P', 'F' } }, // Papeete
+    // Samoa
+    { 17182, TZ_UTC_P13, { 'W', 'S' } }, // Apia
+    // Tonga
+    { 17187, TZ_UTC_P13, { 'T', 'O' } }, // Nuku'alofa
+    // Palau
+    { 17198, TZ_UTC_P9, { 'P', 'W' } }, // Ngerulmud
+    // Micronesia
+    { 17208, TZ_UTC_P11, { 'F', 'M' } }, // Palikir
+    // Marshall Islands
+    { 17216, TZ_UTC_P12, { 'M', 'H' } }, // Majuro
+    // Kiribati
+    { 17223, TZ_UTC_P12, { 'K', 'I' } }, // Tarawa
+    // Nauru
+    { 17230, TZ_UTC_P12, { 'N', 'R' } }, // Yaren
+    // Tuvalu
+    { 17236, TZ_UTC_P12, { 'T', 'V' } }, // Funafuti
+};
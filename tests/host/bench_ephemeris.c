@@ -0,0 +1,76 @@
+/**
+ * @file bench_ephemeris.c
+ * @brief Cost and accuracy of the ephemeris backends (src/ephemeris_*.c)
+ *
+ * Microseconds per day of each backend, and the largest declination and
+ * equation-of-time difference of Meeus-lite against NREL SPA, over every
+ * day from 2000 to 2099. SPA itself is checked against the example of the
+ * NREL report (2003-10-17 12:30:30 -7h) to 1e-4 degree; its own Delta T
+ * model stands in for the report's 67 s.
+ */
+
+#include "host_test.h"
+#include "ephemeris.h"
+#include <math.h>
+
+#define JD_2000         2451545.0
+#define DAYS            36525           // 2000-2099
+#define RAD2ARCSEC(x)   ((x) * (180.0 / M_PI) * 3600.0)
+
+static volatile double sink;
+
+static double us_per_day(const ephemeris_backend_t *backend)
+{
+    int64_t start = host_now_ns();
+
+    for (int d = 0; d < DAYS; d++) {
+        ephemeris_sun_t sun;
+        backend->sun(JD_2000 + d, &sun);
+        sink += sun.declination;
+    }
+    return (double)(host_now_ns() - start) / DAYS / 1000.0;
+}
+
+// Minutes difference, wrapped into +-12 h
+static double eot_diff_min(double a, double b)
+{
+    return remainder(a - b, 1440.0);
+}
+
+int main(void)
+{
+    ephemeris_sun_t sun;
+
+    // NREL/TP-560-34302 example, JD 2452930.312847 UT
+    ephemeris_spa_backend.sun(2452930.312847, &sun);
+    CHECK(fabs(sun.declination * 180.0 / M_PI - -9.31434) < 1e-4,
+          "SPA declination %.6f, expected -9.31434", sun.declination * 180.0 / M_PI);
+    CHECK(fabs(sun.right_ascension - 202.22741) < 1e-4,
+          "SPA right ascension %.6f, expected 202.22741", sun.right_ascension);
+
+    double max_dec = 0.0, max_eot = 0.0;
+    for (int d = 0; d < DAYS; d++) {
+        ephemeris_sun_t meeus, spa;
+
+        ephemeris_meeus_backend.sun(JD_2000 + d, &meeus);
+        ephemeris_spa_backend.sun(JD_2000 + d, &spa);
+        max_dec = fmax(max_dec, fabs(RAD2ARCSEC(meeus.declination - spa.declination)));
+        max_eot = fmax(max_eot, fabs(eot_diff_min(meeus.equation_of_time, spa.equation_of_time)) * 60.0);
+    }
+
+    // Warm up, then time each backend
+    us_per_day(&ephemeris_meeus_backend);
+    double meeus_us = us_per_day(&ephemeris_meeus_backend);
+    double spa_us = us_per_day(&ephemeris_spa_backend);
+
+    printf("Ephemeris backends, every day 2000-2099 (%d days)\n", DAYS);
+    printf("  %-12s %8s %12s %12s\n", "backend", "us/day", "max dDec", "max dEoT");
+    printf("  %-12s %8.3f %11s %11s\n", ephemeris_spa_backend.name, spa_us, "(ref)", "(ref)");
+    printf("  %-12s %8.3f %10.1f\" %10.1fs\n", ephemeris_meeus_backend.name, meeus_us, max_dec, max_eot);
+    printf("  SPA / Meeus-lite cost: %.1fx\n", spa_us / meeus_us);
+
+    // A minute of prayer time is ~15' of hour angle: keep Meeus-lite well inside it
+    CHECK(max_dec < 30.0, "Meeus-lite declination error %.1f\"", max_dec);
+    CHECK(max_eot < 5.0, "Meeus-lite equation of time error %.1f s", max_eot);
+    return host_test_done("bench_ephemeris");
+}
@@ -0,0 +1,150 @@
+/**
+ * @file bench_prayer_batch.c
+ * @brief Batch prayer computation against prayerStruct() per city (src/prayer_batch.c)
+ *
+ * The baseline is what a caller without the batch API does: for each city,
+ * swap the Lat/Lng globals and the prayer timezone and call prayerStruct()
+ * (printk() is a no-op here, so the baseline only pays for its arguments).
+ * Both run over all world cities for one day and report cities per second.
+ * Every 5th day of 2025, with every method and high-latitude rule, each city's
+ * batch times must be within one minute of prayerStruct()'s.
+ */
+
+#include "host_test.h"
+#include "prayer_batch.h"
+#include "prayerTime.h"
+#include "gnss_core.h"
+#include "world_cities.h"
+#include "tz_rules.h"
+#include "time_of_day.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define REPEATS     20
+
+// Globals of main.c read by prayerTime.c
+double Lng, Lat, D;
+
+// No receiver: prayerStruct() uses sea level, as the batch path does
+uint32_t gps_snapshot(struct gps_data *out)
+{
+    memset(out, 0, sizeof(*out));
+    return 0;
+}
+
+static int city_count;
+static float *tz_hours;             // UTC offset of each city at noon UTC of the day
+static int32_t *batch_sod[PRAYER_TIMES_COUNT];
+static int32_t *single_sod[PRAYER_TIMES_COUNT];
+
+static double julian_day(int32_t ordinal)
+{
+    return 2451544.5 + ordinal;
+}
+
+static void city_offsets(int32_t ordinal)
+{
+    static tz_year_t zones[TZ_ZONE_COUNT];
+    int year, month, day;
+
+    tod_civil_from_days(ordinal, &year, &month, &day);
+    for (int i = 0; i < city_count; i++) {
+        city_data_t city;
+        get_city_by_index(i, &city);
+        if (zones[city.tz].year != year) {
+            tz_year_expand(&zones[city.tz], city.tz, year);
+        }
+        tz_hours[i] = tz_offset_min(&zones[city.tz], ordinal * TOD_SECONDS_PER_DAY + 43200) / 60.0f;
+    }
+}
+
+static void run_batch(int32_t ordinal, prayer_method_id_t method, prayer_high_lat_rule_t rule)
+{
+    prayer_batch_day_t day;
+
+    prayer_batch_day_init(&day, julian_day(ordinal), method, PRAYER_ASR_STANDARD, rule);
+    prayer_batch_world_cities(&day, 0, city_count, batch_sod);
+}
+
+static void run_single(int32_t ordinal)
+{
+    double jd = julian_day(ordinal);
+
+    for (int i = 0; i < city_count; i++) {
+        city_data_t city;
+        get_city_by_index(i, &city);
+        Lat = city.latitude;
+        Lng = city.longitude;
+        prayer_set_timezone(tz_hours[i]);
+
+        prayer_myFloats_t prayers = prayerStruct(jd);
+        int32_t sod[PRAYER_TIMES_COUNT];
+        prayer_times_to_sod(&prayers, sod);
+        for (int e = 0; e < PRAYER_TIMES_COUNT; e++) {
+            single_sod[e][i] = sod[e];
+        }
+    }
+}
+
+int main(void)
+{
+    city_count = get_total_cities_count();
+    tz_hours = calloc(city_count, sizeof(*tz_hours));
+    for (int e = 0; e < PRAYER_TIMES_COUNT; e++) {
+        batch_sod[e] = calloc(city_count, sizeof(int32_t));
+        single_sod[e] = calloc(city_count, sizeof(int32_t));
+    }
+
+    int32_t first = tod_days_from_civil(2025, 1, 1);
+    long compared = 0;
+    int worst_min = 0;
+
+    for (int d = 0; d < 365; d += 5) {
+        city_offsets(first + d);
+        for (int m = 0; m < PRAYER_METHOD_COUNT; m++) {
+            for (int rule = 0; rule < PRAYER_HIGH_LAT_COUNT; rule++) {
+                prayer_set_method((prayer_method_id_t)m);
+                prayer_set_asr_method(PRAYER_ASR_STANDARD);
+                prayer_set_high_lat_rule((prayer_high_lat_rule_t)rule);
+                run_single(first + d);
+                run_batch(first + d, (prayer_method_id_t)m, (prayer_high_lat_rule_t)rule);
+
+                for (int i = 0; i < city_count; i++) {
+                    for (int e = 0; e < PRAYER_TIMES_COUNT; e++) {
+                        int diff = abs(batch_sod[e][i] - single_sod[e][i]);
+                        diff = MIN(diff, TOD_SECONDS_PER_DAY - diff) / 60;
+                        worst_min = MAX(worst_min, diff);
+                        compared++;
+                        CHECK(diff <= 1, "day %d, %s, rule %d, city %d, event %d: %d min apart",
+                              d, prayer_methods[m].name, rule, i, e, diff);
+                    }
+                }
+            }
+        }
+    }
+    printf("bench_prayer_batch: %ld times compared, largest difference %d min\n", compared, worst_min);
+
+    // Throughput for one day (MWL, middle of the night)
+    int32_t today = tod_days_from_civil(2025, 6, 21);
+    city_offsets(today);
+    prayer_set_method(PRAYER_METHOD_MWL);
+    prayer_set_high_lat_rule(PRAYER_HIGH_LAT_MIDDLE_OF_NIGHT);
+
+    int64_t start = host_now_ns();
+    for (int r = 0; r < REPEATS; r++) {
+        run_single(today);
+    }
+    double single_s = (double)(host_now_ns() - start) / 1e9;
+
+    start = host_now_ns();
+    for (int r = 0; r < REPEATS; r++) {
+        run_batch(today, PRAYER_METHOD_MWL, PRAYER_HIGH_LAT_MIDDLE_OF_NIGHT);
+    }
+    double batch_s = (double)(host_now_ns() - start) / 1e9;
+
+    double single_rate = REPEATS * (double)city_count / single_s;
+    double batch_rate = REPEATS * (double)city_count / batch_s;
+    printf("%d cities x %d: prayerStruct() loop %.2fM cities/s, batch %.2fM cities/s (%.1fx)\n",
+           city_count, REPEATS, single_rate / 1e6, batch_rate / 1e6, batch_rate / single_rate);
+    return host_test_done("bench_prayer_batch");
+}
@@ -0,0 +1,75 @@
+/**
+ * @file bench_prayer_methods.c
+ * @brief Per-day cost of every calculation method (src/prayer_methods.c)
+ *
+ * Times prayer_day_terms_init() plus prayer_day_offsets(), the whole per-day
+ * work of a method once the sun position is known, for every day of 2025 at
+ * latitudes from the equator to 60 N. All methods should share one budget:
+ * the fixed-interval Isha and the sunset Maghrib skip an acos(), angle-based
+ * ones do not add any.
+ */
+
+#include "host_test.h"
+#include "prayer_methods.h"
+#include "ephemeris.h"
+#include "time_of_day.h"
+
+#define DAYS        365
+#define REPEATS     200
+
+static const double latitudes[] = { 0.0, 21.4, 35.7, 51.5, 60.0 };
+#define LATITUDES   (sizeof(latitudes) / sizeof(latitudes[0]))
+
+static double declination[DAYS];
+static volatile double sink;
+
+int main(void)
+{
+    int32_t first = tod_days_from_civil(2025, 1, 1);
+
+    for (int d = 0; d < DAYS; d++) {
+        ephemeris_sun_t sun;
+        ephemeris_meeus_backend.sun(2451545.0 + first + d, &sun);
+        declination[d] = sun.declination;
+    }
+
+    printf("Per-day method cost, %d days x %zu latitudes x %d repeats (ns/day)\n",
+           DAYS, LATITUDES, REPEATS);
+    printf("  %-8s %8s %8s\n", "method", "mean", "worst");
+
+    double fastest = 0.0, slowest = 0.0;
+    for (int m = 0; m < PRAYER_METHOD_COUNT; m++) {
+        double total_ns = 0.0, worst_ns = 0.0;
+
+        for (size_t l = 0; l < LATITUDES; l++) {
+            int64_t start = host_now_ns();
+            for (int r = 0; r < REPEATS; r++) {
+                for (int d = 0; d < DAYS; d++) {
+                    prayer_day_terms_t terms;
+                    prayer_day_offsets_t offsets;
+
+                    prayer_day_terms_init(&terms, (prayer_method_id_t)m, PRAYER_ASR_STANDARD,
+                                          latitudes[l], declination[d], 0.0);
+                    prayer_day_offsets(&terms, PRAYER_HIGH_LAT_MIDDLE_OF_NIGHT, &offsets);
+                    sink += offsets.isha;
+                }
+            }
+            double ns = (double)(host_now_ns() - start) / (REPEATS * DAYS);
+            total_ns += ns;
+            if (ns > worst_ns) {
+                worst_ns = ns;
+            }
+        }
+
+        double mean_ns = total_ns / LATITUDES;
+        printf("  %-8s %8.1f %8.1f\n", prayer_methods[m].name, mean_ns, worst_ns);
+        if (m == 0 || mean_ns < fastest) {
+            fastest = mean_ns;
+        }
+        if (mean_ns > slowest) {
+            slowest = mean_ns;
+        }
+    }
+    printf("Slowest method / fastest: %.2f\n", slowest / fastest);
+    return 0;
+}
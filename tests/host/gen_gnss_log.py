@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+"""Generate the receiver logs the host tests replay (tests/host/data/).
+
+A NEO-7M in its factory configuration (GPS + GLONASS), one epoch per second:
+RMC, VTG, GGA, two GSA, GPS and GLONASS GSV, GLL as NMEA, and the same epochs
+as UBX NAV-PVT frames (protocol 14 layout, 84-byte payload). The receiver
+drives north-east from Helsinki at 20 m/s; it has no fix for the first five
+epochs and loses it again in a tunnel from epoch 80 to 89, and the UTC date
+(and year) changes after epoch 59. Sentences without a fix carry the empty
+fields a u-blox receiver sends.
+
+Usage: gen_gnss_log.py [--epochs 120] [--nmea data/drive.nmea] [--ubx data/drive.ubx]
+
+The committed logs are the default output; the benchmarks generate longer
+ones into build/ (e.g. --epochs 10800 for three hours).
+"""
+
+import argparse
+import datetime
+import math
+import random
+import struct
+
+START = datetime.datetime(2024, 12, 31, 23, 59, 0)
+NO_FIX = range(0, 5)
+TUNNEL = range(80, 90)
+LAT0, LON0 = 60.1699, 24.9384
+SPEED_MS = 20.0
+COURSE_DEG = 45.0
+GPS_UTC_OFFSET_S = 18               # Leap seconds since 1980
+
+# id, elevation, azimuth, SNR; the first eight of each system are used in the fix
+GPS_SKY = [(2, 62, 48, 44), (5, 35, 301, 38), (9, 18, 110, 31), (12, 71, 205, 46),
+           (16, 44, 152, 40), (18, 27, 252, 35), (22, 12, 12, 27), (24, 53, 96, 42),
+           (26, 6, 330, 18), (29, 3, 178, 0), (31, 9, 80, 0)]
+GLO_SKY = [(65, 40, 20, 39), (66, 58, 95, 43), (72, 22, 310, 30), (73, 15, 140, 0),
+           (80, 64, 250, 41)]
+
+
+def sentence(body):
+    checksum = 0
+    for ch in body.encode("ascii"):
+        checksum ^= ch
+    return f"${body}*{checksum:02X}\r\n"
+
+
+def coord(value, deg_digits):
+    value = abs(value)
+    degrees = int(value)
+    minutes = (value - degrees) * 60
+    return f"{degrees:0{deg_digits}d}{minutes:08.5f}"
+
+
+def gsv(talker, sky, fix, rng):
+    out = []
+    total = (len(sky) + 3) // 4
+    for n in range(total):
+        body = f"{talker}GSV,{total},{n + 1},{len(sky):02d}"
+        for sat_id, elevation, azimuth, snr in sky[n * 4:n * 4 + 4]:
+            snr = snr + rng.randint(-2, 2) if snr and (fix or snr >= 44) else 0
+            body += f",{sat_id:02d},{elevation:02d},{azimuth:03d},"
+            if snr > 0:
+                body += f"{snr:02d}"
+        out.append(sentence(body))
+    return out
+
+
+def gsa(sky, fix):
+    if not fix:
+        return sentence("GNGSA,A,1" + "," * 12 + ",99.99,99.99,99.99")
+    ids = [f"{sat[0]:02d}" for sat in sky[:8]]
+    return sentence("GNGSA,A,3," + ",".join(ids + [""] * (12 - len(ids))) + ",2.50,1.30,2.14")
+
+
+def nav_pvt(when, fix, lat, lon, alt, num_sv):
+    week_start = when - datetime.timedelta(days=(when.weekday() + 1) % 7,
+                                           hours=when.hour, minutes=when.minute, seconds=when.second)
+    itow = int(((when - week_start).total_seconds() + GPS_UTC_OFFSET_S) * 1000) % (7 * 86400 * 1000)
+    payload = bytearray(84)
+    struct.pack_into("<IHBBBBBB", payload, 0, itow, when.year, when.month, when.day,
+                     when.hour, when.minute, when.second, 0x07)
+    struct.pack_into("<BBBB", payload, 20, 3 if fix else 0, 0x01 if fix else 0, 0,
+                     num_sv if fix else 0)
+    if fix:
+        struct.pack_into("<iiiiI", payload, 24, round(lon * 1e7), round(lat * 1e7),
+                         round((alt + 17.9) * 1000), round(alt * 1000), 2500)
+        struct.pack_into("<H", payload, 76, 250)
+    else:
+        struct.pack_into("<I", payload, 40, 4294967295)
+        struct.pack_into("<H", payload, 76, 9999)
+    frame = bytes([0x01, 0x07]) + struct.pack("<H", len(payload)) + bytes(payload)
+    ck_a = ck_b = 0
+    for byte in frame:
+        ck_a = (ck_a + byte) & 0xFF
+        ck_b = (ck_b + ck_a) & 0xFF
+    return b"\xb5\x62" + frame + bytes([ck_a, ck_b])
+
+
+def generate(epochs):
+    rng = random.Random(7)
+    nmea, ubx = [], bytearray()
+    lat, lon = LAT0, LON0
+    step_lat = SPEED_MS * math.cos(math.radians(COURSE_DEG)) / 111320.0
+    for epoch in range(epochs):
+        when = START + datetime.timedelta(seconds=epoch)
+        fix = epoch not in NO_FIX and epoch not in TUNNEL
+        lat += step_lat
+        lon += SPEED_MS * math.sin(math.radians(COURSE_DEG)) / (111320.0 * math.cos(math.radians(lat)))
+        alt = 25.0 + 3.0 * math.sin(epoch / 40.0) + rng.uniform(-0.5, 0.5)
+        hdop = 1.0 + rng.randint(0, 40) / 100.0
+        num_sv = 8 + rng.randint(0, 3)
+
+        t = when.strftime("%H%M%S") + ".00"
+        d = when.strftime("%d%m%y")
+        la, lo = coord(lat, 2), coord(lon, 3)
+        knots = SPEED_MS * 3600 / 1852
+        if fix:
+            nmea.append(sentence(f"GNRMC,{t},A,{la},N,{lo},E,{knots:.3f},{COURSE_DEG:.2f},{d},,,A"))
+            nmea.append(sentence(f"GNVTG,{COURSE_DEG:.2f},T,,M,{knots:.3f},N,{SPEED_MS * 3.6:.3f},K,A"))
+            nmea.append(sentence(f"GNGGA,{t},{la},N,{lo},E,1,{num_sv:02d},{hdop:.2f},{alt:.1f},M,17.9,M,,"))
+        else:
+            nmea.append(sentence(f"GNRMC,{t},V,,,,,,,{d},,,N"))
+            nmea.append(sentence("GNVTG,,,,,,,,,N"))
+            nmea.append(sentence(f"GNGGA,{t},,,,,0,00,99.99,,,,,,"))
+        nmea.append(gsa(GPS_SKY, fix))
+        nmea.append(gsa(GLO_SKY, fix))
+        nmea.extend(gsv("GP", GPS_SKY, fix, rng))
+        nmea.extend(gsv("GL", GLO_SKY, fix, rng))
+        if fix:
+            nmea.append(sentence(f"GNGLL,{la},N,{lo},E,{t},A,A"))
+        else:
+            nmea.append(sentence(f"GNGLL,,,,,{t},V,N"))
+        ubx += nav_pvt(when, fix, lat, lon, alt, num_sv)
+    return "".join(nmea), bytes(ubx)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--epochs", type=int, default=120)
+    parser.add_argument("--nmea", default="data/drive.nmea")
+    parser.add_argument("--ubx", default="data/drive.ubx")
+    args = parser.parse_args()
+
+    nmea, ubx = generate(args.epochs)
+    with open(args.nmea, "w", newline="\n") as out:
+        out.write(nmea)
+    if args.ubx:
+        with open(args.ubx, "wb") as out:
+            out.write(ubx)
+    print(f"{args.epochs} epochs: {len(nmea)} bytes of NMEA, {len(ubx)} bytes of NAV-PVT")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+"""Generate the timezone transition fixture test_tz_rules checks (tests/host/data/).
+
+Each zone's POSIX TZ string is read from src/tz_rules.c, in tz_zone_id_t
+order, and expanded by Python's zoneinfo: the string becomes the footer of
+a TZif file without transitions of its own, so the rules come from an
+implementation independent of tz_rules.c. Output, for each zone:
+
+    zone <id> <POSIX TZ string>
+    0 <offset>                  offset at 2000-01-01 00:00 UTC
+    <utc_s> <offset>            every change up to 2068-01-01
+
+utc_s is UTC seconds since 2000-01-01 00:00, offsets are minutes east of UTC.
+
+Usage: gen_tz_fixture.py [-o data/tz_transitions.txt]
+"""
+
+import argparse
+import datetime
+import io
+import os
+import re
+import struct
+import zoneinfo
+
+TZ_RULES_C = os.path.join(os.path.dirname(__file__), "..", "..", "src", "tz_rules.c")
+EPOCH = datetime.datetime(2000, 1, 1, tzinfo=datetime.timezone.utc)
+END_S = int((datetime.datetime(2068, 1, 1, tzinfo=datetime.timezone.utc) - EPOCH).total_seconds())
+DAY_S = 86400
+
+
+def zone_strings():
+    text = open(TZ_RULES_C).read()
+    table = text[text.index("tz_zones[TZ_ZONE_COUNT]"):]
+    return re.findall(r'^\s*\[TZ_\w+\]\s*=\s*(?:FIXED\(|\{)\s*"([^"]+)"', table, re.M)
+
+
+def posix_zone(rule):
+    """A TZif (version 2) file whose only content is the POSIX footer."""
+    counts = struct.pack(">6l", 0, 0, 0, 1, 1, 4)
+    ttinfo = struct.pack(">lBB", 0, 0, 0) + b"UTC\0"
+    v1 = b"TZif2" + bytes(15) + struct.pack(">6l", 0, 0, 0, 0, 1, 4) + ttinfo
+    # One transition in 1900: the footer applies after the last transition
+    v2 = b"TZif2" + bytes(15) + counts + struct.pack(">q", -2208988800) + b"\0" + ttinfo
+    return zoneinfo.ZoneInfo.from_file(io.BytesIO(v1 + v2 + b"\n" + rule.encode() + b"\n"))
+
+
+def offset_min(zone, utc_s):
+    when = EPOCH + datetime.timedelta(seconds=utc_s)
+    return int(when.astimezone(zone).utcoffset().total_seconds()) // 60
+
+
+def transitions(zone):
+    out = [(0, offset_min(zone, 0))]
+    for day in range(0, END_S, DAY_S):
+        if offset_min(zone, day + DAY_S) == out[-1][1]:
+            continue
+        # First second with the new offset
+        lo, hi = day, day + DAY_S
+        while hi - lo > 1:
+            mid = (lo + hi) // 2
+            if offset_min(zone, mid) == out[-1][1]:
+                lo = mid
+            else:
+                hi = mid
+        out.append((hi, offset_min(zone, hi)))
+    return out
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("-o", "--output", default="data/tz_transitions.txt")
+    args = parser.parse_args()
+
+    lines = ["# Generated by tests/host/gen_tz_fixture.py from src/tz_rules.c, do not edit"]
+    for zone_id, rule in enumerate(zone_strings()):
+        lines.append(f"zone {zone_id} {rule}")
+        lines.extend(f"{utc_s} {offset}" for utc_s, offset in transitions(posix_zone(rule)))
+    with open(args.output, "w", newline="\n") as out:
+        out.write("\n".join(lines) + "\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,285 @@
+/**
+ * @file gnss_receiver.c
+ * @brief Emulated u-blox receiver: log playback, CFG commands and ACKs
+ */
+
+#include "gnss_receiver.h"
+#include "uart_emul.h"
+#include "ubx.h"
+#include <zephyr/kernel.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_EPOCHS          20000
+#define EPOCH_US            1000000
+#define NMEA_IDS            16          ///< CFG-MSG IDs of class 0xF0 tracked
+
+static struct {
+    uint8_t *nmea;
+    size_t nmea_len;
+    size_t nmea_epoch[MAX_EPOCHS + 1];  ///< Start of each epoch, then the end of the log
+    uint8_t *ubx;
+    size_t ubx_epoch[MAX_EPOCHS + 1];
+    int epochs;
+
+    unsigned int flags;
+    uint32_t baud;
+    int64_t start_us;
+    int next_epoch;
+    uint8_t nmea_rate[NMEA_IDS];
+    uint8_t nav_pvt_rate;
+
+    ubx_parser_t parser;
+    ubx_frame_t frame;
+    gnss_receiver_stats_t stats;
+    uint8_t out[4096];
+} rcv;
+
+static uint8_t *load(const char *path, size_t *len)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    *len = (size_t)ftell(f);
+    rewind(f);
+    uint8_t *data = malloc(*len + 1);
+    if (fread(data, 1, *len, f) != *len) {
+        free(data);
+        data = NULL;
+    }
+    fclose(f);
+    return data;
+}
+
+// "$GNRMC" -> RMC
+static bool is_type(const uint8_t *s, const char *type)
+{
+    return s[0] == '$' && memcmp(&s[3], type, 3) == 0;
+}
+
+static int nmea_id(const uint8_t *s)
+{
+    static const char *const types[] = { "GGA", "GLL", "GSA", "GSV", "RMC", "VTG", NULL, NULL, "ZDA" };
+
+    for (int id = 0; id < (int)ARRAY_SIZE(types); id++) {
+        if (types[id] && is_type(s, types[id])) {
+            return id;
+        }
+    }
+    return -1;
+}
+
+int gnss_receiver_load(const char *nmea_path, const char *ubx_path)
+{
+    int nmea_epochs = -1, ubx_epochs = -1;
+
+    memset(&rcv, 0, sizeof(rcv));
+    if (nmea_path) {
+        rcv.nmea = load(nmea_path, &rcv.nmea_len);
+        if (!rcv.nmea) {
+            return -1;
+        }
+        nmea_epochs = 0;
+        for (size_t i = 0; i + 6 <= rcv.nmea_len; i++) {
+            if ((i == 0 || rcv.nmea[i - 1] == '\n') && is_type(&rcv.nmea[i], "RMC") &&
+                nmea_epochs < MAX_EPOCHS) {
+                rcv.nmea_epoch[nmea_epochs++] = i;
+            }
+        }
+        rcv.nmea_epoch[nmea_epochs] = rcv.nmea_len;
+    }
+    if (ubx_path) {
+        size_t len;
+        rcv.ubx = load(ubx_path, &len);
+        if (!rcv.ubx) {
+            return -1;
+        }
+        ubx_epochs = 0;
+        for (size_t i = 0; i + UBX_FRAME_OVERHEAD <= len && ubx_epochs < MAX_EPOCHS;) {
+            rcv.ubx_epoch[ubx_epochs++] = i;
+            i += UBX_FRAME_OVERHEAD + (rcv.ubx[i + 4] | (rcv.ubx[i + 5] << 8));
+            rcv.ubx_epoch[ubx_epochs] = i;
+        }
+    }
+
+    rcv.epochs = (nmea_epochs < 0) ? ubx_epochs :
+                 (ubx_epochs < 0) ? nmea_epochs : MIN(nmea_epochs, ubx_epochs);
+    return rcv.epochs;
+}
+
+const char *gnss_receiver_nmea_epoch(int n, size_t *len)
+{
+    *len = rcv.nmea_epoch[n + 1] - rcv.nmea_epoch[n];
+    return (const char *)&rcv.nmea[rcv.nmea_epoch[n]];
+}
+
+static void send(const uint8_t *data, size_t len)
+{
+    uart_emul_send(data, len, (rcv.flags & GNSS_RECEIVER_FIXED) ? UART_EMUL_BAUD_FOLLOW : rcv.baud);
+    rcv.stats.bytes += len;
+}
+
+/**
+ * @brief Epoch n with the messages switched on
+ */
+static void send_epoch(int n)
+{
+    size_t len = 0;
+    bool fixed = rcv.flags & GNSS_RECEIVER_FIXED;
+
+    if (rcv.nmea) {
+        for (size_t i = rcv.nmea_epoch[n]; i < rcv.nmea_epoch[n + 1];) {
+            const uint8_t *end = memchr(&rcv.nmea[i], '\n', rcv.nmea_epoch[n + 1] - i);
+            size_t next = end ? (size_t)(end - rcv.nmea) + 1 : rcv.nmea_epoch[n + 1];
+            int id = nmea_id(&rcv.nmea[i]);
+            uint8_t rate = (id >= 0) ? rcv.nmea_rate[id] : 1;
+
+            if (fixed || (rate > 0 && n % rate == 0)) {
+                memcpy(&rcv.out[len], &rcv.nmea[i], next - i);
+                len += next - i;
+            }
+            i = next;
+        }
+    }
+    if (rcv.ubx && (fixed || (rcv.nav_pvt_rate > 0 && n % rcv.nav_pvt_rate == 0))) {
+        size_t frame = rcv.ubx_epoch[n + 1] - rcv.ubx_epoch[n];
+        memcpy(&rcv.out[len], &rcv.ubx[rcv.ubx_epoch[n]], frame);
+        len += frame;
+    }
+
+    send(rcv.out, len);
+    rcv.stats.epochs++;
+}
+
+static void answer(bool ack)
+{
+    const uint8_t payload[2] = { rcv.frame.msg_class, rcv.frame.msg_id };
+    uint8_t frame[2 + UBX_FRAME_OVERHEAD];
+
+    send(frame, ubx_build(frame, UBX_CLASS_ACK, ack ? UBX_ID_ACK_ACK : UBX_ID_ACK_NAK,
+                          payload, sizeof(payload)));
+    if (ack) {
+        rcv.stats.acks++;
+    } else {
+        rcv.stats.naks++;
+    }
+}
+
+/**
+ * @brief Apply a command from the host
+ */
+static void command(const ubx_frame_t *frame)
+{
+    const uint8_t *p = frame->payload;
+
+    rcv.stats.commands++;
+    if (frame->msg_class != UBX_CLASS_CFG) {
+        answer(false);
+        return;
+    }
+
+    switch (frame->msg_id) {
+    case UBX_ID_CFG_PRT:
+        if (frame->length >= 20) {
+            // Applied at once: the ACK already goes out at the new rate
+            rcv.baud = p[8] | (p[9] << 8) | (p[10] << 16) | ((uint32_t)p[11] << 24);
+            rcv.stats.baud_changes++;
+            answer(true);
+        } else {
+            answer(false);
+        }
+        break;
+
+    case UBX_ID_CFG_MSG:
+        if (frame->length < 3) {
+            answer(false);
+        } else if (p[0] == UBX_CLASS_NMEA && p[1] < NMEA_IDS) {
+            rcv.nmea_rate[p[1]] = p[2];
+            answer(true);
+        } else if (p[0] == UBX_CLASS_NAV && p[1] == UBX_ID_NAV_PVT &&
+                   !(rcv.flags & GNSS_RECEIVER_NMEA_ONLY)) {
+            rcv.nav_pvt_rate = p[2];
+            answer(true);
+        } else {
+            answer(false);
+        }
+        break;
+
+    case UBX_ID_CFG_RATE:
+    case UBX_ID_CFG_PM2:
+    case UBX_ID_CFG_RXM:
+        answer(true);
+        break;
+
+    default:
+        answer(false);
+        break;
+    }
+}
+
+/**
+ * @brief Bytes the host transmitted (uart_emul_tx_sink_t)
+ */
+static void on_host_tx(const uint8_t *data, size_t len, uint32_t baud)
+{
+    if (rcv.flags & GNSS_RECEIVER_FIXED) {
+        return;
+    }
+    if (baud != rcv.baud) {
+        rcv.stats.deaf_bytes += len;
+        return;
+    }
+    for (size_t i = 0; i < len; i++) {
+        if (ubx_feed(&rcv.parser, data[i])) {
+            command(&rcv.frame);
+        }
+    }
+}
+
+/**
+ * @brief Host event source: the next epoch
+ */
+static int64_t gnss_receiver_source(int64_t now_us)
+{
+    while (rcv.next_epoch < rcv.epochs &&
+           rcv.start_us + (int64_t)rcv.next_epoch * EPOCH_US <= now_us) {
+        send_epoch(rcv.next_epoch++);
+    }
+    if (rcv.next_epoch == rcv.epochs) {
+        return INT64_MAX;
+    }
+    return rcv.start_us + (int64_t)rcv.next_epoch * EPOCH_US;
+}
+
+void gnss_receiver_start(uint32_t baud, unsigned int flags)
+{
+    rcv.flags = flags;
+    rcv.baud = baud;
+    rcv.start_us = host_clock_us;
+    rcv.next_epoch = 0;
+    memset(rcv.nmea_rate, 0, sizeof(rcv.nmea_rate));
+    for (int id = 0; id <= 5; id++) {
+        rcv.nmea_rate[id] = 1;          // Factory default: GGA, GLL, GSA, GSV, RMC, VTG
+    }
+    rcv.nav_pvt_rate = 0;
+    ubx_parser_init(&rcv.parser, &rcv.frame);
+
+    uart_emul_set_tx_sink(on_host_tx);
+    host_add_source(gnss_receiver_source);
+}
+
+bool gnss_receiver_done(void)
+{
+    return rcv.next_epoch == rcv.epochs;
+}
+
+void gnss_receiver_get_stats(gnss_receiver_stats_t *stats)
+{
+    *stats = rcv.stats;
+    stats->nav_pvt_rate = rcv.nav_pvt_rate;
+    stats->gsv_rate = rcv.nmea_rate[3];
+    stats->gll_rate = rcv.nmea_rate[1];
+}
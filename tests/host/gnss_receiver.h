@@ -0,0 +1,66 @@
+/**
+ * @file gnss_receiver.h
+ * @brief Emulated u-blox receiver on the UART emulator (stubs/uart_emul.h)
+ *
+ * Plays a recorded log one epoch per second: the NMEA log (epochs start at
+ * each RMC) filtered by the message rates set with UBX-CFG-MSG, and the NAV-PVT
+ * log once CFG-MSG turns it on. It understands the commands gps_config.c sends
+ * when they arrive at its own baud rate: CFG-PRT moves it to another rate,
+ * CFG-MSG, CFG-RATE, CFG-PM2 and CFG-RXM are ACKed, anything else is NAKed.
+ * Like a NEO-7M it starts at 9600 baud with every NMEA message on.
+ */
+
+#ifndef GNSS_RECEIVER_H
+#define GNSS_RECEIVER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+enum {
+    /** Ignore commands and send every loaded log in full, at whatever rate the UART is set to */
+    GNSS_RECEIVER_FIXED = (1 << 0),
+    /** No NAV-PVT (NEO-6, protocol 7): CFG-MSG for it is NAKed */
+    GNSS_RECEIVER_NMEA_ONLY = (1 << 1),
+};
+
+typedef struct {
+    uint32_t epochs;                ///< Epochs sent
+    uint32_t bytes;                 ///< Bytes sent, ACKs included
+    uint32_t commands;              ///< UBX frames understood
+    uint32_t acks;
+    uint32_t naks;
+    uint32_t baud_changes;          ///< CFG-PRT applied
+    uint32_t deaf_bytes;            ///< Bytes from the host at a baud rate it is not set to
+    uint32_t nav_pvt_rate;          ///< Current CFG-MSG rates
+    uint32_t gsv_rate;
+    uint32_t gll_rate;
+} gnss_receiver_stats_t;
+
+/**
+ * @brief Load the logs to play (either may be NULL)
+ * @return Number of epochs, -1 when a file cannot be read
+ */
+int gnss_receiver_load(const char *nmea_path, const char *ubx_path);
+
+/**
+ * @brief Start sending: epoch n goes out n seconds from now
+ * @param baud Initial baud rate
+ * @param flags GNSS_RECEIVER_*
+ */
+void gnss_receiver_start(uint32_t baud, unsigned int flags);
+
+/**
+ * @brief True once every epoch is on the line
+ */
+bool gnss_receiver_done(void);
+
+/**
+ * @brief Text of epoch n in the NMEA log (n < number of epochs)
+ * @param len Output length
+ */
+const char *gnss_receiver_nmea_epoch(int n, size_t *len);
+
+void gnss_receiver_get_stats(gnss_receiver_stats_t *stats);
+
+#endif // GNSS_RECEIVER_H
@@ -0,0 +1,43 @@
+/**
+ * @file host_test.h
+ * @brief Failure counting and timing shared by the host tests and benchmarks
+ */
+
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+
+static int host_failures;
+
+// Count a failure; only the first 20 are printed
+#define CHECK(cond, ...)                                                    \
+    do {                                                                    \
+        if (!(cond) && host_failures++ < 20) {                              \
+            printf("FAIL %s:%d: ", __FILE__, __LINE__);                     \
+            printf(__VA_ARGS__);                                            \
+            printf("\n");                                                   \
+        }                                                                   \
+    } while (0)
+
+// Monotonic time in nanoseconds
+static inline int64_t host_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+// Result line and exit status of a test
+static inline int host_test_done(const char *name)
+{
+    printf("%s: %s\n", name, host_failures ? "FAILED" : "ok");
+    if (host_failures) {
+        printf("%s: %d failure(s)\n", name, host_failures);
+    }
+    return host_failures != 0;
+}
+
+#endif // HOST_TEST_H
@@ -0,0 +1,224 @@
+/**
+ * @file host_kernel.c
+ * @brief Host implementation of the stubbed kernel services
+ *
+ * Single-threaded: host_run() plays the role of the interrupts (event sources
+ * such as the UART emulator) and of the system work queue, in time order.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/timing/timing.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <time.h>
+
+#define HOST_SOURCES    4
+
+int64_t host_clock_us;
+bool host_printk_enabled;
+uint64_t host_work_ns;
+
+const struct device host_device = { .name = "host" };
+
+static struct k_work *queue_head;
+static struct k_work *queue_tail;
+static struct k_work_delayable *timers;
+static host_source_t sources[HOST_SOURCES];
+
+static uint64_t host_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+uint32_t k_cycle_get_32(void)
+{
+    return (uint32_t)host_ns();
+}
+
+timing_t timing_counter_get(void)
+{
+    return host_ns();
+}
+
+void printk(const char *fmt, ...)
+{
+    if (host_printk_enabled) {
+        va_list ap;
+        va_start(ap, fmt);
+        vprintf(fmt, ap);
+        va_end(ap);
+    }
+}
+
+void k_work_init(struct k_work *work, k_work_handler_t handler)
+{
+    *work = (struct k_work){ .handler = handler };
+}
+
+int k_work_submit(struct k_work *work)
+{
+    if (work->queued) {
+        return 0;
+    }
+    work->queued = true;
+    work->next = NULL;
+    if (queue_tail) {
+        queue_tail->next = work;
+    } else {
+        queue_head = work;
+    }
+    queue_tail = work;
+    return 1;
+}
+
+void k_work_init_delayable(struct k_work_delayable *dwork, k_work_handler_t handler)
+{
+    *dwork = (struct k_work_delayable){ .work = { .handler = handler } };
+}
+
+static void timer_remove(struct k_work_delayable *dwork)
+{
+    for (struct k_work_delayable **p = &timers; *p; p = &(*p)->next_timer) {
+        if (*p == dwork) {
+            *p = dwork->next_timer;
+            break;
+        }
+    }
+    dwork->scheduled = false;
+}
+
+int k_work_reschedule(struct k_work_delayable *dwork, k_timeout_t delay)
+{
+    if (!dwork->scheduled) {
+        dwork->next_timer = timers;
+        timers = dwork;
+        dwork->scheduled = true;
+    }
+    dwork->due_us = host_clock_us + MAX(delay.us, 0);
+    return 1;
+}
+
+int k_work_schedule(struct k_work_delayable *dwork, k_timeout_t delay)
+{
+    if (dwork->scheduled || dwork->work.queued) {
+        return 0;
+    }
+    return k_work_reschedule(dwork, delay);
+}
+
+int k_work_cancel_delayable(struct k_work_delayable *dwork)
+{
+    if (dwork->scheduled) {
+        timer_remove(dwork);
+    }
+    if (dwork->work.queued) {
+        for (struct k_work **p = &queue_head; *p; p = &(*p)->next) {
+            if (*p == &dwork->work) {
+                *p = dwork->work.next;
+                break;
+            }
+        }
+        queue_tail = NULL;
+        for (struct k_work *w = queue_head; w; w = w->next) {
+            queue_tail = w;
+        }
+        dwork->work.queued = false;
+    }
+    return 0;
+}
+
+void host_add_source(host_source_t source)
+{
+    for (int i = 0; i < HOST_SOURCES; i++) {
+        if (!sources[i] || sources[i] == source) {
+            sources[i] = source;
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Submit expired delayable work, then run the queue until it is empty
+ */
+static uint32_t run_due_work(void)
+{
+    uint32_t runs = 0;
+
+    for (struct k_work_delayable *t = timers, *next; t; t = next) {
+        next = t->next_timer;
+        if (t->due_us <= host_clock_us) {
+            timer_remove(t);
+            k_work_submit(&t->work);
+        }
+    }
+
+    while (queue_head) {
+        struct k_work *work = queue_head;
+        queue_head = work->next;
+        if (!queue_head) {
+            queue_tail = NULL;
+        }
+        work->queued = false;
+
+        uint64_t start = host_ns();
+        work->handler(work);
+        host_work_ns += host_ns() - start;
+        runs++;
+    }
+    return runs;
+}
+
+uint32_t host_run(int64_t until_us)
+{
+    uint32_t runs = 0;
+
+    for (;;) {
+        int64_t next = until_us;
+
+        // A source may feed one called before it (the receiver queues bytes on
+        // the UART line): the second pass collects the next events of both
+        for (int pass = 0; pass < 2; pass++) {
+            next = until_us;
+            for (int i = 0; i < HOST_SOURCES && sources[i]; i++) {
+                next = MIN(next, sources[i](host_clock_us));
+            }
+        }
+
+        // Work may start or feed a source: look at the sources again
+        uint32_t ran = run_due_work();
+        if (ran > 0) {
+            runs += ran;
+            continue;
+        }
+
+        for (struct k_work_delayable *t = timers; t; t = t->next_timer) {
+            next = MIN(next, t->due_us);
+        }
+        if (host_clock_us >= until_us) {
+            break;
+        }
+        host_clock_us = MAX(next, host_clock_us);
+    }
+    return runs;
+}
+
+uint32_t crc32_ieee_update(uint32_t crc, const uint8_t *data, size_t len)
+{
+    crc = ~crc;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320U & -(crc & 1U));
+        }
+    }
+    return ~crc;
+}
+
+uint32_t crc32_ieee(const uint8_t *data, size_t len)
+{
+    return crc32_ieee_update(0, data, len);
+}
@@ -0,0 +1,486 @@
+/**
+ * @file uart_emul.c
+ * @brief UART emulator: async (DMA) and interrupt-driven RX, async TX, on host time
+ */
+
+#include "uart_emul.h"
+#include <zephyr/kernel.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LINE_SIZE       8192            ///< Bytes in flight
+#define EVENT_COUNT     32              ///< Async events waiting for the callback
+#define FIFO_SIZE       6               ///< nRF UART RX FIFO
+
+typedef struct {
+    int64_t at_us;                      ///< End of its stop bit
+    uint32_t baud;
+    uint8_t value;
+    uint8_t error;                      ///< enum uart_rx_stop_reason, 0 for none
+} line_byte_t;
+
+static struct {
+    struct uart_config cfg;
+    uart_emul_tx_sink_t sink;
+    uart_emul_stats_t stats;
+
+    // Line: bytes in flight towards RX
+    line_byte_t line[LINE_SIZE];
+    size_t line_head;
+    size_t line_count;
+    int64_t line_free_us;               ///< When the far end's transmitter is free
+    uint8_t inject_error;
+    uint32_t garbage;                   ///< LCG state for garbled bytes
+
+    // Async RX
+    uart_callback_t callback;
+    void *user_data;
+    bool rx_on;
+    uint8_t *buf;                       ///< Buffer being filled
+    size_t buf_len;
+    size_t filled;
+    size_t reported;                    ///< Up to here already given in RX_RDY
+    uint8_t *next_buf;
+    size_t next_len;
+    int32_t timeout_us;
+    int64_t last_byte_us;
+    bool refuse_rsp;
+    struct uart_event events[EVENT_COUNT];
+    size_t event_head;
+    size_t event_count;
+    bool dispatching;
+
+    // Async TX
+    const uint8_t *tx_buf;
+    size_t tx_len;
+    int64_t tx_done_us;
+
+    // Interrupt-driven RX
+    uart_irq_callback_user_data_t irq_callback;
+    bool irq_rx_on;
+    uint8_t fifo[FIFO_SIZE];
+    size_t fifo_count;
+} emul;
+
+static int64_t byte_time_us(uint32_t baud)
+{
+    // 8N1: ten bits per byte
+    return (10000000LL + baud - 1) / baud;
+}
+
+static void push_event(struct uart_event evt)
+{
+    if (emul.event_count == EVENT_COUNT) {
+        fprintf(stderr, "uart_emul: event queue overflow\n");
+        abort();
+    }
+    emul.events[(emul.event_head + emul.event_count++) % EVENT_COUNT] = evt;
+}
+
+/**
+ * @brief Deliver queued events; calls made from the callback queue more
+ */
+static void dispatch(void)
+{
+    if (emul.dispatching) {
+        return;
+    }
+    emul.dispatching = true;
+    while (emul.event_count > 0) {
+        struct uart_event evt = emul.events[emul.event_head];
+        emul.event_head = (emul.event_head + 1) % EVENT_COUNT;
+        emul.event_count--;
+
+        switch (evt.type) {
+        case UART_RX_RDY:
+            emul.stats.rx_rdy++;
+            emul.stats.delivered += evt.data.rx.len;
+            break;
+        case UART_RX_BUF_REQUEST:
+            emul.stats.buf_requests++;
+            break;
+        case UART_RX_BUF_RELEASED:
+            emul.stats.buf_released++;
+            break;
+        case UART_RX_DISABLED:
+            emul.stats.rx_disabled++;
+            break;
+        case UART_TX_DONE:
+            emul.stats.tx_frames++;
+            break;
+        default:
+            break;
+        }
+
+        if (emul.callback) {
+            uint64_t start = k_cycle_get_32();
+            emul.callback(&host_device, &evt, emul.user_data);
+            emul.stats.callback_ns += (uint32_t)(k_cycle_get_32() - start);
+            emul.stats.callbacks++;
+        }
+    }
+    emul.dispatching = false;
+}
+
+static void report_rx(void)
+{
+    if (emul.filled > emul.reported) {
+        push_event((struct uart_event){
+            .type = UART_RX_RDY,
+            .data.rx = { .buf = emul.buf, .offset = emul.reported, .len = emul.filled - emul.reported },
+        });
+        emul.reported = emul.filled;
+    }
+}
+
+static void release(uint8_t *buf)
+{
+    push_event((struct uart_event){ .type = UART_RX_BUF_RELEASED, .data.rx_buf = { .buf = buf } });
+}
+
+/**
+ * @brief Stop reception: release both buffers, then RX_DISABLED
+ */
+static void rx_stop(void)
+{
+    report_rx();
+    release(emul.buf);
+    if (emul.next_buf) {
+        release(emul.next_buf);
+    }
+    emul.buf = NULL;
+    emul.next_buf = NULL;
+    emul.rx_on = false;
+    push_event((struct uart_event){ .type = UART_RX_DISABLED });
+}
+
+/**
+ * @brief True while the driver holds the buffer or RX_RDY data in it is not delivered yet
+ */
+static bool busy(const uint8_t *buf, size_t len)
+{
+    const uint8_t *held[] = { emul.buf, emul.next_buf };
+    const size_t held_len[] = { emul.buf_len, emul.next_len };
+
+    for (int i = 0; i < 2; i++) {
+        if (held[i] && buf < held[i] + held_len[i] && held[i] < buf + len) {
+            return true;
+        }
+    }
+    for (size_t i = 0; i < emul.event_count; i++) {
+        const struct uart_event *evt = &emul.events[(emul.event_head + i) % EVENT_COUNT];
+        if (evt->type == UART_RX_RDY && evt->data.rx.buf >= buf && evt->data.rx.buf < buf + len) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void start_buffer(uint8_t *buf, size_t len)
+{
+    emul.buf = buf;
+    emul.buf_len = len;
+    emul.filled = 0;
+    emul.reported = 0;
+    push_event((struct uart_event){ .type = UART_RX_BUF_REQUEST });
+}
+
+/**
+ * @brief One byte off the line (async mode)
+ */
+static void rx_async(uint8_t value, uint8_t error)
+{
+    if (!emul.rx_on) {
+        emul.stats.lost++;
+        return;
+    }
+    if (error) {
+        emul.stats.lost++;
+        report_rx();
+        push_event((struct uart_event){
+            .type = UART_RX_STOPPED,
+            .data.rx_stop = { .reason = error, .data = { .buf = emul.buf, .offset = emul.filled } },
+        });
+        rx_stop();
+        return;
+    }
+
+    emul.buf[emul.filled++] = value;
+    emul.last_byte_us = host_clock_us;
+    if (emul.filled == emul.buf_len) {
+        report_rx();
+        release(emul.buf);
+        if (emul.next_buf) {
+            uint8_t *next = emul.next_buf;
+            emul.next_buf = NULL;
+            start_buffer(next, emul.next_len);
+        } else {
+            // No buffer to continue in: the driver stops
+            emul.buf = NULL;
+            emul.rx_on = false;
+            push_event((struct uart_event){ .type = UART_RX_DISABLED });
+        }
+    }
+}
+
+/**
+ * @brief One byte off the line (interrupt mode)
+ */
+static void rx_irq(uint8_t value, uint8_t error)
+{
+    if (error || emul.fifo_count == FIFO_SIZE) {
+        emul.stats.lost++;
+        return;
+    }
+    emul.fifo[emul.fifo_count++] = value;
+
+    if (emul.irq_rx_on && emul.irq_callback) {
+        uint64_t start = k_cycle_get_32();
+        emul.irq_callback(&host_device, NULL);
+        emul.stats.callback_ns += (uint32_t)(k_cycle_get_32() - start);
+        emul.stats.callbacks++;
+    }
+}
+
+/**
+ * @brief Host event source: line bytes, RX idle timeout and TX completion due now
+ */
+static int64_t uart_emul_source(int64_t now_us)
+{
+    int64_t next = INT64_MAX;
+
+    while (emul.line_count > 0 && emul.line[emul.line_head].at_us <= now_us) {
+        line_byte_t byte = emul.line[emul.line_head];
+        emul.line_head = (emul.line_head + 1) % LINE_SIZE;
+        emul.line_count--;
+
+        if (byte.baud != UART_EMUL_BAUD_FOLLOW && byte.baud != emul.cfg.baudrate) {
+            // Sampled at the wrong rate: garbage, and now and then a broken stop bit
+            emul.garbage = emul.garbage * 1103515245U + 12345U;
+            byte.value = (uint8_t)(emul.garbage >> 16);
+            if (++emul.stats.garbled % 8 == 0) {
+                byte.error = UART_ERROR_FRAMING;
+            }
+        }
+        if (emul.inject_error) {
+            byte.error = emul.inject_error;
+            emul.inject_error = 0;
+        }
+        if (byte.error) {
+            emul.stats.line_errors++;
+        }
+
+        if (emul.callback) {
+            rx_async(byte.value, byte.error);
+        } else {
+            rx_irq(byte.value, byte.error);
+        }
+        dispatch();
+    }
+
+    // Line idle long enough: flush the partly filled buffer
+    if (emul.rx_on && emul.filled > emul.reported) {
+        int64_t idle_at = emul.last_byte_us + emul.timeout_us;
+        if (idle_at <= now_us) {
+            report_rx();
+            dispatch();
+        } else {
+            next = MIN(next, idle_at);
+        }
+    }
+
+    if (emul.tx_buf && emul.tx_done_us <= now_us) {
+        const uint8_t *buf = emul.tx_buf;
+        size_t len = emul.tx_len;
+
+        emul.tx_buf = NULL;
+        if (emul.sink) {
+            emul.sink(buf, len, emul.cfg.baudrate);
+        }
+        push_event((struct uart_event){ .type = UART_TX_DONE, .data.tx = { .buf = buf, .len = len } });
+        dispatch();
+    }
+    if (emul.tx_buf) {
+        next = MIN(next, emul.tx_done_us);
+    }
+
+    if (emul.line_count > 0) {
+        next = MIN(next, emul.line[emul.line_head].at_us);
+    }
+    return next;
+}
+
+void uart_emul_init(void)
+{
+    memset(&emul, 0, sizeof(emul));
+    emul.cfg = (struct uart_config){ .baudrate = 9600, .stop_bits = 1, .data_bits = 8 };
+    emul.garbage = 0x2545F491;
+    host_add_source(uart_emul_source);
+}
+
+void uart_emul_set_tx_sink(uart_emul_tx_sink_t sink)
+{
+    emul.sink = sink;
+}
+
+void uart_emul_send(const uint8_t *data, size_t len, uint32_t baud)
+{
+    for (size_t i = 0; i < len; i++) {
+        if (emul.line_count == LINE_SIZE) {
+            fprintf(stderr, "uart_emul: line overflow\n");
+            abort();
+        }
+        uint32_t rate = (baud == UART_EMUL_BAUD_FOLLOW) ? emul.cfg.baudrate : baud;
+        emul.line_free_us = MAX(emul.line_free_us, host_clock_us) + byte_time_us(rate);
+
+        line_byte_t *byte = &emul.line[(emul.line_head + emul.line_count++) % LINE_SIZE];
+        byte->at_us = emul.line_free_us;
+        // A follower keeps up with baud changes made while its bytes are queued
+        byte->baud = baud;
+        byte->value = data[i];
+        byte->error = 0;
+    }
+    emul.stats.wire_bytes += len;
+}
+
+size_t uart_emul_pending(void)
+{
+    return emul.line_count;
+}
+
+void uart_emul_inject_error(enum uart_rx_stop_reason reason)
+{
+    emul.inject_error = (uint8_t)reason;
+}
+
+void uart_emul_refuse_next_buffer(void)
+{
+    emul.refuse_rsp = true;
+}
+
+uint32_t uart_emul_baud(void)
+{
+    return emul.cfg.baudrate;
+}
+
+void uart_emul_get_stats(uart_emul_stats_t *stats)
+{
+    *stats = emul.stats;
+}
+
+// UART API
+
+int uart_config_get(const struct device *dev, struct uart_config *cfg)
+{
+    *cfg = emul.cfg;
+    return 0;
+}
+
+int uart_configure(const struct device *dev, const struct uart_config *cfg)
+{
+    if (cfg->baudrate == 0) {
+        return -EINVAL;
+    }
+    emul.cfg = *cfg;
+    return 0;
+}
+
+int uart_callback_set(const struct device *dev, uart_callback_t callback, void *user_data)
+{
+    emul.callback = callback;
+    emul.user_data = user_data;
+    return 0;
+}
+
+int uart_tx(const struct device *dev, const uint8_t *buf, size_t len, int32_t timeout)
+{
+    if (emul.tx_buf) {
+        return -EBUSY;
+    }
+    emul.tx_buf = buf;
+    emul.tx_len = len;
+    emul.tx_done_us = host_clock_us + (int64_t)len * byte_time_us(emul.cfg.baudrate);
+    return 0;
+}
+
+int uart_rx_enable(const struct device *dev, uint8_t *buf, size_t len, int32_t timeout)
+{
+    if (emul.rx_on) {
+        return -EBUSY;
+    }
+    if (busy(buf, len)) {
+        emul.stats.ownership_errors++;
+    }
+    emul.stats.rx_enables++;
+    emul.rx_on = true;
+    emul.timeout_us = timeout;
+    emul.next_buf = NULL;
+    start_buffer(buf, len);
+    dispatch();
+    return 0;
+}
+
+int uart_rx_buf_rsp(const struct device *dev, uint8_t *buf, size_t len)
+{
+    if (!emul.rx_on) {
+        return -EACCES;
+    }
+    if (emul.next_buf) {
+        return -EBUSY;
+    }
+    if (emul.refuse_rsp) {
+        emul.refuse_rsp = false;
+        return -EACCES;
+    }
+    if (busy(buf, len)) {
+        emul.stats.ownership_errors++;
+    }
+    emul.next_buf = buf;
+    emul.next_len = len;
+    return 0;
+}
+
+int uart_rx_disable(const struct device *dev)
+{
+    if (!emul.rx_on) {
+        return -EFAULT;
+    }
+    rx_stop();
+    dispatch();
+    return 0;
+}
+
+int uart_irq_callback_set(const struct device *dev, uart_irq_callback_user_data_t cb)
+{
+    emul.irq_callback = cb;
+    return 0;
+}
+
+void uart_irq_rx_enable(const struct device *dev)
+{
+    emul.irq_rx_on = true;
+}
+
+void uart_irq_rx_disable(const struct device *dev)
+{
+    emul.irq_rx_on = false;
+}
+
+int uart_poll_in(const struct device *dev, unsigned char *c)
+{
+    if (emul.fifo_count == 0) {
+        return -1;
+    }
+    *c = emul.fifo[0];
+    memmove(emul.fifo, emul.fifo + 1, --emul.fifo_count);
+    emul.stats.delivered++;
+    return 0;
+}
+
+void uart_poll_out(const struct device *dev, unsigned char c)
+{
+    if (emul.sink) {
+        emul.sink(&c, 1, emul.cfg.baudrate);
+    }
+}
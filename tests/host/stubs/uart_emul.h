@@ -0,0 +1,98 @@
+/**
+ * @file uart_emul.h
+ * @brief UART emulator behind the stubbed UART API (zephyr/drivers/uart.h)
+ *
+ * One UART on host time (host_run()), modelled on the nRF UARTE driver:
+ * - async RX: bytes land in the application's buffer one byte time apart;
+ *   RX_BUF_REQUEST once a buffer is in use, RX_RDY + RX_BUF_RELEASED when it is
+ *   full, RX_RDY for a partial buffer after the idle timeout. A full buffer
+ *   without a next one disables RX (RX_DISABLED); later bytes are lost until
+ *   uart_rx_enable(). A line error reports RX_STOPPED, releases both buffers and
+ *   disables RX
+ * - interrupt RX: a 6-byte FIFO drained with uart_poll_in() from the callback
+ * - TX: the far end gets the bytes (uart_emul_tx_sink_t) once they are on the
+ *   wire at the configured baud rate, then UART_TX_DONE
+ *
+ * Bytes sent at a baud rate the UART is not set to arrive as garbage, every
+ * eighth one with a framing error. The emulator also checks the buffer
+ * hand-over: a buffer given to the driver while it still owns it is counted in
+ * ownership_errors.
+ */
+
+#ifndef UART_EMUL_H
+#define UART_EMUL_H
+
+#include <zephyr/drivers/uart.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define UART_EMUL_BAUD_FOLLOW   0       ///< uart_emul_send(): whatever rate the UART is set to
+
+/**
+ * @brief Emulator statistics
+ */
+typedef struct {
+    uint32_t wire_bytes;            ///< Bytes sent to the UART
+    uint32_t delivered;             ///< Bytes handed to the application (RX_RDY, uart_poll_in())
+    uint32_t lost;                  ///< Bytes arriving with RX disabled, a full FIFO or an error
+    uint32_t garbled;               ///< Bytes sent at another baud rate
+    uint32_t line_errors;           ///< Framing errors (RX_STOPPED in async mode)
+    uint32_t callbacks;             ///< Callback invocations (interrupts)
+    uint32_t rx_rdy;                ///< RX_RDY events
+    uint32_t buf_requests;          ///< RX_BUF_REQUEST events
+    uint32_t buf_released;          ///< RX_BUF_RELEASED events
+    uint32_t rx_disabled;           ///< RX_DISABLED events
+    uint32_t rx_enables;            ///< uart_rx_enable() calls
+    uint32_t ownership_errors;      ///< Buffers handed over while the driver owned them
+    uint32_t tx_frames;             ///< uart_tx() transfers completed
+    uint64_t callback_ns;           ///< Host time spent in callbacks
+} uart_emul_stats_t;
+
+/**
+ * @brief Bytes the application transmitted, at the baud rate it used
+ */
+typedef void (*uart_emul_tx_sink_t)(const uint8_t *data, size_t len, uint32_t baud);
+
+/**
+ * @brief Reset the emulator to 9600 baud with RX off, and attach it to host_run()
+ */
+void uart_emul_init(void);
+
+/**
+ * @brief Where transmitted bytes go (NULL: dropped)
+ */
+void uart_emul_set_tx_sink(uart_emul_tx_sink_t sink);
+
+/**
+ * @brief Queue bytes on the line, after the ones still in flight
+ * @param baud Rate the far end sends at, UART_EMUL_BAUD_FOLLOW for the UART's own
+ */
+void uart_emul_send(const uint8_t *data, size_t len, uint32_t baud);
+
+/**
+ * @brief Bytes queued on the line and not yet received
+ */
+size_t uart_emul_pending(void);
+
+/**
+ * @brief The next byte received arrives with a line error
+ */
+void uart_emul_inject_error(enum uart_rx_stop_reason reason);
+
+/**
+ * @brief The next uart_rx_buf_rsp() comes too late and is refused (-EACCES)
+ */
+void uart_emul_refuse_next_buffer(void);
+
+/**
+ * @brief Baud rate the UART is set to
+ */
+uint32_t uart_emul_baud(void);
+
+/**
+ * @brief Get the emulator statistics
+ */
+void uart_emul_get_stats(uart_emul_stats_t *stats);
+
+#endif // UART_EMUL_H
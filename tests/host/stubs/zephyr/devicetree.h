@@ -0,0 +1,10 @@
+// Host stub: no devicetree nodes exist
+#ifndef ZEPHYR_DEVICETREE_H_STUB
+#define ZEPHYR_DEVICETREE_H_STUB
+
+#define DT_ALIAS(alias)                 0
+#define DT_NODELABEL(label)             0
+#define DT_NODE_HAS_STATUS(node, s)     0
+#define DT_NODE_EXISTS(node)            0
+
+#endif
@@ -0,0 +1,21 @@
+// Host stub: display writes are dropped
+#ifndef ZEPHYR_DRIVERS_DISPLAY_H_STUB
+#define ZEPHYR_DRIVERS_DISPLAY_H_STUB
+
+#include <zephyr/device.h>
+#include <stdint.h>
+
+struct display_buffer_descriptor {
+    uint32_t buf_size;
+    uint16_t width;
+    uint16_t height;
+    uint16_t pitch;
+};
+
+static inline int display_write(const struct device *dev, uint16_t x, uint16_t y,
+                                const struct display_buffer_descriptor *desc, const void *buf)
+{
+    return 0;
+}
+
+#endif
@@ -0,0 +1,7 @@
+// Host stub: no GPIO (code using it is behind devicetree checks)
+#ifndef ZEPHYR_DRIVERS_GPIO_H_STUB
+#define ZEPHYR_DRIVERS_GPIO_H_STUB
+
+#include <zephyr/device.h>
+
+#endif
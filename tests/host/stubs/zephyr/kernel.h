@@ -0,0 +1,143 @@
+// Host stub of the kernel API used by the modules under test (host_kernel.c)
+#ifndef ZEPHYR_KERNEL_H_STUB
+#define ZEPHYR_KERNEL_H_STUB
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <errno.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/devicetree.h>
+
+#define __noinit
+
+// Uptime follows host_clock_us (tests advance it), cycles are host nanoseconds
+extern int64_t host_clock_us;
+
+static inline int64_t k_uptime_get(void)
+{
+    return host_clock_us / 1000;
+}
+
+static inline uint32_t k_uptime_get_32(void)
+{
+    return (uint32_t)k_uptime_get();
+}
+
+// One tick per microsecond
+static inline int64_t k_uptime_ticks(void)
+{
+    return host_clock_us;
+}
+
+static inline uint64_t k_ticks_to_us_floor64(uint64_t ticks)
+{
+    return ticks;
+}
+
+static inline int32_t k_msleep(int32_t ms)
+{
+    host_clock_us += (int64_t)ms * 1000;
+    return 0;
+}
+
+uint32_t k_cycle_get_32(void);
+
+static inline uint32_t k_cyc_to_us_floor32(uint32_t cycles)
+{
+    return cycles / 1000U;
+}
+
+static inline uint64_t k_cyc_to_us_floor64(uint64_t cycles)
+{
+    return cycles / 1000U;
+}
+
+// Timeouts, in microseconds
+typedef struct {
+    int64_t us;
+} k_timeout_t;
+
+#define SYS_FOREVER_US          (-1)
+#define K_NO_WAIT               ((k_timeout_t){ .us = 0 })
+#define K_FOREVER               ((k_timeout_t){ .us = -1 })
+#define K_USEC(t)               ((k_timeout_t){ .us = (t) })
+#define K_MSEC(t)               ((k_timeout_t){ .us = (int64_t)(t) * 1000 })
+#define K_SECONDS(t)            ((k_timeout_t){ .us = (int64_t)(t) * 1000000 })
+
+/*
+ * Work queue: k_work_submit() queues an item, host_run() runs the queue and
+ * expires delayable work as host_clock_us moves (one queue, like the system
+ * work queue the firmware uses).
+ */
+struct k_work;
+typedef void (*k_work_handler_t)(struct k_work *work);
+
+struct k_work {
+    k_work_handler_t handler;
+    struct k_work *next;
+    bool queued;
+};
+
+struct k_work_delayable {
+    struct k_work work;
+    struct k_work_delayable *next_timer;
+    int64_t due_us;
+    bool scheduled;
+};
+
+#define K_WORK_DEFINE(name, h)  struct k_work name = { .handler = (h) }
+#define K_WORK_DELAYABLE_DEFINE(name, h) \
+    struct k_work_delayable name = { .work = { .handler = (h) } }
+
+void k_work_init(struct k_work *work, k_work_handler_t handler);
+int k_work_submit(struct k_work *work);
+void k_work_init_delayable(struct k_work_delayable *dwork, k_work_handler_t handler);
+int k_work_schedule(struct k_work_delayable *dwork, k_timeout_t delay);
+int k_work_reschedule(struct k_work_delayable *dwork, k_timeout_t delay);
+int k_work_cancel_delayable(struct k_work_delayable *dwork);
+
+static inline struct k_work_delayable *k_work_delayable_from_work(struct k_work *work)
+{
+    return CONTAINER_OF(work, struct k_work_delayable, work);
+}
+
+/**
+ * Event source driven by host_run() (the UART emulator): handles what is due at
+ * now_us and returns the time of its next event, INT64_MAX for none.
+ */
+typedef int64_t (*host_source_t)(int64_t now_us);
+
+void host_add_source(host_source_t source);
+
+/**
+ * Advance host_clock_us to until_us: source events and expired work in time
+ * order, the work queue run after each. Returns the number of work items run.
+ */
+uint32_t host_run(int64_t until_us);
+
+// Host time spent in work handlers, nanoseconds
+extern uint64_t host_work_ns;
+
+// Single thread: spinlocks only mark the critical sections
+struct k_spinlock {
+    int unused;
+};
+
+typedef int k_spinlock_key_t;
+
+static inline k_spinlock_key_t k_spin_lock(struct k_spinlock *lock)
+{
+    (void)lock;
+    return 0;
+}
+
+static inline void k_spin_unlock(struct k_spinlock *lock, k_spinlock_key_t key)
+{
+    (void)lock;
+    (void)key;
+}
+
+#endif
@@ -0,0 +1,2 @@
+// Host stub: the host's own time.h
+#include <time.h>
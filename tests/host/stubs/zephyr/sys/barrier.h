@@ -0,0 +1,10 @@
+// Host stub of the memory barriers
+#ifndef ZEPHYR_SYS_BARRIER_H_STUB
+#define ZEPHYR_SYS_BARRIER_H_STUB
+
+static inline void barrier_dmem_fence_full(void)
+{
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+#endif
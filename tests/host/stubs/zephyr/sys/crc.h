@@ -0,0 +1,11 @@
+// Host stub of the CRC API (host_kernel.c)
+#ifndef ZEPHYR_SYS_CRC_H_STUB
+#define ZEPHYR_SYS_CRC_H_STUB
+
+#include <stddef.h>
+#include <stdint.h>
+
+uint32_t crc32_ieee(const uint8_t *data, size_t len);
+uint32_t crc32_ieee_update(uint32_t crc, const uint8_t *data, size_t len);
+
+#endif
@@ -0,0 +1,11 @@
+// Host stub: printk() prints only when host_printk_enabled is set
+#ifndef ZEPHYR_SYS_PRINTK_H_STUB
+#define ZEPHYR_SYS_PRINTK_H_STUB
+
+#include <stdbool.h>
+
+extern bool host_printk_enabled;
+
+void printk(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+
+#endif
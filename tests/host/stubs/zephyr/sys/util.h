@@ -0,0 +1,14 @@
+// Host stub of the Zephyr utility macros
+#ifndef ZEPHYR_SYS_UTIL_H_STUB
+#define ZEPHYR_SYS_UTIL_H_STUB
+
+#define MIN(a, b)               (((a) < (b)) ? (a) : (b))
+#define MAX(a, b)               (((a) > (b)) ? (a) : (b))
+#define CLAMP(v, lo, hi)        MIN(MAX(v, lo), hi)
+#define BIT(n)                  (1UL << (n))
+#define BIT_MASK(n)             (BIT(n) - 1UL)
+#define ARRAY_SIZE(a)           (sizeof(a) / sizeof((a)[0]))
+#define DIV_ROUND_UP(n, d)      (((n) + (d) - 1) / (d))
+#define CONTAINER_OF(p, t, f)   ((t *)(((char *)(p)) - offsetof(t, f)))
+
+#endif
@@ -0,0 +1,29 @@
+// Host stub of the timing API: the counter is host nanoseconds (host_kernel.c)
+#ifndef ZEPHYR_TIMING_TIMING_H_STUB
+#define ZEPHYR_TIMING_TIMING_H_STUB
+
+#include <stdint.h>
+
+typedef uint64_t timing_t;
+
+timing_t timing_counter_get(void);
+
+static inline void timing_init(void)
+{
+}
+
+static inline void timing_start(void)
+{
+}
+
+static inline uint64_t timing_cycles_get(volatile timing_t *const start, volatile timing_t *const end)
+{
+    return *end - *start;
+}
+
+static inline uint64_t timing_cycles_to_ns(uint64_t cycles)
+{
+    return cycles;
+}
+
+#endif
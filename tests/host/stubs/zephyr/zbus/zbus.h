@@ -0,0 +1,76 @@
+// Host stub of zbus: channels hold their last message, listeners run on publish
+#ifndef ZEPHYR_ZBUS_H_STUB
+#define ZEPHYR_ZBUS_H_STUB
+
+#include <zephyr/kernel.h>
+#include <string.h>
+
+struct zbus_channel;
+
+struct zbus_observer {
+    void (*callback)(const struct zbus_channel *chan);
+};
+
+#define ZBUS_MAX_OBSERVERS      4
+
+struct zbus_channel {
+    void *message;
+    size_t message_size;
+    const struct zbus_observer *observers[ZBUS_MAX_OBSERVERS];
+};
+
+#define ZBUS_OBSERVERS_EMPTY
+#define ZBUS_MSG_INIT(...)      { __VA_ARGS__ }
+
+#define ZBUS_CHAN_DEFINE(name, type, validator, user_data, observers, init_val) \
+    static type _zbus_message_##name = init_val;                                 \
+    struct zbus_channel name = {                                                 \
+        .message = &_zbus_message_##name,                                        \
+        .message_size = sizeof(type),                                            \
+    }
+
+// Up to four channels per declaration
+#define ZBUS_CHAN_DECLARE(...) \
+    _ZBUS_PICK(__VA_ARGS__, _ZBUS_DECL4, _ZBUS_DECL3, _ZBUS_DECL2, _ZBUS_DECL1)(__VA_ARGS__)
+#define _ZBUS_PICK(_1, _2, _3, _4, n, ...) n
+#define _ZBUS_DECL1(a)          extern struct zbus_channel a
+#define _ZBUS_DECL2(a, ...)     _ZBUS_DECL1(a); _ZBUS_DECL1(__VA_ARGS__)
+#define _ZBUS_DECL3(a, ...)     _ZBUS_DECL1(a); _ZBUS_DECL2(__VA_ARGS__)
+#define _ZBUS_DECL4(a, ...)     _ZBUS_DECL1(a); _ZBUS_DECL3(__VA_ARGS__)
+
+#define ZBUS_LISTENER_DEFINE(name, cb) \
+    const struct zbus_observer name = { .callback = (cb) }
+
+// Registered before main() runs
+#define ZBUS_CHAN_ADD_OBS(chan, obs, prio)                                       \
+    __attribute__((constructor)) static void _zbus_add_##obs(void)               \
+    {                                                                            \
+        for (int i = 0; i < ZBUS_MAX_OBSERVERS; i++) {                           \
+            if (!(chan).observers[i]) {                                          \
+                (chan).observers[i] = &(obs);                                    \
+                break;                                                           \
+            }                                                                    \
+        }                                                                        \
+    }
+
+static inline const void *zbus_chan_const_msg(const struct zbus_channel *chan)
+{
+    return chan->message;
+}
+
+static inline int zbus_chan_read(const struct zbus_channel *chan, void *msg, k_timeout_t timeout)
+{
+    memcpy(msg, chan->message, chan->message_size);
+    return 0;
+}
+
+static inline int zbus_chan_pub(struct zbus_channel *chan, const void *msg, k_timeout_t timeout)
+{
+    memcpy(chan->message, msg, chan->message_size);
+    for (int i = 0; i < ZBUS_MAX_OBSERVERS && chan->observers[i]; i++) {
+        chan->observers[i]->callback(chan);
+    }
+    return 0;
+}
+
+#endif
@@ -0,0 +1,96 @@
+/**
+ * @file test_backend.c
+ * @brief Both receiver backends publish the same fixes from the same log
+ *
+ * Built once per backend: test_backend_neo6m (interrupt RX, uart_poll_in()
+ * from the callback) and test_backend_neo7m (async RX with DMA ping-pong and
+ * the receiver configuration). The emulated receiver plays a committed log
+ * (data/drive.nmea, or data/drive.ubx for NAV-PVT) at whatever rate the UART
+ * is set to, so the NEO-7M autobaud loses nothing, and gps_snapshot() is
+ * written to a file near the end of every epoch. The Makefile compares the
+ * files of the two backends; the reception time (utc_update_ms) depends on
+ * the transport and is left out.
+ *
+ * Usage: test_backend_<backend> <log> <snapshot file>
+ */
+
+#include "host_test.h"
+#include "gnss_receiver.h"
+#include "uart_emul.h"
+#include "gnss_core.h"
+#include <string.h>
+
+#define SAMPLE_US       990000          ///< Into each epoch: the 9600 baud burst is over
+#define START_SOD       (23 * 3600 + 59 * 60)   ///< First epoch of gen_gnss_log.py
+#define NO_FIX_EPOCHS   5
+#define TUNNEL_FIRST    80
+#define TUNNEL_LAST     89
+
+// Globals of main.c read by prayerTime.c
+double Lng, Lat, D;
+
+// The display is not part of this test
+void ili9341_draw_string(uint16_t x, uint16_t y, const char *str, uint16_t color, uint16_t bg,
+                         uint8_t size)
+{
+}
+
+static void write_snapshot(FILE *out, int epoch, const struct gps_data *gps)
+{
+    fprintf(out, "%3d %d %.7f %.7f %c %c %d %.2f %u %d %d %d-%02d-%02d %d %s|%s|%s|%s %d %d\n", epoch,
+            gps->valid, gps->latitude, gps->longitude, gps->lat_hemisphere ? gps->lat_hemisphere : '-',
+            gps->lon_hemisphere ? gps->lon_hemisphere : '-', gps->seeHeight_valid, gps->seeHeight,
+            gps->hdop_x100, gps->utc_sod, gps->date_valid, gps->utc_year, gps->utc_month, gps->utc_day,
+            gps->date_ordinal, gps->time_str, gps->date_str, gps->hijri_date_str, gps->day_of_week,
+            gps->hijri_valid, gps->day_valid);
+}
+
+int main(int argc, char **argv)
+{
+    char name[96];
+    const char *backend = strrchr(argv[0], '/') ? strrchr(argv[0], '/') + 1 : argv[0];
+
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s <log> <snapshot file>\n", backend);
+        return 2;
+    }
+    const char *log = argv[1];
+    bool ubx = strlen(log) > 4 && strcmp(log + strlen(log) - 4, ".ubx") == 0;
+    snprintf(name, sizeof(name), "%s %s", backend, log);
+
+    FILE *out = fopen(argv[2], "w");
+    int epochs = ubx ? gnss_receiver_load(NULL, log) : gnss_receiver_load(log, NULL);
+    CHECK(out && epochs > TUNNEL_LAST, "%s: %d epochs, %s", log, epochs, argv[2]);
+    if (!out || epochs <= TUNNEL_LAST) {
+        return host_test_done(name);
+    }
+
+    uart_emul_init();
+    gnss_receiver_start(9600, GNSS_RECEIVER_FIXED);
+    CHECK(gps_init() == 0, "gps_init() failed");
+
+    for (int epoch = 0; epoch < epochs; epoch++) {
+        struct gps_data gps;
+
+        host_run((int64_t)epoch * 1000000 + SAMPLE_US);
+        gps_snapshot(&gps);
+        write_snapshot(out, epoch, &gps);
+
+        // Every epoch is in by the sample time, fix or not
+        bool fix = epoch >= NO_FIX_EPOCHS && (epoch < TUNNEL_FIRST || epoch > TUNNEL_LAST);
+        CHECK(gps.utc_sod == (START_SOD + epoch) % 86400, "epoch %d: time %d", epoch, gps.utc_sod);
+        CHECK(gps.valid == fix, "epoch %d: valid %d", epoch, gps.valid);
+    }
+    fclose(out);
+
+    gps_rx_stats_t stats;
+    uart_emul_stats_t uart;
+    gnss_core_get_rx_stats(&stats);
+    uart_emul_get_stats(&uart);
+    CHECK(uart.lost == 0 && uart.delivered == stats.bytes, "%u bytes lost, %u delivered, core got %u",
+          uart.lost, uart.delivered, stats.bytes);
+    CHECK(stats.checksum_errors == 0 && stats.framing_errors == 0 && stats.lines_dropped == 0,
+          "%u checksum errors, %u framing errors, %u dropped", stats.checksum_errors,
+          stats.framing_errors, stats.lines_dropped);
+    return host_test_done(name);
+}
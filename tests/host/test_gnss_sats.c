@@ -0,0 +1,173 @@
+/**
+ * @file test_gnss_sats.c
+ * @brief Satellite tables (src/gnss_sats.c): GSV sequences and GSA lists
+ *
+ * GSV: a sequence received in order is published and drops the satellites
+ * it no longer reports; one with a lost middle part updates in place but
+ * neither publishes nor removes anything, and counts as broken once; a
+ * sequence restarting at part 1 abandons the old one; 33 satellites overflow
+ * the 32-slot table by one. GSA: GN lists match any constellation, GP only
+ * GPS, and a continuation (the next constellation's GSA of the same epoch)
+ * adds to the list instead of replacing it.
+ */
+
+#include "host_test.h"
+#include "gnss_sats.h"
+#include <zephyr/sys/util.h>
+
+#define GLONASS_ID      65              ///< First GLONASS satellite ID
+
+static gnss_sats_t table;
+
+// Part 'number' of a 'total'-part sequence reporting satellites first..first+count-1
+static void gsv(uint8_t system, int total, int number, int in_view, uint8_t first, int count)
+{
+    gnss_sat_t sats[GNSS_SATS_PER_GSV];
+
+    for (int i = 0; i < count; i++) {
+        sats[i] = (gnss_sat_t){ .id = first + i, .elevation = 45, .azimuth = 90, .snr = 30 };
+    }
+    gnss_sats_gsv(system, total, number, in_view, sats, count);
+}
+
+// A whole sequence reporting satellites first..first+count-1, in order
+static void gsv_sequence(uint8_t system, uint8_t first, int count)
+{
+    int total = (count + GNSS_SATS_PER_GSV - 1) / GNSS_SATS_PER_GSV;
+
+    for (int part = 1; part <= total; part++) {
+        int offset = (part - 1) * GNSS_SATS_PER_GSV;
+        gsv(system, total, part, count, first + offset, MIN(GNSS_SATS_PER_GSV, count - offset));
+    }
+}
+
+static const gnss_sat_t *find(uint8_t system, uint8_t id)
+{
+    for (int i = 0; i < table.count; i++) {
+        if (table.sat[i].system == system && table.sat[i].id == id) {
+            return &table.sat[i];
+        }
+    }
+    return NULL;
+}
+
+static void check_sequences(void)
+{
+    gnss_sats_stats_t stats;
+
+    // In order: published, 1-10 in view
+    gsv_sequence(GNSS_SYSTEM_GPS, 1, 10);
+    uint32_t generation = gnss_sats_snapshot(&table);
+    gnss_sats_get_stats(&stats);
+    CHECK(generation == 1 && stats.sequences == 1 && table.count == 10 && table.in_view == 10 &&
+          table.tracked == 10, "in order: generation %u, %u sequences, %u satellites, %u in view",
+          generation, stats.sequences, table.count, table.in_view);
+
+    // 1 and 2 have set
+    gsv_sequence(GNSS_SYSTEM_GPS, 3, 8);
+    gnss_sats_snapshot(&table);
+    gnss_sats_get_stats(&stats);
+    CHECK(stats.set == 2 && table.count == 8 && !find(GNSS_SYSTEM_GPS, 1) && find(GNSS_SYSTEM_GPS, 10),
+          "%u set, %u satellites", stats.set, table.count);
+
+    // Middle part lost: satellites 3-6 (part 1) and 11-12 (part 3) are updated, nothing
+    // is published or removed
+    gsv(GNSS_SYSTEM_GPS, 3, 1, 10, 3, 4);
+    gsv(GNSS_SYSTEM_GPS, 3, 3, 10, 11, 2);
+    // A late part of the abandoned sequence is not counted again
+    gsv(GNSS_SYSTEM_GPS, 3, 2, 10, 7, 4);
+    generation = gnss_sats_snapshot(&table);
+    gnss_sats_get_stats(&stats);
+    CHECK(stats.broken == 1 && stats.sequences == 2 && generation == 2, "lost part: %u broken, "
+          "%u sequences, generation %u", stats.broken, stats.sequences, generation);
+
+    // Complete again: 11-12 are kept from the broken sequence, 7-10 have set
+    gsv(GNSS_SYSTEM_GPS, 2, 1, 6, 3, 4);
+    gsv(GNSS_SYSTEM_GPS, 2, 2, 6, 11, 2);
+    gnss_sats_snapshot(&table);
+    gnss_sats_get_stats(&stats);
+    CHECK(stats.sequences == 3 && table.count == 6 && find(GNSS_SYSTEM_GPS, 12) && !find(GNSS_SYSTEM_GPS, 7),
+          "after the broken sequence: %u sequences, %u satellites", stats.sequences, table.count);
+
+    // Restart at part 1: the abandoned sequence is broken, the new one judges what set
+    gsv(GNSS_SYSTEM_GPS, 2, 1, 8, 20, 4);
+    gsv(GNSS_SYSTEM_GPS, 2, 1, 5, 3, 4);
+    gsv(GNSS_SYSTEM_GPS, 2, 2, 5, 11, 1);
+    gnss_sats_snapshot(&table);
+    gnss_sats_get_stats(&stats);
+    CHECK(stats.broken == 2 && stats.sequences == 4, "restart: %u broken, %u sequences", stats.broken,
+          stats.sequences);
+    CHECK(table.count == 5 && !find(GNSS_SYSTEM_GPS, 20) && !find(GNSS_SYSTEM_GPS, 12),
+          "restart: %u satellites", table.count);
+}
+
+static void check_overflow(void)
+{
+    gnss_sats_stats_t stats;
+
+    // 20 GPS + 13 GLONASS: one more than the table holds
+    gsv_sequence(GNSS_SYSTEM_GPS, 1, 20);
+    gsv_sequence(GNSS_SYSTEM_GLONASS, GLONASS_ID, 13);
+    gnss_sats_snapshot(&table);
+    gnss_sats_get_stats(&stats);
+    CHECK(stats.overflows == 1 && table.count == GNSS_SATS_MAX && table.in_view == 33,
+          "33 satellites: %u overflows, %u in the table, %u in view", stats.overflows, table.count,
+          table.in_view);
+    CHECK(!find(GNSS_SYSTEM_GLONASS, GLONASS_ID + 12), "satellite beyond the table stored");
+
+    // Fewer GPS satellites: the last GLONASS one fits again
+    gsv_sequence(GNSS_SYSTEM_GPS, 1, 16);
+    gsv_sequence(GNSS_SYSTEM_GLONASS, GLONASS_ID, 13);
+    gnss_sats_snapshot(&table);
+    CHECK(table.count == 29 && find(GNSS_SYSTEM_GLONASS, GLONASS_ID + 12), "%u satellites after "
+          "the GPS ones set", table.count);
+}
+
+static int used_count(void)
+{
+    int used = 0;
+
+    for (int i = 0; i < table.count; i++) {
+        used += table.sat[i].used;
+    }
+    return used;
+}
+
+static void check_gsa(void)
+{
+    const uint8_t gps_ids[] = { 1, 2, 3 };
+    const uint8_t mixed_ids[] = { 4, GLONASS_ID, GLONASS_ID + 1 };
+    const uint8_t glonass_ids[] = { GLONASS_ID + 2, GLONASS_ID + 3 };
+
+    // GN matches any constellation
+    gnss_sats_gsa(GNSS_SYSTEM_ANY, 3, mixed_ids, 3, false);
+    gnss_sats_snapshot(&table);
+    CHECK(table.used == 3 && used_count() == 3 && table.fix_type == 3 && find(GNSS_SYSTEM_GLONASS,
+          GLONASS_ID)->used, "GN GSA: %u used, %d marked", table.used, used_count());
+
+    // GP only GPS: the GLONASS IDs are not GPS satellites
+    gnss_sats_gsa(GNSS_SYSTEM_GPS, 3, mixed_ids, 3, false);
+    gnss_sats_snapshot(&table);
+    CHECK(used_count() == 1 && find(GNSS_SYSTEM_GPS, 4)->used, "GP GSA: %d marked", used_count());
+
+    // GP then GL in the same epoch: one list
+    gnss_sats_gsa(GNSS_SYSTEM_GPS, 3, gps_ids, 3, false);
+    gnss_sats_gsa(GNSS_SYSTEM_GLONASS, 3, glonass_ids, 2, true);
+    gnss_sats_snapshot(&table);
+    CHECK(table.used == 5 && used_count() == 5 && !find(GNSS_SYSTEM_GPS, 4)->used,
+          "GP + GL GSA: %u used, %d marked", table.used, used_count());
+
+    // Next epoch: a new list
+    gnss_sats_gsa(GNSS_SYSTEM_GPS, 2, gps_ids, 2, false);
+    gnss_sats_snapshot(&table);
+    CHECK(table.used == 2 && used_count() == 2 && table.fix_type == 2, "next epoch: %u used, fix %u",
+          table.used, table.fix_type);
+}
+
+int main(void)
+{
+    check_sequences();
+    check_overflow();
+    check_gsa();
+    return host_test_done("test_gnss_sats");
+}
@@ -0,0 +1,197 @@
+/**
+ * @file test_gps_position.c
+ * @brief Position filter (src/gps_position.c) and the fix events built on it (src/gps_events.c)
+ *
+ * Synthetic fixes, one per second, with Gaussian noise scaled by an HDOP
+ * between 1 and 3:
+ * - six hours stationary, with a 1.5 km multipath fix every hour and one
+ *   fix 20 km off: one ACQUIRED, no MOVED, every multipath fix suppressed and
+ *   the far one held out as an outlier. Once settled the smoothed position
+ *   stays close to the true one; a multipath fix is within the outlier
+ *   distance, so it pulls the average for a few fixes, but never as far as
+ *   the move threshold
+ * - ten minutes driving north at 50 km/h: a MOVED about every kilometre and
+ *   the smoothed position lagging by a bounded distance
+ * - a 500 km relocation (the replay script's jump): one relocation restart
+ *   and one MOVED
+ * - a lost fix: LOST, a filter reset, then ACQUIRED again
+ * Event counts are compared against the raw fixes with the same threshold.
+ */
+
+#include "host_test.h"
+#include "gps_position.h"
+#include "gps_events.h"
+#include "gnss_core.h"
+#include <math.h>
+
+#define START_LAT       48.137
+#define START_LON       11.575
+#define M_PER_DEG       111320.0
+#define NOISE_M         2.5             ///< Position error per axis at HDOP 1 (1 sigma)
+#define STATIONARY_S    (6 * 3600)
+#define MULTIPATH_M     1500.0
+#define OUTLIER_M       20000.0
+#define DRIVE_S         600
+#define DRIVE_MPS       (50.0 / 3.6)
+#define SETTLED_ERR_M   15.0            ///< Stationary error bound...
+#define MULTIPATH_S     60              ///< ...except this long after a multipath fix
+#define MULTIPATH_ERR_M 500.0
+#define DRIVE_LAG_M     250.0
+
+static struct {
+    uint32_t acquired;
+    uint32_t lost;
+    uint32_t moved;
+} events;
+
+static uint32_t rng = 1;
+static int32_t epoch;
+static uint32_t raw_moves;
+static double raw_lat, raw_lon;
+
+static void on_fix(const struct zbus_channel *chan)
+{
+    const gps_fix_msg_t *msg = zbus_chan_const_msg(chan);
+
+    switch (msg->event) {
+    case GPS_FIX_ACQUIRED:
+        events.acquired++;
+        break;
+    case GPS_FIX_LOST:
+        events.lost++;
+        break;
+    case GPS_FIX_MOVED:
+        events.moved++;
+        break;
+    }
+}
+
+ZBUS_LISTENER_DEFINE(test_fix_listener, on_fix);
+ZBUS_CHAN_ADD_OBS(gps_fix_chan, test_fix_listener, 0);
+
+static double uniform(void)
+{
+    rng = rng * 1664525U + 1013904223U;
+    return ((rng >> 8) + 0.5) / (double)(1U << 24);
+}
+
+static double gaussian(void)
+{
+    return sqrt(-2.0 * log(uniform())) * cos(2.0 * M_PI * uniform());
+}
+
+// Offset a position by metres north and east
+static void offset(double lat, double lon, double north_m, double east_m, double *out_lat, double *out_lon)
+{
+    *out_lat = lat + north_m / M_PER_DEG;
+    *out_lon = lon + east_m / (M_PER_DEG * cos(lat * M_PI / 180.0));
+}
+
+// One epoch's fix at the true position, error_m further east
+static void fix(double lat, double lon, double error_m, bool valid)
+{
+    double hdop = 1.0 + 2.0 * uniform();
+    struct gps_data gps = {
+        .valid = valid,
+        .utc_sod = epoch++ % 86400,
+        .hdop_x100 = (uint16_t)(hdop * 100),
+    };
+
+    offset(lat, lon, gaussian() * NOISE_M * hdop, error_m + gaussian() * NOISE_M * hdop, &gps.latitude,
+           &gps.longitude);
+    gps_events_update(&gps);
+
+    // What a raw threshold would have announced
+    if (valid) {
+        if (gps_position_moved(gps.latitude, gps.longitude, raw_lat, raw_lon)) {
+            raw_moves++;
+            raw_lat = gps.latitude;
+            raw_lon = gps.longitude;
+        }
+    }
+}
+
+static double error_m(double lat, double lon)
+{
+    double avg_lat, avg_lon;
+
+    if (!gps_position_get(&avg_lat, &avg_lon)) {
+        return INFINITY;
+    }
+    return gps_position_distance_km(lat, lon, avg_lat, avg_lon) * 1000.0;
+}
+
+int main(void)
+{
+    gps_position_stats_t stats;
+    gps_events_stats_t event_stats;
+    double max_err = 0.0, max_multipath_err = 0.0;
+
+    // Stationary, with hourly multipath and one far outlier
+    raw_lat = START_LAT;
+    raw_lon = START_LON;
+    for (int s = 0; s < STATIONARY_S; s++) {
+        double error = (s % 3600 == 1800) ? MULTIPATH_M : (s == 9100) ? OUTLIER_M : 0.0;
+
+        fix(START_LAT, START_LON, error, true);
+        if (s < GPS_POSITION_AVG_FIXES) {
+            continue;
+        }
+        if (s % 3600 >= 1800 && s % 3600 < 1800 + MULTIPATH_S) {
+            max_multipath_err = fmax(max_multipath_err, error_m(START_LAT, START_LON));
+        } else {
+            max_err = fmax(max_err, error_m(START_LAT, START_LON));
+        }
+    }
+    gps_position_get_stats(&stats);
+    gps_events_get_stats(&event_stats);
+    printf("stationary %d h: max error %.1f m, %.0f m after multipath, %u MOVED (raw threshold: %u)\n",
+           STATIONARY_S / 3600, max_err, max_multipath_err, events.moved, raw_moves);
+    CHECK(events.acquired == 1 && events.moved == 0, "%u ACQUIRED, %u MOVED while stationary",
+          events.acquired, events.moved);
+    CHECK(gps_position_settled() && stats.settled == 1, "settled %u times", stats.settled);
+    CHECK(event_stats.suppressed == STATIONARY_S / 3600 + 1,
+          "%u of %d multipath and outlier fixes suppressed", event_stats.suppressed, STATIONARY_S / 3600 + 1);
+    CHECK(stats.outliers == 1 && stats.jumps == 0, "%u outliers, %u jumps", stats.outliers, stats.jumps);
+    CHECK(max_err < SETTLED_ERR_M, "stationary error %.1f m", max_err);
+    CHECK(max_multipath_err < MULTIPATH_ERR_M, "error %.0f m after a multipath fix", max_multipath_err);
+
+    // Driving north
+    uint32_t raw_before = raw_moves;
+    double lat = START_LAT;
+    for (int s = 0; s < DRIVE_S; s++) {
+        lat = START_LAT + DRIVE_MPS * s / M_PER_DEG;
+        fix(lat, START_LON, 0.0, true);
+    }
+    double lag = error_m(lat, START_LON);
+    int expected = (int)(DRIVE_MPS * DRIVE_S / 1000.0 / GPS_POSITION_MOVE_KM);
+    printf("drive %.1f km: %u MOVED (raw threshold: %u), lag %.0f m\n", DRIVE_MPS * DRIVE_S / 1000.0,
+           events.moved, raw_moves - raw_before, lag);
+    CHECK(events.moved >= (uint32_t)expected - 1 && events.moved <= (uint32_t)expected,
+          "%u MOVED over the drive, expected %d", events.moved, expected);
+    CHECK(lag < DRIVE_LAG_M, "lag %.0f m", lag);
+
+    // 500 km relocation: restarted there after GPS_POSITION_JUMP_FIXES fixes
+    double far_lat, far_lon;
+    uint32_t moved_before = events.moved;
+    offset(lat, START_LON, 500000.0, 0.0, &far_lat, &far_lon);
+    for (int s = 0; s < 60; s++) {
+        fix(far_lat, far_lon, 0.0, true);
+    }
+    gps_position_get_stats(&stats);
+    CHECK(stats.jumps == 1 && stats.outliers == 1 + GPS_POSITION_JUMP_FIXES - 1,
+          "%u jumps, %u outliers after the relocation", stats.jumps, stats.outliers);
+    CHECK(events.moved == moved_before + 1, "%u MOVED for one relocation", events.moved - moved_before);
+    CHECK(error_m(far_lat, far_lon) < SETTLED_ERR_M, "%.0f m off after the relocation",
+          error_m(far_lat, far_lon));
+
+    // Fix lost, then back at the same place
+    fix(far_lat, far_lon, 0.0, false);
+    CHECK(events.lost == 1 && !gps_position_get(&(double){ 0 }, &(double){ 0 }), "no LOST / filter reset");
+    fix(far_lat, far_lon, 0.0, true);
+    gps_position_get_stats(&stats);
+    CHECK(events.acquired == 2 && stats.resets == 1, "%u ACQUIRED, %u resets", events.acquired,
+          stats.resets);
+
+    return host_test_done("test_gps_position");
+}
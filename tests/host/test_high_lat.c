@@ -0,0 +1,86 @@
+/**
+ * @file test_high_lat.c
+ * @brief High-latitude sweep of prayer_day_offsets() (src/prayer_methods.c)
+ *
+ * Every day of 2025 at latitudes 45-66 N, with every method, high-latitude
+ * rule and Asr factor: no event may be NaN or infinite, and the events must
+ * stay in order (Fajr <= sunrise < noon < Asr <= sunset <= Maghrib <= Isha,
+ * Isha at most 24 h after Fajr). Each day's cost goes into a histogram; the
+ * worst case is bounded because the rules only reuse sunrise and sunset.
+ */
+
+#include "host_test.h"
+#include "prayer_methods.h"
+#include "ephemeris.h"
+#include "time_of_day.h"
+#include <math.h>
+
+#define DAYS        365
+#define BUCKETS     8           // Powers of two from 128 ns
+
+int main(void)
+{
+    int32_t first = tod_days_from_civil(2025, 1, 1);
+    long computations = 0, adjusted_days = 0;
+    long histogram[BUCKETS] = { 0 };
+    int64_t worst_ns = 0;
+
+    for (int d = 0; d < DAYS; d++) {
+        ephemeris_sun_t sun;
+        ephemeris_meeus_backend.sun(2451545.0 + first + d, &sun);
+
+        for (int lat = 45; lat <= 66; lat++) {
+            for (int m = 0; m < PRAYER_METHOD_COUNT; m++) {
+                for (int rule = 0; rule < PRAYER_HIGH_LAT_COUNT; rule++) {
+                    for (int asr = PRAYER_ASR_STANDARD; asr <= PRAYER_ASR_HANAFI; asr++) {
+                        prayer_day_terms_t terms;
+                        prayer_day_offsets_t o;
+
+                        int64_t start = host_now_ns();
+                        prayer_day_terms_init(&terms, (prayer_method_id_t)m, (prayer_asr_method_t)asr,
+                                              lat, sun.declination, 100.0);
+                        int adjusted = prayer_day_offsets(&terms, (prayer_high_lat_rule_t)rule, &o);
+                        int64_t ns = host_now_ns() - start;
+
+                        int bucket = 0;
+                        while (bucket < BUCKETS - 1 && ns >= (128LL << bucket)) {
+                            bucket++;
+                        }
+                        histogram[bucket]++;
+                        if (ns > worst_ns) {
+                            worst_ns = ns;
+                        }
+                        computations++;
+                        adjusted_days += adjusted > 0;
+
+                        double v[6] = { -o.fajr, -o.sunrise, o.asr, o.sunset, o.maghrib, o.isha };
+                        bool finite = true;
+                        for (int i = 0; i < 6; i++) {
+                            finite &= isfinite(v[i]);
+                        }
+                        CHECK(finite, "NaN/inf at %d N, day %d, %s, rule %d, asr %d",
+                              lat, d, prayer_methods[m].name, rule, asr);
+                        CHECK(v[0] <= v[1] && v[1] < 0 && v[2] > 0 && v[2] <= v[3] && v[3] <= v[4] &&
+                              v[4] <= v[5] && v[5] - v[0] <= 24.0,
+                              "order at %d N, day %d, %s, rule %d, asr %d: %.3f %.3f %.3f %.3f %.3f %.3f",
+                              lat, d, prayer_methods[m].name, rule, asr,
+                              v[0], v[1], v[2], v[3], v[4], v[5]);
+                    }
+                }
+            }
+        }
+    }
+
+    printf("test_high_lat: %ld day computations, %ld with a high-latitude adjustment\n",
+           computations, adjusted_days);
+    printf("Per-day cost (terms + offsets, including two clock reads):\n");
+    for (int b = 0; b < BUCKETS; b++) {
+        if (b < BUCKETS - 1) {
+            printf("  < %5lld ns %8ld\n", 128LL << b, histogram[b]);
+        } else {
+            printf("  >=%5lld ns %8ld\n", 128LL << (b - 1), histogram[b]);
+        }
+    }
+    printf("  worst %lld ns (outliers are host scheduling)\n", (long long)worst_ns);
+    return host_test_done("test_high_lat");
+}
@@ -0,0 +1,89 @@
+/**
+ * @file test_hijri.c
+ * @brief Exhaustive Hijri conversion test (src/hijri.c)
+ *
+ * Every day of the Umm al-Qura table range and of +-2000 years of the tabular
+ * fallback around it must convert to a valid date that converts back to the
+ * same day, and consecutive days must follow each other (next day, or day 1
+ * of the next month after the last day of the month). Known official month
+ * starts anchor the table itself; the Makefile also checks that the table is
+ * what tools/gen_hijri_table.py generates.
+ */
+
+#include "host_test.h"
+#include "hijri.h"
+#include "hijri_table.h"
+#include "time_of_day.h"
+
+#define SWEEP_DAYS  800000      // Tabular range on each side of 2000-01-01
+
+// Official Umm al-Qura dates
+static const struct {
+    int year, month, day;       // Gregorian
+    int hyear, hmonth, hday;
+} anchors[] = {
+    { 2000, 1, 1, 1420, 9, 24 },
+    { 2010, 8, 11, 1431, 9, 1 },
+    { 2023, 3, 23, 1444, 9, 1 },
+    { 2024, 3, 11, 1445, 9, 1 },
+    { 2025, 3, 1, 1446, 9, 1 },
+    { 2025, 6, 26, 1447, 1, 1 },
+    { 2026, 2, 18, 1447, 9, 1 },
+};
+
+static bool follows(hijri_date_t prev, hijri_date_t next)
+{
+    if (next.year == prev.year && next.month == prev.month) {
+        return next.day == prev.day + 1;
+    }
+    if (next.day != 1 || prev.day != hijri_month_length(prev.year, prev.month)) {
+        return false;
+    }
+    return (next.year == prev.year && next.month == prev.month + 1) ||
+           (next.year == prev.year + 1 && next.month == 1 && prev.month == 12);
+}
+
+int main(void)
+{
+    for (size_t i = 0; i < sizeof(anchors) / sizeof(anchors[0]); i++) {
+        int32_t days = tod_days_from_civil(anchors[i].year, anchors[i].month, anchors[i].day);
+        hijri_date_t h = hijri_from_days(days);
+
+        CHECK(h.year == anchors[i].hyear && h.month == anchors[i].hmonth && h.day == anchors[i].hday,
+              "%04d-%02d-%02d -> %d/%d/%d, expected %d/%d/%d", anchors[i].year, anchors[i].month,
+              anchors[i].day, h.day, h.month, h.year, anchors[i].hday, anchors[i].hmonth,
+              anchors[i].hyear);
+    }
+
+    int32_t first = hijri_to_days(HIJRI_TABLE_FIRST_YEAR, 1, 1);
+    int32_t end = hijri_to_days(HIJRI_TABLE_LAST_YEAR, 12, hijri_month_length(HIJRI_TABLE_LAST_YEAR, 12)) + 1;
+    CHECK(hijri_days_in_table(first) && !hijri_days_in_table(first - 1), "table start %d", first);
+    CHECK(hijri_days_in_table(end - 1) && !hijri_days_in_table(end), "table end %d", end);
+
+    long table_days = 0;
+    hijri_date_t prev = hijri_from_days(-SWEEP_DAYS);
+    for (int32_t days = -SWEEP_DAYS; days <= SWEEP_DAYS; days++) {
+        hijri_date_t h = hijri_from_days(days);
+
+        CHECK(h.month >= 1 && h.month <= 12 && h.day >= 1 && h.day <= hijri_month_length(h.year, h.month),
+              "day %d -> %d/%d/%d out of range", days, h.day, h.month, h.year);
+        CHECK(hijri_to_days(h.year, h.month, h.day) == days,
+              "day %d -> %d/%d/%d -> %d", days, h.day, h.month, h.year,
+              hijri_to_days(h.year, h.month, h.day));
+        if (days > -SWEEP_DAYS) {
+            CHECK(follows(prev, h), "day %d: %d/%d/%d after %d/%d/%d", days, h.day, h.month,
+                  h.year, prev.day, prev.month, prev.year);
+        }
+        if (hijri_days_in_table(days)) {
+            CHECK(h.year >= HIJRI_TABLE_FIRST_YEAR && h.year <= HIJRI_TABLE_LAST_YEAR,
+                  "day %d in the table but in year %d", days, h.year);
+            table_days++;
+        }
+        prev = h;
+    }
+    CHECK(table_days == end - first, "%ld table days, expected %d", table_days, end - first);
+
+    printf("test_hijri: %d days (%ld in the %d-%d AH table)\n", 2 * SWEEP_DAYS + 1, table_days,
+           HIJRI_TABLE_FIRST_YEAR, HIJRI_TABLE_LAST_YEAR);
+    return host_test_done("test_hijri");
+}
@@ -0,0 +1,204 @@
+/**
+ * @file test_neo7m_uart.c
+ * @brief NEO-7M async UART reception (src/gps_neo7m.c) on the UART emulator
+ *
+ * The emulated receiver (gnss_receiver.c) plays data/drive.nmea from a cold
+ * boot: gps_config.c finds it at 9600 baud, moves it to GPS_CONFIG_BAUD and
+ * trims its output. Then, at the new rate:
+ * - steady state: no byte lost between the line and the core, no checksum
+ *   errors, and the DMA ping-pong hands every buffer over only once released
+ * - a framing error mid-burst: RX_STOPPED, both buffers released, RX_DISABLED,
+ *   and the backend restarts reception; one sentence at most is lost
+ * - a buffer request answered too late: the full buffer disables RX and the
+ *   backend restarts it without losing a byte
+ * The last epoch of the log must be the published fix. Byte loss, wakeups
+ * (UART callbacks and parser work runs), line bytes/s and parse time are
+ * reported for the steady state.
+ *
+ * Built with GPS_UBX_MODE (test_neo7m_ubx) the receiver also has
+ * data/drive.ubx: configuration turns NAV-PVT on and every NMEA message off,
+ * and the NAV-PVT watchdog must not fall back to NMEA while frames arrive
+ * once a second.
+ */
+
+#include "host_test.h"
+#include "gnss_receiver.h"
+#include "uart_emul.h"
+#include "gps_neo7m.h"
+#include "gps_config.h"
+#include "time_of_day.h"
+
+#define LOG_NMEA        "data/drive.nmea"
+#ifdef GPS_UBX_MODE
+#define TEST_NAME       "test_neo7m_ubx"
+#define LOG_UBX         "data/drive.ubx"
+#define PROTOCOL        GPS_PROTOCOL_UBX
+#define MESSAGES(core)  ((core).ubx_frames)
+#else
+#define TEST_NAME       "test_neo7m_uart"
+#define LOG_UBX         NULL
+#define PROTOCOL        GPS_PROTOCOL_NMEA
+#define MESSAGES(core)  ((core).sentences)
+#endif
+#define CONFIG_S        10              ///< Allowed for detection and configuration
+#define STEADY_END_S    60
+#define ERROR_AT_US     (60 * 1000000LL + 20000)
+#define STARVE_AT_US    (70 * 1000000LL + 20000)
+
+// Globals of main.c read by prayerTime.c
+double Lng, Lat, D;
+
+// The display is not part of this test
+void ili9341_draw_string(uint16_t x, uint16_t y, const char *str, uint16_t color, uint16_t bg,
+                         uint8_t size)
+{
+}
+
+typedef struct {
+    uart_emul_stats_t uart;
+    gps_rx_stats_t core;
+    uint32_t work_runs;
+} sample_t;
+
+static uint32_t work_runs;
+
+static void run_until(int64_t until_us, sample_t *s)
+{
+    work_runs += host_run(until_us);
+    if (s) {
+        uart_emul_get_stats(&s->uart);
+        gps_get_rx_stats(&s->core);
+        s->work_runs = work_runs;
+    }
+}
+
+// Bytes off the line so far; uart.wire_bytes also counts the ones still in flight
+static uint32_t received(const sample_t *s)
+{
+    return s->uart.delivered + s->uart.lost;
+}
+
+static uint32_t lost(const sample_t *a, const sample_t *b)
+{
+    return b->uart.lost - a->uart.lost;
+}
+
+static uint32_t parse_errors(const sample_t *s)
+{
+    return s->core.checksum_errors + s->core.framing_errors;
+}
+
+static void report(const sample_t *a, const sample_t *b, double seconds)
+{
+    uint32_t wire = received(b) - received(a);
+    uint32_t core = b->core.bytes - a->core.bytes;
+    uint32_t callbacks = b->uart.callbacks - a->uart.callbacks;
+    uint32_t runs = b->work_runs - a->work_runs;
+    uint32_t messages = MESSAGES(b->core) - MESSAGES(a->core);
+
+    printf("steady state, %.0f s at %u baud: %u line bytes (%.0f bytes/s), %u lost\n",
+           seconds, uart_emul_baud(), wire, wire / seconds, wire - core);
+    printf("  wakeups: %u UART callbacks + %u work runs = %.1f/s (1 ms polling: 1000/s), "
+           "%u RX_RDY, %u buffers\n", callbacks, runs, (callbacks + runs) / seconds,
+           b->uart.rx_rdy - a->uart.rx_rdy, b->uart.buf_requests - a->uart.buf_requests);
+    printf("  parsing: %u messages, %u us (%.2f us/message); UART callbacks %.0f ns/byte\n",
+           messages, b->core.parse_us - a->core.parse_us,
+           (double)(b->core.parse_us - a->core.parse_us) / MAX(messages, 1U),
+           (double)(b->uart.callback_ns - a->uart.callback_ns) / MAX(core, 1U));
+}
+
+int main(void)
+{
+    sample_t boot, steady, before, after;
+    gnss_receiver_stats_t rcv;
+    struct gps_data gps;
+
+    int epochs = gnss_receiver_load(LOG_NMEA, LOG_UBX);
+    CHECK(epochs == 120, "%s: %d epochs", LOG_NMEA, epochs);
+    if (epochs <= 0) {
+        return host_test_done(TEST_NAME);
+    }
+
+    uart_emul_init();
+    gnss_receiver_start(9600, 0);
+    CHECK(gps_init() == 0, "gps_init() failed");
+
+    // Cold boot: autobaud, CFG-PRT, then the message set
+    run_until(CONFIG_S * 1000000LL, &boot);
+    gnss_receiver_get_stats(&rcv);
+    CHECK(gps_config_done(), "configuration not finished after %d s", CONFIG_S);
+    CHECK(gps_config_baud() == GPS_CONFIG_BAUD && uart_emul_baud() == GPS_CONFIG_BAUD,
+          "baud: config %u, UART %u", gps_config_baud(), uart_emul_baud());
+    CHECK(rcv.baud_changes == 1 && rcv.naks == 0, "%u CFG-PRT, %u NAKs", rcv.baud_changes, rcv.naks);
+#ifdef GPS_UBX_MODE
+    CHECK(rcv.gsv_rate == 0 && rcv.gll_rate == 0 && rcv.nav_pvt_rate == 1,
+          "message rates: GSV %u, GLL %u, NAV-PVT %u", rcv.gsv_rate, rcv.gll_rate, rcv.nav_pvt_rate);
+#else
+    CHECK(rcv.gsv_rate == 5 && rcv.gll_rate == 0 && rcv.nav_pvt_rate == 0,
+          "message rates: GSV %u, GLL %u, NAV-PVT %u", rcv.gsv_rate, rcv.gll_rate, rcv.nav_pvt_rate);
+#endif
+    CHECK(boot.core.protocol == PROTOCOL, "protocol %u", boot.core.protocol);
+    CHECK(boot.uart.rx_enables > 1, "reception never restarted while detecting");
+    printf("boot: configured in %d s, %u bytes garbled at the wrong baud rate, %u line errors, "
+           "%u RX restarts\n", CONFIG_S, boot.uart.garbled, boot.uart.line_errors,
+           boot.uart.rx_enables - 1);
+
+    // Steady state: nothing lost between the line and the core
+    run_until(STEADY_END_S * 1000000LL, &steady);
+    CHECK(lost(&boot, &steady) == 0, "%u bytes lost", lost(&boot, &steady));
+    CHECK(steady.core.bytes == steady.uart.delivered, "UART delivered %u bytes, core got %u",
+          steady.uart.delivered, steady.core.bytes);
+    CHECK(parse_errors(&steady) == parse_errors(&boot), "%u parse errors in steady state",
+          parse_errors(&steady) - parse_errors(&boot));
+    CHECK(steady.core.lines_dropped == boot.core.lines_dropped, "queue overflow");
+    CHECK(steady.uart.rx_enables == boot.uart.rx_enables, "reception restarted in steady state");
+    CHECK(steady.core.protocol == PROTOCOL, "protocol %u in steady state", steady.core.protocol);
+    report(&boot, &steady, STEADY_END_S - CONFIG_S);
+
+    // Framing error in the middle of a burst
+    run_until(ERROR_AT_US, &before);
+    CHECK(uart_emul_pending() > 0, "no burst on the line at the error");
+    uart_emul_inject_error(UART_ERROR_FRAMING);
+    run_until(ERROR_AT_US + 2000000, &after);
+    CHECK(after.core.rx_errors == before.core.rx_errors + 1, "RX_STOPPED not counted");
+    CHECK(after.uart.rx_disabled == before.uart.rx_disabled + 1 &&
+          after.uart.rx_enables == before.uart.rx_enables + 1, "no restart after the error");
+    CHECK(parse_errors(&after) - parse_errors(&before) <= 1, "%u sentences broken by one error",
+          parse_errors(&after) - parse_errors(&before));
+    CHECK(lost(&before, &after) == 1, "%u bytes lost, expected only the bad one",
+          lost(&before, &after));
+
+    // A buffer request answered too late
+    run_until(STARVE_AT_US, &before);
+    uart_emul_refuse_next_buffer();
+    run_until(STARVE_AT_US + 2000000, &after);
+    CHECK(after.uart.rx_disabled == before.uart.rx_disabled + 1 &&
+          after.uart.rx_enables == before.uart.rx_enables + 1, "no restart after a missing buffer");
+    CHECK(lost(&before, &after) == 0, "%u bytes lost across the restart", lost(&before, &after));
+    CHECK(parse_errors(&after) == parse_errors(&before), "sentence broken by the restart");
+
+    // To the end of the log: the last epoch is the published fix
+    run_until((epochs + 1) * 1000000LL, &after);
+    CHECK(after.uart.ownership_errors == 0, "%u buffers handed over while the driver held them",
+          after.uart.ownership_errors);
+    CHECK(after.uart.delivered == after.core.bytes, "UART delivered %u bytes, core got %u",
+          after.uart.delivered, after.core.bytes);
+    CHECK(after.core.protocol == PROTOCOL, "protocol %u at the end", after.core.protocol);
+
+    size_t len;
+    const char *last = gnss_receiver_nmea_epoch(epochs - 1, &len);
+    int hh, mm, ss, lat_deg, lon_deg;
+    double lat_min, lon_min;
+    CHECK(sscanf(last, "$GNRMC,%2d%2d%2d.00,A,%2d%lf,N,%3d%lf,E", &hh, &mm, &ss, &lat_deg, &lat_min,
+                 &lon_deg, &lon_min) == 7, "last epoch: %.40s", last);
+    gps_snapshot(&gps);
+    CHECK(gps.valid && gps.utc_sod == (hh * 60 + mm) * 60 + ss, "last fix at %d, expected %02d:%02d:%02d",
+          gps.utc_sod, hh, mm, ss);
+    CHECK(fabs(gps.latitude - (lat_deg + lat_min / 60)) < 1e-6 &&
+          fabs(gps.longitude - (lon_deg + lon_min / 60)) < 1e-6, "last fix %.7f %.7f",
+          gps.latitude, gps.longitude);
+    CHECK(gps.date_valid && gps.utc_year == 2025 && gps.utc_month == 1 && gps.utc_day == 1,
+          "date %d-%d-%d", gps.utc_year, gps.utc_month, gps.utc_day);
+
+    return host_test_done(TEST_NAME);
+}
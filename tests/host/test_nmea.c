@@ -0,0 +1,302 @@
+/**
+ * @file test_nmea.c
+ * @brief NMEA tokenizer (src/nmea.c): regression checks and throughput
+ *
+ * The checks cover checksum validation (mismatch, lowercase hex, bad digits),
+ * empty and missing fields as a receiver without a fix sends them, truncated,
+ * overlong and over-split sentences, sentences dropped for lack of a buffer,
+ * and nmea_feed_block() against nmea_feed(). Then a three-hour synthetic drive
+ * (LOG_3H, written by gen_gnss_log.py --epochs 10800) goes through both entry
+ * points: every line must come out as the same sentence, and a copy with one
+ * corrupted character per 100 sentences must count exactly those as checksum
+ * errors. The throughput in sentences/s is reported for both.
+ */
+
+#include "host_test.h"
+#include "nmea.h"
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef LOG_3H
+#define LOG_3H          "build/drive_3h.nmea"
+#endif
+#define DMA_BLOCK       64              ///< Block size of the NEO-7M async RX buffers
+#define CORRUPT_EVERY   100
+#define REPEATS         5
+
+static nmea_parser_t parser;
+static nmea_sentence_t sentence;
+
+// Frame a sentence body with its checksum (XORed with 'corrupt') and feed it
+static bool feed(const char *body, uint8_t corrupt)
+{
+    char text[160];
+    uint8_t checksum = 0;
+    bool complete = false;
+
+    for (const char *p = body; *p; p++) {
+        checksum ^= (uint8_t)*p;
+    }
+    snprintf(text, sizeof(text), "$%s*%02X\r\n", body, checksum ^ corrupt);
+    for (const char *p = text; *p; p++) {
+        complete |= nmea_feed(&parser, (uint8_t)*p);
+    }
+    return complete;
+}
+
+static void feed_text(const char *text)
+{
+    for (const char *p = text; *p; p++) {
+        nmea_feed(&parser, (uint8_t)*p);
+    }
+}
+
+static void check_checksum(void)
+{
+    nmea_parser_init(&parser, &sentence);
+
+    CHECK(!feed("GPGGA,1", 0x01) && parser.checksum_errors == 1 && parser.sentences == 0,
+          "checksum mismatch reported as a sentence");
+    feed_text("$GPGLL,4916.48,N,12311.12,W,225444,A*3c\r\n");
+    CHECK(parser.sentences == 1, "lowercase checksum digits rejected");
+    feed_text("$GPGLL,4916.48,N,12311.12,W,225444,A*3G\r\n");
+    CHECK(parser.sentences == 1 && parser.framing_errors == 1, "bad checksum digit accepted");
+    feed_text("$GPGLL,4916.45,N,12311.12,W,225444,A\r\n");
+    CHECK(parser.framing_errors == 2, "sentence without a checksum accepted");
+    CHECK(feed("GPGLL,4916.45,N,12311.12,W,225444,A", 0) && nmea_is(&sentence, "GLL"),
+          "no resync after the errors");
+}
+
+static void check_empty_fields(void)
+{
+    int32_t value;
+    int year, month, day;
+
+    nmea_parser_init(&parser, &sentence);
+
+    // RMC without a fix: time and date only
+    CHECK(feed("GNRMC,235959.123,V,,,,,,,311299,,,N", 0), "RMC without a fix rejected");
+    CHECK(sentence.field_count == 13, "%d fields, expected 13", sentence.field_count);
+    CHECK(nmea_char(&sentence, 2) == 'V' && nmea_char(&sentence, 3) == '\0', "status field");
+    CHECK(!nmea_coord(&sentence, 3, &value) && !nmea_coord(&sentence, 5, &value),
+          "empty coordinate parsed");
+    CHECK(!nmea_fixed(&sentence, 7, 3, &value) && !nmea_int(&sentence, 8, &value),
+          "empty speed or course parsed");
+    CHECK(nmea_time(&sentence, 1, &value) && value == 86399123, "time %d", value);
+    CHECK(nmea_date(&sentence, 9, &year, &month, &day) && year == 2099 && month == 12 && day == 31,
+          "date %d-%d-%d", year, month, day);
+    CHECK(!nmea_int(&sentence, 13, &value) && nmea_char(&sentence, 13) == '\0', "missing field parsed");
+
+    // GGA without a fix, trailing empty fields included
+    CHECK(feed("GNGGA,000001.00,,,,,0,00,99.99,,,,,,", 0), "GGA without a fix rejected");
+    CHECK(sentence.field_count == 15, "%d fields, expected 15", sentence.field_count);
+    CHECK(nmea_int(&sentence, 6, &value) && value == 0, "fix quality");
+    CHECK(nmea_fixed(&sentence, 8, 2, &value) && value == 9999, "HDOP %d", value);
+    CHECK(!nmea_fixed(&sentence, 9, 1, &value) && !nmea_fixed(&sentence, 14, 0, &value),
+          "empty altitude parsed");
+
+    // GSV satellite without SNR, then a GSA with empty slots
+    CHECK(feed("GPGSV,3,3,11,26,06,330,,29,03,178,,31,09,080,", 0), "GSV rejected");
+    CHECK(sentence.field_count == 16 && !nmea_int(&sentence, 15, &value) &&
+          nmea_int(&sentence, 14, &value) && value == 80, "GSV empty SNR");
+    CHECK(feed("GNGSA,A,1,,,,,,,,,,,,,99.99,99.99,99.99", 0) && sentence.field_count == 18 &&
+          !nmea_int(&sentence, 3, &value), "GSA empty slots");
+
+    // Signed fixed point and southern/western coordinates
+    CHECK(feed("GPGGA,000000,3352.1234567,S,15112.5,W,1,08,0.9,-12.34,M,,M,,", 0), "GGA rejected");
+    CHECK(nmea_coord(&sentence, 2, &value) && value == -(330000000 + (520000000 + 1234567 + 30) / 60),
+          "latitude %d", value);
+    CHECK(nmea_fixed(&sentence, 9, 2, &value) && value == -1234, "altitude %d", value);
+    CHECK(!nmea_fixed(&sentence, 11, 2, &value), "empty geoid separation parsed");
+}
+
+static void check_framing(void)
+{
+    char body[120];
+    bool complete;
+
+    nmea_parser_init(&parser, &sentence);
+
+    // Truncated by the next '$'
+    feed_text("$GPRMC,1234");
+    CHECK(feed("GPGSA,A,3,,,,,,,,,,,,,2.5,1.3,2.1", 0) && parser.framing_errors == 1,
+          "truncated sentence not counted");
+
+    // Longer than 82 characters, then more than NMEA_MAX_FIELDS fields
+    memset(body, 'A', 100);
+    body[100] = '\0';
+    CHECK(!feed(body, 0) && parser.framing_errors == 2, "overlong sentence accepted");
+    memset(body, ',', 40);
+    memcpy(body, "GPXXX", 5);
+    body[40] = '\0';
+    CHECK(!feed(body, 0) && parser.framing_errors == 3, "too many fields accepted");
+
+    // Control characters inside a sentence
+    feed_text("$GPGLL,49\x01" "16.45*00\r\n");
+    CHECK(parser.framing_errors == 4, "control character accepted");
+
+    // Block feed stops after a sentence, like the byte feed
+    const char *block = "junk$GPGLL,4916.45,N,12311.12,W,225444,A*31\r\n$GPVTG,1*xx";
+    size_t used = nmea_feed_block(&parser, (const uint8_t *)block, strlen(block), &complete);
+    CHECK(complete && nmea_is(&sentence, "GLL") && used == strlen(block) - strlen("\r\n$GPVTG,1*xx"),
+          "block feed consumed %zu bytes", used);
+
+    // No buffer: sentences are dropped, not parsed
+    nmea_parser_init(&parser, NULL);
+    CHECK(!feed("GPGLL", 0) && parser.dropped == 1 && parser.sentences == 0, "sentence not dropped");
+}
+
+static char *load(const char *path, size_t *len)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    *len = (size_t)ftell(f);
+    rewind(f);
+    char *data = malloc(*len + 1);
+    if (fread(data, 1, *len, f) != *len) {
+        free(data);
+        data = NULL;
+    }
+    fclose(f);
+    return data;
+}
+
+typedef struct {
+    uint32_t sentences;
+    uint32_t checksum_errors;
+    uint32_t framing_errors;
+    uint32_t hash;              ///< Of every sentence's text and field spans
+} log_result_t;
+
+static uint32_t hash_sentence(uint32_t hash, const nmea_sentence_t *s)
+{
+    // FNV-1a over the text and the spans
+    const uint8_t *p = (const uint8_t *)s->text;
+    for (int i = 0; i < s->length; i++) {
+        hash = (hash ^ p[i]) * 16777619U;
+    }
+    p = (const uint8_t *)s->field;
+    for (size_t i = 0; i < s->field_count * sizeof(s->field[0]); i++) {
+        hash = (hash ^ p[i]) * 16777619U;
+    }
+    return hash;
+}
+
+static log_result_t run_bytes(const char *log, size_t len, bool hash)
+{
+    log_result_t r = { .hash = 2166136261U };
+
+    nmea_parser_init(&parser, &sentence);
+    for (size_t i = 0; i < len; i++) {
+        if (nmea_feed(&parser, (uint8_t)log[i]) && hash) {
+            r.hash = hash_sentence(r.hash, &sentence);
+        }
+    }
+    r.sentences = parser.sentences;
+    r.checksum_errors = parser.checksum_errors;
+    r.framing_errors = parser.framing_errors;
+    return r;
+}
+
+static log_result_t run_blocks(const char *log, size_t len, bool hash)
+{
+    log_result_t r = { .hash = 2166136261U };
+
+    nmea_parser_init(&parser, &sentence);
+    for (size_t i = 0; i < len; i += DMA_BLOCK) {
+        const uint8_t *data = (const uint8_t *)&log[i];
+        size_t n = (len - i < DMA_BLOCK) ? len - i : DMA_BLOCK;
+
+        while (n > 0) {
+            bool complete;
+            size_t used = nmea_feed_block(&parser, data, n, &complete);
+            if (complete && hash) {
+                r.hash = hash_sentence(r.hash, &sentence);
+            }
+            data += used;
+            n -= used;
+        }
+    }
+    r.sentences = parser.sentences;
+    r.checksum_errors = parser.checksum_errors;
+    r.framing_errors = parser.framing_errors;
+    return r;
+}
+
+// Best of REPEATS, in sentences per second
+static double throughput(log_result_t (*run)(const char *, size_t, bool), const char *log, size_t len)
+{
+    int64_t best = INT64_MAX;
+    log_result_t r = { 0 };
+
+    for (int i = 0; i < REPEATS; i++) {
+        int64_t start = host_now_ns();
+        r = run(log, len, false);
+        int64_t elapsed = host_now_ns() - start;
+        best = (elapsed < best) ? elapsed : best;
+    }
+    return r.sentences * 1e9 / best;
+}
+
+static void check_log(void)
+{
+    size_t len;
+    char *log = load(LOG_3H, &len);
+
+    CHECK(log, "%s missing (make -C tests/host generates it)", LOG_3H);
+    if (!log) {
+        return;
+    }
+
+    uint32_t lines = 0;
+    for (size_t i = 0; i < len; i++) {
+        lines += (log[i] == '\n');
+    }
+
+    log_result_t bytes = run_bytes(log, len, true);
+    log_result_t blocks = run_blocks(log, len, true);
+    CHECK(bytes.sentences == lines && bytes.checksum_errors == 0 && bytes.framing_errors == 0,
+          "byte feed: %u of %u sentences, %u checksum errors, %u framing errors",
+          bytes.sentences, lines, bytes.checksum_errors, bytes.framing_errors);
+    CHECK(memcmp(&blocks, &bytes, sizeof(bytes)) == 0,
+          "block feed: %u sentences, %u checksum errors, differs from the byte feed", blocks.sentences,
+          blocks.checksum_errors);
+
+    // One flipped character in every CORRUPT_EVERY-th sentence
+    char *bad = malloc(len);
+    uint32_t corrupted = 0, line = 0;
+    memcpy(bad, log, len);
+    for (size_t i = 0; i < len; i++) {
+        if (log[i] == '$' && line++ % CORRUPT_EVERY == 0) {
+            bad[i + 8] ^= 0x01;
+            corrupted++;
+        }
+    }
+    bytes = run_bytes(bad, len, false);
+    blocks = run_blocks(bad, len, false);
+    CHECK(bytes.checksum_errors == corrupted && bytes.sentences == lines - corrupted,
+          "byte feed: %u checksum errors, expected %u", bytes.checksum_errors, corrupted);
+    CHECK(blocks.checksum_errors == corrupted && blocks.sentences == lines - corrupted,
+          "block feed: %u checksum errors, expected %u", blocks.checksum_errors, corrupted);
+    free(bad);
+
+    double byte_rate = throughput(run_bytes, log, len);
+    double block_rate = throughput(run_blocks, log, len);
+    printf("NMEA tokenizer, %s: %u sentences, %.1f MB\n", LOG_3H, lines, len / 1e6);
+    printf("  nmea_feed():       %6.2fM sentences/s\n", byte_rate / 1e6);
+    printf("  nmea_feed_block(): %6.2fM sentences/s (%d-byte blocks, %.1fx)\n", block_rate / 1e6,
+           DMA_BLOCK, block_rate / byte_rate);
+    free(log);
+}
+
+int main(void)
+{
+    check_checksum();
+    check_empty_fields();
+    check_framing();
+    check_log();
+    return host_test_done("test_nmea");
+}
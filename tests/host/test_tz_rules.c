@@ -0,0 +1,184 @@
+/**
+ * @file test_tz_rules.c
+ * @brief Timezone rules (src/tz_rules.c) against zoneinfo, every zone 2000-2067
+ *
+ * data/tz_transitions.txt (gen_tz_fixture.py) holds every offset change of
+ * each zone's POSIX TZ string as Python's zoneinfo expands it. For every zone
+ * and year, tz_year_expand() must give exactly the fixture's transitions, and
+ * one tz_year_t walked forward through the whole range (re-expanding at each
+ * year change) must give the offset before and after every transition and
+ * between them. Then the rules the review of the tables singled out, against
+ * the published dates: Chile's Saturday 24:00, Israel's Friday before the
+ * last Sunday (M3.4.4/26), Egypt's last Thursday 24:00 and the EU changes at
+ * 01:00 UTC (utc flag) next to Moldova's local-time ones.
+ */
+
+#include "host_test.h"
+#include "tz_rules.h"
+#include "time_of_day.h"
+#include <zephyr/sys/util.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define FIXTURE         "data/tz_transitions.txt"
+#define FIRST_YEAR      2000
+#define LAST_YEAR       2067            ///< int32 UTC seconds since 2000 end in 2068
+#define MAX_CHANGES     256             ///< Per zone: two a year
+
+typedef struct {
+    int32_t utc_s;
+    int offset_min;
+} change_t;
+
+static struct {
+    char rule[64];
+    int count;
+    change_t change[MAX_CHANGES];
+} zones[TZ_ZONE_COUNT];
+
+static int load_fixture(void)
+{
+    char line[128];
+    int zone = -1, zone_count = 0;
+    FILE *f = fopen(FIXTURE, "r");
+
+    if (!f) {
+        return -1;
+    }
+    while (fgets(line, sizeof(line), f)) {
+        long utc_s;
+        int offset;
+
+        line[strcspn(line, "\n")] = '\0';
+        if (line[0] == '#') {
+            continue;
+        }
+        if (sscanf(line, "zone %d", &zone) == 1) {
+            if (zone < 0 || zone >= TZ_ZONE_COUNT) {
+                break;
+            }
+            snprintf(zones[zone].rule, sizeof(zones[zone].rule), "%s", strchr(line + 5, ' ') + 1);
+            zone_count++;
+        } else if (zone >= 0 && sscanf(line, "%ld %d", &utc_s, &offset) == 2 &&
+                   zones[zone].count < MAX_CHANGES) {
+            zones[zone].change[zones[zone].count++] = (change_t){ (int32_t)utc_s, offset };
+        }
+    }
+    fclose(f);
+    return zone_count;
+}
+
+static int32_t utc_s(int year, int month, int day, int hour, int minute)
+{
+    return tod_days_from_civil(year, month, day) * 86400 + (hour * 60 + minute) * 60;
+}
+
+// Each year expanded on its own: its two instants are the fixture's changes in that year
+static void check_years(uint8_t zone)
+{
+    const change_t *c = zones[zone].change;
+    int n = zones[zone].count;
+
+    for (int year = FIRST_YEAR; year <= LAST_YEAR; year++) {
+        tz_year_t t;
+        int32_t expected[2];
+        int found = 0;
+
+        tz_year_expand(&t, zone, year);
+        for (int i = 1; i < n; i++) {
+            if (c[i].utc_s >= t.year_start && c[i].utc_s < t.year_end && found < 2) {
+                expected[found++] = c[i].utc_s;
+            }
+        }
+
+        if (t.dst_start == t.dst_end) {
+            CHECK(found == 0 && t.std_min == c[0].offset_min, "%s %d: %d changes, offset %d, expected %d",
+                  zones[zone].rule, year, found, t.std_min, c[0].offset_min);
+            continue;
+        }
+        bool southern = t.dst_end < t.dst_start;
+        int32_t first = southern ? t.dst_end : t.dst_start;
+        int32_t second = southern ? t.dst_start : t.dst_end;
+        CHECK(found == 2 && first == expected[0] && second == expected[1],
+              "%s %d: DST %d..%d, expected %s%d..%d", zones[zone].rule, year, t.dst_start, t.dst_end,
+              found == 2 ? "" : "(missing) ", expected[southern ? 1 : 0], expected[southern ? 0 : 1]);
+    }
+}
+
+// One table walked through the range: offsets around and between the changes
+static void check_walk(uint8_t zone)
+{
+    const change_t *c = zones[zone].change;
+    int n = zones[zone].count;
+    tz_year_t t;
+
+    tz_year_expand(&t, zone, FIRST_YEAR);
+    for (int i = 0; i < n; i++) {
+        int32_t end = (i + 1 < n) ? c[i + 1].utc_s : utc_s(LAST_YEAR + 1, 1, 1, 0, 0);
+        int32_t probes[] = { c[i].utc_s, c[i].utc_s + (end - c[i].utc_s) / 2, end - 1 };
+
+        for (size_t p = 0; p < ARRAY_SIZE(probes); p++) {
+            int offset = tz_offset_min(&t, probes[p]);
+            CHECK(offset == c[i].offset_min, "%s at %d: offset %d, expected %d", zones[zone].rule,
+                  probes[p], offset, c[i].offset_min);
+            bool dst = t.dst_min != t.std_min && offset == t.dst_min;
+            CHECK(tz_is_dst(&t, probes[p]) == dst, "%s at %d: DST flag", zones[zone].rule, probes[p]);
+        }
+    }
+}
+
+static void check_offset(uint8_t zone, int32_t at, int expected, const char *what)
+{
+    tz_year_t t;
+
+    tz_year_expand(&t, zone, 2025);
+    int offset = tz_offset_min(&t, at);
+    CHECK(offset == expected, "%s: offset %d, expected %d", what, offset, expected);
+}
+
+// A change at 'at' from 'before' to 'after'
+static void check_change(uint8_t zone, int32_t at, int before, int after, const char *what)
+{
+    check_offset(zone, at - 1, before, what);
+    check_offset(zone, at, after, what);
+}
+
+int main(void)
+{
+    int count = load_fixture();
+    CHECK(count == TZ_ZONE_COUNT, "%s: %d zones, expected %d", FIXTURE, count, TZ_ZONE_COUNT);
+    if (count != TZ_ZONE_COUNT) {
+        return host_test_done("test_tz_rules");
+    }
+
+    int changes = 0;
+    for (uint8_t zone = 0; zone < TZ_ZONE_COUNT; zone++) {
+        CHECK(strcmp(zones[zone].rule, tz_zone_name(zone)) == 0, "zone %d: fixture %s, table %s",
+              zone, zones[zone].rule, tz_zone_name(zone));
+        check_years(zone);
+        check_walk(zone);
+        changes += zones[zone].count - 1;
+    }
+    printf("tz_rules: %d zones, %d-%d, %d transitions checked\n", TZ_ZONE_COUNT, FIRST_YEAR, LAST_YEAR,
+           changes);
+
+    // Chile: first Saturday of September 24:00 (Sun 2025-09-07 00:00 -04), first Saturday
+    // of April 24:00 (Sun 2025-04-06 00:00 -03)
+    check_change(TZ_CHILE, utc_s(2025, 9, 7, 4, 0), -240, -180, "Chile DST start 2025");
+    check_change(TZ_CHILE, utc_s(2025, 4, 6, 3, 0), -180, -240, "Chile DST end 2025");
+    // Israel: Friday 2025-03-28 02:00 IST, Sunday 2025-10-26 02:00 IDT
+    check_change(TZ_ISRAEL, utc_s(2025, 3, 28, 0, 0), 120, 180, "Israel DST start 2025");
+    check_change(TZ_ISRAEL, utc_s(2025, 10, 25, 23, 0), 180, 120, "Israel DST end 2025");
+    // Egypt: last Friday of April 00:00 (2025-04-25), last Thursday of October 24:00 (2025-10-30)
+    check_change(TZ_EGYPT, utc_s(2025, 4, 24, 22, 0), 120, 180, "Egypt DST start 2025");
+    check_change(TZ_EGYPT, utc_s(2025, 10, 30, 21, 0), 180, 120, "Egypt DST end 2025");
+    // EU: 01:00 UTC in every zone; Moldova changes at 02:00/03:00 local, an hour earlier
+    check_change(TZ_EU_WESTERN, utc_s(2025, 3, 30, 1, 0), 0, 60, "EU western DST start 2025");
+    check_change(TZ_EU_CENTRAL, utc_s(2025, 3, 30, 1, 0), 60, 120, "EU central DST start 2025");
+    check_change(TZ_EU_EASTERN, utc_s(2025, 3, 30, 1, 0), 120, 180, "EU eastern DST start 2025");
+    check_change(TZ_EU_EASTERN, utc_s(2025, 10, 26, 1, 0), 180, 120, "EU eastern DST end 2025");
+    check_change(TZ_MOLDOVA, utc_s(2025, 3, 30, 0, 0), 120, 180, "Moldova DST start 2025");
+    check_change(TZ_MOLDOVA, utc_s(2025, 10, 26, 0, 0), 180, 120, "Moldova DST end 2025");
+
+    return host_test_done("test_tz_rules");
+}
@@ -0,0 +1,150 @@
+/**
+ * @file test_ubx.c
+ * @brief UBX frame parser (src/ubx.c) and the core's NMEA/UBX demultiplexer
+ *
+ * The parser must decode a NAV-PVT frame it built itself, count checksum
+ * errors, accept payloads up to UBX_MAX_PAYLOAD and give up on a header
+ * announcing more right after its length bytes: a corrupted length (or line
+ * noise at the wrong baud rate while autobauding) must not make it take the
+ * following 64 KB as payload. Through gnss_core_rx_bytes() the NMEA sentence
+ * after such a header must still be parsed, and so must one following
+ * gnss_core_rx_reset() in the middle of a frame with a plausible length (what
+ * a baud change or a line error leaves behind).
+ */
+
+#include "host_test.h"
+#include "ubx.h"
+#include "gnss_core.h"
+#include <string.h>
+
+// Globals of main.c read by prayerTime.c
+double Lng, Lat, D;
+
+// The display is not part of this test
+void ili9341_draw_string(uint16_t x, uint16_t y, const char *str, uint16_t color, uint16_t bg,
+                         uint8_t size)
+{
+}
+
+static ubx_parser_t parser;
+static ubx_frame_t frame;
+
+// Bogus header: NAV-PVT with a length of 65535
+static const uint8_t bad_header[] = { UBX_SYNC1, UBX_SYNC2, UBX_CLASS_NAV, UBX_ID_NAV_PVT, 0xFF, 0xFF };
+
+static int feed(const uint8_t *data, size_t len)
+{
+    int complete = 0;
+
+    for (size_t i = 0; i < len; i++) {
+        complete += ubx_feed(&parser, data[i]);
+    }
+    return complete;
+}
+
+static void check_nav_pvt(void)
+{
+    uint8_t out[UBX_MAX_PAYLOAD + UBX_FRAME_OVERHEAD];
+    ubx_nav_pvt_t pvt = {
+        .year = 2025, .month = 3, .day = 30, .hour = 1, .minute = 2, .second = 3,
+        .date_valid = true, .time_valid = true, .fix_type = 3, .fix_ok = true, .num_sv = 9,
+        .lat_e7 = -338688000, .lon_e7 = 1512093000, .hmsl_mm = 58000, .pdop = 135,
+    };
+    ubx_nav_pvt_t decoded;
+
+    ubx_parser_init(&parser, &frame);
+    size_t len = ubx_build_nav_pvt(out, &pvt);
+    CHECK(feed(out, len) == 1 && parser.frames == 1 && ubx_parser_idle(&parser), "NAV-PVT not received");
+    CHECK(ubx_decode_nav_pvt(&frame, &decoded), "NAV-PVT not decoded");
+    CHECK(decoded.year == 2025 && decoded.month == 3 && decoded.day == 30 && decoded.second == 3 &&
+          decoded.lat_e7 == pvt.lat_e7 && decoded.lon_e7 == pvt.lon_e7 && decoded.num_sv == 9,
+          "NAV-PVT fields: %d-%d-%d %d %d", decoded.year, decoded.month, decoded.day, decoded.lat_e7,
+          decoded.lon_e7);
+
+    out[len - 1] ^= 0x01;
+    CHECK(feed(out, len) == 0 && parser.checksum_errors == 1, "checksum error not counted");
+}
+
+static void check_length(void)
+{
+    uint8_t payload[UBX_MAX_PAYLOAD + 1] = { 0 };
+    uint8_t out[sizeof(payload) + UBX_FRAME_OVERHEAD];
+
+    ubx_parser_init(&parser, &frame);
+    size_t len = ubx_build(out, UBX_CLASS_NAV, 0x35, payload, UBX_MAX_PAYLOAD);
+    CHECK(feed(out, len) == 1 && frame.length == UBX_MAX_PAYLOAD, "%d-byte payload rejected",
+          UBX_MAX_PAYLOAD);
+
+    // One byte more: abandoned at the length, the payload is searched for sync bytes
+    len = ubx_build(out, UBX_CLASS_NAV, 0x35, payload, sizeof(payload));
+    CHECK(feed(out, 6) == 0 && ubx_parser_idle(&parser) && parser.oversize == 1,
+          "oversized frame not abandoned at its length");
+    feed(&out[6], len - 6);
+    CHECK(parser.frames == 1 && parser.checksum_errors == 0, "%u frames, %u checksum errors",
+          parser.frames, parser.checksum_errors);
+
+    // A 64 KB length, then a frame: the frame is received
+    len = ubx_build(out, UBX_CLASS_NAV, 0x35, payload, 4);
+    feed(bad_header, sizeof(bad_header));
+    CHECK(ubx_parser_idle(&parser) && parser.oversize == 2, "65535-byte length accepted");
+    CHECK(feed(out, len) == 1 && parser.frames == 2, "frame after a bogus length lost");
+}
+
+// An RMC sentence at the given UTC hour
+static void feed_rmc(int hour)
+{
+    char text[96];
+    uint8_t checksum = 0;
+    int len = snprintf(text, sizeof(text), "$GPRMC,%02d0000.00,A,2126.00,N,03949.00,E,0.0,0.0,300325,,,A*",
+                       hour);
+
+    for (int i = 1; i < len - 1; i++) {
+        checksum ^= (uint8_t)text[i];
+    }
+    snprintf(&text[len], sizeof(text) - len, "%02X\r\n", checksum);
+    gnss_core_rx_bytes((const uint8_t *)text, strlen(text));
+}
+
+// Core: the sentence right after a bogus UBX header is parsed
+static void check_demux(void)
+{
+    gps_rx_stats_t stats;
+    struct gps_data gps;
+
+    gnss_core_rx_bytes(bad_header, sizeof(bad_header));
+    feed_rmc(12);
+    host_run(1000000);
+
+    gnss_core_get_rx_stats(&stats);
+    gps_snapshot(&gps);
+    CHECK(gnss_core_traffic() == 1 && stats.sentences == 1 && stats.framing_errors == 1,
+          "%u messages, %u sentences, %u framing errors", gnss_core_traffic(), stats.sentences,
+          stats.framing_errors);
+    CHECK(gps.valid && gps.utc_sod == 12 * 3600, "fix after the bogus header: valid %d, time %d",
+          gps.valid, gps.utc_sod);
+}
+
+// Core: a frame cut off by gnss_core_rx_reset() does not swallow the next sentence
+static void check_reset(void)
+{
+    const uint8_t partial[] = { UBX_SYNC1, UBX_SYNC2, UBX_CLASS_NAV, UBX_ID_NAV_PVT, 92, 0, 1, 2, 3 };
+    struct gps_data gps;
+
+    gnss_core_rx_bytes(partial, sizeof(partial));
+    gnss_core_rx_reset();
+    feed_rmc(13);
+    host_run(2000000);
+
+    gps_snapshot(&gps);
+    CHECK(gnss_core_traffic() == 2 && gps.utc_sod == 13 * 3600, "%u messages, time %d after a reset",
+          gnss_core_traffic(), gps.utc_sod);
+}
+
+int main(void)
+{
+    check_nav_pvt();
+    check_length();
+    check_demux();
+    check_reset();
+    return host_test_done("test_ubx");
+}
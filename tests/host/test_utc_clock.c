@@ -0,0 +1,129 @@
+/**
+ * @file test_utc_clock.c
+ * @brief Disciplined UTC clock (src/utc_clock.c) on synthetic GPS seconds
+ *
+ * The local clock (host_clock_us) runs DRIFT_PPB fast, and every GPS second
+ * arrives late by a one-sided delay of up to MAX_DELAY_US, as the parse
+ * delay does on the target. Checked:
+ * - the drift estimate after an hour, with the right sign (+ = local fast)
+ * - the clock follows the earliest samples, not the average delay
+ * - a one-hour gap: holdover_s, and holdover_error_us measured with an
+ *   undelayed sample, against the uncorrected drift over the hour
+ * - a sample 400 ms late is not a step, GPS time moving by 2 s is: the
+ *   clock follows it and keeps the drift
+ */
+
+#include "host_test.h"
+#include "utc_clock.h"
+#include "gps_events.h"
+#include "time_of_day.h"
+#include <stdlib.h>
+
+#define DRIFT_PPB       25000           ///< Local clock rate error: 25 ppm fast
+#define MAX_DELAY_US    30000           ///< Receiver and parse delay, one-sided
+#define START_UTC_S     (9000LL * 86400 + 12 * 3600)
+#define LOCAL_START_US  5000000LL       ///< Uptime at the first sample
+#define DRIFT_TOL_PPB   1000            ///< 3.6 ms an hour; uncorrected the hour is 90 ms
+#define PHASE_TOL_US    3000
+
+// gps_events.c is not linked: the clock only listens to the time channel
+ZBUS_CHAN_DEFINE(gps_time_chan, gps_time_msg_t, NULL, NULL, ZBUS_OBSERVERS_EMPTY,
+                 ZBUS_MSG_INIT(.utc_sod = -1, .date_ordinal = -1));
+
+static int64_t gps_error_us;            ///< GPS time minus true time (a step moves it)
+static uint32_t rng = 12345;
+
+static uint32_t next_random(void)
+{
+    rng = rng * 1664525U + 1013904223U;
+    return rng >> 8;
+}
+
+// Local time at true UTC utc_us
+static int64_t local_at(int64_t utc_us)
+{
+    int64_t elapsed = utc_us - START_UTC_S * 1000000;
+    return LOCAL_START_US + elapsed + elapsed / 1000 * DRIFT_PPB / 1000000;
+}
+
+// GPS second utc_s (true time), received delay_us late
+static void sample(int64_t utc_s, int64_t delay_us)
+{
+    int64_t gps_s = utc_s + gps_error_us / 1000000;
+    gps_time_msg_t msg = {
+        .utc_sod = (int32_t)(gps_s % 86400),
+        .date_ordinal = (int32_t)(gps_s / 86400),
+    };
+
+    host_clock_us = local_at(utc_s * 1000000 + delay_us);
+    zbus_chan_pub(&gps_time_chan, &msg, K_NO_WAIT);
+}
+
+static void run(int64_t *utc_s, int seconds)
+{
+    for (int i = 0; i < seconds; i++, (*utc_s)++) {
+        sample(*utc_s, next_random() % MAX_DELAY_US);
+    }
+}
+
+// Clock minus GPS time, in us, half a second after utc_s
+static int64_t clock_error_us(int64_t utc_s)
+{
+    int64_t utc_us = utc_s * 1000000 + 500000;
+
+    host_clock_us = local_at(utc_us);
+    return (utc_clock_now_ms() - (utc_us + gps_error_us) / 1000) * 1000;
+}
+
+int main(void)
+{
+    utc_clock_stats_t stats;
+    int64_t utc_s = START_UTC_S;
+
+    CHECK(utc_clock_now_ms() < 0, "clock valid before the first GPS time");
+
+    // One hour of delayed seconds
+    run(&utc_s, 3600);
+    utc_clock_get_stats(&stats);
+    int64_t phase = clock_error_us(utc_s - 1);
+    printf("after 1 h: drift %d ppb (actual %d), clock error %lld us (delays 0-%d us)\n",
+           stats.drift_ppb, DRIFT_PPB, (long long)phase, MAX_DELAY_US);
+    CHECK(stats.valid && stats.drift_valid && stats.samples == 3600, "valid %d, drift valid %d, %u samples",
+          stats.valid, stats.drift_valid, stats.samples);
+    CHECK(abs(stats.drift_ppb - DRIFT_PPB) < DRIFT_TOL_PPB, "drift %d ppb, expected %d", stats.drift_ppb,
+          DRIFT_PPB);
+    CHECK(phase > -PHASE_TOL_US && phase < PHASE_TOL_US, "clock %lld us off: not on the earliest samples",
+          (long long)phase);
+    CHECK(stats.steps == 0, "%u steps", stats.steps);
+
+    // One hour without GPS, then an undelayed second
+    utc_s += 3600;
+    sample(utc_s++, 0);
+    utc_clock_get_stats(&stats);
+    printf("1 h holdover: %d us off (uncorrected drift: %d us)\n", stats.holdover_error_us,
+           DRIFT_PPB * 36 / 10);
+    CHECK(stats.holdover_s == 3601, "holdover %u s", stats.holdover_s);
+    CHECK(abs(stats.holdover_error_us) < PHASE_TOL_US, "holdover error %d us", stats.holdover_error_us);
+    CHECK(stats.steps == 0, "%u steps after the gap", stats.steps);
+
+    // A very late sample moves nothing
+    run(&utc_s, 300);
+    phase = clock_error_us(utc_s - 1);
+    sample(utc_s++, 400000);
+    CHECK(llabs(clock_error_us(utc_s - 1) - phase) < PHASE_TOL_US, "clock moved by a late sample");
+    utc_clock_get_stats(&stats);
+    CHECK(stats.steps == 0, "a 400 ms late sample counted as a step");
+
+    // GPS time moves by 2 s: one step, the clock follows, the drift stays
+    gps_error_us = 2000000;
+    run(&utc_s, 300);
+    utc_clock_get_stats(&stats);
+    phase = clock_error_us(utc_s - 1);
+    CHECK(stats.steps == 1, "%u steps for a 2 s jump", stats.steps);
+    CHECK(phase > -PHASE_TOL_US && phase < MAX_DELAY_US, "clock %lld us off after the step",
+          (long long)phase);
+    CHECK(abs(stats.drift_ppb - DRIFT_PPB) < DRIFT_TOL_PPB, "drift %d ppb after the step",
+          stats.drift_ppb);
+
+    return host_test_done("test_utc_clock");
+}
@@ -0,0 +1,61 @@
+# Flash footprint of the city table in the linked image.
+#
+# Lists the size of each part of the packed table (world_cities_data.c,
+# generated by tools/gen_city_table.py) and fails when a part is in the image
+# more than once (a definition in a header would give each translation unit
+# including it its own copy). Run after each link by the city_footprint target
+# in CMakeLists.txt, or by hand:
+#
+#   cmake -DNM=arm-zephyr-eabi-nm -DELF=build/zephyr/zephyr.elf -P tools/city_footprint.cmake
+
+cmake_minimum_required(VERSION 3.20.0)
+
+if(NOT NM OR NOT ELF)
+    message(FATAL_ERROR "usage: cmake -DNM=<nm> -DELF=<image.elf> -P city_footprint.cmake")
+endif()
+
+execute_process(COMMAND ${NM} --print-size --radix=d ${ELF}
+    OUTPUT_VARIABLE symbols
+    RESULT_VARIABLE result)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "City footprint: cannot read the symbols of ${ELF}")
+endif()
+
+set(parts world_city_positions world_city_records world_city_names world_cities_count)
+foreach(part IN LISTS parts)
+    set(${part}_copies 0)
+    set(${part}_bytes 0)
+endforeach()
+
+string(REPLACE "\n" ";" symbols "${symbols}")
+foreach(line IN LISTS symbols)
+    # <address> <size> <type> <name>; lower-case types are file-local (static) copies
+    if(line MATCHES "^[0-9]+ ([0-9]+) [a-zA-Z] ([a-z_]+)$" AND CMAKE_MATCH_2 IN_LIST parts)
+        set(part ${CMAKE_MATCH_2})
+        math(EXPR ${part}_copies "${${part}_copies} + 1")
+        math(EXPR ${part}_bytes "${${part}_bytes} + ${CMAKE_MATCH_1}")
+    endif()
+endforeach()
+
+set(total 0)
+set(report "")
+set(duplicated "")
+foreach(part IN LISTS parts)
+    math(EXPR total "${total} + ${${part}_bytes}")
+    string(APPEND report " ${part} ${${part}_bytes}")
+    if(${part}_copies GREATER 1)
+        list(APPEND duplicated "${part} x${${part}_copies}")
+    endif()
+endforeach()
+
+if(total EQUAL 0)
+    message(STATUS "City footprint: no city table in ${ELF}")
+    return()
+endif()
+
+math(EXPR total_kb "(${total} + 512) / 1024")
+message(STATUS "City footprint: ${total} bytes (${total_kb} KB):${report}")
+if(duplicated)
+    message(FATAL_ERROR "City footprint: the city table is in the image more than once (${duplicated}) - "
+                        "keep its definitions in world_cities_data.c only")
+endif()
@@ -0,0 +1,178 @@
+#!/usr/bin/env python3
+"""Generate src/world_cities_data.c, the packed city table used by src/world_cities.c.
+
+Each city becomes an 8-byte position (latitude and longitude as int32 in 1e-5
+degrees, in one dense array for the nearest-city scan) and a 6-byte record: a
+16-bit offset of its name in a NUL-separated name pool, its tz_zone_id_t (UTC
+offset and DST rules, src/tz_rules.h) and a 2-character country code. The pool
+stores equal names once, and a name that ends another one (e.g. "York" in
+"New York") points into it.
+
+The input is a CSV with a "name,latitude,longitude,zone,country" header; zone is
+a tz_zone_id_t without its TZ_ prefix. Lines starting with # are comments and
+are copied into the table as group headings.
+
+Usage: tools/gen_city_table.py [-i tools/world_cities.csv] [-o src/world_cities_data.c]
+"""
+
+import argparse
+import csv
+import os
+import re
+import sys
+
+COORD_SCALE = 100000        # CITY_COORD_SCALE in src/world_cities.h
+POSITION_BYTES = 8          # sizeof(city_position_t)
+RECORD_BYTES = 6            # sizeof(city_record_t)
+NAME_POOL_MAX = 65536       # city_record_t.name is 16-bit
+TZ_RULES_H = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src", "tz_rules.h")
+
+
+def load_zones(path):
+    """Zone names of tz_zone_id_t, without the TZ_ prefix."""
+    with open(path) as fh:
+        text = fh.read()
+    body = text[text.index("typedef enum {"):text.index("TZ_ZONE_COUNT")]
+    return set(re.findall(r"\bTZ_(\w+),", body))
+
+
+def parse_coord(text, limit, line):
+    value = round(float(text) * COORD_SCALE)
+    if abs(value) > limit * COORD_SCALE:
+        sys.exit(f"line {line}: coordinate {text} out of range")
+    if abs(float(text) * COORD_SCALE - value) > 1e-6:
+        sys.exit(f"line {line}: {text} has more than 5 decimals")
+    return value
+
+
+def load_cities(path, zones):
+    """List of cities and group headings, in file order."""
+    rows = []
+    with open(path, newline="", encoding="utf-8") as fh:
+        lines = [(n, l) for n, l in enumerate(fh, 1) if l.strip()]
+    data = [(n, l) for n, l in lines if not l.startswith("#")]
+    if not data or data[0][1].strip() != "name,latitude,longitude,zone,country":
+        sys.exit(f"{path}: expected a name,latitude,longitude,zone,country header")
+    header_line = data[0][0]
+
+    for n, line in lines:
+        if n <= header_line:
+            continue
+        if line.startswith("#"):
+            rows.append(("heading", line[1:].strip()))
+            continue
+        fields = next(csv.reader([line]))
+        if len(fields) != 5:
+            sys.exit(f"line {n}: expected 5 fields, got {len(fields)}")
+        name, lat, lon, zone, country = (f.strip() for f in fields)
+        if not name or "\0" in name or len(name.encode("utf-8")) > 255:
+            sys.exit(f"line {n}: bad name {name!r}")
+        if zone not in zones:
+            sys.exit(f"line {n}: unknown zone {zone}")
+        if not re.fullmatch(r"[A-Z]{2}", country):
+            sys.exit(f"line {n}: country {country!r} is not a 2-letter code")
+        rows.append(("city", {
+            "name": name,
+            "lat": parse_coord(lat, 90, n),
+            "lon": parse_coord(lon, 180, n),
+            "zone": zone,
+            "country": country,
+        }))
+    return rows
+
+
+def build_pool(names):
+    """NUL-separated pool in file order and the offset of each name; suffixes share storage."""
+    unique = list(dict.fromkeys(names))
+    suffixes = {name[i:] for name in unique for i in range(1, len(name))}
+    stored = [name for name in unique if name not in suffixes]
+
+    offsets = {}
+    pool_len = 0
+    for name in stored:
+        # Every suffix of a stored name can point into it
+        for i in range(len(name)):
+            offsets.setdefault(name[i:], pool_len + len(name[:i].encode("utf-8")))
+        pool_len += len(name.encode("utf-8")) + 1
+    if pool_len > NAME_POOL_MAX:
+        sys.exit(f"name pool of {pool_len} bytes does not fit 16-bit offsets")
+    return stored, offsets, pool_len
+
+
+def c_string(text):
+    out = ""
+    for ch in text:
+        if ch in '"\\':
+            out += "\\" + ch
+        elif 0x20 <= ord(ch) < 0x7f:
+            out += ch
+        else:
+            out += "".join(f"\\{b:03o}" for b in ch.encode("utf-8"))
+    return out
+
+
+def emit(rows, out):
+    cities = [c for kind, c in rows if kind == "city"]
+    stored, offsets, pool_len = build_pool([c["name"] for c in cities])
+    plain = sum(len(c["name"].encode("utf-8")) + 1 for c in cities)
+    total = len(cities) * (POSITION_BYTES + RECORD_BYTES) + pool_len
+
+    r = []
+    r.append("/**")
+    r.append(" * @file world_cities_data.c")
+    r.append(" * @brief City table (generated by tools/gen_city_table.py from tools/world_cities.csv)")
+    r.append(" *")
+    r.append(f" * {len(cities)} cities: {POSITION_BYTES}-byte positions, {RECORD_BYTES}-byte records and a "
+             f"{pool_len}-byte name pool")
+    r.append(f" * ({plain} bytes before sharing), {total} bytes in all.")
+    r.append(" * Do not edit by hand, edit the CSV and regenerate instead.")
+    r.append(" */")
+    r.append("")
+    r.append('#include "world_cities.h"')
+    r.append("")
+    r.append(f"const int world_cities_count = {len(cities)};")
+    r.append("")
+    r.append("// Names, NUL-separated; a name equal to or ending another one points into it")
+    r.append("const char world_city_names[] =")
+    for i, name in enumerate(stored):
+        end = "\\0" if i < len(stored) - 1 else ""
+        term = ";" if i == len(stored) - 1 else ""
+        r.append(f'    "{c_string(name)}{end}"{term}')
+    r.append("")
+    r.append("// Latitude, longitude in 1e-5 degrees")
+    r.append(f"const city_position_t world_city_positions[{len(cities)}] = {{")
+    for kind, item in rows:
+        if kind == "heading":
+            r.append(f"    // {item}")
+        else:
+            r.append(f"    {{ {item['lat']}, {item['lon']} }}, // {item['name']}")
+    r.append("};")
+    r.append("")
+    r.append("// Name offset, zone, country")
+    r.append(f"const city_record_t world_city_records[{len(cities)}] = {{")
+    for kind, item in rows:
+        if kind == "heading":
+            r.append(f"    // {item}")
+        else:
+            cc = item["country"]
+            r.append(f"    {{ {offsets[item['name']]}, TZ_{item['zone']}, {{ '{cc[0]}', '{cc[1]}' }} }},"
+                     f" // {item['name']}")
+    r.append("};")
+    out.write("\n".join(r) + "\n")
+    return len(cities), pool_len, total
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("-i", "--input", default="tools/world_cities.csv")
+    parser.add_argument("-o", "--output", default="src/world_cities_data.c")
+    args = parser.parse_args()
+
+    rows = load_cities(args.input, load_zones(TZ_RULES_H))
+    with open(args.output, "w", newline="\n") as out:
+        count, pool_len, total = emit(rows, out)
+    print(f"{count} cities, name pool {pool_len} bytes, table {total} bytes")
+
+
+if __name__ == "__main__":
+    main()
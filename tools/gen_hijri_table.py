@@ -0,0 +1,406 @@
+#!/usr/bin/env python3
+"""Generate src/hijri_table.h, the Umm al-Qura month-length table used by src/hijri.c.
+
+Month starts are computed with the current Umm al-Qura rule: on the evening of the
+29th day of a month, if the geocentric conjunction has occurred before sunset at
+Mecca and the moon sets after the sun, the next day starts the new month;
+otherwise the month has 30 days.
+
+The astronomy is Meeus (new moon ch.49, sun ch.25, moon ch.47 main terms), good to
+about a minute for the conjunction and a few hundredths of a degree for positions.
+Before 1420 AH the official calendar used different criteria, and borderline
+evenings may differ from the published tables. Official month starts can be forced
+with --official FILE, a CSV of "hijri_year,hijri_month,YYYY-MM-DD" lines; those rows
+override the computed ones.
+
+tests/host/test_hijri.c checks every day of the table range, and
+"make -C tests/host" checks the committed table is this script's output.
+
+Usage: tools/gen_hijri_table.py [--official FILE] [-o src/hijri_table.h]
+"""
+
+import argparse
+import datetime
+import math
+import sys
+
+FIRST_YEAR = 1300
+LAST_YEAR = 1600
+
+MECCA_LAT = 21.4225
+MECCA_LON = 39.8262
+MECCA_UTC_OFFSET = 3.0
+
+# Tabular (arithmetic) Islamic calendar epoch: 1 Muharram 1 AH = JD 1948439.5
+TABULAR_EPOCH_JD = 1948440
+ORDINAL_EPOCH_JD = 2451545  # 2000-01-01
+
+
+def sind(x):
+    return math.sin(math.radians(x))
+
+
+def cosd(x):
+    return math.cos(math.radians(x))
+
+
+# --- Calendar helpers (day ordinal = days since 2000-01-01) -------------------
+
+def ordinal_from_date(d):
+    return (d - datetime.date(2000, 1, 1)).days
+
+
+def date_from_ordinal(n):
+    return datetime.date(2000, 1, 1) + datetime.timedelta(days=n)
+
+
+def tabular_year_start(year):
+    """Day ordinal of 1 Muharram in the tabular calendar (must match hijri.c)."""
+    return (year - 1) * 354 + (3 + 11 * year) // 30 + TABULAR_EPOCH_JD - ORDINAL_EPOCH_JD
+
+
+# --- Time scales --------------------------------------------------------------
+
+def delta_t_seconds(year):
+    """TT - UT, Espenak & Meeus polynomials (1860 onwards)."""
+    y = year
+    if y < 1900:
+        t = y - 1860
+        return (7.62 + 0.5737 * t - 0.251754 * t ** 2 + 0.01680668 * t ** 3
+                - 0.0004473624 * t ** 4 + t ** 5 / 233174)
+    if y < 1920:
+        t = y - 1900
+        return -2.79 + 1.494119 * t - 0.0598939 * t ** 2 + 0.0061966 * t ** 3 - 0.000197 * t ** 4
+    if y < 1941:
+        t = y - 1920
+        return 21.20 + 0.84493 * t - 0.076100 * t ** 2 + 0.0020936 * t ** 3
+    if y < 1961:
+        t = y - 1950
+        return 29.07 + 0.407 * t - t ** 2 / 233 + t ** 3 / 2547
+    if y < 1986:
+        t = y - 1975
+        return 45.45 + 1.067 * t - t ** 2 / 260 - t ** 3 / 718
+    if y < 2005:
+        t = y - 2000
+        return (63.86 + 0.3345 * t - 0.060374 * t ** 2 + 0.0017275 * t ** 3
+                + 0.000651814 * t ** 4 + 0.00002373599 * t ** 5)
+    if y < 2050:
+        t = y - 2000
+        return 62.92 + 0.32217 * t + 0.005589 * t ** 2
+    u = (y - 1820) / 100.0
+    if y < 2150:
+        return -20 + 32 * u * u - 0.5628 * (2150 - y)
+    return -20 + 32 * u * u
+
+
+def jd_to_year(jd):
+    return 2000.0 + (jd - 2451545.0) / 365.25
+
+
+# --- New moon (Meeus ch.49) ---------------------------------------------------
+
+def new_moon_jde(k):
+    t = k / 1236.85
+    jde = (2451550.09766 + 29.530588861 * k + 0.00015437 * t ** 2
+           - 0.000000150 * t ** 3 + 0.00000000073 * t ** 4)
+    e = 1 - 0.002516 * t - 0.0000074 * t ** 2
+    m = 2.5534 + 29.10535670 * k - 0.0000014 * t ** 2 - 0.00000011 * t ** 3
+    mp = (201.5643 + 385.81693528 * k + 0.0107582 * t ** 2 + 0.00001238 * t ** 3
+          - 0.000000058 * t ** 4)
+    f = (160.7108 + 390.67050284 * k - 0.0016118 * t ** 2 - 0.00000227 * t ** 3
+         + 0.000000011 * t ** 4)
+    om = 124.7746 - 1.56375588 * k + 0.0020672 * t ** 2 + 0.00000215 * t ** 3
+
+    jde += (-0.40720 * sind(mp) + 0.17241 * e * sind(m) + 0.01608 * sind(2 * mp)
+            + 0.01039 * sind(2 * f) + 0.00739 * e * sind(mp - m) - 0.00514 * e * sind(mp + m)
+            + 0.00208 * e * e * sind(2 * m) - 0.00111 * sind(mp - 2 * f)
+            - 0.00057 * sind(mp + 2 * f) + 0.00056 * e * sind(2 * mp + m)
+            - 0.00042 * sind(3 * mp) + 0.00042 * e * sind(m + 2 * f)
+            + 0.00038 * e * sind(m - 2 * f) - 0.00024 * e * sind(2 * mp - m)
+            - 0.00017 * sind(om) - 0.00007 * sind(mp + 2 * m) + 0.00004 * sind(2 * mp - 2 * f)
+            + 0.00004 * sind(3 * m) + 0.00003 * sind(mp + m - 2 * f)
+            + 0.00003 * sind(2 * mp + 2 * f) - 0.00003 * sind(mp + m + 2 * f)
+            + 0.00003 * sind(mp - m + 2 * f) - 0.00002 * sind(mp - m - 2 * f)
+            - 0.00002 * sind(3 * mp + m) + 0.00002 * sind(4 * mp))
+
+    planetary = (
+        (0.000325, 299.77 + 0.107408 * k - 0.009173 * t ** 2),
+        (0.000165, 251.88 + 0.016321 * k),
+        (0.000164, 251.83 + 26.651886 * k),
+        (0.000126, 349.42 + 36.412478 * k),
+        (0.000110, 84.66 + 18.206239 * k),
+        (0.000062, 141.74 + 53.303771 * k),
+        (0.000060, 207.14 + 2.453732 * k),
+        (0.000056, 154.84 + 7.306860 * k),
+        (0.000047, 34.52 + 27.261239 * k),
+        (0.000042, 207.19 + 0.121824 * k),
+        (0.000040, 291.34 + 1.844379 * k),
+        (0.000037, 161.72 + 24.198154 * k),
+        (0.000035, 239.56 + 25.513099 * k),
+        (0.000023, 331.55 + 3.592518 * k),
+    )
+    jde += sum(c * sind(a) for c, a in planetary)
+    return jde
+
+
+def new_moon_ut(k):
+    jde = new_moon_jde(k)
+    return jde - delta_t_seconds(jd_to_year(jde)) / 86400.0
+
+
+# --- Sun and moon positions ---------------------------------------------------
+
+def obliquity(t):
+    om = 125.04 - 1934.136 * t
+    return 23.439291 - 0.0130042 * t + 0.00256 * cosd(om)
+
+
+def sun_equatorial(jde):
+    """Apparent right ascension and declination of the sun (Meeus ch.25)."""
+    t = (jde - 2451545.0) / 36525.0
+    l0 = 280.46646 + 36000.76983 * t + 0.0003032 * t * t
+    m = 357.52911 + 35999.05029 * t - 0.0001537 * t * t
+    c = ((1.914602 - 0.004817 * t - 0.000014 * t * t) * sind(m)
+         + (0.019993 - 0.000101 * t) * sind(2 * m) + 0.000289 * sind(3 * m))
+    om = 125.04 - 1934.136 * t
+    lam = l0 + c - 0.00569 - 0.00478 * sind(om)
+    eps = obliquity(t)
+    ra = math.degrees(math.atan2(cosd(eps) * sind(lam), cosd(lam)))
+    dec = math.degrees(math.asin(sind(eps) * sind(lam)))
+    return ra, dec
+
+
+# (D, M, M', F, coefficient) - main terms of Meeus tables 47.A and 47.B
+MOON_LON_TERMS = (
+    (0, 0, 1, 0, 6288774), (2, 0, -1, 0, 1274027), (2, 0, 0, 0, 658314),
+    (0, 0, 2, 0, 213618), (0, 1, 0, 0, -185116), (0, 0, 0, 2, -114332),
+    (2, 0, -2, 0, 58793), (2, -1, -1, 0, 57066), (2, 0, 1, 0, 53322),
+    (2, -1, 0, 0, 45758), (0, 1, -1, 0, -40923), (1, 0, 0, 0, -34720),
+    (0, 1, 1, 0, -30383), (2, 0, 0, -2, 15327), (0, 0, 1, 2, -12528),
+    (0, 0, 1, -2, 10980), (4, 0, -1, 0, 10675), (0, 0, 3, 0, 10034),
+    (4, 0, -2, 0, 8548), (2, 1, -1, 0, -7888), (2, 1, 0, 0, -6766),
+    (1, 0, -1, 0, -5163), (1, 1, 0, 0, 4987), (2, -1, 1, 0, 4036),
+    (2, 0, 2, 0, 3994), (4, 0, 0, 0, 3861), (2, 0, -3, 0, 3665),
+    (0, 1, -2, 0, -2689), (2, 0, -1, 2, -2602), (2, -1, -2, 0, 2390),
+    (1, 0, 1, 0, -2348), (2, -2, 0, 0, 2236), (0, 1, 2, 0, -2120),
+    (0, 2, 0, 0, -2069),
+)
+
+MOON_DIST_TERMS = (
+    (0, 0, 1, 0, -20905355), (2, 0, -1, 0, -3699111), (2, 0, 0, 0, -2955968),
+    (0, 0, 2, 0, -569925), (0, 1, 0, 0, 48888), (0, 0, 0, 2, -3149),
+    (2, 0, -2, 0, 246158), (2, -1, -1, 0, -152138), (2, 0, 1, 0, -170733),
+    (2, -1, 0, 0, -204586), (0, 1, -1, 0, -129620), (1, 0, 0, 0, 108743),
+    (0, 1, 1, 0, 104755),
+)
+
+MOON_LAT_TERMS = (
+    (0, 0, 0, 1, 5128122), (0, 0, 1, 1, 280602), (0, 0, 1, -1, 277693),
+    (2, 0, 0, -1, 173237), (2, 0, -1, 1, 55413), (2, 0, -1, -1, 46271),
+    (2, 0, 0, 1, 32573), (0, 0, 2, 1, 17198), (2, 0, 1, -1, 9266),
+    (0, 0, 2, -1, 8822), (2, -1, 0, -1, 8216), (2, 0, -2, -1, 4324),
+    (2, 0, 1, 1, 4200), (2, 1, 0, -1, -3359), (2, -1, -1, 1, 2463),
+)
+
+
+def moon_equatorial(jde):
+    """Geocentric right ascension, declination and horizontal parallax of the moon."""
+    t = (jde - 2451545.0) / 36525.0
+    lp = (218.3164477 + 481267.88123421 * t - 0.0015786 * t ** 2 + t ** 3 / 538841
+          - t ** 4 / 65194000)
+    d = (297.8501921 + 445267.1114034 * t - 0.0018819 * t ** 2 + t ** 3 / 545868
+         - t ** 4 / 113065000)
+    m = 357.5291092 + 35999.0502909 * t - 0.0001536 * t ** 2 + t ** 3 / 24490000
+    mp = (134.9633964 + 477198.8675055 * t + 0.0087414 * t ** 2 + t ** 3 / 69699
+          - t ** 4 / 14712000)
+    f = (93.2720950 + 483202.0175233 * t - 0.0036539 * t ** 2 - t ** 3 / 3526000
+         + t ** 4 / 863310000)
+    e = 1 - 0.002516 * t - 0.0000074 * t * t
+    a1 = 119.75 + 131.849 * t
+    a2 = 53.09 + 479264.290 * t
+    a3 = 313.45 + 481266.484 * t
+
+    def series(terms, fn):
+        total = 0.0
+        for cd, cm, cmp, cf, coeff in terms:
+            arg = cd * d + cm * m + cmp * mp + cf * f
+            total += coeff * (e ** abs(cm)) * fn(arg)
+        return total
+
+    sl = series(MOON_LON_TERMS, sind) + 3958 * sind(a1) + 1962 * sind(lp - f) + 318 * sind(a2)
+    sb = (series(MOON_LAT_TERMS, sind) - 2235 * sind(lp) + 382 * sind(a3)
+          + 175 * sind(a1 - f) + 175 * sind(a1 + f) + 127 * sind(lp - mp) - 115 * sind(lp + mp))
+    sr = series(MOON_DIST_TERMS, cosd)
+
+    om = 125.04452 - 1934.136261 * t
+    dpsi = (-17.20 * sind(om) - 1.32 * sind(2 * (280.4665 + 36000.7698 * t))
+            - 0.23 * sind(2 * lp) + 0.21 * sind(2 * om)) / 3600.0
+
+    lam = lp + sl / 1e6 + dpsi
+    beta = sb / 1e6
+    dist = 385000.56 + sr / 1000.0
+    eps = obliquity(t)
+
+    ra = math.degrees(math.atan2(sind(lam) * cosd(eps) - math.tan(math.radians(beta)) * sind(eps),
+                                 cosd(lam)))
+    dec = math.degrees(math.asin(sind(beta) * cosd(eps) + cosd(beta) * sind(eps) * sind(lam)))
+    parallax = math.degrees(math.asin(6378.14 / dist))
+    return ra, dec, parallax
+
+
+def altitude(jd_ut, ra, dec, lat, lon):
+    t = (jd_ut - 2451545.0) / 36525.0
+    gmst = (280.46061837 + 360.98564736629 * (jd_ut - 2451545.0) + 0.000387933 * t * t
+            - t ** 3 / 38710000)
+    h = gmst + lon - ra
+    return math.degrees(math.asin(sind(lat) * sind(dec) + cosd(lat) * cosd(dec) * cosd(h)))
+
+
+def sun_altitude(jd_ut):
+    jde = jd_ut + delta_t_seconds(jd_to_year(jd_ut)) / 86400.0
+    ra, dec = sun_equatorial(jde)
+    return altitude(jd_ut, ra, dec, MECCA_LAT, MECCA_LON)
+
+
+def sunset_ut(ordinal):
+    """Sunset at Mecca (JD, UT) on the local civil date given as a day ordinal."""
+    local_midnight = ordinal + ORDINAL_EPOCH_JD - 0.5 - MECCA_UTC_OFFSET / 24.0
+    lo = local_midnight + 15.0 / 24.0
+    hi = local_midnight + 21.0 / 24.0
+    for _ in range(40):
+        mid = 0.5 * (lo + hi)
+        if sun_altitude(mid) > -0.8333:
+            lo = mid
+        else:
+            hi = mid
+    return 0.5 * (lo + hi)
+
+
+def moon_sets_after_sun(jd_sunset):
+    jde = jd_sunset + delta_t_seconds(jd_to_year(jd_sunset)) / 86400.0
+    ra, dec, parallax = moon_equatorial(jde)
+    # Geocentric altitude of the moon's upper limb on the horizon (Meeus ch.15)
+    h0 = 0.7275 * parallax - 0.5667
+    return altitude(jd_sunset, ra, dec, MECCA_LAT, MECCA_LON) > h0
+
+
+def last_conjunction_before(jd_ut):
+    k = math.floor((jd_ut - 2451550.1) / 29.530588861)
+    for kk in (k + 1, k, k - 1):
+        tc = new_moon_ut(kk)
+        if tc < jd_ut:
+            return tc
+    return new_moon_ut(k - 2)
+
+
+# --- Month starts -------------------------------------------------------------
+
+def next_month_start(start):
+    """Given the day ordinal of a month's first day, return the next month's."""
+    day29 = start + 28
+    jd_sunset = sunset_ut(day29)
+    conjunction = last_conjunction_before(jd_sunset)
+    started_this_month = conjunction > (start + ORDINAL_EPOCH_JD + 14)
+    if started_this_month and moon_sets_after_sun(jd_sunset):
+        return start + 29
+    return start + 30
+
+
+def compute_month_starts(official):
+    # Start two years early from the tabular estimate; the rule converges within a few months
+    start = tabular_year_start(FIRST_YEAR - 2)
+    starts = {}
+    for year in range(FIRST_YEAR - 2, LAST_YEAR + 2):
+        for month in range(1, 13):
+            if (year, month) in official:
+                start = official[(year, month)]
+            starts[(year, month)] = start
+            start = next_month_start(start)
+    return starts
+
+
+def load_official(path):
+    official = {}
+    if not path:
+        return official
+    with open(path) as fh:
+        for line in fh:
+            line = line.strip()
+            if not line or line.startswith('#'):
+                continue
+            year, month, date = line.split(',')
+            official[(int(year), int(month))] = ordinal_from_date(datetime.date.fromisoformat(date))
+    return official
+
+
+def build_table(starts):
+    lengths = []
+    deltas = []
+    for year in range(FIRST_YEAR, LAST_YEAR + 1):
+        bits = 0
+        for month in range(1, 13):
+            nxt = starts[(year, month + 1)] if month < 12 else starts[(year + 1, 1)]
+            length = nxt - starts[(year, month)]
+            if length not in (29, 30):
+                sys.exit(f"bad month length {length} for {year}/{month}")
+            if length == 30:
+                bits |= 1 << (month - 1)
+        delta = starts[(year, 1)] - tabular_year_start(year)
+        if not -128 <= delta <= 127:
+            sys.exit(f"year start delta {delta} for {year} does not fit int8")
+        lengths.append(bits)
+        deltas.append(delta)
+    return lengths, deltas
+
+
+def emit(lengths, deltas, out):
+    first = date_from_ordinal(tabular_year_start(FIRST_YEAR) + deltas[0])
+    rows = []
+    rows.append("/**")
+    rows.append(" * @file hijri_table.h")
+    rows.append(" * @brief Umm al-Qura month-length table (generated by tools/gen_hijri_table.py)")
+    rows.append(" *")
+    rows.append(f" * Covers {FIRST_YEAR}-{LAST_YEAR} AH; 1 Muharram {FIRST_YEAR} = {first.isoformat()}.")
+    rows.append(" * Do not edit by hand, regenerate instead.")
+    rows.append(" */")
+    rows.append("")
+    rows.append("#ifndef HIJRI_TABLE_H")
+    rows.append("#define HIJRI_TABLE_H")
+    rows.append("")
+    rows.append("#include <stdint.h>")
+    rows.append("")
+    rows.append(f"#define HIJRI_TABLE_FIRST_YEAR {FIRST_YEAR}")
+    rows.append(f"#define HIJRI_TABLE_LAST_YEAR  {LAST_YEAR}")
+    rows.append("")
+    rows.append("// Bit (month - 1) set: the month has 30 days, otherwise 29")
+    rows.append(f"static const uint16_t hijri_month_lengths[{len(lengths)}] = {{")
+    for i in range(0, len(lengths), 10):
+        chunk = ", ".join(f"0x{v:03x}" for v in lengths[i:i + 10])
+        rows.append(f"    {chunk}, // {FIRST_YEAR + i}")
+    rows.append("};")
+    rows.append("")
+    rows.append("// First day of each year minus the tabular calendar's first day, in days")
+    rows.append(f"static const int8_t hijri_year_start_delta[{len(deltas)}] = {{")
+    for i in range(0, len(deltas), 20):
+        chunk = ", ".join(f"{v:2d}" for v in deltas[i:i + 20])
+        rows.append(f"    {chunk}, // {FIRST_YEAR + i}")
+    rows.append("};")
+    rows.append("")
+    rows.append("#endif // HIJRI_TABLE_H")
+    out.write("\n".join(rows) + "\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--official", help="CSV of official month starts to override computed ones")
+    parser.add_argument("-o", "--output", default="src/hijri_table.h")
+    args = parser.parse_args()
+
+    starts = compute_month_starts(load_official(args.official))
+    lengths, deltas = build_table(starts)
+    with open(args.output, "w") as out:
+        emit(lengths, deltas, out)
+
+
+if __name__ == "__main__":
+    main()